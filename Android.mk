@@ -121,6 +121,7 @@ LOCAL_LDLIBS := \
 
 ifeq ($(OTBR_MDNS),mDNSResponder)
 LOCAL_SRC_FILES += \
+    src/mdns/mdns.cpp \
     src/mdns/mdns_mdnssd.cpp \
 
 LOCAL_SHARED_LIBRARIES += libmdnssd
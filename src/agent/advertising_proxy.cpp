@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   The file implements the advertising proxy of the hosts and services registered with SRP.
+ */
+
+#include "agent/advertising_proxy.hpp"
+
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
+    : mNcp(aNcp)
+    , mPublisher(aPublisher)
+    , mHosts(aPublisher)
+{
+}
+
+void AdvertisingProxy::Start(void)
+{
+    otSrpServerSetServiceUpdateHandler(mNcp.GetInstance(), HandleServiceUpdate, this);
+    otSrpServerSetEnabled(mNcp.GetInstance(), true);
+    mNcp.RegisterResetHandler([this]() { HandleReset(); });
+}
+
+void AdvertisingProxy::HandleReset(void)
+{
+    // The registrations are lost with the OpenThread instance, the SRP clients register again.
+    mHosts.Clear();
+    otSrpServerSetServiceUpdateHandler(mNcp.GetInstance(), HandleServiceUpdate, this);
+    otSrpServerSetEnabled(mNcp.GetInstance(), true);
+}
+
+void AdvertisingProxy::PublishPending(void)
+{
+    mHosts.PublishPending();
+}
+
+void AdvertisingProxy::HandleServiceUpdate(otSrpServerServiceUpdateId aId,
+                                           const otSrpServerHost *    aHost,
+                                           uint32_t                   aTimeout,
+                                           void *                     aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimeout);
+
+    static_cast<AdvertisingProxy *>(aContext)->HandleServiceUpdate(aId, *aHost);
+}
+
+void AdvertisingProxy::HandleServiceUpdate(otSrpServerServiceUpdateId aId, const otSrpServerHost &aHost)
+{
+    otbrError error  = UpdateHost(aHost);
+    otError   result = OT_ERROR_NONE;
+
+    otbrLogResult(error, "Advertise SRP host %s", otSrpServerHostGetFullName(&aHost));
+
+    // The update is kept and published once the MDNS service is started, instead of failing the SRP client. Names
+    // out of the domain are not advertised but still served by the SRP server.
+    if (error != OTBR_ERROR_NONE && error != OTBR_ERROR_PARSE && mPublisher.IsStarted())
+    {
+        result = OT_ERROR_FAILED;
+    }
+
+    otSrpServerHandleServiceUpdateResult(mNcp.GetInstance(), aId, result);
+}
+
+otbrError AdvertisingProxy::UpdateHost(const otSrpServerHost &aHost)
+{
+    const char *                                     domain = otSrpServerGetDomain(mNcp.GetInstance());
+    std::string                                      name;
+    const otIp6Address *                             addresses;
+    uint8_t                                          numAddresses = 0;
+    std::vector<Ip6Address>                          hostAddresses;
+    std::vector<Mdns::AdvertisedHosts::Registration> registrations;
+    const otSrpServerService *                       service = nullptr;
+    otbrError                                        error   = OTBR_ERROR_NONE;
+
+    VerifyOrExit(Mdns::AdvertisedHosts::StripDomain(otSrpServerHostGetFullName(&aHost), domain, name),
+                 error = OTBR_ERROR_PARSE);
+
+    if (otSrpServerHostIsDeleted(&aHost))
+    {
+        mHosts.Remove(name);
+        ExitNow();
+    }
+
+    addresses = otSrpServerHostGetAddresses(&aHost, &numAddresses);
+
+    for (uint8_t index = 0; index < numAddresses; index++)
+    {
+        hostAddresses.emplace_back(addresses[index].mFields.m8);
+    }
+
+    while ((service = otSrpServerHostGetNextService(&aHost, service)) != nullptr)
+    {
+        std::string    serviceName;
+        const uint8_t *txtData;
+        uint16_t       txtLength = 0;
+
+        if (!Mdns::AdvertisedHosts::StripDomain(otSrpServerServiceGetFullName(service), domain, serviceName))
+        {
+            otbrLog(OTBR_LOG_WARNING, "Ignore SRP service %s", otSrpServerServiceGetFullName(service));
+            continue;
+        }
+
+        if (otSrpServerServiceIsDeleted(service))
+        {
+            continue;
+        }
+
+        txtData = otSrpServerServiceGetTxtData(service, &txtLength);
+        registrations.push_back({serviceName, otSrpServerServiceGetPort(service),
+                                 std::vector<uint8_t>(txtData, txtData + txtLength)});
+    }
+
+    // The services deleted or no longer registered are withdrawn.
+    error = mHosts.Update(name, std::move(hostAddresses), registrations);
+
+exit:
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definition for the advertising proxy of the hosts and services registered with SRP.
+ */
+
+#ifndef OTBR_AGENT_ADVERTISING_PROXY_HPP_
+#define OTBR_AGENT_ADVERTISING_PROXY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <openthread/srp_server.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/types.hpp"
+#include "mdns/advertised_hosts.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+/**
+ * @addtogroup border-router-border-agent
+ *
+ * @{
+ */
+
+/**
+ * This class implements the advertising proxy, which publishes the hosts and services registered with the SRP server
+ * of OpenThread on the backbone with mDNS.
+ *
+ * Only the addresses and services changed since the previous update of a host are sent again, so that the refreshes
+ * of the SRP clients cost no multicast.
+ *
+ */
+class AdvertisingProxy
+{
+public:
+    /**
+     * The constructor to initialize the advertising proxy.
+     *
+     * @param[in]   aNcp            A reference to the NCP controller.
+     * @param[in]   aPublisher      A reference to the MDNS publisher.
+     *
+     */
+    AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher);
+
+    /**
+     * This method starts handling the updates of the SRP server, also after each reset of the NCP.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method publishes the hosts and services failed to be published, when the MDNS service becomes ready.
+     *
+     */
+    void PublishPending(void);
+
+private:
+    static void HandleServiceUpdate(otSrpServerServiceUpdateId aId,
+                                    const otSrpServerHost *    aHost,
+                                    uint32_t                   aTimeout,
+                                    void *                     aContext);
+    void        HandleServiceUpdate(otSrpServerServiceUpdateId aId, const otSrpServerHost &aHost);
+    otbrError   UpdateHost(const otSrpServerHost &aHost);
+    void        HandleReset(void);
+
+    Ncp::ControllerOpenThread &mNcp;
+    Mdns::Publisher &          mPublisher;
+    Mdns::AdvertisedHosts      mHosts; ///< The hosts by name without the domain.
+};
+
+/**
+ * @}
+ */
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_ADVERTISING_PROXY_HPP_
@@ -43,17 +43,53 @@ namespace otbr {
 AgentInstance::AgentInstance(Ncp::Controller *aNcp)
     : mNcp(aNcp)
     , mBorderAgent(aNcp)
+    , mNcpInitDuration(0)
 {
 }
 
+void AgentInstance::StartInit(void)
+{
+    mBorderAgent.Restore();
+    mNcpInit = std::async(std::launch::async, [this]() { return InitNcp(); });
+}
+
+bool AgentInstance::IsNcpInitDone(void) const
+{
+    return mNcpInit.valid() && mNcpInit.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+otbrError AgentInstance::InitNcp(void)
+{
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    otbrError                             error     = mNcp->Init();
+
+    mNcpInitDuration = std::chrono::steady_clock::now() - startTime;
+
+    return error;
+}
+
 otbrError AgentInstance::Init(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
 
-    SuccessOrExit(error = mNcp->Init());
+    otbrError                error;
+    steady_clock::time_point startTime = steady_clock::now();
+    steady_clock::time_point ncpTime;
+
+    // The NCP initialization waits for the RCP, which is the longest startup phase.
+    error   = mNcpInit.valid() ? mNcpInit.get() : InitNcp();
+    ncpTime = steady_clock::now();
+    SuccessOrExit(error);
 
     mBorderAgent.Init();
 
+    otbrLog(OTBR_LOG_INFO, "Startup phases: ncp %ld ms (waited %ld ms), border agent %ld ms",
+            static_cast<long>(duration_cast<milliseconds>(mNcpInitDuration).count()),
+            static_cast<long>(duration_cast<milliseconds>(ncpTime - startTime).count()),
+            static_cast<long>(duration_cast<milliseconds>(steady_clock::now() - ncpTime).count()));
+
 exit:
     otbrLogResult(error, "Initialize OpenThread Border Router Agent");
     return error;
@@ -72,8 +108,24 @@ void AgentInstance::Process(const otSysMainloopContext &aMainloop)
     mBorderAgent.Process(aMainloop.mReadFdSet, aMainloop.mWriteFdSet, aMainloop.mErrorFdSet);
 }
 
+void AgentInstance::UpdateStartingFdSet(otSysMainloopContext &aMainloop)
+{
+    mBorderAgent.UpdateFdSet(aMainloop.mReadFdSet, aMainloop.mWriteFdSet, aMainloop.mErrorFdSet, aMainloop.mMaxFd,
+                             aMainloop.mTimeout);
+}
+
+void AgentInstance::ProcessStarting(const otSysMainloopContext &aMainloop)
+{
+    mBorderAgent.Process(aMainloop.mReadFdSet, aMainloop.mWriteFdSet, aMainloop.mErrorFdSet);
+}
+
 AgentInstance::~AgentInstance(void)
 {
+    if (mNcpInit.valid())
+    {
+        mNcpInit.wait();
+    }
+
     Ncp::Controller::Destroy(mNcp);
 }
 
@@ -36,6 +36,9 @@
 
 #include "openthread-br/config.h"
 
+#include <chrono>
+#include <future>
+
 #include <stdarg.h>
 #include <stdint.h>
 #include <sys/select.h>
@@ -65,7 +68,25 @@ public:
     ~AgentInstance(void);
 
     /**
-     * This method initialize the agent.
+     * This method starts initializing the NCP on another thread, so that the services not relying on the NCP can be
+     * started meanwhile. The border agent service is restored from the state cache.
+     *
+     * Nothing may access the NCP until `Init()` returns.
+     *
+     */
+    void StartInit(void);
+
+    /**
+     * This method indicates whether the NCP initialization started by `StartInit()` is completed.
+     *
+     * @retval  TRUE   The NCP initialization is completed, `Init()` does not wait for it.
+     * @retval  FALSE  The NCP is still being initialized.
+     *
+     */
+    bool IsNcpInitDone(void) const;
+
+    /**
+     * This method initialize the agent, waiting for the NCP initialization if started by `StartInit()`.
      *
      * @retval  OTBR_ERROR_NONE     Agent initialized successfully.
      * @retval  OTBR_ERROR_ERRNO    Failed due to error indicated in errno.
@@ -89,6 +110,23 @@ public:
      */
     void Process(const otSysMainloopContext &aMainloop);
 
+    /**
+     * This method updates the file descriptor sets and timeout for mainloop while the NCP is being initialized, only
+     * the services not relying on the NCP are served.
+     *
+     * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
+     *
+     */
+    void UpdateStartingFdSet(otSysMainloopContext &aMainloop);
+
+    /**
+     * This method performs processing while the NCP is being initialized.
+     *
+     * @param[in]       aMainloop   A reference to OpenThread mainloop context.
+     *
+     */
+    void ProcessStarting(const otSysMainloopContext &aMainloop);
+
     /**
      * This method return mNcp pointer.
      *
@@ -98,8 +136,12 @@ public:
     Ncp::Controller &GetNcp(void) { return *mNcp; }
 
 private:
-    Ncp::Controller *mNcp;
-    BorderAgent      mBorderAgent;
+    otbrError InitNcp(void);
+
+    Ncp::Controller *                   mNcp;
+    BorderAgent                         mBorderAgent;
+    std::future<otbrError>              mNcpInit;
+    std::chrono::steady_clock::duration mNcpInitDuration;
 };
 
 } // namespace otbr
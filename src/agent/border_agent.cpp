@@ -33,6 +33,8 @@
 
 #include "agent/border_agent.hpp"
 
+#include <chrono>
+
 #include <arpa/inet.h>
 #include <assert.h>
 #include <errno.h>
@@ -49,10 +51,12 @@
 #include "agent/ncp_openthread.hpp"
 #include "agent/uris.hpp"
 #include "common/code_utils.hpp"
+#include "common/health.hpp"
 #include "common/logging.hpp"
 #include "common/tlv.hpp"
 #include "common/types.hpp"
 #include "utils/hex.hpp"
+#include "utils/state_cache.hpp"
 #include "utils/strcpy_utils.hpp"
 
 namespace otbr {
@@ -62,6 +66,10 @@ static const uint16_t kThreadVersion12 = 3; ///< Thread Version 1.2
 
 static const char kBorderAgentServiceType[] = "_meshcop._udp."; ///< Border agent service type of mDNS
 
+// The delay from the first change of the service to its publication, so that the network name, extended PAN ID and
+// Thread version reported on attaching are announced in one update.
+static const std::chrono::milliseconds kPublishDelay(100);
+
 /**
  * Locators
  *
@@ -81,6 +89,17 @@ enum
     kBorderAgentUdpPort = 49191, ///< Thread commissioning port.
 };
 
+/**
+ * Types of the TLVs of the border agent record of the state cache.
+ *
+ */
+enum
+{
+    kStateNetworkName   = 0, ///< The network name.
+    kStateExtPanId      = 1, ///< The extended PAN ID.
+    kStateThreadVersion = 2, ///< The Thread version.
+};
+
 BorderAgent::BorderAgent(Ncp::Controller *aNcp)
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
     : mPublisher(Mdns::Publisher::Create(AF_UNSPEC, nullptr, nullptr, HandleMdnsState, this))
@@ -89,50 +108,106 @@ BorderAgent::BorderAgent(Ncp::Controller *aNcp)
 #endif
     , mNcp(aNcp)
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    , mBackboneAgent(*reinterpret_cast<Ncp::ControllerOpenThread *>(aNcp))
+    , mBackboneAgent(*static_cast<Ncp::ControllerOpenThread *>(aNcp))
+#endif
+#if OTBR_ENABLE_MESHCOP_PROXY
+    , mMeshcopProxy(kBorderAgentUdpPort)
 #endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    , mAdvertisingProxy(*static_cast<Ncp::ControllerOpenThread *>(aNcp), *mPublisher)
+#endif
+    , mExtPanIdInitialized(false)
+    , mThreadVersion(0)
     , mThreadStarted(false)
+    , mPSKcInitialized(false)
+    , mRestored(false)
+    , mPublishTimer(HandlePublishTimer, this)
+    , mNetworkNameChanged(false)
+    , mServiceHandle(Mdns::kInvalidServiceHandle)
 {
+    memset(mNetworkName, 0, sizeof(mNetworkName));
+    memset(mExtPanId, 0, sizeof(mExtPanId));
 }
 
 void BorderAgent::Init(void)
 {
-    memset(mNetworkName, 0, sizeof(mNetworkName));
-    memset(mExtPanId, 0, sizeof(mExtPanId));
-    mExtPanIdInitialized = false;
-    mThreadVersion       = 0;
-
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    mNcp->On(Ncp::kEventExtPanId, HandleExtPanId, this);
-    mNcp->On(Ncp::kEventNetworkName, HandleNetworkName, this);
-    mNcp->On(Ncp::kEventThreadVersion, HandleThreadVersion, this);
+    mNcp->On<Ncp::kEventExtPanId>(HandleExtPanId, this);
+    mNcp->On<Ncp::kEventNetworkName>(HandleNetworkName, this);
+    mNcp->On<Ncp::kEventThreadVersion>(HandleThreadVersion, this);
 #endif
-    mNcp->On(Ncp::kEventThreadState, HandleThreadState, this);
-    mNcp->On(Ncp::kEventPSKc, HandlePSKc, this);
+    mNcp->On<Ncp::kEventThreadState>(HandleThreadState, this);
+    mNcp->On<Ncp::kEventPSKc>(HandlePSKc, this);
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
     mBackboneAgent.Init();
 #endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mAdvertisingProxy.Start();
+#endif
 
     otbrLogResult(mNcp->RequestEvent(Ncp::kEventThreadState), "Check if Thread is up");
     otbrLogResult(mNcp->RequestEvent(Ncp::kEventPSKc), "Check if PSKc is initialized");
 }
 
+void BorderAgent::Restore(void)
+{
+    const std::vector<uint8_t> *record = StateCache::Get().Find(StateCache::kRecordBorderAgent);
+    const Tlv *                 tlv;
+
+    VerifyOrExit(record != nullptr);
+
+    tlv = TlvIterator::Find(record->data(), record->size(), kStateNetworkName);
+    VerifyOrExit(tlv != nullptr && tlv->GetLength() > 0 && tlv->GetLength() <= kSizeNetworkName);
+    memcpy(mNetworkName, tlv->GetValue(), tlv->GetLength());
+    mNetworkName[tlv->GetLength()] = '\0';
+
+    tlv = TlvIterator::Find(record->data(), record->size(), kStateExtPanId);
+    VerifyOrExit(tlv != nullptr && tlv->GetLength() == sizeof(mExtPanId));
+    memcpy(mExtPanId, tlv->GetValue(), sizeof(mExtPanId));
+    mExtPanIdInitialized = true;
+
+    tlv = TlvIterator::Find(record->data(), record->size(), kStateThreadVersion);
+    VerifyOrExit(tlv != nullptr && tlv->GetLength() == sizeof(uint16_t));
+    VerifyOrExit(tlv->GetValueUInt16() == kThreadVersion11 || tlv->GetValueUInt16() == kThreadVersion12);
+    mThreadVersion = tlv->GetValueUInt16();
+
+    // The service is only published once the NCP confirms Thread is still up with PSKc initialized.
+    mRestored = true;
+
+exit:
+    otbrLog(OTBR_LOG_INFO, "Border agent service is %s", (mRestored ? "restored" : "not restored"));
+}
+
 otbrError BorderAgent::Start(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error    = OTBR_ERROR_NONE;
+    bool      restored = mRestored;
 
     VerifyOrExit(mThreadStarted && mPSKcInitialized, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
 
     // In case we didn't receive Thread down event.
     Stop();
 
+#if OTBR_ENABLE_MESHCOP_PROXY
+    // Commissioners can still reach the border agent directly if the proxy fails to start.
+    mMeshcopProxy.Start();
+#endif
+
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+    // The restored service is published at once, then updated below with the live state.
+    if (restored)
+    {
+        StartPublishService();
+    }
+
     SuccessOrExit(error = mNcp->RequestEvent(Ncp::kEventNetworkName));
     SuccessOrExit(error = mNcp->RequestEvent(Ncp::kEventExtPanId));
 
     SuccessOrExit(error = mNcp->RequestEvent(Ncp::kEventThreadVersion));
-    StartPublishService();
+    SchedulePublishService();
+#else
+    OTBR_UNUSED_VARIABLE(restored);
 #endif // OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
 
     // Suppress unused warning of label exit
@@ -145,9 +220,15 @@ exit:
 
 void BorderAgent::Stop(void)
 {
+    mRestored = false;
+
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+    mPublishTimer.Stop();
     StopPublishService();
 #endif
+#if OTBR_ENABLE_MESHCOP_PROXY
+    mMeshcopProxy.Stop();
+#endif
 }
 
 BorderAgent::~BorderAgent(void)
@@ -163,10 +244,15 @@ BorderAgent::~BorderAgent(void)
 
 void BorderAgent::HandleMdnsState(Mdns::State aState)
 {
+    Health::Get().SetReady(Health::kSubsystemMdns, aState == Mdns::kStateReady);
+
     switch (aState)
     {
     case Mdns::kStateReady:
         PublishService();
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+        mAdvertisingProxy.PublishPending();
+#endif
         break;
     default:
         otbrLog(OTBR_LOG_WARNING, "MDNS service not available!");
@@ -180,10 +266,6 @@ void BorderAgent::UpdateFdSet(fd_set & aReadFdSet,
                               int &    aMaxFd,
                               timeval &aTimeout)
 {
-#if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent.UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
-#endif
-
     if (mPublisher != nullptr)
     {
         mPublisher->UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
@@ -192,9 +274,6 @@ void BorderAgent::UpdateFdSet(fd_set & aReadFdSet,
 
 void BorderAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
-#if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
-#endif
     if (mPublisher != nullptr)
     {
         mPublisher->Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
@@ -223,13 +302,80 @@ void BorderAgent::PublishService(void)
     assert(mExtPanIdInitialized);
 
     assert(mThreadVersion != 0);
-    // clang-format off
-    mPublisher->PublishService(kBorderAgentUdpPort, mNetworkName, kBorderAgentServiceType,
-        "nn", mNetworkName, strlen(mNetworkName),
-        "xp", &mExtPanId, sizeof(mExtPanId),
-        "tv", versionString, strlen(versionString),
-        nullptr);
-    // clang-format on
+
+    Mdns::Publisher::TxtList txtList{{"nn", mNetworkName}, {"xp", mExtPanId}, {"tv", versionString}};
+    uint16_t                 port = kBorderAgentUdpPort;
+
+#if OTBR_ENABLE_MESHCOP_PROXY
+    if (mMeshcopProxy.IsStarted())
+    {
+        port = mMeshcopProxy.GetPort();
+    }
+#endif
+
+    mPublisher->PublishService(port, mNetworkName, kBorderAgentServiceType, txtList, &mServiceHandle);
+    SaveState();
+}
+
+otbrError BorderAgent::SaveState(void) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   buffer[3 * TlvIterator::kHeaderSize + kSizeNetworkName + kSizeExtPanId + sizeof(uint16_t)];
+    TlvWriter writer(buffer, sizeof(buffer));
+
+    // The restored service is saved again once reconciled with the live state.
+    VerifyOrExit(!mRestored);
+
+    writer.Append(kStateNetworkName, mNetworkName, static_cast<uint16_t>(strlen(mNetworkName)));
+    writer.Append(kStateExtPanId, mExtPanId, sizeof(mExtPanId));
+    writer.Append(kStateThreadVersion, mThreadVersion);
+    VerifyOrExit(!writer.IsOverflowed(), error = OTBR_ERROR_INVALID_ARGS);
+
+    StateCache::Get().Update(StateCache::kRecordBorderAgent,
+                             std::vector<uint8_t>(buffer, buffer + writer.GetLength()));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to save the border agent state: %s", otbrErrorString(error));
+    }
+
+    return error;
+}
+
+void BorderAgent::SchedulePublishService(void)
+{
+    // Later changes within the delay are folded into the same publication.
+    VerifyOrExit(!mPublishTimer.IsRunning());
+    mPublishTimer.Start(kPublishDelay);
+
+exit:
+    return;
+}
+
+void BorderAgent::HandlePublishTimer(Timer &aTimer, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+
+    static_cast<BorderAgent *>(aContext)->HandlePublishTimer();
+}
+
+void BorderAgent::HandlePublishTimer(void)
+{
+    VerifyOrExit(mThreadStarted);
+
+    if (mNetworkNameChanged && mServiceHandle != Mdns::kInvalidServiceHandle)
+    {
+        // Withdraw the service of the old name.
+        mPublisher->UnpublishService(mServiceHandle);
+        mServiceHandle = Mdns::kInvalidServiceHandle;
+    }
+
+    mNetworkNameChanged = false;
+    StartPublishService();
+
+exit:
+    return;
 }
 
 void BorderAgent::StartPublishService(void)
@@ -266,14 +412,17 @@ exit:
 
 void BorderAgent::SetNetworkName(const char *aNetworkName)
 {
+    if (strncmp(mNetworkName, aNetworkName, sizeof(mNetworkName)) != 0)
+    {
+        mNetworkNameChanged = true;
+    }
+
     strcpy_safe(mNetworkName, sizeof(mNetworkName), aNetworkName);
 
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
     if (mThreadStarted)
     {
-        // Restart publisher to publish new service name.
-        mPublisher->Stop();
-        StartPublishService();
+        SchedulePublishService();
     }
 #endif
 }
@@ -285,7 +434,7 @@ void BorderAgent::SetExtPanId(const uint8_t *aExtPanId)
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
     if (mThreadStarted)
     {
-        StartPublishService();
+        SchedulePublishService();
     }
 #endif
 }
@@ -296,18 +445,14 @@ void BorderAgent::SetThreadVersion(uint16_t aThreadVersion)
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
     if (mThreadStarted)
     {
-        StartPublishService();
+        SchedulePublishService();
     }
 #endif
 }
 
-void BorderAgent::HandlePSKc(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandlePSKc(void *aContext, const uint8_t *aPSKc)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-
-    assert(aEvent == Ncp::kEventPSKc);
-
-    static_cast<BorderAgent *>(aContext)->HandlePSKc(va_arg(aArguments, const uint8_t *));
+    static_cast<BorderAgent *>(aContext)->HandlePSKc(aPSKc);
 }
 
 void BorderAgent::HandlePSKc(const uint8_t *aPSKc)
@@ -330,6 +475,7 @@ void BorderAgent::HandlePSKc(const uint8_t *aPSKc)
     else
     {
         Stop();
+        StateCache::Get().Erase(StateCache::kRecordBorderAgent);
     }
 
     otbrLog(OTBR_LOG_INFO, "PSKc is %s", (mPSKcInitialized ? "initialized" : "not initialized"));
@@ -337,6 +483,13 @@ void BorderAgent::HandlePSKc(const uint8_t *aPSKc)
 
 void BorderAgent::HandleThreadState(bool aStarted)
 {
+    // The restored service is stale if Thread is down.
+    if (!aStarted && mRestored)
+    {
+        mRestored = false;
+        StateCache::Get().Erase(StateCache::kRecordBorderAgent);
+    }
+
     VerifyOrExit(mThreadStarted != aStarted);
 
     mThreadStarted = aStarted;
@@ -349,51 +502,31 @@ void BorderAgent::HandleThreadState(bool aStarted)
     else
     {
         Stop();
+        StateCache::Get().Erase(StateCache::kRecordBorderAgent);
     }
 
 exit:
     otbrLog(OTBR_LOG_INFO, "Thread is %s", (aStarted ? "up" : "down"));
 }
 
-void BorderAgent::HandleThreadState(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleThreadState(void *aContext, bool aStarted)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-
-    assert(aEvent == Ncp::kEventThreadState);
-
-    int started = va_arg(aArguments, int);
-    static_cast<BorderAgent *>(aContext)->HandleThreadState(started);
+    static_cast<BorderAgent *>(aContext)->HandleThreadState(aStarted);
 }
 
-void BorderAgent::HandleNetworkName(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleNetworkName(void *aContext, const char *aNetworkName)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-
-    assert(aEvent == Ncp::kEventNetworkName);
-
-    const char *networkName = va_arg(aArguments, const char *);
-    static_cast<BorderAgent *>(aContext)->SetNetworkName(networkName);
+    static_cast<BorderAgent *>(aContext)->SetNetworkName(aNetworkName);
 }
 
-void BorderAgent::HandleExtPanId(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleExtPanId(void *aContext, const uint8_t *aExtPanId)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-
-    assert(aEvent == Ncp::kEventExtPanId);
-
-    const uint8_t *xpanid = va_arg(aArguments, const uint8_t *);
-    static_cast<BorderAgent *>(aContext)->SetExtPanId(xpanid);
+    static_cast<BorderAgent *>(aContext)->SetExtPanId(aExtPanId);
 }
 
-void BorderAgent::HandleThreadVersion(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleThreadVersion(void *aContext, uint16_t aThreadVersion)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-
-    assert(aEvent == Ncp::kEventThreadVersion);
-
-    // `uint16_t` has been promoted to `int`.
-    uint16_t threadVersion = static_cast<uint16_t>(va_arg(aArguments, int));
-    static_cast<BorderAgent *>(aContext)->SetThreadVersion(threadVersion);
+    static_cast<BorderAgent *>(aContext)->SetThreadVersion(aThreadVersion);
 }
 
 } // namespace otbr
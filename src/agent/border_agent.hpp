@@ -38,8 +38,17 @@
 
 #include "agent/instance_params.hpp"
 #include "agent/ncp.hpp"
+#include "common/timer.hpp"
 #include "mdns/mdns.hpp"
 
+#if OTBR_ENABLE_MESHCOP_PROXY
+#include "agent/meshcop_proxy.hpp"
+#endif
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+#include "agent/advertising_proxy.hpp"
+#endif
+
 #if OTBR_ENABLE_BACKBONE_ROUTER
 #include "backbone_router/backbone_agent.hpp"
 #endif
@@ -78,6 +87,16 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method restores the service published before otbr-agent restarted from the state cache.
+     *
+     * It doesn't access the NCP, so that it runs while the NCP is being initialized. The restored service is published
+     * as soon as the NCP reports Thread up with PSKc initialized, without waiting for the network name, the extended
+     * PAN ID and the Thread version, then updated with them.
+     *
+     */
+    void Restore(void);
+
     /**
      * This method updates the fd_set and timeout for mainloop.
      *
@@ -122,26 +141,37 @@ private:
     }
     void HandleMdnsState(Mdns::State aState);
     void PublishService(void);
+    void SchedulePublishService(void);
     void StartPublishService(void);
     void StopPublishService(void);
 
+    otbrError SaveState(void) const;
+
     void SetNetworkName(const char *aNetworkName);
     void SetExtPanId(const uint8_t *aExtPanId);
     void SetThreadVersion(uint16_t aThreadVersion);
     void HandleThreadState(bool aStarted);
     void HandlePSKc(const uint8_t *aPSKc);
 
-    static void HandlePSKc(void *aContext, int aEvent, va_list aArguments);
-    static void HandleThreadState(void *aContext, int aEvent, va_list aArguments);
-    static void HandleNetworkName(void *aContext, int aEvent, va_list aArguments);
-    static void HandleExtPanId(void *aContext, int aEvent, va_list aArguments);
-    static void HandleThreadVersion(void *aContext, int aEvent, va_list aArguments);
+    static void HandlePSKc(void *aContext, const uint8_t *aPSKc);
+    static void HandleThreadState(void *aContext, bool aStarted);
+    static void HandleNetworkName(void *aContext, const char *aNetworkName);
+    static void HandleExtPanId(void *aContext, const uint8_t *aExtPanId);
+    static void HandleThreadVersion(void *aContext, uint16_t aThreadVersion);
+    static void HandlePublishTimer(Timer &aTimer, void *aContext);
+    void        HandlePublishTimer(void);
 
     Mdns::Publisher *mPublisher;
     Ncp::Controller *mNcp;
 #if OTBR_ENABLE_BACKBONE_ROUTER
     BackboneRouter::BackboneAgent mBackboneAgent;
 #endif
+#if OTBR_ENABLE_MESHCOP_PROXY
+    MeshcopProxy mMeshcopProxy;
+#endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    AdvertisingProxy mAdvertisingProxy;
+#endif
 
     uint8_t  mExtPanId[kSizeExtPanId];
     bool     mExtPanIdInitialized;
@@ -149,6 +179,13 @@ private:
     char     mNetworkName[kSizeNetworkName + 1];
     bool     mThreadStarted;
     bool     mPSKcInitialized;
+    bool     mRestored; ///< Whether the service restored from the state cache is not published yet.
+
+    // Timer coalescing the changes of the service into one publication
+    Timer mPublishTimer;
+    bool  mNetworkNameChanged;
+
+    Mdns::ServiceHandle mServiceHandle;
 };
 
 /**
@@ -0,0 +1,72 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the history of the channel occupancy.
+ */
+
+#include "agent/channel_history.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+static const ChannelHistory::ResolutionInfo kResolutions[ChannelHistory::kNumResolutions] = {
+    {60, OTBR_CHANNEL_HISTORY_MINUTES, "1m"},
+    {3600, OTBR_CHANNEL_HISTORY_HOURS, "1h"},
+    {86400, OTBR_CHANNEL_HISTORY_DAYS, "1d"},
+};
+
+ChannelHistory::ChannelHistory(void)
+    : History(kResolutions, MemoryStats::kSubsystemChannelHistory)
+{
+}
+
+void ChannelHistory::Add(uint64_t aTime, uint32_t aChannelMask, const uint16_t (&aOccupancies)[kNumChannels])
+{
+    History::Add(aTime, [aChannelMask, &aOccupancies](Window &aWindow) {
+        for (uint8_t i = 0; i < kNumChannels; i++)
+        {
+            Occupancy &occupancy = aWindow.mChannels[i];
+            uint16_t   value     = aOccupancies[i];
+
+            if (!(aChannelMask & (1U << (kMinChannel + i))))
+            {
+                continue;
+            }
+
+            occupancy.mMin = (occupancy.mCount == 0 || value < occupancy.mMin ? value : occupancy.mMin);
+            occupancy.mMax = (value > occupancy.mMax ? value : occupancy.mMax);
+            occupancy.mSum += value;
+            occupancy.mCount++;
+        }
+    });
+}
+
+} // namespace Ncp
+} // namespace otbr
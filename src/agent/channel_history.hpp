@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the history of the channel occupancy.
+ */
+
+#ifndef OTBR_AGENT_CHANNEL_HISTORY_HPP_
+#define OTBR_AGENT_CHANNEL_HISTORY_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "agent/history.hpp"
+
+/**
+ * The number of windows kept at the resolution of one minute.
+ *
+ */
+#ifndef OTBR_CHANNEL_HISTORY_MINUTES
+#define OTBR_CHANNEL_HISTORY_MINUTES 120
+#endif
+
+/**
+ * The number of windows kept at the resolution of one hour.
+ *
+ */
+#ifndef OTBR_CHANNEL_HISTORY_HOURS
+#define OTBR_CHANNEL_HISTORY_HOURS 168
+#endif
+
+/**
+ * The number of windows kept at the resolution of one day.
+ *
+ */
+#ifndef OTBR_CHANNEL_HISTORY_DAYS
+#define OTBR_CHANNEL_HISTORY_DAYS 30
+#endif
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents the occupancy of a channel in a window.
+ *
+ * The occupancies are fractions of the time the channel is busy, 0 for never and 0xffff for always.
+ *
+ */
+struct ChannelOccupancy
+{
+    uint16_t mMin;   ///< The lowest occupancy sampled.
+    uint16_t mMax;   ///< The highest occupancy sampled.
+    uint32_t mCount; ///< The number of samples, 0 when the channel was not sampled in the window.
+    uint64_t mSum;   ///< The sum of the occupancies sampled.
+
+    /**
+     * This method returns the average occupancy of the window.
+     *
+     * @returns The average occupancy, 0 when the channel was not sampled.
+     *
+     */
+    uint16_t GetAverage(void) const { return mCount == 0 ? 0 : static_cast<uint16_t>(mSum / mCount); }
+};
+
+/**
+ * This structure represents a window of the channel occupancy history.
+ *
+ */
+struct ChannelWindow
+{
+    static constexpr uint8_t kMinChannel  = 11; ///< The lowest channel kept.
+    static constexpr uint8_t kMaxChannel  = 26; ///< The highest channel kept.
+    static constexpr uint8_t kNumChannels = kMaxChannel - kMinChannel + 1;
+
+    uint64_t         mTime;                   ///< The start of the window, in seconds since the Unix epoch.
+    ChannelOccupancy mChannels[kNumChannels]; ///< The occupancies, from channel `kMinChannel` to `kMaxChannel`.
+};
+
+/**
+ * This class keeps a history of the occupancy of the 2.4 GHz channels at the resolutions of one minute, one hour and
+ * one day.
+ *
+ * Each window aggregates the minimum, the sum and the maximum of the occupancies sampled in its period, so that the
+ * average is exact at any resolution, and the history of a day of samples stays a few kilobytes.
+ *
+ */
+class ChannelHistory : public History<ChannelWindow, true>
+{
+public:
+    typedef ChannelOccupancy Occupancy;
+    typedef ChannelWindow    Window;
+
+    static constexpr uint8_t kMinChannel  = Window::kMinChannel;  ///< The lowest channel kept.
+    static constexpr uint8_t kMaxChannel  = Window::kMaxChannel;  ///< The highest channel kept.
+    static constexpr uint8_t kNumChannels = Window::kNumChannels; ///< The number of channels kept.
+
+    /**
+     * This enumeration represents the resolutions of the history.
+     *
+     */
+    enum Resolution : uint8_t
+    {
+        kResolutionMinute = 0, ///< One window per minute, named "1m".
+        kResolutionHour   = 1, ///< One window per hour, named "1h".
+        kResolutionDay    = 2, ///< One window per day, named "1d".
+    };
+
+    /**
+     * The constructor allocates the rings of all resolutions.
+     *
+     */
+    ChannelHistory(void);
+
+    /**
+     * This method adds a sample of the channel occupancies to the current window of each resolution.
+     *
+     * A sample older than the current window of a resolution, after the system clock is set back, restarts the
+     * history of that resolution.
+     *
+     * @param[in]   aTime           The time the occupancies were read, in seconds since the Unix epoch.
+     * @param[in]   aChannelMask    The channels sampled, bit N for channel N.
+     * @param[in]   aOccupancies    The occupancies, from channel `kMinChannel` to `kMaxChannel`. Only those of the
+     *                              channels in @p aChannelMask are read.
+     *
+     */
+    void Add(uint64_t aTime, uint32_t aChannelMask, const uint16_t (&aOccupancies)[kNumChannels]);
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_CHANNEL_HISTORY_HPP_
@@ -0,0 +1,446 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   The file implements the commissioning orchestrator of a queue of joiners.
+ */
+
+#include "agent/commissioning_orchestrator.hpp"
+
+#include <thread>
+
+#include <string.h>
+
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+CommissioningOrchestrator::CommissioningOrchestrator(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mStarted(false)
+    , mActiveJoiners(0)
+    , mSteeringDataStale(false)
+    , mSteeringDataChanged(false)
+    , mRefreshTimer(HandleRefreshTimer, this)
+    , mSteeringDataTimer(HandleSteeringDataTimer, this)
+{
+    mSteeringData.Init(SteeringData::kMaxSizeOfBloomFilter);
+    Publish();
+}
+
+otError CommissioningOrchestrator::Start(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(!mStarted, error = OT_ERROR_ALREADY);
+    SuccessOrExit(error = otCommissionerStart(mInstance, HandleStateChanged, HandleJoinerEvent, this));
+    mStarted = true;
+
+exit:
+    otbrLog(error == OT_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, "Start commissioning: %s",
+            otThreadErrorToString(error));
+    return error;
+}
+
+otError CommissioningOrchestrator::Stop(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mStarted, error = OT_ERROR_INVALID_STATE);
+
+    // The joiners are marked out of the joiner table first, so that their removal by the commissioner is ignored.
+    RequeueJoiners();
+    mStarted = false;
+    otCommissionerStop(mInstance);
+    Publish();
+
+exit:
+    return error;
+}
+
+bool CommissioningOrchestrator::IsPskdValid(const std::string &aPskd)
+{
+    bool valid = (aPskd.size() >= 6 && aPskd.size() <= 32);
+
+    // Uppercase alphanumeric characters, excluding I, O, Q and Z for readability.
+    for (char c : aPskd)
+    {
+        valid = valid && ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z')) && c != 'I' && c != 'O' && c != 'Q' &&
+                c != 'Z';
+    }
+
+    return valid;
+}
+
+otError CommissioningOrchestrator::AddJoiners(const std::vector<JoinerRequest> &aJoiners)
+{
+    otError                          error = OT_ERROR_NONE;
+    size_t                           added = 0;
+    std::vector<SteeringData::Eui64> eui64s;
+
+    for (size_t i = 0; i < aJoiners.size(); i++)
+    {
+        const Joiner *joiner = FindJoiner(aJoiners[i].mEui64.data());
+
+        VerifyOrExit(IsPskdValid(aJoiners[i].mPskd), error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(joiner == nullptr || !IsPending(joiner->mState), error = OT_ERROR_ALREADY);
+        added += (joiner == nullptr);
+
+        for (size_t j = 0; j < i; j++)
+        {
+            VerifyOrExit(aJoiners[j].mEui64 != aJoiners[i].mEui64, error = OT_ERROR_ALREADY);
+        }
+    }
+
+    VerifyOrExit(mJoiners.size() + added <= OTBR_COMMISSIONING_MAX_JOINERS, error = OT_ERROR_NO_BUFS);
+
+    for (const JoinerRequest &request : aJoiners)
+    {
+        Joiner *joiner = FindJoiner(request.mEui64.data());
+
+        if (joiner == nullptr)
+        {
+            mJoiners.emplace_back();
+            joiner           = &mJoiners.back();
+            joiner->mEui64   = request.mEui64;
+            joiner->mInTable = false;
+        }
+
+        joiner->mPskd       = request.mPskd;
+        joiner->mState      = kJoinerQueued;
+        joiner->mAttempts   = 0;
+        joiner->mQueuedTime = Timer::Clock::now();
+        eui64s.push_back(request.mEui64);
+    }
+
+    // Queued joiners only add bits to the steering data, the joiner IDs are hashed on all cores for large batches.
+    if (!eui64s.empty())
+    {
+        mSteeringData.ComputeBloomFilter(eui64s, std::thread::hardware_concurrency());
+        mSteeringDataChanged = true;
+    }
+
+    Refresh();
+
+exit:
+    otbrLog(error == OT_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, "Queue %zu joiners: %s", aJoiners.size(),
+            otThreadErrorToString(error));
+    return error;
+}
+
+otError CommissioningOrchestrator::RemoveJoiner(const SteeringData::Eui64 &aEui64)
+{
+    otError error  = OT_ERROR_NONE;
+    Joiner *joiner = FindJoiner(aEui64.data());
+
+    VerifyOrExit(joiner != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    if (joiner->mInTable)
+    {
+        otExtAddress eui64;
+
+        // The joiner is marked out of the joiner table first, so that its removal by the commissioner is ignored.
+        memcpy(eui64.m8, aEui64.data(), sizeof(eui64.m8));
+        joiner->mInTable = false;
+        mActiveJoiners--;
+        otCommissionerRemoveJoiner(mInstance, &eui64);
+        mSteeringDataChanged = true;
+    }
+
+    mSteeringDataStale = mSteeringDataStale || IsPending(joiner->mState);
+    mJoiners.erase(mJoiners.begin() + (joiner - mJoiners.data()));
+    Refresh();
+
+exit:
+    return error;
+}
+
+void CommissioningOrchestrator::HandleNcpReset(otInstance *aInstance)
+{
+    // The commissioner and its joiner table are lost with the previous instance.
+    RequeueJoiners();
+    mInstance = aInstance;
+    mStarted  = false;
+    mRefreshTimer.Stop();
+    mSteeringDataTimer.Stop();
+    Publish();
+}
+
+void CommissioningOrchestrator::HandleStateChanged(otCommissionerState aState, void *aContext)
+{
+    static_cast<CommissioningOrchestrator *>(aContext)->HandleStateChanged(aState);
+}
+
+void CommissioningOrchestrator::HandleStateChanged(otCommissionerState aState)
+{
+    otbrLog(OTBR_LOG_INFO, "Commissioner state: %d", aState);
+
+    if (aState == OT_COMMISSIONER_STATE_DISABLED)
+    {
+        // The commissioner stopped on its own, e.g. when its petition was rejected or it lost its session.
+        RequeueJoiners();
+        mStarted = false;
+    }
+    else if (aState == OT_COMMISSIONER_STATE_ACTIVE)
+    {
+        // The steering data of the queued joiners is sent along with the first joiners added.
+        mSteeringDataChanged = true;
+    }
+
+    mRefreshTimer.Start(std::chrono::microseconds(0));
+}
+
+void CommissioningOrchestrator::HandleJoinerEvent(otCommissionerJoinerEvent aEvent,
+                                                  const otJoinerInfo *      aJoinerInfo,
+                                                  const otExtAddress *      aJoinerId,
+                                                  void *                    aContext)
+{
+    OTBR_UNUSED_VARIABLE(aJoinerId);
+
+    VerifyOrExit(aJoinerInfo != nullptr && aJoinerInfo->mType == OT_JOINER_INFO_TYPE_EUI64);
+    static_cast<CommissioningOrchestrator *>(aContext)->HandleJoinerEvent(aEvent, *aJoinerInfo);
+
+exit:
+    return;
+}
+
+void CommissioningOrchestrator::HandleJoinerEvent(otCommissionerJoinerEvent aEvent, const otJoinerInfo &aJoinerInfo)
+{
+    Joiner *joiner = FindJoiner(aJoinerInfo.mSharedId.mEui64.m8);
+
+    // Joiners added by other clients of the commissioner and joiners already removed are ignored.
+    VerifyOrExit(joiner != nullptr && joiner->mInTable);
+
+    switch (aEvent)
+    {
+    case OT_COMMISSIONER_JOINER_START:
+        joiner->mAttempts += (joiner->mAttempts < UINT16_MAX);
+        break;
+    case OT_COMMISSIONER_JOINER_CONNECTED:
+        joiner->mState = kJoinerConnected;
+        break;
+    case OT_COMMISSIONER_JOINER_FINALIZE:
+        joiner->mState = kJoinerFinalizing;
+        break;
+    case OT_COMMISSIONER_JOINER_END:
+        if (joiner->mState == kJoinerFinalizing)
+        {
+            // The joiner is removed from the joiner table out of the callback to make room for the next joiner.
+            Finish(*joiner, kJoinerJoined);
+        }
+        else
+        {
+            // The joiner failed to connect, e.g. with a wrong PSKd, and may try again until it expires.
+            joiner->mState = kJoinerActive;
+        }
+        break;
+    case OT_COMMISSIONER_JOINER_REMOVED:
+        joiner->mInTable = false;
+        mActiveJoiners--;
+        mSteeringDataChanged = true;
+        Finish(*joiner, kJoinerFailed);
+        break;
+    }
+
+    mRefreshTimer.Start(std::chrono::microseconds(0));
+
+exit:
+    return;
+}
+
+void CommissioningOrchestrator::HandleRefreshTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<CommissioningOrchestrator *>(aContext)->Refresh();
+}
+
+void CommissioningOrchestrator::HandleSteeringDataTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<CommissioningOrchestrator *>(aContext)->SendSteeringData();
+}
+
+void CommissioningOrchestrator::SendSteeringData(void)
+{
+    otCommissioningDataset dataset;
+    otError                error   = OT_ERROR_NONE;
+    bool                   pending = false;
+
+    for (const Joiner &joiner : mJoiners)
+    {
+        pending = pending || IsPending(joiner.mState);
+    }
+
+    // The commissioner sends the steering data of its own joiner table when it changes, this one is sent after it
+    // to also steer the queued joiners.
+    VerifyOrExit(pending && otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_ACTIVE);
+
+    memset(&dataset, 0, sizeof(dataset));
+    dataset.mSteeringData.mLength = mSteeringData.GetLength();
+    memcpy(dataset.mSteeringData.m8, mSteeringData.GetBloomFilter(), mSteeringData.GetLength());
+    dataset.mIsSteeringDataSet = true;
+
+    error = otCommissionerSendMgmtSet(mInstance, &dataset, nullptr, 0);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to send steering data: %s", otThreadErrorToString(error));
+    }
+}
+
+CommissioningOrchestrator::Joiner *CommissioningOrchestrator::FindJoiner(const uint8_t *aEui64)
+{
+    Joiner *found = nullptr;
+
+    for (Joiner &joiner : mJoiners)
+    {
+        if (memcmp(joiner.mEui64.data(), aEui64, joiner.mEui64.size()) == 0)
+        {
+            found = &joiner;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void CommissioningOrchestrator::Finish(Joiner &aJoiner, JoinerState aState)
+{
+    aJoiner.mState     = aState;
+    aJoiner.mEndTime   = Timer::Clock::now();
+    mSteeringDataStale = true;
+
+    otbrLog(OTBR_LOG_INFO, "Joiner %s after %u attempts", aState == kJoinerJoined ? "joined" : "failed",
+            aJoiner.mAttempts);
+}
+
+void CommissioningOrchestrator::RequeueJoiners(void)
+{
+    for (Joiner &joiner : mJoiners)
+    {
+        joiner.mInTable = false;
+
+        if (IsPending(joiner.mState))
+        {
+            joiner.mState = kJoinerQueued;
+        }
+    }
+
+    mActiveJoiners = 0;
+}
+
+void CommissioningOrchestrator::Refresh(void)
+{
+    bool active = mStarted && otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_ACTIVE;
+    bool room   = active;
+
+    // Joiners done at the same time are removed from the steering data at once.
+    if (mSteeringDataStale)
+    {
+        std::vector<SteeringData::Eui64> eui64s;
+
+        for (const Joiner &joiner : mJoiners)
+        {
+            if (IsPending(joiner.mState))
+            {
+                eui64s.push_back(joiner.mEui64);
+            }
+        }
+
+        mSteeringData.Init(SteeringData::kMaxSizeOfBloomFilter);
+        mSteeringData.ComputeBloomFilter(eui64s, std::thread::hardware_concurrency());
+        mSteeringDataStale   = false;
+        mSteeringDataChanged = true;
+    }
+
+    for (Joiner &joiner : mJoiners)
+    {
+        otExtAddress eui64;
+
+        memcpy(eui64.m8, joiner.mEui64.data(), sizeof(eui64.m8));
+
+        if (joiner.mInTable && !IsPending(joiner.mState))
+        {
+            // The joiner is marked out of the joiner table first, so that its removal by the commissioner is ignored.
+            joiner.mInTable = false;
+            mActiveJoiners--;
+            otCommissionerRemoveJoiner(mInstance, &eui64);
+            mSteeringDataChanged = true;
+        }
+        else if (room && joiner.mState == kJoinerQueued && mActiveJoiners < OTBR_COMMISSIONING_MAX_ACTIVE_JOINERS)
+        {
+            otError error = otCommissionerAddJoiner(mInstance, &eui64, joiner.mPskd.c_str(),
+                                                    OTBR_COMMISSIONING_JOINER_TIMEOUT);
+
+            if (error == OT_ERROR_NONE)
+            {
+                joiner.mState      = kJoinerActive;
+                joiner.mActiveTime = Timer::Clock::now();
+                joiner.mInTable    = true;
+                mActiveJoiners++;
+                mSteeringDataChanged = true;
+            }
+            else
+            {
+                // The joiner table is full of joiners added by other clients of the commissioner, the joiner is
+                // added once one of the joiners of this orchestrator is done.
+                room = false;
+            }
+        }
+    }
+
+    if (mSteeringDataChanged && active)
+    {
+        mSteeringDataChanged = false;
+        mSteeringDataTimer.Start(std::chrono::milliseconds(OTBR_COMMISSIONING_STEERING_DATA_DELAY));
+    }
+
+    Publish();
+}
+
+void CommissioningOrchestrator::Publish(void)
+{
+    std::shared_ptr<Progress> progress = std::make_shared<Progress>();
+
+    progress->mState = (mStarted ? otCommissionerGetState(mInstance) : OT_COMMISSIONER_STATE_DISABLED);
+    progress->mJoiners.assign(mJoiners.begin(), mJoiners.end());
+
+    std::atomic_store(&mProgress, std::shared_ptr<const Progress>(progress));
+}
+
+} // namespace agent
+} // namespace otbr
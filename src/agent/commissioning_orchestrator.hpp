@@ -0,0 +1,261 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the commissioning orchestrator of a queue of joiners.
+ */
+
+#ifndef OTBR_AGENT_COMMISSIONING_ORCHESTRATOR_HPP_
+#define OTBR_AGENT_COMMISSIONING_ORCHESTRATOR_HPP_
+
+#include "openthread-br/config.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openthread/commissioner.h>
+#include <openthread/instance.h>
+
+#include "common/timer.hpp"
+#include "utils/steering_data.hpp"
+
+/**
+ * The timeout in seconds of a joiner added to the commissioner, after which it fails if not joined.
+ *
+ */
+#ifndef OTBR_COMMISSIONING_JOINER_TIMEOUT
+#define OTBR_COMMISSIONING_JOINER_TIMEOUT 120
+#endif
+
+/**
+ * The maximum number of joiners added to the commissioner at the same time, further joiners wait in the queue.
+ *
+ * Joiners are also kept in the queue while the joiner table of the commissioner is full, so it only needs to be lower
+ * than the size of the joiner table to leave room for joiners added by other clients of the commissioner.
+ *
+ */
+#ifndef OTBR_COMMISSIONING_MAX_ACTIVE_JOINERS
+#define OTBR_COMMISSIONING_MAX_ACTIVE_JOINERS 16
+#endif
+
+/**
+ * The maximum number of joiners tracked, including the joined and failed ones.
+ *
+ */
+#ifndef OTBR_COMMISSIONING_MAX_JOINERS
+#define OTBR_COMMISSIONING_MAX_JOINERS 1024
+#endif
+
+/**
+ * The delay in milliseconds changes of the steering data are coalesced before it is sent to the leader.
+ *
+ */
+#ifndef OTBR_COMMISSIONING_STEERING_DATA_DELAY
+#define OTBR_COMMISSIONING_STEERING_DATA_DELAY 200
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class commissions a queue of expected joiners.
+ *
+ * Queued joiners are added to the commissioner as its joiner table has room, and each joined or failed joiner makes
+ * room for the next one. The steering data sent to the leader covers all joiners not joined or failed yet, it is
+ * updated incrementally as joiners are queued and recomputed once for all joiners done at the same time.
+ *
+ * The progress is published as an immutable snapshot, so that it can be read on any thread.
+ *
+ */
+class CommissioningOrchestrator
+{
+public:
+    /**
+     * The state of a joiner.
+     *
+     */
+    enum JoinerState : uint8_t
+    {
+        kJoinerQueued     = 0, ///< Waiting for room in the joiner table of the commissioner.
+        kJoinerActive     = 1, ///< Added to the commissioner, waiting for the joiner to connect.
+        kJoinerConnected  = 2, ///< The DTLS session of the joiner is connected.
+        kJoinerFinalizing = 3, ///< The joiner requested the network credentials.
+        kJoinerJoined     = 4, ///< The joiner received the network credentials.
+        kJoinerFailed     = 5, ///< The joiner expired from the commissioner without joining.
+    };
+
+    /**
+     * This structure represents an expected joiner.
+     *
+     */
+    struct JoinerRequest
+    {
+        SteeringData::Eui64 mEui64; ///< The EUI-64 of the joiner.
+        std::string         mPskd;  ///< The PSKd of the joiner.
+    };
+
+    /**
+     * This structure represents the progress of a joiner.
+     *
+     */
+    struct JoinerProgress
+    {
+        SteeringData::Eui64      mEui64;      ///< The EUI-64 of the joiner.
+        JoinerState              mState;      ///< The state of the joiner.
+        uint16_t                 mAttempts;   ///< The number of DTLS sessions started by the joiner.
+        Timer::Clock::time_point mQueuedTime; ///< The time the joiner was queued.
+        Timer::Clock::time_point mActiveTime; ///< The time the joiner was added to the commissioner, unless queued.
+        Timer::Clock::time_point mEndTime;    ///< The time the joiner joined or failed.
+    };
+
+    /**
+     * This structure represents the progress of the commissioning.
+     *
+     */
+    struct Progress
+    {
+        otCommissionerState         mState;   ///< The state of the commissioner.
+        std::vector<JoinerProgress> mJoiners; ///< The joiners in the order they were queued.
+    };
+
+    /**
+     * The constructor of a commissioning orchestrator.
+     *
+     * @param[in]   aInstance   A pointer to the OpenThread instance.
+     *
+     */
+    explicit CommissioningOrchestrator(otInstance *aInstance);
+
+    /**
+     * This method starts the commissioner, queued joiners are added to it once it becomes active.
+     *
+     * @retval  OT_ERROR_NONE       Successfully started the commissioner.
+     * @retval  OT_ERROR_ALREADY    The commissioner is already started.
+     * @retval  ...                 Other errors of starting the commissioner.
+     *
+     */
+    otError Start(void);
+
+    /**
+     * This method stops the commissioner, the joiners not joined yet are queued again.
+     *
+     * @retval  OT_ERROR_NONE           Successfully stopped the commissioner.
+     * @retval  OT_ERROR_INVALID_STATE  The commissioner was not started by this orchestrator.
+     *
+     */
+    otError Stop(void);
+
+    /**
+     * This method queues joiners.
+     *
+     * Joiners are queued either all or none. A joined or failed joiner is queued again with its new PSKd.
+     *
+     * @param[in]   aJoiners    The joiners to queue.
+     *
+     * @retval  OT_ERROR_NONE           Successfully queued the joiners.
+     * @retval  OT_ERROR_INVALID_ARGS   A PSKd is invalid.
+     * @retval  OT_ERROR_ALREADY        A joiner is queued twice, or is neither joined nor failed yet.
+     * @retval  OT_ERROR_NO_BUFS        Queuing the joiners exceeds the maximum number of joiners.
+     *
+     */
+    otError AddJoiners(const std::vector<JoinerRequest> &aJoiners);
+
+    /**
+     * This method removes a joiner, from the commissioner as well if it has been added to it.
+     *
+     * @param[in]   aEui64  The EUI-64 of the joiner.
+     *
+     * @retval  OT_ERROR_NONE       Successfully removed the joiner.
+     * @retval  OT_ERROR_NOT_FOUND  The joiner is not queued.
+     *
+     */
+    otError RemoveJoiner(const SteeringData::Eui64 &aEui64);
+
+    /**
+     * This method returns the snapshot of the progress of the commissioning.
+     *
+     * @returns The shared pointer to the progress of the commissioning.
+     *
+     */
+    std::shared_ptr<const Progress> GetProgress(void) const { return std::atomic_load(&mProgress); }
+
+    /**
+     * This method handles the reset of the NCP, the joiners not joined yet are queued again.
+     *
+     * @param[in]   aInstance   A pointer to the new OpenThread instance.
+     *
+     */
+    void HandleNcpReset(otInstance *aInstance);
+
+private:
+    struct Joiner : public JoinerProgress
+    {
+        std::string mPskd;
+        bool        mInTable; ///< Whether the joiner is in the joiner table of the commissioner.
+    };
+
+    static bool IsPending(JoinerState aState) { return aState < kJoinerJoined; }
+    static bool IsPskdValid(const std::string &aPskd);
+
+    static void HandleStateChanged(otCommissionerState aState, void *aContext);
+    void        HandleStateChanged(otCommissionerState aState);
+    static void HandleJoinerEvent(otCommissionerJoinerEvent aEvent,
+                                  const otJoinerInfo *      aJoinerInfo,
+                                  const otExtAddress *      aJoinerId,
+                                  void *                    aContext);
+    void        HandleJoinerEvent(otCommissionerJoinerEvent aEvent, const otJoinerInfo &aJoinerInfo);
+    static void HandleRefreshTimer(Timer &aTimer, void *aContext);
+    static void HandleSteeringDataTimer(Timer &aTimer, void *aContext);
+    void        SendSteeringData(void);
+
+    Joiner *FindJoiner(const uint8_t *aEui64);
+    void    Finish(Joiner &aJoiner, JoinerState aState);
+    void    RequeueJoiners(void);
+    void    Refresh(void);
+    void    Publish(void);
+
+    otInstance *        mInstance;
+    bool                mStarted;
+    std::vector<Joiner> mJoiners;
+    uint16_t            mActiveJoiners; ///< The number of joiners in the joiner table of the commissioner.
+    SteeringData        mSteeringData;
+    bool                mSteeringDataStale;   ///< Whether joiners were removed from the steering data.
+    bool                mSteeringDataChanged; ///< Whether the steering data or the joiner table changed.
+    Timer               mRefreshTimer;
+    Timer               mSteeringDataTimer;
+
+    std::shared_ptr<const Progress> mProgress;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_AGENT_COMMISSIONING_ORCHESTRATOR_HPP_
@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definition for the history of the MAC and IPv6 counters.
+ */
+
+#ifndef OTBR_AGENT_COUNTERS_HISTORY_HPP_
+#define OTBR_AGENT_COUNTERS_HISTORY_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include "agent/history.hpp"
+
+/**
+ * The number of samples kept at the resolution of one second.
+ *
+ */
+#ifndef OTBR_COUNTERS_HISTORY_SECONDS
+#define OTBR_COUNTERS_HISTORY_SECONDS 300
+#endif
+
+/**
+ * The number of samples kept at the resolution of one minute.
+ *
+ */
+#ifndef OTBR_COUNTERS_HISTORY_MINUTES
+#define OTBR_COUNTERS_HISTORY_MINUTES 120
+#endif
+
+/**
+ * The number of samples kept at the resolution of one hour.
+ *
+ */
+#ifndef OTBR_COUNTERS_HISTORY_HOURS
+#define OTBR_COUNTERS_HISTORY_HOURS 168
+#endif
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents a sample of the counters.
+ *
+ */
+struct CountersSample
+{
+    uint64_t      mTime;        ///< The time the counters were read, in seconds since the Unix epoch.
+    otMacCounters mMacCounters; ///< The MAC counters.
+    otIpCounters  mIpCounters;  ///< The IPv6 counters.
+};
+
+/**
+ * This class keeps a history of the MAC and IPv6 counters at the resolutions of one second, one minute and one hour.
+ *
+ * The history holds the last sample of each period. As the counters are cumulative, the last sample of a period is an
+ * exact downsampling of the samples of that period, and the rates are derived from the differences of consecutive
+ * samples. A counter lower than in the previous sample means the counters were reset in between.
+ *
+ */
+class CountersHistory : public History<CountersSample, false>
+{
+public:
+    typedef CountersSample Sample;
+
+    /**
+     * This enumeration represents the resolutions of the history.
+     *
+     */
+    enum Resolution : uint8_t
+    {
+        kResolutionSecond = 0, ///< One sample per second, named "1s".
+        kResolutionMinute = 1, ///< One sample per minute, named "1m".
+        kResolutionHour   = 2, ///< One sample per hour, named "1h".
+    };
+
+    /**
+     * The constructor allocates the rings of all resolutions.
+     *
+     */
+    CountersHistory(void);
+
+    /**
+     * This method adds a sample, replacing the sample of the same period at each resolution.
+     *
+     * A sample older than the last sample of a resolution, after the system clock is set back, restarts the history
+     * of that resolution.
+     *
+     * @param[in]   aTime           The time the counters were read, in seconds since the Unix epoch.
+     * @param[in]   aMacCounters    The MAC counters.
+     * @param[in]   aIpCounters     The IPv6 counters.
+     *
+     */
+    void Add(uint64_t aTime, const otMacCounters &aMacCounters, const otIpCounters &aIpCounters);
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_COUNTERS_HISTORY_HPP_
@@ -0,0 +1,279 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the histories kept at several resolutions.
+ */
+
+#ifndef OTBR_AGENT_HISTORY_HPP_
+#define OTBR_AGENT_HISTORY_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/memory_stats.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class template keeps a history at three resolutions, in a ring of entries for each resolution.
+ *
+ * An entry holds its time in a `uint64_t mTime` member, in seconds since the Unix epoch, and covers one period of its
+ * resolution. A window starts at the start of its period and aggregates all samples of the period, otherwise an entry
+ * is the last sample of its period.
+ *
+ * The entries are added on the mainloop thread, and can be queried from any thread.
+ *
+ * @tparam  EntryType   The type of the entries.
+ * @tparam  kWindows    Whether the entries are windows rather than samples.
+ *
+ */
+template <typename EntryType, bool kWindows> class History
+{
+public:
+    typedef EntryType Entry;
+
+    static constexpr uint8_t kNumResolutions = 3;
+
+    /**
+     * This structure represents a resolution of the history.
+     *
+     */
+    struct ResolutionInfo
+    {
+        uint32_t    mPeriod;   ///< The period in seconds.
+        size_t      mCapacity; ///< The number of entries kept.
+        const char *mName;     ///< The name of the resolution in the REST API, e.g. "1m".
+    };
+
+    /**
+     * The constructor allocates the rings of all resolutions.
+     *
+     * @param[in]   aResolutions    The resolutions, from the finest, which must outlive the history.
+     * @param[in]   aSubsystem      The subsystem the memory of the rings is accounted to.
+     *
+     */
+    History(const ResolutionInfo (&aResolutions)[kNumResolutions], MemoryStats::Subsystem aSubsystem)
+        : mResolutions(aResolutions)
+    {
+        size_t size = 0;
+
+        for (uint8_t index = 0; index < kNumResolutions; index++)
+        {
+            mRings[index].mEntries.resize(mResolutions[index].mCapacity);
+            mRings[index].mFirst = 0;
+            mRings[index].mCount = 0;
+            size += MemoryStats::VectorSize(mRings[index].mEntries);
+        }
+
+        MemoryStats::Get().Update(aSubsystem, size);
+    }
+
+    /**
+     * This method returns the period of a resolution.
+     *
+     * @param[in]   aResolution     The resolution.
+     *
+     * @returns The period in seconds.
+     *
+     */
+    uint32_t GetPeriod(uint8_t aResolution) const { return mResolutions[aResolution].mPeriod; }
+
+    /**
+     * This method finds the resolution of a period.
+     *
+     * @param[in]   aPeriod         The period in seconds.
+     * @param[out]  aResolution     The resolution.
+     *
+     * @retval  true    The resolution is found.
+     * @retval  false   No resolution has the period.
+     *
+     */
+    bool FindResolution(uint32_t aPeriod, uint8_t &aResolution) const
+    {
+        bool found = false;
+
+        for (uint8_t index = 0; index < kNumResolutions && !found; index++)
+        {
+            if (mResolutions[index].mPeriod == aPeriod)
+            {
+                aResolution = index;
+                found       = true;
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * This method parses the name of a resolution.
+     *
+     * @param[in]   aName           The name, empty for the finest resolution.
+     * @param[out]  aResolution     The resolution.
+     *
+     * @retval  true    The name is parsed.
+     * @retval  false   No resolution has the name.
+     *
+     */
+    bool ParseResolution(const std::string &aName, uint8_t &aResolution) const
+    {
+        bool found = aName.empty();
+
+        aResolution = 0;
+
+        for (uint8_t index = 0; index < kNumResolutions && !found; index++)
+        {
+            if (aName == mResolutions[index].mName)
+            {
+                aResolution = index;
+                found       = true;
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * This method updates the entry of the current period of each resolution, adding it if needed.
+     *
+     * A time before the latest entry of a resolution, after the system clock is set back, restarts the history of
+     * that resolution.
+     *
+     * @param[in]   aTime       The time of the sample, in seconds since the Unix epoch.
+     * @param[in]   aUpdate     The function updating an entry, `void(EntryType &)`. Entries are added zeroed, and
+     *                          their time is already set.
+     *
+     */
+    template <typename UpdateType> void Add(uint64_t aTime, UpdateType aUpdate)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (uint8_t index = 0; index < kNumResolutions; index++)
+        {
+            Ring &     ring   = mRings[index];
+            uint32_t   period = mResolutions[index].mPeriod;
+            uint64_t   time   = kWindows ? aTime - aTime % period : aTime;
+            EntryType *entry  = nullptr;
+
+            if (ring.mEntries.empty())
+            {
+                continue;
+            }
+
+            if (ring.mCount > 0)
+            {
+                entry = &ring.mEntries[(ring.mFirst + ring.mCount - 1) % ring.mEntries.size()];
+
+                if (time < entry->mTime)
+                {
+                    ring.mFirst = 0;
+                    ring.mCount = 0;
+                    entry       = nullptr;
+                }
+                else if (time / period != entry->mTime / period)
+                {
+                    entry = nullptr;
+                }
+            }
+
+            if (entry == nullptr)
+            {
+                if (ring.mCount == ring.mEntries.size())
+                {
+                    ring.mFirst = (ring.mFirst + 1) % ring.mEntries.size();
+                }
+                else
+                {
+                    ring.mCount++;
+                }
+
+                entry  = &ring.mEntries[(ring.mFirst + ring.mCount - 1) % ring.mEntries.size()];
+                *entry = EntryType();
+            }
+
+            entry->mTime = time;
+            aUpdate(*entry);
+        }
+    }
+
+    /**
+     * This method reads the entries of a resolution in a range of time.
+     *
+     * @param[in]   aResolution     The resolution.
+     * @param[in]   aSince          The earliest time of the range, in seconds since the Unix epoch.
+     * @param[in]   aUntil          The latest time of the range, in seconds since the Unix epoch.
+     * @param[out]  aEntries        The entries in the range, or windows overlapping it, from the oldest to the latest.
+     *
+     */
+    void Query(uint8_t aResolution, uint64_t aSince, uint64_t aUntil, std::vector<EntryType> &aEntries) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const Ring &                ring   = mRings[aResolution];
+        uint32_t                    period = mResolutions[aResolution].mPeriod;
+
+        aEntries.clear();
+
+        for (size_t offset = 0; offset < ring.mCount; offset++)
+        {
+            const EntryType &entry = ring.mEntries[(ring.mFirst + offset) % ring.mEntries.size()];
+
+            if (entry.mTime > aUntil)
+            {
+                break;
+            }
+
+            if (kWindows ? entry.mTime + period > aSince : entry.mTime >= aSince)
+            {
+                aEntries.push_back(entry);
+            }
+        }
+    }
+
+private:
+    struct Ring
+    {
+        std::vector<EntryType> mEntries; ///< The storage of the entries, of the capacity of the ring.
+        size_t                 mFirst;   ///< The index of the oldest entry.
+        size_t                 mCount;   ///< The number of entries.
+    };
+
+    const ResolutionInfo (&mResolutions)[kNumResolutions];
+    mutable std::mutex mMutex;
+    Ring               mRings[kNumResolutions];
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_HISTORY_HPP_
@@ -34,6 +34,8 @@
 #ifndef OTBR_AGENT_INSATNCE_PARAMS_HPP_
 #define OTBR_AGENT_INSATNCE_PARAMS_HPP_
 
+#include <stdint.h>
+
 namespace otbr {
 
 /**
@@ -83,15 +85,103 @@ public:
      */
     const char *GetBackboneIfName(void) const { return mBackboneIfName; }
 
+    /**
+     * This method sets the port number the REST server listens on, so that the agents of several Thread networks
+     * can serve on the same host.
+     *
+     * @param[in] aPort  The port number, 0 for the default one.
+     *
+     */
+    void SetRestListenPort(uint16_t aPort) { mRestListenPort = aPort; }
+
+    /**
+     * This method gets the port number the REST server listens on.
+     *
+     * @returns The port number, 0 for the default one.
+     *
+     */
+    uint16_t GetRestListenPort(void) const { return mRestListenPort; }
+
+    /**
+     * This method sets the certificate and the private key the REST server is served over TLS with.
+     *
+     * @param[in] aCertFile  The path of the certificate file, nullptr to serve in plaintext.
+     * @param[in] aKeyFile   The path of the private key file.
+     *
+     */
+    void SetRestTlsFiles(const char *aCertFile, const char *aKeyFile)
+    {
+        mRestTlsCertFile = aCertFile;
+        mRestTlsKeyFile  = aKeyFile;
+    }
+
+    /**
+     * This method gets the path of the certificate file of the REST server.
+     *
+     * @returns The path of the certificate file, nullptr if served in plaintext.
+     *
+     */
+    const char *GetRestTlsCertFile(void) const { return mRestTlsCertFile; }
+
+    /**
+     * This method gets the path of the private key file of the REST server.
+     *
+     * @returns The path of the private key file.
+     *
+     */
+    const char *GetRestTlsKeyFile(void) const { return mRestTlsKeyFile; }
+
+    /**
+     * This method sets the path of the Unix domain socket the REST server also listens on, for local consumers.
+     *
+     * @param[in] aPath  The path of the socket, nullptr to listen on TCP only.
+     *
+     */
+    void SetRestUnixSocketPath(const char *aPath) { mRestUnixSocketPath = aPath; }
+
+    /**
+     * This method gets the path of the Unix domain socket of the REST server.
+     *
+     * @returns The path of the socket, nullptr if the REST server listens on TCP only.
+     *
+     */
+    const char *GetRestUnixSocketPath(void) const { return mRestUnixSocketPath; }
+
+    /**
+     * This method sets the path of the file the d-bus method calls are captured to.
+     *
+     * @param[in] aPath  The path of the capture file, nullptr to not capture.
+     *
+     */
+    void SetDBusCaptureFile(const char *aPath) { mDBusCaptureFile = aPath; }
+
+    /**
+     * This method gets the path of the file the d-bus method calls are captured to.
+     *
+     * @returns The path of the capture file, nullptr if not capturing.
+     *
+     */
+    const char *GetDBusCaptureFile(void) const { return mDBusCaptureFile; }
+
 private:
     InstanceParams()
         : mThreadIfName(nullptr)
         , mBackboneIfName(nullptr)
+        , mRestListenPort(0)
+        , mRestTlsCertFile(nullptr)
+        , mRestTlsKeyFile(nullptr)
+        , mRestUnixSocketPath(nullptr)
+        , mDBusCaptureFile(nullptr)
     {
     }
 
     const char *mThreadIfName;
     const char *mBackboneIfName;
+    uint16_t    mRestListenPort;
+    const char *mRestTlsCertFile;
+    const char *mRestTlsKeyFile;
+    const char *mRestUnixSocketPath;
+    const char *mDBusCaptureFile;
 };
 
 } // namespace otbr
@@ -0,0 +1,195 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the tracking of the link quality of the neighbors.
+ */
+
+#include "agent/link_quality.hpp"
+
+#include <string.h>
+
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/memory_stats.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+LinkQualityTracker::LinkQualityTracker(void)
+    : mLastSampleTime(0)
+{
+}
+
+uint8_t LinkQualityTracker::GetRssiBucket(int8_t aRssi)
+{
+    uint8_t bucket = 0;
+
+    if (aRssi >= kRssiBucketLow)
+    {
+        bucket = static_cast<uint8_t>(1 + (aRssi - kRssiBucketLow) / kRssiBucketWidth);
+        bucket = (bucket < kNumRssiBuckets ? bucket : kNumRssiBuckets - 1);
+    }
+
+    return bucket;
+}
+
+void LinkQualityTracker::Add(uint64_t aTime, const std::vector<otNeighborInfo> &aNeighbors)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::map<uint64_t, Stats>   neighbors;
+    uint64_t                    elapsed = aTime - mLastSampleTime;
+
+    // A clock set back samples again at once.
+    VerifyOrExit(aTime < mLastSampleTime || elapsed >= OTBR_LINK_QUALITY_SAMPLE_INTERVAL);
+
+    for (const otNeighborInfo &neighbor : aNeighbors)
+    {
+        uint64_t                                  key = 0;
+        Stats *                                   stats;
+        std::map<uint64_t, Stats>::const_iterator previous;
+
+        for (uint8_t byte : neighbor.mExtAddress.m8)
+        {
+            key = (key << 8) | byte;
+        }
+
+        stats    = &neighbors[key];
+        previous = mNeighbors.find(key);
+
+        if (previous != mNeighbors.end())
+        {
+            *stats = previous->second;
+        }
+        else
+        {
+            memset(stats, 0, sizeof(*stats));
+            stats->mExtAddress = neighbor.mExtAddress;
+            stats->mFirstSeen  = aTime;
+        }
+
+        stats->mLastSeen = aTime;
+        Sample(*stats, neighbor, elapsed);
+    }
+
+    mNeighbors.swap(neighbors);
+    mLastSampleTime = aTime;
+    MemoryStats::Get().Update(MemoryStats::kSubsystemLinkQuality, MemoryStats::TreeSize(mNeighbors));
+
+exit:
+    return;
+}
+
+void LinkQualityTracker::Sample(Stats &aStats, const otNeighborInfo &aNeighbor, uint64_t aElapsed)
+{
+    int8_t rssi = aNeighbor.mLastRssi;
+    bool   degraded;
+
+    aStats.mRloc16           = aNeighbor.mRloc16;
+    aStats.mIsChild          = aNeighbor.mIsChild;
+    aStats.mFrameErrorRate   = aNeighbor.mFrameErrorRate;
+    aStats.mMessageErrorRate = aNeighbor.mMessageErrorRate;
+
+    // Without a frame heard since the previous sample, the RSSI and the link quality were already sampled.
+    VerifyOrExit(rssi != OT_RADIO_RSSI_INVALID && (aStats.mSamples == 0 || aNeighbor.mAge < aElapsed));
+
+    if (aStats.mSamples >= OTBR_LINK_QUALITY_MAX_SAMPLES)
+    {
+        uint16_t samples = 0;
+
+        for (uint16_t &count : aStats.mRssiHistogram)
+        {
+            count /= 2;
+            samples += count;
+        }
+
+        for (uint16_t &count : aStats.mLinkQualityHistogram)
+        {
+            count /= 2;
+        }
+
+        aStats.mRssiSum = static_cast<int32_t>(static_cast<int64_t>(aStats.mRssiSum) * samples / aStats.mSamples);
+        aStats.mFrameErrorRateSum =
+            static_cast<uint32_t>(static_cast<uint64_t>(aStats.mFrameErrorRateSum) * samples / aStats.mSamples);
+        aStats.mSamples           = samples;
+    }
+
+    if (aStats.mSamples == 0)
+    {
+        aStats.mMinRssi      = rssi;
+        aStats.mMaxRssi      = rssi;
+        aStats.mRecentRssi   = static_cast<int16_t>(rssi * 64);
+        aStats.mBaselineRssi = static_cast<int16_t>(rssi * 64);
+    }
+    else
+    {
+        aStats.mMinRssi      = (rssi < aStats.mMinRssi ? rssi : aStats.mMinRssi);
+        aStats.mMaxRssi      = (rssi > aStats.mMaxRssi ? rssi : aStats.mMaxRssi);
+        aStats.mRecentRssi   = static_cast<int16_t>(aStats.mRecentRssi + (rssi * 64 - aStats.mRecentRssi) / 8);
+        aStats.mBaselineRssi = static_cast<int16_t>(aStats.mBaselineRssi + (rssi * 64 - aStats.mBaselineRssi) / 64);
+    }
+
+    aStats.mRssiHistogram[GetRssiBucket(rssi)]++;
+    aStats.mLinkQualityHistogram[aNeighbor.mLinkQualityIn < kNumLinkQualities ? aNeighbor.mLinkQualityIn
+                                                                              : kNumLinkQualities - 1]++;
+    aStats.mRssiSum += rssi;
+    aStats.mFrameErrorRateSum += aNeighbor.mFrameErrorRate;
+    aStats.mSamples++;
+
+exit:
+    degraded = aStats.mSamples >= kMinDegradedSamples &&
+               (aStats.GetRecentRssi() + OTBR_LINK_QUALITY_DEGRADED_RSSI_DROP <= aStats.GetBaselineRssi() ||
+                aStats.mFrameErrorRate >= OTBR_LINK_QUALITY_DEGRADED_FRAME_ERROR_RATE);
+
+    if (degraded != aStats.mDegraded)
+    {
+        otbrLog(OTBR_LOG_NOTICE, "Link to neighbor 0x%04x %s: recent RSSI %d dBm, baseline %d dBm, frame error %.1f%%",
+                aStats.mRloc16, degraded ? "degraded" : "recovered", aStats.GetRecentRssi(), aStats.GetBaselineRssi(),
+                aStats.mFrameErrorRate * 100.0 / UINT16_MAX);
+        aStats.mDegraded = degraded;
+    }
+}
+
+void LinkQualityTracker::Get(std::vector<Stats> &aStats) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    aStats.clear();
+    aStats.reserve(mNeighbors.size());
+
+    for (const auto &neighbor : mNeighbors)
+    {
+        aStats.push_back(neighbor.second);
+    }
+}
+
+} // namespace Ncp
+} // namespace otbr
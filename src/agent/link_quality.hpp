@@ -0,0 +1,212 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the tracking of the link quality of the neighbors.
+ */
+
+#ifndef OTBR_AGENT_LINK_QUALITY_HPP_
+#define OTBR_AGENT_LINK_QUALITY_HPP_
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <openthread/thread.h>
+
+/**
+ * The minimum interval, in seconds, between two samples of the neighbor table.
+ *
+ */
+#ifndef OTBR_LINK_QUALITY_SAMPLE_INTERVAL
+#define OTBR_LINK_QUALITY_SAMPLE_INTERVAL 10
+#endif
+
+/**
+ * The number of samples of a neighbor after which its histograms and averages are halved, so that older samples
+ * fade out.
+ *
+ */
+#ifndef OTBR_LINK_QUALITY_MAX_SAMPLES
+#define OTBR_LINK_QUALITY_MAX_SAMPLES 360
+#endif
+
+/**
+ * The drop of the recent RSSI below the baseline RSSI of a neighbor, in dB, from which its link is degraded.
+ *
+ */
+#ifndef OTBR_LINK_QUALITY_DEGRADED_RSSI_DROP
+#define OTBR_LINK_QUALITY_DEGRADED_RSSI_DROP 10
+#endif
+
+/**
+ * The frame error rate of a neighbor (0xffff for 100%) from which its link is degraded.
+ *
+ */
+#ifndef OTBR_LINK_QUALITY_DEGRADED_FRAME_ERROR_RATE
+#define OTBR_LINK_QUALITY_DEGRADED_FRAME_ERROR_RATE 0x1999
+#endif
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class tracks the link quality of each neighbor from periodic samples of the neighbor table.
+ *
+ * A neighbor keeps fixed-bucket histograms of the RSSI and of the link quality of the frames heard from it, and
+ * averages of its RSSI and frame error rate, in a hundred bytes however long it is tracked. The RSSI is also followed
+ * by a fast and a slow moving average, the link of a neighbor is degraded when the recent RSSI drops well below the
+ * baseline one, or when its frame error rate is high. A neighbor leaving the neighbor table is no longer tracked.
+ *
+ * The samples are added on the mainloop thread, and the statistics can be read from any thread.
+ *
+ */
+class LinkQualityTracker
+{
+public:
+    static constexpr uint8_t kNumRssiBuckets     = 8;   ///< The number of buckets of the RSSI histogram.
+    static constexpr int8_t  kRssiBucketLow      = -90; ///< The upper bound of the first RSSI bucket, in dBm.
+    static constexpr uint8_t kRssiBucketWidth    = 10;  ///< The width of the RSSI buckets in between, in dB.
+    static constexpr uint8_t kNumLinkQualities   = 4;   ///< The number of link qualities, from 0 to 3.
+    static constexpr uint8_t kMinDegradedSamples = 6;   ///< The number of samples before a link can be degraded.
+
+    static_assert(OTBR_LINK_QUALITY_MAX_SAMPLES <= UINT16_MAX, "The histograms count up to UINT16_MAX samples");
+
+    /**
+     * This structure represents the link quality statistics of a neighbor.
+     *
+     */
+    struct Stats
+    {
+        otExtAddress mExtAddress;                              ///< The extended address.
+        uint16_t     mRloc16;                                  ///< The RLOC16.
+        bool         mIsChild;                                 ///< Whether the neighbor is a child.
+        uint64_t     mFirstSeen;                               ///< The first sample, in seconds since the Unix epoch.
+        uint64_t     mLastSeen;                                ///< The latest sample, in seconds since the Unix epoch.
+        uint16_t     mSamples;                                 ///< The number of samples in the histograms.
+        uint16_t     mRssiHistogram[kNumRssiBuckets];          ///< The number of samples of each RSSI bucket.
+        uint16_t     mLinkQualityHistogram[kNumLinkQualities]; ///< The number of samples of each link quality.
+        int8_t       mMinRssi;                                 ///< The lowest RSSI sampled, in dBm.
+        int8_t       mMaxRssi;                                 ///< The highest RSSI sampled, in dBm.
+        int32_t      mRssiSum;                                 ///< The sum of the RSSI of the samples.
+        int16_t      mRecentRssi;                              ///< The fast moving average of the RSSI, in 1/64 dBm.
+        int16_t      mBaselineRssi;                            ///< The slow moving average of the RSSI, in 1/64 dBm.
+        uint16_t     mFrameErrorRate;                          ///< The latest frame error rate, 0xffff for 100%.
+        uint16_t     mMessageErrorRate;                        ///< The latest message error rate, 0xffff for 100%.
+        uint32_t     mFrameErrorRateSum;                       ///< The sum of the frame error rates of the samples.
+        bool         mDegraded;                                ///< Whether the link is degraded.
+
+        /**
+         * This method returns the average RSSI of the samples.
+         *
+         * @returns The average RSSI in dBm, 0 without samples.
+         *
+         */
+        int8_t GetAverageRssi(void) const { return mSamples == 0 ? 0 : static_cast<int8_t>(mRssiSum / mSamples); }
+
+        /**
+         * This method returns the fast moving average of the RSSI, which follows the latest samples.
+         *
+         * @returns The recent RSSI in dBm.
+         *
+         */
+        int8_t GetRecentRssi(void) const { return static_cast<int8_t>(mRecentRssi / 64); }
+
+        /**
+         * This method returns the slow moving average of the RSSI, which the recent RSSI is compared to.
+         *
+         * @returns The baseline RSSI in dBm.
+         *
+         */
+        int8_t GetBaselineRssi(void) const { return static_cast<int8_t>(mBaselineRssi / 64); }
+
+        /**
+         * This method returns the average frame error rate of the samples.
+         *
+         * @returns The average frame error rate, 0xffff for 100%.
+         *
+         */
+        uint16_t GetAverageFrameErrorRate(void) const
+        {
+            return mSamples == 0 ? 0 : static_cast<uint16_t>(mFrameErrorRateSum / mSamples);
+        }
+    };
+
+    /**
+     * This method returns the bucket of an RSSI in the RSSI histogram.
+     *
+     * The first bucket holds the RSSI below `kRssiBucketLow`, the last one the RSSI above the other buckets.
+     *
+     * @param[in]   aRssi   The RSSI in dBm.
+     *
+     * @returns The index of the bucket.
+     *
+     */
+    static uint8_t GetRssiBucket(int8_t aRssi);
+
+    /**
+     * The constructor initializes an empty tracker.
+     *
+     */
+    LinkQualityTracker(void);
+
+    /**
+     * This method samples the neighbor table, at most every `OTBR_LINK_QUALITY_SAMPLE_INTERVAL`.
+     *
+     * The RSSI and link quality of a neighbor are only sampled when a frame was heard from it since the previous
+     * sample.
+     *
+     * @param[in]   aTime       The time the table was read, in seconds since the Unix epoch.
+     * @param[in]   aNeighbors  The neighbor table.
+     *
+     */
+    void Add(uint64_t aTime, const std::vector<otNeighborInfo> &aNeighbors);
+
+    /**
+     * This method reads the statistics of the neighbors tracked.
+     *
+     * @param[out]  aStats  The statistics, ordered by extended address.
+     *
+     */
+    void Get(std::vector<Stats> &aStats) const;
+
+private:
+    static void Sample(Stats &aStats, const otNeighborInfo &aNeighbor, uint64_t aElapsed);
+
+    mutable std::mutex        mMutex;
+    std::map<uint64_t, Stats> mNeighbors;
+    uint64_t                  mLastSampleTime;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_LINK_QUALITY_HPP_
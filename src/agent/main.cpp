@@ -28,7 +28,7 @@
 
 #include <openthread-br/config.h>
 
-#include <mutex>
+#include <chrono>
 #include <thread>
 
 #include <errno.h>
@@ -46,9 +46,17 @@
 #include "agent/ncp.hpp"
 #include "agent/ncp_openthread.hpp"
 #include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
+#include "common/health.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_clock.hpp"
+#include "common/mainloop_profiler.hpp"
 #include "common/region_code.hpp"
+#include "common/thread_scheduling.hpp"
+#include "common/timer.hpp"
+#include "common/trace.hpp"
 #include "common/types.hpp"
+#include "utils/state_cache.hpp"
 #if OTBR_ENABLE_REST_SERVER
 #include "rest/rest_web_server.hpp"
 using otbr::rest::RestWebServer;
@@ -57,14 +65,23 @@ using otbr::rest::RestWebServer;
 #include "dbus/server/dbus_agent.hpp"
 using otbr::DBus::DBusAgent;
 #endif
+using otbr::EventPoller;
+using otbr::Health;
+using otbr::MainloopProfiler;
+using otbr::StateCache;
+using otbr::ThreadScheduling;
+using otbr::TimerScheduler;
 using otbr::Ncp::ControllerOpenThread;
+using std::chrono::steady_clock;
 
 #if OTBR_ENABLE_OPENWRT
-extern void       UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd);
-extern void       UbusProcess(const fd_set &aReadFdSet);
-extern void       UbusServerRun(void);
-extern void       UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aNcpThreadMutex);
-static std::mutex sThreadMutex;
+extern void UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd);
+extern void UbusProcess(const fd_set &aReadFdSet);
+extern void UbusServerRun(void);
+extern void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController);
+#if OTBR_ENABLE_UBUS_INLINE
+extern void UbusServerStop(void);
+#endif
 #endif
 
 static const char kSyslogIdent[]          = "otbr-agent";
@@ -81,11 +98,24 @@ enum
     OTBR_OPT_SHORTMAX                = 128,
     OTBR_OPT_RADIO_VERSION,
     OTBR_OPT_REGION,
+    OTBR_OPT_TRACE_FILE,
+    OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_STATE_CACHE_FILE,
+    OTBR_OPT_REST_TLS_CERT,
+    OTBR_OPT_REST_TLS_KEY,
+    OTBR_OPT_REST_UNIX_SOCKET,
+    OTBR_OPT_RADIO_CPUS,
+    OTBR_OPT_RADIO_PRIORITY,
+    OTBR_OPT_MANAGEMENT_CPUS,
+    OTBR_OPT_DBUS_CAPTURE_FILE,
+    OTBR_OPT_TRACE_DUMP_FILE,
 };
 
 // Default poll timeout.
-static const struct timeval kPollTimeout = {10, 0};
-static const struct option  kOptions[]   = {
+static const struct timeval kPollTimeout         = {10, 0};
+// Poll timeout for checking whether the NCP is initialized while serving the starting state.
+static const struct timeval kStartingPollTimeout = {0, 10000};
+static const struct option  kOptions[]           = {
     {"backbone-ifname", required_argument, nullptr, OTBR_OPT_BACKBONE_INTERFACE_NAME},
     {"debug-level", required_argument, nullptr, OTBR_OPT_DEBUG_LEVEL},
     {"help", no_argument, nullptr, OTBR_OPT_HELP},
@@ -94,6 +124,23 @@ static const struct option  kOptions[]   = {
     {"version", no_argument, nullptr, OTBR_OPT_VERSION},
     {"radio-version", no_argument, nullptr, OTBR_OPT_RADIO_VERSION},
     {"reg", required_argument, nullptr, OTBR_OPT_REGION},
+    {"trace-file", required_argument, nullptr, OTBR_OPT_TRACE_FILE},
+    {"trace-dump-file", required_argument, nullptr, OTBR_OPT_TRACE_DUMP_FILE},
+    {"state-cache-file", required_argument, nullptr, OTBR_OPT_STATE_CACHE_FILE},
+    {"radio-cpus", required_argument, nullptr, OTBR_OPT_RADIO_CPUS},
+    {"radio-priority", required_argument, nullptr, OTBR_OPT_RADIO_PRIORITY},
+    {"management-cpus", required_argument, nullptr, OTBR_OPT_MANAGEMENT_CPUS},
+#if OTBR_ENABLE_DBUS_SERVER
+    {"dbus-capture-file", required_argument, nullptr, OTBR_OPT_DBUS_CAPTURE_FILE},
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"rest-unix-socket", required_argument, nullptr, OTBR_OPT_REST_UNIX_SOCKET},
+#endif
+#if OTBR_ENABLE_REST_TLS
+    {"rest-tls-cert", required_argument, nullptr, OTBR_OPT_REST_TLS_CERT},
+    {"rest-tls-key", required_argument, nullptr, OTBR_OPT_REST_TLS_KEY},
+#endif
     {0, 0, 0, 0}};
 
 static void HandleSignal(int aSignal)
@@ -101,29 +148,171 @@ static void HandleSignal(int aSignal)
     signal(aSignal, SIG_DFL);
 }
 
-static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
+#if OTBR_ENABLE_MAINLOOP_PROFILER
+static void HandleProfilerSignal(int aSignal)
+{
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+    MainloopProfiler::RequestDump();
+}
+
+#define OTBR_MAINLOOP_PROFILE(aSubsystem, aPhase, aStatement)                                           \
+    do                                                                                                  \
+    {                                                                                                   \
+        MainloopProfiler::Get().Start(MainloopProfiler::aPhase, mainloop);                              \
+        aStatement;                                                                                     \
+        MainloopProfiler::Get().Stop(MainloopProfiler::aSubsystem, MainloopProfiler::aPhase, mainloop); \
+    } while (false)
+#else
+#define OTBR_MAINLOOP_PROFILE(aSubsystem, aPhase, aStatement) aStatement
+#endif
+
+static long ElapsedMilliseconds(steady_clock::time_point aStartTime)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    return static_cast<long>(duration_cast<milliseconds>(steady_clock::now() - aStartTime).count());
+}
+
+// Traces the iterations which processed long enough to delay the radio, the idle ones would overwrite the others.
+static void TraceMainloopIteration(steady_clock::time_point aSelectTime,
+                                   steady_clock::time_point aProcessTime,
+                                   int                      aResult)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    microseconds processing = duration_cast<microseconds>(steady_clock::now() - aProcessTime);
+    microseconds waiting    = duration_cast<microseconds>(aProcessTime - aSelectTime);
+    uint32_t     data[2];
+
+    VerifyOrExit(processing.count() >= OTBR_TRACE_MAINLOOP_MIN_DURATION);
+
+    // 32 bits of microseconds hold more than an hour.
+    data[0] = static_cast<uint32_t>(waiting.count());
+    data[1] = static_cast<uint32_t>(aResult);
+    otbrTrace(OTBR_TRACE_MAINLOOP, static_cast<uint32_t>(processing.count()), data, sizeof(data));
+
+exit:
+    return;
+}
+
+// Serves the services not relying on the NCP until the NCP initialized on another thread is up: the REST server
+// answers with the starting state and the border agent serves the service restored from the state cache. With
+// OTBR_ENABLE_RADIO_THREAD, the REST server runs on its own thread from then on.
+static otbrError ServeStarting(otbr::AgentInstance &aInstance)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+#if OTBR_ENABLE_REST_SERVER
+    RestWebServer &restServer =
+        *RestWebServer::GetRestWebServer(&static_cast<ControllerOpenThread &>(aInstance.GetNcp()));
+
+    restServer.Start();
+#endif
+
+    while (!aInstance.IsNcpInitDone())
+    {
+        otSysMainloopContext mainloop;
+        int                  rval;
+
+        Health::Get().Heartbeat();
+
+        // The timeouts of all subsystems are computed from the same time.
+        MainloopClock::Update();
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = kStartingPollTimeout;
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        aInstance.UpdateStartingFdSet(mainloop);
+        EventPoller::Get().UpdateFdSet(mainloop);
+        TimerScheduler::Get().UpdateTimeout(mainloop.mTimeout);
+#if OTBR_ENABLE_REST_SERVER && !OTBR_ENABLE_RADIO_THREAD
+        restServer.UpdateFdSet(mainloop);
+#endif
+
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        MainloopClock::Update();
+
+        if (rval >= 0)
+        {
+            // The timers started so far belong to the mDNS publisher.
+            aInstance.ProcessStarting(mainloop);
+            EventPoller::Get().Process(mainloop);
+            TimerScheduler::Get().Process();
+#if OTBR_ENABLE_REST_SERVER && !OTBR_ENABLE_RADIO_THREAD
+            restServer.Process(mainloop);
+#endif
+        }
+        else if (errno != EINTR)
+        {
+            error = OTBR_ERROR_ERRNO;
+            otbrLog(OTBR_LOG_ERR, "select() failed: %s", strerror(errno));
+            break;
+        }
+    }
+
+    // The initialization until the mainloop starts takes a while, its timers are started from the current time.
+    MainloopClock::Reset();
+
+    return error;
+}
+
+static int Mainloop(otbr::AgentInstance &   aInstance,
+                    const char *             aInterfaceName,
+                    const ThreadScheduling & aRadioScheduling,
+                    steady_clock::time_point aStartTime)
 {
-    int                   error         = EXIT_FAILURE;
-    ControllerOpenThread &ncpOpenThread = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
+    int                      error         = EXIT_FAILURE;
+    ControllerOpenThread &   ncpOpenThread = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
+    steady_clock::time_point phaseTime     = steady_clock::now();
 
 #if OTBR_ENABLE_DBUS_SERVER
     std::unique_ptr<DBusAgent> dbusAgent = std::unique_ptr<DBusAgent>(new DBusAgent(aInterfaceName, &ncpOpenThread));
     dbusAgent->Init();
+    otbrLog(OTBR_LOG_INFO, "Startup phase: dbus %ld ms", ElapsedMilliseconds(phaseTime));
+    phaseTime = steady_clock::now();
 #else
     (void)aInterfaceName;
 #endif
 #if OTBR_ENABLE_REST_SERVER
     RestWebServer *restServer = RestWebServer::GetRestWebServer(&ncpOpenThread);
     restServer->Init();
+    otbrLog(OTBR_LOG_INFO, "Startup phase: rest %ld ms", ElapsedMilliseconds(phaseTime));
 #endif
-    otbrLog(OTBR_LOG_INFO, "Border router agent started.");
+    OTBR_UNUSED_VARIABLE(phaseTime);
+
+    // All management threads are started, they keep the scheduling they inherited.
+    if (ApplyThreadScheduling(aRadioScheduling) != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to apply the scheduling of the mainloop: %s", strerror(errno));
+    }
+    otbrLog(OTBR_LOG_INFO, "Scheduling of the mainloop: %s", otbr::DescribeThreadScheduling().c_str());
+
+    otbrLog(OTBR_LOG_INFO, "Border router agent started in %ld ms.", ElapsedMilliseconds(aStartTime));
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+#if OTBR_ENABLE_MAINLOOP_PROFILER
+    signal(SIGUSR1, HandleProfilerSignal);
+#endif
 
     while (true)
     {
-        otSysMainloopContext mainloop;
-        int                  rval;
+        otSysMainloopContext     mainloop;
+        int                      rval;
+        steady_clock::time_point selectTime;
+        steady_clock::time_point processTime;
+
+        Health::Get().Heartbeat();
+
+        // The timeouts of all subsystems are computed from the same time.
+        MainloopClock::Update();
 
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
@@ -132,24 +321,45 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        aInstance.UpdateFdSet(mainloop);
+#if OTBR_ENABLE_MAINLOOP_PROFILER
+        if (MainloopProfiler::Get().IsDumpRequested())
+        {
+            MainloopProfiler::Get().Dump();
+        }
+#endif
+
+        OTBR_MAINLOOP_PROFILE(kSubsystemAgent, kPhaseUpdate, aInstance.UpdateFdSet(mainloop));
+        OTBR_MAINLOOP_PROFILE(kSubsystemEventPoller, kPhaseUpdate, EventPoller::Get().UpdateFdSet(mainloop));
+        OTBR_MAINLOOP_PROFILE(kSubsystemTimer, kPhaseUpdate, TimerScheduler::Get().UpdateTimeout(mainloop.mTimeout));
 
 #if OTBR_ENABLE_DBUS_SERVER
-        dbusAgent->UpdateFdSet(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet, mainloop.mMaxFd,
-                               mainloop.mTimeout);
+        OTBR_MAINLOOP_PROFILE(kSubsystemDBus, kPhaseUpdate, dbusAgent->UpdateFdSet(mainloop));
 #endif
 
-#if OTBR_ENABLE_REST_SERVER
-        restServer->UpdateFdSet(mainloop);
+#if OTBR_ENABLE_REST_SERVER && !OTBR_ENABLE_RADIO_THREAD
+        OTBR_MAINLOOP_PROFILE(kSubsystemRest, kPhaseUpdate, restServer->UpdateFdSet(mainloop));
 #endif
 
 #if OTBR_ENABLE_OPENWRT
-        UbusUpdateFdSet(mainloop.mReadFdSet, mainloop.mMaxFd);
-        sThreadMutex.unlock();
+        OTBR_MAINLOOP_PROFILE(kSubsystemUbus, kPhaseUpdate, UbusUpdateFdSet(mainloop.mReadFdSet, mainloop.mMaxFd));
 #endif
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+#if OTBR_ENABLE_MAINLOOP_PROFILER
+        MainloopProfiler::Get().BeginSelect();
+#endif
+        selectTime  = steady_clock::now();
+        rval        = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                             &mainloop.mTimeout);
+        processTime = steady_clock::now();
+        MainloopClock::Update();
+#if OTBR_ENABLE_MAINLOOP_PROFILER
+        MainloopProfiler::Get().EndSelect(mainloop, rval);
+
+        if (rval < 0 && errno == EINTR && MainloopProfiler::Get().IsDumpRequested())
+        {
+            continue;
+        }
+#endif
 
         if (ncpOpenThread.IsResetRequested())
         {
@@ -159,38 +369,64 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 
         if (rval >= 0)
         {
-#if OTBR_ENABLE_OPENWRT
-            sThreadMutex.lock();
-            UbusProcess(mainloop.mReadFdSet);
+            // The radio is processed first, then the poller dispatches the ND Proxy before the management work,
+            // which is limited to a budget per iteration.
+            OTBR_MAINLOOP_PROFILE(kSubsystemAgent, kPhaseProcess, aInstance.Process(mainloop));
+            OTBR_MAINLOOP_PROFILE(kSubsystemEventPoller, kPhaseProcess, EventPoller::Get().Process(mainloop));
+            OTBR_MAINLOOP_PROFILE(kSubsystemTimer, kPhaseProcess, TimerScheduler::Get().Process());
+
+#if OTBR_ENABLE_REST_SERVER && !OTBR_ENABLE_RADIO_THREAD
+            OTBR_MAINLOOP_PROFILE(kSubsystemRest, kPhaseProcess, restServer->Process(mainloop));
 #endif
 
-#if OTBR_ENABLE_REST_SERVER
-            restServer->Process(mainloop);
+#if OTBR_ENABLE_DBUS_SERVER
+            OTBR_MAINLOOP_PROFILE(kSubsystemDBus, kPhaseProcess, dbusAgent->Process(mainloop));
 #endif
 
-            aInstance.Process(mainloop);
-
-#if OTBR_ENABLE_DBUS_SERVER
-            dbusAgent->Process(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet);
+#if OTBR_ENABLE_OPENWRT
+            OTBR_MAINLOOP_PROFILE(kSubsystemUbus, kPhaseProcess, UbusProcess(mainloop.mReadFdSet));
 #endif
+            TraceMainloopIteration(selectTime, processTime, rval);
         }
         else
         {
-#if OTBR_ENABLE_OPENWRT
-            sThreadMutex.lock();
-#endif
             error = OTBR_ERROR_ERRNO;
             otbrLog(OTBR_LOG_ERR, "select() failed", strerror(errno));
             break;
         }
     }
 
+#if OTBR_ENABLE_REST_SERVER
+    restServer->RemoveUnixSocket();
+#endif
+
     return error;
 }
 
 static void PrintHelp(const char *aProgramName)
 {
-    fprintf(stderr, "Usage: %s [--reg region] [-I interfaceName] [-d DEBUG_LEVEL] [-v] RADIO_URL\n", aProgramName);
+    fprintf(stderr, "Usage: %s [--reg region] [--trace-file path] [-I interfaceName] [-d DEBUG_LEVEL] [-v] RADIO_URL\n",
+            aProgramName);
+#if OTBR_ENABLE_DBUS_SERVER
+    fprintf(stderr, "    --dbus-capture-file New file the d-bus method calls are captured to, for dbus-replay.\n");
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    fprintf(stderr, "    --rest-listen-port  Port of the REST server, one for each agent of a host, %d by default.\n",
+            OTBR_REST_LISTEN_PORT);
+    fprintf(stderr, "    --rest-unix-socket  Unix domain socket the REST server also serves local consumers on.\n");
+#endif
+#if OTBR_ENABLE_REST_TLS
+    fprintf(stderr, "    --rest-tls-cert     Certificate file of the REST server, served over HTTPS when set.\n");
+    fprintf(stderr, "    --rest-tls-key      Private key file of the certificate of the REST server.\n");
+#endif
+    fprintf(stderr, "    --trace-file        File the events are traced to, in memory by default.\n");
+    fprintf(stderr, "    --trace-dump-file   File the trace is dumped to on SIGUSR2 and crashes, %s by default.\n",
+            OTBR_TRACE_DUMP_DIR "/otbr-agent-<thread-ifname>.trace");
+    fprintf(stderr, "    --state-cache-file  File the state is restored from, empty to disable, %s by default.\n",
+            StateCache::GetDefaultPath("<thread-ifname>").c_str());
+    fprintf(stderr, "    --radio-cpus        CPUs of the mainloop processing the radio, e.g. 2-3.\n");
+    fprintf(stderr, "    --radio-priority    SCHED_FIFO priority of the mainloop processing the radio, 1 to 99.\n");
+    fprintf(stderr, "    --management-cpus   CPUs of the other threads, e.g. of ubus and the REST server, e.g. 0,1.\n");
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
@@ -212,7 +448,8 @@ static void OnAllocateFailed(void)
 
 int main(int argc, char *argv[])
 {
-    int                              logLevel = OTBR_LOG_INFO;
+    steady_clock::time_point         startTime = steady_clock::now();
+    int                              logLevel  = OTBR_LOG_INFO;
     int                              opt;
     int                              ret                   = EXIT_SUCCESS;
     const char *                     interfaceName         = kDefaultInterfaceName;
@@ -221,7 +458,20 @@ int main(int argc, char *argv[])
     otbr::Ncp::ControllerOpenThread *ncpOpenThread         = nullptr;
     bool                             verbose               = false;
     bool                             printRadioVersion     = false;
+    const char *                     traceFile             = nullptr;
+    std::string                      traceDumpFile;
+    int                              restListenPort        = 0;
+    const char *                     restTlsCert           = nullptr;
+    const char *                     restTlsKey            = nullptr;
+    const char *                     restUnixSocket        = nullptr;
+    const char *                     dbusCaptureFile       = nullptr;
     std::string                      regionCode;
+    std::string                      stateCacheFile;
+    bool                             hasStateCacheFile = false;
+    ThreadScheduling                 radioScheduling;
+    ThreadScheduling                 managementScheduling;
+    otbrError                        managementError;
+    int                              managementErrno;
 
     std::set_new_handler(OnAllocateFailed);
 
@@ -264,6 +514,60 @@ int main(int argc, char *argv[])
             regionCode = optarg;
             break;
 
+        case OTBR_OPT_TRACE_FILE:
+            traceFile = optarg;
+            break;
+
+        case OTBR_OPT_TRACE_DUMP_FILE:
+            traceDumpFile = optarg;
+            break;
+
+        case OTBR_OPT_STATE_CACHE_FILE:
+            stateCacheFile    = optarg;
+            hasStateCacheFile = true;
+            break;
+
+        case OTBR_OPT_RADIO_CPUS:
+            VerifyOrExit(otbr::ParseCpuList(optarg, radioScheduling.mCpus) == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_RADIO_PRIORITY:
+            VerifyOrExit(otbr::ParseFifoPriority(optarg, radioScheduling.mPriority) == OTBR_ERROR_NONE,
+                         ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_MANAGEMENT_CPUS:
+            VerifyOrExit(otbr::ParseCpuList(optarg, managementScheduling.mCpus) == OTBR_ERROR_NONE,
+                         ret = EXIT_FAILURE);
+            break;
+
+#if OTBR_ENABLE_DBUS_SERVER
+        case OTBR_OPT_DBUS_CAPTURE_FILE:
+            dbusCaptureFile = optarg;
+            break;
+#endif
+
+#if OTBR_ENABLE_REST_SERVER
+        case OTBR_OPT_REST_LISTEN_PORT:
+            restListenPort = atoi(optarg);
+            VerifyOrExit(restListenPort > 0 && restListenPort <= UINT16_MAX, ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_REST_UNIX_SOCKET:
+            restUnixSocket = optarg;
+            break;
+#endif
+
+#if OTBR_ENABLE_REST_TLS
+        case OTBR_OPT_REST_TLS_CERT:
+            restTlsCert = optarg;
+            break;
+
+        case OTBR_OPT_REST_TLS_KEY:
+            restTlsKey = optarg;
+            break;
+#endif
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -271,9 +575,42 @@ int main(int argc, char *argv[])
         }
     }
 
+    // Every thread is started from the main thread, and inherits the scheduling of the management threads until the
+    // mainloop applies its own.
+    managementError = ApplyThreadScheduling(managementScheduling);
+    managementErrno = errno;
+    otbr::SaveManagementScheduling();
+
     otbrLogInit(kSyslogIdent, logLevel, verbose);
     otbrLog(OTBR_LOG_INFO, "Running %s", OTBR_PACKAGE_VERSION);
+
+    if (managementError != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to apply the scheduling of the management threads: %s",
+                strerror(managementErrno));
+    }
+    otbrLog(OTBR_LOG_INFO, "Scheduling of the management threads: %s", otbr::DescribeThreadScheduling().c_str());
     VerifyOrExit(optind < argc, ret = EXIT_FAILURE);
+    VerifyOrExit((restTlsCert == nullptr) == (restTlsKey == nullptr), ret = EXIT_FAILURE);
+
+    // Without a trace file, the recent events are kept in memory and dumped on crashes.
+    VerifyOrExit(otbrTraceInit(traceFile) == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+    if (traceDumpFile.empty())
+    {
+        traceDumpFile = std::string(OTBR_TRACE_DUMP_DIR "/otbr-agent-") + interfaceName + ".trace";
+    }
+    otbrTraceSetDumpPath(traceDumpFile.c_str());
+
+    if (!hasStateCacheFile)
+    {
+        stateCacheFile = StateCache::GetDefaultPath(interfaceName);
+    }
+
+    // The agent starts without restoring its state if the state cache file can't be opened.
+    if (!stateCacheFile.empty())
+    {
+        StateCache::Get().Open(stateCacheFile);
+    }
 
     ncp           = otbr::Ncp::Controller::Create(interfaceName, argv[optind], backboneInterfaceName);
     ncpOpenThread = static_cast<ControllerOpenThread *>(ncp);
@@ -293,8 +630,19 @@ int main(int argc, char *argv[])
 
         otbr::InstanceParams::Get().SetThreadIfName(interfaceName);
         otbr::InstanceParams::Get().SetBackboneIfName(backboneInterfaceName);
+        otbr::InstanceParams::Get().SetRestListenPort(static_cast<uint16_t>(restListenPort));
+        otbr::InstanceParams::Get().SetRestTlsFiles(restTlsCert, restTlsKey);
+        otbr::InstanceParams::Get().SetRestUnixSocketPath(restUnixSocket);
+        otbr::InstanceParams::Get().SetDBusCaptureFile(dbusCaptureFile);
 
+        if (!printRadioVersion)
+        {
+            // The REST server and the restored border agent service are up while waiting for the RCP.
+            instance.StartInit();
+            SuccessOrExit(ret = ServeStarting(instance));
+        }
         SuccessOrExit(ret = instance.Init());
+        ncpOpenThread->GetThreadHelper()->StartResume();
 
         if (printRadioVersion)
         {
@@ -303,14 +651,24 @@ int main(int argc, char *argv[])
         }
 
 #if OTBR_ENABLE_OPENWRT
-        UbusServerInit(ncpOpenThread, &sThreadMutex);
+        UbusServerInit(ncpOpenThread);
+#if OTBR_ENABLE_UBUS_INLINE
+        // Only connects, the requests are handled by the mainloop.
+        UbusServerRun();
+#else
         std::thread(UbusServerRun).detach();
 #endif
-        SuccessOrExit(ret = Mainloop(instance, interfaceName));
+#endif
+        ret = Mainloop(instance, interfaceName, radioScheduling, startTime);
+#if OTBR_ENABLE_OPENWRT && OTBR_ENABLE_UBUS_INLINE
+        UbusServerStop();
+#endif
     }
 
-    otbrLogDeinit();
-
 exit:
+    // The pending updates of the state are written also when the mainloop fails.
+    StateCache::Get().Close();
+    otbrTraceDeinit();
+    otbrLogDeinit();
     return ret;
 }
@@ -0,0 +1,502 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   The file implements the MeshCoP proxy of the Thread border agent.
+ */
+
+#include "agent/meshcop_proxy.hpp"
+
+#if OTBR_ENABLE_MESHCOP_PROXY
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+MeshcopProxyCounters &MeshcopProxyCounters::Get(void)
+{
+    static MeshcopProxyCounters sCounters;
+
+    return sCounters;
+}
+
+void MeshcopProxy::Batch::Prepare(void)
+{
+    for (uint16_t index = 0; index < kBatchSize; index++)
+    {
+        msghdr &header = mMessages[index].msg_hdr;
+
+        mIovecs[index].iov_base = mBuffers[index];
+        mIovecs[index].iov_len  = sizeof(mBuffers[index]);
+
+        memset(&header, 0, sizeof(header));
+        header.msg_name          = &mAddresses[index];
+        header.msg_namelen       = sizeof(mAddresses[index]);
+        header.msg_iov           = &mIovecs[index];
+        header.msg_iovlen        = 1;
+        mMessages[index].msg_len = 0;
+    }
+}
+
+MeshcopProxy::MeshcopProxy(uint16_t aUpstreamPort)
+    : mUpstreamPort(aUpstreamPort)
+    , mListenFd(-1)
+    , mSessions(kMaxSessions)
+    , mExpireTimer(HandleExpireTimer, this)
+{
+    size_t slots = 1;
+
+    // At most half of the slots are used, so that probing sequences stay short and always end at an empty slot.
+    while (slots < 2 * kMaxSessions)
+    {
+        slots <<= 1;
+    }
+    mSlots.assign(slots, kNoSession);
+
+    for (uint16_t index = kMaxSessions; index > 0; index--)
+    {
+        mSessions[index - 1].mProxy = this;
+        mSessions[index - 1].mFd    = -1;
+        mFreeSessions.push_back(index - 1);
+    }
+}
+
+MeshcopProxy::~MeshcopProxy(void)
+{
+    Stop();
+}
+
+otbrError MeshcopProxy::Start(void)
+{
+    otbrError    error  = OTBR_ERROR_NONE;
+    int          v6only = 0;
+    sockaddr_in6 address;
+
+    VerifyOrExit(!IsStarted());
+
+    mListenFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mListenFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    // Commissioners on IPv4 are served as IPv4-mapped addresses.
+    VerifyOrExit(setsockopt(mListenFd, IPPROTO_IPV6, IPV6_V6ONLY, &v6only, sizeof(v6only)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    address.sin6_port   = htons(OTBR_MESHCOP_PROXY_PORT);
+    address.sin6_addr   = in6addr_any;
+    VerifyOrExit(bind(mListenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = EventPoller::Get().Register(mListenFd, EventPoller::kEventReadable, HandleListenEvent, this,
+                                                       EventPoller::kPriorityHigh));
+
+    if (mBatch == nullptr)
+    {
+        mBatch = std::unique_ptr<Batch>(new Batch());
+    }
+
+    mExpireTimer.Start(std::chrono::seconds(OTBR_MESHCOP_PROXY_SESSION_TIMEOUT) / 2);
+
+exit:
+    if (error != OTBR_ERROR_NONE && mListenFd >= 0)
+    {
+        close(mListenFd);
+        mListenFd = -1;
+    }
+
+    otbrLogResult(error, "Start MeshCoP proxy on port %u", OTBR_MESHCOP_PROXY_PORT);
+    return error;
+}
+
+void MeshcopProxy::Stop(void)
+{
+    VerifyOrExit(IsStarted());
+
+    for (Session &session : mSessions)
+    {
+        if (session.mFd >= 0)
+        {
+            CloseSession(session);
+        }
+    }
+
+    EventPoller::Get().Unregister(mListenFd);
+    close(mListenFd);
+    mListenFd = -1;
+    mExpireTimer.Stop();
+
+    otbrLog(OTBR_LOG_INFO, "Stop MeshCoP proxy");
+
+exit:
+    return;
+}
+
+size_t MeshcopProxy::Hash(const sockaddr_in6 &aPeer)
+{
+    Ip6Address address(aPeer.sin6_addr.s6_addr);
+
+    // Commissioners connecting from one host only differ in their ports.
+    return Ip6AddressHash()(address) ^ (static_cast<size_t>(aPeer.sin6_port) * 0x9e3779b1u);
+}
+
+bool MeshcopProxy::IsSameHost(const sockaddr_in6 &aFirst, const sockaddr_in6 &aSecond)
+{
+    return aFirst.sin6_scope_id == aSecond.sin6_scope_id &&
+           memcmp(&aFirst.sin6_addr, &aSecond.sin6_addr, sizeof(aFirst.sin6_addr)) == 0;
+}
+
+bool MeshcopProxy::IsSamePeer(const sockaddr_in6 &aFirst, const sockaddr_in6 &aSecond)
+{
+    return aFirst.sin6_port == aSecond.sin6_port && IsSameHost(aFirst, aSecond);
+}
+
+MeshcopProxy::Session *MeshcopProxy::FindSession(const sockaddr_in6 &aPeer)
+{
+    size_t   mask    = mSlots.size() - 1;
+    Session *session = nullptr;
+
+    for (size_t slot = Hash(aPeer) & mask; mSlots[slot] != kNoSession; slot = (slot + 1) & mask)
+    {
+        if (IsSamePeer(mSessions[mSlots[slot]].mPeer, aPeer))
+        {
+            ExitNow(session = &mSessions[mSlots[slot]]);
+        }
+    }
+
+exit:
+    return session;
+}
+
+MeshcopProxy::Session *MeshcopProxy::OpenSession(const sockaddr_in6 &aPeer)
+{
+    size_t                   mask         = mSlots.size() - 1;
+    Session *                session      = nullptr;
+    Session *                oldest       = nullptr;
+    uint16_t                 hostSessions = 0;
+    int                      fd           = -1;
+    Timer::Clock::time_point now          = Timer::Clock::now();
+    uint16_t                 index;
+    size_t                   slot;
+    sockaddr_in6             upstream;
+
+    // New commissioners are rare, so the sessions are scanned rather than indexed by host and by activity.
+    for (Session &other : mSessions)
+    {
+        if (other.mFd < 0)
+        {
+            continue;
+        }
+
+        if (IsSameHost(other.mPeer, aPeer))
+        {
+            hostSessions++;
+        }
+
+        if (oldest == nullptr || other.mLastActive < oldest->mLastActive)
+        {
+            oldest = &other;
+        }
+    }
+
+    VerifyOrExit(hostSessions < kMaxHostSessions, errno = ENOBUFS);
+
+    if (mFreeSessions.empty())
+    {
+        VerifyOrExit(now - oldest->mLastActive >= std::chrono::seconds(OTBR_MESHCOP_PROXY_EVICT_IDLE_TIME),
+                     errno = ENOBUFS);
+        otbrLog(OTBR_LOG_INFO, "MeshCoP proxy session of port %u evicted", ntohs(oldest->mPeer.sin6_port));
+        CloseSession(*oldest);
+        MeshcopProxyCounters::Get().mSessionsEvicted++;
+    }
+
+    index = mFreeSessions.back();
+
+    fd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(fd >= 0);
+
+    memset(&upstream, 0, sizeof(upstream));
+    upstream.sin6_family = AF_INET6;
+    upstream.sin6_port   = htons(mUpstreamPort);
+    upstream.sin6_addr   = in6addr_loopback;
+    VerifyOrExit(connect(fd, reinterpret_cast<sockaddr *>(&upstream), sizeof(upstream)) == 0);
+
+    VerifyOrExit(EventPoller::Get().Register(fd, EventPoller::kEventReadable, HandleSessionEvent, &mSessions[index],
+                                             EventPoller::kPriorityHigh) == OTBR_ERROR_NONE);
+
+    mFreeSessions.pop_back();
+    session              = &mSessions[index];
+    session->mPeer       = aPeer;
+    session->mFd         = fd;
+    session->mLastActive = now;
+
+    for (slot = Hash(aPeer) & mask; mSlots[slot] != kNoSession; slot = (slot + 1) & mask)
+    {
+    }
+    mSlots[slot] = index;
+
+    MeshcopProxyCounters::Get().mSessions = mSessions.size() - mFreeSessions.size();
+    MeshcopProxyCounters::Get().mSessionsOpened++;
+
+exit:
+    if (session == nullptr)
+    {
+        // Running out of sessions is only counted, as it happens for each datagram of the rejected commissioners.
+        if (errno != ENOBUFS)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to open MeshCoP proxy session: %s", strerror(errno));
+        }
+
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    return session;
+}
+
+void MeshcopProxy::CloseSession(Session &aSession)
+{
+    size_t   mask  = mSlots.size() - 1;
+    uint16_t index = static_cast<uint16_t>(&aSession - mSessions.data());
+    size_t   slot  = Hash(aSession.mPeer) & mask;
+
+    while (mSlots[slot] != index)
+    {
+        slot = (slot + 1) & mask;
+    }
+    mSlots[slot] = kNoSession;
+
+    // Entries probed past the freed slot are shifted back, so that their lookups don't stop at it.
+    for (size_t next = (slot + 1) & mask; mSlots[next] != kNoSession; next = (next + 1) & mask)
+    {
+        size_t home = Hash(mSessions[mSlots[next]].mPeer) & mask;
+
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            mSlots[slot] = mSlots[next];
+            mSlots[next] = kNoSession;
+            slot         = next;
+        }
+    }
+
+    EventPoller::Get().Unregister(aSession.mFd);
+    close(aSession.mFd);
+    aSession.mFd = -1;
+    mFreeSessions.push_back(index);
+
+    MeshcopProxyCounters::Get().mSessions = mSessions.size() - mFreeSessions.size();
+}
+
+unsigned int MeshcopProxy::Send(int aFd, mmsghdr *aMessages, unsigned int aCount, sockaddr_in6 *aDestination)
+{
+    MeshcopProxyCounters &counters = MeshcopProxyCounters::Get();
+    unsigned int          count    = 0;
+    unsigned int          sent     = 0;
+
+    // The received datagrams are sent from their buffers, leaving out the truncated ones.
+    for (unsigned int index = 0; index < aCount; index++)
+    {
+        mmsghdr message = aMessages[index];
+
+        if (message.msg_hdr.msg_flags & MSG_TRUNC)
+        {
+            continue;
+        }
+
+        message.msg_hdr.msg_name         = aDestination;
+        message.msg_hdr.msg_namelen      = (aDestination == nullptr) ? 0 : sizeof(*aDestination);
+        message.msg_hdr.msg_iov->iov_len = message.msg_len;
+        message.msg_hdr.msg_flags        = 0;
+        aMessages[count++]               = message;
+    }
+
+    while (sent < count)
+    {
+        int rval = sendmmsg(aFd, aMessages + sent, count - sent, MSG_DONTWAIT);
+
+        counters.mSendCalls++;
+        if (rval <= 0)
+        {
+            break;
+        }
+        sent += static_cast<unsigned int>(rval);
+    }
+
+    counters.mDropped += aCount - sent;
+
+    return sent;
+}
+
+void MeshcopProxy::HandleListenEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+
+    static_cast<MeshcopProxy *>(aContext)->HandleListenEvent();
+}
+
+void MeshcopProxy::HandleListenEvent(void)
+{
+    MeshcopProxyCounters &counters = MeshcopProxyCounters::Get();
+
+    for (uint8_t round = 0; round < kMaxReceiveRounds; round++)
+    {
+        mmsghdr *    messages = mBatch->mMessages;
+        unsigned int count;
+        int          rval;
+
+        mBatch->Prepare();
+        rval = recvmmsg(mListenFd, messages, kBatchSize, MSG_DONTWAIT, nullptr);
+        if (rval <= 0)
+        {
+            break;
+        }
+
+        count = static_cast<unsigned int>(rval);
+        counters.mReceiveCalls++;
+        counters.mRxDatagrams += count;
+
+        // Consecutive datagrams of a commissioner, e.g. a DTLS flight, are forwarded with one system call.
+        for (unsigned int start = 0, end; start < count; start = end)
+        {
+            const sockaddr_in6 &peer = mBatch->mAddresses[start];
+            Session *           session;
+
+            for (end = start; end < count && IsSamePeer(mBatch->mAddresses[end], peer); end++)
+            {
+                counters.mRxBytes += messages[end].msg_len;
+            }
+
+            session = FindSession(peer);
+            if (session == nullptr)
+            {
+                session = OpenSession(peer);
+            }
+
+            if (session == nullptr)
+            {
+                counters.mSessionsRejected += end - start;
+                counters.mDropped += end - start;
+                continue;
+            }
+
+            Send(session->mFd, messages + start, end - start, nullptr);
+            session->mLastActive = Timer::Clock::now();
+        }
+
+        if (count < kBatchSize)
+        {
+            break;
+        }
+    }
+}
+
+void MeshcopProxy::HandleSessionEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    Session *session = static_cast<Session *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+
+    session->mProxy->HandleSessionEvent(*session);
+}
+
+void MeshcopProxy::HandleSessionEvent(Session &aSession)
+{
+    MeshcopProxyCounters &counters = MeshcopProxyCounters::Get();
+
+    for (uint8_t round = 0; round < kMaxReceiveRounds; round++)
+    {
+        mmsghdr *    messages = mBatch->mMessages;
+        unsigned int count;
+        unsigned int sent;
+        int          rval;
+
+        mBatch->Prepare();
+        // Errors, e.g. ECONNREFUSED while the border agent is not listening, leave the session to expire.
+        rval = recvmmsg(aSession.mFd, messages, kBatchSize, MSG_DONTWAIT, nullptr);
+        if (rval <= 0)
+        {
+            break;
+        }
+
+        count = static_cast<unsigned int>(rval);
+        counters.mReceiveCalls++;
+
+        sent = Send(mListenFd, messages, count, &aSession.mPeer);
+        counters.mTxDatagrams += sent;
+        for (unsigned int index = 0; index < sent; index++)
+        {
+            counters.mTxBytes += messages[index].msg_len;
+        }
+        aSession.mLastActive = Timer::Clock::now();
+
+        if (count < kBatchSize)
+        {
+            break;
+        }
+    }
+}
+
+void MeshcopProxy::HandleExpireTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<MeshcopProxy *>(aContext)->HandleExpireTimer();
+}
+
+void MeshcopProxy::HandleExpireTimer(void)
+{
+    Timer::Clock::time_point now = Timer::Clock::now();
+
+    for (Session &session : mSessions)
+    {
+        if (session.mFd >= 0 && now - session.mLastActive >= std::chrono::seconds(OTBR_MESHCOP_PROXY_SESSION_TIMEOUT))
+        {
+            otbrLog(OTBR_LOG_INFO, "MeshCoP proxy session of port %u expired", ntohs(session.mPeer.sin6_port));
+            CloseSession(session);
+            MeshcopProxyCounters::Get().mSessionsExpired++;
+        }
+    }
+
+    mExpireTimer.Start(std::chrono::seconds(OTBR_MESHCOP_PROXY_SESSION_TIMEOUT) / 2);
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_MESHCOP_PROXY
@@ -0,0 +1,266 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definition for the MeshCoP proxy of the Thread border agent.
+ */
+
+#ifndef OTBR_AGENT_MESHCOP_PROXY_HPP_
+#define OTBR_AGENT_MESHCOP_PROXY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "common/timer.hpp"
+#include "common/types.hpp"
+
+/**
+ * The UDP port the MeshCoP proxy listens on for external commissioners, which is published instead of the port of
+ * the OpenThread border agent.
+ *
+ */
+#ifndef OTBR_MESHCOP_PROXY_PORT
+#define OTBR_MESHCOP_PROXY_PORT 49192
+#endif
+
+/**
+ * The maximum number of concurrent commissioner sessions, datagrams of further commissioners are dropped.
+ *
+ */
+#ifndef OTBR_MESHCOP_PROXY_MAX_SESSIONS
+#define OTBR_MESHCOP_PROXY_MAX_SESSIONS 64
+#endif
+
+/**
+ * The maximum number of concurrent sessions of commissioners on one host, so that a host opening sessions from many
+ * ports doesn't take the sessions of the others.
+ *
+ */
+#ifndef OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS
+#define OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS 16
+#endif
+
+/**
+ * The time (in seconds) a session has to be idle before it is closed for a new commissioner while all sessions are in
+ * use. It is longer than the retransmission timeout of DTLS handshakes, so that ongoing handshakes are not evicted.
+ *
+ */
+#ifndef OTBR_MESHCOP_PROXY_EVICT_IDLE_TIME
+#define OTBR_MESHCOP_PROXY_EVICT_IDLE_TIME 2
+#endif
+
+/**
+ * The time (in seconds) a session without any datagram in either direction is kept. It is longer than the keep-alive
+ * interval of commissioners, so that only abandoned sessions expire.
+ *
+ */
+#ifndef OTBR_MESHCOP_PROXY_SESSION_TIMEOUT
+#define OTBR_MESHCOP_PROXY_SESSION_TIMEOUT 60
+#endif
+
+/**
+ * The maximum number of datagrams received or sent with one system call.
+ *
+ */
+#ifndef OTBR_MESHCOP_PROXY_BATCH_SIZE
+#define OTBR_MESHCOP_PROXY_BATCH_SIZE 16
+#endif
+
+namespace otbr {
+
+/**
+ * @addtogroup border-router-border-agent
+ *
+ * @{
+ */
+
+/**
+ * This class counts the sessions and datagrams relayed by the MeshCoP proxy.
+ *
+ * The counters are process-wide, so that the D-Bus and REST servers read them without a border agent.
+ *
+ */
+class MeshcopProxyCounters
+{
+public:
+    uint64_t mSessions;         ///< Number of sessions currently open.
+    uint64_t mSessionsOpened;   ///< Number of sessions opened.
+    uint64_t mSessionsExpired;  ///< Number of sessions closed after being idle.
+    uint64_t mSessionsEvicted;  ///< Number of idle sessions closed for new commissioners.
+    uint64_t mSessionsRejected; ///< Number of datagrams of new commissioners dropped for lack of a session.
+    uint64_t mRxDatagrams;      ///< Number of datagrams received from commissioners.
+    uint64_t mRxBytes;          ///< Number of bytes received from commissioners.
+    uint64_t mTxDatagrams;      ///< Number of datagrams sent to commissioners.
+    uint64_t mTxBytes;          ///< Number of bytes sent to commissioners.
+    uint64_t mDropped;          ///< Number of datagrams truncated or failed to be relayed in either direction.
+    uint64_t mReceiveCalls;     ///< Number of system calls receiving datagrams.
+    uint64_t mSendCalls;        ///< Number of system calls sending datagrams.
+
+    /**
+     * This method returns the singleton counters.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    static MeshcopProxyCounters &Get(void);
+
+private:
+    MeshcopProxyCounters(void) = default;
+};
+
+/**
+ * This class implements a MeshCoP proxy, which dispatches the DTLS datagrams of external commissioners to the
+ * OpenThread border agent.
+ *
+ * Each commissioner, identified by its address and port, has a session with its own socket connected to the border
+ * agent, so that the border agent tells the commissioners apart. Sessions are looked up in a flat hash table, and
+ * datagrams are received and sent in batches with `recvmmsg()` and `sendmmsg()`. While all sessions are in use, the
+ * least recently active session is closed for a new commissioner once it is idle for long enough.
+ *
+ */
+class MeshcopProxy
+{
+public:
+    /**
+     * The constructor to initialize the MeshCoP proxy.
+     *
+     * @param[in]   aUpstreamPort   The UDP port of the OpenThread border agent on the loopback interface.
+     *
+     */
+    explicit MeshcopProxy(uint16_t aUpstreamPort);
+
+    ~MeshcopProxy(void);
+
+    /**
+     * This method starts listening for commissioners.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully started the proxy, or it was already started.
+     * @retval  OTBR_ERROR_ERRNO    Failed to open the listening socket.
+     *
+     */
+    otbrError Start(void);
+
+    /**
+     * This method stops listening and closes all sessions.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether the proxy is listening for commissioners.
+     *
+     * @returns Whether the proxy is started.
+     *
+     */
+    bool IsStarted(void) const { return mListenFd >= 0; }
+
+    /**
+     * This method returns the UDP port the proxy listens on.
+     *
+     * @returns The UDP port.
+     *
+     */
+    uint16_t GetPort(void) const { return OTBR_MESHCOP_PROXY_PORT; }
+
+private:
+    enum : uint16_t
+    {
+        kMaxSessions      = OTBR_MESHCOP_PROXY_MAX_SESSIONS,
+        kMaxHostSessions  = OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS,
+        kBatchSize        = OTBR_MESHCOP_PROXY_BATCH_SIZE,
+        kMaxDatagramSize  = 1500,   ///< Larger datagrams are truncated and dropped.
+        kNoSession        = 0xffff, ///< An empty slot of the hash table.
+        kMaxReceiveRounds = 4,      ///< Batches received on one event, so that one socket doesn't starve others.
+    };
+
+    struct Session
+    {
+        MeshcopProxy *           mProxy;
+        sockaddr_in6             mPeer;       ///< The commissioner.
+        int                      mFd;         ///< The socket connected to the border agent, -1 if the session is free.
+        Timer::Clock::time_point mLastActive; ///< The time of the last datagram in either direction.
+    };
+
+    struct Batch
+    {
+        mmsghdr      mMessages[kBatchSize];
+        iovec        mIovecs[kBatchSize];
+        sockaddr_in6 mAddresses[kBatchSize];
+        uint8_t      mBuffers[kBatchSize][kMaxDatagramSize];
+
+        void Prepare(void);
+    };
+
+    static size_t Hash(const sockaddr_in6 &aPeer);
+    static bool   IsSameHost(const sockaddr_in6 &aFirst, const sockaddr_in6 &aSecond);
+    static bool   IsSamePeer(const sockaddr_in6 &aFirst, const sockaddr_in6 &aSecond);
+
+    Session *    FindSession(const sockaddr_in6 &aPeer);
+    Session *    OpenSession(const sockaddr_in6 &aPeer);
+    void         CloseSession(Session &aSession);
+    unsigned int Send(int aFd, mmsghdr *aMessages, unsigned int aCount, sockaddr_in6 *aDestination);
+
+    static void HandleListenEvent(void *aContext, int aFd, uint32_t aEvents);
+    void        HandleListenEvent(void);
+    static void HandleSessionEvent(void *aContext, int aFd, uint32_t aEvents);
+    void        HandleSessionEvent(Session &aSession);
+    static void HandleExpireTimer(Timer &aTimer, void *aContext);
+    void        HandleExpireTimer(void);
+
+    uint16_t mUpstreamPort;
+    int      mListenFd;
+
+    // The sessions, whose addresses are stable as they are the contexts of their sockets.
+    std::vector<Session>  mSessions;
+    std::vector<uint16_t> mFreeSessions;
+    // Open addressing with linear probing, slots are indices in `mSessions` or `kNoSession`.
+    std::vector<uint16_t> mSlots;
+
+    // Buffers of received datagrams, reused for sending them.
+    std::unique_ptr<Batch> mBatch;
+
+    Timer mExpireTimer;
+};
+
+/**
+ * @}
+ */
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MESHCOP_PROXY_HPP_
@@ -38,6 +38,9 @@
 
 #include <netinet/in.h>
 #include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/backbone_router_ftd.h>
 
 #include "common/mainloop.h"
 #include "common/types.hpp"
@@ -62,22 +65,43 @@ namespace Ncp {
  */
 enum
 {
-    kEventExtPanId,                        ///< Extended PAN ID arrived.
-    kEventNetworkName,                     ///< Network name arrived.
-    kEventPSKc,                            ///< PSKc arrived.
-    kEventThreadState,                     ///< Thread State.
-    kEventThreadVersion,                   ///< Thread Version.
-    kEventUdpForwardStream,                ///< UDP forward stream arrived.
-    kEventBackboneRouterState,             ///< Backbone Router State.
-    kEventBackboneRouterDomainPrefixEvent, ///< Backbone Router Domain Prefix event.
-    kEventBackboneRouterNdProxyEvent,      ///< Backbone Router ND Proxy event arrived.
+    kEventExtPanId,                             ///< Extended PAN ID arrived.
+    kEventNetworkName,                          ///< Network name arrived.
+    kEventPSKc,                                 ///< PSKc arrived.
+    kEventThreadState,                          ///< Thread State.
+    kEventThreadVersion,                        ///< Thread Version.
+    kEventUdpForwardStream,                     ///< UDP forward stream arrived.
+    kEventBackboneRouterState,                  ///< Backbone Router State.
+    kEventBackboneRouterDomainPrefixEvent,      ///< Backbone Router Domain Prefix event.
+    kEventBackboneRouterNdProxyEvent,           ///< Backbone Router ND Proxy event arrived.
+    kEventBackboneRouterMulticastListenerEvent, ///< Backbone Router Multicast Listener event arrived.
+    kEventPartitionId,                          ///< Thread Partition ID changed.
 };
 
+/**
+ * This type is the emitter of the NCP events, with the argument types of each event in the order of the events.
+ *
+ */
+typedef TypedEventEmitter<void(const uint8_t *aExtPanId),
+                          void(const char *aNetworkName),
+                          void(const uint8_t *aPSKc),
+                          void(bool aAttached),
+                          void(uint16_t aThreadVersion),
+                          void(void),
+                          void(void),
+                          void(otBackboneRouterDomainPrefixEvent aEvent, const otIp6Prefix *aDomainPrefix),
+                          void(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aAddress),
+                          void(otBackboneRouterMulticastListenerEvent aEvent, const otIp6Address *aAddress),
+                          void(uint32_t aPartitionId)>
+    ControllerEventEmitter;
+
+static_assert(ControllerEventEmitter::kNumEvents == kEventPartitionId + 1, "Missing argument types of NCP events");
+
 /**
  * This interface defines NCP Controller functionality.
  *
  */
-class Controller : public EventEmitter
+class Controller : public ControllerEventEmitter
 {
 public:
     /**
@@ -28,23 +28,37 @@
 
 #include "agent/ncp_openthread.hpp"
 
+#include <algorithm>
+#include <future>
+
 #include <assert.h>
+#include <poll.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include <openthread/backbone_router_ftd.h>
+#include <openthread/channel_monitor.h>
 #include <openthread/cli.h>
 #include <openthread/dataset.h>
+#include <openthread/link.h>
 #include <openthread/logging.h>
 #include <openthread/tasklet.h>
 #include <openthread/thread.h>
 #include <openthread/thread_ftd.h>
 #include <openthread/platform/logging.h>
 #include <openthread/platform/misc.h>
+#include <openthread/platform/radio.h>
 #include <openthread/platform/settings.h>
 
+#include "agent/netif_batch_counters.hpp"
+#include "agent/radio_link_counters.hpp"
 #include "common/code_utils.hpp"
+#include "common/health.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_clock.hpp"
+#include "common/timer.hpp"
+#include "common/trace.hpp"
 #include "common/types.hpp"
 
 #if OTBR_ENABLE_LEGACY
@@ -52,10 +66,8 @@
 #endif
 
 static bool sReset;
-using std::chrono::duration_cast;
-using std::chrono::microseconds;
-using std::chrono::seconds;
-using std::chrono::steady_clock;
+
+static constexpr std::chrono::milliseconds kNodeStateRefreshInterval(OTBR_NODE_STATE_REFRESH_INTERVAL);
 
 namespace otbr {
 namespace Ncp {
@@ -68,7 +80,10 @@ const otCliCommand ControllerOpenThread::sRegionCommand = {
 ControllerOpenThread::ControllerOpenThread(const char *aInterfaceName,
                                            const char *aRadioUrl,
                                            const char *aBackboneInterfaceName)
-    : mTriedAttach(false)
+    : mInstance(nullptr)
+    , mRegionInfo(&otbr::GetRegionInfo(mRegionCode))
+    , mRadioTxPower(0)
+    , mChannelMonitorSampleCount(0)
 {
     memset(&mConfig, 0, sizeof(mConfig));
 
@@ -116,6 +131,8 @@ otbrError ControllerOpenThread::Init(void)
     VerifyOrExit(otLoggingSetLevel(level) == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
 
     mInstance = otSysInit(&mConfig);
+    RadioLinkCounters::Get().SetRadioUrl(mConfig.mRadioUrl);
+    NetifBatchCounters::Get().SetInterfaceName(mConfig.mInterfaceName);
     otCliUartInit(mInstance);
 #if OTBR_ENABLE_LEGACY
     otLegacyInit();
@@ -132,25 +149,60 @@ otbrError ControllerOpenThread::Init(void)
     otBackboneRouterSetDomainPrefixCallback(mInstance, &ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent,
                                             this);
     otBackboneRouterSetNdProxyCallback(mInstance, &ControllerOpenThread::HandleBackboneRouterNdProxyEvent, this);
+    otBackboneRouterSetMulticastListenerCallback(
+        mInstance, &ControllerOpenThread::HandleBackboneRouterMulticastListenerEvent, this);
 #endif
 
-    mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
+    if (mThreadHelper == nullptr)
+    {
+        mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
+    }
+    else
+    {
+        mThreadHelper->HandleNcpReset(mInstance);
+    }
     otCliSetUserCommands(&sRegionCommand, 1, this);
 
+    // The radio starts at its own transmit power after each reset, which the region then caps.
+    if (otPlatRadioGetTransmitPower(mInstance, &mRadioTxPower) != OT_ERROR_NONE)
+    {
+        mRadioTxPower = mRegionInfo->mMaxTxPower;
+    }
+    ApplyRegionTxPower();
+
+    UpdateNodeState();
+    UpdateNetworkData();
+
 exit:
+    Health::Get().SetReady(Health::kSubsystemNcp, error == OTBR_ERROR_NONE);
     return error;
 }
 
 void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
 {
+    otbrTrace(OTBR_TRACE_STATE_CHANGED, aFlags);
+
+    // The handlers below read the new state from the snapshots.
+    UpdateNodeState();
+
+    if (aFlags & OT_CHANGED_THREAD_NETDATA)
+    {
+        UpdateNetworkData();
+    }
+
     if (aFlags & OT_CHANGED_THREAD_NETWORK_NAME)
     {
-        EventEmitter::Emit(kEventNetworkName, otThreadGetNetworkName(mInstance));
+        Emit<kEventNetworkName>(otThreadGetNetworkName(mInstance));
     }
 
     if (aFlags & OT_CHANGED_THREAD_EXT_PANID)
     {
-        EventEmitter::Emit(kEventExtPanId, otThreadGetExtendedPanId(mInstance));
+        Emit<kEventExtPanId>(otThreadGetExtendedPanId(mInstance)->m8);
+    }
+
+    if (aFlags & OT_CHANGED_THREAD_PARTITION_ID)
+    {
+        Emit<kEventPartitionId>(otThreadGetPartitionId(mInstance));
     }
 
     if (aFlags & OT_CHANGED_THREAD_ROLE)
@@ -176,89 +228,223 @@ void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
             break;
         }
 
-        EventEmitter::Emit(kEventThreadState, attached);
+        Emit<kEventThreadState>(attached);
     }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
     if (aFlags & OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE)
     {
-        EventEmitter::Emit(kEventBackboneRouterState);
+        Emit<kEventBackboneRouterState>();
     }
 #endif
 
     mThreadHelper->StateChangedCallback(aFlags);
+
+    for (auto &callback : mThreadStateChangedCallbacks)
+    {
+        callback(aFlags);
+    }
 }
 
-static struct timeval ToTimeVal(const microseconds &aTime)
+void ControllerOpenThread::UpdateNodeState(void)
 {
-    constexpr int  kUsPerSecond = 1000000;
-    struct timeval val;
+    std::shared_ptr<const NodeState> state = std::make_shared<NodeState>(mInstance, mNodeState.get());
+    uint64_t                         now   = static_cast<uint64_t>(time(nullptr));
 
-    val.tv_sec  = aTime.count() / kUsPerSecond;
-    val.tv_usec = aTime.count() % kUsPerSecond;
+    std::atomic_store(&mNodeState, state);
+    mCountersHistory.Add(now, state->mMacCounters, state->mIpCounters);
+    mLinkQualityTracker.Add(now, state->mNeighbors);
+    UpdateChannelHistory();
+}
 
-    return val;
-};
+void ControllerOpenThread::UpdateChannelHistory(void)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    uint32_t channelMask = otLinkGetSupportedChannelMask(mInstance);
+    uint32_t sampleCount = otChannelMonitorGetSampleCount(mInstance);
+    uint16_t occupancies[ChannelHistory::kNumChannels];
+
+    // The occupancies only change when the channel monitor samples the channels again.
+    VerifyOrExit(otChannelMonitorIsRunning(mInstance) && sampleCount != mChannelMonitorSampleCount);
+    mChannelMonitorSampleCount = sampleCount;
+
+    for (uint8_t i = 0; i < ChannelHistory::kNumChannels; i++)
+    {
+        uint8_t channel = ChannelHistory::kMinChannel + i;
+
+        occupancies[i] = (channelMask & (1U << channel)) ? otChannelMonitorGetChannelOccupancy(mInstance, channel) : 0;
+    }
+
+    mChannelHistory.Add(static_cast<uint64_t>(time(nullptr)), channelMask, occupancies);
+
+exit:
+    return;
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+}
+
+void ControllerOpenThread::UpdateNetworkData(void)
+{
+    std::shared_ptr<const NetworkData> networkData = GetNetworkData();
+    otLeaderData                       leaderData;
+
+    // The network data is only decoded again when its version changes, the version of a detached node is unknown.
+    VerifyOrExit(networkData == nullptr || otThreadGetLeaderData(mInstance, &leaderData) != OT_ERROR_NONE ||
+                 !networkData->IsVersionOf(leaderData));
+
+    std::atomic_store(&mNetworkData, std::shared_ptr<const NetworkData>(std::make_shared<NetworkData>(mInstance)));
+
+exit:
+    return;
+}
 
 void ControllerOpenThread::UpdateFdSet(otSysMainloopContext &aMainloop)
 {
-    microseconds timeout = microseconds(aMainloop.mTimeout.tv_usec) + seconds(aMainloop.mTimeout.tv_sec);
-    auto         now     = steady_clock::now();
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    using std::chrono::steady_clock;
 
-    if (otTaskletsArePending(mInstance))
+    constexpr int            kUsPerSecond = 1000000;
+    steady_clock::time_point refreshTime  = mNodeState->mUpdateTime + kNodeStateRefreshInterval;
+    microseconds             remaining =
+        duration_cast<microseconds>(refreshTime - MainloopClock::Now() + microseconds(1) - steady_clock::duration(1));
+
+    if (otTaskletsArePending(mInstance) || remaining.count() <= 0)
     {
-        timeout = microseconds::zero();
+        aMainloop.mTimeout.tv_sec  = 0;
+        aMainloop.mTimeout.tv_usec = 0;
     }
-    else if (!mTimers.empty())
+    else if (remaining <
+             microseconds(aMainloop.mTimeout.tv_usec + static_cast<int64_t>(aMainloop.mTimeout.tv_sec) * kUsPerSecond))
     {
-        if (mTimers.begin()->first < now)
-        {
-            timeout = microseconds::zero();
-        }
-        else
-        {
-            timeout = std::min(timeout, duration_cast<microseconds>(mTimers.begin()->first - now));
-        }
+        aMainloop.mTimeout.tv_sec  = static_cast<time_t>(remaining.count() / kUsPerSecond);
+        aMainloop.mTimeout.tv_usec = static_cast<suseconds_t>(remaining.count() % kUsPerSecond);
     }
 
-    aMainloop.mTimeout = ToTimeVal(timeout);
-
     otSysMainloopUpdate(mInstance, &aMainloop);
+
+#if OTBR_ENABLE_RADIO_THREAD
+    mCommands.UpdateFdSet(aMainloop);
+#endif
 }
 
 void ControllerOpenThread::Process(const otSysMainloopContext &aMainloop)
 {
-    auto now = steady_clock::now();
+    int  radioFd = RadioLinkCounters::Get().GetRadioFd();
+    bool radioRx = (radioFd >= 0 && FD_ISSET(radioFd, &aMainloop.mReadFdSet));
+    int  tunFd   = NetifBatchCounters::Get().GetTunFd();
+    bool tunRx   = (tunFd >= 0 && FD_ISSET(tunFd, &aMainloop.mReadFdSet));
+    auto start   = std::chrono::steady_clock::now();
 
     otTaskletsProcess(mInstance);
 
     otSysMainloopProcess(mInstance, &aMainloop);
 
-    while (!mTimers.empty() && mTimers.begin()->first <= now)
+    if (tunRx)
     {
-        mTimers.begin()->second();
-        mTimers.erase(mTimers.begin());
+        ProcessNetifBatch(tunFd);
     }
 
-    if (!mTriedAttach && mThreadHelper->TryResumeNetwork() == OT_ERROR_NONE)
+    if (radioRx)
     {
-        mTriedAttach = true;
+        Health::Get().RecordRadioActivity();
+        RadioLinkCounters::Get().AddLatency(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+
+#if OTBR_ENABLE_RADIO_THREAD
+    mCommands.Process(aMainloop);
+#endif
+
+    // The counters and the tables change without a state change.
+    if (MainloopClock::Now() - mNodeState->mUpdateTime >= kNodeStateRefreshInterval)
+    {
+        UpdateNodeState();
     }
 }
 
+void ControllerOpenThread::ProcessNetifBatch(int aTunFd)
+{
+    static_assert(OTBR_NETIF_BATCH_BUDGET > 0, "OTBR_NETIF_BATCH_BUDGET must be positive");
+
+    uint32_t packets   = 1;
+    bool     exhausted = false;
+
+    // OpenThread reads one packet each time the tun device is readable, the packets still queued are read here
+    // instead of costing one iteration of the mainloop each. The tasklets run in between so that each packet is
+    // forwarded before the next one takes a message buffer.
+    while (true)
+    {
+        struct pollfd        pollFd = {aTunFd, POLLIN, 0};
+        otSysMainloopContext mainloop;
+
+        if (poll(&pollFd, 1, 0) <= 0 || !(pollFd.revents & POLLIN))
+        {
+            break;
+        }
+
+        if (packets >= OTBR_NETIF_BATCH_BUDGET)
+        {
+            exhausted = true;
+            break;
+        }
+
+        memset(&mainloop, 0, sizeof(mainloop));
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+        FD_SET(aTunFd, &mainloop.mReadFdSet);
+        mainloop.mMaxFd = aTunFd;
+
+        otTaskletsProcess(mInstance);
+        otSysMainloopProcess(mInstance, &mainloop);
+        packets++;
+    }
+
+    NetifBatchCounters::Get().AddBatch(packets, exhausted);
+}
+
 void ControllerOpenThread::Reset(void)
 {
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+
+    steady_clock::time_point startTime = steady_clock::now();
+    steady_clock::time_point deinitTime;
+    steady_clock::time_point initTime;
+    steady_clock::time_point endTime;
+    otbrError                error;
+
     gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
 
+    // Only the OpenThread instance and the radio are reinitialized, the services and their handlers are kept.
+    Health::Get().SetReady(Health::kSubsystemNcp, false);
+    RadioLinkCounters::Get().HandleReset(mInstance);
+    NetifBatchCounters::Get().HandleReset();
     otInstanceFinalize(mInstance);
     otSysDeinit();
-    Init();
+    deinitTime = steady_clock::now();
+
+    error = Init();
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to reinitialize OpenThread after reset: %s", otbrErrorString(error));
+    }
+    initTime = steady_clock::now();
+
     for (auto &handler : mResetHandlers)
     {
         handler();
     }
-    mTriedAttach = false;
-    sReset       = false;
+    sReset  = false;
+    endTime = steady_clock::now();
+
+    otbrTrace(OTBR_TRACE_NCP_RESET, static_cast<uint32_t>(duration_cast<milliseconds>(endTime - startTime).count()));
+    otbrLog(OTBR_LOG_INFO, "NCP reset recovered in %ld ms: deinit %ld ms, init %ld ms, reset handlers %ld ms",
+            static_cast<long>(duration_cast<milliseconds>(endTime - startTime).count()),
+            static_cast<long>(duration_cast<milliseconds>(deinitTime - startTime).count()),
+            static_cast<long>(duration_cast<milliseconds>(initTime - deinitTime).count()),
+            static_cast<long>(duration_cast<milliseconds>(endTime - initTime).count()));
 }
 
 bool ControllerOpenThread::IsResetRequested(void)
@@ -274,7 +460,7 @@ otbrError ControllerOpenThread::RequestEvent(int aEvent)
     {
     case kEventExtPanId:
     {
-        EventEmitter::Emit(kEventExtPanId, otThreadGetExtendedPanId(mInstance));
+        Emit<kEventExtPanId>(otThreadGetExtendedPanId(mInstance)->m8);
         break;
     }
     case kEventThreadState:
@@ -292,22 +478,22 @@ otbrError ControllerOpenThread::RequestEvent(int aEvent)
             break;
         }
 
-        EventEmitter::Emit(kEventThreadState, attached);
+        Emit<kEventThreadState>(attached);
         break;
     }
     case kEventNetworkName:
     {
-        EventEmitter::Emit(kEventNetworkName, otThreadGetNetworkName(mInstance));
+        Emit<kEventNetworkName>(otThreadGetNetworkName(mInstance));
         break;
     }
     case kEventPSKc:
     {
-        EventEmitter::Emit(kEventPSKc, otThreadGetPskc(mInstance));
+        Emit<kEventPSKc>(otThreadGetPskc(mInstance)->m8);
         break;
     }
     case kEventThreadVersion:
     {
-        EventEmitter::Emit(kEventThreadVersion, otThreadGetVersion());
+        Emit<kEventThreadVersion>(otThreadGetVersion());
         break;
     }
     default:
@@ -321,7 +507,23 @@ otbrError ControllerOpenThread::RequestEvent(int aEvent)
 void ControllerOpenThread::PostTimerTask(std::chrono::steady_clock::time_point aTimePoint,
                                          const std::function<void(void)> &     aTask)
 {
-    mTimers.insert({aTimePoint, aTask});
+    TimerScheduler::Get().Post(aTimePoint, aTask);
+}
+
+void ControllerOpenThread::RunCommand(const std::function<void(void)> &aCommand)
+{
+#if OTBR_ENABLE_RADIO_THREAD
+    std::promise<void> done;
+    std::future<void>  future = done.get_future();
+
+    mCommands.Post([&aCommand, &done]() {
+        aCommand();
+        done.set_value();
+    });
+    future.wait();
+#else
+    aCommand();
+#endif
 }
 
 void ControllerOpenThread::RegisterResetHandler(std::function<void(void)> aHandler)
@@ -329,6 +531,40 @@ void ControllerOpenThread::RegisterResetHandler(std::function<void(void)> aHandl
     mResetHandlers.emplace_back(std::move(aHandler));
 }
 
+void ControllerOpenThread::AddThreadStateChangedCallback(std::function<void(otChangedFlags)> aCallback)
+{
+    mThreadStateChangedCallbacks.emplace_back(std::move(aCallback));
+}
+
+void ControllerOpenThread::SetRegionCode(const std::string &aCode)
+{
+    mRegionCode = aCode;
+    mRegionInfo = &otbr::GetRegionInfo(aCode);
+    ApplyRegionTxPower();
+}
+
+void ControllerOpenThread::ApplyRegionTxPower(void)
+{
+    int8_t  txPower = std::min(mRadioTxPower, mRegionInfo->mMaxTxPower);
+    otError error;
+
+    VerifyOrExit(mInstance != nullptr);
+
+    error = otPlatRadioSetTransmitPower(mInstance, txPower);
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to set the transmit power to %d dBm: %s", txPower,
+                otThreadErrorToString(error));
+    }
+    else
+    {
+        otbrLog(OTBR_LOG_INFO, "Transmit power %d dBm for region %s", txPower, mRegionCode.c_str());
+    }
+
+exit:
+    return;
+}
+
 void ControllerOpenThread::HandleRegionCommand(void *aContext, uint8_t aArgLength, char **aArgs)
 {
     ControllerOpenThread *controller = static_cast<ControllerOpenThread *>(aContext);
@@ -345,7 +581,7 @@ void ControllerOpenThread::HandleRegionCommand(uint8_t aArgLength, char **aArgs)
     {
         if (strnlen(aArgs[0], 3) == 2)
         {
-            mRegionCode = aArgs[0];
+            SetRegionCode(aArgs[0]);
             otCliOutputFormat("Done\n");
         }
         else
@@ -370,7 +606,7 @@ void ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent(void *
 void ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
                                                                  const otIp6Prefix *               aDomainPrefix)
 {
-    EventEmitter::Emit(kEventBackboneRouterDomainPrefixEvent, aEvent, aDomainPrefix);
+    Emit<kEventBackboneRouterDomainPrefixEvent>(aEvent, aDomainPrefix);
 }
 
 void ControllerOpenThread::HandleBackboneRouterNdProxyEvent(void *                       aContext,
@@ -383,7 +619,20 @@ void ControllerOpenThread::HandleBackboneRouterNdProxyEvent(void *
 void ControllerOpenThread::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent,
                                                             const otIp6Address *         aAddress)
 {
-    EventEmitter::Emit(kEventBackboneRouterNdProxyEvent, aEvent, aAddress);
+    Emit<kEventBackboneRouterNdProxyEvent>(aEvent, aAddress);
+}
+
+void ControllerOpenThread::HandleBackboneRouterMulticastListenerEvent(void *                                 aContext,
+                                                                      otBackboneRouterMulticastListenerEvent aEvent,
+                                                                      const otIp6Address *                   aAddress)
+{
+    static_cast<ControllerOpenThread *>(aContext)->HandleBackboneRouterMulticastListenerEvent(aEvent, aAddress);
+}
+
+void ControllerOpenThread::HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                                      const otIp6Address *                   aAddress)
+{
+    Emit<kEventBackboneRouterMulticastListenerEvent>(aEvent, aAddress);
 }
 #endif
 
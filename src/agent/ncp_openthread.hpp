@@ -35,6 +35,7 @@
 #define OTBR_AGENT_NCP_OPENTHREAD_HPP_
 
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include <openthread/backbone_router_ftd.h>
@@ -43,8 +44,24 @@
 #include <openthread/openthread-system.h>
 
 #include "ncp.hpp"
+#include "agent/channel_history.hpp"
+#include "agent/counters_history.hpp"
+#include "agent/link_quality.hpp"
+#include "agent/network_data.hpp"
+#include "agent/node_state.hpp"
 #include "agent/thread_helper.hpp"
 #include "common/region_code.hpp"
+#if OTBR_ENABLE_RADIO_THREAD
+#include "common/task_queue.hpp"
+#endif
+
+/**
+ * The maximum number of packets read from the Thread network interface in one wakeup of the mainloop.
+ *
+ */
+#ifndef OTBR_NETIF_BATCH_BUDGET
+#define OTBR_NETIF_BATCH_BUDGET 32
+#endif
 
 namespace otbr {
 namespace Ncp {
@@ -90,13 +107,70 @@ public:
      */
     otbr::agent::ThreadHelper *GetThreadHelper(void) { return mThreadHelper.get(); }
 
+    /**
+     * This method returns the latest snapshot of the node state.
+     *
+     * The snapshot is taken on each Thread state change and every `OTBR_NODE_STATE_REFRESH_INTERVAL`. This method can
+     * be called from any thread, the snapshot is immutable and stays valid as long as it is referenced.
+     *
+     * @returns A pointer to the snapshot, nullptr before the controller is initialized.
+     *
+     */
+    std::shared_ptr<const NodeState> GetNodeState(void) const { return std::atomic_load(&mNodeState); }
+
+    /**
+     * This method returns the latest snapshot of the network data.
+     *
+     * The snapshot is taken on each network data version change. This method can be called from any thread, the
+     * snapshot is immutable and stays valid as long as it is referenced.
+     *
+     * @returns A pointer to the snapshot, nullptr before the controller is initialized.
+     *
+     */
+    std::shared_ptr<const NetworkData> GetNetworkData(void) const { return std::atomic_load(&mNetworkData); }
+
+    /**
+     * This method returns the history of the MAC and IPv6 counters.
+     *
+     * A sample is added with each snapshot of the node state. The history can be queried from any thread.
+     *
+     * @returns A reference to the history.
+     *
+     */
+    const CountersHistory &GetCountersHistory(void) const { return mCountersHistory; }
+
+    /**
+     * This method returns the history of the channel occupancy.
+     *
+     * A sample is added with each snapshot of the node state taken after the channel monitor sampled the channels
+     * again. The history can be queried from any thread.
+     *
+     * @returns A reference to the history.
+     *
+     */
+    const ChannelHistory &GetChannelHistory(void) const { return mChannelHistory; }
+
+    /**
+     * This method returns the link quality statistics of the neighbors.
+     *
+     * The neighbor table of the snapshots of the node state is sampled every `OTBR_LINK_QUALITY_SAMPLE_INTERVAL`. The
+     * statistics can be read from any thread.
+     *
+     * @returns A reference to the tracker.
+     *
+     */
+    const LinkQualityTracker &GetLinkQualityTracker(void) const { return mLinkQualityTracker; }
+
     /**
      * This method sets the region code.
      *
+     * The transmit power of the radio is capped to the maximum transmit power of the region, now if the controller is
+     * initialized or else when it is.
+     *
      * @param[in]   aCode   The region code.
      *
      */
-    void SetRegionCode(const std::string &aCode) { mRegionCode = aCode; }
+    void SetRegionCode(const std::string &aCode);
 
     /**
      * This method gets the region code.
@@ -104,7 +178,15 @@ public:
      * @retval  The region code.
      *
      */
-    std::string GetRegionCode(void) { return mRegionCode; }
+    const std::string &GetRegionCode(void) const { return mRegionCode; }
+
+    /**
+     * This method gets the regulatory constraints of the region, resolved once when the region code is set.
+     *
+     * @returns The regulatory constraints of the region.
+     *
+     */
+    const RegionInfo &GetRegionInfo(void) const { return *mRegionInfo; }
 
     /**
      * This method updates the fd_set to poll.
@@ -149,7 +231,7 @@ public:
     otbrError RequestEvent(int aEvent) override;
 
     /**
-     * This method posts a task to the timer
+     * This method posts a task to the timer scheduler.
      *
      * @param[in]   aTimePoint  The timepoint to trigger the task.
      * @param[in]   aTask       The task function.
@@ -165,6 +247,26 @@ public:
      */
     void RegisterResetHandler(std::function<void(void)> aHandler);
 
+    /**
+     * This method adds a handler to be called with the flags of each Thread state change.
+     *
+     * @param[in]   aCallback  The handler function.
+     *
+     */
+    void AddThreadStateChangedCallback(std::function<void(otChangedFlags)> aCallback);
+
+    /**
+     * This method runs a command accessing OpenThread on behalf of another thread, e.g. the thread of the REST server.
+     *
+     * With `OTBR_ENABLE_RADIO_THREAD`, the command is handed over to the mainloop, which runs it after the radio is
+     * processed, and the caller waits until it is done. It must not be called from the mainloop then. Otherwise the
+     * command runs at once.
+     *
+     * @param[in]   aCommand    The command.
+     *
+     */
+    void RunCommand(const std::function<void(void)> &aCommand);
+
     ~ControllerOpenThread(void) override;
 
 private:
@@ -173,6 +275,10 @@ private:
         static_cast<ControllerOpenThread *>(aContext)->HandleStateChanged(aFlags);
     }
     void HandleStateChanged(otChangedFlags aFlags);
+    void UpdateNodeState(void);
+    void UpdateNetworkData(void);
+    void UpdateChannelHistory(void);
+    void ProcessNetifBatch(int aTunFd);
 
     static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
@@ -193,15 +299,26 @@ private:
 
     static void HandleRegionCommand(void *aContext, uint8_t aArgLength, char **aArgs);
     void        HandleRegionCommand(uint8_t aArgLength, char **aArgs);
+    void        ApplyRegionTxPower(void);
 
     otInstance *mInstance;
 
-    otPlatformConfig                                                                mConfig;
-    std::unique_ptr<otbr::agent::ThreadHelper>                                      mThreadHelper;
-    std::multimap<std::chrono::steady_clock::time_point, std::function<void(void)>> mTimers;
-    bool                                                                            mTriedAttach;
-    std::vector<std::function<void(void)>>                                          mResetHandlers;
-    std::string                                                                     mRegionCode;
+    otPlatformConfig                                 mConfig;
+    std::unique_ptr<otbr::agent::ThreadHelper>       mThreadHelper;
+    std::vector<std::function<void(void)>>           mResetHandlers;
+    std::vector<std::function<void(otChangedFlags)>> mThreadStateChangedCallbacks;
+    std::string                                      mRegionCode;
+    const RegionInfo *                               mRegionInfo;
+    int8_t                                           mRadioTxPower; // The transmit power of the radio before capping.
+    std::shared_ptr<const NodeState>                 mNodeState;
+    std::shared_ptr<const NetworkData>               mNetworkData;
+    CountersHistory                                  mCountersHistory;
+    ChannelHistory                                   mChannelHistory;
+    uint32_t                                         mChannelMonitorSampleCount;
+    LinkQualityTracker                               mLinkQualityTracker;
+#if OTBR_ENABLE_RADIO_THREAD
+    TaskQueue mCommands;
+#endif
 
     static const otCliCommand sRegionCommand;
 };
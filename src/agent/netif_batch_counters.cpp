@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   The file implements the batched packet processing counters of the Thread network interface.
+ */
+
+#include "agent/netif_batch_counters.hpp"
+
+#include <dirent.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include <sys/ioctl.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+const uint64_t NetifBatchCounters::kBatchBucketBounds[kNumBatchBuckets] = {1, 2, 4, 8, 16, 32, 64};
+
+NetifBatchCounters::NetifBatchCounters(void)
+    : mPackets("otbr_netif_rx_packets_total", "Packets read from the Thread network interface.")
+    , mBudgetExhausted("otbr_netif_rx_budget_exhausted_total",
+                       "Wakeups leaving packets of the Thread network interface to the next one.")
+    , mBatches("otbr_netif_rx_packets_per_wakeup",
+               "Packets read from the Thread network interface in each wakeup it is readable.",
+               kBatchBucketBounds,
+               kNumBatchBuckets)
+    , mTunFd(-1)
+{
+}
+
+NetifBatchCounters &NetifBatchCounters::Get(void)
+{
+    static NetifBatchCounters sCounters;
+
+    return sCounters;
+}
+
+void NetifBatchCounters::SetInterfaceName(const char *aInterfaceName)
+{
+    DIR *          dir = nullptr;
+    struct dirent *entry;
+
+    mTunFd = -1;
+
+    VerifyOrExit(aInterfaceName != nullptr);
+
+    // The tun device is opened by OpenThread, find its file descriptor among those of the process.
+    VerifyOrExit((dir = opendir("/proc/self/fd")) != nullptr);
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        char         link[sizeof("/proc/self/fd/") + sizeof(entry->d_name)];
+        char         target[PATH_MAX];
+        ssize_t      length;
+        struct ifreq ifr;
+
+        snprintf(link, sizeof(link), "/proc/self/fd/%s", entry->d_name);
+        length = readlink(link, target, sizeof(target) - 1);
+
+        if (length <= 0)
+        {
+            continue;
+        }
+
+        target[length] = '\0';
+        memset(&ifr, 0, sizeof(ifr));
+
+        // Several tun devices may be opened, the one of the Thread network interface is found by its name.
+        if (strcmp(target, "/dev/net/tun") == 0 && ioctl(atoi(entry->d_name), TUNGETIFF, &ifr) == 0 &&
+            strncmp(ifr.ifr_name, aInterfaceName, sizeof(ifr.ifr_name)) == 0)
+        {
+            mTunFd = atoi(entry->d_name);
+            break;
+        }
+    }
+
+exit:
+    if (dir != nullptr)
+    {
+        closedir(dir);
+    }
+
+    if (mTunFd < 0)
+    {
+        otbrLog(OTBR_LOG_INFO, "Tun device of %s is not found, its packets are not batched",
+                aInterfaceName != nullptr ? aInterfaceName : "");
+    }
+}
+
+void NetifBatchCounters::AddBatch(uint32_t aPackets, bool aExhausted)
+{
+    mBatches.Add(aPackets);
+    mPackets += aPackets;
+
+    if (aExhausted)
+    {
+        mBudgetExhausted++;
+    }
+}
+
+} // namespace Ncp
+} // namespace otbr
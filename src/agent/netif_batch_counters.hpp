@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definition for the batched packet processing of the Thread network interface.
+ */
+
+#ifndef OTBR_AGENT_NETIF_BATCH_COUNTERS_HPP_
+#define OTBR_AGENT_NETIF_BATCH_COUNTERS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/metrics_registry.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class counts the packets read from the Thread network interface per wakeup of the mainloop.
+ *
+ * The tun device of the Thread network interface is opened by OpenThread, which reads one packet each time it is
+ * readable. The controller reads the packets still queued in the same wakeup, up to a budget, and records the size of
+ * each batch here. The counters are process-wide, accumulated across resets and registered to the metrics registry.
+ *
+ */
+class NetifBatchCounters
+{
+public:
+    static const size_t kNumBatchBuckets = 7;
+
+    static const uint64_t kBatchBucketBounds[kNumBatchBuckets]; ///< Upper bounds (in packets) of buckets.
+
+    MetricsRegistry::Counter   mPackets;         ///< Number of packets read from the Thread network interface.
+    MetricsRegistry::Counter   mBudgetExhausted; ///< Number of batches stopped by the budget with packets left.
+    MetricsRegistry::Histogram mBatches;         ///< Packets of each wakeup with the interface readable.
+
+    /**
+     * This method returns the singleton counters.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    static NetifBatchCounters &Get(void);
+
+    /**
+     * This method finds the tun device of the Thread network interface opened by OpenThread.
+     *
+     * @param[in]   aInterfaceName  The name of the Thread network interface.
+     *
+     */
+    void SetInterfaceName(const char *aInterfaceName);
+
+    /**
+     * This method returns the file descriptor of the tun device.
+     *
+     * @returns The file descriptor, or -1 if the tun device is not found.
+     *
+     */
+    int GetTunFd(void) const { return mTunFd; }
+
+    /**
+     * This method records a batch of packets read in one wakeup.
+     *
+     * @param[in]   aPackets    The number of packets read.
+     * @param[in]   aExhausted  Whether packets were left when the budget was reached.
+     *
+     */
+    void AddBatch(uint32_t aPackets, bool aExhausted);
+
+    /**
+     * This method forgets the tun device before the OpenThread instance is reset.
+     *
+     */
+    void HandleReset(void) { mTunFd = -1; }
+
+private:
+    NetifBatchCounters(void);
+
+    int mTunFd;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_NETIF_BATCH_COUNTERS_HPP_
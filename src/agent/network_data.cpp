@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the snapshot of the Thread network data.
+ */
+
+#include "agent/network_data.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+namespace Ncp {
+
+// The maximum size of the network data TLVs.
+static constexpr uint8_t kNetworkDataMaxSize = 255;
+
+static std::vector<uint8_t> GetNetworkDataTlvs(otInstance *aInstance, bool aStable)
+{
+    uint8_t data[kNetworkDataMaxSize];
+    uint8_t length = sizeof(data);
+
+    if (otNetDataGet(aInstance, aStable, data, &length) != OT_ERROR_NONE)
+    {
+        length = 0;
+    }
+
+    return std::vector<uint8_t>(data, data + length);
+}
+
+NetworkData::NetworkData(otInstance *aInstance)
+    : mPartitionId(0)
+    , mVersion(0)
+    , mStableVersion(0)
+    , mVersionValid(false)
+    , mData(GetNetworkDataTlvs(aInstance, /* aStable */ false))
+    , mStableData(GetNetworkDataTlvs(aInstance, /* aStable */ true))
+{
+    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    otBorderRouterConfig  prefixConfig;
+    otExternalRouteConfig routeConfig;
+    otServiceConfig       serviceConfig;
+    otLeaderData          leaderData;
+    Ip6Prefix             prefix;
+
+    if (otThreadGetLeaderData(aInstance, &leaderData) == OT_ERROR_NONE)
+    {
+        mPartitionId   = leaderData.mPartitionId;
+        mVersion       = leaderData.mDataVersion;
+        mStableVersion = leaderData.mStableDataVersion;
+        mVersionValid  = true;
+    }
+
+    // Each Border Router of a prefix has its own entry.
+    while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &prefixConfig) == OT_ERROR_NONE)
+    {
+        prefix.Set(prefixConfig.mPrefix);
+        mOnMeshPrefixes[prefix].push_back(prefixConfig);
+        mBorderRouters.push_back(prefixConfig.mRloc16);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    while (otNetDataGetNextRoute(aInstance, &iterator, &routeConfig) == OT_ERROR_NONE)
+    {
+        prefix.Set(routeConfig.mPrefix);
+        mExternalRoutes[prefix].push_back(routeConfig);
+        mBorderRouters.push_back(routeConfig.mRloc16);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    while (otNetDataGetNextService(aInstance, &iterator, &serviceConfig) == OT_ERROR_NONE)
+    {
+        mServices.push_back(serviceConfig);
+    }
+
+    std::sort(mBorderRouters.begin(), mBorderRouters.end());
+    mBorderRouters.erase(std::unique(mBorderRouters.begin(), mBorderRouters.end()), mBorderRouters.end());
+}
+
+bool NetworkData::IsVersionOf(const otLeaderData &aLeaderData) const
+{
+    return mVersionValid && mPartitionId == aLeaderData.mPartitionId && mVersion == aLeaderData.mDataVersion &&
+           mStableVersion == aLeaderData.mStableDataVersion;
+}
+
+} // namespace Ncp
+} // namespace otbr
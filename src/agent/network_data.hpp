@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the snapshot of the Thread network data.
+ */
+
+#ifndef OTBR_AGENT_NETWORK_DATA_HPP_
+#define OTBR_AGENT_NETWORK_DATA_HPP_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <openthread/instance.h>
+#include <openthread/netdata.h>
+#include <openthread/thread.h>
+
+#include "common/prefix_trie.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents an immutable snapshot of the Thread network data, decoded into its on-mesh prefixes and
+ * external routes indexed by prefix, its services and its Border Routers.
+ *
+ * The snapshot is taken when the network data version in the leader data changes and is shared like `NodeState`, so
+ * that readers neither copy nor decode the network data through OpenThread.
+ *
+ */
+struct NetworkData
+{
+    /**
+     * The constructor takes a snapshot of the network data.
+     *
+     * It must be called on the mainloop thread, as it calls OpenThread.
+     *
+     * @param[in]   aInstance  A pointer to the OpenThread instance.
+     *
+     */
+    explicit NetworkData(otInstance *aInstance);
+
+    /**
+     * This method returns if the snapshot is of the network data of the given leader data, i.e. the network data has
+     * not changed since the snapshot was taken.
+     *
+     * @param[in]   aLeaderData  The current leader data.
+     *
+     * @returns Whether the partition and the versions of @p aLeaderData are the ones of the snapshot.
+     *
+     */
+    bool IsVersionOf(const otLeaderData &aLeaderData) const;
+
+    uint32_t             mPartitionId;   ///< The partition ID, valid if `mVersionValid`.
+    uint8_t              mVersion;       ///< The full network data version, valid if `mVersionValid`.
+    uint8_t              mStableVersion; ///< The stable network data version, valid if `mVersionValid`.
+    bool                 mVersionValid;  ///< Whether the node was attached with leader data.
+    std::vector<uint8_t> mData;          ///< The full network data TLVs.
+    std::vector<uint8_t> mStableData;    ///< The stable network data TLVs.
+
+    PrefixTrie<std::vector<otBorderRouterConfig>>  mOnMeshPrefixes; ///< The on-mesh prefixes, by prefix.
+    PrefixTrie<std::vector<otExternalRouteConfig>> mExternalRoutes; ///< The external routes, by prefix.
+    std::vector<otServiceConfig>                   mServices;       ///< The services, one entry for each server.
+    std::vector<uint16_t>                          mBorderRouters;  ///< The sorted RLOC16s of the Border Routers.
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_NETWORK_DATA_HPP_
@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the snapshot of the Thread node state.
+ */
+
+#include "agent/node_state.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace otbr {
+namespace Ncp {
+
+static uint64_t GetPageKey(const otExtAddress &aExtAddress)
+{
+    uint64_t key = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        key = (key << 8) | byte;
+    }
+
+    return key;
+}
+
+template <typename EntryType>
+static uint64_t GetTablePage(const std::vector<EntryType> &aTable,
+                             uint64_t                      aCursor,
+                             size_t                        aLimit,
+                             std::vector<size_t> &         aIndices)
+{
+    uint64_t next = 0;
+
+    aIndices.clear();
+
+    for (size_t index = 0; index < aTable.size(); index++)
+    {
+        if (GetPageKey(aTable[index].mExtAddress) >= aCursor)
+        {
+            aIndices.push_back(index);
+        }
+    }
+
+    std::sort(aIndices.begin(), aIndices.end(), [&aTable](size_t aLeft, size_t aRight) {
+        return GetPageKey(aTable[aLeft].mExtAddress) < GetPageKey(aTable[aRight].mExtAddress);
+    });
+
+    if (aIndices.size() > aLimit)
+    {
+        next = GetPageKey(aTable[aIndices[aLimit]].mExtAddress);
+        aIndices.resize(aLimit);
+    }
+
+    return next;
+}
+
+NodeState::NodeState(otInstance *aInstance, const NodeState *aPrevious)
+    : mUpdateTime(std::chrono::steady_clock::now())
+    , mRole(otThreadGetDeviceRole(aInstance))
+    , mRloc16(otThreadGetRloc16(aInstance))
+    , mRloc(*otThreadGetRloc(aInstance))
+    , mExtAddress(*otLinkGetExtendedAddress(aInstance))
+    , mExtPanId(*otThreadGetExtendedPanId(aInstance))
+    , mNetworkName(otThreadGetNetworkName(aInstance))
+    , mPartitionId(otThreadGetPartitionId(aInstance))
+    , mMacCounters(*otLinkGetCounters(aInstance))
+    , mIpCounters(*otThreadGetIp6Counters(aInstance))
+{
+    uint8_t                maxRouterId = otThreadGetMaxRouterId(aInstance);
+    uint16_t               maxChildren = otThreadGetMaxAllowedChildren(aInstance);
+    otNeighborInfoIterator iterator    = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otRouterInfo           routerInfo;
+    otChildInfo            childInfo;
+    otNeighborInfo         neighborInfo;
+
+    mLeaderDataValid = (otThreadGetLeaderData(aInstance, &mLeaderData) == OT_ERROR_NONE);
+    if (!mLeaderDataValid)
+    {
+        memset(&mLeaderData, 0, sizeof(mLeaderData));
+    }
+
+    for (uint8_t routerId = 0; routerId <= maxRouterId; routerId++)
+    {
+        if (otThreadGetRouterInfo(aInstance, routerId, &routerInfo) == OT_ERROR_NONE)
+        {
+            mRouters.push_back(routerInfo);
+        }
+    }
+
+    // The child table may have unused entries between valid ones.
+    for (uint16_t childIndex = 0; childIndex < maxChildren; childIndex++)
+    {
+        if (otThreadGetChildInfoByIndex(aInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+        {
+            mChildren.push_back(childInfo);
+        }
+    }
+
+    while (otThreadGetNextNeighborInfo(aInstance, &iterator, &neighborInfo) == OT_ERROR_NONE)
+    {
+        mNeighbors.push_back(neighborInfo);
+    }
+
+    mChildVersions.Update(mChildren, aPrevious != nullptr ? &aPrevious->mChildren : nullptr,
+                          aPrevious != nullptr ? &aPrevious->mChildVersions : nullptr);
+    mNeighborVersions.Update(mNeighbors, aPrevious != nullptr ? &aPrevious->mNeighbors : nullptr,
+                             aPrevious != nullptr ? &aPrevious->mNeighborVersions : nullptr);
+}
+
+uint64_t NodeState::GetChildPage(uint64_t aCursor, size_t aLimit, std::vector<size_t> &aIndices) const
+{
+    return GetTablePage(mChildren, aCursor, aLimit, aIndices);
+}
+
+uint64_t NodeState::GetNeighborPage(uint64_t aCursor, size_t aLimit, std::vector<size_t> &aIndices) const
+{
+    return GetTablePage(mNeighbors, aCursor, aLimit, aIndices);
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the snapshot of the Thread node state.
+ */
+
+#ifndef OTBR_AGENT_NODE_STATE_HPP_
+#define OTBR_AGENT_NODE_STATE_HPP_
+
+#include <stdint.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <openthread/instance.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "agent/table_versions.hpp"
+
+/**
+ * The interval (in milliseconds) of refreshing the node state snapshot between state changes, which keeps the
+ * counters and the tables up to date.
+ *
+ */
+#ifndef OTBR_NODE_STATE_REFRESH_INTERVAL
+#define OTBR_NODE_STATE_REFRESH_INTERVAL 1000
+#endif
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents an immutable snapshot of the Thread node state.
+ *
+ * The management servers read the snapshot instead of calling OpenThread for each request. It is shared through a
+ * `std::shared_ptr<const NodeState>`, so that a reader on any thread keeps a consistent state as long as it holds it.
+ *
+ */
+struct NodeState
+{
+    /**
+     * The constructor takes a snapshot of the node state.
+     *
+     * It must be called on the mainloop thread, as it calls OpenThread.
+     *
+     * @param[in]   aInstance  A pointer to the OpenThread instance.
+     * @param[in]   aPrevious  A pointer to the previous snapshot the versions of the tables are derived from, nullptr
+     *                         for the first snapshot.
+     *
+     */
+    NodeState(otInstance *aInstance, const NodeState *aPrevious);
+
+    /**
+     * This method selects a page of the child table, in the order of the extended addresses of the children.
+     *
+     * Pages are keyed by the extended addresses rather than by the indices of the table, so that no entry is skipped
+     * or repeated when the table changes between the pages.
+     *
+     * @param[in]   aCursor     The extended address, in big-endian as an integer, of the first entry of the page, 0
+     *                          for the first page.
+     * @param[in]   aLimit      The maximum number of entries of the page.
+     * @param[out]  aIndices    The indices in the child table of the entries of the page, in order.
+     *
+     * @returns The cursor of the next page, 0 if there are no more entries after the page.
+     *
+     */
+    uint64_t GetChildPage(uint64_t aCursor, size_t aLimit, std::vector<size_t> &aIndices) const;
+
+    /**
+     * This method selects a page of the neighbor table, in the order of the extended addresses of the neighbors.
+     *
+     * @param[in]   aCursor     The extended address, in big-endian as an integer, of the first entry of the page, 0
+     *                          for the first page.
+     * @param[in]   aLimit      The maximum number of entries of the page.
+     * @param[out]  aIndices    The indices in the neighbor table of the entries of the page, in order.
+     *
+     * @returns The cursor of the next page, 0 if there are no more entries after the page.
+     *
+     */
+    uint64_t GetNeighborPage(uint64_t aCursor, size_t aLimit, std::vector<size_t> &aIndices) const;
+
+    std::chrono::steady_clock::time_point mUpdateTime;       ///< The time the snapshot was taken.
+    otDeviceRole                          mRole;             ///< The device role.
+    uint16_t                              mRloc16;           ///< The RLOC16.
+    otIp6Address                          mRloc;             ///< The RLOC address.
+    otExtAddress                          mExtAddress;       ///< The extended address.
+    otExtendedPanId                       mExtPanId;         ///< The extended PAN ID.
+    std::string                           mNetworkName;      ///< The network name.
+    uint32_t                              mPartitionId;      ///< The partition ID.
+    otLeaderData                          mLeaderData;       ///< The leader data, valid if `mLeaderDataValid`.
+    bool                                  mLeaderDataValid;  ///< Whether the node is attached with leader data.
+    otMacCounters                         mMacCounters;      ///< The MAC counters.
+    otIpCounters                          mIpCounters;       ///< The IPv6 counters.
+    std::vector<otRouterInfo>             mRouters;          ///< The allocated routers.
+    std::vector<otChildInfo>              mChildren;         ///< The valid entries of the child table.
+    std::vector<otNeighborInfo>           mNeighbors;        ///< The neighbor table.
+    TableVersions                         mChildVersions;    ///< The versions of the child table.
+    TableVersions                         mNeighborVersions; ///< The versions of the neighbor table.
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_NODE_STATE_HPP_
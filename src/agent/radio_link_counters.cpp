@@ -0,0 +1,178 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the counters of the link to the Radio Co-Processor.
+ */
+
+#include "agent/radio_link_counters.hpp"
+
+#include <dirent.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+
+#include <string>
+
+#include <openthread/link.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+const uint64_t RadioLinkCounters::kLatencyBucketBounds[kNumLatencyBuckets] = {100,  250,   500,   1000,  2500,
+                                                                              5000, 10000, 25000, 50000, 100000};
+
+RadioLinkCounters::RadioLinkCounters(void)
+    : mLink()
+    , mResets(0)
+    , mRxLatency("otbr_radio_link_rx_latency_seconds",
+                 "Time from the radio device being readable to the received data processed.",
+                 kLatencyBucketBounds,
+                 kNumLatencyBuckets,
+                 MetricsRegistry::kUnitMicroseconds)
+    , mBase()
+    , mRadioFd(-1)
+{
+}
+
+RadioLinkCounters &RadioLinkCounters::Get(void)
+{
+    static RadioLinkCounters sCounters;
+
+    return sCounters;
+}
+
+void RadioLinkCounters::SetRadioUrl(const char *aRadioUrl)
+{
+    const char *   path = (aRadioUrl != nullptr ? strstr(aRadioUrl, "://") : nullptr);
+    char           device[PATH_MAX];
+    DIR *          dir = nullptr;
+    struct dirent *entry;
+
+    mRadioFd = -1;
+
+    VerifyOrExit(path != nullptr);
+    path += sizeof("://") - 1;
+    VerifyOrExit(realpath(std::string(path, strcspn(path, "?")).c_str(), device) != nullptr);
+
+    // The radio device is opened by OpenThread, find its file descriptor among those of the process.
+    VerifyOrExit((dir = opendir("/proc/self/fd")) != nullptr);
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        char    link[sizeof("/proc/self/fd/") + sizeof(entry->d_name)];
+        char    target[PATH_MAX];
+        ssize_t length;
+
+        snprintf(link, sizeof(link), "/proc/self/fd/%s", entry->d_name);
+        length = readlink(link, target, sizeof(target) - 1);
+
+        if (length > 0)
+        {
+            target[length] = '\0';
+
+            if (strcmp(target, device) == 0)
+            {
+                mRadioFd = atoi(entry->d_name);
+                break;
+            }
+        }
+    }
+
+exit:
+    if (dir != nullptr)
+    {
+        closedir(dir);
+    }
+
+    if (mRadioFd < 0)
+    {
+        otbrLog(OTBR_LOG_INFO, "Radio device of %s is not found, its link is not measured",
+                aRadioUrl != nullptr ? aRadioUrl : "");
+    }
+}
+
+void RadioLinkCounters::ReadLink(otInstance *aInstance, Link &aLink) const
+{
+    const otMacCounters *         counters = otLinkGetCounters(aInstance);
+    struct serial_icounter_struct deviceCounters;
+
+    memset(&aLink, 0, sizeof(aLink));
+
+    aLink.mTxFrames  = counters->mTxTotal;
+    aLink.mRxFrames  = counters->mRxTotal;
+    aLink.mTxRetries = counters->mTxRetry;
+    aLink.mTxErrors  = counters->mTxErrCca + counters->mTxErrAbort + counters->mTxErrBusyChannel;
+    aLink.mRxErrors  = counters->mRxErrNoFrame + counters->mRxErrUnknownNeighbor + counters->mRxErrInvalidSrcAddr +
+                      counters->mRxErrSec + counters->mRxErrFcs + counters->mRxErrOther;
+
+    if (mRadioFd >= 0 && ioctl(mRadioFd, TIOCGICOUNT, &deviceCounters) == 0)
+    {
+        aLink.mTxBytes      = static_cast<uint32_t>(deviceCounters.tx);
+        aLink.mRxBytes      = static_cast<uint32_t>(deviceCounters.rx);
+        aLink.mDeviceErrors = static_cast<uint32_t>(deviceCounters.frame) +
+                              static_cast<uint32_t>(deviceCounters.parity) +
+                              static_cast<uint32_t>(deviceCounters.overrun) +
+                              static_cast<uint32_t>(deviceCounters.buf_overrun);
+    }
+}
+
+void RadioLinkCounters::Update(otInstance *aInstance)
+{
+    Link link;
+
+    ReadLink(aInstance, link);
+
+    mLink.mTxFrames     = mBase.mTxFrames + link.mTxFrames;
+    mLink.mRxFrames     = mBase.mRxFrames + link.mRxFrames;
+    mLink.mTxRetries    = mBase.mTxRetries + link.mTxRetries;
+    mLink.mTxErrors     = mBase.mTxErrors + link.mTxErrors;
+    mLink.mRxErrors     = mBase.mRxErrors + link.mRxErrors;
+    mLink.mTxBytes      = mBase.mTxBytes + link.mTxBytes;
+    mLink.mRxBytes      = mBase.mRxBytes + link.mRxBytes;
+    mLink.mDeviceErrors = mBase.mDeviceErrors + link.mDeviceErrors;
+}
+
+void RadioLinkCounters::HandleReset(otInstance *aInstance)
+{
+    // The MAC counters and the radio device are reinitialized with the instance.
+    Update(aInstance);
+    mBase    = mLink;
+    mRadioFd = -1;
+    mResets++;
+}
+
+} // namespace Ncp
+} // namespace otbr
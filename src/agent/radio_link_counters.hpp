@@ -0,0 +1,144 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the counters of the link to the Radio Co-Processor.
+ */
+
+#ifndef OTBR_AGENT_RADIO_LINK_COUNTERS_HPP_
+#define OTBR_AGENT_RADIO_LINK_COUNTERS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "common/metrics_registry.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class counts the frames and bytes exchanged with the Radio Co-Processor (RCP), and the time spent processing
+ * them.
+ *
+ * Each MAC frame and each retransmission is carried by one spinel frame, so the frames are counted from the MAC
+ * counters of OpenThread. The bytes and the errors of the link are read from the serial driver of the radio device,
+ * they stay zero if the driver does not support it. The counters are process-wide and accumulated across resets, so
+ * that the D-Bus and REST servers read them without a controller.
+ *
+ */
+class RadioLinkCounters
+{
+public:
+    static const size_t kNumLatencyBuckets = 10;
+
+    static const uint64_t kLatencyBucketBounds[kNumLatencyBuckets]; ///< Upper bounds (in microseconds) of buckets.
+
+    /**
+     * This structure represents the counters of the link, as of the last update.
+     *
+     */
+    struct Link
+    {
+        uint64_t mTxFrames;     ///< Number of MAC frames transmitted, not including retransmissions.
+        uint64_t mRxFrames;     ///< Number of MAC frames received.
+        uint64_t mTxRetries;    ///< Number of MAC frames retransmitted.
+        uint64_t mTxErrors;     ///< Number of MAC frames failed to be transmitted by the RCP.
+        uint64_t mRxErrors;     ///< Number of received MAC frames dropped.
+        uint64_t mTxBytes;      ///< Number of bytes transmitted by the radio device.
+        uint64_t mRxBytes;      ///< Number of bytes received by the radio device.
+        uint64_t mDeviceErrors; ///< Number of framing, parity and overrun errors of the radio device.
+    };
+
+    Link                       mLink;      ///< The counters of the link.
+    uint64_t                   mResets;    ///< Number of RCP resets recovered.
+    MetricsRegistry::Histogram mRxLatency; ///< Latencies (in microseconds) of processing received data.
+
+    /**
+     * This method returns the singleton counters.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    static RadioLinkCounters &Get(void);
+
+    /**
+     * This method finds the radio device opened by OpenThread.
+     *
+     * @param[in]   aRadioUrl   The radio URL OpenThread is initialized with.
+     *
+     */
+    void SetRadioUrl(const char *aRadioUrl);
+
+    /**
+     * This method returns the file descriptor of the radio device.
+     *
+     * @returns The file descriptor, or -1 if the radio device is not found.
+     *
+     */
+    int GetRadioFd(void) const { return mRadioFd; }
+
+    /**
+     * This method records the time spent processing data received from the radio device.
+     *
+     * @param[in]   aLatency    The time (in microseconds) from the radio device being readable to the data processed.
+     *
+     */
+    void AddLatency(uint64_t aLatency) { mRxLatency.Add(aLatency); }
+
+    /**
+     * This method updates the counters of the link.
+     *
+     * @param[in]   aInstance   The OpenThread instance.
+     *
+     */
+    void Update(otInstance *aInstance);
+
+    /**
+     * This method keeps the counters of the link before the OpenThread instance and the radio device are reset.
+     *
+     * @param[in]   aInstance   The OpenThread instance to be finalized.
+     *
+     */
+    void HandleReset(otInstance *aInstance);
+
+private:
+    RadioLinkCounters(void);
+
+    void ReadLink(otInstance *aInstance, Link &aLink) const;
+
+    Link mBase; ///< The counters of the link of the previous instances.
+    int  mRadioFd;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_RADIO_LINK_COUNTERS_HPP_
@@ -0,0 +1,210 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the versions of the tables of the Thread node state.
+ */
+
+#include "agent/table_versions.hpp"
+
+#include <string.h>
+
+#include <unordered_map>
+
+namespace otbr {
+namespace Ncp {
+
+static uint64_t GetEntryKey(const otExtAddress &aExtAddress)
+{
+    uint64_t key;
+
+    memcpy(&key, aExtAddress.m8, sizeof(key));
+    return key;
+}
+
+// Only the identity and the topology are compared, the link metrics change with each frame heard.
+static bool IsSameEntry(const otChildInfo &aEntry, const otChildInfo &aOther)
+{
+    return aEntry.mTimeout == aOther.mTimeout && aEntry.mRloc16 == aOther.mRloc16 &&
+           aEntry.mChildId == aOther.mChildId && aEntry.mNetworkDataVersion == aOther.mNetworkDataVersion &&
+           aEntry.mRxOnWhenIdle == aOther.mRxOnWhenIdle && aEntry.mFullThreadDevice == aOther.mFullThreadDevice &&
+           aEntry.mFullNetworkData == aOther.mFullNetworkData && aEntry.mIsStateRestoring == aOther.mIsStateRestoring;
+}
+
+static bool IsSameEntry(const otNeighborInfo &aEntry, const otNeighborInfo &aOther)
+{
+    return aEntry.mRloc16 == aOther.mRloc16 && aEntry.mRxOnWhenIdle == aOther.mRxOnWhenIdle &&
+           aEntry.mFullThreadDevice == aOther.mFullThreadDevice && aEntry.mFullNetworkData == aOther.mFullNetworkData &&
+           aEntry.mIsChild == aOther.mIsChild;
+}
+
+template <typename EntryType>
+static void UpdateTableVersions(const std::vector<EntryType> &aTable,
+                                const std::vector<EntryType> *aPreviousTable,
+                                const TableVersions *         aPreviousVersions,
+                                TableVersions &               aVersions)
+{
+    std::unordered_map<uint64_t, size_t> previousIndexes;
+    std::vector<bool>                    kept;
+    uint32_t                             version;
+    bool                                 changed = false;
+
+    aVersions.mVersion       = 0;
+    aVersions.mPrunedVersion = 0;
+
+    if (aPreviousTable != nullptr)
+    {
+        aVersions.mVersion       = aPreviousVersions->mVersion;
+        aVersions.mPrunedVersion = aPreviousVersions->mPrunedVersion;
+        aVersions.mRemovals      = aPreviousVersions->mRemovals;
+
+        for (size_t index = 0; index < aPreviousTable->size(); index++)
+        {
+            previousIndexes[GetEntryKey((*aPreviousTable)[index].mExtAddress)] = index;
+        }
+        kept.resize(aPreviousTable->size(), false);
+    }
+
+    version = aVersions.mVersion + 1;
+
+    for (const EntryType &entry : aTable)
+    {
+        uint64_t key      = GetEntryKey(entry.mExtAddress);
+        auto     previous = previousIndexes.find(key);
+
+        if (previous == previousIndexes.end())
+        {
+            // An entry added again is no longer removed.
+            for (auto removal = aVersions.mRemovals.begin(); removal != aVersions.mRemovals.end(); ++removal)
+            {
+                if (GetEntryKey(removal->mExtAddress) == key)
+                {
+                    aVersions.mRemovals.erase(removal);
+                    break;
+                }
+            }
+
+            aVersions.mEntries.push_back({version, version});
+            changed = true;
+        }
+        else
+        {
+            const TableVersions::Entry &previousEntry = aPreviousVersions->mEntries[previous->second];
+
+            kept[previous->second] = true;
+
+            if (IsSameEntry(entry, (*aPreviousTable)[previous->second]))
+            {
+                aVersions.mEntries.push_back(previousEntry);
+            }
+            else
+            {
+                aVersions.mEntries.push_back({previousEntry.mAddedVersion, version});
+                changed = true;
+            }
+        }
+    }
+
+    for (size_t index = 0; index < kept.size(); index++)
+    {
+        if (!kept[index])
+        {
+            aVersions.mRemovals.push_back({(*aPreviousTable)[index].mExtAddress, version});
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        aVersions.mVersion = version;
+    }
+
+    if (aVersions.mRemovals.size() > OTBR_NODE_STATE_MAX_REMOVED_ENTRIES)
+    {
+        size_t pruned = aVersions.mRemovals.size() - OTBR_NODE_STATE_MAX_REMOVED_ENTRIES;
+
+        aVersions.mPrunedVersion = aVersions.mRemovals[pruned - 1].mVersion;
+        aVersions.mRemovals.erase(aVersions.mRemovals.begin(), aVersions.mRemovals.begin() + pruned);
+    }
+}
+
+void TableVersions::GetChanges(uint32_t aSince, const std::vector<size_t> *aPage, Changes &aChanges) const
+{
+    size_t count = (aPage != nullptr) ? aPage->size() : mEntries.size();
+
+    aChanges.mFull = (aSince == 0) || !HasChangesSince(aSince);
+    aChanges.mAdded.clear();
+    aChanges.mUpdated.clear();
+    aChanges.mRemoved.clear();
+
+    if (aChanges.mFull)
+    {
+        aSince = 0;
+    }
+
+    for (size_t position = 0; position < count; position++)
+    {
+        size_t index = (aPage != nullptr) ? (*aPage)[position] : position;
+
+        if (mEntries[index].mAddedVersion > aSince)
+        {
+            aChanges.mAdded.push_back(index);
+        }
+        else if (mEntries[index].mVersion > aSince)
+        {
+            aChanges.mUpdated.push_back(index);
+        }
+    }
+
+    // The full table has no removals, the entries not in it are all removed.
+    for (size_t index = 0; !aChanges.mFull && index < mRemovals.size(); index++)
+    {
+        if (mRemovals[index].mVersion > aSince)
+        {
+            aChanges.mRemoved.push_back(index);
+        }
+    }
+}
+
+void TableVersions::Update(const std::vector<otChildInfo> &aTable,
+                           const std::vector<otChildInfo> *aPreviousTable,
+                           const TableVersions *           aPreviousVersions)
+{
+    UpdateTableVersions(aTable, aPreviousTable, aPreviousVersions, *this);
+}
+
+void TableVersions::Update(const std::vector<otNeighborInfo> &aTable,
+                           const std::vector<otNeighborInfo> *aPreviousTable,
+                           const TableVersions *              aPreviousVersions)
+{
+    UpdateTableVersions(aTable, aPreviousTable, aPreviousVersions, *this);
+}
+
+} // namespace Ncp
+} // namespace otbr
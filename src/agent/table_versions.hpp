@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the versions of the tables of the Thread node state.
+ */
+
+#ifndef OTBR_AGENT_TABLE_VERSIONS_HPP_
+#define OTBR_AGENT_TABLE_VERSIONS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+/**
+ * The maximum number of removed entries kept for each table of the node state, so that their removal is found by the
+ * changes since a version.
+ *
+ */
+#ifndef OTBR_NODE_STATE_MAX_REMOVED_ENTRIES
+#define OTBR_NODE_STATE_MAX_REMOVED_ENTRIES 64
+#endif
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents the versions of the child table or the neighbor table of the node state, so that the
+ * entries added, updated and removed since a version could be found.
+ *
+ * The version of the table is bumped by each snapshot changing the table, starting at 0 for the empty table. Entries
+ * are identified by their extended address, and only updated by a change of their role or link mode. The link
+ * metrics, i.e. the age, the RSSI, the link quality, the error rates and the frame counters, change with each frame
+ * heard, so they do not update the entry by themselves.
+ *
+ */
+struct TableVersions
+{
+    /**
+     * This structure represents the versions of an entry.
+     *
+     */
+    struct Entry
+    {
+        uint32_t mAddedVersion; ///< The version of the table the entry was added at.
+        uint32_t mVersion;      ///< The version of the table the entry last changed at.
+    };
+
+    /**
+     * This structure represents a removed entry.
+     *
+     */
+    struct Removal
+    {
+        otExtAddress mExtAddress; ///< The extended address of the entry.
+        uint32_t     mVersion;    ///< The version of the table the entry was removed at.
+    };
+
+    /**
+     * This structure represents the changes of a table since a version.
+     *
+     */
+    struct Changes
+    {
+        bool                mFull;    ///< Whether all entries are added, as the changes are not known.
+        std::vector<size_t> mAdded;   ///< The indices in the table of the entries added.
+        std::vector<size_t> mUpdated; ///< The indices in the table of the entries updated.
+        std::vector<size_t> mRemoved; ///< The indices in `mRemovals` of the entries removed.
+    };
+
+    /**
+     * This method indicates whether all changes since a version are known, including the removed entries.
+     *
+     * @param[in]   aVersion    The version.
+     *
+     * @retval  true    The changes since the version are known.
+     * @retval  false   The version is too old or unknown, the full table is needed.
+     *
+     */
+    bool HasChangesSince(uint32_t aVersion) const { return aVersion >= mPrunedVersion && aVersion <= mVersion; }
+
+    /**
+     * This method finds the changes of the table since a version.
+     *
+     * @param[in]   aSince      The version, 0 for the full table.
+     * @param[in]   aPage       A pointer to the indices of the entries to consider, in order, nullptr for all entries.
+     *                          The removed entries are never paged.
+     * @param[out]  aChanges    The changes.
+     *
+     */
+    void GetChanges(uint32_t aSince, const std::vector<size_t> *aPage, Changes &aChanges) const;
+
+    /**
+     * This method derives the versions of a child table from the previous snapshot.
+     *
+     * @param[in]   aTable              The child table.
+     * @param[in]   aPreviousTable      A pointer to the previous child table, nullptr for the first snapshot.
+     * @param[in]   aPreviousVersions   A pointer to the versions of the previous child table, nullptr for the first
+     *                                  snapshot.
+     *
+     */
+    void Update(const std::vector<otChildInfo> &aTable,
+                const std::vector<otChildInfo> *aPreviousTable,
+                const TableVersions *           aPreviousVersions);
+
+    /**
+     * This method derives the versions of a neighbor table from the previous snapshot.
+     *
+     * @param[in]   aTable              The neighbor table.
+     * @param[in]   aPreviousTable      A pointer to the previous neighbor table, nullptr for the first snapshot.
+     * @param[in]   aPreviousVersions   A pointer to the versions of the previous neighbor table, nullptr for the first
+     *                                  snapshot.
+     *
+     */
+    void Update(const std::vector<otNeighborInfo> &aTable,
+                const std::vector<otNeighborInfo> *aPreviousTable,
+                const TableVersions *              aPreviousVersions);
+
+    uint32_t             mVersion;       ///< The version of the table.
+    uint32_t             mPrunedVersion; ///< The version of the latest removal no longer kept.
+    std::vector<Entry>   mEntries;       ///< The versions of the entries, in the order of the table.
+    std::vector<Removal> mRemovals;      ///< The removed entries, from the oldest removal.
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_TABLE_VERSIONS_HPP_
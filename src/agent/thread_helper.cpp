@@ -29,13 +29,17 @@
 #include "agent/thread_helper.hpp"
 
 #include <assert.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <string.h>
 
+#include <algorithm>
 #include <string>
 
 #include <openthread/border_router.h>
 #include <openthread/channel_manager.h>
+#include <openthread/channel_monitor.h>
+#include <openthread/dataset.h>
 #include <openthread/jam_detection.h>
 #include <openthread/joiner.h>
 #include <openthread/thread_ftd.h>
@@ -46,14 +50,39 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/region_code.hpp"
+#include "common/tlv.hpp"
+#include "common/trace.hpp"
+#include "utils/state_cache.hpp"
 
 namespace otbr {
 namespace agent {
 
+namespace {
+
+enum
+{
+    kStateRole     = 0, ///< The attached role.
+    kStateExtPanId = 1, ///< The extended PAN ID of the network of the role.
+};
+
+} // namespace
+
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::ControllerOpenThread *aNcp)
     : mInstance(aInstance)
     , mNcp(aNcp)
+    , mScanResultsValid(false)
+    , mResumeTimer(HandleResumeTimer, this)
+    , mResuming(false)
+    , mResumeRole(OT_DEVICE_ROLE_DISABLED)
+    , mResumeRouterRequested(false)
+    , mCommissioningOrchestrator(aInstance)
+{
+}
+
+void ThreadHelper::StartResume(void)
 {
+    // The network is resumed from the mainloop, once the services have registered their handlers.
+    mResumeTimer.Start(std::chrono::microseconds(0));
 }
 
 void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
@@ -67,6 +96,13 @@ void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
             handler(role);
         }
 
+        if (mResuming)
+        {
+            HandleResumeRoleChanged(role);
+        }
+
+        SaveRole(role);
+
         if (role != OT_DEVICE_ROLE_DISABLED && role != OT_DEVICE_ROLE_DETACHED)
         {
             if (mAttachHandler != nullptr)
@@ -88,25 +124,50 @@ void ThreadHelper::AddDeviceRoleHandler(DeviceRoleHandler aHandler)
     mDeviceRoleHandlers.emplace_back(aHandler);
 }
 
-void ThreadHelper::Scan(ScanHandler aHandler)
+void ThreadHelper::Scan(ScanHandler aHandler, ScanResultHandler aResultHandler)
 {
-    otError error = OT_ERROR_NONE;
+    otError error    = OT_ERROR_NONE;
+    bool    scanning = !mScanSubscribers.empty();
+    bool    cached   = false;
 
     VerifyOrExit(aHandler != nullptr);
-    mScanHandler = aHandler;
-    mScanResults.clear();
 
-    error =
-        otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0, &ThreadHelper::sActiveScanHandler, this);
+    if (!scanning && mScanResultsValid)
+    {
+        cached = std::chrono::steady_clock::now() - mScanResultsTime < std::chrono::milliseconds(OTBR_SCAN_CACHE_TTL);
+    }
 
-exit:
-    if (error != OT_ERROR_NONE)
+    if (!scanning && !cached)
     {
-        if (aHandler)
+        mScanResults.clear();
+        mScanResultsValid = false;
+
+        SuccessOrExit(error = otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0,
+                                               &ThreadHelper::sActiveScanHandler, this));
+    }
+
+    if (aResultHandler != nullptr)
+    {
+        for (const otActiveScanResult &result : mScanResults)
         {
-            mScanHandler(error, {});
+            aResultHandler(result);
         }
-        mScanHandler = nullptr;
+    }
+
+    if (cached)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "Scan results returned from cache");
+        aHandler(OT_ERROR_NONE, mScanResults);
+    }
+    else
+    {
+        mScanSubscribers.push_back({aHandler, aResultHandler});
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aHandler(error, {});
     }
 }
 
@@ -132,14 +193,33 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mScanHandler != nullptr)
+        std::vector<ScanSubscriber>     subscribers;
+        std::vector<otActiveScanResult> results = mScanResults;
+
+        // Handlers may request another scan.
+        subscribers.swap(mScanSubscribers);
+        mScanResultsValid = true;
+        mScanResultsTime  = std::chrono::steady_clock::now();
+
+        for (const ScanSubscriber &subscriber : subscribers)
         {
-            mScanHandler(OT_ERROR_NONE, mScanResults);
+            subscriber.mHandler(OT_ERROR_NONE, results);
         }
     }
     else
     {
         mScanResults.push_back(*aResult);
+
+        // Indexed as handlers may request to share this scan.
+        for (size_t i = 0; i < mScanSubscribers.size(); i++)
+        {
+            ScanResultHandler handler = mScanSubscribers[i].mResultHandler;
+
+            if (handler != nullptr)
+            {
+                handler(*aResult);
+            }
+        }
     }
 }
 
@@ -161,6 +241,45 @@ uint8_t ThreadHelper::RandomChannelFromChannelMask(uint32_t aChannelMask)
     return channels[std::uniform_int_distribution<unsigned int>(0, numValidChannels - 1)(mRandomDevice)];
 }
 
+uint8_t ThreadHelper::SelectChannelFromChannelMask(uint32_t aChannelMask)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    // Channels this close to the least occupied one are as good, picking one at random spreads border routers
+    // forming networks at the same time.
+    constexpr uint16_t kOccupancyTolerance = 0x0400;
+    constexpr uint8_t  kNumChannels        = sizeof(aChannelMask) * 8;
+    uint16_t           occupancies[kNumChannels];
+    uint16_t           minOccupancy = UINT16_MAX;
+    uint32_t           candidates   = 0;
+
+    VerifyOrExit(otChannelMonitorIsRunning(mInstance) &&
+                 otChannelMonitorGetSampleCount(mInstance) >= OTBR_ATTACH_CHANNEL_MIN_SAMPLES);
+
+    for (uint8_t i = 0; i < kNumChannels; i++)
+    {
+        if (aChannelMask & (1U << i))
+        {
+            occupancies[i] = otChannelMonitorGetChannelOccupancy(mInstance, i);
+            minOccupancy   = (occupancies[i] < minOccupancy ? occupancies[i] : minOccupancy);
+        }
+    }
+
+    for (uint8_t i = 0; i < kNumChannels; i++)
+    {
+        if ((aChannelMask & (1U << i)) && occupancies[i] - minOccupancy <= kOccupancyTolerance)
+        {
+            candidates |= (1U << i);
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "Least channel occupancy is %.2f%%", minOccupancy * 100.0 / UINT16_MAX);
+    aChannelMask = candidates;
+
+exit:
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    return RandomChannelFromChannelMask(aChannelMask);
+}
+
 static otExtendedPanId ToOtExtendedPanId(uint64_t aExtPanId)
 {
     otExtendedPanId extPanId;
@@ -187,8 +306,8 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
     otExtendedPanId extPanId;
     otMasterKey     masterKey;
     otPskc          pskc;
-    uint32_t        preferredChannelMask = GetPreferredChannelMaskForRegion(mNcp->GetRegionCode());
-    uint32_t        supportedChannelMask = GetSupportedChannelMaskForRegion(mNcp->GetRegionCode());
+    uint32_t        preferredChannelMask = mNcp->GetRegionInfo().mPreferredChannelMask;
+    uint32_t        supportedChannelMask = mNcp->GetRegionInfo().mSupportedChannelMask;
     uint32_t        channelMask;
     uint8_t         channel;
 
@@ -254,7 +373,7 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
     }
     VerifyOrExit(channelMask != 0, otbrLog(OTBR_LOG_WARNING, "Invalid channel mask"), error = OT_ERROR_INVALID_ARGS);
 
-    channel = RandomChannelFromChannelMask(channelMask);
+    channel = SelectChannelFromChannelMask(channelMask);
     SuccessOrExit(otLinkSetChannel(mInstance, channel));
 
     SuccessOrExit(error = otThreadSetPskc(mInstance, &pskc));
@@ -271,9 +390,85 @@ exit:
     }
 }
 
+void ThreadHelper::AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, ResultHandler aHandler)
+{
+    otError                  error = OT_ERROR_NONE;
+    otOperationalDatasetTlvs datasetTlvs;
+    otDeviceRole             role;
+
+    VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(!aDatasetTlvs.empty() && aDatasetTlvs.size() <= sizeof(datasetTlvs.mTlvs),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    memcpy(datasetTlvs.mTlvs, aDatasetTlvs.data(), aDatasetTlvs.size());
+    datasetTlvs.mLength = static_cast<uint8_t>(aDatasetTlvs.size());
+    SuccessOrExit(error = otDatasetSetActiveTlvs(mInstance, &datasetTlvs));
+
+    if (!otIp6IsEnabled(mInstance))
+    {
+        SuccessOrExit(error = otIp6SetEnabled(mInstance, true));
+    }
+
+    SuccessOrExit(error = otThreadSetEnabled(mInstance, true));
+
+    role = otThreadGetDeviceRole(mInstance);
+
+    if (role != OT_DEVICE_ROLE_DISABLED && role != OT_DEVICE_ROLE_DETACHED)
+    {
+        // Already attached, the role will not change to signal the attach.
+        aHandler(OT_ERROR_NONE);
+    }
+    else
+    {
+        // The role changes are signaled from the tasklets, never from within the calls above.
+        mAttachHandler = aHandler;
+    }
+
+exit:
+    if (error != OT_ERROR_NONE && aHandler != nullptr)
+    {
+        aHandler(error);
+    }
+}
+
+void ThreadHelper::HandleNcpReset(otInstance *aInstance)
+{
+    std::vector<ScanSubscriber> subscribers;
+    ResultHandler               attachHandler = mAttachHandler;
+    ResultHandler               joinerHandler = mJoinerHandler;
+
+    mInstance = aInstance;
+
+    // The operations in progress are lost with the previous instance, handlers may start new ones.
+    subscribers.swap(mScanSubscribers);
+    mScanResults.clear();
+    mScanResultsValid = false;
+    mAttachHandler    = nullptr;
+    mJoinerHandler    = nullptr;
+    mResuming         = false;
+    mUnsecurePortCloseTime.clear();
+    mResumeTimer.Start(std::chrono::microseconds(0));
+    mCommissioningOrchestrator.HandleNcpReset(aInstance);
+
+    for (const ScanSubscriber &subscriber : subscribers)
+    {
+        subscriber.mHandler(OT_ERROR_ABORT, std::vector<otActiveScanResult>());
+    }
+
+    if (attachHandler != nullptr)
+    {
+        attachHandler(OT_ERROR_ABORT);
+    }
+
+    if (joinerHandler != nullptr)
+    {
+        joinerHandler(OT_ERROR_ABORT);
+    }
+}
+
 otError ThreadHelper::Reset(void)
 {
-    mDeviceRoleHandlers.clear();
     otInstanceReset(mInstance);
 
     return OT_ERROR_NONE;
@@ -339,6 +534,26 @@ otError ThreadHelper::TryResumeNetwork(void)
     {
         if (!otIp6IsEnabled(mInstance))
         {
+            const std::vector<uint8_t> *record = StateCache::Get().Find(StateCache::kRecordThread);
+            const Tlv *                 role =
+                (record != nullptr ? TlvIterator::Find(record->data(), record->size(), kStateRole) : nullptr);
+            const Tlv *extPanId =
+                (record != nullptr ? TlvIterator::Find(record->data(), record->size(), kStateExtPanId) : nullptr);
+
+            // The cached role is only restored on the same network.
+            mResumeRole = OT_DEVICE_ROLE_DISABLED;
+            if (role != nullptr && role->GetLength() == sizeof(uint8_t) && extPanId != nullptr &&
+                extPanId->GetLength() == sizeof(otExtendedPanId) &&
+                memcmp(extPanId->GetValue(), otThreadGetExtendedPanId(mInstance), sizeof(otExtendedPanId)) == 0)
+            {
+                mResumeRole = static_cast<otDeviceRole>(role->GetValueUInt8());
+            }
+
+            mResuming              = true;
+            mResumeRouterRequested = false;
+            mResumeStartTime       = std::chrono::steady_clock::now();
+            std::fill(std::begin(mResumePhases), std::end(mResumePhases), UINT32_MAX);
+
             SuccessOrExit(error = otIp6SetEnabled(mInstance, true));
             SuccessOrExit(error = otThreadSetEnabled(mInstance, true));
         }
@@ -348,6 +563,122 @@ exit:
     if (error != OT_ERROR_NONE)
     {
         (void)otIp6SetEnabled(mInstance, false);
+        mResuming = false;
+    }
+
+    return error;
+}
+
+void ThreadHelper::HandleResumeTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<ThreadHelper *>(aContext)->HandleResumeTimer();
+}
+
+void ThreadHelper::HandleResumeTimer(void)
+{
+    otError error = TryResumeNetwork();
+
+    if (error != OT_ERROR_NONE)
+    {
+        LogOpenThreadResult("Resume Thread network", error);
+        mResumeTimer.Start(std::chrono::milliseconds(OTBR_RESUME_RETRY_INTERVAL));
+    }
+}
+
+void ThreadHelper::HandleResumeRoleChanged(otDeviceRole aRole)
+{
+    uint32_t elapsed = static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mResumeStartTime)
+            .count());
+
+    switch (aRole)
+    {
+    case OT_DEVICE_ROLE_DISABLED:
+        // Stopped before resuming, the timings would mean nothing.
+        mResuming = false;
+        break;
+
+    case OT_DEVICE_ROLE_DETACHED:
+        if (mResumePhases[kResumeDetached] == UINT32_MAX)
+        {
+            mResumePhases[kResumeDetached] = elapsed;
+        }
+        break;
+
+    case OT_DEVICE_ROLE_CHILD:
+        if (mResumePhases[kResumeAttached] == UINT32_MAX)
+        {
+            mResumePhases[kResumeAttached] = elapsed;
+        }
+
+        // A former router asks for the router role now, instead of after the router selection jitter. It asks once,
+        // the resume ends as a child if the next role is a child again.
+        if (!mResumeRouterRequested && (mResumeRole == OT_DEVICE_ROLE_ROUTER || mResumeRole == OT_DEVICE_ROLE_LEADER) &&
+            otThreadIsRouterEligible(mInstance))
+        {
+            mResumeRouterRequested = true;
+
+            if (otThreadBecomeRouter(mInstance) == OT_ERROR_NONE)
+            {
+                otbrLog(OTBR_LOG_INFO, "Resuming the router role");
+                break;
+            }
+        }
+
+        mResumePhases[kResumeResumed] = elapsed;
+        FinishResume(aRole);
+        break;
+
+    case OT_DEVICE_ROLE_ROUTER:
+    case OT_DEVICE_ROLE_LEADER:
+        if (mResumePhases[kResumeAttached] == UINT32_MAX)
+        {
+            mResumePhases[kResumeAttached] = elapsed;
+        }
+
+        mResumePhases[kResumeResumed] = elapsed;
+        FinishResume(aRole);
+        break;
+    }
+}
+
+void ThreadHelper::FinishResume(otDeviceRole aRole)
+{
+    mResuming = false;
+
+    // A skipped phase took no time.
+    if (mResumePhases[kResumeDetached] == UINT32_MAX)
+    {
+        mResumePhases[kResumeDetached] = mResumePhases[kResumeAttached];
+    }
+
+    otbrTrace(OTBR_TRACE_RESUME, static_cast<uint32_t>(aRole), mResumePhases, sizeof(mResumePhases));
+    otbrLog(OTBR_LOG_INFO, "Resumed as %s in %" PRIu32 " ms, detached at %" PRIu32 " ms, attached at %" PRIu32 " ms",
+            otThreadDeviceRoleToString(aRole), mResumePhases[kResumeResumed], mResumePhases[kResumeDetached],
+            mResumePhases[kResumeAttached]);
+}
+
+otbrError ThreadHelper::SaveRole(otDeviceRole aRole)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   buffer[2 * TlvIterator::kHeaderSize + sizeof(uint8_t) + sizeof(otExtendedPanId)];
+    TlvWriter writer(buffer, sizeof(buffer));
+
+    // The role is kept when detached or stopped, as the one to resume.
+    VerifyOrExit(aRole == OT_DEVICE_ROLE_CHILD || aRole == OT_DEVICE_ROLE_ROUTER || aRole == OT_DEVICE_ROLE_LEADER);
+
+    writer.Append(kStateRole, static_cast<uint8_t>(aRole));
+    writer.Append(kStateExtPanId, otThreadGetExtendedPanId(mInstance), sizeof(otExtendedPanId));
+    VerifyOrExit(!writer.IsOverflowed(), error = OTBR_ERROR_INVALID_ARGS);
+
+    StateCache::Get().Update(StateCache::kRecordThread, std::vector<uint8_t>(buffer, buffer + writer.GetLength()));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to save the Thread role: %s", otbrErrorString(error));
     }
 
     return error;
@@ -43,7 +43,34 @@
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
 
+#include "agent/commissioning_orchestrator.hpp"
 #include "common/logging.hpp"
+#include "common/timer.hpp"
+
+/**
+ * The time in milliseconds the results of a completed scan are returned to further scan requests, 0 to not cache.
+ *
+ */
+#ifndef OTBR_SCAN_CACHE_TTL
+#define OTBR_SCAN_CACHE_TTL 5000
+#endif
+
+/**
+ * The minimum number of channel monitor samples for attaching to the least occupied channel of the channel mask,
+ * fewer samples attach to a random channel of the channel mask.
+ *
+ */
+#ifndef OTBR_ATTACH_CHANNEL_MIN_SAMPLES
+#define OTBR_ATTACH_CHANNEL_MIN_SAMPLES 4
+#endif
+
+/**
+ * The delay in milliseconds before retrying to resume the network after a failure.
+ *
+ */
+#ifndef OTBR_RESUME_RETRY_INTERVAL
+#define OTBR_RESUME_RETRY_INTERVAL 1000
+#endif
 
 namespace otbr {
 namespace Ncp {
@@ -59,6 +86,7 @@ class ThreadHelper
 public:
     using DeviceRoleHandler = std::function<void(otDeviceRole)>;
     using ScanHandler       = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
+    using ScanResultHandler = std::function<void(const otActiveScanResult &)>;
     using ResultHandler     = std::function<void(otError)>;
 
     /**
@@ -92,10 +120,15 @@ public:
     /**
      * This method performs a Thread network scan.
      *
-     * @param[in]   aHandler  The scan result handler.
+     * Requests made while a scan is in progress share its radio scan, and requests made within
+     * OTBR_SCAN_CACHE_TTL after a successful scan get its results without scanning.
+     *
+     * @param[in]   aHandler        The scan result handler, called with all results once the scan completes.
+     * @param[in]   aResultHandler  The handler of each result, called as results arrive, may be nullptr. Results
+     *                              which arrived or were cached before the request are passed right away.
      *
      */
-    void Scan(ScanHandler aHandler);
+    void Scan(ScanHandler aHandler, ScanResultHandler aResultHandler = nullptr);
 
     /**
      * This method attaches the device to the Thread network.
@@ -107,7 +140,8 @@ public:
      * @param[in]   aExtPanId       The extended pan id, UINT64_MAX for random.
      * @param[in]   aMasterKey      The master key, empty for random.
      * @param[in]   aPSKc           The pre-shared commissioner key, empty for random.
-     * @param[in]   aChannelMask    A bitmask for valid channels, will random select one.
+     * @param[in]   aChannelMask    A bitmask for valid channels, the least occupied one is selected if the channel
+     *                              monitor has enough samples, a random one otherwise.
      * @param[in]   aHandler        The attach result handler.
      *
      */
@@ -119,6 +153,29 @@ public:
                 uint32_t                    aChannelMask,
                 ResultHandler               aHandler);
 
+    /**
+     * This method attaches the device to the Thread network of a complete active operational dataset.
+     *
+     * The dataset is committed at once, then Thread is started.
+     *
+     * @note The joiner start and the attach proccesses are exclusive
+     *
+     * @param[in]   aDatasetTlvs    The MeshCoP TLVs of the active operational dataset.
+     * @param[in]   aHandler        The attach result handler.
+     *
+     */
+    void AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, ResultHandler aHandler);
+
+    /**
+     * This method handles the reinitialization of the OpenThread instance after a NCP reset.
+     *
+     * The device role handlers are kept, the pending scan, attach and join handlers are called with OT_ERROR_ABORT.
+     *
+     * @param[in]   aInstance   The reinitialized OpenThread instance.
+     *
+     */
+    void HandleNcpReset(otInstance *aInstance);
+
     /**
      * This method resets the OpenThread stack.
      *
@@ -152,11 +209,24 @@ public:
     /**
      * This method tries to restore the network after reboot
      *
+     * It is called once the OpenThread instance is initialized, and after `OTBR_RESUME_RETRY_INTERVAL` while it fails.
+     * A device which was a router before the restart requests the router role as soon as it is attached as a child,
+     * instead of after the router selection jitter. The time spent in each phase of the attach is logged and traced.
+     *
      * @returns The error value of underlying OpenThread api calls.
      *
      */
     otError TryResumeNetwork(void);
 
+    /**
+     * This method starts resuming the network with `TryResumeNetwork()` on the timer scheduler of the calling thread.
+     *
+     * It must be called from the mainloop once the OpenThread instance is initialized, which may be on another thread.
+     * The network is resumed again after a NCP reset.
+     *
+     */
+    void StartResume(void);
+
     /**
      * This method returns the underlying OpenThread instance.
      *
@@ -165,6 +235,14 @@ public:
      */
     otInstance *GetInstance(void) { return mInstance; }
 
+    /**
+     * This method returns the commissioning orchestrator of the queue of joiners.
+     *
+     * @returns A reference to the commissioning orchestrator.
+     *
+     */
+    CommissioningOrchestrator &GetCommissioningOrchestrator(void) { return mCommissioningOrchestrator; }
+
     /**
      * This method handles OpenThread state changed notification.
      *
@@ -193,15 +271,30 @@ private:
     static void sJoinerCallback(otError aError, void *aThreadHelper);
     void        JoinerCallback(otError aResult);
 
+    static void HandleResumeTimer(Timer &aTimer, void *aContext);
+    void        HandleResumeTimer(void);
+    void        HandleResumeRoleChanged(otDeviceRole aRole);
+    void        FinishResume(otDeviceRole aRole);
+    otbrError   SaveRole(otDeviceRole aRole);
+
     void    RandomFill(void *aBuf, size_t size);
     uint8_t RandomChannelFromChannelMask(uint32_t aChannelMask);
+    uint8_t SelectChannelFromChannelMask(uint32_t aChannelMask);
 
     otInstance *mInstance;
 
     otbr::Ncp::ControllerOpenThread *mNcp;
 
-    ScanHandler                     mScanHandler;
-    std::vector<otActiveScanResult> mScanResults;
+    struct ScanSubscriber
+    {
+        ScanHandler       mHandler;
+        ScanResultHandler mResultHandler;
+    };
+
+    std::vector<ScanSubscriber>           mScanSubscribers; ///< Empty if no scan is in progress.
+    std::vector<otActiveScanResult>       mScanResults;
+    bool                                  mScanResultsValid;
+    std::chrono::steady_clock::time_point mScanResultsTime;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
 
@@ -210,7 +303,24 @@ private:
     ResultHandler mAttachHandler;
     ResultHandler mJoinerHandler;
 
+    enum
+    {
+        kResumeDetached, ///< The detached role.
+        kResumeAttached, ///< Attached in any role.
+        kResumeResumed,  ///< The role before the restart, or the first one if it is not restored.
+        kNumResumePhases,
+    };
+
+    Timer                                 mResumeTimer;
+    bool                                  mResuming;
+    otDeviceRole                          mResumeRole;           ///< The role before the restart, disabled if unknown.
+    bool                                  mResumeRouterRequested; ///< Whether the router role was requested.
+    std::chrono::steady_clock::time_point mResumeStartTime;
+    uint32_t                              mResumePhases[kNumResumePhases]; ///< Milliseconds since the start.
+
     std::random_device mRandomDevice;
+
+    CommissioningOrchestrator mCommissioningOrchestrator;
 };
 
 } // namespace agent
@@ -37,6 +37,7 @@
 #include <net/if.h>
 
 #include <openthread/backbone_router_ftd.h>
+#include <openthread/thread.h>
 
 #include "common/code_utils.hpp"
 
@@ -47,27 +48,36 @@ BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp)
     : mNcp(aNcp)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
     , mNdProxyManager(aNcp)
+    , mMulticastRoutingManager(aNcp)
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    , mPeerSync(mNdProxyManager, mMulticastRoutingManager)
+#endif
 {
 }
 
 void BackboneAgent::Init(void)
 {
-    mNcp.On(Ncp::kEventBackboneRouterState, HandleBackboneRouterState, this);
-    mNcp.On(Ncp::kEventBackboneRouterDomainPrefixEvent, HandleBackboneRouterDomainPrefixEvent, this);
-    mNcp.On(Ncp::kEventBackboneRouterNdProxyEvent, HandleBackboneRouterNdProxyEvent, this);
+    mNcp.On<Ncp::kEventBackboneRouterState>(HandleBackboneRouterState, this);
+    mNcp.On<Ncp::kEventBackboneRouterDomainPrefixEvent>(HandleBackboneRouterDomainPrefixEvent, this);
+    mNcp.On<Ncp::kEventBackboneRouterNdProxyEvent>(HandleBackboneRouterNdProxyEvent, this);
+    mNcp.On<Ncp::kEventBackboneRouterMulticastListenerEvent>(HandleBackboneRouterMulticastListenerEvent, this);
 
     mNdProxyManager.Init();
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    mPeerSync.Init();
+    mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) {
+        if (aFlags & OT_CHANGED_MASTER_KEY)
+        {
+            UpdatePeerSync();
+        }
+    });
+#endif
 
     HandleBackboneRouterState();
 }
 
-void BackboneAgent::HandleBackboneRouterState(void *aContext, int aEvent, va_list aArguments)
+void BackboneAgent::HandleBackboneRouterState(void *aContext)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-    OT_UNUSED_VARIABLE(aArguments);
-
-    assert(aEvent == Ncp::kEventBackboneRouterState);
-
     static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterState();
 }
 
@@ -78,6 +88,11 @@ void BackboneAgent::HandleBackboneRouterState(void)
 
     otbrLog(OTBR_LOG_DEBUG, "BackboneAgent: HandleBackboneRouterState: state=%d, mBackboneRouterState=%d", state,
             mBackboneRouterState);
+
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    // The Primary may change while the state of this Backbone Router does not.
+    UpdatePeerSync();
+#endif
     VerifyOrExit(mBackboneRouterState != state);
 
     mBackboneRouterState = state;
@@ -99,10 +114,22 @@ void BackboneAgent::OnBecomePrimary(void)
 {
     otbrLog(OTBR_LOG_NOTICE, "BackboneAgent: Backbone Router becomes Primary!");
 
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    // The state of the previous Primary is taken over before enabling, so that it is proxied at once.
+    mNdProxyManager.AddPeerNdProxies(mPeerSync.GetPeerDuas(mDomainPrefix));
+#endif
+
     if (mDomainPrefix.IsValid())
     {
         mNdProxyManager.Enable(mDomainPrefix);
     }
+
+    mMulticastRoutingManager.Enable();
+
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    mMulticastRoutingManager.AddPeerListeners(mPeerSync.GetPeerListeners());
+    mPeerSync.SetPrimary(true);
+#endif
 }
 
 void BackboneAgent::OnResignPrimary(void)
@@ -111,8 +138,32 @@ void BackboneAgent::OnResignPrimary(void)
             StateToString(mBackboneRouterState));
 
     mNdProxyManager.Disable();
+    mMulticastRoutingManager.Disable();
+
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    mPeerSync.SetPrimary(false);
+#endif
 }
 
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+void BackboneAgent::UpdatePeerSync(void)
+{
+    otBackboneRouterConfig primary;
+    const otMasterKey *    masterKey = otThreadGetMasterKey(mNcp.GetInstance());
+
+    mPeerSync.SetNetworkKey(masterKey->m8, sizeof(masterKey->m8));
+
+    if (otBackboneRouterGetPrimary(mNcp.GetInstance(), &primary) == OT_ERROR_NONE)
+    {
+        mPeerSync.SetPrimaryServer(primary.mServer16);
+    }
+    else
+    {
+        mPeerSync.SetPrimaryServer(PeerSyncCodec::kInvalidRloc16);
+    }
+}
+#endif
+
 const char *BackboneAgent::StateToString(otBackboneRouterState aState)
 {
     const char *ret = "Unknown";
@@ -132,32 +183,11 @@ const char *BackboneAgent::StateToString(otBackboneRouterState aState)
 
     return ret;
 }
-void BackboneAgent::UpdateFdSet(fd_set & aReadFdSet,
-                                fd_set & aWriteFdSet,
-                                fd_set & aErrorFdSet,
-                                int &    aMaxFd,
-                                timeval &aTimeout) const
-{
-    mNdProxyManager.UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
-}
-
-void BackboneAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
+                                                          otBackboneRouterDomainPrefixEvent aEvent,
+                                                          const otIp6Prefix *               aDomainPrefix)
 {
-    mNdProxyManager.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
-}
-
-void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(void *aContext, int aEvent, va_list aArguments)
-{
-    OT_UNUSED_VARIABLE(aEvent);
-
-    otBackboneRouterDomainPrefixEvent event;
-    const otIp6Prefix *               domainPrefix;
-
-    assert(aEvent == Ncp::kEventBackboneRouterDomainPrefixEvent);
-
-    event        = static_cast<otBackboneRouterDomainPrefixEvent>(va_arg(aArguments, int));
-    domainPrefix = va_arg(aArguments, const otIp6Prefix *);
-    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterDomainPrefixEvent(event, domainPrefix);
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterDomainPrefixEvent(aEvent, aDomainPrefix);
 }
 
 void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
@@ -182,23 +212,39 @@ exit:
     return;
 }
 
-void BackboneAgent::HandleBackboneRouterNdProxyEvent(void *aContext, int aEvent, va_list aArguments)
+void BackboneAgent::HandleBackboneRouterNdProxyEvent(void *                       aContext,
+                                                     otBackboneRouterNdProxyEvent aEvent,
+                                                     const otIp6Address *         aAddress)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterNdProxyEvent(aEvent, aAddress);
+}
 
-    otBackboneRouterNdProxyEvent event;
-    const otIp6Address *         address;
+void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
+{
+    mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
 
-    assert(aEvent == Ncp::kEventBackboneRouterNdProxyEvent);
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    mPeerSync.ScheduleUpdate();
+#endif
+}
 
-    event   = static_cast<otBackboneRouterNdProxyEvent>(va_arg(aArguments, int));
-    address = va_arg(aArguments, const otIp6Address *);
-    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterNdProxyEvent(event, address);
+void BackboneAgent::HandleBackboneRouterMulticastListenerEvent(void *                                 aContext,
+                                                               otBackboneRouterMulticastListenerEvent aEvent,
+                                                               const otIp6Address *                   aAddress)
+{
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterMulticastListenerEvent(aEvent, aAddress);
 }
 
-void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
+void BackboneAgent::HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                               const otIp6Address *                   aAddress)
 {
-    mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
+    assert(aAddress != nullptr);
+
+    mMulticastRoutingManager.HandleBackboneMulticastListenerEvent(aEvent, Ip6Address(aAddress->mFields.m8));
+
+#if OTBR_ENABLE_BACKBONE_PEER_SYNC
+    mPeerSync.ScheduleUpdate();
+#endif
 }
 
 } // namespace BackboneRouter
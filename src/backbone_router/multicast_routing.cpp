@@ -0,0 +1,460 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the multicast routing of Multicast Listener Registration (MLR).
+ */
+
+#include "backbone_router/multicast_routing.hpp"
+
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#if __linux__
+#include <linux/mroute6.h>
+#else
+#error "Platform not supported"
+#endif
+
+#include "agent/instance_params.hpp"
+#include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+MulticastRoutingManager::MulticastRoutingManager(otbr::Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+    , mMulticastRouterSock(-1)
+    , mUpdateTimer(HandleUpdateTimer, this)
+    , mExpireTimer(HandleExpireTimer, this)
+    , mPeerTimer(HandlePeerTimer, this)
+{
+}
+
+void MulticastRoutingManager::Enable(void)
+{
+    otbrError                                 error    = OTBR_ERROR_NONE;
+    otBackboneRouterMulticastListenerIterator iterator = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    otBackboneRouterMulticastListenerInfo     info;
+
+    VerifyOrExit(!IsEnabled());
+
+    SuccessOrExit(error = InitMulticastRouterSock());
+
+    // Listeners registered before becoming Primary are read all at once, no route exists yet to be updated.
+    mListenerSet.clear();
+    while (otBackboneRouterMulticastListenerGetNext(mNcp.GetInstance(), &iterator, &info) == OT_ERROR_NONE)
+    {
+        mListenerSet.insert(Ip6Address(info.mAddress.mFields.m8));
+    }
+
+    mExpireTimer.Start(std::chrono::seconds(kExpireInterval));
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: %s with %zu listeners", __FUNCTION__, mListenerSet.size());
+}
+
+void MulticastRoutingManager::Disable(void)
+{
+    VerifyOrExit(IsEnabled());
+
+    // Closing the socket removes all interfaces and routes from the kernel.
+    FiniMulticastRouterSock();
+
+    mUpdateTimer.Stop();
+    mExpireTimer.Stop();
+    mPeerTimer.Stop();
+    mRoutes.clear();
+    mDirtyGroups.clear();
+    mPeerListeners.clear();
+
+    otbrLog(OTBR_LOG_INFO, "MulticastRoutingManager: %s", __FUNCTION__);
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::HandleBackboneMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                                   const Ip6Address &                     aAddress)
+{
+    mPeerListeners.erase(aAddress);
+
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED:
+        if (mListenerSet.insert(aAddress).second)
+        {
+            MarkGroupDirty(aAddress);
+        }
+        break;
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED:
+        if (mListenerSet.erase(aAddress) > 0)
+        {
+            MarkGroupDirty(aAddress);
+        }
+        break;
+    }
+
+    otbrLog(OTBR_LOG_DEBUG, "MulticastRoutingManager: %s listener %s",
+            aEvent == OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED ? "added" : "removed", aAddress.ToString().c_str());
+}
+
+std::vector<Ip6Address> MulticastRoutingManager::GetListeners(void) const
+{
+    return std::vector<Ip6Address>(mListenerSet.begin(), mListenerSet.end());
+}
+
+void MulticastRoutingManager::AddPeerListeners(const std::vector<Ip6Address> &aGroups)
+{
+    VerifyOrExit(IsEnabled());
+
+    for (const Ip6Address &group : aGroups)
+    {
+        if (mListenerSet.insert(group).second)
+        {
+            mPeerListeners.insert(group);
+            MarkGroupDirty(group);
+        }
+    }
+
+    if (!mPeerListeners.empty())
+    {
+        mPeerTimer.Start(std::chrono::milliseconds(OTBR_MULTICAST_PEER_LISTENER_TIMEOUT));
+    }
+
+    otbrLog(OTBR_LOG_INFO, "MulticastRoutingManager: took over %zu of %zu listeners of the previous Primary",
+            mPeerListeners.size(), aGroups.size());
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::HandlePeerTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<MulticastRoutingManager *>(aContext)->HandlePeerTimer();
+}
+
+void MulticastRoutingManager::HandlePeerTimer(void)
+{
+    // Listeners reported by OpenThread meanwhile were removed from the set already.
+    for (const Ip6Address &group : mPeerListeners)
+    {
+        if (mListenerSet.erase(group) > 0)
+        {
+            MarkGroupDirty(group);
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "MulticastRoutingManager: dropped %zu listeners of the previous Primary",
+            mPeerListeners.size());
+    mPeerListeners.clear();
+}
+
+otbrError MulticastRoutingManager::InitMulticastRouterSock(void)
+{
+    otbrError           error = OTBR_ERROR_NONE;
+    int                 one   = 1;
+    struct icmp6_filter filter;
+
+    mMulticastRouterSock = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+    VerifyOrExit(mMulticastRouterSock >= 0, error = OTBR_ERROR_ERRNO);
+
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_INIT, &one, sizeof(one)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    // Only kernel upcalls are read from the socket.
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = AddMulticastInterface(kMifIndexThread, InstanceParams::Get().GetThreadIfName()));
+    SuccessOrExit(error = AddMulticastInterface(kMifIndexBackbone, InstanceParams::Get().GetBackboneIfName()));
+
+    SuccessOrExit(error = EventPoller::Get().Register(mMulticastRouterSock, EventPoller::kEventReadable,
+                                                      &MulticastRoutingManager::HandleEvent, this,
+                                                      EventPoller::kPriorityHigh));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        FiniMulticastRouterSock();
+    }
+
+    otbrLogResult(error, "MulticastRoutingManager: %s", __FUNCTION__);
+    return error;
+}
+
+void MulticastRoutingManager::FiniMulticastRouterSock(void)
+{
+    if (mMulticastRouterSock != -1)
+    {
+        EventPoller::Get().Unregister(mMulticastRouterSock);
+        close(mMulticastRouterSock);
+        mMulticastRouterSock = -1;
+    }
+}
+
+otbrError MulticastRoutingManager::AddMulticastInterface(MifIndex aMif, const char *aIfName)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mif6ctl mif6ctl;
+
+    memset(&mif6ctl, 0, sizeof(mif6ctl));
+    mif6ctl.mif6c_mifi = aMif;
+    mif6ctl.mif6c_pifi = static_cast<uint16_t>(if_nametoindex(aIfName));
+    VerifyOrExit(mif6ctl.mif6c_pifi > 0, error = OTBR_ERROR_ERRNO);
+
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MIF, &mif6ctl, sizeof(mif6ctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: %s %s as %u", __FUNCTION__, aIfName, aMif);
+    return error;
+}
+
+void MulticastRoutingManager::HandleEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+
+    static_cast<MulticastRoutingManager *>(aContext)->ProcessMulticastRouterMessages();
+}
+
+void MulticastRoutingManager::ProcessMulticastRouterMessages(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   buffer[sizeof(struct mrt6msg)];
+    ssize_t   len;
+
+    // Upcalls left over the budget are handled in the next mainloop iteration, as the socket stays readable.
+    for (int budget = kMaxUpcallsPerProcess; budget > 0; budget--)
+    {
+        struct mrt6msg *msg = reinterpret_cast<struct mrt6msg *>(buffer);
+
+        // The upcall is the IPv6 header of the packet overwritten by a `mrt6msg`, the rest is truncated.
+        len = recv(mMulticastRouterSock, buffer, sizeof(buffer), MSG_DONTWAIT | MSG_TRUNC);
+
+        if (len < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            ExitNow();
+        }
+
+        if (static_cast<size_t>(len) < sizeof(*msg) || msg->im6_mbz != 0)
+        {
+            continue;
+        }
+
+        if (msg->im6_msgtype == MRT6MSG_NOCACHE)
+        {
+            HandleNoCache(Ip6Address(msg->im6_src.s6_addr), Ip6Address(msg->im6_dst.s6_addr),
+                          static_cast<MifIndex>(msg->im6_mif));
+        }
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogResult(error, "MulticastRoutingManager: %s", __FUNCTION__);
+    }
+}
+
+void MulticastRoutingManager::HandleNoCache(const Ip6Address &aSource, const Ip6Address &aGroup, MifIndex aInputMif)
+{
+    RouteKey key;
+    Route    route;
+
+    VerifyOrExit(aInputMif == kMifIndexThread || aInputMif == kMifIndexBackbone);
+
+    key.mSource        = aSource;
+    key.mGroup         = aGroup;
+    route.mInputMif    = aInputMif;
+    route.mPacketCount = 0;
+
+    // A route is added even when not forwarding, so that the kernel drops the packets instead of reporting each.
+    SuccessOrExit(SetRoute(key, route));
+    mRoutes[key] = route;
+
+exit:
+    return;
+}
+
+bool MulticastRoutingManager::IsForwarding(const Ip6Address &aGroup, MifIndex aInputMif) const
+{
+    static constexpr uint8_t kRealmLocalScope = 3;
+
+    bool forwarding;
+
+    if (aInputMif == kMifIndexBackbone)
+    {
+        forwarding = mListenerSet.count(aGroup) > 0;
+    }
+    else
+    {
+        // Multicast from Thread is forwarded to the backbone beyond the realm-local scope.
+        forwarding = (aGroup.m8[1] & 0x0f) > kRealmLocalScope;
+    }
+
+    return forwarding;
+}
+
+otbrError MulticastRoutingManager::SetRoute(const RouteKey &aKey, Route &aRoute)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mf6cctl mf6cctl;
+
+    memset(&mf6cctl, 0, sizeof(mf6cctl));
+    aKey.mSource.CopyTo(mf6cctl.mf6cc_origin);
+    aKey.mGroup.CopyTo(mf6cctl.mf6cc_mcastgrp);
+    mf6cctl.mf6cc_parent = aRoute.mInputMif;
+
+    aRoute.mForwarding = IsForwarding(aKey.mGroup, aRoute.mInputMif);
+    if (aRoute.mForwarding)
+    {
+        IF_SET(aRoute.mInputMif == kMifIndexThread ? kMifIndexBackbone : kMifIndexThread, &mf6cctl.mf6cc_ifset);
+    }
+
+    // An existing route of the same source and group is replaced.
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MFC, &mf6cctl, sizeof(mf6cctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: %s %s => %s from %u %s", __FUNCTION__,
+                  aKey.mSource.ToString().c_str(), aKey.mGroup.ToString().c_str(), aRoute.mInputMif,
+                  aRoute.mForwarding ? "forwarding" : "blocked");
+    return error;
+}
+
+MulticastRoutingManager::RouteMap::iterator MulticastRoutingManager::RemoveRoute(RouteMap::iterator aRoute)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mf6cctl mf6cctl;
+
+    memset(&mf6cctl, 0, sizeof(mf6cctl));
+    aRoute->first.mSource.CopyTo(mf6cctl.mf6cc_origin);
+    aRoute->first.mGroup.CopyTo(mf6cctl.mf6cc_mcastgrp);
+    mf6cctl.mf6cc_parent = aRoute->second.mInputMif;
+
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_DEL_MFC, &mf6cctl, sizeof(mf6cctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: %s %s => %s", __FUNCTION__,
+                  aRoute->first.mSource.ToString().c_str(), aRoute->first.mGroup.ToString().c_str());
+    return mRoutes.erase(aRoute);
+}
+
+void MulticastRoutingManager::MarkGroupDirty(const Ip6Address &aGroup)
+{
+    VerifyOrExit(IsEnabled());
+
+    mDirtyGroups.insert(aGroup);
+
+    // Listener changes of a burst of registrations are applied together in the next mainloop iteration.
+    if (!mUpdateTimer.IsRunning())
+    {
+        mUpdateTimer.Start(std::chrono::microseconds(0));
+    }
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::HandleUpdateTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<MulticastRoutingManager *>(aContext)->HandleUpdateTimer();
+}
+
+void MulticastRoutingManager::HandleUpdateTimer(void)
+{
+    for (const Ip6Address &group : mDirtyGroups)
+    {
+        RouteKey first;
+
+        first.mGroup = group;
+
+        // The zero source is the lowest, so the first route of the group is found.
+        for (auto it = mRoutes.lower_bound(first); it != mRoutes.end() && it->first.mGroup == group; ++it)
+        {
+            if (it->second.mForwarding != IsForwarding(group, it->second.mInputMif))
+            {
+                SetRoute(it->first, it->second);
+            }
+        }
+    }
+
+    mDirtyGroups.clear();
+}
+
+void MulticastRoutingManager::HandleExpireTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<MulticastRoutingManager *>(aContext)->HandleExpireTimer();
+}
+
+void MulticastRoutingManager::HandleExpireTimer(void)
+{
+    for (auto it = mRoutes.begin(); it != mRoutes.end();)
+    {
+        struct sioc_sg_req6 request;
+
+        memset(&request, 0, sizeof(request));
+        it->first.mSource.CopyTo(request.src);
+        it->first.mGroup.CopyTo(request.grp);
+
+        // A route without packets since the last check is removed, a later packet adds it again.
+        if (ioctl(mMulticastRouterSock, SIOCGETSGCNT_IN6, &request) == 0 && request.pktcnt == it->second.mPacketCount)
+        {
+            it = RemoveRoute(it);
+        }
+        else
+        {
+            it->second.mPacketCount = request.pktcnt;
+            ++it;
+        }
+    }
+
+    mExpireTimer.Start(std::chrono::seconds(kExpireInterval));
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
@@ -0,0 +1,205 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the multicast routing of Multicast Listener Registration (MLR).
+ */
+
+#ifndef BACKBONE_ROUTER_MULTICAST_ROUTING_HPP_
+#define BACKBONE_ROUTER_MULTICAST_ROUTING_HPP_
+
+#include <map>
+#include <netinet/in.h>
+#include <unordered_set>
+#include <vector>
+
+#include <openthread/backbone_router_ftd.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/timer.hpp"
+#include "common/types.hpp"
+
+/**
+ * The time in milliseconds the listeners taken over from the previous Primary Backbone Router are routed, they are
+ * dropped then unless OpenThread has them again.
+ *
+ */
+#ifndef OTBR_MULTICAST_PEER_LISTENER_TIMEOUT
+#define OTBR_MULTICAST_PEER_LISTENER_TIMEOUT 30000
+#endif
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-bbr
+ *
+ * @brief
+ *   This module includes definition for the multicast routing manager.
+ *
+ * @{
+ */
+
+/**
+ * This class forwards multicast between the Thread and the backbone interfaces by kernel multicast routing (MRT6).
+ *
+ * The multicast forwarding cache (MFC) of the kernel is programmed on demand: the kernel reports the first packet of
+ * each (source, group) without a route, and every later packet is forwarded by the kernel. Packets from the backbone
+ * are forwarded to Thread only for groups with registered listeners.
+ *
+ */
+class MulticastRoutingManager
+{
+public:
+    /**
+     * This constructor initializes a MulticastRoutingManager instance.
+     *
+     * @param[in] aNcp  The Thread instance.
+     *
+     */
+    explicit MulticastRoutingManager(otbr::Ncp::ControllerOpenThread &aNcp);
+
+    /**
+     * This method enables the multicast routing, with the listeners registered in OpenThread.
+     *
+     */
+    void Enable(void);
+
+    /**
+     * This method disables the multicast routing, and removes all routes from the kernel.
+     *
+     */
+    void Disable(void);
+
+    /**
+     * This method handles a Backbone Router Multicast Listener event.
+     *
+     * @param[in] aEvent    The Backbone Router Multicast Listener event type.
+     * @param[in] aAddress  The multicast address of the listener.
+     *
+     */
+    void HandleBackboneMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                              const Ip6Address &                     aAddress);
+
+    /**
+     * This method returns if the multicast routing is enabled.
+     *
+     * @returns  If the multicast routing is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return mMulticastRouterSock >= 0; }
+
+    /**
+     * This method returns the multicast groups with registered listeners.
+     *
+     * @returns The multicast groups with registered listeners.
+     *
+     */
+    std::vector<Ip6Address> GetListeners(void) const;
+
+    /**
+     * This method routes the listeners of the previous Primary Backbone Router, until OpenThread reports them or
+     * `OTBR_MULTICAST_PEER_LISTENER_TIMEOUT` drops them.
+     *
+     * The multicast routing must be enabled.
+     *
+     * @param[in] aGroups  The multicast groups with listeners of the previous Primary Backbone Router.
+     *
+     */
+    void AddPeerListeners(const std::vector<Ip6Address> &aGroups);
+
+private:
+    enum MifIndex : uint16_t
+    {
+        kMifIndexThread   = 0,
+        kMifIndexBackbone = 1,
+    };
+
+    enum
+    {
+        kMaxUpcallsPerProcess = 64,  ///< Max number of kernel upcalls handled per mainloop iteration.
+        kExpireInterval       = 300, ///< Interval (in seconds) after which an idle route is removed.
+    };
+
+    struct RouteKey
+    {
+        Ip6Address mSource;
+        Ip6Address mGroup;
+
+        bool operator<(const RouteKey &aOther) const
+        {
+            return mGroup < aOther.mGroup || (mGroup == aOther.mGroup && mSource < aOther.mSource);
+        }
+    };
+
+    struct Route
+    {
+        MifIndex      mInputMif;
+        bool          mForwarding;  ///< Whether packets are forwarded, or dropped by the kernel without an upcall.
+        unsigned long mPacketCount; ///< Number of packets of the route at the last expiry check.
+    };
+
+    typedef std::map<RouteKey, Route> RouteMap; ///< Routes ordered by group, so routes of a group are adjacent.
+
+    otbrError          InitMulticastRouterSock(void);
+    void               FiniMulticastRouterSock(void);
+    otbrError          AddMulticastInterface(MifIndex aMif, const char *aIfName);
+    void               ProcessMulticastRouterMessages(void);
+    void               HandleNoCache(const Ip6Address &aSource, const Ip6Address &aGroup, MifIndex aInputMif);
+    bool               IsForwarding(const Ip6Address &aGroup, MifIndex aInputMif) const;
+    otbrError          SetRoute(const RouteKey &aKey, Route &aRoute);
+    RouteMap::iterator RemoveRoute(RouteMap::iterator aRoute);
+    void               MarkGroupDirty(const Ip6Address &aGroup);
+    static void        HandleEvent(void *aContext, int aFd, uint32_t aEvents);
+    static void        HandleUpdateTimer(Timer &aTimer, void *aContext);
+    void               HandleUpdateTimer(void);
+    static void        HandleExpireTimer(Timer &aTimer, void *aContext);
+    void               HandleExpireTimer(void);
+    static void        HandlePeerTimer(Timer &aTimer, void *aContext);
+    void               HandlePeerTimer(void);
+
+    otbr::Ncp::ControllerOpenThread &              mNcp;
+    int                                            mMulticastRouterSock;
+    std::unordered_set<Ip6Address, Ip6AddressHash> mListenerSet;   ///< Groups with registered listeners.
+    std::unordered_set<Ip6Address, Ip6AddressHash> mDirtyGroups;   ///< Groups whose routes are to be updated.
+    std::unordered_set<Ip6Address, Ip6AddressHash> mPeerListeners; ///< Groups not reported by OpenThread yet.
+    RouteMap                                       mRoutes;
+    Timer                                          mUpdateTimer; ///< Updates the routes of dirty groups in a batch.
+    Timer                                          mExpireTimer;
+    Timer                                          mPeerTimer; ///< Drops the listeners taken over.
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // BACKBONE_ROUTER_MULTICAST_ROUTING_HPP_
@@ -35,14 +35,23 @@
 
 #include <openthread/backbone_router_ftd.h>
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include <assert.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <stddef.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 #if __linux__
+#include <linux/filter.h>
 #include <linux/netfilter.h>
 #else
 #error "Platform not supported"
@@ -50,9 +59,14 @@
 
 #include "agent/instance_params.hpp"
 #include "backbone_router/constants.hpp"
+#include "backbone_router/nd_proxy_counters.hpp"
 #include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
 #include "common/logging.hpp"
+#include "common/memory_stats.hpp"
 #include "common/types.hpp"
+#include "utils/nft_rule_manager.hpp"
+#include "utils/state_cache.hpp"
 #include "utils/system_utils.hpp"
 
 namespace otbr {
@@ -71,12 +85,9 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     SuccessOrExit(error = UpdateMacAddress());
     SuccessOrExit(error = InitNetfilterQueue());
 
-    // Add ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = AddUnicastNsRule());
+
+    SyncNdProxyTable();
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -94,95 +105,176 @@ void NdProxyManager::Disable(void)
 
     VerifyOrExit(IsEnabled());
 
+    mUpdateTimer.Stop();
+    mPendingAnnouncements.clear();
+    mSocketFilterPending = false;
+
+    if (mSavePending)
+    {
+        mSavePending = false;
+        SaveNdProxyTable();
+    }
+
     FiniNetfilterQueue();
     FiniIcmp6RawSocket();
 
-    // Remove ip6tables rule for unicast ICMPv6 messages
+    error = RemoveUnicastNsRule();
+
+exit:
+    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+}
+
+otbrError NdProxyManager::AddUnicastNsRule(void)
+{
+    const char *                backboneIfName = InstanceParams::Get().GetBackboneIfName();
+    Utils::NftRuleManager::Rule rule;
+    otbrError                   error;
+
+    rule.MatchInputInterface(backboneIfName)
+        .MatchDestination(mDomainPrefix)
+        .MatchIcmp6Type(ND_NEIGHBOR_SOLICIT)
+        .Queue(kUnicastNsQueueNum, OTBR_ND_PROXY_QUEUE_FAIL_OPEN);
+
+    mUnicastNsChain = std::string("nd_proxy_") + InstanceParams::Get().GetThreadIfName();
+    mUnicastNsByIp6tables = false;
+
+    error = mNftRules.SetChain(mUnicastNsChain.c_str(), Utils::NftRuleManager::kHookPrerouting,
+                               Utils::NftRuleManager::kPriorityRaw, {rule});
+    VerifyOrExit(error != OTBR_ERROR_NONE);
+
+    // Kernels without nf_tables only support the ip6tables rules.
+    otbrLog(OTBR_LOG_WARNING, "NdProxyManager: failed to add the nftables rule: %s, using ip6tables", strerror(errno));
+    VerifyOrExit(SystemUtils::ExecuteCommand(
+                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
+                     "NFQUEUE --queue-num %d%s",
+                     mDomainPrefix.ToString().c_str(), backboneIfName, kUnicastNsQueueNum,
+                     OTBR_ND_PROXY_QUEUE_FAIL_OPEN ? " --queue-bypass" : "") == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    mUnicastNsByIp6tables = true;
+    error                 = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError NdProxyManager::RemoveUnicastNsRule(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    if (!mUnicastNsByIp6tables)
+    {
+        error = mNftRules.RemoveChain(mUnicastNsChain.c_str());
+        ExitNow();
+    }
+
     VerifyOrExit(SystemUtils::ExecuteCommand(
                      "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
+                     "NFQUEUE --queue-num %d%s",
+                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName(), kUnicastNsQueueNum,
+                     OTBR_ND_PROXY_QUEUE_FAIL_OPEN ? " --queue-bypass" : "") == 0,
                  error = OTBR_ERROR_ERRNO);
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return error;
 }
 
 void NdProxyManager::Init(void)
 {
     mBackboneIfIndex = if_nametoindex(InstanceParams::Get().GetBackboneIfName());
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
+
+    RestoreNdProxyTable();
 }
 
-void NdProxyManager::UpdateFdSet(fd_set & aReadFdSet,
-                                 fd_set & aWriteFdSet,
-                                 fd_set & aErrorFdSet,
-                                 int &    aMaxFd,
-                                 timeval &aTimeout) const
+void NdProxyManager::HandleEvent(void *aContext, int aFd, uint32_t aEvents)
 {
-    OTBR_UNUSED_VARIABLE(aWriteFdSet);
-    OTBR_UNUSED_VARIABLE(aErrorFdSet);
-    OTBR_UNUSED_VARIABLE(aTimeout);
+    NdProxyManager *ndProxyManager = static_cast<NdProxyManager *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aEvents);
 
-    if (mIcmp6RawSock >= 0)
+    if (aFd == ndProxyManager->mIcmp6RawSock)
     {
-        FD_SET(mIcmp6RawSock, &aReadFdSet);
-        aMaxFd = std::max(aMaxFd, mIcmp6RawSock);
+        ndProxyManager->ProcessMulticastNeighborSolicition();
     }
-
-    if (mUnicastNsQueueSock >= 0)
+    else if (aFd == ndProxyManager->mUnicastNsQueueSock)
     {
-        FD_SET(mUnicastNsQueueSock, &aReadFdSet);
-        aMaxFd = std::max(aMaxFd, mUnicastNsQueueSock);
+        ndProxyManager->ProcessUnicastNeighborSolicition();
     }
 }
 
-void NdProxyManager::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+void NdProxyManager::ProcessMulticastNeighborSolicition(void)
 {
-    OTBR_UNUSED_VARIABLE(aWriteFdSet);
-    OTBR_UNUSED_VARIABLE(aErrorFdSet);
+    uint8_t        packets[kMaxNsBatchSize][kMaxICMP6PacketSize];
+    unsigned char  cbufs[kMaxNsBatchSize][2 * CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(timespec))];
+    sockaddr_in6   sources[kMaxNsBatchSize];
+    struct iovec   iovecs[kMaxNsBatchSize];
+    struct mmsghdr messages[kMaxNsBatchSize];
+    otbrError      error  = OTBR_ERROR_NONE;
+    int            budget = kMaxNsPerProcess;
+
+    // Messages left over the budget are handled in the next mainloop iteration, as the socket stays readable.
+    while (budget > 0)
+    {
+        unsigned int count = static_cast<unsigned int>(std::min<int>(budget, kMaxNsBatchSize));
+        int          received;
 
-    VerifyOrExit(IsEnabled());
+        for (unsigned int i = 0; i < count; i++)
+        {
+            struct msghdr &msghdr = messages[i].msg_hdr;
+
+            iovecs[i].iov_len  = kMaxICMP6PacketSize;
+            iovecs[i].iov_base = packets[i];
+
+            memset(&messages[i], 0, sizeof(messages[i]));
+            msghdr.msg_name       = &sources[i];
+            msghdr.msg_namelen    = sizeof(sources[i]);
+            msghdr.msg_iov        = &iovecs[i];
+            msghdr.msg_iovlen     = 1;
+            msghdr.msg_control    = cbufs[i];
+            msghdr.msg_controllen = sizeof(cbufs[i]);
+        }
 
-    if (FD_ISSET(mIcmp6RawSock, &aReadFdSet))
-    {
-        ProcessMulticastNeighborSolicition();
+        received = recvmmsg(mIcmp6RawSock, messages, count, MSG_DONTWAIT, nullptr);
+
+        if (received <= 0)
+        {
+            VerifyOrExit(received == 0 || errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            ExitNow();
+        }
+
+        for (int i = 0; i < received; i++)
+        {
+            HandleMulticastNeighborSolicit(messages[i].msg_hdr, messages[i].msg_len);
+        }
+
+        budget -= received;
+        VerifyOrExit(static_cast<unsigned int>(received) == count);
     }
 
-    if (FD_ISSET(mUnicastNsQueueSock, &aReadFdSet))
+exit:
+    FlushNeighborAdvertisements();
+
+    if (error != OTBR_ERROR_NONE)
     {
-        ProcessUnicastNeighborSolicition();
+        otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
     }
-exit:
-    return;
 }
 
-void NdProxyManager::ProcessMulticastNeighborSolicition()
+void NdProxyManager::HandleMulticastNeighborSolicit(struct msghdr &aMessage, size_t aLength)
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
+    uint8_t *         packet = static_cast<uint8_t *>(aMessage.msg_iov[0].iov_base);
+    sockaddr_in6 &    sin6   = *static_cast<sockaddr_in6 *>(aMessage.msg_name);
     struct icmp6_hdr *icmp6header;
     struct cmsghdr *  cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
+    timespec          receiveTime;
     otbrError         error = OTBR_ERROR_NONE;
     bool              found = false;
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
-
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
-
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
+    // The time of receiving from the kernel is used when the packet isn't timestamped.
+    clock_gettime(CLOCK_REALTIME, &receiveTime);
 
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(aLength >= sizeof(struct nd_neighbor_solicit), error = OTBR_ERROR_PARSE);
 
     {
         Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
@@ -191,11 +283,18 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
+        NdProxyCounters::Get().mMulticastNsReceived++;
 
         otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+        for (cmsghdr = CMSG_FIRSTHDR(&aMessage); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMessage, cmsghdr))
         {
+            if (cmsghdr->cmsg_level == SOL_SOCKET && cmsghdr->cmsg_type == SCM_TIMESTAMPNS &&
+                cmsghdr->cmsg_len == CMSG_LEN(sizeof(timespec)))
+            {
+                memcpy(&receiveTime, CMSG_DATA(cmsghdr), sizeof(receiveTime));
+            }
+
             if (cmsghdr->cmsg_level != IPPROTO_IPV6)
             {
                 continue;
@@ -210,14 +309,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     Ip6Address &        dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
 
-                    for (const Ip6Address &ipaddr : mNdProxySet)
-                    {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
+                    found = mSolicitedNodeGroups.count(dst) > 0;
 
                     otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(),
                             ifindex, found ? "Y" : "N");
@@ -243,10 +335,14 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
             struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
             Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
 
+            // Other addresses may share the solicited-node multicast group of a DUA.
+            VerifyOrExit(mNdProxySet.count(target) > 0, error = OTBR_ERROR_NOT_FOUND);
+
             otbrLog(OTBR_LOG_INFO, "NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
                     src.ToString().c_str(), target.ToString().c_str());
 
-            SendNeighborAdvertisement(target, src);
+            NdProxyCounters::Get().mNsMatched++;
+            QueueNeighborAdvertisement(target, src, &receiveTime);
         }
     }
 
@@ -260,12 +356,22 @@ void NdProxyManager::ProcessUnicastNeighborSolicition(void)
     char      packet[kMaxICMP6PacketSize];
     ssize_t   len;
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    for (int budget = kMaxNsPerProcess; budget > 0; budget--)
+    {
+        len = recv(mUnicastNsQueueSock, packet, sizeof(packet), MSG_DONTWAIT);
 
-    error = OTBR_ERROR_NONE;
+        if (len < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            ExitNow();
+        }
+
+        VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    }
 
 exit:
+    FlushVerdicts();
+    FlushNeighborAdvertisements();
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
@@ -279,78 +385,531 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
         target = Ip6Address(aDua->mFields.m8);
     }
 
+    // DUAs are tracked while disabled, so that they are proxied at once when enabled again.
     switch (aEvent)
     {
     case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
     case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
     {
-        bool isNewInsert = mNdProxySet.insert(target).second;
+        // A device re-registering after sleep was found unique on the backbone moments ago, so its NA isn't queued
+        // behind the paced announcements.
+        bool recentlyUnique = (aEvent == OT_BACKBONE_ROUTER_NDPROXY_ADDED) && IsDadCached(target);
 
-        if (isNewInsert)
+        if (aEvent == OT_BACKBONE_ROUTER_NDPROXY_ADDED)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            NdProxyCounters &counters = NdProxyCounters::Get();
+
+            (recentlyUnique ? counters.mDadCacheHits : counters.mDadCacheMisses)++;
         }
 
-        SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        AddNdProxy(target);
+        mRestoredDuas.erase(target);
+        CacheDadOutcome(target);
+
+        if (IsEnabled() && recentlyUnique)
+        {
+            QueueNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress(), nullptr);
+            FlushNeighborAdvertisements();
+        }
+        else if (IsEnabled())
+        {
+            AnnounceNdProxy(target);
+        }
         break;
     }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        RemoveNdProxy(target);
+        mRestoredDuas.erase(target);
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
-        for (const Ip6Address &proxingTarget : mNdProxySet)
+        if (IsEnabled())
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            for (const auto &group : mSolicitedNodeGroups)
+            {
+                LeaveSolicitedNodeMulticastGroup(group.first);
+            }
+            ScheduleSocketFilterUpdate();
         }
+        mSolicitedNodeGroups.clear();
         mNdProxySet.clear();
+        mRestoredDuas.clear();
+        // The outcomes may be stale once the Backbone Router has left its partition.
+        mDadCache.clear();
+        mRestoreTimer.Stop();
+        mPendingAnnouncements.clear();
         break;
     }
+
+    UpdateMemoryStats();
+    ScheduleSaveNdProxyTable();
+}
+
+bool NdProxyManager::AddNdProxy(const Ip6Address &aDua)
+{
+    auto result      = mNdProxySet.insert(aDua);
+    bool isNewInsert = result.second;
+
+    // Only tables of a fixed capacity fill up.
+    if (result.first == mNdProxySet.end())
+    {
+        otbrLog(OTBR_LOG_WARNING, "NdProxyManager: %zu DUAs proxied already, %s is not", mNdProxySet.size(),
+                aDua.ToString().c_str());
+    }
+
+    if (isNewInsert)
+    {
+        Ip6Address group = aDua.ToSolicitedNodeMulticastAddress();
+
+        if (mSolicitedNodeGroups[group]++ == 0 && IsEnabled())
+        {
+            JoinSolicitedNodeMulticastGroup(group);
+            ScheduleSocketFilterUpdate();
+        }
+    }
+
+    return isNewInsert;
+}
+
+bool NdProxyManager::IsDadCached(const Ip6Address &aDua) const
+{
+    auto it = mDadCache.find(aDua);
+
+    return it != mDadCache.end() &&
+           Timer::Clock::now() - it->second < std::chrono::milliseconds(OTBR_ND_PROXY_DAD_CACHE_TTL);
+}
+
+void NdProxyManager::CacheDadOutcome(const Ip6Address &aDua)
+{
+    const Timer::Clock::duration kTtl = std::chrono::milliseconds(OTBR_ND_PROXY_DAD_CACHE_TTL);
+    Timer::Clock::time_point     now  = Timer::Clock::now();
+
+    VerifyOrExit(OTBR_ND_PROXY_DAD_CACHE_TTL > 0);
+
+    // Expired outcomes are ignored by lookups, and only dropped when the cache is full.
+    if (mDadCache.size() >= OTBR_ND_PROXY_MAX_DUAS && mDadCache.count(aDua) == 0)
+    {
+        for (auto it = mDadCache.begin(); it != mDadCache.end();)
+        {
+            it = (now - it->second >= kTtl) ? mDadCache.erase(it) : std::next(it);
+        }
+
+        if (mDadCache.size() >= OTBR_ND_PROXY_MAX_DUAS)
+        {
+            auto oldest = mDadCache.begin();
+
+            for (auto it = mDadCache.begin(); it != mDadCache.end(); ++it)
+            {
+                if (it->second < oldest->second)
+                {
+                    oldest = it;
+                }
+            }
+
+            mDadCache.erase(oldest);
+        }
+    }
+
+    mDadCache[aDua] = now;
+
+exit:
+    return;
+}
+
+void NdProxyManager::RemoveNdProxy(const Ip6Address &aDua)
+{
+    Ip6Address group;
+    auto       it = mSolicitedNodeGroups.end();
+
+    VerifyOrExit(mNdProxySet.erase(aDua) > 0);
+
+    group = aDua.ToSolicitedNodeMulticastAddress();
+    it    = mSolicitedNodeGroups.find(group);
+
+    // The group is left with its last DUA.
+    assert(it != mSolicitedNodeGroups.end());
+    if (--it->second == 0)
+    {
+        mSolicitedNodeGroups.erase(it);
+
+        if (IsEnabled())
+        {
+            LeaveSolicitedNodeMulticastGroup(group);
+            ScheduleSocketFilterUpdate();
+        }
+    }
+
+exit:
+    return;
 }
 
-void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+void NdProxyManager::RestoreNdProxyTable(void)
 {
-    uint8_t                    packet[kMaxICMP6PacketSize];
-    uint16_t                   len = 0;
-    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
-    struct nd_opt_hdr &        opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
+    const std::vector<uint8_t> *record = StateCache::Get().Find(StateCache::kRecordNdProxy);
+    Ip6Address                  dua;
+
+    VerifyOrExit(record != nullptr);
+
+    for (size_t offset = 0; offset + sizeof(dua.m8) <= record->size(); offset += sizeof(dua.m8))
+    {
+        memcpy(dua.m8, record->data() + offset, sizeof(dua.m8));
+
+        if (AddNdProxy(dua))
+        {
+            mRestoredDuas.insert(dua);
+        }
+    }
+
+    // The restored DUAs are proxied until OpenThread reports the live ones, the others are dropped then.
+    if (!mRestoredDuas.empty())
+    {
+        mRestoreTimer.Start(std::chrono::milliseconds(OTBR_ND_PROXY_RESTORE_TIMEOUT));
+    }
+
+    UpdateMemoryStats();
+
+exit:
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: restored %zu DUAs", mRestoredDuas.size());
+}
+
+std::vector<Ip6Address> NdProxyManager::GetNdProxies(void) const
+{
+    std::vector<Ip6Address> duas;
+
+    duas.reserve(mNdProxySet.size());
+    for (const Ip6Address &dua : mNdProxySet)
+    {
+        duas.push_back(dua);
+    }
+
+    return duas;
+}
+
+void NdProxyManager::AddPeerNdProxies(const std::vector<Ip6Address> &aDuas)
+{
+    size_t added = 0;
+
+    for (const Ip6Address &dua : aDuas)
+    {
+        if (AddNdProxy(dua))
+        {
+            mRestoredDuas.insert(dua);
+            added++;
+        }
+    }
+
+    VerifyOrExit(added > 0);
+
+    mRestoreTimer.Start(std::chrono::milliseconds(OTBR_ND_PROXY_RESTORE_TIMEOUT));
+    UpdateMemoryStats();
+    ScheduleSaveNdProxyTable();
+
+exit:
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: took over %zu of %zu DUAs of the previous Primary", added, aDuas.size());
+}
+
+void NdProxyManager::HandleRestoreTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<NdProxyManager *>(aContext)->HandleRestoreTimer();
+}
+
+void NdProxyManager::HandleRestoreTimer(void)
+{
+    size_t dropped = 0;
+
+    for (const Ip6Address &dua : mRestoredDuas)
+    {
+        otBackboneRouterNdProxyInfo info;
+
+        if (otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&dua), &info) !=
+            OT_ERROR_NONE)
+        {
+            RemoveNdProxy(dua);
+            dropped++;
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: dropped %zu of %zu restored DUAs", dropped, mRestoredDuas.size());
+    mRestoredDuas.clear();
+
+    UpdateMemoryStats();
+    ScheduleSaveNdProxyTable();
+}
+
+void NdProxyManager::SaveNdProxyTable(void) const
+{
+    std::vector<uint8_t> record;
+
+    record.reserve(std::min(mNdProxySet.size() * sizeof(Ip6Address), StateCache::kMaxRecordLength));
+
+    for (const Ip6Address &dua : mNdProxySet)
+    {
+        if (record.size() + sizeof(dua.m8) > StateCache::kMaxRecordLength)
+        {
+            break;
+        }
+
+        record.insert(record.end(), dua.m8, dua.m8 + sizeof(dua.m8));
+    }
+
+    StateCache::Get().Update(StateCache::kRecordNdProxy, std::move(record));
+}
+
+void NdProxyManager::ScheduleSaveNdProxyTable(void)
+{
+    mSavePending = true;
+
+    // The table is saved once for a burst of events.
+    if (!mUpdateTimer.IsRunning())
+    {
+        mUpdateTimer.Start(std::chrono::microseconds(0));
+    }
+}
+
+void NdProxyManager::SyncNdProxyTable(void)
+{
+    // OpenThread provides no iterator of its ND Proxy table, so the DUAs tracked while disabled are checked one by
+    // one, and those unknown to OpenThread are dropped.
+    for (auto it = mNdProxySet.begin(); it != mNdProxySet.end();)
+    {
+        otBackboneRouterNdProxyInfo info;
+
+        // The restored DUAs are kept until OpenThread reports them or the restore timer drops them.
+        if (mRestoredDuas.count(*it) > 0 ||
+            otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&*it),
+                                           &info) == OT_ERROR_NONE)
+        {
+            ++it;
+            continue;
+        }
+
+        {
+            auto group = mSolicitedNodeGroups.find(it->ToSolicitedNodeMulticastAddress());
+
+            assert(group != mSolicitedNodeGroups.end());
+            if (--group->second == 0)
+            {
+                mSolicitedNodeGroups.erase(group);
+            }
+        }
+
+        it = mNdProxySet.erase(it);
+    }
+
+    // The filter is rebuilt once for all groups instead of once per group.
+    for (const auto &group : mSolicitedNodeGroups)
+    {
+        JoinSolicitedNodeMulticastGroup(group.first);
+    }
+    UpdateSocketFilter();
+
+    // Neighbor caches of the backbone still point to the previous Primary BBR.
+    mPendingAnnouncements.assign(mNdProxySet.begin(), mNdProxySet.end());
+    if (!mPendingAnnouncements.empty())
+    {
+        mUpdateTimer.Start(std::chrono::microseconds(0));
+    }
+
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: synced %zu DUAs of %zu groups", mNdProxySet.size(),
+            mSolicitedNodeGroups.size());
+    UpdateMemoryStats();
+    ScheduleSaveNdProxyTable();
+}
+
+void NdProxyManager::UpdateMemoryStats(void) const
+{
+    size_t bytes = MemoryStats::HashTableSize(mNdProxySet) + MemoryStats::HashTableSize(mSolicitedNodeGroups) +
+                   MemoryStats::HashTableSize(mRestoredDuas) + MemoryStats::HashTableSize(mDadCache) +
+                   mPendingAnnouncements.size() * sizeof(Ip6Address);
+
+    MemoryStats::Get().Update(MemoryStats::kSubsystemNdProxy, bytes);
+}
+
+void NdProxyManager::AnnounceNdProxy(const Ip6Address &aDua)
+{
+    mPendingAnnouncements.push_back(aDua);
+
+    // Announcements of a burst of events are sent together in the next mainloop iteration.
+    if (!mUpdateTimer.IsRunning())
+    {
+        mUpdateTimer.Start(std::chrono::microseconds(0));
+    }
+}
+
+void NdProxyManager::ScheduleSocketFilterUpdate(void)
+{
+    mSocketFilterPending = true;
+
+    if (!mUpdateTimer.IsRunning())
+    {
+        mUpdateTimer.Start(std::chrono::microseconds(0));
+    }
+}
+
+void NdProxyManager::HandleUpdateTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<NdProxyManager *>(aContext)->HandleUpdateTimer();
+}
+
+void NdProxyManager::HandleUpdateTimer(void)
+{
+    if (mSocketFilterPending)
+    {
+        mSocketFilterPending = false;
+        UpdateSocketFilter();
+    }
+
+    if (mSavePending)
+    {
+        mSavePending = false;
+        SaveNdProxyTable();
+    }
+
+    // Unsolicited NAs are paced so that a large table doesn't flood the backbone.
+    for (int count = 0; count < kMaxNaBatchSize && !mPendingAnnouncements.empty(); mPendingAnnouncements.pop_front())
+    {
+        const Ip6Address &dua = mPendingAnnouncements.front();
+
+        // The DUA may be removed while waiting.
+        if (mNdProxySet.count(dua) > 0)
+        {
+            QueueNeighborAdvertisement(dua, Ip6Address::GetLinkLocalAllNodesMulticastAddress(), nullptr);
+            count++;
+        }
+    }
+
+    FlushNeighborAdvertisements();
+
+    if (!mPendingAnnouncements.empty())
+    {
+        mUpdateTimer.Start(std::chrono::milliseconds(kAnnounceInterval));
+    }
+}
+
+void NdProxyManager::QueueNeighborAdvertisement(const Ip6Address &aTarget,
+                                                const Ip6Address &aDst,
+                                                const timespec *  aReceiveTime)
+{
+    static_assert(kNaPacketSize == sizeof(struct nd_neighbor_advert) + 8, "kNaPacketSize is wrong");
+
+    NeighborAdvertisement *    advertisement;
+    uint8_t *                  packet;
+    struct nd_neighbor_advert *na;
+    struct nd_opt_hdr *        opt;
     bool                       isSolicited = !aDst.IsMulticast();
-    sockaddr_in6               dst;
-    otbrError                  error = OTBR_ERROR_NONE;
+    otbrError                  error       = OTBR_ERROR_NONE;
     otBackboneRouterNdProxyInfo aNdProxyInfo;
 
     VerifyOrExit(otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
                                                 &aNdProxyInfo) == OT_ERROR_NONE,
                  error = OTBR_ERROR_OPENTHREAD);
 
-    memset(packet, 0, sizeof(packet));
+    if (mNaQueueLength == kMaxNaBatchSize)
+    {
+        FlushNeighborAdvertisements();
+    }
+
+    advertisement = &mNaQueue[mNaQueueLength];
+    packet        = advertisement->mPacket;
+    na            = reinterpret_cast<struct nd_neighbor_advert *>(packet);
+    opt           = reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
+
+    memset(packet, 0, kNaPacketSize);
 
-    na.nd_na_type = ND_NEIGHBOR_ADVERT;
-    na.nd_na_code = 0;
+    na->nd_na_type = ND_NEIGHBOR_ADVERT;
+    na->nd_na_code = 0;
     // set Solicited
-    na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
+    na->nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
     // set Router
-    na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
+    na->nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
     // set Override
-    na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
+    na->nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
 
-    memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
-    len += sizeof(struct nd_neighbor_advert);
+    memcpy(&na->nd_na_target, aTarget.m8, sizeof(Ip6Address));
 
-    opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
-    opt.nd_opt_len  = 1;
+    opt->nd_opt_type = ND_OPT_TARGET_LINKADDR;
+    opt->nd_opt_len  = 1;
 
-    memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
+    memcpy(reinterpret_cast<uint8_t *>(opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
 
-    len += (opt.nd_opt_len * 8);
+    aDst.CopyTo(advertisement->mDst);
+    advertisement->mHasReceiveTime = (aReceiveTime != nullptr);
+    if (aReceiveTime != nullptr)
+    {
+        advertisement->mReceiveTime = *aReceiveTime;
+    }
+    mNaQueueLength++;
 
-    aDst.CopyTo(dst);
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        NdProxyCounters::Get().mNaFailed++;
+        otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    }
+}
 
-    VerifyOrExit(sendto(mIcmp6RawSock, packet, len, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) == len,
-                 error = OTBR_ERROR_ERRNO);
+void NdProxyManager::FlushNeighborAdvertisements(void)
+{
+    struct iovec     iovecs[kMaxNaBatchSize];
+    struct mmsghdr   messages[kMaxNaBatchSize];
+    unsigned int     sent     = 0;
+    otbrError        error    = OTBR_ERROR_NONE;
+    NdProxyCounters &counters = NdProxyCounters::Get();
+    timespec         now;
+
+    VerifyOrExit(mNaQueueLength > 0);
+
+    for (unsigned int i = 0; i < mNaQueueLength; i++)
+    {
+        iovecs[i].iov_base = mNaQueue[i].mPacket;
+        iovecs[i].iov_len  = kNaPacketSize;
+
+        memset(&messages[i], 0, sizeof(messages[i]));
+        messages[i].msg_hdr.msg_name    = &mNaQueue[i].mDst;
+        messages[i].msg_hdr.msg_namelen = sizeof(mNaQueue[i].mDst);
+        messages[i].msg_hdr.msg_iov     = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    while (sent < mNaQueueLength)
+    {
+        int ret = sendmmsg(mIcmp6RawSock, messages + sent, mNaQueueLength - sent, 0);
+
+        VerifyOrExit(ret > 0, error = OTBR_ERROR_ERRNO);
+        sent += static_cast<unsigned int>(ret);
+    }
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    if (mNaQueueLength > 0)
+    {
+        otbrLogResult(error, "NdProxyManager: sent %u of %u NA", sent, mNaQueueLength);
+
+        clock_gettime(CLOCK_REALTIME, &now);
+        for (unsigned int i = 0; i < sent; i++)
+        {
+            const timespec &receiveTime = mNaQueue[i].mReceiveTime;
+            int64_t         latency;
+
+            if (!mNaQueue[i].mHasReceiveTime)
+            {
+                continue;
+            }
+
+            latency = (static_cast<int64_t>(now.tv_sec) - receiveTime.tv_sec) * 1000000 +
+                      (now.tv_nsec - receiveTime.tv_nsec) / 1000;
+            // The realtime clock may step backwards.
+            counters.AddLatency(latency > 0 ? static_cast<uint64_t>(latency) : 0);
+        }
+
+        counters.mNaSent += sent;
+        counters.mNaFailed += mNaQueueLength - sent;
+    }
+
+    // Unsent advertisements are dropped, as a lost NA is repeated by its solicitation.
+    mNaQueueLength = 0;
 }
 
 otbrError NdProxyManager::UpdateMacAddress(void)
@@ -396,6 +955,8 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
                  error = OTBR_ERROR_ERRNO);
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &on, sizeof(on)) == 0,
                  error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) == 0,
+                 error = OTBR_ERROR_ERRNO);
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) == 0,
                  error = OTBR_ERROR_ERRNO);
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) == 0,
@@ -406,6 +967,10 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+    UpdateSocketFilter();
+
+    SuccessOrExit(error = EventPoller::Get().Register(mIcmp6RawSock, EventPoller::kEventReadable,
+                                                      &NdProxyManager::HandleEvent, this, EventPoller::kPriorityHigh));
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -415,10 +980,70 @@ exit:
     return error;
 }
 
+void NdProxyManager::UpdateSocketFilter(void)
+{
+    // A filter of an IPv6 raw socket starts at the ICMPv6 header. The solicited-node multicast group of a NS is
+    // given by the low 24 bits of its target, taken from the last word of the target.
+    static const uint32_t kTargetGroupOffset = offsetof(struct nd_neighbor_solicit, nd_ns_target) + 12;
+    static const uint32_t kGroupMask         = 0x00ffffff;
+    static const size_t   kMaxJump           = 255;
+
+    std::vector<struct sock_filter> program;
+    struct sock_fprog               fprog;
+    otbrError                       error     = OTBR_ERROR_NONE;
+    size_t                          remaining = mSolicitedNodeGroups.size();
+    auto                            group     = mSolicitedNodeGroups.begin();
+
+    VerifyOrExit(IsEnabled());
+
+    program.push_back(BPF_STMT(BPF_LD | BPF_B | BPF_ABS, offsetof(struct icmp6_hdr, icmp6_type)));
+    program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_SOLICIT, 1, 0));
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+    program.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kTargetGroupOffset));
+    program.push_back(BPF_STMT(BPF_ALU | BPF_AND | BPF_K, kGroupMask));
+
+    // Jumps are limited to 255 instructions, so the groups are compared in blocks each followed by an accept.
+    while (remaining > 0)
+    {
+        size_t count = std::min(remaining, kMaxJump);
+
+        for (size_t i = 0; i < count; ++i, ++group)
+        {
+            uint32_t value = ntohl(group->first.m32[3]) & kGroupMask;
+
+            program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, value, static_cast<uint8_t>(count - i), 0));
+        }
+
+        program.push_back(BPF_STMT(BPF_JMP | BPF_JA, 1));
+        program.push_back(BPF_STMT(BPF_RET | BPF_K, kMaxICMP6PacketSize));
+        remaining -= count;
+    }
+
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+
+    VerifyOrExit(program.size() <= BPF_MAXINSNS, error = OTBR_ERROR_INVALID_ARGS);
+
+    fprog.len    = static_cast<unsigned short>(program.size());
+    fprog.filter = program.data();
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        int dummy = 0;
+
+        // Too many groups for a filter, let all NS through to be matched in userspace.
+        setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_DETACH_FILTER, &dummy, sizeof(dummy));
+        otbrLogResult(error, "NdProxyManager: filter NS of %zu groups", mSolicitedNodeGroups.size());
+    }
+}
+
 void NdProxyManager::FiniIcmp6RawSocket(void)
 {
     if (mIcmp6RawSock != -1)
     {
+        EventPoller::Get().Unregister(mIcmp6RawSock);
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
     }
@@ -432,11 +1057,21 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_unbind_pf(mNfqHandler, AF_INET6) >= 0);
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
-    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
+    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, kUnicastNsQueueNum, HandleNetfilterQueue, this)) !=
+                 nullptr);
     VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
+    VerifyOrExit(nfq_set_queue_maxlen(mNfqQueueHandler, OTBR_ND_PROXY_QUEUE_LENGTH) >= 0);
+#if OTBR_ND_PROXY_QUEUE_FAIL_OPEN
+    // Kernels before 3.6 don't support it, unicast NS are then dropped when the queue is full.
+    if (nfq_set_queue_flags(mNfqQueueHandler, NFQA_CFG_F_FAIL_OPEN, NFQA_CFG_F_FAIL_OPEN) < 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "NdProxyManager: failed to make the netfilter queue fail open");
+    }
+#endif
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
-    error = OTBR_ERROR_NONE;
+    SuccessOrExit(error = EventPoller::Get().Register(mUnicastNsQueueSock, EventPoller::kEventReadable,
+                                                      &NdProxyManager::HandleEvent, this, EventPoller::kPriorityHigh));
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
@@ -451,8 +1086,11 @@ exit:
 
 void NdProxyManager::FiniNetfilterQueue(void)
 {
+    mPendingVerdictCount = 0;
+
     if (mUnicastNsQueueSock != -1)
     {
+        EventPoller::Get().Unregister(mUnicastNsQueueSock);
         close(mUnicastNsQueueSock);
         mUnicastNsQueueSock = -1;
     }
@@ -482,19 +1120,21 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                          struct nfgenmsg *    aNfMsg,
                                          struct nfq_data *    aNfData)
 {
+    OTBR_UNUSED_VARIABLE(aNfQueueHandler);
     OTBR_UNUSED_VARIABLE(aNfMsg);
 
     struct nfqnl_msg_packet_hdr *ph;
     unsigned char *              data;
     uint32_t                     id      = 0;
-    int                          ret     = 0;
     int                          len     = 0;
-    int                          verdict = NF_ACCEPT;
+    uint32_t                     verdict = NF_ACCEPT;
 
     Ip6Address        dst;
     Ip6Address        src;
     struct icmp6_hdr *icmp6header = nullptr;
     struct ip6_hdr *  ip6header   = nullptr;
+    struct timeval    timestamp;
+    timespec          receiveTime;
     otbrError         error       = OTBR_ERROR_NONE;
 
     if ((ph = nfq_get_msg_packet_hdr(aNfData)) != nullptr)
@@ -516,6 +1156,7 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    NdProxyCounters::Get().mUnicastNsReceived++;
 
     VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
 
@@ -526,49 +1167,91 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
         otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
                 ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
-        SendNeighborAdvertisement(target, src);
+
+        // The time of receiving from the netfilter queue is used when the kernel doesn't timestamp the packet.
+        if (nfq_get_timestamp(aNfData, &timestamp) == 0)
+        {
+            receiveTime.tv_sec  = timestamp.tv_sec;
+            receiveTime.tv_nsec = timestamp.tv_usec * 1000;
+        }
+        else
+        {
+            clock_gettime(CLOCK_REALTIME, &receiveTime);
+        }
+
+        NdProxyCounters::Get().mNsMatched++;
+        QueueNeighborAdvertisement(target, src, &receiveTime);
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    QueueVerdict(id, verdict);
 
-    otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
-                  verdict);
+    otbrLogResult(error, "NdProxyManager: %s (id %u verdict %u)", __FUNCTION__, id, verdict);
 
-    return ret;
+    return 0;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::QueueVerdict(uint32_t aPacketId, uint32_t aVerdict)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    // Packet ids of a queue increase, so a batch verdict covers consecutive packets with the same verdict.
+    if (mPendingVerdictCount > 0 && mPendingVerdict != aVerdict)
+    {
+        FlushVerdicts();
+    }
+
+    mPendingVerdict  = aVerdict;
+    mPendingPacketId = aPacketId;
+    mPendingVerdictCount++;
+}
+
+void NdProxyManager::FlushVerdicts(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mPendingVerdictCount > 0);
+
+    VerifyOrExit(nfq_set_verdict_batch(mNfqQueueHandler, mPendingPacketId, mPendingVerdict) >= 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (mPendingVerdictCount > 0)
+    {
+        otbrLogResult(error, "NdProxyManager: verdict %u for %u packets up to id %u", mPendingVerdict,
+                      mPendingVerdictCount, mPendingPacketId);
+    }
+
+    mPendingVerdictCount = 0;
+}
+
+void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const
+{
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
+    NdProxyCounters::Get().mGroupJoins++;
 exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup %s", aGroup.ToString().c_str());
 }
 
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
+    NdProxyCounters::Get().mGroupLeaves++;
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup %s", aGroup.ToString().c_str());
 }
 
 } // namespace BackboneRouter
@@ -38,17 +38,66 @@
 #define __APPLE_USE_RFC_3542
 #endif
 
+#include <deque>
 #include <inttypes.h>
 #include <libnetfilter_queue/libnetfilter_queue.h>
-#include <map>
 #include <netinet/in.h>
-#include <set>
 #include <string>
+#include <time.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <openthread/backbone_router_ftd.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "common/fixed_containers.hpp"
+#include "common/timer.hpp"
 #include "common/types.hpp"
+#include "utils/nft_rule_manager.hpp"
+
+/**
+ * The maximum number of unicast NS waiting in the kernel netfilter queue for a verdict.
+ *
+ */
+#ifndef OTBR_ND_PROXY_QUEUE_LENGTH
+#define OTBR_ND_PROXY_QUEUE_LENGTH 1024
+#endif
+
+/**
+ * Whether unicast NS are accepted by the kernel instead of dropped, when the netfilter queue is full or otbr-agent
+ * is not listening to it.
+ *
+ */
+#ifndef OTBR_ND_PROXY_QUEUE_FAIL_OPEN
+#define OTBR_ND_PROXY_QUEUE_FAIL_OPEN 1
+#endif
+
+/**
+ * The time in milliseconds the DUAs restored from the state cache are proxied, they are dropped then unless
+ * OpenThread has them again.
+ *
+ */
+#ifndef OTBR_ND_PROXY_RESTORE_TIMEOUT
+#define OTBR_ND_PROXY_RESTORE_TIMEOUT 30000
+#endif
+
+/**
+ * The maximum number of DUAs proxied, when built with containers of a fixed capacity.
+ *
+ */
+#ifndef OTBR_ND_PROXY_MAX_DUAS
+#define OTBR_ND_PROXY_MAX_DUAS 1024
+#endif
+
+/**
+ * The time in milliseconds a DUA reported by OpenThread is remembered as unique on the backbone after it is removed,
+ * so that it is announced at once when registered again. Zero disables the cache.
+ *
+ */
+#ifndef OTBR_ND_PROXY_DAD_CACHE_TTL
+#define OTBR_ND_PROXY_DAD_CACHE_TTL 300000
+#endif
 
 namespace otbr {
 namespace BackboneRouter {
@@ -79,11 +128,25 @@ public:
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mNaQueueLength(0)
+        , mPendingVerdictCount(0)
+        , mUpdateTimer(HandleUpdateTimer, this)
+        , mRestoreTimer(HandleRestoreTimer, this)
+        , mSocketFilterPending(false)
+        , mSavePending(false)
+        , mUnicastNsByIp6tables(false)
     {
     }
 
     /**
-     * This method initializes a ND Proxy manager instance.
+     * This destructor disables the ND Proxy manager, removing its netfilter rules on shutdown.
+     *
+     */
+    ~NdProxyManager(void) { Disable(); }
+
+    /**
+     * This method initializes a ND Proxy manager instance, restoring the DUAs proxied before otbr-agent restarted
+     * from the state cache.
      *
      */
     void Init(void);
@@ -103,73 +166,118 @@ public:
     void Disable(void);
 
     /**
-     * This method updates the fd_set and timeout for mainloop.
+     * This method handles a Backbone Router ND Proxy event.
      *
-     * @param[inout]    aReadFdSet      A reference to fd_set for polling read.
-     * @param[inout]    aWriteFdSet     A reference to fd_set for polling read.
-     * @param[inout]    aErrorFdSet     A reference to fd_set for polling error.
-     * @param[inout]    aMaxFd          A reference to the current max fd in @p aReadFdSet and @p aWriteFdSet.
-     * @param[inout]    aTimeout        A reference to the timeout.
+     * @param[in] aEvent    The Backbone Router ND Proxy event type.
+     * @param[in] aDua      The Domain Unicast Address of the ND Proxy, or `nullptr` if @p `aEvent` is
+     *                      `OT_BACKBONE_ROUTER_NDPROXY_CLEARED`.
      *
      */
-    void UpdateFdSet(fd_set & aReadFdSet,
-                     fd_set & aWriteFdSet,
-                     fd_set & aErrorFdSet,
-                     int &    aMaxFd,
-                     timeval &aTimeout) const;
+    void HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua);
 
     /**
-     * This method performs border agent processing.
+     * This method returns if the ND Proxy manager is enabled.
      *
-     * @param[in]   aReadFdSet   A reference to read file descriptors.
-     * @param[in]   aWriteFdSet  A reference to write file descriptors.
-     * @param[in]   aErrorFdSet  A reference to error file descriptors.
+     * @returns  If the ND Proxy manager is enabled;
      *
      */
-    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
+    bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
 
     /**
-     * This method handles a Backbone Router ND Proxy event.
+     * This method returns the DUAs proxied.
      *
-     * @param[in] aEvent    The Backbone Router ND Proxy event type.
-     * @param[in] aDua      The Domain Unicast Address of the ND Proxy, or `nullptr` if @p `aEvent` is
-     *                      `OT_BACKBONE_ROUTER_NDPROXY_CLEARED`.
+     * @returns The DUAs proxied.
      *
      */
-    void HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua);
+    std::vector<Ip6Address> GetNdProxies(void) const;
 
     /**
-     * This method returns if the ND Proxy manager is enabled.
+     * This method proxies the DUAs of the previous Primary Backbone Router, until OpenThread reports them or the
+     * restore timeout drops them, like the DUAs restored from the state cache.
      *
-     * @returns  If the ND Proxy manager is enabled;
+     * @param[in] aDuas  The DUAs of the previous Primary Backbone Router.
      *
      */
-    bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
+    void AddPeerNdProxies(const std::vector<Ip6Address> &aDuas);
 
 private:
     enum
     {
         kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kNaPacketSize       = 32,   ///< Size of a NA with the Target Link-Layer Address option in bytes.
+        kMaxNsBatchSize     = 16,   ///< Max number of NS received by one system call.
+        kMaxNaBatchSize     = 16,   ///< Max number of NA sent by one system call.
+        kMaxNsPerProcess    = 64,   ///< Max number of NS handled per mainloop iteration, to keep the mainloop fair.
+        kAnnounceInterval   = 10,   ///< Interval (in milliseconds) between batches of unsolicited NA.
+        kUnicastNsQueueNum  = 88,   ///< Number of the netfilter queue of unicast NS.
+    };
+
+    struct NeighborAdvertisement
+    {
+        sockaddr_in6 mDst;
+        uint8_t      mPacket[kNaPacketSize];
+        timespec     mReceiveTime;    ///< Time the solicitation was received, in CLOCK_REALTIME.
+        bool         mHasReceiveTime; ///< Whether the advertisement is solicited and its latency is recorded.
     };
 
-    void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    bool       AddNdProxy(const Ip6Address &aDua);
+    void       RemoveNdProxy(const Ip6Address &aDua);
+    void       RestoreNdProxyTable(void);
+    void       SaveNdProxyTable(void) const;
+    void       ScheduleSaveNdProxyTable(void);
+    void       SyncNdProxyTable(void);
+    void       AnnounceNdProxy(const Ip6Address &aDua);
+    bool       IsDadCached(const Ip6Address &aDua) const;
+    void       CacheDadOutcome(const Ip6Address &aDua);
+    void       ScheduleSocketFilterUpdate(void);
+    void       UpdateMemoryStats(void) const;
+    void       QueueNeighborAdvertisement(const Ip6Address &aTarget,
+                                          const Ip6Address &aDst,
+                                          const timespec *  aReceiveTime);
+    void       FlushNeighborAdvertisements(void);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
+    void       UpdateSocketFilter(void);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
+    otbrError  AddUnicastNsRule(void);
+    otbrError  RemoveUnicastNsRule(void);
     void       FiniNetfilterQueue(void);
+    void       QueueVerdict(uint32_t aPacketId, uint32_t aVerdict);
+    void       FlushVerdicts(void);
     void       ProcessMulticastNeighborSolicition(void);
+    void       HandleMulticastNeighborSolicit(struct msghdr &aMessage, size_t aLength);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const;
+    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const;
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg *    aNfMsg,
                                     struct nfq_data *    aNfData,
                                     void *               aContext);
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
+    static void HandleEvent(void *aContext, int aFd, uint32_t aEvents);
+    static void HandleUpdateTimer(Timer &aTimer, void *aContext);
+    void        HandleUpdateTimer(void);
+    static void HandleRestoreTimer(Timer &aTimer, void *aContext);
+    void        HandleRestoreTimer(void);
+
+#if OTBR_ENABLE_FIXED_CONTAINERS
+    typedef FixedHashSet<Ip6Address, OTBR_ND_PROXY_MAX_DUAS, Ip6AddressHash>                           DuaSet;
+    typedef FixedHashMap<Ip6Address, uint32_t, OTBR_ND_PROXY_MAX_DUAS, Ip6AddressHash>                 GroupMap;
+    typedef FixedDeque<Ip6Address, OTBR_ND_PROXY_MAX_DUAS>                                             DuaQueue;
+    typedef FixedHashMap<Ip6Address, Timer::Clock::time_point, OTBR_ND_PROXY_MAX_DUAS, Ip6AddressHash> DadCache;
+#else
+    typedef std::unordered_set<Ip6Address, Ip6AddressHash>                           DuaSet;
+    typedef std::unordered_map<Ip6Address, uint32_t, Ip6AddressHash>                 GroupMap;
+    typedef std::deque<Ip6Address>                                                   DuaQueue;
+    typedef std::unordered_map<Ip6Address, Timer::Clock::time_point, Ip6AddressHash> DadCache;
+#endif
 
     otbr::Ncp::ControllerOpenThread &mNcp;
-    std::set<Ip6Address>             mNdProxySet;
+    DuaSet                           mNdProxySet;
+    DuaSet                           mRestoredDuas;        ///< DUAs not reported yet.
+    GroupMap                         mSolicitedNodeGroups; ///< DUAs in each joined group.
+    DadCache                         mDadCache;            ///< Time each DUA was last known unique.
     uint32_t                         mBackboneIfIndex;
     int                              mIcmp6RawSock;
     int                              mUnicastNsQueueSock;
@@ -177,6 +285,19 @@ private:
     struct nfq_q_handle *            mNfqQueueHandler; ///< A pointer to a newly created queue.
     MacAddress                       mMacAddress;
     Ip6Prefix                        mDomainPrefix;
+    NeighborAdvertisement            mNaQueue[kMaxNaBatchSize]; ///< NAs to be sent together.
+    uint8_t                          mNaQueueLength;
+    uint32_t                         mPendingVerdict;       ///< Verdict of the pending packets.
+    uint32_t                         mPendingPacketId;      ///< Last id of the pending packets.
+    uint32_t                         mPendingVerdictCount;  ///< Number of pending packets.
+    Timer                            mUpdateTimer;          ///< Paces unsolicited NA.
+    DuaQueue                         mPendingAnnouncements; ///< DUAs to be announced.
+    Timer                            mRestoreTimer;         ///< Drops the restored DUAs.
+    bool                             mSocketFilterPending;  ///< Whether to update the filter.
+    bool                             mSavePending;          ///< Whether to save the DUAs.
+    Utils::NftRuleManager            mNftRules;             ///< Installs the unicast NS rule.
+    std::string                      mUnicastNsChain;       ///< Chain of the unicast NS rule.
+    bool                             mUnicastNsByIp6tables; ///< Whether ip6tables added it.
 };
 
 /**
@@ -0,0 +1,76 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the counters of the ND Proxy.
+ */
+
+#include "backbone_router/nd_proxy_counters.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+const uint64_t NdProxyCounters::kLatencyBucketBounds[kNumLatencyBuckets] = {50,   100,  250,   500,   1000,
+                                                                            2500, 5000, 10000, 50000, 100000};
+
+NdProxyCounters::NdProxyCounters(void)
+    : mMulticastNsReceived("otbr_ndproxy_ns_received_total",
+                           "Neighbor Solicitations received, by destination.",
+                           "dst=\"multicast\"")
+    , mUnicastNsReceived("otbr_ndproxy_ns_received_total",
+                         "Neighbor Solicitations received, by destination.",
+                         "dst=\"unicast\"")
+    , mNsMatched("otbr_ndproxy_ns_matched_total", "Neighbor Solicitations of a proxied DUA.")
+    , mNaSent("otbr_ndproxy_na_sent_total", "Neighbor Advertisements sent.")
+    , mNaFailed("otbr_ndproxy_na_failed_total", "Neighbor Advertisements failed to be sent.")
+    , mGroupJoins("otbr_ndproxy_group_joins_total", "Solicited-node multicast groups joined.")
+    , mGroupLeaves("otbr_ndproxy_group_leaves_total", "Solicited-node multicast groups left.")
+    , mDadCacheHits("otbr_ndproxy_dad_cache_lookups_total",
+                    "DUAs added, by whether they were recently known unique.",
+                    "result=\"hit\"")
+    , mDadCacheMisses("otbr_ndproxy_dad_cache_lookups_total",
+                      "DUAs added, by whether they were recently known unique.",
+                      "result=\"miss\"")
+    , mNaLatency("otbr_ndproxy_na_latency_seconds",
+                 "Time from receiving a Neighbor Solicitation to sending its Neighbor Advertisement.",
+                 kLatencyBucketBounds,
+                 kNumLatencyBuckets,
+                 MetricsRegistry::kUnitMicroseconds)
+{
+}
+
+NdProxyCounters &NdProxyCounters::Get(void)
+{
+    static NdProxyCounters sCounters;
+
+    return sCounters;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
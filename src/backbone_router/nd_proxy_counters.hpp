@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the counters of the ND Proxy.
+ */
+
+#ifndef ND_PROXY_COUNTERS_HPP_
+#define ND_PROXY_COUNTERS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/metrics_registry.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-bbr
+ *
+ * @{
+ */
+
+/**
+ * This class counts the Neighbor Solicitations (NS) handled by the ND Proxy, and the latency of answering them with
+ * Neighbor Advertisements (NA).
+ *
+ * The counters are process-wide, so that the D-Bus and REST servers read them without a ND Proxy manager. They are
+ * registered to the metrics registry.
+ *
+ */
+class NdProxyCounters
+{
+public:
+    static const size_t kNumLatencyBuckets = 10;
+
+    static const uint64_t kLatencyBucketBounds[kNumLatencyBuckets]; ///< Upper bounds (in microseconds) of buckets.
+
+    typedef MetricsRegistry::Counter   Counter;
+    typedef MetricsRegistry::Histogram Histogram;
+
+    Counter   mMulticastNsReceived; ///< Number of multicast NS received.
+    Counter   mUnicastNsReceived;   ///< Number of unicast NS received from the netfilter queue.
+    Counter   mNsMatched;           ///< Number of NS of a proxied DUA, each answered with a NA.
+    Counter   mNaSent;              ///< Number of NA sent, both solicited and unsolicited.
+    Counter   mNaFailed;            ///< Number of NA failed to be sent.
+    Counter   mGroupJoins;          ///< Number of solicited-node multicast groups joined.
+    Counter   mGroupLeaves;         ///< Number of solicited-node multicast groups left.
+    Counter   mDadCacheHits;        ///< Number of DUAs added again while known unique.
+    Counter   mDadCacheMisses;      ///< Number of DUAs added without a recent outcome.
+    Histogram mNaLatency;           ///< Latencies (in microseconds) of the solicited NA.
+
+    /**
+     * This method returns the singleton counters.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    static NdProxyCounters &Get(void);
+
+    /**
+     * This method records the latency of a solicited NA.
+     *
+     * @param[in]   aLatency    The time (in microseconds) from receiving a NS to sending its NA.
+     *
+     */
+    void AddLatency(uint64_t aLatency) { mNaLatency.Add(aLatency); }
+
+private:
+    NdProxyCounters(void);
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // ND_PROXY_COUNTERS_HPP_
@@ -0,0 +1,378 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the state synchronization between the Primary and Secondary Backbone Routers.
+ */
+
+#include "backbone_router/peer_sync.hpp"
+
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iterator>
+
+#include "agent/instance_params.hpp"
+#include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+PeerSync::PeerSync(NdProxyManager &aNdProxyManager, MulticastRoutingManager &aMulticastRoutingManager)
+    : mNdProxyManager(aNdProxyManager)
+    , mMulticastRoutingManager(aMulticastRoutingManager)
+    , mSocket(-1)
+    , mBackboneIfIndex(0)
+    , mIsPrimary(false)
+    , mPrimaryServer16(PeerSyncCodec::kInvalidRloc16)
+    , mSendTimer(HandleSendTimer, this)
+{
+}
+
+PeerSync::~PeerSync(void)
+{
+    FiniSocket();
+}
+
+void PeerSync::Init(void)
+{
+    otbrError error = InitSocket();
+
+    otbrLogResult(error, "PeerSync: %s on port %d", __FUNCTION__, OTBR_BACKBONE_PEER_SYNC_PORT);
+}
+
+otbrError PeerSync::InitSocket(void)
+{
+    const char *     backboneIfName = InstanceParams::Get().GetBackboneIfName();
+    otbrError        error          = OTBR_ERROR_ERRNO;
+    int              on             = 1;
+    int              off            = 0;
+    int              hops           = 255;
+    struct ipv6_mreq mreq;
+    sockaddr_in6     sin6;
+
+    SuccessOrExit(error = Ip6Address::FromString(OTBR_BACKBONE_PEER_SYNC_GROUP, mGroup));
+    error = OTBR_ERROR_ERRNO;
+
+    mBackboneIfIndex = if_nametoindex(backboneIfName);
+    VerifyOrExit(mBackboneIfIndex > 0);
+
+    mSocket = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+    VerifyOrExit(mSocket >= 0);
+
+    VerifyOrExit(setsockopt(mSocket, SOL_SOCKET, SO_BINDTODEVICE, backboneIfName, strlen(backboneIfName)) == 0);
+    VerifyOrExit(setsockopt(mSocket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &on, sizeof(on)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_MULTICAST_IF, &mBackboneIfIndex, sizeof(mBackboneIfIndex)) ==
+                 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) == 0);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &off, sizeof(off)) == 0);
+
+    memset(&sin6, 0, sizeof(sin6));
+    sin6.sin6_family = AF_INET6;
+    sin6.sin6_addr   = in6addr_any;
+    sin6.sin6_port   = htons(OTBR_BACKBONE_PEER_SYNC_PORT);
+    VerifyOrExit(bind(mSocket, reinterpret_cast<const sockaddr *>(&sin6), sizeof(sin6)) == 0);
+
+    mGroup.CopyTo(mreq.ipv6mr_multiaddr);
+    mreq.ipv6mr_interface = mBackboneIfIndex;
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0);
+
+    SuccessOrExit(error = EventPoller::Get().Register(mSocket, EventPoller::kEventReadable, &PeerSync::HandleEvent,
+                                                      this, EventPoller::kPriorityLow));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        FiniSocket();
+    }
+
+    return error;
+}
+
+void PeerSync::FiniSocket(void)
+{
+    if (mSocket != -1)
+    {
+        EventPoller::Get().Unregister(mSocket);
+        close(mSocket);
+        mSocket = -1;
+    }
+}
+
+void PeerSync::SetPrimary(bool aIsPrimary)
+{
+    VerifyOrExit(mIsPrimary != aIsPrimary);
+
+    mIsPrimary = aIsPrimary;
+
+    if (mIsPrimary)
+    {
+        // The state was taken over, and the Secondaries learn the new one from now on.
+        mPeerDuas.clear();
+        mPeerListeners.clear();
+        mSendTimer.Start(std::chrono::microseconds(0));
+    }
+    else
+    {
+        mSendTimer.Stop();
+    }
+
+exit:
+    return;
+}
+
+void PeerSync::ScheduleUpdate(void)
+{
+    Timer::Clock::time_point updateTime = Timer::Clock::now() + std::chrono::milliseconds(kUpdateDelay);
+
+    VerifyOrExit(mIsPrimary);
+
+    if (!mSendTimer.IsRunning() || mSendTimer.GetFireTime() > updateTime)
+    {
+        mSendTimer.StartAt(updateTime);
+    }
+
+exit:
+    return;
+}
+
+void PeerSync::HandleSendTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<PeerSync *>(aContext)->SendState();
+}
+
+void PeerSync::SendState(void)
+{
+    VerifyOrExit(mIsPrimary);
+
+    // The whole state is sent every interval, so that a lost message or a restarted Secondary is caught up with.
+    SendTable(PeerSyncCodec::kTypeDuas, mNdProxyManager.GetNdProxies());
+    SendTable(PeerSyncCodec::kTypeListeners, mMulticastRoutingManager.GetListeners());
+
+    mSendTimer.Start(std::chrono::milliseconds(OTBR_BACKBONE_PEER_SYNC_INTERVAL));
+
+exit:
+    return;
+}
+
+void PeerSync::SendTable(uint8_t aType, const std::vector<Ip6Address> &aAddresses)
+{
+    uint8_t      buffer[PeerSyncCodec::kMaxLength];
+    sockaddr_in6 dst;
+    otbrError    error  = OTBR_ERROR_NONE;
+    size_t       offset = 0;
+
+    VerifyOrExit(mSocket >= 0);
+
+    memset(&dst, 0, sizeof(dst));
+    mGroup.CopyTo(dst);
+    dst.sin6_port     = htons(OTBR_BACKBONE_PEER_SYNC_PORT);
+    dst.sin6_scope_id = mBackboneIfIndex;
+
+    // An empty table is sent as well, so that nothing is left to be taken over.
+    do
+    {
+        size_t count = std::min<size_t>(aAddresses.size() - offset, PeerSyncCodec::kMaxEntries);
+        size_t length;
+
+        SuccessOrExit(error =
+                          mCodec.Encode(aType, mPrimaryServer16, aAddresses.data() + offset, count, buffer, length));
+        VerifyOrExit(sendto(mSocket, buffer, length, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) ==
+                         static_cast<ssize_t>(length),
+                     error = OTBR_ERROR_ERRNO);
+        offset += count;
+    } while (offset < aAddresses.size());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogResult(error, "PeerSync: send %zu addresses of type %u", aAddresses.size(), aType);
+    }
+}
+
+void PeerSync::HandleEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+
+    static_cast<PeerSync *>(aContext)->ProcessMessages();
+}
+
+void PeerSync::ProcessMessages(void)
+{
+    uint8_t       buffer[PeerSyncCodec::kMaxLength];
+    unsigned char cbuf[CMSG_SPACE(sizeof(int))];
+
+    for (int budget = kMaxMessagesPerProcess; budget > 0; budget--)
+    {
+        struct iovec    iov;
+        struct msghdr   msg;
+        struct cmsghdr *cmsg;
+        sockaddr_in6    src;
+        ssize_t         length;
+        int             hops = 0;
+
+        iov.iov_base = buffer;
+        iov.iov_len  = sizeof(buffer);
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name       = &src;
+        msg.msg_namelen    = sizeof(src);
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = cbuf;
+        msg.msg_controllen = sizeof(cbuf);
+
+        length = recvmsg(mSocket, &msg, MSG_DONTWAIT);
+        if (length < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogResult(OTBR_ERROR_ERRNO, "PeerSync: %s", __FUNCTION__);
+            }
+            break;
+        }
+
+        for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_HOPLIMIT &&
+                cmsg->cmsg_len == CMSG_LEN(sizeof(int)))
+            {
+                memcpy(&hops, CMSG_DATA(cmsg), sizeof(hops));
+            }
+        }
+
+        // Like ND, only messages of on-link senders are trusted.
+        if (hops != 255)
+        {
+            otbrLog(OTBR_LOG_WARNING, "PeerSync: ignored a message with hop limit %d", hops);
+            continue;
+        }
+
+        HandleMessage(buffer, static_cast<size_t>(length));
+    }
+}
+
+void PeerSync::HandleMessage(const uint8_t *aBuffer, size_t aLength)
+{
+    Timer::Clock::time_point now = Timer::Clock::now();
+    std::vector<Ip6Address>  addresses;
+    PeerTable *              table;
+    uint8_t                  type;
+    otbrError                error = OTBR_ERROR_NONE;
+
+    // Another Primary is a transient conflict which OpenThread resolves.
+    VerifyOrExit(!mIsPrimary);
+
+    SuccessOrExit(error = mCodec.Decode(aBuffer, aLength, mPrimaryServer16, type, addresses));
+    table = (type == PeerSyncCodec::kTypeDuas ? &mPeerDuas : &mPeerListeners);
+
+    Expire(*table, now);
+
+    for (const Ip6Address &address : addresses)
+    {
+        Refresh(*table, address, now);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogResult(error, "PeerSync: %s", __FUNCTION__);
+    }
+}
+
+void PeerSync::Refresh(PeerTable &aTable, const Ip6Address &aAddress, Timer::Clock::time_point aNow)
+{
+    // Addresses over the capacity are left to OpenThread after failover.
+    if (aTable.count(aAddress) > 0 || aTable.size() < OTBR_ND_PROXY_MAX_DUAS)
+    {
+        aTable[aAddress] = aNow;
+    }
+}
+
+void PeerSync::Expire(PeerTable &aTable, Timer::Clock::time_point aNow)
+{
+    for (auto it = aTable.begin(); it != aTable.end();)
+    {
+        it = IsFresh(*it, aNow) ? std::next(it) : aTable.erase(it);
+    }
+}
+
+bool PeerSync::IsFresh(const PeerTable::value_type &aEntry, Timer::Clock::time_point aNow)
+{
+    return aNow - aEntry.second < std::chrono::milliseconds(3 * OTBR_BACKBONE_PEER_SYNC_INTERVAL);
+}
+
+std::vector<Ip6Address> PeerSync::GetPeerDuas(const Ip6Prefix &aDomainPrefix) const
+{
+    Timer::Clock::time_point now = Timer::Clock::now();
+    std::vector<Ip6Address>  duas;
+
+    VerifyOrExit(aDomainPrefix.IsValid());
+
+    for (const auto &entry : mPeerDuas)
+    {
+        if (aDomainPrefix.ContainsAddress(entry.first) && IsFresh(entry, now))
+        {
+            duas.push_back(entry.first);
+        }
+    }
+
+exit:
+    return duas;
+}
+
+std::vector<Ip6Address> PeerSync::GetPeerListeners(void) const
+{
+    Timer::Clock::time_point now = Timer::Clock::now();
+    std::vector<Ip6Address>  listeners;
+
+    for (const auto &entry : mPeerListeners)
+    {
+        if (IsFresh(entry, now))
+        {
+            listeners.push_back(entry.first);
+        }
+    }
+
+    return listeners;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the state synchronization between the Primary and Secondary Backbone Routers.
+ */
+
+#ifndef BACKBONE_ROUTER_PEER_SYNC_HPP_
+#define BACKBONE_ROUTER_PEER_SYNC_HPP_
+
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "backbone_router/multicast_routing.hpp"
+#include "backbone_router/nd_proxy.hpp"
+#include "backbone_router/peer_sync_codec.hpp"
+#include "common/fixed_containers.hpp"
+#include "common/timer.hpp"
+#include "common/types.hpp"
+
+/**
+ * The link-local multicast group on the backbone the state of the Primary Backbone Router is sent to.
+ *
+ */
+#ifndef OTBR_BACKBONE_PEER_SYNC_GROUP
+#define OTBR_BACKBONE_PEER_SYNC_GROUP "ff02::6f74:6272"
+#endif
+
+/**
+ * The UDP port of the state synchronization.
+ *
+ */
+#ifndef OTBR_BACKBONE_PEER_SYNC_PORT
+#define OTBR_BACKBONE_PEER_SYNC_PORT 49191
+#endif
+
+/**
+ * The interval in milliseconds the Primary Backbone Router sends its whole state at, the Secondary Backbone Routers
+ * forget the entries not received for three intervals.
+ *
+ */
+#ifndef OTBR_BACKBONE_PEER_SYNC_INTERVAL
+#define OTBR_BACKBONE_PEER_SYNC_INTERVAL 5000
+#endif
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-backbone
+ *
+ * @{
+ */
+
+/**
+ * This class replicates the DUAs of the ND Proxy and the multicast listeners of the Primary Backbone Router to the
+ * Secondary Backbone Routers on the backbone link.
+ *
+ * OpenThread of a Secondary Backbone Router has neither, until the devices register again with it once it becomes
+ * Primary, so the replicated state is proxied and routed in the meantime.
+ *
+ * The messages are authenticated with the network key, and only the state of the current Primary is accepted.
+ *
+ */
+class PeerSync
+{
+public:
+    /**
+     * This constructor initializes a PeerSync instance.
+     *
+     * @param[in] aNdProxyManager           The ND Proxy manager whose DUAs are replicated.
+     * @param[in] aMulticastRoutingManager  The multicast routing manager whose listeners are replicated.
+     *
+     */
+    PeerSync(NdProxyManager &aNdProxyManager, MulticastRoutingManager &aMulticastRoutingManager);
+
+    /**
+     * This destructor closes the socket.
+     *
+     */
+    ~PeerSync(void);
+
+    /**
+     * This method opens the socket of the state synchronization on the backbone interface.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method sets whether this Backbone Router is Primary, and so sends its state instead of receiving it.
+     *
+     * The state received from the previous Primary is forgotten when becoming Primary.
+     *
+     * @param[in] aIsPrimary  Whether this Backbone Router is Primary.
+     *
+     */
+    void SetPrimary(bool aIsPrimary);
+
+    /**
+     * This method sets the network key the messages are authenticated with.
+     *
+     * No state is sent nor accepted before the network key is set.
+     *
+     * @param[in] aNetworkKey  A pointer to the network key.
+     * @param[in] aLength      The length of the network key.
+     *
+     */
+    void SetNetworkKey(const uint8_t *aNetworkKey, size_t aLength) { mCodec.SetNetworkKey(aNetworkKey, aLength); }
+
+    /**
+     * This method sets the RLOC16 of the current Primary Backbone Router.
+     *
+     * The state is only accepted from the current Primary. The state received from a previous Primary is kept until
+     * it expires, so that it is still taken over when this Backbone Router becomes Primary.
+     *
+     * @param[in] aRloc16  The RLOC16 of the Primary Backbone Router, or `PeerSyncCodec::kInvalidRloc16` if none.
+     *
+     */
+    void SetPrimaryServer(uint16_t aRloc16) { mPrimaryServer16 = aRloc16; }
+
+    /**
+     * This method schedules sending the state, after a DUA or a listener changed.
+     *
+     */
+    void ScheduleUpdate(void);
+
+    /**
+     * This method returns the DUAs received from the Primary Backbone Router.
+     *
+     * @param[in] aDomainPrefix  The Domain Prefix, DUAs of other prefixes are left out.
+     *
+     * @returns The DUAs of the Primary Backbone Router.
+     *
+     */
+    std::vector<Ip6Address> GetPeerDuas(const Ip6Prefix &aDomainPrefix) const;
+
+    /**
+     * This method returns the multicast listeners received from the Primary Backbone Router.
+     *
+     * @returns The multicast groups with listeners of the Primary Backbone Router.
+     *
+     */
+    std::vector<Ip6Address> GetPeerListeners(void) const;
+
+private:
+    enum
+    {
+        kMaxMessagesPerProcess = 16,  ///< Max number of messages handled per mainloop iteration.
+        kUpdateDelay           = 100, ///< Delay (in milliseconds) coalescing changes into one update.
+    };
+
+#if OTBR_ENABLE_FIXED_CONTAINERS
+    typedef FixedHashMap<Ip6Address, Timer::Clock::time_point, OTBR_ND_PROXY_MAX_DUAS, Ip6AddressHash> PeerTable;
+#else
+    typedef std::unordered_map<Ip6Address, Timer::Clock::time_point, Ip6AddressHash> PeerTable;
+#endif
+
+    otbrError   InitSocket(void);
+    void        FiniSocket(void);
+    void        SendState(void);
+    void        SendTable(uint8_t aType, const std::vector<Ip6Address> &aAddresses);
+    void        ProcessMessages(void);
+    void        HandleMessage(const uint8_t *aBuffer, size_t aLength);
+    static void Refresh(PeerTable &aTable, const Ip6Address &aAddress, Timer::Clock::time_point aNow);
+    static void Expire(PeerTable &aTable, Timer::Clock::time_point aNow);
+    static bool IsFresh(const PeerTable::value_type &aEntry, Timer::Clock::time_point aNow);
+    static void HandleEvent(void *aContext, int aFd, uint32_t aEvents);
+    static void HandleSendTimer(Timer &aTimer, void *aContext);
+
+    NdProxyManager &         mNdProxyManager;
+    MulticastRoutingManager &mMulticastRoutingManager;
+    int                      mSocket;
+    Ip6Address               mGroup;
+    unsigned int             mBackboneIfIndex;
+    bool                     mIsPrimary;
+    uint16_t                 mPrimaryServer16; ///< The RLOC16 of the current Primary.
+    PeerSyncCodec            mCodec;
+    Timer                    mSendTimer;
+    PeerTable                mPeerDuas;      ///< DUAs of the Primary, by the time last received.
+    PeerTable                mPeerListeners; ///< Listeners of the Primary, by the time last received.
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // BACKBONE_ROUTER_PEER_SYNC_HPP_
@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the messages of the state synchronization between Backbone Routers.
+ */
+
+#include "backbone_router/peer_sync_codec.hpp"
+
+#include <string.h>
+
+#include <mbedtls/md.h>
+#include <mbedtls/platform_util.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+// The label the key of the messages is derived from the network key with, so that it is not used for anything else.
+static const char kKeyLabel[] = "OTBR PeerSync";
+
+PeerSyncCodec::PeerSyncCodec(void)
+    : mHasKey(false)
+{
+    memset(mKey, 0, sizeof(mKey));
+}
+
+void PeerSyncCodec::SetNetworkKey(const uint8_t *aNetworkKey, size_t aLength)
+{
+    mHasKey = mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), aNetworkKey, aLength,
+                              reinterpret_cast<const unsigned char *>(kKeyLabel), sizeof(kKeyLabel) - 1, mKey) == 0;
+
+    if (!mHasKey)
+    {
+        mbedtls_platform_zeroize(mKey, sizeof(mKey));
+    }
+}
+
+bool PeerSyncCodec::ComputeTag(const uint8_t *aMessage, size_t aLength, uint8_t *aTag) const
+{
+    uint8_t digest[kKeyLength];
+    bool    computed;
+
+    computed = mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), mKey, sizeof(mKey), aMessage, aLength,
+                               digest) == 0;
+
+    if (computed)
+    {
+        memcpy(aTag, digest, kTagLength);
+    }
+
+    return computed;
+}
+
+otbrError PeerSyncCodec::Encode(uint8_t           aType,
+                                uint16_t          aSender,
+                                const Ip6Address *aAddresses,
+                                size_t            aCount,
+                                uint8_t *         aBuffer,
+                                size_t &          aLength) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    length;
+
+    VerifyOrExit(mHasKey, error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(aCount <= kMaxEntries, error = OTBR_ERROR_INVALID_ARGS);
+
+    aBuffer[0] = kVersion;
+    aBuffer[1] = aType;
+    aBuffer[2] = static_cast<uint8_t>(aCount >> 8);
+    aBuffer[3] = static_cast<uint8_t>(aCount);
+    aBuffer[4] = static_cast<uint8_t>(aSender >> 8);
+    aBuffer[5] = static_cast<uint8_t>(aSender);
+    length     = kHeaderLength;
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        memcpy(aBuffer + length, aAddresses[i].m8, sizeof(Ip6Address));
+        length += sizeof(Ip6Address);
+    }
+
+    VerifyOrExit(ComputeTag(aBuffer, length, aBuffer + length), error = OTBR_ERROR_ERRNO);
+    aLength = length + kTagLength;
+
+exit:
+    return error;
+}
+
+otbrError PeerSyncCodec::Decode(const uint8_t *          aBuffer,
+                                size_t                   aLength,
+                                uint16_t                 aPrimary,
+                                uint8_t &                aType,
+                                std::vector<Ip6Address> &aAddresses) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   tag[kTagLength];
+    uint8_t   diff = 0;
+    size_t    count;
+    uint16_t  sender;
+
+    VerifyOrExit(mHasKey, error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(aLength >= kHeaderLength + kTagLength, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(aBuffer[0] == kVersion, error = OTBR_ERROR_PARSE);
+
+    count = static_cast<size_t>((aBuffer[2] << 8) | aBuffer[3]);
+    VerifyOrExit(count <= kMaxEntries && aLength == kHeaderLength + count * sizeof(Ip6Address) + kTagLength,
+                 error = OTBR_ERROR_PARSE);
+
+    // The tag is compared in constant time, so that it cannot be guessed byte by byte.
+    VerifyOrExit(ComputeTag(aBuffer, aLength - kTagLength, tag), error = OTBR_ERROR_PARSE);
+
+    for (size_t i = 0; i < kTagLength; i++)
+    {
+        diff |= tag[i] ^ aBuffer[aLength - kTagLength + i];
+    }
+
+    VerifyOrExit(diff == 0, error = OTBR_ERROR_PARSE);
+
+    sender = static_cast<uint16_t>((aBuffer[4] << 8) | aBuffer[5]);
+    VerifyOrExit(aPrimary != kInvalidRloc16 && sender == aPrimary, error = OTBR_ERROR_INVALID_ARGS);
+
+    VerifyOrExit(aBuffer[1] == kTypeDuas || aBuffer[1] == kTypeListeners, error = OTBR_ERROR_PARSE);
+    aType = aBuffer[1];
+
+    aAddresses.clear();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Ip6Address address;
+
+        memcpy(address.m8, aBuffer + kHeaderLength + i * sizeof(Ip6Address), sizeof(address.m8));
+        aAddresses.push_back(address);
+    }
+
+exit:
+    return error;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the messages of the state synchronization between Backbone Routers.
+ */
+
+#ifndef BACKBONE_ROUTER_PEER_SYNC_CODEC_HPP_
+#define BACKBONE_ROUTER_PEER_SYNC_CODEC_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-backbone
+ *
+ * @{
+ */
+
+/**
+ * This class encodes and authenticates the messages of the state synchronization.
+ *
+ * A message carries the RLOC16 of the Primary Backbone Router sending it and is authenticated with a HMAC-SHA256
+ * keyed from the network key, so that only a device of the Thread network can inject state and the Secondaries
+ * accept the state of the current Primary only.
+ *
+ */
+class PeerSyncCodec
+{
+public:
+    enum
+    {
+        kTypeDuas      = 1,      ///< The message carries DUAs.
+        kTypeListeners = 2,      ///< The message carries multicast listeners.
+        kMaxEntries    = 64,     ///< Max number of addresses of one message.
+        kHeaderLength  = 6,      ///< Length of the header of a message.
+        kTagLength     = 16,     ///< Length of the truncated HMAC ending a message.
+        kInvalidRloc16 = 0xfffe, ///< The RLOC16 of no Primary.
+    };
+
+    enum
+    {
+        kMaxLength = kHeaderLength + kMaxEntries * sizeof(Ip6Address) + kTagLength, ///< Max length of a message.
+    };
+
+    /**
+     * This constructor initializes a codec without key, which neither encodes nor accepts messages.
+     *
+     */
+    PeerSyncCodec(void);
+
+    /**
+     * This method sets the network key the messages are authenticated with.
+     *
+     * @param[in] aNetworkKey  A pointer to the network key.
+     * @param[in] aLength      The length of the network key.
+     *
+     */
+    void SetNetworkKey(const uint8_t *aNetworkKey, size_t aLength);
+
+    /**
+     * This method encodes a message.
+     *
+     * @param[in]  aType       The type of the addresses.
+     * @param[in]  aSender     The RLOC16 of the Primary Backbone Router sending the message.
+     * @param[in]  aAddresses  A pointer to the addresses.
+     * @param[in]  aCount      The number of addresses, at most `kMaxEntries`.
+     * @param[out] aBuffer     A pointer to the buffer of `kMaxLength` bytes receiving the message.
+     * @param[out] aLength     The length of the message.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully encoded the message.
+     * @retval OTBR_ERROR_INVALID_ARGS  Too many addresses.
+     * @retval OTBR_ERROR_NOT_FOUND     No network key is set.
+     * @retval OTBR_ERROR_ERRNO         Failed to compute the HMAC.
+     *
+     */
+    otbrError Encode(uint8_t           aType,
+                     uint16_t          aSender,
+                     const Ip6Address *aAddresses,
+                     size_t            aCount,
+                     uint8_t *         aBuffer,
+                     size_t &          aLength) const;
+
+    /**
+     * This method authenticates and decodes a message.
+     *
+     * @param[in]  aBuffer     A pointer to the message.
+     * @param[in]  aLength     The length of the message.
+     * @param[in]  aPrimary    The RLOC16 of the current Primary Backbone Router.
+     * @param[out] aType       The type of the addresses.
+     * @param[out] aAddresses  The addresses.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully decoded the message.
+     * @retval OTBR_ERROR_PARSE         The message is malformed or fails the authentication.
+     * @retval OTBR_ERROR_INVALID_ARGS  The message is not sent by @p aPrimary.
+     * @retval OTBR_ERROR_NOT_FOUND     No network key is set.
+     *
+     */
+    otbrError Decode(const uint8_t *          aBuffer,
+                     size_t                   aLength,
+                     uint16_t                 aPrimary,
+                     uint8_t &                aType,
+                     std::vector<Ip6Address> &aAddresses) const;
+
+private:
+    enum
+    {
+        kVersion   = 2,
+        kKeyLength = 32,
+    };
+
+    bool ComputeTag(const uint8_t *aMessage, size_t aLength, uint8_t *aTag) const;
+
+    uint8_t mKey[kKeyLength];
+    bool    mHasKey;
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // BACKBONE_ROUTER_PEER_SYNC_CODEC_HPP_
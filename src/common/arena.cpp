@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the arena of per-request scratch memory.
+ */
+
+#include "common/arena.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include <assert.h>
+
+namespace otbr {
+
+Arena::Arena(size_t aBlockSize)
+    : mBlockSize(aBlockSize)
+    , mBlocks(nullptr)
+    , mCursor(nullptr)
+    , mEnd(nullptr)
+    , mUsed(0)
+    , mCapacity(0)
+{
+}
+
+Arena::~Arena(void)
+{
+    while (mBlocks != nullptr)
+    {
+        Block *next = mBlocks->mNext;
+
+        ::operator delete(mBlocks);
+        mBlocks = next;
+    }
+}
+
+void *Arena::Allocate(size_t aSize, size_t aAlignment)
+{
+    uintptr_t address;
+
+    assert(aAlignment != 0 && (aAlignment & (aAlignment - 1)) == 0);
+
+    address = (reinterpret_cast<uintptr_t>(mCursor) + aAlignment - 1) & ~(aAlignment - 1);
+
+    if (mCursor == nullptr || address + aSize > reinterpret_cast<uintptr_t>(mEnd))
+    {
+        AddBlock(std::max(mBlockSize, aSize + aAlignment));
+        address = (reinterpret_cast<uintptr_t>(mCursor) + aAlignment - 1) & ~(aAlignment - 1);
+    }
+
+    mUsed += address + aSize - reinterpret_cast<uintptr_t>(mCursor);
+    mCursor = reinterpret_cast<uint8_t *>(address + aSize);
+
+    return reinterpret_cast<void *>(address);
+}
+
+void Arena::AddBlock(size_t aSize)
+{
+    Block *block = static_cast<Block *>(::operator new(sizeof(Block) + aSize));
+
+    block->mNext = mBlocks;
+    block->mSize = aSize;
+    mBlocks      = block;
+    mCursor      = reinterpret_cast<uint8_t *>(block + 1);
+    mEnd         = mCursor + aSize;
+    mCapacity += aSize;
+}
+
+void Arena::Reset(void)
+{
+    Block *first = nullptr;
+
+    // Blocks are linked from the newest one, the first block is the last of the list.
+    while (mBlocks != nullptr)
+    {
+        Block *next = mBlocks->mNext;
+
+        if (next == nullptr && mBlocks->mSize == mBlockSize)
+        {
+            first = mBlocks;
+        }
+        else
+        {
+            mCapacity -= mBlocks->mSize;
+            ::operator delete(mBlocks);
+        }
+        mBlocks = next;
+    }
+
+    mBlocks = first;
+    mCursor = first != nullptr ? reinterpret_cast<uint8_t *>(first + 1) : nullptr;
+    mEnd    = first != nullptr ? mCursor + first->mSize : nullptr;
+    mUsed   = 0;
+}
+
+} // namespace otbr
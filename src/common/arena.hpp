@@ -0,0 +1,202 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the arena of per-request scratch memory.
+ */
+
+#ifndef OTBR_COMMON_ARENA_HPP_
+#define OTBR_COMMON_ARENA_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The size of each block of memory of an arena, in bytes.
+ *
+ */
+#ifndef OTBR_ARENA_BLOCK_SIZE
+#define OTBR_ARENA_BLOCK_SIZE 4096
+#endif
+
+namespace otbr {
+
+/**
+ * This class implements a bump allocator for memory used while serving one request.
+ *
+ * Memory is carved from blocks allocated on demand and is not freed individually, it is released all at once by
+ * `Reset()`. The first block is kept across resets, so that requests fitting in one block do not allocate at all.
+ *
+ * An arena is not thread-safe, it must be used by one thread at a time.
+ *
+ */
+class Arena
+{
+public:
+    /**
+     * The constructor of an arena.
+     *
+     * @param[in]   aBlockSize  The size of each block of memory, larger allocations get a block of their own.
+     *
+     */
+    explicit Arena(size_t aBlockSize = OTBR_ARENA_BLOCK_SIZE);
+
+    ~Arena(void);
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /**
+     * This method allocates memory from the arena.
+     *
+     * @param[in]   aSize       The number of bytes to allocate.
+     * @param[in]   aAlignment  The alignment of the memory, a power of two.
+     *
+     * @returns A pointer to the memory, valid until the next call of `Reset()`.
+     *
+     * @throws std::bad_alloc if a new block could not be allocated.
+     *
+     */
+    void *Allocate(size_t aSize, size_t aAlignment = alignof(max_align_t));
+
+    /**
+     * This method releases all memory allocated from the arena, keeping the first block for reuse.
+     *
+     * Objects holding memory of the arena must be destroyed or emptied before.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method returns the number of bytes allocated since the last reset.
+     *
+     * @returns The number of bytes allocated, including the padding for alignment.
+     *
+     */
+    size_t GetUsed(void) const { return mUsed; }
+
+    /**
+     * This method returns the number of bytes of the blocks held by the arena.
+     *
+     * @returns The number of bytes of the blocks.
+     *
+     */
+    size_t GetCapacity(void) const { return mCapacity; }
+
+private:
+    struct Block
+    {
+        Block *mNext;
+        size_t mSize;
+    };
+
+    void AddBlock(size_t aSize);
+
+    const size_t mBlockSize;
+    Block *      mBlocks;
+    uint8_t *    mCursor;
+    uint8_t *    mEnd;
+    size_t       mUsed;
+    size_t       mCapacity;
+};
+
+/**
+ * This class implements a standard allocator allocating from an `Arena`.
+ *
+ * Deallocation does nothing, the memory is reclaimed when the arena is reset.
+ *
+ */
+template <typename T> class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    /**
+     * The constructor of an allocator allocating from the given arena.
+     *
+     * @param[in]   aArena  A reference to the arena.
+     *
+     */
+    explicit ArenaAllocator(Arena &aArena)
+        : mArena(&aArena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &aOther)
+        : mArena(&aOther.GetArena())
+    {
+    }
+
+    T *allocate(size_t aCount) { return static_cast<T *>(mArena->Allocate(aCount * sizeof(T), alignof(T))); }
+
+    void deallocate(T *, size_t) {}
+
+    /**
+     * This method returns the arena of this allocator.
+     *
+     * @returns A reference to the arena.
+     *
+     */
+    Arena &GetArena(void) const { return *mArena; }
+
+private:
+    Arena *mArena;
+};
+
+template <typename T, typename U> bool operator==(const ArenaAllocator<T> &aLhs, const ArenaAllocator<U> &aRhs)
+{
+    return &aLhs.GetArena() == &aRhs.GetArena();
+}
+
+template <typename T, typename U> bool operator!=(const ArenaAllocator<T> &aLhs, const ArenaAllocator<U> &aRhs)
+{
+    return !(aLhs == aRhs);
+}
+
+/**
+ * This type represents a string allocated from an arena.
+ *
+ */
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>> ArenaString;
+
+/**
+ * This type represents a vector allocated from an arena.
+ *
+ */
+template <typename T> using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_ARENA_HPP_
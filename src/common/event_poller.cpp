@@ -0,0 +1,384 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the file descriptor event poller of the mainloop.
+ */
+
+#include "common/event_poller.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+EventPoller &EventPoller::Get(void)
+{
+    static thread_local EventPoller sEventPoller;
+
+    return sEventPoller;
+}
+
+#if OTBR_ENABLE_EPOLL
+
+EventPoller::EventPoller(void)
+{
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(mEpollFd >= 0, strerror(errno));
+}
+
+uint32_t EventPoller::ToEpollEvents(uint32_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & kEventReadable)
+    {
+        events |= EPOLLIN;
+    }
+
+    if (aEvents & kEventWritable)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (aEvents & kEventEdgeTriggered)
+    {
+        events |= EPOLLET;
+    }
+
+    return events;
+}
+
+otbrError EventPoller::Register(int aFd, uint32_t aEvents, Handler aHandler, void *aContext, Priority aPriority)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    struct epoll_event event;
+
+    assert(aHandler != nullptr);
+
+    VerifyOrExit(aFd >= 0 && mWatches.find(aFd) == mWatches.end(), error = OTBR_ERROR_INVALID_ARGS);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = ToEpollEvents(aEvents);
+    event.data.fd = aFd;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+
+    mWatches[aFd] = {aEvents, aHandler, aContext, aPriority};
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to register fd %d: %s", aFd, otbrErrorString(error));
+    }
+
+    return error;
+}
+
+otbrError EventPoller::Update(int aFd, uint32_t aEvents)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    auto               it    = mWatches.find(aFd);
+    struct epoll_event event;
+
+    VerifyOrExit(it != mWatches.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(it->second.mEvents != aEvents);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = ToEpollEvents(aEvents);
+    event.data.fd = aFd;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+
+    it->second.mEvents = aEvents;
+
+exit:
+    return error;
+}
+
+void EventPoller::Unregister(int aFd)
+{
+    auto it = mWatches.find(aFd);
+
+    VerifyOrExit(it != mWatches.end());
+
+    epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr);
+    mWatches.erase(it);
+    RemoveDeferredEvents(aFd);
+
+exit:
+    return;
+}
+
+void EventPoller::UpdateFdSet(otSysMainloopContext &aMainloop)
+{
+    if (!mDeferredEvents.empty())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+
+    VerifyOrExit(!mWatches.empty());
+
+    FD_SET(mEpollFd, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mEpollFd);
+
+exit:
+    return;
+}
+
+void EventPoller::Process(const otSysMainloopContext &aMainloop)
+{
+    int count = 0;
+
+    mReadyEvents.clear();
+
+    if (FD_ISSET(mEpollFd, &aMainloop.mReadFdSet))
+    {
+        count = epoll_wait(mEpollFd, mEpollEvents, kMaxEpollEvents, 0);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t events = 0;
+
+        if (mEpollEvents[i].events & (EPOLLIN | EPOLLHUP))
+        {
+            events |= kEventReadable;
+        }
+
+        if (mEpollEvents[i].events & EPOLLOUT)
+        {
+            events |= kEventWritable;
+        }
+
+        if (mEpollEvents[i].events & (EPOLLERR | EPOLLHUP))
+        {
+            events |= kEventError;
+        }
+
+        mReadyEvents.push_back({mEpollEvents[i].data.fd, events, kPriorityNormal});
+    }
+
+    Dispatch();
+}
+
+#else // OTBR_ENABLE_EPOLL
+
+EventPoller::EventPoller(void)
+{
+}
+
+otbrError EventPoller::Register(int aFd, uint32_t aEvents, Handler aHandler, void *aContext, Priority aPriority)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    assert(aHandler != nullptr);
+
+    VerifyOrExit(aFd >= 0 && aFd < FD_SETSIZE && mWatches.find(aFd) == mWatches.end(),
+                 error = OTBR_ERROR_INVALID_ARGS);
+
+    mWatches[aFd] = {aEvents, aHandler, aContext, aPriority};
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to register fd %d: %s", aFd, otbrErrorString(error));
+    }
+
+    return error;
+}
+
+otbrError EventPoller::Update(int aFd, uint32_t aEvents)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mWatches.find(aFd);
+
+    VerifyOrExit(it != mWatches.end(), error = OTBR_ERROR_NOT_FOUND);
+    it->second.mEvents = aEvents;
+
+exit:
+    return error;
+}
+
+void EventPoller::Unregister(int aFd)
+{
+    mWatches.erase(aFd);
+    RemoveDeferredEvents(aFd);
+}
+
+void EventPoller::UpdateFdSet(otSysMainloopContext &aMainloop)
+{
+    if (!mDeferredEvents.empty())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+
+    for (const auto &watch : mWatches)
+    {
+        int fd = watch.first;
+
+        if (watch.second.mEvents & kEventReadable)
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+
+        if (watch.second.mEvents & kEventWritable)
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+
+        if (watch.second.mEvents & kEventError)
+        {
+            FD_SET(fd, &aMainloop.mErrorFdSet);
+        }
+
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+    }
+}
+
+void EventPoller::Process(const otSysMainloopContext &aMainloop)
+{
+    mReadyEvents.clear();
+
+    for (const auto &watch : mWatches)
+    {
+        int      fd     = watch.first;
+        uint32_t events = 0;
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            events |= kEventReadable;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            events |= kEventWritable;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        {
+            events |= kEventError;
+        }
+
+        if (events != 0)
+        {
+            mReadyEvents.push_back({fd, events, watch.second.mPriority});
+        }
+    }
+
+    Dispatch();
+}
+
+#endif // OTBR_ENABLE_EPOLL
+
+void EventPoller::RemoveDeferredEvents(int aFd)
+{
+    mDeferredEvents.erase(std::remove_if(mDeferredEvents.begin(), mDeferredEvents.end(),
+                                         [aFd](const ReadyEvent &aEvent) { return aEvent.mFd == aFd; }),
+                          mDeferredEvents.end());
+}
+
+void EventPoller::Dispatch(void)
+{
+    const std::chrono::microseconds       budget(OTBR_EVENT_POLLER_LOW_PRIORITY_BUDGET);
+    std::chrono::steady_clock::time_point lowPriorityStart;
+    bool                                  lowPriorityStarted = false;
+
+    // The events deferred in the previous iteration are merged, they may not be reported again.
+    for (const ReadyEvent &deferred : mDeferredEvents)
+    {
+        auto it = std::find_if(mReadyEvents.begin(), mReadyEvents.end(),
+                               [&deferred](const ReadyEvent &aReady) { return aReady.mFd == deferred.mFd; });
+
+        if (it == mReadyEvents.end())
+        {
+            mReadyEvents.push_back(deferred);
+        }
+        else
+        {
+            it->mEvents |= deferred.mEvents;
+        }
+    }
+    mDeferredEvents.clear();
+
+    for (ReadyEvent &ready : mReadyEvents)
+    {
+        auto it = mWatches.find(ready.mFd);
+
+        if (it != mWatches.end())
+        {
+            ready.mPriority = it->second.mPriority;
+        }
+    }
+
+    std::stable_sort(mReadyEvents.begin(), mReadyEvents.end(),
+                     [](const ReadyEvent &aLhs, const ReadyEvent &aRhs) { return aLhs.mPriority < aRhs.mPriority; });
+
+    for (size_t index = 0; index < mReadyEvents.size(); index++)
+    {
+        const ReadyEvent &ready = mReadyEvents[index];
+
+        // The watch may have been unregistered by a previous handler.
+        auto     it = mWatches.find(ready.mFd);
+        uint32_t events;
+
+        if (it == mWatches.end())
+        {
+            continue;
+        }
+
+        if (it->second.mPriority == kPriorityLow)
+        {
+            if (!lowPriorityStarted)
+            {
+                lowPriorityStart   = std::chrono::steady_clock::now();
+                lowPriorityStarted = true;
+            }
+            else if (std::chrono::steady_clock::now() - lowPriorityStart >= budget)
+            {
+                mDeferredEvents.assign(mReadyEvents.begin() + static_cast<ptrdiff_t>(index), mReadyEvents.end());
+                break;
+            }
+        }
+
+        events = ready.mEvents & (it->second.mEvents | kEventError);
+
+        if (events != 0)
+        {
+            it->second.mHandler(it->second.mContext, ready.mFd, events);
+        }
+    }
+}
+
+} // namespace otbr
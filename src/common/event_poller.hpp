@@ -0,0 +1,226 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the file descriptor event poller of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_EVENT_POLLER_HPP_
+#define OTBR_COMMON_EVENT_POLLER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+
+#if OTBR_ENABLE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#include "common/mainloop.h"
+#include "common/types.hpp"
+
+/**
+ * The time (in microseconds) the handlers of low priority file descriptors may run in one mainloop iteration, the
+ * events left are dispatched in the next iteration.
+ *
+ */
+#ifndef OTBR_EVENT_POLLER_LOW_PRIORITY_BUDGET
+#define OTBR_EVENT_POLLER_LOW_PRIORITY_BUDGET 10000
+#endif
+
+namespace otbr {
+
+/**
+ * This class implements a file descriptor event poller.
+ *
+ * Subsystems register a file descriptor once together with the events they are interested in, and the handler is
+ * only called when any of these events happened. The poller is hooked into the select() based mainloop through
+ * `UpdateFdSet()` and `Process()`.
+ *
+ * When built with `OTBR_ENABLE_EPOLL`, all registered file descriptors are kept in an epoll instance and only the
+ * epoll file descriptor itself is added to the select() sets, so the cost of a wakeup depends on the number of ready
+ * file descriptors rather than the number of registered ones, and registered file descriptors are not limited by
+ * `FD_SETSIZE`. Otherwise, registered file descriptors are added to the select() sets directly.
+ *
+ */
+class EventPoller
+{
+public:
+    /**
+     * Event flags.
+     *
+     */
+    enum : uint32_t
+    {
+        kEventReadable = 1u << 0, ///< The file descriptor is readable.
+        kEventWritable = 1u << 1, ///< The file descriptor is writable.
+        kEventError    = 1u << 2, ///< An error condition happened on the file descriptor.
+
+        /**
+         * Report events edge-triggered instead of level-triggered. The handler must then consume all available data
+         * (until `EAGAIN`). This flag is only honored by the epoll backend.
+         *
+         */
+        kEventEdgeTriggered = 1u << 31,
+    };
+
+    /**
+     * This function pointer is called when events happened on a registered file descriptor.
+     *
+     * @param[in]   aContext    A pointer to application-specific context.
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The events happened, a combination of `kEventReadable`, `kEventWritable` and
+     *                          `kEventError`.
+     *
+     */
+    typedef void (*Handler)(void *aContext, int aFd, uint32_t aEvents);
+
+    /**
+     * Priorities of file descriptors, the handlers of higher priority are called first.
+     *
+     */
+    enum Priority : uint8_t
+    {
+        kPriorityHigh   = 0, ///< Time-critical forwarding work, e.g. the ND Proxy.
+        kPriorityNormal = 1, ///< Default priority.
+        kPriorityLow    = 2, ///< Management work, limited by `OTBR_EVENT_POLLER_LOW_PRIORITY_BUDGET` per iteration.
+    };
+
+    /**
+     * This method returns the event poller of the calling thread, each thread running a mainloop has its own.
+     *
+     * @returns A reference to the event poller.
+     *
+     */
+    static EventPoller &Get(void);
+
+    /**
+     * This method registers a file descriptor.
+     *
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The events to watch.
+     * @param[in]   aHandler    The function to be called when any of @p aEvents happened.
+     * @param[in]   aContext    A pointer to application-specific context.
+     * @param[in]   aPriority   The priority of the file descriptor.
+     *
+     * @retval  OTBR_ERROR_NONE             Successfully registered the file descriptor.
+     * @retval  OTBR_ERROR_INVALID_ARGS     The file descriptor is invalid or already registered.
+     * @retval  OTBR_ERROR_ERRNO            Failed to add the file descriptor to epoll.
+     *
+     */
+    otbrError Register(int      aFd,
+                       uint32_t aEvents,
+                       Handler  aHandler,
+                       void *   aContext,
+                       Priority aPriority = kPriorityNormal);
+
+    /**
+     * This method updates the events watched on a registered file descriptor.
+     *
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The events to watch.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully updated the events.
+     * @retval  OTBR_ERROR_NOT_FOUND    The file descriptor is not registered.
+     * @retval  OTBR_ERROR_ERRNO        Failed to modify the file descriptor in epoll.
+     *
+     */
+    otbrError Update(int aFd, uint32_t aEvents);
+
+    /**
+     * This method unregisters a file descriptor. This must be done before the file descriptor is closed.
+     *
+     * It is safe to call this method from within a handler.
+     *
+     * @param[in]   aFd         The file descriptor.
+     *
+     */
+    void Unregister(int aFd);
+
+    /**
+     * This method updates the file descriptor sets and timeout for mainloop.
+     *
+     * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
+     *
+     */
+    void UpdateFdSet(otSysMainloopContext &aMainloop);
+
+    /**
+     * This method calls the handlers of file descriptors with pending events.
+     *
+     * @param[in]       aMainloop   A reference to OpenThread mainloop context.
+     *
+     */
+    void Process(const otSysMainloopContext &aMainloop);
+
+private:
+    struct Watch
+    {
+        uint32_t mEvents;
+        Handler  mHandler;
+        void *   mContext;
+        Priority mPriority;
+    };
+
+    struct ReadyEvent
+    {
+        int      mFd;
+        uint32_t mEvents;
+        Priority mPriority;
+    };
+
+    EventPoller(void);
+
+    void RemoveDeferredEvents(int aFd);
+    void Dispatch(void);
+
+    std::unordered_map<int, Watch> mWatches;
+    std::vector<ReadyEvent>        mReadyEvents;
+    std::vector<ReadyEvent>        mDeferredEvents; ///< Low priority events left when the budget ran out.
+
+#if OTBR_ENABLE_EPOLL
+    enum
+    {
+        kMaxEpollEvents = 64, ///< Max number of events retrieved by one epoll_wait().
+    };
+
+    static uint32_t ToEpollEvents(uint32_t aEvents);
+
+    int                mEpollFd;
+    struct epoll_event mEpollEvents[kMaxEpollEvents];
+#endif
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_EVENT_POLLER_HPP_
@@ -0,0 +1,693 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions of containers of a fixed capacity storing their elements inline.
+ */
+
+#ifndef OTBR_COMMON_FIXED_CONTAINERS_HPP_
+#define OTBR_COMMON_FIXED_CONTAINERS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <assert.h>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace otbr {
+
+/**
+ * This class template implements a vector of at most @p kCapacity elements stored inline, so that it never allocates.
+ *
+ * Only the part of the `std::vector` interface used by the subsystems is provided. Adding an element to a full vector
+ * does nothing and returns false.
+ *
+ */
+template <typename T, size_t kCapacity> class FixedVector
+{
+public:
+    typedef T        value_type;
+    typedef T *      iterator;
+    typedef const T *const_iterator;
+
+    FixedVector(void)
+        : mSize(0)
+    {
+    }
+
+    FixedVector(const FixedVector &aOther)
+        : mSize(0)
+    {
+        for (const T &value : aOther)
+        {
+            push_back(value);
+        }
+    }
+
+    FixedVector &operator=(const FixedVector &aOther)
+    {
+        if (this != &aOther)
+        {
+            clear();
+            for (const T &value : aOther)
+            {
+                push_back(value);
+            }
+        }
+
+        return *this;
+    }
+
+    ~FixedVector(void) { clear(); }
+
+    size_t                  size(void) const { return mSize; }
+    bool                    empty(void) const { return mSize == 0; }
+    bool                    full(void) const { return mSize == kCapacity; }
+    static constexpr size_t capacity(void) { return kCapacity; }
+
+    iterator       begin(void) { return Data(); }
+    iterator       end(void) { return Data() + mSize; }
+    const_iterator begin(void) const { return Data(); }
+    const_iterator end(void) const { return Data() + mSize; }
+
+    T &operator[](size_t aIndex)
+    {
+        assert(aIndex < mSize);
+        return Data()[aIndex];
+    }
+
+    const T &operator[](size_t aIndex) const
+    {
+        assert(aIndex < mSize);
+        return Data()[aIndex];
+    }
+
+    T &      back(void) { return (*this)[mSize - 1]; }
+    const T &back(void) const { return (*this)[mSize - 1]; }
+
+    /**
+     * This method constructs an element at the end.
+     *
+     * @param[in]   aArgs   The arguments of the constructor of the element.
+     *
+     * @returns Whether the element is added, false if the vector is full.
+     *
+     */
+    template <typename... Args> bool emplace_back(Args &&... aArgs)
+    {
+        bool added = !full();
+
+        if (added)
+        {
+            new (Data() + mSize) T(std::forward<Args>(aArgs)...);
+            mSize++;
+        }
+
+        return added;
+    }
+
+    bool push_back(const T &aValue) { return emplace_back(aValue); }
+
+    void pop_back(void)
+    {
+        assert(mSize > 0);
+        Data()[--mSize].~T();
+    }
+
+    /**
+     * This method removes an element, moving the following elements forward.
+     *
+     * @param[in]   aPosition   The iterator of the element.
+     *
+     * @returns The iterator of the element following the removed one.
+     *
+     */
+    iterator erase(iterator aPosition)
+    {
+        std::move(aPosition + 1, end(), aPosition);
+        pop_back();
+
+        return aPosition;
+    }
+
+    void clear(void)
+    {
+        while (mSize > 0)
+        {
+            pop_back();
+        }
+    }
+
+private:
+    T *      Data(void) { return reinterpret_cast<T *>(mStorage); }
+    const T *Data(void) const { return reinterpret_cast<const T *>(mStorage); }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type mStorage[kCapacity];
+    size_t                                                     mSize;
+};
+
+/**
+ * This class template implements a double-ended queue of at most @p kCapacity elements stored inline in a ring.
+ *
+ * Only the operations of a FIFO queue are provided. Adding an element to a full queue does nothing and returns false.
+ *
+ */
+template <typename T, size_t kCapacity> class FixedDeque
+{
+public:
+    typedef T value_type;
+
+    FixedDeque(void)
+        : mHead(0)
+        , mSize(0)
+    {
+    }
+
+    FixedDeque(const FixedDeque &) = delete;
+    FixedDeque &operator=(const FixedDeque &) = delete;
+
+    ~FixedDeque(void) { clear(); }
+
+    size_t                  size(void) const { return mSize; }
+    bool                    empty(void) const { return mSize == 0; }
+    bool                    full(void) const { return mSize == kCapacity; }
+    static constexpr size_t capacity(void) { return kCapacity; }
+
+    T &front(void)
+    {
+        assert(mSize > 0);
+        return Data()[mHead];
+    }
+
+    const T &front(void) const
+    {
+        assert(mSize > 0);
+        return Data()[mHead];
+    }
+
+    bool push_back(const T &aValue)
+    {
+        bool added = !full();
+
+        if (added)
+        {
+            new (Data() + (mHead + mSize) % kCapacity) T(aValue);
+            mSize++;
+        }
+
+        return added;
+    }
+
+    void pop_front(void)
+    {
+        assert(mSize > 0);
+        Data()[mHead].~T();
+        mHead = (mHead + 1) % kCapacity;
+        mSize--;
+    }
+
+    /**
+     * This method replaces the elements with the ones of a range, the elements beyond the capacity are dropped.
+     *
+     * @param[in]   aFirst  The iterator of the first element of the range.
+     * @param[in]   aLast   The iterator past the last element of the range.
+     *
+     */
+    template <typename InputIterator> void assign(InputIterator aFirst, InputIterator aLast)
+    {
+        clear();
+        for (; aFirst != aLast && push_back(*aFirst); ++aFirst)
+        {
+        }
+    }
+
+    void clear(void)
+    {
+        while (mSize > 0)
+        {
+            pop_front();
+        }
+        mHead = 0;
+    }
+
+private:
+    T *      Data(void) { return reinterpret_cast<T *>(mStorage); }
+    const T *Data(void) const { return reinterpret_cast<const T *>(mStorage); }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type mStorage[kCapacity];
+    size_t                                                     mHead;
+    size_t                                                     mSize;
+};
+
+/**
+ * This class template implements a hash table of at most @p kCapacity elements stored inline.
+ *
+ * It uses open addressing with linear probing, and removes an element by moving back the following elements of its
+ * cluster rather than leaving a tombstone, so that lookups are not degraded by churn. Iterations start past an empty
+ * slot, thus an element moved back while erasing during an iteration is still visited exactly once.
+ *
+ * Inserting a new element into a full table does nothing and returns `end()`, as for an unsuccessful lookup.
+ *
+ * @tparam  Value       The type of the elements.
+ * @tparam  Key         The type of the keys.
+ * @tparam  KeyOf       A function object type returning the key of an element.
+ * @tparam  kCapacity   The maximum number of elements.
+ * @tparam  Hash        A function object type hashing a key.
+ *
+ */
+template <typename Value, typename Key, typename KeyOf, size_t kCapacity, typename Hash> class FixedHashTable
+{
+    static constexpr size_t NumSlots(size_t aMinimum, size_t aSlots = 1)
+    {
+        return aSlots >= aMinimum ? aSlots : NumSlots(aMinimum, aSlots * 2);
+    }
+
+    // The load factor is kept at most 3/4 with at least one empty slot.
+    static constexpr size_t kNumSlots = NumSlots(kCapacity + kCapacity / 3 + 1);
+    static constexpr size_t kSlotMask = kNumSlots - 1;
+
+public:
+    typedef Key    key_type;
+    typedef Value  value_type;
+    typedef size_t size_type;
+
+    /**
+     * This class template implements the forward iterators of the table.
+     *
+     */
+    template <typename Table, typename Reference> class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag                        iterator_category;
+        typedef Value                                            value_type;
+        typedef ptrdiff_t                                        difference_type;
+        typedef typename std::remove_reference<Reference>::type *pointer;
+        typedef Reference                                        reference;
+
+        Iterator(Table *aTable = nullptr, size_t aIndex = kNumSlots, size_t aRemaining = 0)
+            : mTable(aTable)
+            , mIndex(aIndex)
+            , mRemaining(aRemaining)
+        {
+        }
+
+        // Non-const iterators convert to const iterators.
+        template <typename OtherTable, typename OtherReference>
+        Iterator(const Iterator<OtherTable, OtherReference> &aOther)
+            : mTable(aOther.mTable)
+            , mIndex(aOther.mIndex)
+            , mRemaining(aOther.mRemaining)
+        {
+        }
+
+        reference operator*(void) const { return mTable->Slot(mIndex); }
+        pointer   operator->(void) const { return &mTable->Slot(mIndex); }
+
+        Iterator &operator++(void)
+        {
+            Advance();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator it = *this;
+
+            Advance();
+            return it;
+        }
+
+        bool operator==(const Iterator &aOther) const { return mIndex == aOther.mIndex; }
+        bool operator!=(const Iterator &aOther) const { return mIndex != aOther.mIndex; }
+
+    private:
+        friend class FixedHashTable;
+        template <typename, typename> friend class Iterator;
+
+        // Moves to the next used slot, skipping the current one first if @p aSkipCurrent.
+        void Advance(bool aSkipCurrent = true)
+        {
+            if (aSkipCurrent)
+            {
+                mIndex = (mIndex + 1) & kSlotMask;
+                mRemaining--;
+            }
+
+            while (mRemaining > 0 && !mTable->mUsed[mIndex])
+            {
+                mIndex = (mIndex + 1) & kSlotMask;
+                mRemaining--;
+            }
+
+            if (mRemaining == 0)
+            {
+                mIndex = kNumSlots;
+            }
+        }
+
+        Table *mTable;
+        size_t mIndex;     // The slot, kNumSlots past the end.
+        size_t mRemaining; // The number of slots left to visit, including the current one.
+    };
+
+    FixedHashTable(void)
+        : mSize(0)
+        , mUsed()
+    {
+    }
+
+    FixedHashTable(const FixedHashTable &) = delete;
+    FixedHashTable &operator=(const FixedHashTable &) = delete;
+
+    ~FixedHashTable(void) { clear(); }
+
+    size_t                  size(void) const { return mSize; }
+    bool                    empty(void) const { return mSize == 0; }
+    bool                    full(void) const { return mSize == kCapacity; }
+    static constexpr size_t capacity(void) { return kCapacity; }
+
+    size_t count(const Key &aKey) const { return FindSlot(aKey) != kNoSlot ? 1 : 0; }
+
+    /**
+     * This method removes the element of a key.
+     *
+     * @param[in]   aKey    The key.
+     *
+     * @returns The number of elements removed.
+     *
+     */
+    size_t erase(const Key &aKey)
+    {
+        size_t index = FindSlot(aKey);
+
+        if (index != kNoSlot)
+        {
+            EraseSlot(index);
+        }
+
+        return index != kNoSlot ? 1 : 0;
+    }
+
+    void clear(void)
+    {
+        for (size_t i = 0; i < kNumSlots; i++)
+        {
+            if (mUsed[i])
+            {
+                Slot(i).~Value();
+                mUsed[i] = false;
+            }
+        }
+        mSize = 0;
+    }
+
+protected:
+    static constexpr size_t kNoSlot = kNumSlots; ///< The slot of no element, also of the end iterator.
+
+    // Returns the iterator of a slot.
+    template <typename Iter> Iter MakeIterator(size_t aIndex) const
+    {
+        size_t start = StartSlot();
+
+        return Iter(const_cast<FixedHashTable *>(this), aIndex, kNumSlots - ((aIndex - start) & kSlotMask));
+    }
+
+    // Returns the iterator of the first element.
+    template <typename Iter> Iter Begin(void) const
+    {
+        Iter it(const_cast<FixedHashTable *>(this), StartSlot(), kNumSlots);
+
+        it.Advance(/* aSkipCurrent */ false);
+        return it;
+    }
+
+    // Returns the slot of a key, kNoSlot if not found.
+    size_t FindSlot(const Key &aKey) const
+    {
+        size_t index = Hash()(aKey) & kSlotMask;
+
+        while (mUsed[index] && !(KeyOf()(Slot(index)) == aKey))
+        {
+            index = (index + 1) & kSlotMask;
+        }
+
+        return mUsed[index] ? index : kNoSlot;
+    }
+
+    /**
+     * This method inserts an element unless there is one of the same key.
+     *
+     * @param[in]   aKey    The key of the element.
+     * @param[in]   aArgs   The arguments of the constructor of the element.
+     *
+     * @returns The slot of the element of @p aKey, kNoSlot if the table is full, and whether it is inserted.
+     *
+     */
+    template <typename... Args> std::pair<size_t, bool> Emplace(const Key &aKey, Args &&... aArgs)
+    {
+        size_t index = Hash()(aKey) & kSlotMask;
+
+        while (mUsed[index] && !(KeyOf()(Slot(index)) == aKey))
+        {
+            index = (index + 1) & kSlotMask;
+        }
+
+        if (mUsed[index])
+        {
+            return std::make_pair(index, false);
+        }
+
+        if (full())
+        {
+            index = kNoSlot;
+            return std::make_pair(index, false);
+        }
+
+        new (&Slot(index)) Value(std::forward<Args>(aArgs)...);
+        mUsed[index] = true;
+        mSize++;
+
+        return std::make_pair(index, true);
+    }
+
+    // Removes the element of a slot, the slot then holds the next element of the iteration if any was moved back.
+    void EraseSlot(size_t aIndex)
+    {
+        size_t hole = aIndex;
+
+        Slot(hole).~Value();
+        mUsed[hole] = false;
+        mSize--;
+
+        for (size_t index = (hole + 1) & kSlotMask; mUsed[index]; index = (index + 1) & kSlotMask)
+        {
+            size_t home = Hash()(KeyOf()(Slot(index))) & kSlotMask;
+
+            // Elements whose home is cyclically within (hole, index] stay.
+            if (hole <= index ? (hole < home && home <= index) : (hole < home || home <= index))
+            {
+                continue;
+            }
+
+            new (&Slot(hole)) Value(std::move(Slot(index)));
+            Slot(index).~Value();
+            mUsed[hole]  = true;
+            mUsed[index] = false;
+            hole         = index;
+        }
+    }
+
+    // Returns the iterator following the element erased at the slot of @p aIterator.
+    template <typename Iter> Iter EraseAt(Iter aIterator)
+    {
+        EraseSlot(aIterator.mIndex);
+        aIterator.Advance(/* aSkipCurrent */ false);
+
+        return aIterator;
+    }
+
+    Value &      Slot(size_t aIndex) { return *reinterpret_cast<Value *>(&mSlots[aIndex]); }
+    const Value &Slot(size_t aIndex) const { return *reinterpret_cast<const Value *>(&mSlots[aIndex]); }
+
+private:
+    // Returns the slot following an empty slot, clusters never wrap around it.
+    size_t StartSlot(void) const
+    {
+        size_t index = 0;
+
+        while (mUsed[(index - 1) & kSlotMask])
+        {
+            index++;
+        }
+
+        return index;
+    }
+
+    typename std::aligned_storage<sizeof(Value), alignof(Value)>::type mSlots[kNumSlots];
+    size_t                                                             mSize;
+    bool                                                               mUsed[kNumSlots];
+};
+
+/**
+ * This structure returns an element as its key.
+ *
+ */
+template <typename Key> struct FixedIdentity
+{
+    const Key &operator()(const Key &aKey) const { return aKey; }
+};
+
+/**
+ * This structure returns the first member of a pair as its key.
+ *
+ */
+template <typename Pair> struct FixedFirst
+{
+    const typename Pair::first_type &operator()(const Pair &aPair) const { return aPair.first; }
+};
+
+/**
+ * This class template implements an unordered set of at most @p kCapacity keys stored inline.
+ *
+ * Only the part of the `std::unordered_set` interface used by the subsystems is provided.
+ *
+ */
+template <typename Key, size_t kCapacity, typename Hash = std::hash<Key>>
+class FixedHashSet : public FixedHashTable<Key, Key, FixedIdentity<Key>, kCapacity, Hash>
+{
+    typedef FixedHashTable<Key, Key, FixedIdentity<Key>, kCapacity, Hash> Table;
+
+public:
+    typedef typename Table::template Iterator<const Table, const Key &> const_iterator;
+    typedef const_iterator                                              iterator;
+
+    const_iterator begin(void) const { return Table::template Begin<const_iterator>(); }
+    const_iterator end(void) const { return const_iterator(); }
+
+    const_iterator find(const Key &aKey) const
+    {
+        size_t index = Table::FindSlot(aKey);
+
+        return index != Table::kNoSlot ? Table::template MakeIterator<const_iterator>(index) : end();
+    }
+
+    /**
+     * This method inserts a key unless it is in the set already.
+     *
+     * @param[in]   aKey    The key.
+     *
+     * @returns The iterator of the key, `end()` if the set is full, and whether it is inserted.
+     *
+     */
+    std::pair<const_iterator, bool> insert(const Key &aKey)
+    {
+        std::pair<size_t, bool> result = Table::Emplace(aKey, aKey);
+        const_iterator          it     = end();
+
+        if (result.first != Table::kNoSlot)
+        {
+            it = Table::template MakeIterator<const_iterator>(result.first);
+        }
+
+        return std::make_pair(it, result.second);
+    }
+
+    using Table::erase;
+
+    const_iterator erase(const_iterator aPosition) { return Table::EraseAt(aPosition); }
+};
+
+/**
+ * This class template implements an unordered map of at most @p kCapacity keys stored inline.
+ *
+ * Only the part of the `std::unordered_map` interface used by the subsystems is provided.
+ *
+ */
+template <typename Key, typename T, size_t kCapacity, typename Hash = std::hash<Key>>
+class FixedHashMap
+    : public FixedHashTable<std::pair<const Key, T>, Key, FixedFirst<std::pair<const Key, T>>, kCapacity, Hash>
+{
+    typedef FixedHashTable<std::pair<const Key, T>, Key, FixedFirst<std::pair<const Key, T>>, kCapacity, Hash> Table;
+
+public:
+    typedef T                                                                               mapped_type;
+    typedef typename Table::template Iterator<Table, std::pair<const Key, T> &>             iterator;
+    typedef typename Table::template Iterator<const Table, const std::pair<const Key, T> &> const_iterator;
+
+    iterator       begin(void) { return Table::template Begin<iterator>(); }
+    iterator       end(void) { return iterator(); }
+    const_iterator begin(void) const { return Table::template Begin<const_iterator>(); }
+    const_iterator end(void) const { return const_iterator(); }
+
+    iterator find(const Key &aKey)
+    {
+        size_t index = Table::FindSlot(aKey);
+
+        return index != Table::kNoSlot ? Table::template MakeIterator<iterator>(index) : end();
+    }
+
+    const_iterator find(const Key &aKey) const
+    {
+        size_t index = Table::FindSlot(aKey);
+
+        return index != Table::kNoSlot ? Table::template MakeIterator<const_iterator>(index) : end();
+    }
+
+    /**
+     * This method returns the value of a key, inserting a value-initialized one if not found.
+     *
+     * The map must not be full when the key is not found.
+     *
+     * @param[in]   aKey    The key.
+     *
+     * @returns A reference to the value.
+     *
+     */
+    T &operator[](const Key &aKey)
+    {
+        std::pair<size_t, bool> result = Table::Emplace(aKey, aKey, T());
+
+        assert(result.first != Table::kNoSlot);
+        return Table::Slot(result.first).second;
+    }
+
+    using Table::erase;
+
+    iterator erase(iterator aPosition) { return Table::EraseAt(aPosition); }
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_FIXED_CONTAINERS_HPP_
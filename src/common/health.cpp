@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the health of otbr-agent.
+ */
+
+#include "common/health.hpp"
+
+#include <chrono>
+
+namespace otbr {
+
+Health &Health::Get(void)
+{
+    static Health sHealth;
+
+    return sHealth;
+}
+
+const char *Health::GetName(Subsystem aSubsystem)
+{
+    static const char *const kNames[kNumSubsystems] = {"ncp", "rest", "dbus", "mdns"};
+
+    return aSubsystem < kNumSubsystems ? kNames[aSubsystem] : "unknown";
+}
+
+Health::Health(void)
+    : mHeartbeat(Now())
+    , mRadioActivity(-1)
+    , mReported(0)
+    , mReady(0)
+{
+    static_assert(kNumSubsystems <= 8, "the subsystems must fit in the bit masks");
+}
+
+int64_t Health::Now(void)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint32_t Health::GetAge(int64_t aNow, int64_t aTime)
+{
+    int64_t age = aNow - aTime;
+
+    return aTime < 0 ? UINT32_MAX : static_cast<uint32_t>(age < 0 ? 0 : (age < UINT32_MAX ? age : UINT32_MAX));
+}
+
+void Health::SetReady(Subsystem aSubsystem, bool aReady)
+{
+    uint8_t bit = static_cast<uint8_t>(1U << aSubsystem);
+
+    mReported.fetch_or(bit, std::memory_order_relaxed);
+
+    if (aReady)
+    {
+        mReady.fetch_or(bit, std::memory_order_relaxed);
+    }
+    else
+    {
+        mReady.fetch_and(static_cast<uint8_t>(~bit), std::memory_order_relaxed);
+    }
+}
+
+void Health::GetStatus(Status &aStatus) const
+{
+    static constexpr uint8_t kNcpBit = 1U << kSubsystemNcp;
+
+    int64_t now = Now();
+
+    aStatus.mHeartbeatAge     = GetAge(now, mHeartbeat.load(std::memory_order_relaxed));
+    aStatus.mRadioActivityAge = GetAge(now, mRadioActivity.load(std::memory_order_relaxed));
+    aStatus.mReported         = mReported.load(std::memory_order_relaxed);
+    aStatus.mReady            = mReady.load(std::memory_order_relaxed);
+    aStatus.mLive             = aStatus.mHeartbeatAge <= OTBR_HEALTH_HEARTBEAT_TIMEOUT;
+    aStatus.mAllReady         = aStatus.mLive && (aStatus.mReady & kNcpBit) && aStatus.mReady == aStatus.mReported;
+}
+
+} // namespace otbr
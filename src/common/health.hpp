@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the health of otbr-agent.
+ */
+
+#ifndef OTBR_COMMON_HEALTH_HPP_
+#define OTBR_COMMON_HEALTH_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+
+#include <stdint.h>
+
+/**
+ * The longest time (in milliseconds) without an iteration of the mainloop before otbr-agent is unhealthy, longer
+ * than the timeout of an idle iteration.
+ *
+ */
+#ifndef OTBR_HEALTH_HEARTBEAT_TIMEOUT
+#define OTBR_HEALTH_HEARTBEAT_TIMEOUT 30000
+#endif
+
+namespace otbr {
+
+/**
+ * This class records the liveness and the readiness of otbr-agent, for probes to be answered from any thread without
+ * calling into the NCP.
+ *
+ */
+class Health
+{
+public:
+    /**
+     * This enumeration represents the subsystems reporting their readiness.
+     *
+     */
+    enum Subsystem : uint8_t
+    {
+        kSubsystemNcp  = 0, ///< The OpenThread instance and the radio.
+        kSubsystemRest = 1, ///< The REST server.
+        kSubsystemDBus = 2, ///< The D-Bus server.
+        kSubsystemMdns = 3, ///< The mDNS publisher.
+        kNumSubsystems = 4,
+    };
+
+    /**
+     * This structure represents the health of otbr-agent.
+     *
+     */
+    struct Status
+    {
+        uint32_t mHeartbeatAge;     ///< The time since the last iteration of the mainloop, in milliseconds.
+        uint32_t mRadioActivityAge; ///< The time since the radio was last readable, UINT32_MAX if never.
+        uint8_t  mReported;         ///< The bit mask of the subsystems which reported their readiness.
+        uint8_t  mReady;            ///< The bit mask of the subsystems which are ready.
+        bool     mLive;             ///< Whether the mainloop iterated within `OTBR_HEALTH_HEARTBEAT_TIMEOUT`.
+        bool     mAllReady;         ///< Whether the NCP and all the other subsystems reporting are ready.
+    };
+
+    /**
+     * This method returns the health of the process.
+     *
+     * @returns A reference to the health.
+     *
+     */
+    static Health &Get(void);
+
+    /**
+     * This method returns the name of a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     *
+     * @returns A C string of the name, in lower case.
+     *
+     */
+    static const char *GetName(Subsystem aSubsystem);
+
+    /**
+     * This method records an iteration of the mainloop.
+     *
+     */
+    void Heartbeat(void) { mHeartbeat.store(Now(), std::memory_order_relaxed); }
+
+    /**
+     * This method records that the radio was readable.
+     *
+     */
+    void RecordRadioActivity(void) { mRadioActivity.store(Now(), std::memory_order_relaxed); }
+
+    /**
+     * This method records the readiness of a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     * @param[in]   aReady      Whether the subsystem is ready.
+     *
+     */
+    void SetReady(Subsystem aSubsystem, bool aReady);
+
+    /**
+     * This method returns the health of otbr-agent.
+     *
+     * @param[out]  aStatus     The health.
+     *
+     */
+    void GetStatus(Status &aStatus) const;
+
+private:
+    Health(void);
+
+    static int64_t  Now(void);
+    static uint32_t GetAge(int64_t aNow, int64_t aTime);
+
+    std::atomic<int64_t> mHeartbeat;
+    std::atomic<int64_t> mRadioActivity;
+    std::atomic<uint8_t> mReported;
+    std::atomic<uint8_t> mReady;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_HEALTH_HPP_
@@ -38,10 +38,123 @@
 #include <sys/time.h>
 #include <syslog.h>
 
+#if OTBR_ENABLE_LOG_ASYNC
+#include <atomic>
+#include <thread>
+
+#include <semaphore.h>
+#endif
+
 #include "common/time.hpp"
+#include "common/trace.hpp"
 
 static int sLevel = LOG_INFO;
 
+#if OTBR_ENABLE_LOG_ASYNC
+static_assert((OTBR_LOG_ASYNC_RECORDS & (OTBR_LOG_ASYNC_RECORDS - 1)) == 0,
+              "The number of log records is not a power of 2");
+
+/**
+ * A slot of the log ring, whose sequence tells which position of the ring it holds.
+ *
+ * The slot at position N is free to be written when its sequence is N, and ready to be read when its sequence is
+ * N + 1. Reading it sets the sequence to N + OTBR_LOG_ASYNC_RECORDS, the next position of the slot.
+ *
+ */
+struct LogRecord
+{
+    std::atomic<uint32_t> mSequence;
+    int                   mLevel;
+    char                  mMessage[OTBR_LOG_ASYNC_RECORD_SIZE];
+};
+
+static LogRecord             sLogRecords[OTBR_LOG_ASYNC_RECORDS];
+static std::atomic<uint32_t> sLogWritePosition(0);
+static uint32_t              sLogReadPosition = 0; ///< Only accessed by the thread reading the ring.
+static std::atomic<uint32_t> sLogDropped(0);
+static std::atomic<bool>     sLogRunning(false);
+static sem_t                 sLogPending; ///< Never destroyed, a late log may still post it after deinit.
+static bool                  sLogPendingInitialized = false;
+static std::thread           sLogThread;
+
+/** Queue a log record for the log thread, any thread can queue without locking */
+static bool LogQueue(int aLevel, const char *aFormat, va_list ap)
+{
+    uint32_t   position = sLogWritePosition.load(std::memory_order_relaxed);
+    LogRecord *record;
+
+    for (;;)
+    {
+        int32_t distance;
+
+        record   = &sLogRecords[position % OTBR_LOG_ASYNC_RECORDS];
+        distance = static_cast<int32_t>(record->mSequence.load(std::memory_order_acquire) - position);
+
+        if (distance == 0)
+        {
+            if (sLogWritePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (distance < 0)
+        {
+            // The slot still holds the record of the previous round, the ring is full.
+            return false;
+        }
+        else
+        {
+            position = sLogWritePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->mLevel = aLevel;
+    vsnprintf(record->mMessage, sizeof(record->mMessage), aFormat, ap);
+    record->mSequence.store(position + 1, std::memory_order_release);
+    sem_post(&sLogPending);
+
+    return true;
+}
+
+/** Write the queued log records to syslog, in the order they were queued */
+static void LogFlush(void)
+{
+    uint32_t dropped;
+
+    for (;;)
+    {
+        LogRecord &record = sLogRecords[sLogReadPosition % OTBR_LOG_ASYNC_RECORDS];
+
+        if (record.mSequence.load(std::memory_order_acquire) != sLogReadPosition + 1)
+        {
+            break;
+        }
+
+        syslog(record.mLevel, "%s", record.mMessage);
+        record.mSequence.store(sLogReadPosition + OTBR_LOG_ASYNC_RECORDS, std::memory_order_release);
+        sLogReadPosition++;
+    }
+
+    if ((dropped = sLogDropped.exchange(0, std::memory_order_relaxed)) != 0)
+    {
+        syslog(LOG_WARNING, "%u log records dropped, the log queue was full", dropped);
+        otbrTrace(OTBR_TRACE_LOG_DROPPED, dropped);
+    }
+}
+
+static void LogThread(void)
+{
+    do
+    {
+        while (sem_wait(&sLogPending) != 0 && errno == EINTR)
+        {
+        }
+
+        LogFlush();
+    } while (sLogRunning.load(std::memory_order_acquire));
+}
+#endif // OTBR_ENABLE_LOG_ASYNC
+
 /** Get the current debug log level */
 int otbrLogGetLevel(void)
 {
@@ -56,10 +169,30 @@ void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr)
 
     openlog(aIdent, (LOG_CONS | LOG_PID) | (aPrintStderr ? LOG_PERROR : 0), LOG_USER);
     sLevel = aLevel;
+
+#if OTBR_ENABLE_LOG_ASYNC
+    if (!sLogRunning.load(std::memory_order_relaxed))
+    {
+        for (uint32_t i = 0; i < OTBR_LOG_ASYNC_RECORDS; i++)
+        {
+            sLogRecords[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+        sLogWritePosition.store(0, std::memory_order_relaxed);
+        sLogReadPosition = 0;
+
+        if (!sLogPendingInitialized)
+        {
+            sem_init(&sLogPending, 0, 0);
+            sLogPendingInitialized = true;
+        }
+        sLogRunning.store(true, std::memory_order_release);
+        sLogThread = std::thread(LogThread);
+    }
+#endif
 }
 
 /** log to the syslog or log file */
-void otbrLog(int aLevel, const char *aFormat, ...)
+void(otbrLog)(int aLevel, const char *aFormat, ...)
 {
     va_list ap;
 
@@ -75,7 +208,19 @@ void otbrLogv(int aLevel, const char *aFormat, va_list ap)
 
     if (aLevel <= sLevel)
     {
+#if OTBR_ENABLE_LOG_ASYNC
+        // Logs before the log thread starts or after it stops are written directly.
+        if (!sLogRunning.load(std::memory_order_acquire))
+        {
+            vsyslog(aLevel, aFormat, ap);
+        }
+        else if (!LogQueue(aLevel, aFormat, ap))
+        {
+            sLogDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+#else
         vsyslog(aLevel, aFormat, ap);
+#endif
     }
 }
 
@@ -126,7 +271,7 @@ void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize
         }
         *ch = 0;
 
-        syslog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
+        otbrLog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
     }
 }
 
@@ -181,5 +326,14 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+#if OTBR_ENABLE_LOG_ASYNC
+    if (sLogRunning.exchange(false, std::memory_order_acq_rel))
+    {
+        sem_post(&sLogPending);
+        sLogThread.join();
+        LogFlush();
+    }
+#endif
+
     closelog();
 }
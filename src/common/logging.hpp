@@ -36,6 +36,24 @@
 
 #include "common/types.hpp"
 
+#if OTBR_ENABLE_LOG_ASYNC
+/**
+ * The number of log records queued for the background thread, further records are dropped and counted.
+ *
+ */
+#ifndef OTBR_LOG_ASYNC_RECORDS
+#define OTBR_LOG_ASYNC_RECORDS 256
+#endif
+
+/**
+ * The maximum length of a queued log record including the null terminator, longer records are truncated.
+ *
+ */
+#ifndef OTBR_LOG_ASYNC_RECORD_SIZE
+#define OTBR_LOG_ASYNC_RECORD_SIZE 256
+#endif
+#endif // OTBR_ENABLE_LOG_ASYNC
+
 /**
  * Logging level, which is identical to syslog
  *
@@ -52,11 +70,27 @@ enum
     OTBR_LOG_DEBUG,   /* debug-level messages */
 };
 
+/**
+ * The highest log level built in, logs of a higher level are compiled out along with their arguments.
+ *
+ */
+#ifndef OTBR_LOG_MAX_LEVEL
+#define OTBR_LOG_MAX_LEVEL OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level
  */
 int otbrLogGetLevel(void);
 
+/**
+ * This macro indicates whether logs at level @p aLevel are written.
+ *
+ * @param[in]   aLevel  Log level of the logger.
+ *
+ */
+#define otbrLogIsEnabled(aLevel) ((aLevel) <= OTBR_LOG_MAX_LEVEL && (aLevel) <= otbrLogGetLevel())
+
 /**
  * Control log to syslog
  *
@@ -68,6 +102,9 @@ void otbrLogEnableSyslog(bool aEnabled);
 /**
  * This function initialize the logging service.
  *
+ * With OTBR_ENABLE_LOG_ASYNC, this function starts the thread writing the logs to syslog, which lets the callers
+ * return without waiting for syslog.
+ *
  * @param[in]   aIdent          Identity of the logger.
  * @param[in]   aLevel          Log level of the logger.
  * @param[in]   aPrintStderr    Whether to log to stderr.
@@ -82,7 +119,19 @@ void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr);
  * @param[in]   aFormat Format string as in printf.
  *
  */
-void otbrLog(int aLevel, const char *aFormat, ...);
+void(otbrLog)(int aLevel, const char *aFormat, ...);
+
+/**
+ * This macro log at level @p aLevel, the arguments are only evaluated if the log is written.
+ *
+ * @p aLevel may be evaluated twice.
+ *
+ * @param[in]   aLevel  Log level of the logger.
+ * @param[in]   aFormat Format string as in printf.
+ *
+ */
+#define otbrLog(aLevel, aFormat, ...) \
+    (otbrLogIsEnabled(aLevel) ? (otbrLog)((aLevel), aFormat, ##__VA_ARGS__) : (void)0)
 
 /**
  * This macro log a action result according to @p aError.
@@ -135,6 +184,8 @@ const char *otbrErrorString(otbrError aError);
 /**
  * This function deinitializes the logging service.
  *
+ * The queued logs are written before this function returns.
+ *
  */
 void otbrLogDeinit(void);
 
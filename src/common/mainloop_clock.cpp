@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the clock of the mainloop.
+ */
+
+#include "common/mainloop_clock.hpp"
+
+#include <time.h>
+
+namespace otbr {
+
+namespace {
+
+// The time sampled by the mainloop of the calling thread, the epoch when never sampled.
+thread_local MainloopClock::Clock::time_point sNow;
+
+} // namespace
+
+MainloopClock::Clock::time_point MainloopClock::Update(void)
+{
+    sNow = Read();
+
+    return sNow;
+}
+
+MainloopClock::Clock::time_point MainloopClock::Now(void)
+{
+    return (sNow == Clock::time_point()) ? Clock::now() : sNow;
+}
+
+void MainloopClock::Reset(void)
+{
+    sNow = Clock::time_point();
+}
+
+MainloopClock::Clock::time_point MainloopClock::Read(void)
+{
+#if OTBR_ENABLE_MAINLOOP_COARSE_CLOCK && defined(CLOCK_MONOTONIC_COARSE)
+    // The steady clock is the monotonic clock on Linux, the coarse one has the same epoch.
+    timespec now;
+
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &now) == 0)
+    {
+        return Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(now.tv_sec) +
+                                                                              std::chrono::nanoseconds(now.tv_nsec)));
+    }
+#endif
+
+    return Clock::now();
+}
+
+} // namespace otbr
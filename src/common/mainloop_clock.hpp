@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the clock of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_CLOCK_HPP_
+#define OTBR_COMMON_MAINLOOP_CLOCK_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+
+namespace otbr {
+
+/**
+ * This class implements the clock of the mainloop of the calling thread.
+ *
+ * The clock is sampled once when the mainloop wakes up, and once before it computes its timeout, so that all
+ * subsystems processed in between read the same time and compute consistent deadlines without reading the clock
+ * themselves. A thread that doesn't run a mainloop, e.g. a worker, reads the clock each time.
+ *
+ * With `OTBR_ENABLE_MAINLOOP_COARSE_CLOCK` the mainloop samples the coarse monotonic clock, which is cheaper but late
+ * by up to a scheduler tick, so deadlines are too. Measured durations, e.g. latencies, keep reading `Clock::now()`.
+ *
+ */
+class MainloopClock
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * This method samples the clock of the mainloop of the calling thread.
+     *
+     * @returns The sampled time.
+     *
+     */
+    static Clock::time_point Update(void);
+
+    /**
+     * This method returns the time sampled by the mainloop of the calling thread.
+     *
+     * @returns The sampled time, or the current time if the calling thread never sampled the clock.
+     *
+     */
+    static Clock::time_point Now(void);
+
+    /**
+     * This method forgets the time sampled by the mainloop of the calling thread, until it samples the clock again.
+     *
+     * A thread leaving its mainloop calls it, so that the timers started before the next mainloop are not due early.
+     *
+     */
+    static void Reset(void);
+
+private:
+    static Clock::time_point Read(void);
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_CLOCK_HPP_
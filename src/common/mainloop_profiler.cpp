@@ -0,0 +1,236 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the profiler of the mainloop.
+ */
+
+#include "common/mainloop_profiler.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+static const char *const kSubsystemNames[] = {"agent", "poller", "timer", "dbus", "rest", "ubus"};
+
+static_assert(sizeof(kSubsystemNames) / sizeof(kSubsystemNames[0]) == MainloopProfiler::kNumSubsystems,
+              "Subsystem names do not match the subsystems");
+
+volatile sig_atomic_t MainloopProfiler::sDumpRequested = 0;
+
+MainloopProfiler &MainloopProfiler::Get(void)
+{
+    static MainloopProfiler sProfiler;
+
+    return sProfiler;
+}
+
+MainloopProfiler::MainloopProfiler(void)
+    : mIdleTimeouts(0)
+    , mInterrupts(0)
+    , mTimeoutOwner(kNumSubsystems)
+    , mBeginTime(Clock::now())
+{
+    memset(mTimes, 0, sizeof(mTimes));
+    memset(mLatencies, 0, sizeof(mLatencies));
+    memset(&mSelect, 0, sizeof(mSelect));
+    memset(mWakeups, 0, sizeof(mWakeups));
+    memset(mTimeouts, 0, sizeof(mTimeouts));
+    memset(mSpins, 0, sizeof(mSpins));
+    memset(mFdOwners, kNumSubsystems, sizeof(mFdOwners));
+    memset(&mTimeout, 0, sizeof(mTimeout));
+    memset(&mSelectTimeout, 0, sizeof(mSelectTimeout));
+    FD_ZERO(&mReadFdSet);
+    FD_ZERO(&mWriteFdSet);
+    FD_ZERO(&mErrorFdSet);
+}
+
+void MainloopProfiler::Stats::Add(uint64_t aValue)
+{
+    mCount++;
+    mSum += aValue;
+    mMax = (aValue > mMax ? aValue : mMax);
+}
+
+uint64_t MainloopProfiler::ToMicroseconds(Clock::duration aDuration)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(aDuration).count());
+}
+
+void MainloopProfiler::Start(Phase aPhase, const otSysMainloopContext &aMainloop)
+{
+    if (aPhase == kPhaseUpdate)
+    {
+        mReadFdSet  = aMainloop.mReadFdSet;
+        mWriteFdSet = aMainloop.mWriteFdSet;
+        mErrorFdSet = aMainloop.mErrorFdSet;
+        mTimeout    = aMainloop.mTimeout;
+    }
+
+    mStartTime = Clock::now();
+}
+
+void MainloopProfiler::Stop(Subsystem aSubsystem, Phase aPhase, const otSysMainloopContext &aMainloop)
+{
+    Clock::time_point now = Clock::now();
+
+    mTimes[aSubsystem][aPhase].Add(ToMicroseconds(now - mStartTime));
+
+    if (aPhase == kPhaseUpdate)
+    {
+        // The file descriptors added by this subsystem.
+        for (int fd = 0; fd <= aMainloop.mMaxFd && fd < FD_SETSIZE; fd++)
+        {
+            if ((FD_ISSET(fd, &aMainloop.mReadFdSet) && !FD_ISSET(fd, &mReadFdSet)) ||
+                (FD_ISSET(fd, &aMainloop.mWriteFdSet) && !FD_ISSET(fd, &mWriteFdSet)) ||
+                (FD_ISSET(fd, &aMainloop.mErrorFdSet) && !FD_ISSET(fd, &mErrorFdSet)))
+            {
+                mFdOwners[fd] = aSubsystem;
+            }
+        }
+
+        // The final timeout is the shortest one, which is set by the last subsystem shortening it.
+        if (IsShorter(aMainloop.mTimeout, mTimeout))
+        {
+            mTimeoutOwner  = aSubsystem;
+            mSelectTimeout = aMainloop.mTimeout;
+        }
+    }
+    else
+    {
+        mLatencies[aSubsystem].Add(ToMicroseconds(mStartTime - mSelectTime));
+    }
+}
+
+void MainloopProfiler::BeginSelect(void)
+{
+    mSelectTime = Clock::now();
+}
+
+void MainloopProfiler::EndSelect(const otSysMainloopContext &aMainloop, int aResult)
+{
+    Clock::time_point now = Clock::now();
+    bool              woken[kNumSubsystems + 1];
+
+    mSelect.Add(ToMicroseconds(now - mSelectTime));
+    mSelectTime = now;
+
+    if (aResult > 0)
+    {
+        memset(woken, 0, sizeof(woken));
+
+        for (int fd = 0; fd <= aMainloop.mMaxFd && fd < FD_SETSIZE; fd++)
+        {
+            if (FD_ISSET(fd, &aMainloop.mReadFdSet) || FD_ISSET(fd, &aMainloop.mWriteFdSet) ||
+                FD_ISSET(fd, &aMainloop.mErrorFdSet))
+            {
+                woken[mFdOwners[fd]] = true;
+            }
+        }
+
+        for (size_t subsystem = 0; subsystem < kNumSubsystems; subsystem++)
+        {
+            mWakeups[subsystem] += woken[subsystem];
+        }
+    }
+    else if (aResult == 0)
+    {
+        if (mTimeoutOwner < kNumSubsystems)
+        {
+            mTimeouts[mTimeoutOwner]++;
+        }
+        else
+        {
+            mIdleTimeouts++;
+        }
+    }
+    else if (errno == EINTR)
+    {
+        mInterrupts++;
+    }
+
+    if (mTimeoutOwner < kNumSubsystems && mSelectTimeout.tv_sec == 0 && mSelectTimeout.tv_usec == 0)
+    {
+        mSpins[mTimeoutOwner]++;
+    }
+
+    mTimeoutOwner = kNumSubsystems;
+}
+
+void MainloopProfiler::Dump(void)
+{
+    uint64_t elapsed  = ToMicroseconds(Clock::now() - mBeginTime);
+    uint64_t timeouts = mIdleTimeouts;
+
+    sDumpRequested = 0;
+
+    for (uint64_t count : mTimeouts)
+    {
+        timeouts += count;
+    }
+
+    otbrLog(OTBR_LOG_INFO,
+            "Mainloop profile of %llu ms: %llu iterations (%llu per minute), %llu timeouts (%llu default), %llu "
+            "interrupts",
+            static_cast<unsigned long long>(elapsed / 1000), static_cast<unsigned long long>(mSelect.mCount),
+            static_cast<unsigned long long>(elapsed > 0 ? mSelect.mCount * 60000000 / elapsed : 0),
+            static_cast<unsigned long long>(timeouts), static_cast<unsigned long long>(mIdleTimeouts),
+            static_cast<unsigned long long>(mInterrupts));
+    otbrLog(OTBR_LOG_INFO, "Mainloop select: %llu ms blocked, %llu us average, %llu us max",
+            static_cast<unsigned long long>(mSelect.mSum / 1000), static_cast<unsigned long long>(mSelect.GetAverage()),
+            static_cast<unsigned long long>(mSelect.mMax));
+
+    for (size_t subsystem = 0; subsystem < kNumSubsystems; subsystem++)
+    {
+        const Stats &update  = mTimes[subsystem][kPhaseUpdate];
+        const Stats &process = mTimes[subsystem][kPhaseProcess];
+        const Stats &latency = mLatencies[subsystem];
+
+        if (update.mCount == 0 && process.mCount == 0)
+        {
+            continue;
+        }
+
+        otbrLog(OTBR_LOG_INFO,
+                "Mainloop %s: %llu wakeups, %llu timeouts, %llu spins, update %llu/%llu us, process %llu/%llu us, "
+                "%llu ms total, latency %llu/%llu us (average/max)",
+                kSubsystemNames[subsystem], static_cast<unsigned long long>(mWakeups[subsystem]),
+                static_cast<unsigned long long>(mTimeouts[subsystem]),
+                static_cast<unsigned long long>(mSpins[subsystem]),
+                static_cast<unsigned long long>(update.GetAverage()), static_cast<unsigned long long>(update.mMax),
+                static_cast<unsigned long long>(process.GetAverage()), static_cast<unsigned long long>(process.mMax),
+                static_cast<unsigned long long>((update.mSum + process.mSum) / 1000),
+                static_cast<unsigned long long>(latency.GetAverage()), static_cast<unsigned long long>(latency.mMax));
+    }
+}
+
+} // namespace otbr
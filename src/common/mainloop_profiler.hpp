@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the profiler of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_PROFILER_HPP_
+#define OTBR_COMMON_MAINLOOP_PROFILER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+
+#include <signal.h>
+#include <stdint.h>
+
+#include "common/mainloop.h"
+
+namespace otbr {
+
+/**
+ * This class profiles the iterations of the select() based mainloop.
+ *
+ * The wall-clock time each subsystem spends in updating the file descriptor sets and in processing is recorded, as
+ * well as the time from select() returning to each subsystem being processed, and the reasons of waking up. A
+ * wakeup is attributed to a subsystem when any of the file descriptors it added to the sets is ready, and a timeout
+ * to the subsystem which shortened the timeout last, so that the sources of the wakeups of an idle agent are known.
+ * Iterations whose timeout is zero are counted as spins of the subsystem zeroing it, as they do not wait at all.
+ *
+ */
+class MainloopProfiler
+{
+public:
+    /**
+     * The subsystems driven by the mainloop.
+     *
+     */
+    enum Subsystem : uint8_t
+    {
+        kSubsystemAgent       = 0, ///< The agent instance, including OpenThread.
+        kSubsystemEventPoller = 1, ///< The file descriptors registered to the event poller.
+        kSubsystemTimer       = 2, ///< The timers.
+        kSubsystemDBus        = 3, ///< The D-Bus server.
+        kSubsystemRest        = 4, ///< The REST server.
+        kSubsystemUbus        = 5, ///< The ubus server.
+        kNumSubsystems        = 6,
+    };
+
+    /**
+     * The phases of a mainloop iteration.
+     *
+     */
+    enum Phase : uint8_t
+    {
+        kPhaseUpdate  = 0, ///< Updating the file descriptor sets and the timeout.
+        kPhaseProcess = 1, ///< Processing after select() returned.
+        kNumPhases    = 2,
+    };
+
+    /**
+     * This method returns the singleton profiler.
+     *
+     * @returns A reference to the profiler.
+     *
+     */
+    static MainloopProfiler &Get(void);
+
+    /**
+     * This function requests the profile to be logged, it is safe to call from a signal handler.
+     *
+     */
+    static void RequestDump(void) { sDumpRequested = 1; }
+
+    /**
+     * This method indicates whether the profile is requested to be logged.
+     *
+     */
+    bool IsDumpRequested(void) const { return sDumpRequested != 0; }
+
+    /**
+     * This method logs the profile since the start of the mainloop.
+     *
+     */
+    void Dump(void);
+
+    /**
+     * This method starts measuring a subsystem.
+     *
+     * @param[in]   aPhase      The phase of the mainloop iteration.
+     * @param[in]   aMainloop   A reference to the mainloop context.
+     *
+     */
+    void Start(Phase aPhase, const otSysMainloopContext &aMainloop);
+
+    /**
+     * This method stops measuring a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem measured since the last call to `Start()`.
+     * @param[in]   aPhase      The phase of the mainloop iteration.
+     * @param[in]   aMainloop   A reference to the mainloop context.
+     *
+     */
+    void Stop(Subsystem aSubsystem, Phase aPhase, const otSysMainloopContext &aMainloop);
+
+    /**
+     * This method is called before select() is called.
+     *
+     */
+    void BeginSelect(void);
+
+    /**
+     * This method is called after select() returned.
+     *
+     * @param[in]   aMainloop   A reference to the mainloop context.
+     * @param[in]   aResult     The return value of select().
+     *
+     */
+    void EndSelect(const otSysMainloopContext &aMainloop, int aResult);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Stats
+    {
+        uint64_t mCount; ///< Number of samples.
+        uint64_t mSum;   ///< Sum of the samples, in microseconds.
+        uint64_t mMax;   ///< Maximum sample, in microseconds.
+
+        void     Add(uint64_t aValue);
+        uint64_t GetAverage(void) const { return mCount > 0 ? mSum / mCount : 0; }
+    };
+
+    MainloopProfiler(void);
+
+    static uint64_t ToMicroseconds(Clock::duration aDuration);
+    static bool     IsShorter(const timeval &aFirst, const timeval &aSecond)
+    {
+        return aFirst.tv_sec < aSecond.tv_sec || (aFirst.tv_sec == aSecond.tv_sec && aFirst.tv_usec < aSecond.tv_usec);
+    }
+
+    static volatile sig_atomic_t sDumpRequested;
+
+    Stats             mTimes[kNumSubsystems][kNumPhases];
+    Stats             mLatencies[kNumSubsystems]; ///< Time from select() returning to processing each subsystem.
+    Stats             mSelect;                    ///< Time blocked in select().
+    uint64_t          mWakeups[kNumSubsystems];   ///< Number of wakeups with ready file descriptors of each subsystem.
+    uint64_t          mTimeouts[kNumSubsystems];  ///< Number of wakeups of the timeout set by each subsystem.
+    uint64_t          mIdleTimeouts;              ///< Number of wakeups of the default timeout.
+    uint64_t          mSpins[kNumSubsystems];     ///< Number of iterations with a zero timeout of each subsystem.
+    uint64_t          mInterrupts;                ///< Number of select() calls interrupted.
+    uint8_t           mFdOwners[FD_SETSIZE];      ///< The subsystem which added each file descriptor to the sets.
+    fd_set            mReadFdSet;                 ///< The read set before the measured subsystem updated it.
+    fd_set            mWriteFdSet;                ///< The write set before the measured subsystem updated it.
+    fd_set            mErrorFdSet;                ///< The error set before the measured subsystem updated it.
+    timeval           mTimeout;                   ///< The timeout before the measured subsystem updated it.
+    timeval           mSelectTimeout;             ///< The timeout of the last subsystem shortening it.
+    uint8_t           mTimeoutOwner;              ///< The subsystem which shortened the timeout last.
+    Clock::time_point mStartTime;
+    Clock::time_point mSelectTime;
+    Clock::time_point mBeginTime;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_PROFILER_HPP_
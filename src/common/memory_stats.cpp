@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the memory accounting of the subsystems.
+ */
+
+#include "common/memory_stats.hpp"
+
+#include <algorithm>
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace otbr {
+
+MemoryStats &MemoryStats::Get(void)
+{
+    static MemoryStats sMemoryStats;
+
+    return sMemoryStats;
+}
+
+const char *MemoryStats::GetName(Subsystem aSubsystem)
+{
+    static const char *const kNames[kNumSubsystems] = {
+        "rest_connections", "diag_cache", "mdns_services", "nd_proxy", "timers", "dbus_watches", "counters_history",
+        "channel_history", "link_quality",
+    };
+
+    return aSubsystem < kNumSubsystems ? kNames[aSubsystem] : "unknown";
+}
+
+void MemoryStats::Update(Subsystem aSubsystem, size_t aBytes)
+{
+    Counter &counter = mCounters[aSubsystem];
+    size_t   peak    = counter.mPeak.load(std::memory_order_relaxed);
+
+    counter.mCurrent.store(aBytes, std::memory_order_relaxed);
+
+    while (peak < aBytes && !counter.mPeak.compare_exchange_weak(peak, aBytes, std::memory_order_relaxed))
+    {
+    }
+}
+
+MemoryStats::Usage MemoryStats::GetUsage(Subsystem aSubsystem) const
+{
+    const Counter &counter = mCounters[aSubsystem];
+
+    return Usage{counter.mCurrent.load(std::memory_order_relaxed), counter.mPeak.load(std::memory_order_relaxed)};
+}
+
+void MemoryStats::GetProcessUsage(Usage &aUsage)
+{
+    FILE *        statm    = fopen("/proc/self/statm", "r");
+    long          pageSize = sysconf(_SC_PAGESIZE);
+    unsigned long size;
+    unsigned long resident;
+    struct rusage rusage;
+
+    aUsage.mCurrent = 0;
+    aUsage.mPeak    = 0;
+
+    if (statm != nullptr)
+    {
+        if (fscanf(statm, "%lu %lu", &size, &resident) == 2 && pageSize > 0)
+        {
+            aUsage.mCurrent = resident * static_cast<size_t>(pageSize);
+        }
+        fclose(statm);
+    }
+
+    if (getrusage(RUSAGE_SELF, &rusage) == 0)
+    {
+        // The maximum resident set size is reported in kilobytes.
+        aUsage.mPeak = std::max(aUsage.mCurrent, static_cast<size_t>(rusage.ru_maxrss) * 1024);
+    }
+}
+
+} // namespace otbr
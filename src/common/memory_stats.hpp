@@ -0,0 +1,215 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the memory accounting of the subsystems.
+ */
+
+#ifndef OTBR_COMMON_MEMORY_STATS_HPP_
+#define OTBR_COMMON_MEMORY_STATS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/fixed_containers.hpp"
+
+namespace otbr {
+
+/**
+ * This class records the memory held by each subsystem, and its peak since the start.
+ *
+ * Subsystems report an estimate of the heap memory of their containers whenever it changes, so that a growing
+ * resident set could be attributed without a heap profiler. The estimates count the elements and the bookkeeping of
+ * the containers, not the allocator overhead. Subsystems may report from any thread.
+ *
+ */
+class MemoryStats
+{
+public:
+    /**
+     * This enumeration represents the subsystems accounted.
+     *
+     */
+    enum Subsystem : uint8_t
+    {
+        kSubsystemRestConnections = 0, ///< The connections of the REST server and their buffers.
+        kSubsystemDiagCache       = 1, ///< The network diagnostics stored by the REST server.
+        kSubsystemMdnsServices    = 2, ///< The services published and the instances cached by the mDNS publisher.
+        kSubsystemNdProxy         = 3, ///< The DUAs proxied by the ND Proxy and their multicast groups.
+        kSubsystemTimers          = 4, ///< The heap of running timers and the posted tasks.
+        kSubsystemDbusWatches     = 5, ///< The watches of the D-Bus connection.
+        kSubsystemCountersHistory = 6, ///< The history of the MAC and IPv6 counters.
+        kSubsystemChannelHistory  = 7, ///< The history of the channel occupancy.
+        kSubsystemLinkQuality     = 8, ///< The link quality statistics of the neighbors.
+        kNumSubsystems            = 9,
+    };
+
+    /**
+     * This structure represents the memory usage of a subsystem or of the process.
+     *
+     */
+    struct Usage
+    {
+        size_t mCurrent; ///< The number of bytes held now.
+        size_t mPeak;    ///< The highest number of bytes held.
+    };
+
+    /**
+     * This method returns the memory accounting of the process.
+     *
+     * @returns A reference to the memory accounting.
+     *
+     */
+    static MemoryStats &Get(void);
+
+    /**
+     * This method returns the name of a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     *
+     * @returns A C string of the name, in lower case with underscores.
+     *
+     */
+    static const char *GetName(Subsystem aSubsystem);
+
+    /**
+     * This method records the memory held by a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     * @param[in]   aBytes      The number of bytes the subsystem holds now.
+     *
+     */
+    void Update(Subsystem aSubsystem, size_t aBytes);
+
+    /**
+     * This method returns the memory usage of a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     *
+     * @returns The memory usage.
+     *
+     */
+    Usage GetUsage(Subsystem aSubsystem) const;
+
+    /**
+     * This method returns the resident set size of the process, and its high-water mark.
+     *
+     * @param[out]  aUsage  The resident set size, both zero if it could not be read.
+     *
+     */
+    static void GetProcessUsage(Usage &aUsage);
+
+    /**
+     * This function estimates the memory of a hash table, not including the memory owned by its elements.
+     *
+     * @param[in]   aTable  The hash table.
+     *
+     * @returns The estimated number of bytes.
+     *
+     */
+    template <typename HashTable> static size_t HashTableSize(const HashTable &aTable)
+    {
+        return aTable.size() * (sizeof(typename HashTable::value_type) + 2 * sizeof(void *)) +
+               aTable.bucket_count() * sizeof(void *);
+    }
+
+    /**
+     * This function returns the memory of a hash set of a fixed capacity, which is held whether used or not.
+     *
+     * @param[in]   aTable  The hash set.
+     *
+     * @returns The number of bytes.
+     *
+     */
+    template <typename Key, size_t kCapacity, typename Hash>
+    static size_t HashTableSize(const FixedHashSet<Key, kCapacity, Hash> &aTable)
+    {
+        return sizeof(aTable);
+    }
+
+    /**
+     * This function returns the memory of a hash map of a fixed capacity, which is held whether used or not.
+     *
+     * @param[in]   aTable  The hash map.
+     *
+     * @returns The number of bytes.
+     *
+     */
+    template <typename Key, typename T, size_t kCapacity, typename Hash>
+    static size_t HashTableSize(const FixedHashMap<Key, T, kCapacity, Hash> &aTable)
+    {
+        return sizeof(aTable);
+    }
+
+    /**
+     * This function estimates the memory of an ordered associative container, not including the memory owned by its
+     * elements.
+     *
+     * @param[in]   aTree   The container.
+     *
+     * @returns The estimated number of bytes.
+     *
+     */
+    template <typename Tree> static size_t TreeSize(const Tree &aTree)
+    {
+        return aTree.size() * (sizeof(typename Tree::value_type) + 4 * sizeof(void *));
+    }
+
+    /**
+     * This function returns the memory of a vector or a string, not including the memory owned by its elements.
+     *
+     * @param[in]   aVector     The vector or string.
+     *
+     * @returns The number of bytes allocated.
+     *
+     */
+    template <typename Vector> static size_t VectorSize(const Vector &aVector)
+    {
+        return aVector.capacity() * sizeof(typename Vector::value_type);
+    }
+
+private:
+    struct Counter
+    {
+        std::atomic<size_t> mCurrent;
+        std::atomic<size_t> mPeak;
+    };
+
+    MemoryStats(void) = default;
+
+    Counter mCounters[kNumSubsystems];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MEMORY_STATS_HPP_
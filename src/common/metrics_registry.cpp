@@ -0,0 +1,400 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the metrics registry shared by the subsystems.
+ */
+
+#include "common/metrics_registry.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace otbr {
+
+static std::string FormatValue(uint64_t aValue, MetricsRegistry::Unit aUnit)
+{
+    char value[sizeof("18446744073709.551615")];
+
+    if (aUnit == MetricsRegistry::kUnitMicroseconds)
+    {
+        snprintf(value, sizeof(value), "%llu.%06llu", static_cast<unsigned long long>(aValue / 1000000),
+                 static_cast<unsigned long long>(aValue % 1000000));
+    }
+    else
+    {
+        snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(aValue));
+    }
+
+    return value;
+}
+
+static std::string FormatSeries(const char *aName, const char *aSuffix, const char *aLabels, const std::string &aLe)
+{
+    std::string series    = std::string(aName) + aSuffix;
+    bool        hasLabels = (aLabels != nullptr && aLabels[0] != '\0');
+
+    if (hasLabels || !aLe.empty())
+    {
+        series += '{';
+        if (hasLabels)
+        {
+            series += aLabels;
+        }
+        if (!aLe.empty())
+        {
+            series += std::string(hasLabels ? "," : "") + "le=\"" + aLe + "\"";
+        }
+        series += '}';
+    }
+
+    return series;
+}
+
+// The metrics of families are never unregistered, as readers walk the list without a lock, so they are never freed.
+template <typename MetricType, typename... ArgTypes> static MetricType *NewMetric(ArgTypes... aArgs)
+{
+    void *storage = nullptr;
+
+    // The cells are aligned to cache lines, which the `new` of C++11 does not guarantee.
+    if (posix_memalign(&storage, alignof(MetricType), sizeof(MetricType)) != 0)
+    {
+        throw std::bad_alloc();
+    }
+
+    return new (storage) MetricType(aArgs...);
+}
+
+MetricsRegistry::Metric::Metric(Type aType, const char *aName, const char *aHelp, const char *aLabels)
+    : mType(aType)
+    , mName(aName)
+    , mHelp(aHelp)
+    , mLabels(aLabels)
+    , mNext(nullptr)
+{
+}
+
+MetricsRegistry::Counter::Counter(const char *aName, const char *aHelp, const char *aLabels)
+    : Metric(kTypeCounter, aName, aHelp, aLabels)
+{
+    for (Cell &cell : mCells)
+    {
+        cell.mValue.store(0, std::memory_order_relaxed);
+    }
+
+    MetricsRegistry::Get().Register(*this);
+}
+
+uint64_t MetricsRegistry::Counter::GetValue(void) const
+{
+    uint64_t value = 0;
+
+    for (const Cell &cell : mCells)
+    {
+        value += cell.mValue.load(std::memory_order_relaxed);
+    }
+
+    return value;
+}
+
+MetricsRegistry::Gauge::Gauge(const char *aName, const char *aHelp, const char *aLabels)
+    : Metric(kTypeGauge, aName, aHelp, aLabels)
+    , mValue(0)
+{
+    MetricsRegistry::Get().Register(*this);
+}
+
+MetricsRegistry::Histogram::Histogram(const char *    aName,
+                                      const char *    aHelp,
+                                      const uint64_t *aBounds,
+                                      size_t          aNumBounds,
+                                      Unit            aUnit,
+                                      const char *    aLabels)
+    : Metric(kTypeHistogram, aName, aHelp, aLabels)
+    , mBounds(aBounds)
+    , mNumBounds(aNumBounds < kMaxBuckets ? aNumBounds : kMaxBuckets)
+    , mUnit(aUnit)
+{
+    assert(aNumBounds <= kMaxBuckets);
+
+    for (Cell &cell : mCells)
+    {
+        for (std::atomic<uint64_t> &bucket : cell.mBuckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        cell.mCount.store(0, std::memory_order_relaxed);
+        cell.mSum.store(0, std::memory_order_relaxed);
+    }
+
+    MetricsRegistry::Get().Register(*this);
+}
+
+void MetricsRegistry::Histogram::Add(uint64_t aValue)
+{
+    Cell &cell  = mCells[GetShard()];
+    auto  bound = std::lower_bound(mBounds, mBounds + mNumBounds, aValue);
+
+    // Samples above the last bound are only in the count, like the +Inf bucket.
+    if (bound != mBounds + mNumBounds)
+    {
+        cell.mBuckets[bound - mBounds].fetch_add(1, std::memory_order_relaxed);
+    }
+    cell.mCount.fetch_add(1, std::memory_order_relaxed);
+    cell.mSum.fetch_add(aValue, std::memory_order_relaxed);
+}
+
+void MetricsRegistry::Histogram::GetValue(Value &aValue) const
+{
+    memset(&aValue, 0, sizeof(aValue));
+
+    for (const Cell &cell : mCells)
+    {
+        for (size_t index = 0; index < mNumBounds; index++)
+        {
+            aValue.mBuckets[index] += cell.mBuckets[index].load(std::memory_order_relaxed);
+        }
+        aValue.mCount += cell.mCount.load(std::memory_order_relaxed);
+        aValue.mSum += cell.mSum.load(std::memory_order_relaxed);
+    }
+}
+
+MetricsRegistry::CounterFamily::CounterFamily(const char *aName, const char *aHelp)
+    : mName(aName)
+    , mHelp(aHelp)
+{
+}
+
+MetricsRegistry::Counter &MetricsRegistry::CounterFamily::Get(const std::string &aLabels)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto                        it = mCounters.find(aLabels);
+
+    if (it == mCounters.end())
+    {
+        it = mCounters.emplace(aLabels, nullptr).first;
+
+        // The key of a map node never moves, so the counter keeps pointing to it as its labels.
+        it->second = NewMetric<Counter>(mName, mHelp, it->first.c_str());
+    }
+
+    return *it->second;
+}
+
+MetricsRegistry::HistogramFamily::HistogramFamily(const char *    aName,
+                                                  const char *    aHelp,
+                                                  const uint64_t *aBounds,
+                                                  size_t          aNumBounds,
+                                                  Unit            aUnit)
+    : mName(aName)
+    , mHelp(aHelp)
+    , mBounds(aBounds)
+    , mNumBounds(aNumBounds)
+    , mUnit(aUnit)
+{
+}
+
+MetricsRegistry::Histogram &MetricsRegistry::HistogramFamily::Get(const std::string &aLabels)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto                        it = mHistograms.find(aLabels);
+
+    if (it == mHistograms.end())
+    {
+        it = mHistograms.emplace(aLabels, nullptr).first;
+        it->second = NewMetric<Histogram>(mName, mHelp, mBounds, mNumBounds, mUnit, it->first.c_str());
+    }
+
+    return *it->second;
+}
+
+std::string MetricsRegistry::FormatLabel(const char *aName, const std::string &aValue)
+{
+    std::string label = std::string(aName) + "=\"";
+
+    for (char c : aValue)
+    {
+        if (c == '\\' || c == '"')
+        {
+            label += '\\';
+            label += c;
+        }
+        else if (c == '\n')
+        {
+            label += "\\n";
+        }
+        else
+        {
+            label += c;
+        }
+    }
+
+    return label + '"';
+}
+
+MetricsRegistry &MetricsRegistry::Get(void)
+{
+    static MetricsRegistry sRegistry;
+
+    return sRegistry;
+}
+
+void MetricsRegistry::Register(Metric &aMetric)
+{
+    Metric *head = mHead.load(std::memory_order_relaxed);
+
+    // Readers walk the list without a lock, so a metric is linked after it is fully constructed.
+    do
+    {
+        aMetric.mNext = head;
+    } while (!mHead.compare_exchange_weak(head, &aMetric, std::memory_order_release, std::memory_order_relaxed));
+}
+
+std::vector<MetricsRegistry::Metric *> MetricsRegistry::GetSortedMetrics(void) const
+{
+    std::vector<Metric *> metrics;
+
+    for (Metric *metric = mHead.load(std::memory_order_acquire); metric != nullptr; metric = metric->mNext)
+    {
+        metrics.push_back(metric);
+    }
+
+    // The series of a name are adjacent in the Prometheus format, and in registration order.
+    std::reverse(metrics.begin(), metrics.end());
+    std::stable_sort(metrics.begin(), metrics.end(),
+                     [](const Metric *aLeft, const Metric *aRight) { return strcmp(aLeft->mName, aRight->mName) < 0; });
+
+    return metrics;
+}
+
+void MetricsRegistry::WritePrometheus(std::string &aOutput) const
+{
+    static const char *const kTypeNames[] = {"counter", "gauge", "histogram"};
+
+    const char *lastName = nullptr;
+
+    for (const Metric *metric : GetSortedMetrics())
+    {
+        if (lastName == nullptr || strcmp(lastName, metric->mName) != 0)
+        {
+            aOutput += std::string("# HELP ") + metric->mName + " " + metric->mHelp + "\n# TYPE " + metric->mName +
+                       " " + kTypeNames[metric->mType] + "\n";
+            lastName = metric->mName;
+        }
+
+        switch (metric->mType)
+        {
+        case kTypeCounter:
+            aOutput += FormatSeries(metric->mName, "", metric->mLabels, "") + " " +
+                       std::to_string(static_cast<const Counter *>(metric)->GetValue()) + "\n";
+            break;
+
+        case kTypeGauge:
+            aOutput += FormatSeries(metric->mName, "", metric->mLabels, "") + " " +
+                       std::to_string(static_cast<const Gauge *>(metric)->GetValue()) + "\n";
+            break;
+
+        case kTypeHistogram:
+        {
+            const Histogram &histogram  = *static_cast<const Histogram *>(metric);
+            uint64_t         cumulative = 0;
+            Histogram::Value value;
+
+            histogram.GetValue(value);
+
+            // Buckets of the Prometheus format are cumulative.
+            for (size_t index = 0; index < histogram.mNumBounds; index++)
+            {
+                cumulative += value.mBuckets[index];
+                aOutput += FormatSeries(metric->mName, "_bucket", metric->mLabels,
+                                        FormatValue(histogram.mBounds[index], histogram.mUnit)) +
+                           " " + std::to_string(cumulative) + "\n";
+            }
+            aOutput += FormatSeries(metric->mName, "_bucket", metric->mLabels, "+Inf") + " " +
+                       std::to_string(value.mCount) + "\n";
+            aOutput += FormatSeries(metric->mName, "_sum", metric->mLabels, "") + " " +
+                       FormatValue(value.mSum, histogram.mUnit) + "\n";
+            aOutput += FormatSeries(metric->mName, "_count", metric->mLabels, "") + " " +
+                       std::to_string(value.mCount) + "\n";
+            break;
+        }
+        }
+    }
+}
+
+void MetricsRegistry::GetValues(std::vector<std::pair<std::string, int64_t>> &aValues) const
+{
+    for (const Metric *metric : GetSortedMetrics())
+    {
+        switch (metric->mType)
+        {
+        case kTypeCounter:
+            aValues.emplace_back(FormatSeries(metric->mName, "", metric->mLabels, ""),
+                                 static_cast<int64_t>(static_cast<const Counter *>(metric)->GetValue()));
+            break;
+
+        case kTypeGauge:
+            aValues.emplace_back(FormatSeries(metric->mName, "", metric->mLabels, ""),
+                                 static_cast<const Gauge *>(metric)->GetValue());
+            break;
+
+        case kTypeHistogram:
+        {
+            const Histogram &histogram  = *static_cast<const Histogram *>(metric);
+            uint64_t         cumulative = 0;
+            Histogram::Value value;
+
+            histogram.GetValue(value);
+
+            // The bounds and the sum are in the unit of the samples, not converted like in the Prometheus format.
+            for (size_t index = 0; index < histogram.mNumBounds; index++)
+            {
+                cumulative += value.mBuckets[index];
+                aValues.emplace_back(FormatSeries(metric->mName, "_bucket", metric->mLabels,
+                                                  FormatValue(histogram.mBounds[index], kUnitNone)),
+                                     static_cast<int64_t>(cumulative));
+            }
+            aValues.emplace_back(FormatSeries(metric->mName, "_bucket", metric->mLabels, "+Inf"),
+                                 static_cast<int64_t>(value.mCount));
+            aValues.emplace_back(FormatSeries(metric->mName, "_sum", metric->mLabels, ""),
+                                 static_cast<int64_t>(value.mSum));
+            aValues.emplace_back(FormatSeries(metric->mName, "_count", metric->mLabels, ""),
+                                 static_cast<int64_t>(value.mCount));
+            break;
+        }
+        }
+    }
+}
+
+} // namespace otbr
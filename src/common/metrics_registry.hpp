@@ -0,0 +1,460 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the metrics registry shared by the subsystems.
+ */
+
+#ifndef OTBR_COMMON_METRICS_REGISTRY_HPP_
+#define OTBR_COMMON_METRICS_REGISTRY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The number of shards of each counter and histogram, threads updating the same metric are spread over them.
+ *
+ */
+#ifndef OTBR_METRICS_SHARDS
+#define OTBR_METRICS_SHARDS 4
+#endif
+
+namespace otbr {
+
+/**
+ * This class registers the counters, gauges and histograms of all subsystems, and exports them in the Prometheus text
+ * format or as name-value pairs.
+ *
+ * Metrics register themselves when constructed and must outlive the process, they are members of the singleton
+ * counters of the subsystems. Updates are relaxed atomic operations on a shard of the calling thread, so they are
+ * safe and cheap from any thread. Reads sum the shards and may miss concurrent updates.
+ *
+ * Metrics whose labels are only known at runtime, e.g. the resource of a request, are created on demand by a family.
+ *
+ */
+class MetricsRegistry
+{
+public:
+    static const size_t kNumShards = OTBR_METRICS_SHARDS;
+
+    /**
+     * This enumeration represents the types of metrics.
+     *
+     */
+    enum Type : uint8_t
+    {
+        kTypeCounter   = 0, ///< A value only increasing.
+        kTypeGauge     = 1, ///< A value set or changed both ways.
+        kTypeHistogram = 2, ///< Samples counted in fixed buckets.
+    };
+
+    /**
+     * This enumeration represents the units of histogram samples.
+     *
+     */
+    enum Unit : uint8_t
+    {
+        kUnitNone         = 0, ///< Exported as is.
+        kUnitMicroseconds = 1, ///< Exported in seconds.
+    };
+
+    /**
+     * This class is the base of the registered metrics.
+     *
+     */
+    class Metric
+    {
+    public:
+        Metric(const Metric &) = delete;
+        Metric &operator=(const Metric &) = delete;
+
+        /**
+         * This method returns the name of the metric.
+         *
+         * @returns The name, shared by the metrics of other labels.
+         *
+         */
+        const char *GetName(void) const { return mName; }
+
+        /**
+         * This method returns the labels of the metric.
+         *
+         * @returns The labels in the Prometheus format without braces, e.g. `dst="unicast"`, or nullptr.
+         *
+         */
+        const char *GetLabels(void) const { return mLabels; }
+
+    protected:
+        Metric(Type aType, const char *aName, const char *aHelp, const char *aLabels);
+
+    private:
+        friend class MetricsRegistry;
+
+        Type        mType;
+        const char *mName;
+        const char *mHelp;
+        const char *mLabels;
+        Metric *    mNext;
+    };
+
+    /**
+     * This class implements a counter.
+     *
+     */
+    class Counter : public Metric
+    {
+    public:
+        /**
+         * This constructor registers a counter.
+         *
+         * @param[in]   aName   The name, which must be a string literal.
+         * @param[in]   aHelp   The description, which must be a string literal.
+         * @param[in]   aLabels The labels, which must be a string literal, or nullptr.
+         *
+         */
+        Counter(const char *aName, const char *aHelp, const char *aLabels = nullptr);
+
+        /**
+         * This method adds to the counter.
+         *
+         * @param[in]   aValue  The value to add.
+         *
+         */
+        void Add(uint64_t aValue) { mCells[GetShard()].mValue.fetch_add(aValue, std::memory_order_relaxed); }
+
+        /**
+         * This method returns the value of the counter.
+         *
+         * @returns The sum of all shards.
+         *
+         */
+        uint64_t GetValue(void) const;
+
+        /**
+         * These operators let the counter be used like the integer it replaces.
+         *
+         */
+        void operator++(int) { Add(1); }
+        void operator+=(uint64_t aValue) { Add(aValue); }
+        operator uint64_t(void) const { return GetValue(); }
+
+    private:
+        struct alignas(64) Cell
+        {
+            std::atomic<uint64_t> mValue;
+        };
+
+        Cell mCells[kNumShards];
+    };
+
+    /**
+     * This class implements a gauge.
+     *
+     */
+    class Gauge : public Metric
+    {
+    public:
+        /**
+         * This constructor registers a gauge.
+         *
+         * @param[in]   aName   The name, which must be a string literal.
+         * @param[in]   aHelp   The description, which must be a string literal.
+         * @param[in]   aLabels The labels, which must be a string literal, or nullptr.
+         *
+         */
+        Gauge(const char *aName, const char *aHelp, const char *aLabels = nullptr);
+
+        /**
+         * This method sets the gauge.
+         *
+         * @param[in]   aValue  The value.
+         *
+         */
+        void Set(int64_t aValue) { mValue.store(aValue, std::memory_order_relaxed); }
+
+        /**
+         * This method changes the gauge.
+         *
+         * @param[in]   aDelta  The value to add, negative to subtract.
+         *
+         */
+        void Add(int64_t aDelta) { mValue.fetch_add(aDelta, std::memory_order_relaxed); }
+
+        /**
+         * This method returns the value of the gauge.
+         *
+         * @returns The value.
+         *
+         */
+        int64_t GetValue(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    private:
+        // Gauges are set rather than added to, so shards could not be summed.
+        std::atomic<int64_t> mValue;
+    };
+
+    /**
+     * This class implements a histogram of fixed buckets.
+     *
+     */
+    class Histogram : public Metric
+    {
+    public:
+        static const size_t kMaxBuckets = 16;
+
+        /**
+         * This structure represents the value of a histogram.
+         *
+         */
+        struct Value
+        {
+            uint64_t mBuckets[kMaxBuckets]; ///< Number of samples of each bucket, not cumulative.
+            uint64_t mCount;                ///< Number of samples, including those above the last bucket.
+            uint64_t mSum;                  ///< Sum of the samples.
+        };
+
+        /**
+         * This constructor registers a histogram.
+         *
+         * @param[in]   aName       The name, which must be a string literal.
+         * @param[in]   aHelp       The description, which must be a string literal.
+         * @param[in]   aBounds     The ascending upper bounds of the buckets, which must outlive the histogram.
+         * @param[in]   aNumBounds  The number of buckets, at most `kMaxBuckets`.
+         * @param[in]   aUnit       The unit of the samples.
+         * @param[in]   aLabels     The labels, which must be a string literal, or nullptr.
+         *
+         */
+        Histogram(const char *    aName,
+                  const char *    aHelp,
+                  const uint64_t *aBounds,
+                  size_t          aNumBounds,
+                  Unit            aUnit   = kUnitNone,
+                  const char *    aLabels = nullptr);
+
+        /**
+         * This method records a sample.
+         *
+         * @param[in]   aValue  The sample.
+         *
+         */
+        void Add(uint64_t aValue);
+
+        /**
+         * This method returns the value of the histogram.
+         *
+         * @param[out]  aValue  The sum of all shards.
+         *
+         */
+        void GetValue(Value &aValue) const;
+
+        /**
+         * This method returns the number of buckets.
+         *
+         * @returns The number of buckets.
+         *
+         */
+        size_t GetNumBounds(void) const { return mNumBounds; }
+
+        /**
+         * This method returns the upper bound of a bucket.
+         *
+         * @param[in]   aIndex  The index of the bucket.
+         *
+         * @returns The upper bound of the bucket.
+         *
+         */
+        uint64_t GetBound(size_t aIndex) const { return mBounds[aIndex]; }
+
+    private:
+        friend class MetricsRegistry;
+
+        struct alignas(64) Cell
+        {
+            std::atomic<uint64_t> mBuckets[kMaxBuckets];
+            std::atomic<uint64_t> mCount;
+            std::atomic<uint64_t> mSum;
+        };
+
+        const uint64_t *mBounds;
+        size_t          mNumBounds;
+        Unit            mUnit;
+        Cell            mCells[kNumShards];
+    };
+
+    /**
+     * This class implements a family of counters sharing a name, labeled at runtime.
+     *
+     * A counter is registered the first time its labels are used and is never freed, so the labels must only take a
+     * bounded number of values.
+     *
+     */
+    class CounterFamily
+    {
+    public:
+        /**
+         * This constructor initializes a family of counters.
+         *
+         * @param[in]   aName   The name, which must be a string literal.
+         * @param[in]   aHelp   The description, which must be a string literal.
+         *
+         */
+        CounterFamily(const char *aName, const char *aHelp);
+
+        /**
+         * This method returns the counter of some labels, registering it if not yet used.
+         *
+         * @param[in]   aLabels The labels in the Prometheus format without braces, e.g. built by `FormatLabel()`.
+         *
+         * @returns A reference to the counter.
+         *
+         */
+        Counter &Get(const std::string &aLabels);
+
+    private:
+        const char *                     mName;
+        const char *                     mHelp;
+        std::mutex                       mMutex;
+        std::map<std::string, Counter *> mCounters;
+    };
+
+    /**
+     * This class implements a family of histograms sharing a name and buckets, labeled at runtime.
+     *
+     * A histogram is registered the first time its labels are used and is never freed, so the labels must only take
+     * a bounded number of values.
+     *
+     */
+    class HistogramFamily
+    {
+    public:
+        /**
+         * This constructor initializes a family of histograms.
+         *
+         * @param[in]   aName       The name, which must be a string literal.
+         * @param[in]   aHelp       The description, which must be a string literal.
+         * @param[in]   aBounds     The ascending upper bounds of the buckets, which must outlive the family.
+         * @param[in]   aNumBounds  The number of buckets, at most `Histogram::kMaxBuckets`.
+         * @param[in]   aUnit       The unit of the samples.
+         *
+         */
+        HistogramFamily(const char *    aName,
+                        const char *    aHelp,
+                        const uint64_t *aBounds,
+                        size_t          aNumBounds,
+                        Unit            aUnit = kUnitNone);
+
+        /**
+         * This method returns the histogram of some labels, registering it if not yet used.
+         *
+         * @param[in]   aLabels The labels in the Prometheus format without braces, e.g. built by `FormatLabel()`.
+         *
+         * @returns A reference to the histogram.
+         *
+         */
+        Histogram &Get(const std::string &aLabels);
+
+    private:
+        const char *                       mName;
+        const char *                       mHelp;
+        const uint64_t *                   mBounds;
+        size_t                             mNumBounds;
+        Unit                               mUnit;
+        std::mutex                         mMutex;
+        std::map<std::string, Histogram *> mHistograms;
+    };
+
+    /**
+     * This method formats a label, escaping its value.
+     *
+     * @param[in]   aName   The name of the label.
+     * @param[in]   aValue  The value of the label.
+     *
+     * @returns The label in the Prometheus format, e.g. `resource="/node"`.
+     *
+     */
+    static std::string FormatLabel(const char *aName, const std::string &aValue);
+
+    /**
+     * This method returns the singleton registry.
+     *
+     * @returns A reference to the registry.
+     *
+     */
+    static MetricsRegistry &Get(void);
+
+    /**
+     * This method writes all metrics in the Prometheus text exposition format.
+     *
+     * @param[out]  aOutput     A reference to the string the metrics are appended to.
+     *
+     */
+    void WritePrometheus(std::string &aOutput) const;
+
+    /**
+     * This method returns all metrics as pairs of a series name, with its labels, and a value.
+     *
+     * Histograms are flattened into cumulative `_bucket` series, `_count` and `_sum`, like in the Prometheus format.
+     *
+     * @param[out]  aValues     A reference to the vector the pairs are appended to.
+     *
+     */
+    void GetValues(std::vector<std::pair<std::string, int64_t>> &aValues) const;
+
+private:
+    MetricsRegistry(void)
+        : mHead(nullptr)
+    {
+    }
+
+    static size_t GetShard(void)
+    {
+        static std::atomic<size_t> sNextShard(0);
+        static thread_local size_t sShard = sNextShard.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+
+        return sShard;
+    }
+
+    void                  Register(Metric &aMetric);
+    std::vector<Metric *> GetSortedMetrics(void) const;
+
+    std::atomic<Metric *> mHead; ///< The metrics registered, most recent first.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_METRICS_REGISTRY_HPP_
@@ -0,0 +1,279 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for a binary trie of IPv6 prefixes.
+ */
+
+#ifndef OTBR_COMMON_PREFIX_TRIE_HPP_
+#define OTBR_COMMON_PREFIX_TRIE_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a binary trie of IPv6 prefixes, each mapped to a value.
+ *
+ * Lookups walk one node per bit of the prefix or address, so they take O(prefix length) regardless of the number of
+ * prefixes. The nodes are kept in one vector and refer to each other by index, and the entries are kept in another
+ * vector in insertion order, which is the snapshot exported to readers.
+ *
+ * Nodes are only released by `Clear()`, as the tries are rebuilt from the network data rather than edited in place.
+ *
+ */
+template <typename T> class PrefixTrie
+{
+public:
+    typedef std::pair<Ip6Prefix, T> Entry; ///< A prefix and its value.
+
+    /**
+     * The constructor initializes an empty trie.
+     *
+     */
+    PrefixTrie(void) { Clear(); }
+
+    /**
+     * This method returns the value of a prefix, inserting a value-initialized one if the prefix is not in the trie.
+     *
+     * Bits of @p aPrefix after its length are ignored.
+     *
+     * @param[in] aPrefix  The IPv6 prefix.
+     *
+     * @returns A reference to the value of the prefix, valid until the next insertion or removal.
+     *
+     */
+    T &operator[](const Ip6Prefix &aPrefix)
+    {
+        uint32_t node   = 0;
+        uint8_t  length = GetLength(aPrefix);
+
+        for (uint8_t depth = 0; depth < length; depth++)
+        {
+            uint8_t bit = GetBit(aPrefix.mPrefix, depth);
+
+            if (mNodes[node].mChild[bit] == kNoNode)
+            {
+                mNodes[node].mChild[bit] = static_cast<uint32_t>(mNodes.size());
+                mNodes.emplace_back();
+            }
+
+            node = mNodes[node].mChild[bit];
+        }
+
+        if (mNodes[node].mEntry == kNoEntry)
+        {
+            mNodes[node].mEntry = static_cast<uint32_t>(mEntries.size());
+            mEntries.emplace_back(Normalize(aPrefix), T());
+            mEntryNodes.push_back(node);
+        }
+
+        return mEntries[mNodes[node].mEntry].second;
+    }
+
+    /**
+     * This method removes a prefix.
+     *
+     * @param[in] aPrefix  The IPv6 prefix.
+     *
+     * @returns Whether the prefix was in the trie.
+     *
+     */
+    bool Remove(const Ip6Prefix &aPrefix)
+    {
+        uint32_t entry = FindEntry(aPrefix);
+        bool     found = (entry != kNoEntry);
+
+        if (found)
+        {
+            // The last entry takes the place of the removed one, so that the entries stay contiguous.
+            mNodes[mEntryNodes[entry]].mEntry = kNoEntry;
+            mEntries[entry]                   = std::move(mEntries.back());
+            mEntryNodes[entry]                = mEntryNodes.back();
+            mEntries.pop_back();
+            mEntryNodes.pop_back();
+
+            if (entry < mEntries.size())
+            {
+                mNodes[mEntryNodes[entry]].mEntry = entry;
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * This method returns the value of a prefix.
+     *
+     * @param[in] aPrefix  The IPv6 prefix.
+     *
+     * @returns A pointer to the value of the prefix, or `nullptr` if the prefix is not in the trie.
+     *
+     */
+    const T *Find(const Ip6Prefix &aPrefix) const
+    {
+        uint32_t entry = FindEntry(aPrefix);
+
+        return entry == kNoEntry ? nullptr : &mEntries[entry].second;
+    }
+
+    /**
+     * This method returns the longest prefix containing an address.
+     *
+     * @param[in] aAddress  The IPv6 address.
+     *
+     * @returns A pointer to the entry of the longest prefix containing @p aAddress, or `nullptr` if none.
+     *
+     */
+    const Entry *Lookup(const Ip6Address &aAddress) const
+    {
+        uint32_t node  = 0;
+        uint32_t match = mNodes[0].mEntry;
+
+        for (uint8_t depth = 0; depth < kMaxLength; depth++)
+        {
+            node = mNodes[node].mChild[GetBit(aAddress, depth)];
+
+            if (node == kNoNode)
+            {
+                break;
+            }
+
+            if (mNodes[node].mEntry != kNoEntry)
+            {
+                match = mNodes[node].mEntry;
+            }
+        }
+
+        return match == kNoEntry ? nullptr : &mEntries[match];
+    }
+
+    /**
+     * This method returns the entries of the trie.
+     *
+     * @returns The entries, in insertion order as long as no prefix is removed.
+     *
+     */
+    const std::vector<Entry> &GetEntries(void) const { return mEntries; }
+
+    /**
+     * This method returns the number of prefixes.
+     *
+     * @returns The number of prefixes.
+     *
+     */
+    size_t GetSize(void) const { return mEntries.size(); }
+
+    /**
+     * This method removes all prefixes and releases the nodes.
+     *
+     */
+    void Clear(void)
+    {
+        mNodes.assign(1, Node());
+        mEntries.clear();
+        mEntryNodes.clear();
+    }
+
+private:
+    enum : uint32_t
+    {
+        kNoNode    = 0,          ///< No child node, the root is never a child.
+        kNoEntry   = 0xffffffff, ///< No entry.
+        kMaxLength = 128,        ///< The maximum prefix length.
+    };
+
+    struct Node
+    {
+        Node(void)
+            : mChild{kNoNode, kNoNode}
+            , mEntry(kNoEntry)
+        {
+        }
+
+        uint32_t mChild[2]; ///< The index of the child node of each bit value.
+        uint32_t mEntry;    ///< The index of the entry of the prefix of the node, or `kNoEntry`.
+    };
+
+    static uint8_t GetLength(const Ip6Prefix &aPrefix)
+    {
+        return aPrefix.mLength < kMaxLength ? aPrefix.mLength : static_cast<uint8_t>(kMaxLength);
+    }
+
+    static uint8_t GetBit(const Ip6Address &aAddress, uint8_t aIndex)
+    {
+        return (aAddress.m8[aIndex / 8] >> (7 - aIndex % 8)) & 1;
+    }
+
+    static Ip6Prefix Normalize(const Ip6Prefix &aPrefix)
+    {
+        Ip6Prefix prefix;
+
+        prefix.mLength = GetLength(aPrefix);
+
+        for (uint8_t i = 0; i < prefix.mLength; i++)
+        {
+            prefix.mPrefix.m8[i / 8] |= aPrefix.mPrefix.m8[i / 8] & (0x80 >> (i % 8));
+        }
+
+        return prefix;
+    }
+
+    uint32_t FindEntry(const Ip6Prefix &aPrefix) const
+    {
+        uint32_t node   = 0;
+        uint8_t  length = GetLength(aPrefix);
+
+        for (uint8_t depth = 0; depth < length; depth++)
+        {
+            node = mNodes[node].mChild[GetBit(aPrefix.mPrefix, depth)];
+
+            if (node == kNoNode)
+            {
+                return kNoEntry;
+            }
+        }
+
+        return mNodes[node].mEntry;
+    }
+
+    std::vector<Node>     mNodes;      ///< The nodes, the root first.
+    std::vector<Entry>    mEntries;    ///< The prefixes and their values.
+    std::vector<uint32_t> mEntryNodes; ///< The node of each entry.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_PREFIX_TRIE_HPP_
@@ -28,43 +28,123 @@
 
 #include "region_code.hpp"
 
+#include <algorithm>
+
+#include <ctype.h>
+
+namespace otbr {
+
 namespace {
 
 constexpr uint32_t kChannelMask11To24 = 0x1fff800;
 constexpr uint32_t kChannelMask11To25 = 0x3fff800;
 constexpr uint32_t kChannelMask11To26 = 0x7fff800;
 
-constexpr char kRegionCodeUS[] = "US";
-constexpr char kRegionCodeCA[] = "CA";
+constexpr int8_t kMaxTxPowerFcc     = 30; ///< FCC part 15.247 and ISED RSS-247, channel 26 is not supported.
+constexpr int8_t kMaxTxPowerEtsi    = 20; ///< ETSI EN 300 328 and the rules harmonized with it, e.g. SRRC in CN.
+constexpr int8_t kMaxTxPowerHigh    = 30; ///< ACMA LIPD, NZ GURL and WPC GSR 45, up to 4 W EIRP for channel 11-26.
+constexpr int8_t kMaxTxPowerLow     = 10; ///< ARIB STD-T66 and KC, 10 mW per MHz.
+constexpr int8_t kMaxTxPowerDefault = 20;
 
-} // namespace
+constexpr RegionInfo kDefaultRegion = {0, kChannelMask11To26, kChannelMask11To26, kMaxTxPowerDefault};
 
-namespace otbr {
+// Sorted by packed region code for binary search, regions not listed use the default constraints.
+constexpr RegionInfo kRegions[] = {
+    {PackRegionCode('A', 'E'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('A', 'S'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('A', 'T'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('A', 'U'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerHigh},
+    {PackRegionCode('B', 'E'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('B', 'G'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('B', 'R'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('C', 'A'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('C', 'H'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('C', 'N'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('C', 'Y'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('C', 'Z'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('D', 'E'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('D', 'K'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('E', 'E'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('E', 'S'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('F', 'I'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('F', 'R'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('G', 'B'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('G', 'R'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('G', 'U'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('H', 'K'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('H', 'R'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('H', 'U'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('I', 'E'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('I', 'L'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('I', 'N'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerHigh},
+    {PackRegionCode('I', 'S'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('I', 'T'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('J', 'P'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerLow},
+    {PackRegionCode('K', 'R'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerLow},
+    {PackRegionCode('L', 'I'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('L', 'T'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('L', 'U'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('L', 'V'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('M', 'P'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('M', 'T'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('M', 'X'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('M', 'Y'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('N', 'L'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('N', 'O'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('N', 'Z'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerHigh},
+    {PackRegionCode('P', 'L'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('P', 'R'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('P', 'T'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('R', 'O'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('R', 'U'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('S', 'A'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('S', 'E'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('S', 'G'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('S', 'I'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('S', 'K'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('T', 'H'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('T', 'R'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+    {PackRegionCode('T', 'W'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('U', 'M'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('U', 'S'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('V', 'I'), kChannelMask11To25, kChannelMask11To24, kMaxTxPowerFcc},
+    {PackRegionCode('W', 'W'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerDefault},
+    {PackRegionCode('Z', 'A'), kChannelMask11To26, kChannelMask11To26, kMaxTxPowerEtsi},
+};
+
+constexpr size_t kNumRegions = sizeof(kRegions) / sizeof(kRegions[0]);
+
+constexpr bool IsSorted(size_t aIndex)
+{
+    return aIndex + 1 >= kNumRegions || (kRegions[aIndex].mCode < kRegions[aIndex + 1].mCode && IsSorted(aIndex + 1));
+}
+
+static_assert(IsSorted(0), "regions must be sorted by packed region code");
+
+} // namespace
 
-uint32_t GetSupportedChannelMaskForRegion(const std::string &aRegionCode)
+uint16_t PackRegionCode(const std::string &aRegionCode)
 {
-    uint32_t mask = kChannelMask11To26;
+    uint16_t code = 0;
 
-    // US or CA
-    if (aRegionCode == kRegionCodeUS || aRegionCode == kRegionCodeCA)
+    if (aRegionCode.size() == 2 && isalpha(static_cast<unsigned char>(aRegionCode[0])) &&
+        isalpha(static_cast<unsigned char>(aRegionCode[1])))
     {
-        mask = kChannelMask11To25;
+        code = PackRegionCode(static_cast<char>(toupper(static_cast<unsigned char>(aRegionCode[0]))),
+                              static_cast<char>(toupper(static_cast<unsigned char>(aRegionCode[1]))));
     }
 
-    return mask;
+    return code;
 }
 
-uint32_t GetPreferredChannelMaskForRegion(const std::string &aRegionCode)
+const RegionInfo &GetRegionInfo(uint16_t aPackedCode)
 {
-    uint32_t mask = kChannelMask11To26;
-
-    // US or CA
-    if (aRegionCode == kRegionCodeUS || aRegionCode == kRegionCodeCA)
-    {
-        mask = kChannelMask11To24;
-    }
+    const RegionInfo *end = kRegions + kNumRegions;
+    const RegionInfo *region =
+        std::lower_bound(kRegions, end, aPackedCode,
+                         [](const RegionInfo &aRegion, uint16_t aCode) { return aRegion.mCode < aCode; });
 
-    return mask;
+    return (region != end && region->mCode == aPackedCode) ? *region : kDefaultRegion;
 }
 
 } // namespace otbr
@@ -31,27 +31,68 @@
 
 #include <string>
 
+#include <stdint.h>
+
 namespace otbr {
 
 /**
- * This method returns the supported channel mask for a region code.
+ * This structure represents the regulatory constraints of the 2.4 GHz IEEE 802.15.4 channels of a region.
+ *
+ */
+struct RegionInfo
+{
+    uint16_t mCode;                 ///< The packed two-letter region code, 0 for the default of unlisted regions.
+    uint32_t mSupportedChannelMask; ///< The channels allowed in the region.
+    uint32_t mPreferredChannelMask; ///< The channels preferred when forming a network in the region.
+    int8_t   mMaxTxPower;           ///< The maximum transmit power (in dBm EIRP), the radio is capped to it.
+};
+
+/**
+ * This function packs a two-letter region code into an integer.
  *
+ * @param[in] aFirst    The first letter, in uppercase.
+ * @param[in] aSecond   The second letter, in uppercase.
+ *
+ * @returns The packed region code.
+ *
+ */
+constexpr uint16_t PackRegionCode(char aFirst, char aSecond)
+{
+    return static_cast<uint16_t>((static_cast<uint8_t>(aFirst) << 8) | static_cast<uint8_t>(aSecond));
+}
+
+/**
+ * This function packs a two-letter region code into an integer, letters are case-insensitive.
  *
  * @param[in] aRegionCode   The region code.
- * @returns The supported channel mask.
+ *
+ * @returns The packed region code, 0 if @p aRegionCode is not two letters.
+ *
+ */
+uint16_t PackRegionCode(const std::string &aRegionCode);
+
+/**
+ * This function returns the regulatory constraints of a region.
+ *
+ * @param[in] aPackedCode   The packed region code.
+ *
+ * @returns The regulatory constraints of the region, or the default ones if the region is not listed.
  *
  */
-uint32_t GetSupportedChannelMaskForRegion(const std::string &aRegionCode);
+const RegionInfo &GetRegionInfo(uint16_t aPackedCode);
 
 /**
- * This method returns the preferred channel mask for a region code.
+ * This function returns the regulatory constraints of a region.
  *
  * @param[in] aRegionCode   The region code.
  *
- * @returns The preferred channel mask.
+ * @returns The regulatory constraints of the region, or the default ones if the region is not listed.
  *
  */
-uint32_t GetPreferredChannelMaskForRegion(const std::string &aRegionCode);
+inline const RegionInfo &GetRegionInfo(const std::string &aRegionCode)
+{
+    return GetRegionInfo(PackRegionCode(aRegionCode));
+}
 
 } // namespace otbr
 
@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the queue of tasks handed over to the mainloop of another thread.
+ */
+
+#include "common/task_queue.hpp"
+
+#include <cerrno>
+
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+TaskQueue::TaskQueue(void)
+    : mTasks(nullptr)
+{
+    mEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrDie(mEventFd != -1, strerror(errno));
+}
+
+TaskQueue::~TaskQueue(void)
+{
+    for (Node *node = mTasks.exchange(nullptr); node != nullptr;)
+    {
+        Node *next = node->mNext;
+
+        delete node;
+        node = next;
+    }
+
+    close(mEventFd);
+}
+
+void TaskQueue::Post(Task aTask)
+{
+    Node *   node   = new Node{std::move(aTask), nullptr};
+    Node *   head   = mTasks.load(std::memory_order_relaxed);
+    uint64_t wakeup = 1;
+
+    // The release ordering makes what the poster did before visible to the task.
+    do
+    {
+        node->mNext = head;
+    } while (!mTasks.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+    // The mainloop takes all tasks at once, only the first task after that needs to wake it up.
+    if (head == nullptr && write(mEventFd, &wakeup, sizeof(wakeup)) != sizeof(wakeup))
+    {
+        otbrLog(OTBR_LOG_WARNING, "task queue wakeup error: %s", strerror(errno));
+    }
+}
+
+void TaskQueue::UpdateFdSet(otSysMainloopContext &aMainloop) const
+{
+    FD_SET(mEventFd, &aMainloop.mReadFdSet);
+
+    if (mEventFd > aMainloop.mMaxFd)
+    {
+        aMainloop.mMaxFd = mEventFd;
+    }
+}
+
+void TaskQueue::Process(const otSysMainloopContext &aMainloop)
+{
+    uint64_t count;
+    Node *   node;
+    Node *   ordered = nullptr;
+
+    VerifyOrExit(FD_ISSET(mEventFd, &aMainloop.mReadFdSet));
+
+    // Clear the eventfd before taking the tasks, a task posted afterwards always wakes up the mainloop again.
+    if (read(mEventFd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+    {
+        otbrLog(OTBR_LOG_WARNING, "task queue read error: %s", strerror(errno));
+    }
+
+    node = mTasks.exchange(nullptr, std::memory_order_acquire);
+
+    // The stack holds the latest task first, run the tasks in the order they were posted.
+    while (node != nullptr)
+    {
+        Node *next = node->mNext;
+
+        node->mNext = ordered;
+        ordered     = node;
+        node        = next;
+    }
+
+    while (ordered != nullptr)
+    {
+        Node *next = ordered->mNext;
+
+        ordered->mTask();
+        delete ordered;
+        ordered = next;
+    }
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the queue of tasks handed over to the mainloop of another thread.
+ */
+
+#ifndef OTBR_COMMON_TASK_QUEUE_HPP_
+#define OTBR_COMMON_TASK_QUEUE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <functional>
+
+#include <openthread/openthread-system.h>
+
+namespace otbr {
+
+/**
+ * This class implements a lock-free queue of tasks run by the mainloop of one thread.
+ *
+ * Any thread posts tasks, without taking a lock or waiting for the mainloop. The mainloop is woken up by an eventfd
+ * and runs the tasks in the order they were posted, through `UpdateFdSet()` and `Process()`.
+ *
+ */
+class TaskQueue
+{
+public:
+    typedef std::function<void(void)> Task;
+
+    /**
+     * The constructor to initialize the queue, which exits the program if the eventfd could not be created.
+     *
+     */
+    TaskQueue(void);
+
+    ~TaskQueue(void);
+
+    TaskQueue(const TaskQueue &) = delete;
+    TaskQueue &operator=(const TaskQueue &) = delete;
+
+    /**
+     * This method posts a task, it may be called from any thread.
+     *
+     * @param[in]   aTask   The task run on the thread of the mainloop processing the queue.
+     *
+     */
+    void Post(Task aTask);
+
+    /**
+     * This method updates the file descriptor sets of the mainloop with the eventfd of the queue.
+     *
+     * @param[inout]    aMainloop   A reference to the mainloop context.
+     *
+     */
+    void UpdateFdSet(otSysMainloopContext &aMainloop) const;
+
+    /**
+     * This method runs the tasks posted so far.
+     *
+     * @param[in]   aMainloop   A reference to the mainloop context.
+     *
+     */
+    void Process(const otSysMainloopContext &aMainloop);
+
+private:
+    struct Node
+    {
+        Task  mTask;
+        Node *mNext;
+    };
+
+    // Lock-free stack of posted tasks, taken as a whole by the mainloop.
+    std::atomic<Node *> mTasks;
+    int                 mEventFd;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TASK_QUEUE_HPP_
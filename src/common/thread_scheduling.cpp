@@ -0,0 +1,269 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the CPU affinity and the scheduling policy of threads.
+ */
+
+#include "common/thread_scheduling.hpp"
+
+#include <cerrno>
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+static bool               sManagementSaved = false;
+static int                sManagementPolicy;
+static struct sched_param sManagementParam;
+static cpu_set_t          sManagementCpus;
+
+static bool ParseCpu(const char *&aCursor, int &aCpu)
+{
+    char *end;
+    long  cpu;
+
+    VerifyOrExit(*aCursor >= '0' && *aCursor <= '9');
+    cpu     = strtol(aCursor, &end, 10);
+    aCursor = end;
+    VerifyOrExit(cpu < CPU_SETSIZE);
+    aCpu = static_cast<int>(cpu);
+
+    return true;
+
+exit:
+    return false;
+}
+
+otbrError ParseCpuList(const char *aList, cpu_set_t &aCpus)
+{
+    otbrError   error  = OTBR_ERROR_INVALID_ARGS;
+    const char *cursor = aList;
+
+    CPU_ZERO(&aCpus);
+
+    while (true)
+    {
+        int first;
+        int last;
+
+        VerifyOrExit(ParseCpu(cursor, first));
+        last = first;
+
+        if (*cursor == '-')
+        {
+            cursor++;
+            VerifyOrExit(ParseCpu(cursor, last) && last >= first);
+        }
+
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            CPU_SET(cpu, &aCpus);
+        }
+
+        if (*cursor == '\0')
+        {
+            break;
+        }
+
+        VerifyOrExit(*cursor == ',');
+        cursor++;
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ParseFifoPriority(const char *aText, int &aPriority)
+{
+    otbrError error = OTBR_ERROR_INVALID_ARGS;
+    char *    end;
+    long      priority;
+
+    VerifyOrExit(*aText >= '0' && *aText <= '9');
+    errno    = 0;
+    priority = strtol(aText, &end, 10);
+    VerifyOrExit(errno == 0 && *end == '\0');
+    VerifyOrExit(priority >= sched_get_priority_min(SCHED_FIFO) && priority <= sched_get_priority_max(SCHED_FIFO));
+
+    aPriority = static_cast<int>(priority);
+    error     = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ApplyThreadScheduling(const ThreadScheduling &aScheduling)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    if (CPU_COUNT(&aScheduling.mCpus) > 0)
+    {
+        VerifyOrExit(pthread_setaffinity_np(pthread_self(), sizeof(aScheduling.mCpus), &aScheduling.mCpus) == 0,
+                     error = OTBR_ERROR_ERRNO);
+    }
+
+    if (aScheduling.mPriority > 0)
+    {
+        struct sched_param param;
+        int                ret;
+
+        param.sched_priority = aScheduling.mPriority;
+        ret                  = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+
+        // The pthread functions return the error number instead of setting errno.
+        VerifyOrExit(ret == 0, errno = ret, error = OTBR_ERROR_ERRNO);
+    }
+
+exit:
+    return error;
+}
+
+void SaveManagementScheduling(void)
+{
+    sManagementSaved = pthread_getschedparam(pthread_self(), &sManagementPolicy, &sManagementParam) == 0 &&
+                       pthread_getaffinity_np(pthread_self(), sizeof(sManagementCpus), &sManagementCpus) == 0;
+}
+
+otbrError ApplyManagementScheduling(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       ret;
+
+    VerifyOrExit(sManagementSaved);
+
+    ret = pthread_setaffinity_np(pthread_self(), sizeof(sManagementCpus), &sManagementCpus);
+    VerifyOrExit(ret == 0, errno = ret, error = OTBR_ERROR_ERRNO);
+
+    // Leaving SCHED_FIFO for a lower policy needs no privilege.
+    ret = pthread_setschedparam(pthread_self(), sManagementPolicy, &sManagementParam);
+    VerifyOrExit(ret == 0, errno = ret, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+static const char *GetPolicyName(int aPolicy)
+{
+    const char *name = "unknown";
+
+    switch (aPolicy)
+    {
+    case SCHED_OTHER:
+        name = "SCHED_OTHER";
+        break;
+    case SCHED_FIFO:
+        name = "SCHED_FIFO";
+        break;
+    case SCHED_RR:
+        name = "SCHED_RR";
+        break;
+#ifdef SCHED_BATCH
+    case SCHED_BATCH:
+        name = "SCHED_BATCH";
+        break;
+#endif
+#ifdef SCHED_IDLE
+    case SCHED_IDLE:
+        name = "SCHED_IDLE";
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return name;
+}
+
+std::string DescribeThreadScheduling(void)
+{
+    std::string        description;
+    struct sched_param param;
+    int                policy;
+    cpu_set_t          cpus;
+
+    if (pthread_getschedparam(pthread_self(), &policy, &param) == 0)
+    {
+        description = GetPolicyName(policy);
+
+        if (policy == SCHED_FIFO || policy == SCHED_RR)
+        {
+            description += " priority " + std::to_string(param.sched_priority);
+        }
+    }
+    else
+    {
+        description = "unknown policy";
+    }
+
+    description += ", CPUs ";
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0)
+    {
+        bool first = true;
+
+        // Consecutive CPUs are merged into ranges.
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            int last = cpu;
+
+            if (!CPU_ISSET(cpu, &cpus))
+            {
+                continue;
+            }
+
+            while (last + 1 < CPU_SETSIZE && CPU_ISSET(last + 1, &cpus))
+            {
+                last++;
+            }
+
+            description += (first ? "" : ",") + std::to_string(cpu);
+            if (last > cpu)
+            {
+                description += "-" + std::to_string(last);
+            }
+
+            first = false;
+            cpu   = last;
+        }
+    }
+    else
+    {
+        description += "unknown";
+    }
+
+    return description;
+}
+
+} // namespace otbr
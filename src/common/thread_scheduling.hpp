@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the CPU affinity and the scheduling policy of threads.
+ */
+
+#ifndef OTBR_COMMON_THREAD_SCHEDULING_HPP_
+#define OTBR_COMMON_THREAD_SCHEDULING_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+
+#include <sched.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This structure represents the scheduling requested for a thread.
+ *
+ * Threads created afterwards by the thread inherit its scheduling.
+ *
+ */
+struct ThreadScheduling
+{
+    ThreadScheduling(void)
+        : mPriority(0)
+    {
+        CPU_ZERO(&mCpus);
+    }
+
+    cpu_set_t mCpus;     ///< The CPUs the thread may run on, the CPUs are kept if empty.
+    int       mPriority; ///< The SCHED_FIFO priority, 0 keeps the scheduling policy.
+};
+
+/**
+ * This function parses a list of CPUs, e.g. "0,2-3".
+ *
+ * @param[in]   aList   A pointer to the list of CPU numbers and ranges of CPU numbers, separated by commas.
+ * @param[out]  aCpus   The CPUs of the list.
+ *
+ * @retval  OTBR_ERROR_NONE             Successfully parsed the list.
+ * @retval  OTBR_ERROR_INVALID_ARGS     The list is malformed, empty, or has a CPU number out of range.
+ *
+ */
+otbrError ParseCpuList(const char *aList, cpu_set_t &aCpus);
+
+/**
+ * This function parses a SCHED_FIFO priority.
+ *
+ * @param[in]   aText       A pointer to the decimal priority.
+ * @param[out]  aPriority   The priority.
+ *
+ * @retval  OTBR_ERROR_NONE             Successfully parsed the priority.
+ * @retval  OTBR_ERROR_INVALID_ARGS     The priority is malformed or out of the range of SCHED_FIFO.
+ *
+ */
+otbrError ParseFifoPriority(const char *aText, int &aPriority);
+
+/**
+ * This function applies the scheduling to the calling thread.
+ *
+ * @param[in]   aScheduling     The scheduling.
+ *
+ * @retval  OTBR_ERROR_NONE     Successfully applied the scheduling.
+ * @retval  OTBR_ERROR_ERRNO    Failed to set the CPU affinity or the scheduling policy, e.g. without the
+ *                              CAP_SYS_NICE capability for SCHED_FIFO, `errno` tells why.
+ *
+ */
+otbrError ApplyThreadScheduling(const ThreadScheduling &aScheduling);
+
+/**
+ * This function records the scheduling of the calling thread as the one of the management threads.
+ *
+ */
+void SaveManagementScheduling(void);
+
+/**
+ * This function applies the scheduling recorded by `SaveManagementScheduling()` to the calling thread.
+ *
+ * The helper threads started by the mainloop call it first, instead of keeping the real-time priority and the CPUs of
+ * the mainloop they inherit.
+ *
+ * @retval  OTBR_ERROR_NONE     Successfully applied the scheduling, or no scheduling was recorded.
+ * @retval  OTBR_ERROR_ERRNO    Failed to set the CPU affinity or the scheduling policy, `errno` tells why.
+ *
+ */
+otbrError ApplyManagementScheduling(void);
+
+/**
+ * This function describes the effective scheduling of the calling thread.
+ *
+ * @returns A string of the scheduling policy, the priority of a real-time policy and the CPUs, e.g.
+ *          "SCHED_FIFO priority 10, CPUs 2-3".
+ *
+ */
+std::string DescribeThreadScheduling(void);
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_THREAD_SCHEDULING_HPP_
@@ -0,0 +1,292 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the timers of the mainloop.
+ */
+
+#include "common/timer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <assert.h>
+
+#include "common/code_utils.hpp"
+#include "common/memory_stats.hpp"
+
+namespace otbr {
+
+namespace {
+
+// Number of posted tasks of the calling thread not run yet.
+thread_local size_t sPostedTasks = 0;
+
+/**
+ * This class implements a timer owning the task posted by `TimerScheduler::Post()`.
+ *
+ */
+class TaskTimer
+{
+public:
+    TaskTimer(const std::function<void(void)> &aTask)
+        : mTimer(HandleTimer, this)
+        , mTask(aTask)
+    {
+        sPostedTasks++;
+    }
+
+    ~TaskTimer(void) { sPostedTasks--; }
+
+    Timer &GetTimer(void) { return mTimer; }
+
+private:
+    static void HandleTimer(Timer &aTimer, void *aContext)
+    {
+        TaskTimer *taskTimer = static_cast<TaskTimer *>(aContext);
+
+        OTBR_UNUSED_VARIABLE(aTimer);
+
+        taskTimer->mTask();
+        delete taskTimer;
+        TimerScheduler::Get().UpdateMemoryStats();
+    }
+
+    Timer                     mTimer;
+    std::function<void(void)> mTask;
+};
+
+} // namespace
+
+Timer::Timer(Handler aHandler, void *aContext)
+    : mHandler(aHandler)
+    , mContext(aContext)
+    , mHeapIndex(kNotRunning)
+{
+    assert(aHandler != nullptr);
+}
+
+Timer::~Timer(void)
+{
+    Stop();
+}
+
+void Timer::StartAt(Clock::time_point aFireTime)
+{
+    Stop();
+    mFireTime = aFireTime;
+    TimerScheduler::Get().Add(*this);
+}
+
+void Timer::Stop(void)
+{
+    if (IsRunning())
+    {
+        TimerScheduler::Get().Remove(*this);
+    }
+}
+
+TimerScheduler &TimerScheduler::Get(void)
+{
+    static thread_local TimerScheduler sTimerScheduler;
+
+    return sTimerScheduler;
+}
+
+void TimerScheduler::Post(Timer::Clock::time_point aFireTime, const std::function<void(void)> &aTask)
+{
+    TaskTimer *taskTimer = new TaskTimer(aTask);
+
+    taskTimer->GetTimer().StartAt(aFireTime);
+}
+
+void TimerScheduler::UpdateTimeout(timeval &aTimeout) const
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    constexpr int kUsPerSecond = 1000000;
+    microseconds  remaining;
+
+    VerifyOrExit(!mHeap.empty());
+
+    // Rounded up, or select() returns just before the deadline and the mainloop iterates once more for nothing.
+    remaining = duration_cast<microseconds>(mHeap.front()->mFireTime - MainloopClock::Now() + microseconds(1) -
+                                            Timer::Clock::duration(1));
+
+    if (remaining.count() <= 0)
+    {
+        aTimeout.tv_sec  = 0;
+        aTimeout.tv_usec = 0;
+    }
+    else if (remaining < microseconds(aTimeout.tv_usec + static_cast<int64_t>(aTimeout.tv_sec) * kUsPerSecond))
+    {
+        aTimeout.tv_sec  = static_cast<time_t>(remaining.count() / kUsPerSecond);
+        aTimeout.tv_usec = static_cast<suseconds_t>(remaining.count() % kUsPerSecond);
+    }
+
+exit:
+    return;
+}
+
+void TimerScheduler::Process(void)
+{
+    assert(!mProcessing);
+
+    mProcessTime = MainloopClock::Now();
+    mProcessing  = true;
+
+    while (!mHeap.empty() && mHeap.front()->mFireTime <= mProcessTime)
+    {
+        Timer &timer = *mHeap.front();
+
+        Remove(timer);
+        timer.mHandler(timer, timer.mContext);
+    }
+
+    mProcessing = false;
+
+    // The deferred timers stopped or destroyed by a handler are already removed.
+    for (Timer *timer : mDeferred)
+    {
+        timer->mHeapIndex = Timer::kNotRunning;
+        Add(*timer);
+    }
+
+    mDeferred.clear();
+}
+
+void TimerScheduler::Add(Timer &aTimer)
+{
+    assert(!aTimer.IsRunning());
+
+    if (mProcessing && aTimer.mFireTime <= mProcessTime)
+    {
+        aTimer.mHeapIndex = Timer::kDeferred;
+        mDeferred.push_back(&aTimer);
+    }
+    else
+    {
+        aTimer.mHeapIndex = mHeap.size();
+        mHeap.push_back(&aTimer);
+        SiftUp(aTimer.mHeapIndex);
+    }
+
+    UpdateMemoryStats();
+}
+
+void TimerScheduler::Remove(Timer &aTimer)
+{
+    size_t index = aTimer.mHeapIndex;
+
+    if (index == Timer::kDeferred)
+    {
+        mDeferred.erase(std::find(mDeferred.begin(), mDeferred.end(), &aTimer));
+        aTimer.mHeapIndex = Timer::kNotRunning;
+        UpdateMemoryStats();
+        ExitNow();
+    }
+
+    assert(index < mHeap.size() && mHeap[index] == &aTimer);
+
+    Swap(index, mHeap.size() - 1);
+    mHeap.pop_back();
+    aTimer.mHeapIndex = Timer::kNotRunning;
+
+    if (index < mHeap.size())
+    {
+        SiftUp(index);
+        SiftDown(index);
+    }
+
+    UpdateMemoryStats();
+
+exit:
+    return;
+}
+
+void TimerScheduler::UpdateMemoryStats(void) const
+{
+    MemoryStats::Get().Update(MemoryStats::kSubsystemTimers,
+                              MemoryStats::VectorSize(mHeap) + MemoryStats::VectorSize(mDeferred) +
+                                  sPostedTasks * sizeof(TaskTimer));
+}
+
+void TimerScheduler::SiftUp(size_t aIndex)
+{
+    while (aIndex > 0)
+    {
+        size_t parent = (aIndex - 1) / 2;
+
+        if (!IsEarlier(aIndex, parent))
+        {
+            break;
+        }
+
+        Swap(aIndex, parent);
+        aIndex = parent;
+    }
+}
+
+void TimerScheduler::SiftDown(size_t aIndex)
+{
+    while (true)
+    {
+        size_t earliest = aIndex;
+        size_t left     = 2 * aIndex + 1;
+        size_t right    = left + 1;
+
+        if (left < mHeap.size() && IsEarlier(left, earliest))
+        {
+            earliest = left;
+        }
+
+        if (right < mHeap.size() && IsEarlier(right, earliest))
+        {
+            earliest = right;
+        }
+
+        if (earliest == aIndex)
+        {
+            break;
+        }
+
+        Swap(aIndex, earliest);
+        aIndex = earliest;
+    }
+}
+
+void TimerScheduler::Swap(size_t aFirst, size_t aSecond)
+{
+    std::swap(mHeap[aFirst], mHeap[aSecond]);
+    mHeap[aFirst]->mHeapIndex  = aFirst;
+    mHeap[aSecond]->mHeapIndex = aSecond;
+}
+
+} // namespace otbr
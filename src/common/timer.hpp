@@ -0,0 +1,216 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the timers of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_TIMER_HPP_
+#define OTBR_COMMON_TIMER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include <stddef.h>
+#include <sys/time.h>
+
+#include "common/mainloop_clock.hpp"
+
+namespace otbr {
+
+class TimerScheduler;
+
+/**
+ * This class implements a one-shot timer.
+ *
+ * A timer is owned by the caller and linked into the `TimerScheduler` only while it is running, so starting and
+ * stopping a timer does not allocate. A timer is stopped automatically when destroyed.
+ *
+ */
+class Timer
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * This function pointer is called when the timer fires.
+     *
+     * @param[in]   aTimer      A reference to the timer.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    typedef void (*Handler)(Timer &aTimer, void *aContext);
+
+    /**
+     * The constructor to initialize a timer.
+     *
+     * @param[in]   aHandler    The function to be called when the timer fires.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    Timer(Handler aHandler, void *aContext);
+
+    ~Timer(void);
+
+    Timer(const Timer &) = delete;
+    Timer &operator=(const Timer &) = delete;
+
+    /**
+     * This method starts or restarts the timer to fire after a delay.
+     *
+     * @param[in]   aDelay      The delay from the time last sampled by the mainloop, see `MainloopClock::Now()`.
+     *
+     */
+    void Start(std::chrono::microseconds aDelay) { StartAt(MainloopClock::Now() + aDelay); }
+
+    /**
+     * This method starts or restarts the timer to fire at a time point.
+     *
+     * @param[in]   aFireTime   The time point to fire.
+     *
+     */
+    void StartAt(Clock::time_point aFireTime);
+
+    /**
+     * This method stops the timer. Nothing happens if the timer is not running.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether the timer is running.
+     *
+     * @retval  true     The timer is running.
+     * @retval  false    The timer is not running.
+     *
+     */
+    bool IsRunning(void) const { return mHeapIndex != kNotRunning; }
+
+    /**
+     * This method returns the time point the timer fires.
+     *
+     * @returns The fire time point, only valid when the timer is running.
+     *
+     */
+    Clock::time_point GetFireTime(void) const { return mFireTime; }
+
+private:
+    friend class TimerScheduler;
+
+    static const size_t kNotRunning = static_cast<size_t>(-1);
+    static const size_t kDeferred   = static_cast<size_t>(-2);
+
+    Clock::time_point mFireTime;
+    Handler           mHandler;
+    void *            mContext;
+    size_t            mHeapIndex; ///< The index in the scheduler heap, `kDeferred` or `kNotRunning`.
+};
+
+/**
+ * This class implements the scheduler of all running timers.
+ *
+ * Running timers are kept in a binary min-heap, so the next deadline is found in constant time, and starting or
+ * stopping a timer takes logarithmic time.
+ *
+ */
+class TimerScheduler
+{
+public:
+    /**
+     * This method returns the timer scheduler of the calling thread, each thread running a mainloop has its own.
+     *
+     * A timer is started, stopped and fired on the same thread.
+     *
+     * @returns A reference to the timer scheduler.
+     *
+     */
+    static TimerScheduler &Get(void);
+
+    /**
+     * This method posts a one-shot task.
+     *
+     * @param[in]   aFireTime   The time point to run the task.
+     * @param[in]   aTask       The task function.
+     *
+     */
+    void Post(Timer::Clock::time_point aFireTime, const std::function<void(void)> &aTask);
+
+    /**
+     * This method shortens the mainloop timeout to the next deadline.
+     *
+     * @param[inout]    aTimeout    A reference to the timeout.
+     *
+     */
+    void UpdateTimeout(timeval &aTimeout) const;
+
+    /**
+     * This method fires all expired timers.
+     *
+     * The timers started by the handlers to fire at or before the time they were fired at wait for the next call, so
+     * that a timer restarted with no delay doesn't spin.
+     *
+     */
+    void Process(void);
+
+    /**
+     * This method reports the memory of the running timers and the posted tasks to `MemoryStats`.
+     *
+     */
+    void UpdateMemoryStats(void) const;
+
+private:
+    friend class Timer;
+
+    TimerScheduler(void)
+        : mProcessing(false)
+    {
+    }
+
+    void Add(Timer &aTimer);
+    void Remove(Timer &aTimer);
+    void SiftUp(size_t aIndex);
+    void SiftDown(size_t aIndex);
+    void Swap(size_t aFirst, size_t aSecond);
+    bool IsEarlier(size_t aFirst, size_t aSecond) const
+    {
+        return mHeap[aFirst]->mFireTime < mHeap[aSecond]->mFireTime;
+    }
+
+    std::vector<Timer *>     mHeap;
+    std::vector<Timer *>     mDeferred;    ///< The timers due at `mProcessTime` started while processing.
+    Timer::Clock::time_point mProcessTime; ///< The time the timers are fired at while processing.
+    bool                     mProcessing;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_HPP_
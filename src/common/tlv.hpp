@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -47,12 +48,12 @@ namespace otbr {
  */
 class Tlv
 {
+public:
     enum
     {
         kLengthEscape = 0xff, ///< This length value indicates the actual length is of two-bytes length.
     };
 
-public:
     /**
      * This method returns the Tlv type.
      *
@@ -206,6 +207,314 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class implements a bounds-checked iteration over the Tlvs of a buffer, without copying them.
+ *
+ * Iteration stops at the end of the buffer, or before a Tlv that doesn't fit in the rest of the buffer, in which case
+ * `IsTruncated()` tells so. The iterator is its own range:
+ *
+ *     for (const Tlv &tlv : TlvIterator(buffer, length)) { ... }
+ *
+ */
+class TlvIterator
+{
+public:
+    enum
+    {
+        kHeaderSize         = 2, ///< Size of the type and the length of a Tlv.
+        kExtendedHeaderSize = 4, ///< Size of the type and the length of a Tlv in the extended length form.
+    };
+
+    /**
+     * The constructor initializes an iterator at the end of any buffer.
+     *
+     */
+    TlvIterator(void)
+        : mCursor(nullptr)
+        , mEnd(nullptr)
+        , mTruncated(false)
+    {
+    }
+
+    /**
+     * The constructor initializes an iterator at the first Tlv of a buffer.
+     *
+     * @param[in]  aBuffer  A pointer to the Tlvs.
+     * @param[in]  aLength  The length of the Tlvs in bytes.
+     *
+     */
+    TlvIterator(const void *aBuffer, size_t aLength)
+        : mCursor(static_cast<const uint8_t *>(aBuffer))
+        , mEnd(static_cast<const uint8_t *>(aBuffer) + aLength)
+        , mTruncated(false)
+    {
+        Check();
+    }
+
+    /**
+     * This method returns the current Tlv, the iterator must not be at the end.
+     *
+     * @returns A reference to the Tlv in the buffer.
+     *
+     */
+    const Tlv &operator*(void) const { return *reinterpret_cast<const Tlv *>(mCursor); }
+
+    /**
+     * This method returns the current Tlv, the iterator must not be at the end.
+     *
+     * @returns A pointer to the Tlv in the buffer.
+     *
+     */
+    const Tlv *operator->(void) const { return reinterpret_cast<const Tlv *>(mCursor); }
+
+    /**
+     * This method advances to the next Tlv.
+     *
+     * @returns A reference to this iterator.
+     *
+     */
+    TlvIterator &operator++(void)
+    {
+        mCursor = static_cast<const uint8_t *>((*this)->GetValue()) + (*this)->GetLength();
+        Check();
+
+        return *this;
+    }
+
+    /**
+     * This method returns if two iterators are at the same Tlv.
+     *
+     * @param[in]  aOther  The other iterator.
+     *
+     * @returns Whether the iterators are at the same Tlv, or both at the end.
+     *
+     */
+    bool operator==(const TlvIterator &aOther) const { return mCursor == aOther.mCursor; }
+
+    /**
+     * This method returns if two iterators are at different Tlvs.
+     *
+     * @param[in]  aOther  The other iterator.
+     *
+     * @returns Whether the iterators are at different Tlvs.
+     *
+     */
+    bool operator!=(const TlvIterator &aOther) const { return mCursor != aOther.mCursor; }
+
+    /**
+     * This method returns if the iteration stopped before a Tlv that doesn't fit in the buffer.
+     *
+     * @returns Whether the buffer is truncated.
+     *
+     */
+    bool IsTruncated(void) const { return mTruncated; }
+
+    /**
+     * This function returns the first Tlv of a type in a buffer.
+     *
+     * @param[in]  aBuffer  A pointer to the Tlvs.
+     * @param[in]  aLength  The length of the Tlvs in bytes.
+     * @param[in]  aType    The Tlv type.
+     *
+     * @returns A pointer to the Tlv in the buffer, or nullptr if there is no complete Tlv of @p aType.
+     *
+     */
+    static const Tlv *Find(const void *aBuffer, size_t aLength, uint8_t aType)
+    {
+        for (TlvIterator iterator(aBuffer, aLength); iterator != TlvIterator(); ++iterator)
+        {
+            if (iterator->GetType() == aType)
+            {
+                return &*iterator;
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+    // Moves to the end unless the Tlv at the cursor fits in the buffer.
+    void Check(void)
+    {
+        size_t remaining = static_cast<size_t>(mEnd - mCursor);
+        size_t header    = kHeaderSize;
+
+        if (remaining == 0)
+        {
+            mCursor = nullptr;
+            return;
+        }
+
+        if (remaining >= kHeaderSize && mCursor[1] == Tlv::kLengthEscape)
+        {
+            header = kExtendedHeaderSize;
+        }
+
+        if (remaining < header || remaining - header < (*this)->GetLength())
+        {
+            mCursor    = nullptr;
+            mTruncated = true;
+        }
+    }
+
+    const uint8_t *mCursor; ///< The current Tlv, nullptr at the end.
+    const uint8_t *mEnd;
+    bool           mTruncated;
+};
+
+/**
+ * This function returns the iterator as the beginning of its range.
+ *
+ * @param[in]  aIterator  The iterator.
+ *
+ * @returns The iterator.
+ *
+ */
+inline TlvIterator begin(TlvIterator aIterator)
+{
+    return aIterator;
+}
+
+/**
+ * This function returns the end of the range of an iterator.
+ *
+ * @returns The end iterator.
+ *
+ */
+inline TlvIterator end(const TlvIterator &)
+{
+    return TlvIterator();
+}
+
+/**
+ * This class implements appending Tlvs to a preallocated buffer.
+ *
+ * The extended length form is used for values of at least `Tlv::kLengthEscape` bytes. Appending stops at the first
+ * Tlv that doesn't fit, which `IsOverflowed()` tells.
+ *
+ */
+class TlvWriter
+{
+public:
+    /**
+     * The constructor initializes a writer at the beginning of a buffer.
+     *
+     * @param[in]  aBuffer  A pointer to the buffer.
+     * @param[in]  aSize    The size of the buffer in bytes.
+     *
+     */
+    TlvWriter(void *aBuffer, size_t aSize)
+        : mBuffer(static_cast<uint8_t *>(aBuffer))
+        , mSize(aSize)
+        , mLength(0)
+        , mOverflowed(false)
+    {
+    }
+
+    /**
+     * This method appends a Tlv whose value is built in place.
+     *
+     * @param[in]  aType    The Tlv type.
+     * @param[in]  aLength  The length of the value in bytes.
+     *
+     * @returns A pointer to the value in the buffer to be written by the caller, or nullptr if the Tlv doesn't fit.
+     *
+     */
+    uint8_t *Reserve(uint8_t aType, uint16_t aLength)
+    {
+        size_t   header =
+            (aLength >= Tlv::kLengthEscape) ? TlvIterator::kExtendedHeaderSize : TlvIterator::kHeaderSize;
+        uint8_t *value = nullptr;
+
+        if (!mOverflowed && mSize - mLength >= header + aLength)
+        {
+            Tlv *tlv = reinterpret_cast<Tlv *>(mBuffer + mLength);
+
+            tlv->SetType(aType);
+            tlv->SetLength(aLength);
+            value = mBuffer + mLength + header;
+            mLength += header + aLength;
+        }
+        else
+        {
+            mOverflowed = true;
+        }
+
+        return value;
+    }
+
+    /**
+     * This method appends a Tlv.
+     *
+     * @param[in]  aType    The Tlv type.
+     * @param[in]  aValue   A pointer to the value.
+     * @param[in]  aLength  The length of the value in bytes.
+     *
+     * @returns Whether the Tlv fit in the buffer.
+     *
+     */
+    bool Append(uint8_t aType, const void *aValue, uint16_t aLength)
+    {
+        uint8_t *value = Reserve(aType, aLength);
+
+        if (value != nullptr && aLength > 0)
+        {
+            memcpy(value, aValue, aLength);
+        }
+
+        return value != nullptr;
+    }
+
+    /**
+     * This method appends a Tlv of a uint8_t value.
+     *
+     * @param[in]  aType   The Tlv type.
+     * @param[in]  aValue  The value.
+     *
+     * @returns Whether the Tlv fit in the buffer.
+     *
+     */
+    bool Append(uint8_t aType, uint8_t aValue) { return Append(aType, &aValue, sizeof(aValue)); }
+
+    /**
+     * This method appends a Tlv of a uint16_t value, in network byte order.
+     *
+     * @param[in]  aType   The Tlv type.
+     * @param[in]  aValue  The value.
+     *
+     * @returns Whether the Tlv fit in the buffer.
+     *
+     */
+    bool Append(uint8_t aType, uint16_t aValue)
+    {
+        uint8_t value[sizeof(aValue)] = {static_cast<uint8_t>(aValue >> 8), static_cast<uint8_t>(aValue & 0xff)};
+
+        return Append(aType, value, sizeof(value));
+    }
+
+    /**
+     * This method returns the length of the Tlvs written.
+     *
+     * @returns The length in bytes.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns if a Tlv didn't fit in the buffer, the following ones are not appended either.
+     *
+     * @returns Whether the buffer overflowed.
+     *
+     */
+    bool IsOverflowed(void) const { return mOverflowed; }
+
+private:
+    uint8_t *mBuffer;
+    size_t   mSize;
+    size_t   mLength;
+    bool     mOverflowed;
+};
+
 namespace Meshcop {
 
 enum
@@ -221,6 +530,16 @@ enum
     kJoinerRouterKek         = 21,
     kUdpEncapsulation        = 48,
     kIPv6Address             = 49,
+    kChannel                 = 0,
+    kPanId                   = 1,
+    kExtendedPanId           = 2,
+    kNetworkName             = 3,
+    kPskc                    = 4,
+    kMasterKey               = 5,
+    kMeshLocalPrefix         = 7,
+    kSecurityPolicy          = 12,
+    kActiveTimestamp         = 14,
+    kChannelMask             = 53,
 };
 
 enum
@@ -0,0 +1,294 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary trace of border router events.
+ */
+
+#include "common/trace.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+static_assert(sizeof(otbrTraceHeader) % sizeof(uint64_t) == 0, "Trace header breaks the alignment of records");
+static_assert(sizeof(otbrTraceRecord) == OTBR_TRACE_RECORD_SIZE, "Trace record has padding");
+
+static const size_t kTraceFileSize   = sizeof(otbrTraceHeader) + OTBR_TRACE_RECORDS * sizeof(otbrTraceRecord);
+static const size_t kTraceMemorySize = sizeof(otbrTraceHeader) + OTBR_TRACE_MEMORY_RECORDS * sizeof(otbrTraceRecord);
+
+static otbrTraceHeader *sTraceHeader  = nullptr;
+static otbrTraceRecord *sTraceRecords = nullptr;
+static size_t           sTraceSize    = 0;
+static uint32_t         sRecordCount  = 0;
+static bool             sTraceFile    = false;
+static char             sDumpPath[PATH_MAX];
+
+static const int kCrashSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+static otbrError TraceToMemory(void)
+{
+    otbrError error   = OTBR_ERROR_ERRNO;
+    void *    mapping = mmap(nullptr, kTraceMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    VerifyOrExit(mapping != MAP_FAILED);
+
+    sTraceHeader = static_cast<otbrTraceHeader *>(mapping);
+    memcpy(sTraceHeader->mMagic, OTBR_TRACE_MAGIC, sizeof(OTBR_TRACE_MAGIC));
+    sTraceHeader->mVersion     = OTBR_TRACE_VERSION;
+    sTraceHeader->mRecordSize  = sizeof(otbrTraceRecord);
+    sTraceHeader->mRecordCount = OTBR_TRACE_MEMORY_RECORDS;
+    error                      = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+static otbrError TraceToFile(const char *aPath)
+{
+    otbrError   error = OTBR_ERROR_ERRNO;
+    int         fd    = -1;
+    void *      mapping;
+    struct stat st;
+
+    fd = open(aPath, O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, 0600);
+    VerifyOrExit(fd != -1);
+    VerifyOrExit(fstat(fd, &st) == 0);
+
+    if (static_cast<size_t>(st.st_size) != kTraceFileSize)
+    {
+        VerifyOrExit(ftruncate(fd, 0) == 0 && ftruncate(fd, static_cast<off_t>(kTraceFileSize)) == 0);
+    }
+
+    mapping = mmap(nullptr, kTraceFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    VerifyOrExit(mapping != MAP_FAILED);
+
+    sTraceHeader = static_cast<otbrTraceHeader *>(mapping);
+
+    if (memcmp(sTraceHeader->mMagic, OTBR_TRACE_MAGIC, sizeof(OTBR_TRACE_MAGIC)) != 0 ||
+        sTraceHeader->mVersion != OTBR_TRACE_VERSION || sTraceHeader->mRecordSize != sizeof(otbrTraceRecord) ||
+        sTraceHeader->mRecordCount != OTBR_TRACE_RECORDS)
+    {
+        memset(mapping, 0, kTraceFileSize);
+        memcpy(sTraceHeader->mMagic, OTBR_TRACE_MAGIC, sizeof(OTBR_TRACE_MAGIC));
+        sTraceHeader->mVersion     = OTBR_TRACE_VERSION;
+        sTraceHeader->mRecordSize  = sizeof(otbrTraceRecord);
+        sTraceHeader->mRecordCount = OTBR_TRACE_RECORDS;
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+    return error;
+}
+
+otbrError otbrTraceInit(const char *aPath)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(sTraceHeader == nullptr);
+
+    if (aPath != nullptr)
+    {
+        error = TraceToFile(aPath);
+        otbrLogResult(error, "Trace to %s", aPath);
+    }
+    else
+    {
+        error = TraceToMemory();
+        otbrLogResult(error, "Trace to memory");
+    }
+    SuccessOrExit(error);
+
+    sTraceRecords = reinterpret_cast<otbrTraceRecord *>(sTraceHeader + 1);
+    sRecordCount  = sTraceHeader->mRecordCount;
+    sTraceSize    = sizeof(otbrTraceHeader) + sRecordCount * sizeof(otbrTraceRecord);
+    sTraceFile    = (aPath != nullptr);
+
+exit:
+    return error;
+}
+
+bool otbrTraceIsEnabled(void)
+{
+    return sTraceHeader != nullptr;
+}
+
+void otbrTrace(uint16_t aEvent, uint32_t aValue, const void *aData, uint16_t aLength)
+{
+    otbrTraceHeader *header = sTraceHeader;
+    otbrTraceRecord *record;
+    uint64_t         sequence;
+    timespec         now;
+
+    VerifyOrExit(header != nullptr);
+
+    sequence = __atomic_fetch_add(&header->mSequence, 1, __ATOMIC_RELAXED);
+    record   = &sTraceRecords[sequence % sRecordCount];
+
+    // A record left all ones by a crash while it was written is skipped by the decoder.
+    __atomic_store_n(&record->mSequence, UINT32_MAX, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    aLength = (aLength < sizeof(record->mData)) ? aLength : sizeof(record->mData);
+
+    record->mTimestamp = static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+    record->mEvent     = aEvent;
+    record->mLength    = aLength;
+    record->mValue     = aValue;
+    if (aLength > 0)
+    {
+        memcpy(record->mData, aData, aLength);
+    }
+
+    __atomic_store_n(&record->mSequence, static_cast<uint32_t>(sequence), __ATOMIC_RELEASE);
+
+exit:
+    return;
+}
+
+otbrError otbrTraceDump(const char *aPath)
+{
+    otbrError      error  = OTBR_ERROR_ERRNO;
+    const uint8_t *buffer = reinterpret_cast<const uint8_t *>(sTraceHeader);
+    size_t         length = sTraceSize;
+    int            fd     = -1;
+
+    VerifyOrExit(sTraceHeader != nullptr, error = OTBR_ERROR_NOT_FOUND);
+
+    // Only async-signal-safe functions are called, so that the trace can be dumped from a signal handler.
+    // The trace keeps request URLs and addresses, a link in place of the dump file is not followed.
+    fd = open(aPath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_NOFOLLOW, 0600);
+    VerifyOrExit(fd != -1);
+
+    while (length > 0)
+    {
+        ssize_t written = write(fd, buffer, length);
+
+        if (written < 0)
+        {
+            VerifyOrExit(errno == EINTR);
+            continue;
+        }
+
+        buffer += written;
+        length -= static_cast<size_t>(written);
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+    return error;
+}
+
+static void HandleDumpSignal(int aSignal)
+{
+    int savedErrno = errno;
+
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+    otbrTraceDump(sDumpPath);
+    errno = savedErrno;
+}
+
+static void HandleCrashSignal(int aSignal)
+{
+    otbrTraceDump(sDumpPath);
+
+    // The handler was reset to the default one, which terminates the process with the original signal.
+    raise(aSignal);
+}
+
+otbrError otbrTraceSetDumpPath(const char *aPath)
+{
+    otbrError        error  = OTBR_ERROR_INVALID_ARGS;
+    size_t           length = strnlen(aPath, sizeof(sDumpPath));
+    struct sigaction action;
+
+    VerifyOrExit(length < sizeof(sDumpPath));
+    memcpy(sDumpPath, aPath, length + 1);
+
+    memset(&action, 0, sizeof(action));
+    sigemptyset(&action.sa_mask);
+    action.sa_flags   = SA_RESTART;
+    action.sa_handler = HandleDumpSignal;
+    VerifyOrExit(sigaction(SIGUSR2, &action, nullptr) == 0, error = OTBR_ERROR_ERRNO);
+
+    // A trace file is kept by the kernel when the process crashes, only the trace in memory is dumped.
+    if (!sTraceFile)
+    {
+        action.sa_flags   = SA_RESETHAND | SA_NODEFER;
+        action.sa_handler = HandleCrashSignal;
+
+        for (int crashSignal : kCrashSignals)
+        {
+            VerifyOrExit(sigaction(crashSignal, &action, nullptr) == 0, error = OTBR_ERROR_ERRNO);
+        }
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    otbrLogResult(error, "Dump the trace to %s", aPath);
+    return error;
+}
+
+void otbrTraceDeinit(void)
+{
+    VerifyOrExit(sTraceHeader != nullptr);
+
+    if (sTraceFile)
+    {
+        msync(sTraceHeader, sTraceSize, MS_SYNC);
+    }
+    munmap(sTraceHeader, sTraceSize);
+    sTraceHeader  = nullptr;
+    sTraceRecords = nullptr;
+
+exit:
+    return;
+}
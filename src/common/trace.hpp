@@ -0,0 +1,199 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary trace of border router events.
+ */
+
+#ifndef OTBR_COMMON_TRACE_HPP_
+#define OTBR_COMMON_TRACE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+/**
+ * The number of records of a trace file, when full the oldest records are overwritten.
+ *
+ */
+#ifndef OTBR_TRACE_RECORDS
+#define OTBR_TRACE_RECORDS 16384
+#endif
+
+/**
+ * The number of records of the trace in memory, which is kept when no trace file is given.
+ *
+ */
+#ifndef OTBR_TRACE_MEMORY_RECORDS
+#define OTBR_TRACE_MEMORY_RECORDS 2048
+#endif
+
+/**
+ * The minimum duration in microseconds of the processing of a mainloop iteration for the iteration to be traced, so
+ * that the records cover a longer period than the idle iterations.
+ *
+ */
+#ifndef OTBR_TRACE_MAINLOOP_MIN_DURATION
+#define OTBR_TRACE_MAINLOOP_MIN_DURATION 1000
+#endif
+
+/**
+ * The size of a trace record, including the record header.
+ *
+ */
+#ifndef OTBR_TRACE_RECORD_SIZE
+#define OTBR_TRACE_RECORD_SIZE 64
+#endif
+
+/**
+ * The directory of the default file the trace is dumped to, which should only be writable by the agent user.
+ *
+ */
+#ifndef OTBR_TRACE_DUMP_DIR
+#define OTBR_TRACE_DUMP_DIR "/var/lib/thread"
+#endif
+
+#define OTBR_TRACE_MAGIC "OTBRTRC"
+#define OTBR_TRACE_VERSION 1
+
+/**
+ * Trace events, the meaning of the value and the data of each event is kept once assigned.
+ *
+ */
+enum
+{
+    OTBR_TRACE_STATE_CHANGED = 1, ///< Value: the otChangedFlags.
+    OTBR_TRACE_REST_REQUEST  = 2, ///< Value: the method, and the route match status << 8. Data: the URL.
+    OTBR_TRACE_LOG_DROPPED   = 3, ///< Value: the number of log records dropped.
+    OTBR_TRACE_NCP_RESET     = 4, ///< Value: the duration of the reset recovery in milliseconds.
+    OTBR_TRACE_RESUME        = 5, ///< Value: the resumed role. Data: the uint32_t milliseconds from the resume to
+                                  ///< the detached role, the attach and the resumed role.
+    OTBR_TRACE_MAINLOOP      = 6, ///< Value: the microseconds processing the iteration. Data: the uint32_t
+                                  ///< microseconds waited for events and the int32_t result of select().
+    OTBR_TRACE_DBUS_REQUEST  = 7, ///< Value: the handling latency in microseconds. Data: the method name.
+};
+
+/**
+ * This structure represents the header of a trace file, all fields are in host byte order.
+ *
+ */
+struct otbrTraceHeader
+{
+    char     mMagic[8];    ///< OTBR_TRACE_MAGIC, null terminated.
+    uint32_t mVersion;     ///< OTBR_TRACE_VERSION.
+    uint32_t mRecordSize;  ///< The size of each record.
+    uint32_t mRecordCount; ///< The number of records following the header.
+    uint32_t mReserved;    ///< Zero.
+    uint64_t mSequence;    ///< The sequence of the next record.
+};
+
+/**
+ * This structure represents a trace record, which is stored at the index of its sequence modulo the record count.
+ *
+ */
+struct otbrTraceRecord
+{
+    uint64_t mTimestamp; ///< The real time in microseconds.
+    uint32_t mSequence;  ///< The low 32 bits of the sequence, all ones while the record is being written.
+    uint16_t mEvent;     ///< The event.
+    uint16_t mLength;    ///< The length of the data.
+    uint32_t mValue;     ///< The value.
+    uint8_t  mData[OTBR_TRACE_RECORD_SIZE - 20];
+};
+
+/**
+ * This function starts tracing to a file, which is mapped in memory, or to a ring of OTBR_TRACE_MEMORY_RECORDS
+ * records in memory.
+ *
+ * The records of a file having the same layout are kept, new records are appended.
+ *
+ * @param[in]   aPath   The path of the trace file, nullptr to trace to memory.
+ *
+ * @retval  OTBR_ERROR_NONE     Successfully started tracing.
+ * @retval  OTBR_ERROR_ERRNO    Failed to create or map the file or the memory.
+ *
+ */
+otbrError otbrTraceInit(const char *aPath);
+
+/**
+ * This function indicates whether tracing is started.
+ *
+ */
+bool otbrTraceIsEnabled(void);
+
+/**
+ * This function traces an event, any thread can trace without locking.
+ *
+ * Nothing is done if tracing is not started.
+ *
+ * @param[in]   aEvent  The event.
+ * @param[in]   aValue  The value of the event.
+ * @param[in]   aData   A pointer to the data of the event, truncated to the data size of a record.
+ * @param[in]   aLength The length of the data.
+ *
+ */
+void otbrTrace(uint16_t aEvent, uint32_t aValue, const void *aData = nullptr, uint16_t aLength = 0);
+
+/**
+ * This function writes the trace to a file, in the layout of a trace file.
+ *
+ * This function is async-signal-safe. A record being written meanwhile is skipped by the decoder.
+ *
+ * @param[in]   aPath   The path of the file.
+ *
+ * @retval  OTBR_ERROR_NONE         Successfully wrote the trace.
+ * @retval  OTBR_ERROR_NOT_FOUND    Tracing is not started.
+ * @retval  OTBR_ERROR_ERRNO        Failed to create or write the file.
+ *
+ */
+otbrError otbrTraceDump(const char *aPath);
+
+/**
+ * This function sets the file the trace is dumped to on SIGUSR2 and, when tracing to memory, on crash signals.
+ *
+ * The crash signals are handled once, by dumping the trace and raising the signal again with the default handler.
+ *
+ * @param[in]   aPath   The path of the dump file.
+ *
+ * @retval  OTBR_ERROR_NONE             Successfully installed the signal handlers.
+ * @retval  OTBR_ERROR_INVALID_ARGS     The path is too long.
+ * @retval  OTBR_ERROR_ERRNO            Failed to install the signal handlers.
+ *
+ */
+otbrError otbrTraceSetDumpPath(const char *aPath);
+
+/**
+ * This function stops tracing, writing the records to the file.
+ *
+ */
+void otbrTraceDeinit(void);
+
+#endif // OTBR_COMMON_TRACE_HPP_
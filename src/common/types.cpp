@@ -28,7 +28,6 @@
 
 #include <cstdio>
 #include <arpa/inet.h>
-#include <sstream>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
@@ -42,14 +41,183 @@ Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
     memcpy(m8, aAddress, sizeof(m8));
 }
 
+static_assert(Ip6Address::kStringSize == INET6_ADDRSTRLEN, "kStringSize doesn't match INET6_ADDRSTRLEN");
+
+namespace {
+
+int ParseHexDigit(char aChar)
+{
+    int digit = -1;
+
+    if (aChar >= '0' && aChar <= '9')
+    {
+        digit = aChar - '0';
+    }
+    else if (aChar >= 'a' && aChar <= 'f')
+    {
+        digit = aChar - 'a' + 10;
+    }
+    else if (aChar >= 'A' && aChar <= 'F')
+    {
+        digit = aChar - 'A' + 10;
+    }
+
+    return digit;
+}
+
+// Parses a dotted-quad IPv4 address without leading zeros, as `inet_pton()`.
+bool ParseIp4Address(const char *aStr, const char *aEnd, uint8_t *aAddress)
+{
+    bool     valid  = false;
+    unsigned octets = 0;
+
+    while (octets < 4)
+    {
+        unsigned value  = 0;
+        unsigned digits = 0;
+
+        while (aStr < aEnd && *aStr >= '0' && *aStr <= '9')
+        {
+            VerifyOrExit(digits == 0 || value != 0);
+            value = value * 10 + static_cast<unsigned>(*aStr - '0');
+            VerifyOrExit(value <= 255);
+            digits++;
+            aStr++;
+        }
+
+        VerifyOrExit(digits > 0);
+        aAddress[octets++] = static_cast<uint8_t>(value);
+
+        if (octets < 4)
+        {
+            VerifyOrExit(aStr < aEnd && *aStr == '.');
+            aStr++;
+        }
+    }
+
+    valid = (aStr == aEnd);
+
+exit:
+    return valid;
+}
+
+char *FormatHex(uint16_t aValue, char *aCursor)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+    int               shift        = 12;
+
+    while (shift > 0 && (aValue >> shift) == 0)
+    {
+        shift -= 4;
+    }
+
+    for (; shift >= 0; shift -= 4)
+    {
+        *aCursor++ = kHexDigits[(aValue >> shift) & 0xf];
+    }
+
+    return aCursor;
+}
+
+char *FormatDecimal(uint8_t aValue, char *aCursor)
+{
+    if (aValue >= 100)
+    {
+        *aCursor++ = static_cast<char>('0' + aValue / 100);
+    }
+
+    if (aValue >= 10)
+    {
+        *aCursor++ = static_cast<char>('0' + aValue / 10 % 10);
+    }
+
+    *aCursor++ = static_cast<char>('0' + aValue % 10);
+
+    return aCursor;
+}
+
+} // namespace
+
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    char   strbuf[kStringSize];
+    size_t length = ToString(strbuf);
 
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 address to string");
+    return std::string(strbuf, length);
+}
 
-    return std::string(strbuf);
+size_t Ip6Address::ToString(char (&aBuffer)[kStringSize]) const
+{
+    uint16_t words[8];
+    int      bestBase   = -1;
+    int      bestLength = 0;
+    int      base       = -1;
+    char *   cursor     = aBuffer;
+
+    for (int i = 0; i < 8; i++)
+    {
+        words[i] = static_cast<uint16_t>(m8[2 * i] << 8 | m8[2 * i + 1]);
+    }
+
+    // The longest run of at least two zero words is compressed, the first one on a tie.
+    for (int i = 0; i <= 8; i++)
+    {
+        if (i < 8 && words[i] == 0)
+        {
+            base = (base == -1) ? i : base;
+        }
+        else if (base != -1)
+        {
+            if (i - base > bestLength && i - base >= 2)
+            {
+                bestBase   = base;
+                bestLength = i - base;
+            }
+            base = -1;
+        }
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (bestBase != -1 && i >= bestBase && i < bestBase + bestLength)
+        {
+            if (i == bestBase)
+            {
+                *cursor++ = ':';
+            }
+            continue;
+        }
+
+        if (i != 0)
+        {
+            *cursor++ = ':';
+        }
+
+        // IPv4-compatible and IPv4-mapped addresses end with the IPv4 address, as formatted by `inet_ntop()`.
+        if (i == 6 && bestBase == 0 && (bestLength == 6 || (bestLength == 5 && words[5] == 0xffff)))
+        {
+            for (int j = 12; j < 16; j++)
+            {
+                if (j > 12)
+                {
+                    *cursor++ = '.';
+                }
+                cursor = FormatDecimal(m8[j], cursor);
+            }
+            break;
+        }
+
+        cursor = FormatHex(words[i], cursor);
+    }
+
+    if (bestBase != -1 && bestBase + bestLength == 8)
+    {
+        *cursor++ = ':';
+    }
+
+    *cursor = '\0';
+
+    return static_cast<size_t>(cursor - aBuffer);
 }
 
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
@@ -77,11 +245,90 @@ void Ip6Address::CopyTo(struct in6_addr &aIn6Addr) const
 
 otbrError Ip6Address::FromString(const char *aStr, Ip6Address &aAddr)
 {
-    int ret;
+    return FromString(aStr, strlen(aStr), aAddr);
+}
+
+otbrError Ip6Address::FromString(const char *aStr, size_t aLength, Ip6Address &aAddr)
+{
+    otbrError   error = OTBR_ERROR_INVALID_ARGS;
+    const char *end   = aStr + aLength;
+    const char *group = aStr; // Start of the current group.
+    uint8_t     address[sizeof(m8)];
+    unsigned    length = 0;  // Number of bytes parsed.
+    int         gap    = -1; // Offset of the "::", if any.
+    unsigned    value  = 0;
+    unsigned    digits = 0;
+
+    if (aStr < end && *aStr == ':')
+    {
+        VerifyOrExit(++aStr < end && *aStr == ':');
+    }
+
+    for (; aStr < end; aStr++)
+    {
+        int digit = ParseHexDigit(*aStr);
+
+        if (digit >= 0)
+        {
+            VerifyOrExit(++digits <= 4);
+            value = (value << 4) | static_cast<unsigned>(digit);
+        }
+        else if (*aStr == ':')
+        {
+            group = aStr + 1;
+
+            if (digits == 0)
+            {
+                VerifyOrExit(gap == -1);
+                gap = static_cast<int>(length);
+                continue;
+            }
+
+            // A single trailing colon is invalid.
+            VerifyOrExit(group < end && length + 2 <= sizeof(address));
+            address[length++] = static_cast<uint8_t>(value >> 8);
+            address[length++] = static_cast<uint8_t>(value);
+            value             = 0;
+            digits            = 0;
+        }
+        else if (*aStr == '.')
+        {
+            VerifyOrExit(length + 4 <= sizeof(address) && ParseIp4Address(group, end, &address[length]));
+            length += 4;
+            digits = 0;
+            break;
+        }
+        else
+        {
+            ExitNow();
+        }
+    }
 
-    ret = inet_pton(AF_INET6, aStr, &aAddr.m8);
+    if (digits > 0)
+    {
+        VerifyOrExit(length + 2 <= sizeof(address));
+        address[length++] = static_cast<uint8_t>(value >> 8);
+        address[length++] = static_cast<uint8_t>(value);
+    }
 
-    return ret == 1 ? OTBR_ERROR_NONE : OTBR_ERROR_INVALID_ARGS;
+    if (gap != -1)
+    {
+        unsigned tail = length - static_cast<unsigned>(gap);
+
+        VerifyOrExit(length < sizeof(address));
+        memmove(&address[sizeof(address) - tail], &address[gap], tail);
+        memset(&address[gap], 0, sizeof(address) - length);
+    }
+    else
+    {
+        VerifyOrExit(length == sizeof(address));
+    }
+
+    memcpy(aAddr.m8, address, sizeof(address));
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
 }
 
 Ip6Address Ip6Address::FromString(const char *aStr)
@@ -98,21 +345,23 @@ void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
     memcpy(reinterpret_cast<void *>(this), &aPrefix, sizeof(*this));
 }
 
-std::string Ip6Prefix::ToString() const
+bool Ip6Prefix::ContainsAddress(const Ip6Address &aAddress) const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    uint8_t length = mLength < 128 ? mLength : 128;
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+    return memcmp(aAddress.m8, mPrefix.m8, length / 8) == 0 &&
+           (length % 8 == 0 || ((aAddress.m8[length / 8] ^ mPrefix.m8[length / 8]) >> (8 - length % 8)) == 0);
+}
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+std::string Ip6Prefix::ToString() const
+{
+    char        strbuf[Ip6Address::kStringSize];
+    std::string str(strbuf, mPrefix.ToString(strbuf));
 
-    sprintf(strbuf, "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+    str += '/';
+    str += std::to_string(mLength);
 
-    return strBuilder.str();
+    return str;
 }
 
 std::string MacAddress::ToString(void) const
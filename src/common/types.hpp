@@ -102,6 +102,11 @@ OTBR_TOOL_PACKED_BEGIN
 class Ip6Address
 {
 public:
+    enum
+    {
+        kStringSize = 46, ///< Size of a buffer of the string representation, equal to INET6_ADDRSTRLEN.
+    };
+
     /**
      * Default constructor.
      *
@@ -179,6 +184,18 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 address to a buffer, without allocating memory.
+     *
+     * The representation is the one of `inet_ntop()`, in the RFC 5952 format.
+     *
+     * @param[out] aBuffer  The buffer to write the null-terminated string representation to.
+     *
+     * @returns The length of the string representation, without the null character.
+     *
+     */
+    size_t ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method returns if the Ip6 address is a multicast address.
      *
@@ -225,6 +242,21 @@ public:
      */
     static otbrError FromString(const char *aStr, Ip6Address &aAddr);
 
+    /**
+     * This function converts Ip6 addresses from text to `Ip6Address`, the text needn't be null-terminated.
+     *
+     * The accepted text is the one of `inet_pton()`.
+     *
+     * @param[in]   aStr     A pointer to the Ip6 address text.
+     * @param[in]   aLength  The length of the Ip6 address text.
+     * @param[out]  aAddr    A reference to `Ip6Address` to output the Ip6 address.
+     *
+     * @retval OTBR_ERROR_NONE          If the Ip6 address was successfully converted.
+     * @retval OTBR_ERROR_INVALID_ARGS  If @p `aStr` is not a valid string representing of Ip6 address.
+     *
+     */
+    static otbrError FromString(const char *aStr, size_t aLength, Ip6Address &aAddr);
+
     /**
      * This method copies the Ip6 address to a `sockaddr_in6` structure.
      *
@@ -254,6 +286,22 @@ private:
 
 } OTBR_TOOL_PACKED_END;
 
+/**
+ * This class implements a hash function of Ip6 addresses, for unordered containers.
+ *
+ */
+struct Ip6AddressHash
+{
+    size_t operator()(const Ip6Address &aAddress) const
+    {
+        uint64_t high = aAddress.m64[0];
+        uint64_t low  = aAddress.m64[1];
+
+        // Addresses of interest mostly share their prefix, so the interface identifier carries most of the entropy.
+        return static_cast<size_t>(low ^ (high * 0x9e3779b97f4a7c15ULL) ^ (low >> 32));
+    }
+};
+
 /**
  * This class represents a Ipv6 prefix.
  *
@@ -298,6 +346,16 @@ public:
      */
     bool IsValid(void) const { return mLength > 0 && mLength <= 128; }
 
+    /**
+     * This method returns if an Ip6 address is in the Ip6 prefix.
+     *
+     * @param[in] aAddress  The Ip6 address.
+     *
+     * @returns  If the first `mLength` bits of @p aAddress equal the ones of the prefix.
+     *
+     */
+    bool ContainsAddress(const Ip6Address &aAddress) const;
+
     Ip6Address mPrefix; ///< The IPv6 prefix.
     uint8_t    mLength; ///< The IPv6 prefix length (in bits).
 } OTBR_TOOL_PACKED_END;
@@ -98,20 +98,60 @@ ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aIn
 ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
 {
     std::string matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
+    // Restarts of the server drop the subscriptions and invalidate the cached properties.
+    std::string ownerMatchRule = "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS
+                                 "',member='NameOwnerChanged',arg0='" OTBR_DBUS_SERVER_PREFIX +
+                                 mInterfaceName + "'";
     DBusError   error;
     ClientError ret = ClientError::ERROR_NONE;
 
     dbus_error_init(&error);
     dbus_bus_add_match(mConnection, matchRule.c_str(), &error);
-
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
+    dbus_bus_add_match(mConnection, ownerMatchRule.c_str(), &error);
     VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
     dbus_connection_add_filter(mConnection, sDBusMessageFilter, this, nullptr);
+    UpdateServerOwner();
 exit:
     dbus_error_free(&error);
     return ret;
 }
 
+void ThreadApiDBus::UpdateServerOwner(void)
+{
+    std::string             serverName = OTBR_DBUS_SERVER_PREFIX + mInterfaceName;
+    std::string             owner;
+    auto                    args = std::tie(owner);
+    DBus::UniqueDBusMessage message(
+        dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_DBUS, "GetNameOwner"));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+
+    dbus_error_init(&error);
+    mServerOwner.clear();
+    VerifyOrExit(message != nullptr);
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, std::tie(serverName)) == OTBR_ERROR_NONE);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    // The server not running is not an error, the owner is learnt from the `NameOwnerChanged` signal of its start.
+    VerifyOrExit(!dbus_error_is_set(&error) && reply != nullptr);
+    VerifyOrExit(DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE);
+    mServerOwner = owner;
+
+exit:
+    dbus_error_free(&error);
+}
+
+bool ThreadApiDBus::IsServerSignal(DBusMessage *aMessage) const
+{
+    const char *sender = dbus_message_get_sender(aMessage);
+    const char *path   = dbus_message_get_path(aMessage);
+
+    return !mServerOwner.empty() && sender != nullptr && path != nullptr && mServerOwner == sender &&
+           OTBR_DBUS_OBJECT_PREFIX + mInterfaceName == path;
+}
+
 DBusHandlerResult ThreadApiDBus::sDBusMessageFilter(DBusConnection *aConnection,
                                                     DBusMessage *   aMessage,
                                                     void *          aThreadApiDBus)
@@ -125,34 +165,178 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 {
     (void)aConnection;
 
+    if (dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL))
+    {
+        HandlePropertiesChanged(aMessage);
+    }
+    else if (dbus_message_is_signal(aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged"))
+    {
+        HandleNameOwnerChanged(aMessage);
+    }
+    else if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL))
+    {
+        HandleScanResult(aMessage);
+    }
+
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+void ThreadApiDBus::HandlePropertiesChanged(DBusMessage *aMessage)
+{
     DBusMessageIter iter, subIter, dictEntryIter, valIter;
     std::string     interfaceName, propertyName, val;
     DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
 
-    VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
+    // Any peer may send a `PropertiesChanged` signal, only the ones of the server invalidate the cache.
+    VerifyOrExit(IsServerSignal(aMessage));
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
     SuccessOrExit(DBusMessageExtract(&iter, interfaceName));
     VerifyOrExit(interfaceName == OTBR_DBUS_THREAD_INTERFACE);
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
-    VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
-    dbus_message_iter_recurse(&dictEntryIter, &valIter);
-    SuccessOrExit(DBusMessageExtract(&valIter, val));
 
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
-    SuccessOrExit(NameToDeviceRole(val, role));
+    // One signal may carry several properties.
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
+    {
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+        mPropertyCache.erase(propertyName);
+
+        if (mCachedProperties.count(propertyName) != 0)
+        {
+            mSignaledProperties.insert(propertyName);
+        }
+
+        if (propertyName != OTBR_DBUS_PROPERTY_DEVICE_ROLE ||
+            dbus_message_iter_get_arg_type(&dictEntryIter) != DBUS_TYPE_VARIANT)
+        {
+            continue;
+        }
+
+        dbus_message_iter_recurse(&dictEntryIter, &valIter);
+        SuccessOrExit(DBusMessageExtract(&valIter, val));
+        SuccessOrExit(NameToDeviceRole(val, role));
+
+        for (const auto &f : mDeviceRoleHandlers)
+        {
+            f(role);
+        }
+    }
+
+exit:
+    return;
+}
+
+void ThreadApiDBus::HandleNameOwnerChanged(DBusMessage *aMessage)
+{
+    std::string              name;
+    std::string              oldOwner;
+    std::string              newOwner;
+    auto                     args = std::tie(name, oldOwner, newOwner);
+    std::vector<std::string> signalNames;
+    const char *             sender = dbus_message_get_sender(aMessage);
+    const char *             path   = dbus_message_get_path(aMessage);
+
+    VerifyOrExit(sender != nullptr && strcmp(sender, DBUS_SERVICE_DBUS) == 0);
+    VerifyOrExit(path != nullptr && strcmp(path, DBUS_PATH_DBUS) == 0);
+    VerifyOrExit(DBusMessageToTuple(*aMessage, args) == OTBR_ERROR_NONE);
+    VerifyOrExit(name == OTBR_DBUS_SERVER_PREFIX + mInterfaceName);
+
+    mServerOwner = newOwner;
+    mPropertyCache.clear();
+    mSignaledProperties.clear();
+
+    // The subscriptions are sent without waiting for the reply, as the connection is being dispatched.
+    VerifyOrExit(!newOwner.empty());
+    signalNames = GetSubscribedSignals();
+    VerifyOrExit(!signalNames.empty());
+    CallDBusMethodAsync(OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD, std::tie(signalNames),
+                        &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::SubscribeSignalsPendingCallHandler>);
 
-    for (const auto &f : mDeviceRoleHandlers)
+exit:
+    return;
+}
+
+void ThreadApiDBus::HandleScanResult(DBusMessage *aMessage)
+{
+    ActiveScanResult result;
+    auto             args = std::tie(result);
+
+    // Only the server reports the results of a scan, not any peer sending the signal.
+    VerifyOrExit(mScanResultHandler != nullptr && IsServerSignal(aMessage));
+    VerifyOrExit(DBusMessageToTuple(*aMessage, args) == OTBR_ERROR_NONE);
+    mScanResultHandler(result);
+
+exit:
+    return;
+}
+
+void ThreadApiDBus::SubscribeSignalsPendingCallHandler(DBusPendingCall *aPending)
+{
+    UniqueDBusMessage message(dbus_pending_call_steal_reply(aPending));
+
+    if (message == nullptr || CheckErrorMessage(message.get()) != ClientError::ERROR_NONE)
     {
-        f(role);
+        // Without the signals, cached values could become stale.
+        mPropertyCache.clear();
+        mCachedProperties.clear();
+        mSignaledProperties.clear();
     }
+}
+
+std::vector<std::string> ThreadApiDBus::GetSubscribedSignals(void) const
+{
+    std::set<std::string> signalNames(mSubscribedSignals);
+
+    signalNames.insert(mCachedProperties.begin(), mCachedProperties.end());
+
+    return std::vector<std::string>(signalNames.begin(), signalNames.end());
+}
+
+ClientError ThreadApiDBus::SubscribeSignals(const std::vector<std::string> &aNames)
+{
+    ClientError error;
+
+    SuccessOrExit(error = CallDBusMethodSync(OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD, std::tie(aNames)));
+    mSubscribedSignals.insert(aNames.begin(), aNames.end());
 
 exit:
-    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    return error;
+}
+
+ClientError ThreadApiDBus::EnablePropertyCache(const std::vector<std::string> &aPropertyNames)
+{
+    ClientError error;
+
+    SuccessOrExit(error = CallDBusMethodSync(OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD, std::tie(aPropertyNames)));
+    mCachedProperties.insert(aPropertyNames.begin(), aPropertyNames.end());
+
+exit:
+    return error;
+}
+
+void ThreadApiDBus::DisablePropertyCache(void)
+{
+    std::vector<std::string> propertyNames;
+
+    for (const std::string &name : mCachedProperties)
+    {
+        // The signals subscribed by `SubscribeSignals()` are kept.
+        if (mSubscribedSignals.find(name) == mSubscribedSignals.end())
+        {
+            propertyNames.push_back(name);
+        }
+    }
+
+    mCachedProperties.clear();
+    mSignaledProperties.clear();
+    mPropertyCache.clear();
+
+    if (!propertyNames.empty())
+    {
+        CallDBusMethodSync(OTBR_DBUS_UNSUBSCRIBE_SIGNALS_METHOD, std::tie(propertyNames));
+    }
 }
 
 void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
@@ -192,6 +376,41 @@ void ThreadApiDBus::ScanPendingCallHandler(DBusPendingCall *aPending)
     mScanHandler = nullptr;
 }
 
+ClientError ThreadApiDBus::ScanStream(const ScanResultHandler &aResultHandler, const OtResultHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    VerifyOrExit(mScanStreamHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mScanResultHandler = aResultHandler;
+    mScanStreamHandler = aHandler;
+
+    error = CallDBusMethodAsync(OTBR_DBUS_SCAN_STREAM_METHOD,
+                                &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::ScanStreamPendingCallHandler>);
+    if (error != ClientError::ERROR_NONE)
+    {
+        mScanResultHandler = nullptr;
+        mScanStreamHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
+void ThreadApiDBus::ScanStreamPendingCallHandler(DBusPendingCall *aPending)
+{
+    ClientError       ret = ClientError::OT_ERROR_FAILED;
+    UniqueDBusMessage message(dbus_pending_call_steal_reply(aPending));
+    auto              handler = mScanStreamHandler;
+
+    if (message != nullptr)
+    {
+        ret = CheckErrorMessage(message.get());
+    }
+
+    mScanResultHandler = nullptr;
+    mScanStreamHandler = nullptr;
+    handler(ret);
+}
+
 ClientError ThreadApiDBus::PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds)
 {
     return CallDBusMethodSync(OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD, std::tie(aPort, aSeconds));
@@ -228,6 +447,31 @@ exit:
     return error;
 }
 
+ClientError ThreadApiDBus::AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, const OtResultHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+    const auto  args  = std::tie(aDatasetTlvs);
+
+    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mAttachHandler = aHandler;
+
+    if (aHandler)
+    {
+        error = CallDBusMethodAsync(OTBR_DBUS_ATTACH_DATASET_METHOD, args,
+                                    &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::AttachPendingCallHandler>);
+    }
+    else
+    {
+        error = CallDBusMethodSync(OTBR_DBUS_ATTACH_DATASET_METHOD, args);
+    }
+    if (error != ClientError::ERROR_NONE)
+    {
+        mAttachHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
 void ThreadApiDBus::AttachPendingCallHandler(DBusPendingCall *aPending)
 {
     ClientError       ret = ClientError::OT_ERROR_FAILED;
@@ -354,11 +598,40 @@ ClientError ThreadApiDBus::AddExternalRoute(const ExternalRoute &aExternalRoute)
     return CallDBusMethodSync(OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD, std::tie(aExternalRoute));
 }
 
+ClientError ThreadApiDBus::StartCommissioning(void)
+{
+    return CallDBusMethodSync(OTBR_DBUS_START_COMMISSIONING_METHOD);
+}
+
+ClientError ThreadApiDBus::StopCommissioning(void)
+{
+    return CallDBusMethodSync(OTBR_DBUS_STOP_COMMISSIONING_METHOD);
+}
+
+ClientError ThreadApiDBus::AddCommissioningJoiners(const std::vector<CommissioningJoiner> &aJoiners)
+{
+    return CallDBusMethodSync(OTBR_DBUS_ADD_COMMISSIONING_JOINERS_METHOD, std::tie(aJoiners));
+}
+
+ClientError ThreadApiDBus::RemoveCommissioningJoiner(uint64_t aEui64)
+{
+    return CallDBusMethodSync(OTBR_DBUS_REMOVE_COMMISSIONING_JOINER_METHOD, std::tie(aEui64));
+}
+
 ClientError ThreadApiDBus::RemoveExternalRoute(const Ip6Prefix &aPrefix)
 {
     return CallDBusMethodSync(OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD, std::tie(aPrefix));
 }
 
+ClientError ThreadApiDBus::UpdateNetworkData(const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                             const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                             const std::vector<ExternalRoute> &aAddedRoutes,
+                                             const std::vector<Ip6Prefix> &    aRemovedRoutes)
+{
+    return CallDBusMethodSync(OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+                              std::tie(aAddedPrefixes, aRemovedPrefixes, aAddedRoutes, aRemovedRoutes));
+}
+
 ClientError ThreadApiDBus::SetMeshLocalPrefix(const std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix)
 {
     return SetProperty(OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX, aPrefix);
@@ -470,6 +743,16 @@ ClientError ThreadApiDBus::GetStableNetworkData(std::vector<uint8_t> &aNetworkDa
     return GetProperty(OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY, aNetworkData);
 }
 
+ClientError ThreadApiDBus::GetNetworkDataVersion(uint8_t &aVersion)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_NETWORK_DATA_VERSION, aVersion);
+}
+
+ClientError ThreadApiDBus::GetStableNetworkDataVersion(uint8_t &aVersion)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_VERSION, aVersion);
+}
+
 ClientError ThreadApiDBus::GetLocalLeaderWeight(uint8_t &aWeight)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT, aWeight);
@@ -495,6 +778,11 @@ ClientError ThreadApiDBus::GetNeighborTable(std::vector<NeighborInfo> &aNeighbor
     return GetProperty(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY, aNeighborTable);
 }
 
+ClientError ThreadApiDBus::GetNeighborLinkQuality(std::vector<NeighborLinkQuality> &aLinkQualities)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_NEIGHBOR_LINK_QUALITY, aLinkQualities);
+}
+
 ClientError ThreadApiDBus::GetPartitionId(uint32_t &aPartitionId)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY, aPartitionId);
@@ -515,11 +803,139 @@ ClientError ThreadApiDBus::GetExternalRoutes(std::vector<ExternalRoute> &aExtern
     return GetProperty(OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES, aExternalRoutes);
 }
 
+ClientError ThreadApiDBus::GetOnMeshPrefixes(std::vector<OnMeshPrefix> &aOnMeshPrefixes)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES, aOnMeshPrefixes);
+}
+
+ClientError ThreadApiDBus::GetCommissioningState(uint8_t &aState)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_COMMISSIONING_STATE, aState);
+}
+
+ClientError ThreadApiDBus::GetCommissioningJoiners(std::vector<CommissioningJoinerProgress> &aJoiners)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_COMMISSIONING_JOINERS, aJoiners);
+}
+
 ClientError ThreadApiDBus::GetRegion(std::string &aRegion)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_REGION, aRegion);
 }
 
+ClientError ThreadApiDBus::GetMeshLocalPrefix(std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX, aPrefix);
+}
+
+ClientError ThreadApiDBus::GetEui64(uint64_t &aEui64)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_EUI64, aEui64);
+}
+
+ClientError ThreadApiDBus::GetOtHostVersion(std::string &aVersion)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_OT_HOST_VERSION, aVersion);
+}
+
+ClientError ThreadApiDBus::GetNdProxyCounters(NdProxyCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetMeshCounters(MeshCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MESH_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetRadioLinkCounters(RadioLinkCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_RADIO_LINK_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetMethodCallCounters(MethodCallCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_METHOD_CALL_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetMemoryUsage(MemoryUsage &aUsage)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MEMORY_USAGE, aUsage);
+}
+
+ClientError ThreadApiDBus::GetMetrics(std::vector<MetricValue> &aMetrics)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_METRICS, aMetrics);
+}
+
+ClientError ThreadApiDBus::GetHealth(HealthStatus &aStatus)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_HEALTH, aStatus);
+}
+
+ClientError ThreadApiDBus::GetPropertiesReply(const std::vector<std::string> &aPropertyNames,
+                                              UniqueDBusMessage &             aReply)
+{
+    UniqueDBusMessage message(
+        dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                     (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(), OTBR_DBUS_THREAD_INTERFACE,
+                                     OTBR_DBUS_GET_PROPERTIES_METHOD));
+    ClientError       ret = ClientError::ERROR_NONE;
+    DBusError         error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    aReply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error) && aReply != nullptr, ret = ClientError::ERROR_DBUS);
+    ret = DBus::CheckErrorMessage(aReply.get());
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::GetPropertyAsync(const std::string &           aPropertyName,
+                                            DBusPendingCallNotifyFunction aFunction,
+                                            void *                        aContext,
+                                            DBusFreeFunction              aFreeContext)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                           (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                           DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
+    DBusPendingCall * pending = nullptr;
+    ClientError       ret     = ClientError::ERROR_NONE;
+
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_pending_call_set_notify(pending, aFunction, aContext, aFreeContext),
+                 ret = ClientError::ERROR_DBUS);
+
+    // The connection keeps its own reference until the reply is dispatched.
+    aContext = nullptr;
+
+exit:
+    if (pending != nullptr)
+    {
+        if (aContext != nullptr)
+        {
+            dbus_pending_call_cancel(pending);
+        }
+        dbus_pending_call_unref(pending);
+    }
+    if (aContext != nullptr)
+    {
+        aFreeContext(aContext);
+    }
+    return ret;
+}
+
 std::string ThreadApiDBus::GetInterfaceName(void)
 {
     return mInterfaceName;
@@ -623,6 +1039,8 @@ ClientError ThreadApiDBus::SetProperty(const std::string &aPropertyName, const V
 
     dbus_error_init(&error);
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    // Properties not signaled on changes are refreshed from the server at the next read.
+    mPropertyCache.erase(aPropertyName);
 
     dbus_message_iter_init_append(message.get(), &iter);
     VerifyOrExit(DBus::DBusMessageEncode(&iter, OTBR_DBUS_THREAD_INTERFACE) == OTBR_ERROR_NONE,
@@ -642,16 +1060,35 @@ exit:
 
 template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::string &aPropertyName, ValType &aValue)
 {
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
-                                                                 DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
-    DBus::UniqueDBusMessage reply = nullptr;
+    DBus::UniqueDBusMessage message   = nullptr;
+    DBus::UniqueDBusMessage reply     = nullptr;
+    auto                    cacheIter = mPropertyCache.find(aPropertyName);
 
     ClientError     ret = ClientError::ERROR_NONE;
     DBusError       error;
     DBusMessageIter iter;
 
     dbus_error_init(&error);
+
+    if (cacheIter != mPropertyCache.end() && mSignaledProperties.count(aPropertyName) == 0 &&
+        std::chrono::steady_clock::now() >= cacheIter->second.mExpiry)
+    {
+        mPropertyCache.erase(cacheIter);
+        cacheIter = mPropertyCache.end();
+    }
+
+    if (cacheIter != mPropertyCache.end())
+    {
+        VerifyOrExit(dbus_message_iter_init(cacheIter->second.mReply.get(), &iter),
+                     ret = ClientError::OT_ERROR_FAILED);
+        VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE,
+                     ret = ClientError::OT_ERROR_FAILED);
+        ExitNow();
+    }
+
+    message.reset(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                               (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                               DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
     otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
     reply = DBus::UniqueDBusMessage(
@@ -663,6 +1100,15 @@ template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::st
     VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE,
                  ret = ClientError::OT_ERROR_FAILED);
 
+    if (mCachedProperties.find(aPropertyName) != mCachedProperties.end())
+    {
+        CachedProperty &cached = mPropertyCache[aPropertyName];
+
+        cached.mReply  = std::move(reply);
+        cached.mExpiry =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(OTBR_DBUS_CLIENT_PROPERTY_CACHE_TTL);
+    }
+
 exit:
     dbus_error_free(&error);
     return ret;
@@ -29,15 +29,35 @@
 #ifndef OTBR_THREAD_API_DBUS_HPP_
 #define OTBR_THREAD_API_DBUS_HPP_
 
+#include <chrono>
 #include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <dbus/dbus.h>
 
+#include "common/code_utils.hpp"
 #include "common/types.hpp"
+#include "dbus/client/client_error.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
+/**
+ * The time in milliseconds a cached property is kept before the server signaled a change of the property.
+ *
+ * The client cannot tell a property not signaled by the server from a property which did not change yet, the cached
+ * value of a property is only kept until invalidated by a signal after a first property changed signal of it.
+ *
+ */
+#ifndef OTBR_DBUS_CLIENT_PROPERTY_CACHE_TTL
+#define OTBR_DBUS_CLIENT_PROPERTY_CACHE_TTL 1000
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -48,8 +68,11 @@ class ThreadApiDBus
 public:
     using DeviceRoleHandler = std::function<void(DeviceRole)>;
     using ScanHandler       = std::function<void(const std::vector<ActiveScanResult> &)>;
+    using ScanResultHandler = std::function<void(const ActiveScanResult &)>;
     using OtResultHandler   = std::function<void(ClientError)>;
 
+    template <typename ValueType> using PropertyHandler = std::function<void(ClientError, const ValueType &)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -102,6 +125,21 @@ public:
      */
     ClientError Scan(const ScanHandler &aHandler);
 
+    /**
+     * This method performs a Thread network scan, passing each network as soon as it is found.
+     *
+     * The networks are passed while the connection is dispatched, all of them before @p aHandler is called.
+     *
+     * @param[in]   aResultHandler  The handler of each found network.
+     * @param[in]   aHandler        The scan completion handler.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError ScanStream(const ScanResultHandler &aResultHandler, const OtResultHandler &aHandler);
+
     /**
      * This method attaches the device to the Thread network.
      * @param[in]   aNetworkName    The network name.
@@ -125,6 +163,19 @@ public:
                        uint32_t                    aChannelMask,
                        const OtResultHandler &     aHandler);
 
+    /**
+     * This method attaches the device to the Thread network of a complete active operational dataset.
+     *
+     * @param[in]   aDatasetTlvs    The MeshCoP TLVs of the active operational dataset.
+     * @param[in]   aHandler        The attach result handler, nullptr to wait for the attach.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, const OtResultHandler &aHandler);
+
     /**
      * This method performs a factory reset.
      *
@@ -231,6 +282,71 @@ public:
      */
     ClientError RemoveExternalRoute(const Ip6Prefix &aPrefix);
 
+    /**
+     * This method applies changes of the on-mesh prefixes and external routes, and registers them at once.
+     *
+     * The removals are applied before the additions. Either all the changes are applied, or none of them if any
+     * fails.
+     *
+     * @param[in]   aAddedPrefixes      The on-mesh prefixes to add.
+     * @param[in]   aRemovedPrefixes    The on-mesh prefixes to remove.
+     * @param[in]   aAddedRoutes        The external routes to add.
+     * @param[in]   aRemovedRoutes      The prefixes of the external routes to remove.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError UpdateNetworkData(const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                  const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                  const std::vector<ExternalRoute> &aAddedRoutes,
+                                  const std::vector<Ip6Prefix> &    aRemovedRoutes);
+
+    /**
+     * This method starts the commissioner of the queue of joiners.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError StartCommissioning(void);
+
+    /**
+     * This method stops the commissioner of the queue of joiners.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError StopCommissioning(void);
+
+    /**
+     * This method queues joiners to commission, either all or none.
+     *
+     * @param[in]   aJoiners    The EUI-64s and PSKds of the joiners.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AddCommissioningJoiners(const std::vector<CommissioningJoiner> &aJoiners);
+
+    /**
+     * This method removes a joiner from the commissioning queue.
+     *
+     * @param[in]   aEui64      The EUI-64 of the joiner.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError RemoveCommissioningJoiner(uint64_t aEui64);
+
     /**
      * This method sets the mesh-local prefix.
      *
@@ -483,6 +599,30 @@ public:
      */
     ClientError GetStableNetworkData(std::vector<uint8_t> &aNetworkData);
 
+    /**
+     * This method gets the network data version, which changes with each change of the network data.
+     *
+     * @param[out]  aVersion   The network data version.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNetworkDataVersion(uint8_t &aVersion);
+
+    /**
+     * This method gets the stable network data version, which changes with each change of the stable network data.
+     *
+     * @param[out]  aVersion   The stable network data version.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetStableNetworkDataVersion(uint8_t &aVersion);
+
     /**
      * This method gets the node's local leader weight.
      *
@@ -543,6 +683,18 @@ public:
      */
     ClientError GetNeighborTable(std::vector<NeighborInfo> &aNeighborTable);
 
+    /**
+     * This method gets the link quality statistics of the neighbors.
+     *
+     * @param[out]  aLinkQualities     The statistics of each neighbor.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNeighborLinkQuality(std::vector<NeighborLinkQuality> &aLinkQualities);
+
     /**
      * This method gets the network's parition id.
      *
@@ -591,6 +743,40 @@ public:
      */
     ClientError GetExternalRoutes(std::vector<ExternalRoute> &aExternalRoutes);
 
+    /**
+     * This method gets the on-mesh prefixes of the network data, with one entry for each Border Router of a prefix.
+     *
+     * @param[out]  aOnMeshPrefixes   The on-mesh prefixes.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetOnMeshPrefixes(std::vector<OnMeshPrefix> &aOnMeshPrefixes);
+
+    /**
+     * This method gets the commissioner state of the commissioning.
+     *
+     * @param[out]  aState      The commissioner state, 0 disabled, 1 petition or 2 active.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetCommissioningState(uint8_t &aState);
+
+    /**
+     * This method gets the progress of the joiners of the commissioning queue.
+     *
+     * @param[out]  aJoiners    The joiners in the order they were queued.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetCommissioningJoiners(std::vector<CommissioningJoinerProgress> &aJoiners);
+
     /**
      * This method gets the region.
      *
@@ -602,6 +788,168 @@ public:
      */
     ClientError GetRegion(std::string &aRegion);
 
+    /**
+     * This method gets the mesh local prefix.
+     *
+     * @param[out]  aPrefix    The mesh local prefix.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetMeshLocalPrefix(std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix);
+
+    /**
+     * This method gets the factory assigned IEEE EUI-64.
+     *
+     * @param[out]  aEui64     The IEEE EUI-64.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetEui64(uint64_t &aEui64);
+
+    /**
+     * This method gets the version of OpenThread running the otbr-agent.
+     *
+     * @param[out]  aVersion   The version string.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetOtHostVersion(std::string &aVersion);
+
+    /**
+     * This method gets the counters of the Backbone Router ND Proxy.
+     *
+     * @param[out]  aCounters    The ND Proxy counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error, or otbr-agent is built without Backbone Router
+     *
+     */
+    ClientError GetNdProxyCounters(NdProxyCounters &aCounters); // For telemetry
+
+    /**
+     * This method gets the sums of the MAC counters of the nodes of the Thread network.
+     *
+     * @param[out]  aCounters    The sums of the MAC counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error, or otbr-agent is built without the REST server
+     *
+     */
+    ClientError GetMeshCounters(MeshCounters &aCounters); // For telemetry
+
+    /**
+     * This method gets the counters of the link to the Radio Co-Processor.
+     *
+     * @param[out]  aCounters    The radio link counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetRadioLinkCounters(RadioLinkCounters &aCounters); // For telemetry
+
+    /**
+     * This method gets the number and latency of the d-bus method calls handled by otbr-agent.
+     *
+     * @param[out]  aCounters    The method call counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetMethodCallCounters(MethodCallCounters &aCounters); // For telemetry
+
+    /**
+     * This method gets the memory held by otbr-agent and by each of its subsystems.
+     *
+     * @param[out]  aUsage       The memory usage.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetMemoryUsage(MemoryUsage &aUsage); // For telemetry
+
+    /**
+     * This method gets the metrics registered by the subsystems of otbr-agent.
+     *
+     * @param[out]  aMetrics    The metrics, by series name.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetMetrics(std::vector<MetricValue> &aMetrics); // For telemetry
+
+    /**
+     * This method gets the liveness and the readiness of otbr-agent.
+     *
+     * @param[out]  aStatus     The health.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    ClientError GetHealth(HealthStatus &aStatus);
+
+    /**
+     * This method gets several properties in a single d-bus call.
+     *
+     * All the values are read by otbr-agent at once, so they are consistent with each other.
+     *
+     * @param[in]   aPropertyNames  The names of the properties, e.g. OTBR_DBUS_PROPERTY_RLOC16.
+     * @param[out]  aValues         The property values, one for each name in the same order.
+     *
+     * @retval ERROR_NONE             successfully performed the dbus function call
+     * @retval ERROR_DBUS             dbus encode/decode error
+     * @retval OT_ERROR_INVALID_ARGS  the number of names and values differ
+     * @retval ...                    OpenThread defined error value otherwise
+     *
+     */
+    template <typename... ValueTypes>
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, ValueTypes &... aValues)
+    {
+        UniqueDBusMessage reply;
+        DBusMessageIter   iter, subIter;
+        ClientError       ret = ClientError::ERROR_NONE;
+
+        VerifyOrExit(aPropertyNames.size() == sizeof...(ValueTypes), ret = ClientError::OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(ret = GetPropertiesReply(aPropertyNames, reply));
+        VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_recurse(&iter, &subIter);
+        ret = ExtractProperties(&subIter, aValues...);
+
+    exit:
+        return ret;
+    }
+
+    /**
+     * This method gets a property without waiting for the reply.
+     *
+     * Any number of requests can be in flight at once, the handlers are called in the order of the replies when the
+     * connection is dispatched.
+     *
+     * @param[in]   aPropertyName   The name of the property, e.g. OTBR_DBUS_PROPERTY_RLOC16.
+     * @param[in]   aHandler        The handler called with the error and the value of the property.
+     *
+     * @retval ERROR_NONE successfully sent the request, @p aHandler will be called
+     * @retval ERROR_DBUS failed to send the request, @p aHandler will not be called
+     *
+     */
+    template <typename ValueType>
+    ClientError GetPropertyAsync(const std::string &aPropertyName, PropertyHandler<ValueType> aHandler)
+    {
+        return GetPropertyAsync(aPropertyName, &sGetPropertyPendingCallHandler<ValueType>,
+                                new PropertyHandler<ValueType>(std::move(aHandler)), &sFreePropertyHandler<ValueType>);
+    }
+
     /**
      * This method returns the network interface name the client is bound to.
      *
@@ -610,6 +958,47 @@ public:
      */
     std::string GetInterfaceName(void);
 
+    /**
+     * This method enables caching the values of properties read by the getters.
+     *
+     * A cached property is read from the server at its first read only, later reads return the cached value until a
+     * property changed signal of the property or a restart of the server invalidates it. The client subscribes to the
+     * property changed signals of the properties, which are received while the d-bus connection is dispatched, so
+     * that the cache should only be enabled by clients dispatching their connection.
+     *
+     * Properties changing without being signaled, like the instant RSSI, are not kept longer than
+     * OTBR_DBUS_CLIENT_PROPERTY_CACHE_TTL, as the client only trusts the signals of a property once it received one.
+     *
+     * @param[in]   aPropertyNames  The names of the properties to be cached.
+     *
+     * @retval ERROR_NONE successfully subscribed to the property changed signals
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError EnablePropertyCache(const std::vector<std::string> &aPropertyNames);
+
+    /**
+     * This method disables caching the values of properties and frees the cached values.
+     *
+     */
+    void DisablePropertyCache(void);
+
+    /**
+     * This method subscribes to signals or property changed signals only sent to subscribed clients, like the
+     * periodically checked counters.
+     *
+     * The subscriptions are sent again when the server restarts, while the d-bus connection is dispatched.
+     *
+     * @param[in]   aNames  The names of the signals or properties, "*" for all of them.
+     *
+     * @retval ERROR_NONE successfully subscribed to the signals
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError SubscribeSignals(const std::vector<std::string> &aNames);
+
 private:
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
@@ -625,9 +1014,63 @@ private:
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
+    ClientError GetPropertiesReply(const std::vector<std::string> &aPropertyNames, UniqueDBusMessage &aReply);
+
+    ClientError GetPropertyAsync(const std::string &           aPropertyName,
+                                 DBusPendingCallNotifyFunction aFunction,
+                                 void *                        aContext,
+                                 DBusFreeFunction              aFreeContext);
+
+    template <typename ValueType>
+    static void sGetPropertyPendingCallHandler(DBusPendingCall *aPending, void *aContext)
+    {
+        UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+        DBusMessageIter   iter;
+        ValueType         value{};
+        ClientError       ret = ClientError::ERROR_NONE;
+
+        VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+        SuccessOrExit(ret = CheckErrorMessage(reply.get()));
+        VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(DBusMessageExtractFromVariant(&iter, value) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+
+    exit:
+        (*static_cast<PropertyHandler<ValueType> *>(aContext))(ret, value);
+    }
+
+    template <typename ValueType> static void sFreePropertyHandler(void *aContext)
+    {
+        delete static_cast<PropertyHandler<ValueType> *>(aContext);
+    }
+
+    ClientError ExtractProperties(DBusMessageIter *aIter)
+    {
+        return dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_INVALID ? ClientError::ERROR_NONE
+                                                                          : ClientError::ERROR_DBUS;
+    }
+    template <typename ValueType, typename... RestTypes>
+    ClientError ExtractProperties(DBusMessageIter *aIter, ValueType &aValue, RestTypes &... aRest)
+    {
+        ClientError ret = ClientError::ERROR_NONE;
+
+        VerifyOrExit(DBusMessageExtractFromVariant(aIter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_next(aIter);
+        ret = ExtractProperties(aIter, aRest...);
+
+    exit:
+        return ret;
+    }
+
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
+    void                     HandlePropertiesChanged(DBusMessage *aMessage);
+    void                     HandleNameOwnerChanged(DBusMessage *aMessage);
+    void                     HandleScanResult(DBusMessage *aMessage);
+    bool                     IsServerSignal(DBusMessage *aMessage) const;
+    void                     UpdateServerOwner(void);
+    std::vector<std::string> GetSubscribedSignals(void) const;
+    void                     SubscribeSignalsPendingCallHandler(DBusPendingCall *aPending);
 
     template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
     static void sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus);
@@ -637,6 +1080,7 @@ private:
     void        JoinerStartPendingCallHandler(DBusPendingCall *aPending);
     static void sScanPendingCallHandler(DBusPendingCall *aPending, void *aThreadApiDBus);
     void        ScanPendingCallHandler(DBusPendingCall *aPending);
+    void        ScanStreamPendingCallHandler(DBusPendingCall *aPending);
 
     static void EmptyFree(void *aData) { (void)aData; }
 
@@ -644,12 +1088,31 @@ private:
 
     DBusConnection *mConnection;
 
-    ScanHandler     mScanHandler;
-    OtResultHandler mAttachHandler;
-    OtResultHandler mFactoryResetHandler;
-    OtResultHandler mJoinerHandler;
+    ScanHandler       mScanHandler;
+    ScanResultHandler mScanResultHandler;
+    OtResultHandler   mScanStreamHandler;
+    OtResultHandler   mAttachHandler;
+    OtResultHandler   mFactoryResetHandler;
+    OtResultHandler   mJoinerHandler;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+
+    struct CachedProperty
+    {
+        UniqueDBusMessage                     mReply;
+        std::chrono::steady_clock::time_point mExpiry;
+    };
+
+    // Unique name of the server, only signals sent by it are handled
+    std::string mServerOwner;
+
+    // Names of the cached properties, the properties signaled at least once, and the cached replies of the reads
+    std::set<std::string>                 mCachedProperties;
+    std::set<std::string>                 mSignaledProperties;
+    std::map<std::string, CachedProperty> mPropertyCache;
+
+    // Names of the signals subscribed by `SubscribeSignals()`
+    std::set<std::string> mSubscribedSignals;
 };
 
 } // namespace DBus
@@ -40,7 +40,9 @@
 #define OTBR_DBUS_OBJECT_PREFIX "/io/openthread/BorderRouter/"
 
 #define OTBR_DBUS_SCAN_METHOD "Scan"
+#define OTBR_DBUS_SCAN_STREAM_METHOD "ScanStream"
 #define OTBR_DBUS_ATTACH_METHOD "Attach"
+#define OTBR_DBUS_ATTACH_DATASET_METHOD "AttachDataset"
 #define OTBR_DBUS_FACTORY_RESET_METHOD "FactoryReset"
 #define OTBR_DBUS_RESET_METHOD "Reset"
 #define OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD "AddOnMeshPrefix"
@@ -50,6 +52,22 @@
 #define OTBR_DBUS_JOINER_STOP_METHOD "JoinerStop"
 #define OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD "AddExternalRoute"
 #define OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD "RemoveExternalRoute"
+#define OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD "UpdateNetworkData"
+#define OTBR_DBUS_GET_PROPERTIES_METHOD "GetProperties"
+#define OTBR_DBUS_START_COMMISSIONING_METHOD "StartCommissioning"
+#define OTBR_DBUS_STOP_COMMISSIONING_METHOD "StopCommissioning"
+#define OTBR_DBUS_ADD_COMMISSIONING_JOINERS_METHOD "AddCommissioningJoiners"
+#define OTBR_DBUS_REMOVE_COMMISSIONING_JOINER_METHOD "RemoveCommissioningJoiner"
+#define OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD "SubscribeSignals"
+#define OTBR_DBUS_UNSUBSCRIBE_SIGNALS_METHOD "UnsubscribeSignals"
+#define OTBR_DBUS_GET_COUNTERS_HISTORY_METHOD "GetCountersHistory"
+#define OTBR_DBUS_GET_CHANNEL_OCCUPANCY_HISTORY_METHOD "GetChannelOccupancyHistory"
+#define OTBR_DBUS_GET_CHILD_TABLE_CHANGES_METHOD "GetChildTableChanges"
+#define OTBR_DBUS_GET_NEIGHBOR_TABLE_CHANGES_METHOD "GetNeighborTableChanges"
+#define OTBR_DBUS_GET_CHILD_TABLE_PAGE_METHOD "GetChildTablePage"
+#define OTBR_DBUS_GET_NEIGHBOR_TABLE_PAGE_METHOD "GetNeighborTablePage"
+
+#define OTBR_DBUS_SCAN_RESULT_SIGNAL "ScanResult"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LEGACY_ULA_PREFIX "LegacyULAPrefix"
@@ -70,16 +88,31 @@
 #define OTBR_DBUS_PROPERTY_LEADER_DATA "LeaderData"
 #define OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY "NetworkData"
 #define OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY "StableNetworkData"
+#define OTBR_DBUS_PROPERTY_NETWORK_DATA_VERSION "NetworkDataVersion"
+#define OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_VERSION "StableNetworkDataVersion"
 #define OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT "LocalLeaderWeight"
 #define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT "ChannelMonitorSampleCount"
 #define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES "ChannelMonitorAllChannelQualities"
 #define OTBR_DBUS_PROPERTY_CHILD_TABLE "ChildTable"
 #define OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY "NeighborTable"
+#define OTBR_DBUS_PROPERTY_NEIGHBOR_LINK_QUALITY "NeighborLinkQuality"
 #define OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY "PartitionID"
 #define OTBR_DBUS_PROPERTY_INSTANT_RSSI "InstantRssi"
 #define OTBR_DBUS_PROPERTY_RADIO_TX_POWER "RadioTxPower"
 #define OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES "ExternalRoutes"
+#define OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES "OnMeshPrefixes"
 #define OTBR_DBUS_PROPERTY_REGION "Region"
+#define OTBR_DBUS_PROPERTY_EUI64 "Eui64"
+#define OTBR_DBUS_PROPERTY_OT_HOST_VERSION "OtHostVersion"
+#define OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS "NdProxyCounters"
+#define OTBR_DBUS_PROPERTY_MESH_COUNTERS "MeshCounters"
+#define OTBR_DBUS_PROPERTY_RADIO_LINK_COUNTERS "RadioLinkCounters"
+#define OTBR_DBUS_PROPERTY_METHOD_CALL_COUNTERS "MethodCallCounters"
+#define OTBR_DBUS_PROPERTY_MEMORY_USAGE "MemoryUsage"
+#define OTBR_DBUS_PROPERTY_METRICS "Metrics"
+#define OTBR_DBUS_PROPERTY_HEALTH "Health"
+#define OTBR_DBUS_PROPERTY_COMMISSIONING_STATE "CommissioningState"
+#define OTBR_DBUS_PROPERTY_COMMISSIONING_JOINERS "CommissioningJoiners"
 
 #define OTBR_ROLE_NAME_DISABLED "disabled"
 #define OTBR_ROLE_NAME_DETACHED "detached"
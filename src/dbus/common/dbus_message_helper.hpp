@@ -60,14 +60,46 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const MacCounters &aCounters
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MacCounters &aCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const IpCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, IpCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NdProxyCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NdProxyCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MeshCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MeshCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioLinkCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, RadioLinkCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MethodCallStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MethodCallStats &aStats);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MethodCallCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MethodCallCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SubsystemMemoryUsage &aUsage);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SubsystemMemoryUsage &aUsage);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MemoryUsage &aUsage);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MemoryUsage &aUsage);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MetricValue &aValue);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MetricValue &aValue);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SubsystemHealth &aHealth);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SubsystemHealth &aHealth);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const HealthStatus &aStatus);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, HealthStatus &aStatus);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CountersSample &aSample);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CountersSample &aSample);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelOccupancy &aOccupancy);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelOccupancy &aOccupancy);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelOccupancyWindow &aWindow);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelOccupancyWindow &aWindow);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChildInfo &aChildInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChildInfo &aChildInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborInfo &aNeighborInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborInfo &aNeighborInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborLinkQuality &aLinkQuality);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborLinkQuality &aLinkQuality);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderData);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelQuality &aQuality);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CommissioningJoiner &aJoiner);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CommissioningJoiner &aJoiner);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CommissioningJoinerProgress &aProgress);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CommissioningJoinerProgress &aProgress);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -83,6 +115,126 @@ template <> struct DBusTypeTrait<MacCounters>
     static constexpr const char *TYPE_AS_STRING = "(uuuuuuuuuuuuuuuuuuuuuuuuuuuuuuuu)";
 };
 
+template <> struct DBusTypeTrait<NdProxyCounters>
+{
+    // struct of seven counters, two arrays of latency buckets, the latency count and sum
+    static constexpr const char *TYPE_AS_STRING = "(tttttttatattt)";
+};
+
+template <> struct DBusTypeTrait<MeshCounters>
+{
+    // struct of the number of nodes and nine sums of counters
+    static constexpr const char *TYPE_AS_STRING = "(uttttttttt)";
+};
+
+template <> struct DBusTypeTrait<RadioLinkCounters>
+{
+    // struct of nine counters, two arrays of latency buckets, the latency count and sum
+    static constexpr const char *TYPE_AS_STRING = "(tttttttttatattt)";
+};
+
+template <> struct DBusTypeTrait<MethodCallStats>
+{
+    // struct of { string, uint64, uint64, uint64, array of uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(stttat)";
+};
+
+template <> struct DBusTypeTrait<std::vector<MethodCallStats>>
+{
+    // array of struct of { string, uint64, uint64, uint64, array of uint64 }
+    static constexpr const char *TYPE_AS_STRING = "a(stttat)";
+};
+
+template <> struct DBusTypeTrait<MethodCallCounters>
+{
+    // struct of { array of uint64, array of method call statistics }
+    static constexpr const char *TYPE_AS_STRING = "(ata(stttat))";
+};
+
+template <> struct DBusTypeTrait<SubsystemMemoryUsage>
+{
+    // struct of { string, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(stt)";
+};
+
+template <> struct DBusTypeTrait<std::vector<SubsystemMemoryUsage>>
+{
+    // array of struct of { string, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "a(stt)";
+};
+
+template <> struct DBusTypeTrait<MemoryUsage>
+{
+    // struct of { uint64, uint64, array of subsystem memory usages }
+    static constexpr const char *TYPE_AS_STRING = "(tta(stt))";
+};
+
+template <> struct DBusTypeTrait<MetricValue>
+{
+    // dict entry of { string, int64 }
+    static constexpr const char *TYPE_AS_STRING = "{sx}";
+};
+
+template <> struct DBusTypeTrait<std::vector<MetricValue>>
+{
+    // dict of string to int64
+    static constexpr const char *TYPE_AS_STRING = "a{sx}";
+};
+
+template <> struct DBusTypeTrait<SubsystemHealth>
+{
+    // struct of { string, bool }
+    static constexpr const char *TYPE_AS_STRING = "(sb)";
+};
+
+template <> struct DBusTypeTrait<std::vector<SubsystemHealth>>
+{
+    // array of struct of { string, bool }
+    static constexpr const char *TYPE_AS_STRING = "a(sb)";
+};
+
+template <> struct DBusTypeTrait<HealthStatus>
+{
+    // struct of { bool, bool, uint32, uint32, array of subsystem healths }
+    static constexpr const char *TYPE_AS_STRING = "(bbuua(sb))";
+};
+
+template <> struct DBusTypeTrait<CountersSample>
+{
+    // struct of { uint64, MAC counters, IPv6 counters }
+    static constexpr const char *TYPE_AS_STRING = "(t(uuuuuuuuuuuuuuuuuuuuuuuuuuuuuuuu)(uuuu))";
+};
+
+template <> struct DBusTypeTrait<std::vector<CountersSample>>
+{
+    // array of struct of { uint64, MAC counters, IPv6 counters }
+    static constexpr const char *TYPE_AS_STRING = "a(t(uuuuuuuuuuuuuuuuuuuuuuuuuuuuuuuu)(uuuu))";
+};
+
+template <> struct DBusTypeTrait<ChannelOccupancy>
+{
+    // struct of { uint8, uint16, uint16, uint16 }
+    static constexpr const char *TYPE_AS_STRING = "(yqqq)";
+};
+
+template <> struct DBusTypeTrait<std::vector<ChannelOccupancy>>
+{
+    // array of struct of { uint8, uint16, uint16, uint16 }
+    static constexpr const char *TYPE_AS_STRING = "a(yqqq)";
+};
+
+template <> struct DBusTypeTrait<ChannelOccupancyWindow>
+{
+    // struct of { uint64, array of channel occupancies }
+    static constexpr const char *TYPE_AS_STRING = "(ta(yqqq))";
+};
+
+template <> struct DBusTypeTrait<std::vector<ChannelOccupancyWindow>>
+{
+    // array of struct of { uint64, array of channel occupancies }
+    static constexpr const char *TYPE_AS_STRING = "a(ta(yqqq))";
+};
+
 template <> struct DBusTypeTrait<LinkModeConfig>
 {
     // struct of four booleans
@@ -107,6 +259,24 @@ template <> struct DBusTypeTrait<Ip6Prefix>
     static constexpr const char *TYPE_AS_STRING = "(ayy)";
 };
 
+template <> struct DBusTypeTrait<std::vector<Ip6Prefix>>
+{
+    // array of {array of bytes, byte}
+    static constexpr const char *TYPE_AS_STRING = "a(ayy)";
+};
+
+template <> struct DBusTypeTrait<OnMeshPrefix>
+{
+    // struct of {{array of bytes, byte}, byte, {bool, bool, bool, bool, bool, bool, bool}}
+    static constexpr const char *TYPE_AS_STRING = "((ayy)y(bbbbbbb))";
+};
+
+template <> struct DBusTypeTrait<std::vector<OnMeshPrefix>>
+{
+    // array of {{array of bytes, byte}, byte, {bool, bool, bool, bool, bool, bool, bool}}
+    static constexpr const char *TYPE_AS_STRING = "a((ayy)y(bbbbbbb))";
+};
+
 template <> struct DBusTypeTrait<ExternalRoute>
 {
     // struct of {{array of bytes, byte}, uint16, byte, bool, bool}
@@ -145,6 +315,20 @@ template <> struct DBusTypeTrait<std::vector<NeighborInfo>>
     static constexpr const char *TYPE_AS_STRING = "a(tuquuyyyqqbbbb)";
 };
 
+template <> struct DBusTypeTrait<NeighborLinkQuality>
+{
+    // struct of { uint64, uint16, bool, uint16, array of uint16, array of uint16,
+    //             uint8, uint8, uint8, uint8, uint8, uint16, uint16, uint16, bool }
+    static constexpr const char *TYPE_AS_STRING = "(tqbqaqaqyyyyyqqqb)";
+};
+
+template <> struct DBusTypeTrait<std::vector<NeighborLinkQuality>>
+{
+    // array of struct of { uint64, uint16, bool, uint16, array of uint16, array of uint16,
+    //                      uint8, uint8, uint8, uint8, uint8, uint16, uint16, uint16, bool }
+    static constexpr const char *TYPE_AS_STRING = "a(tqbqaqaqyyyyyqqqb)";
+};
+
 template <> struct DBusTypeTrait<ChildInfo>
 {
     // struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
@@ -165,6 +349,30 @@ template <> struct DBusTypeTrait<ChannelQuality>
     static constexpr const char *TYPE_AS_STRING = "(yq)";
 };
 
+template <> struct DBusTypeTrait<CommissioningJoiner>
+{
+    // struct of { uint64, string }
+    static constexpr const char *TYPE_AS_STRING = "(ts)";
+};
+
+template <> struct DBusTypeTrait<std::vector<CommissioningJoiner>>
+{
+    // array of struct of { uint64, string }
+    static constexpr const char *TYPE_AS_STRING = "a(ts)";
+};
+
+template <> struct DBusTypeTrait<CommissioningJoinerProgress>
+{
+    // struct of { uint64, uint8, uint16, uint32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(tyquu)";
+};
+
+template <> struct DBusTypeTrait<std::vector<CommissioningJoinerProgress>>
+{
+    // array of struct of { uint64, uint8, uint16, uint32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "a(tyquu)";
+};
+
 template <> struct DBusTypeTrait<std::vector<ChildInfo>>
 {
     // array of struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
@@ -172,6 +380,12 @@ template <> struct DBusTypeTrait<std::vector<ChildInfo>>
     static constexpr const char *TYPE_AS_STRING = "a(tuuqqyyyyqqbbbb)";
 };
 
+template <> struct DBusTypeTrait<bool>
+{
+    static constexpr int         TYPE           = DBUS_TYPE_BOOLEAN;
+    static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_BOOLEAN_AS_STRING;
+};
+
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
@@ -366,7 +580,8 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue)
+template <typename T>
+otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const T *aValues, size_t aLength)
 {
     DBusMessageIter subIter;
     otbrError       error = OTBR_ERROR_NONE;
@@ -374,19 +589,22 @@ template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIte
     VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
                  error = OTBR_ERROR_DBUS);
 
-    if (!aValue.empty())
+    if (aLength > 0)
     {
-        const T *buf = &aValue.front();
-
-        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &buf,
-                                                          static_cast<int>(aValue.size())),
-                     error = OTBR_ERROR_DBUS);
+        VerifyOrExit(
+            dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &aValues, static_cast<int>(aLength)),
+            error = OTBR_ERROR_DBUS);
     }
     VerifyOrExit(dbus_message_iter_close_container(aIter, &subIter), error = OTBR_ERROR_DBUS);
 exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue)
+{
+    return DBusMessageEncodePrimitive(aIter, aValue.data(), aValue.size());
+}
+
 template <typename T, size_t SIZE>
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::array<T, SIZE> &aValue)
 {
@@ -409,6 +627,48 @@ exit:
     return error;
 }
 
+/**
+ * This class derives the d-bus signature of a sequence of C++ types from their DBusTypeTrait.
+ *
+ * A missing DBusTypeTrait is a compile error, and the signature is built once for each sequence of types.
+ *
+ */
+template <typename... FieldTypes> struct DBusSignature;
+
+template <> struct DBusSignature<>
+{
+    static const std::string &Get(void)
+    {
+        static const std::string sSignature;
+
+        return sSignature;
+    }
+};
+
+template <typename FieldType, typename... RestTypes> struct DBusSignature<FieldType, RestTypes...>
+{
+    static const std::string &Get(void)
+    {
+        static const std::string sSignature =
+            std::string(DBusTypeTrait<FieldType>::TYPE_AS_STRING) + DBusSignature<RestTypes...>::Get();
+
+        return sSignature;
+    }
+};
+
+template <size_t... Indexes> struct IndexSequence
+{
+};
+
+template <size_t N, size_t... Indexes> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Indexes...>
+{
+};
+
+template <size_t... Indexes> struct MakeIndexSequence<0, Indexes...>
+{
+    using Type = IndexSequence<Indexes...>;
+};
+
 template <size_t I, typename... FieldTypes> struct ElementType
 {
     using ValueType         = typename std::tuple_element<I, std::tuple<FieldTypes...>>::type;
@@ -504,6 +764,73 @@ exit:
     return error;
 }
 
+/**
+ * This function converts an array of primitive values to a d-bus variant, without copying it to a container first.
+ *
+ * @param[out]  aIter     The message iterator pointing to the variant.
+ * @param[in]   aValues   A pointer to the values.
+ * @param[in]   aLength   The number of values.
+ *
+ * @retval  OTBR_ERROR_NONE   Successfully encoded to the variant.
+ * @retval  OTBR_ERROR_DBUS   Failed to encode to the variant.
+ */
+template <typename T>
+otbrError DBusMessageEncodePrimitiveToVariant(DBusMessageIter *aIter, const T *aValues, size_t aLength)
+{
+    otbrError         error     = OTBR_ERROR_NONE;
+    const std::string signature = std::string(DBUS_TYPE_ARRAY_AS_STRING) + DBusTypeTrait<T>::TYPE_AS_STRING;
+    DBusMessageIter   subIter;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_VARIANT, signature.c_str(), &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncodePrimitive(&subIter, aValues, aLength));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &subIter), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+/**
+ * This function converts a sequence of values to a d-bus variant of an array, one value at a time.
+ *
+ * The values are encoded as soon as they are produced, so a table read through an iterator needs no intermediate
+ * container.
+ *
+ * @param[out]  aIter     The message iterator pointing to the variant.
+ * @param[in]   aNext     A callable with signature `bool(ValueType &)`, which fills the next value and returns
+ *                        whether a value was filled.
+ *
+ * @retval  OTBR_ERROR_NONE   Successfully encoded to the variant.
+ * @retval  OTBR_ERROR_DBUS   Failed to encode to the variant.
+ */
+template <typename ValueType, typename NextFunc>
+otbrError DBusMessageEncodeArrayToVariant(DBusMessageIter *aIter, NextFunc aNext)
+{
+    otbrError       error = OTBR_ERROR_NONE;
+    DBusMessageIter variantIter, arrayIter;
+    ValueType       value;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_VARIANT,
+                                                  DBusTypeTrait<std::vector<ValueType>>::TYPE_AS_STRING, &variantIter),
+                 error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_open_container(&variantIter, DBUS_TYPE_ARRAY,
+                                                  DBusTypeTrait<ValueType>::TYPE_AS_STRING, &arrayIter),
+                 error = OTBR_ERROR_DBUS);
+
+    while (aNext(value))
+    {
+        SuccessOrExit(error = DBusMessageEncode(&arrayIter, value));
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&variantIter, &arrayIter), error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &variantIter), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 /**
  * This function converts a d-bus variant to a value.
  *
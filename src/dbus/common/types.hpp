@@ -476,6 +476,25 @@ struct NeighborInfo
     bool     mIsChild;          ///< Is the neighbor a child
 };
 
+struct NeighborLinkQuality
+{
+    uint64_t              mExtAddress;            ///< IEEE 802.15.4 Extended Address
+    uint16_t              mRloc16;                ///< RLOC16
+    bool                  mIsChild;               ///< Is the neighbor a child
+    uint16_t              mSamples;               ///< The number of samples in the histograms
+    std::vector<uint16_t> mRssiHistogram;         ///< The samples below -90 dBm, in 10 dB buckets, and above -30 dBm
+    std::vector<uint16_t> mLinkQualityHistogram;  ///< The samples of each link quality, from 0 to 3
+    int8_t                mMinRssi;               ///< The lowest RSSI sampled
+    int8_t                mAverageRssi;           ///< The average RSSI of the samples
+    int8_t                mMaxRssi;               ///< The highest RSSI sampled
+    int8_t                mRecentRssi;            ///< The fast moving average of the RSSI
+    int8_t                mBaselineRssi;          ///< The slow moving average of the RSSI
+    uint16_t              mFrameErrorRate;        ///< The latest frame error rate (0xffff->100%)
+    uint16_t              mAverageFrameErrorRate; ///< The average frame error rate of the samples (0xffff->100%)
+    uint16_t              mMessageErrorRate;      ///< The latest (IPv6) message error rate (0xffff->100%)
+    bool                  mDegraded;              ///< Whether the link is degraded
+};
+
 struct LeaderData
 {
     uint32_t mPartitionId;       ///< Partition ID
@@ -485,6 +504,138 @@ struct LeaderData
     uint8_t  mLeaderRouterId;    ///< Leader Router ID
 };
 
+struct CommissioningJoiner
+{
+    uint64_t    mEui64; ///< The EUI-64 of the joiner.
+    std::string mPskd;  ///< The PSKd of the joiner.
+};
+
+struct CommissioningJoinerProgress
+{
+    uint64_t mEui64;     ///< The EUI-64 of the joiner.
+    uint8_t  mState;     ///< The state, 0 queued, 1 active, 2 connected, 3 finalizing, 4 joined or 5 failed.
+    uint16_t mAttempts;  ///< The number of DTLS sessions started by the joiner.
+    uint32_t mQueueTime; ///< The time (in milliseconds) the joiner waited in the queue, so far if still queued.
+    uint32_t mJoinTime;  ///< The time (in milliseconds) since the joiner left the queue, until it joined or failed.
+};
+
+struct NdProxyCounters
+{
+    uint64_t              mMulticastNsReceived; ///< The number of multicast Neighbor Solicitations received.
+    uint64_t              mUnicastNsReceived;   ///< The number of unicast Neighbor Solicitations received.
+    uint64_t              mNsMatched;           ///< The number of Neighbor Solicitations of a proxied DUA.
+    uint64_t              mNaSent;              ///< The number of Neighbor Advertisements sent.
+    uint64_t              mNaFailed;            ///< The number of Neighbor Advertisements failed to be sent.
+    uint64_t              mGroupJoins;          ///< The number of solicited-node multicast groups joined.
+    uint64_t              mGroupLeaves;         ///< The number of solicited-node multicast groups left.
+    std::vector<uint64_t> mLatencyBucketBounds; ///< The upper bounds (in microseconds) of the latency buckets.
+    std::vector<uint64_t> mLatencyBuckets;      ///< The number of solicited advertisements of each latency bucket.
+    uint64_t              mLatencyCount;        ///< The number of solicited advertisements.
+    uint64_t              mLatencySum;          ///< The sum (in microseconds) of the latencies.
+};
+
+struct MeshCounters
+{
+    uint32_t mNumNodes;           ///< The number of nodes whose MAC counters are summed.
+    uint64_t mIfInUnknownProtos;  ///< The sum of the inbound packets with an unknown or unsupported protocol.
+    uint64_t mIfInErrors;         ///< The sum of the inbound packets with errors.
+    uint64_t mIfOutErrors;        ///< The sum of the outbound packets failed to be transmitted.
+    uint64_t mIfInUcastPkts;      ///< The sum of the inbound unicast packets.
+    uint64_t mIfInBroadcastPkts;  ///< The sum of the inbound broadcast packets.
+    uint64_t mIfInDiscards;       ///< The sum of the inbound packets discarded.
+    uint64_t mIfOutUcastPkts;     ///< The sum of the outbound unicast packets.
+    uint64_t mIfOutBroadcastPkts; ///< The sum of the outbound broadcast packets.
+    uint64_t mIfOutDiscards;      ///< The sum of the outbound packets discarded.
+};
+
+struct RadioLinkCounters
+{
+    uint64_t              mTxFrames;            ///< The number of MAC frames transmitted, not including retries.
+    uint64_t              mRxFrames;            ///< The number of MAC frames received.
+    uint64_t              mTxRetries;           ///< The number of MAC frames retransmitted.
+    uint64_t              mTxErrors;            ///< The number of MAC frames failed to be transmitted by the RCP.
+    uint64_t              mRxErrors;            ///< The number of received MAC frames dropped.
+    uint64_t              mTxBytes;             ///< The number of bytes transmitted by the radio device.
+    uint64_t              mRxBytes;             ///< The number of bytes received by the radio device.
+    uint64_t              mDeviceErrors;        ///< The number of framing, parity and overrun errors of the device.
+    uint64_t              mResets;              ///< The number of RCP resets recovered.
+    std::vector<uint64_t> mLatencyBucketBounds; ///< The upper bounds (in microseconds) of the latency buckets.
+    std::vector<uint64_t> mLatencyBuckets;      ///< The number of receptions of each latency bucket.
+    uint64_t              mLatencyCount;        ///< The number of receptions from the radio device.
+    uint64_t              mLatencySum;          ///< The sum (in microseconds) of the latencies.
+};
+
+struct MethodCallStats
+{
+    std::string           mName;           ///< The interface and name of the method.
+    uint64_t              mCalls;          ///< The number of calls handled.
+    uint64_t              mLatencySum;     ///< The sum (in microseconds) of the handling latencies.
+    uint64_t              mLatencyMax;     ///< The maximum (in microseconds) handling latency.
+    std::vector<uint64_t> mLatencyBuckets; ///< The number of calls of each latency bucket.
+};
+
+struct MethodCallCounters
+{
+    std::vector<uint64_t>        mLatencyBucketBounds; ///< The upper bounds (in microseconds) of the latency buckets.
+    std::vector<MethodCallStats> mMethods;             ///< The statistics of each method called at least once.
+};
+
+struct SubsystemMemoryUsage
+{
+    std::string mName;    ///< The name of the subsystem.
+    uint64_t    mCurrent; ///< The estimated number of bytes held now.
+    uint64_t    mPeak;    ///< The highest estimated number of bytes held.
+};
+
+struct MemoryUsage
+{
+    uint64_t                          mResident;     ///< The resident set size of otbr-agent, in bytes.
+    uint64_t                          mResidentPeak; ///< The high-water mark of the resident set size, in bytes.
+    std::vector<SubsystemMemoryUsage> mSubsystems;   ///< The memory held by each subsystem.
+};
+
+struct MetricValue
+{
+    std::string mName;  ///< The series name of the metric, with its labels in the Prometheus format.
+    int64_t     mValue; ///< The value of the metric.
+};
+
+struct SubsystemHealth
+{
+    std::string mName;  ///< The name of the subsystem.
+    bool        mReady; ///< Whether the subsystem is ready.
+};
+
+struct HealthStatus
+{
+    bool                         mLive;             ///< Whether the mainloop of otbr-agent is iterating.
+    bool                         mReady;            ///< Whether the NCP and all the subsystems reported are ready.
+    uint32_t                     mHeartbeatAge;     ///< The time since the last iteration of the mainloop, in ms.
+    uint32_t                     mRadioActivityAge; ///< The time since the radio was last readable, in ms.
+    std::vector<SubsystemHealth> mSubsystems;       ///< The readiness of the subsystems which reported it.
+};
+
+struct CountersSample
+{
+    uint64_t    mTime;        ///< The time the counters were read, in seconds since the Unix epoch.
+    MacCounters mMacCounters; ///< The MAC counters.
+    IpCounters  mIpCounters;  ///< The IPv6 counters.
+};
+
+struct ChannelOccupancy
+{
+    uint8_t  mChannel; ///< The channel.
+    uint16_t mMin;     ///< The lowest occupancy sampled, 0xffff for always busy.
+    uint16_t mAverage; ///< The average occupancy sampled.
+    uint16_t mMax;     ///< The highest occupancy sampled.
+};
+
+struct ChannelOccupancyWindow
+{
+    uint64_t                      mTime;     ///< The start of the window, in seconds since the Unix epoch.
+    std::vector<ChannelOccupancy> mChannels; ///< The occupancies of the channels sampled in the window.
+};
+
 } // namespace DBus
 } // namespace otbr
 
@@ -27,7 +27,10 @@
  */
 
 #include "dbus/server/dbus_agent.hpp"
+#include "agent/instance_params.hpp"
+#include "common/health.hpp"
 #include "common/logging.hpp"
+#include "common/memory_stats.hpp"
 #include "dbus/common/constants.hpp"
 
 namespace otbr {
@@ -62,8 +65,16 @@ otbrError DBusAgent::Init(void)
     VerifyOrExit(dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch, ToggleDBusWatch,
                                                      this, nullptr));
     mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, mNcp));
-    error         = mThreadObject->Init();
+    SuccessOrExit(error = mThreadObject->Init());
+
+    if (InstanceParams::Get().GetDBusCaptureFile() != nullptr &&
+        mCapture.Open(InstanceParams::Get().GetDBusCaptureFile()) == OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_INFO, "Capturing d-bus method calls to %s", InstanceParams::Get().GetDBusCaptureFile());
+        mThreadObject->SetCapture(&mCapture);
+    }
 exit:
+    Health::Get().SetReady(Health::kSubsystemDBus, error == OTBR_ERROR_NONE);
     if (error != OTBR_ERROR_NONE)
     {
         otbrLog(OTBR_LOG_ERR, "dbus error %s: %s", dbusError.name, dbusError.message);
@@ -74,113 +85,163 @@ exit:
 
 dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches[aWatch] = true;
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    agent->mWatches[aWatch] = true;
+    agent->UpdateWatchFd(dbus_watch_get_unix_fd(aWatch));
+    agent->UpdateMemoryStats();
+
     return TRUE;
 }
 
 void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    agent->mWatches.erase(aWatch);
+    agent->UpdateWatchFd(dbus_watch_get_unix_fd(aWatch));
+    agent->UpdateMemoryStats();
+}
+
+void DBusAgent::UpdateMemoryStats(void) const
+{
+    MemoryStats::Get().Update(MemoryStats::kSubsystemDbusWatches,
+                              MemoryStats::TreeSize(mWatches) + MemoryStats::VectorSize(mReadyWatches));
 }
 
 void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches[aWatch] = (dbus_watch_get_enabled(aWatch) ? true : false);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    agent->mWatches[aWatch] = (dbus_watch_get_enabled(aWatch) ? true : false);
+    agent->UpdateWatchFd(dbus_watch_get_unix_fd(aWatch));
 }
 
-void DBusAgent::UpdateFdSet(fd_set &        aReadFdSet,
-                            fd_set &        aWriteFdSet,
-                            fd_set &        aErrorFdSet,
-                            int &           aMaxFd,
-                            struct timeval &aTimeOut)
+void DBusAgent::UpdateWatchFd(int aFd)
 {
-    DBusWatch *  watch = nullptr;
-    unsigned int flags;
-    int          fd;
+    bool     found  = false;
+    uint32_t events = 0;
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
-    {
-        aTimeOut = {0, 0};
-    }
+    VerifyOrExit(aFd >= 0);
 
+    // libdbus may use separate watches for reading and writing the same file descriptor.
     for (const auto &p : mWatches)
     {
-        if (!p.second)
+        unsigned int flags;
+
+        if (dbus_watch_get_unix_fd(p.first) != aFd)
         {
             continue;
         }
 
-        watch = p.first;
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+        found = true;
 
-        if (fd < 0)
+        if (!p.second)
         {
             continue;
         }
 
+        flags = dbus_watch_get_flags(p.first);
+        events |= EventPoller::kEventError;
+
         if (flags & DBUS_WATCH_READABLE)
         {
-            FD_SET(fd, &aReadFdSet);
+            events |= EventPoller::kEventReadable;
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE) && dbus_connection_has_messages_to_send(mConnection.get()))
+        if (flags & DBUS_WATCH_WRITABLE)
         {
-            FD_SET(fd, &aWriteFdSet);
+            events |= EventPoller::kEventWritable;
         }
+    }
 
-        FD_SET(fd, &aErrorFdSet);
-
-        if (fd > aMaxFd)
-        {
-            aMaxFd = fd;
-        }
+    if (!found)
+    {
+        EventPoller::Get().Unregister(aFd);
     }
+    else if (EventPoller::Get().Update(aFd, events) == OTBR_ERROR_NOT_FOUND)
+    {
+        EventPoller::Get().Register(aFd, events, &DBusAgent::HandleDBusEvent, this);
+    }
+
+exit:
+    return;
+}
+
+void DBusAgent::HandleDBusEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    static_cast<DBusAgent *>(aContext)->HandleDBusEvent(aFd, aEvents);
 }
 
-void DBusAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+void DBusAgent::HandleDBusEvent(int aFd, uint32_t aEvents)
 {
-    DBusWatch *  watch = nullptr;
-    unsigned int flags;
-    int          fd;
+    mReadyWatches.clear();
 
     for (const auto &p : mWatches)
     {
-        if (!p.second)
+        if (p.second && dbus_watch_get_unix_fd(p.first) == aFd)
         {
-            continue;
+            mReadyWatches.push_back(p.first);
         }
+    }
 
-        watch = p.first;
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+    for (DBusWatch *watch : mReadyWatches)
+    {
+        unsigned int flags;
+        auto         it = mWatches.find(watch);
 
-        if (fd < 0)
+        // The watch may have been removed or disabled when handling a previous one.
+        if (it == mWatches.end() || !it->second)
         {
             continue;
         }
 
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aReadFdSet))
+        flags = dbus_watch_get_flags(watch);
+
+        if (!(aEvents & EventPoller::kEventReadable))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aWriteFdSet))
+        if (!(aEvents & EventPoller::kEventWritable))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
         }
 
-        if (FD_ISSET(fd, &aErrorFdSet))
+        if (aEvents & EventPoller::kEventError)
         {
             flags |= DBUS_WATCH_ERROR;
         }
 
         dbus_watch_handle(watch, flags);
     }
+}
+
+void DBusAgent::UpdateFdSet(otSysMainloopContext &aMainloop)
+{
+    // A disconnected bus keeps reporting remaining data that is never dispatched, which would spin the mainloop.
+    if (dbus_connection_get_is_connected(mConnection.get()) &&
+        dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+}
+
+void DBusAgent::Process(const otSysMainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    static_assert(OTBR_DBUS_DISPATCH_BUDGET > 0, "OTBR_DBUS_DISPATCH_BUDGET must be positive");
 
-    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_get_dispatch_status(mConnection.get()) &&
-           dbus_connection_read_write_dispatch(mConnection.get(), 0))
-        ;
+    // The messages left are dispatched in the next iteration, as UpdateFdSet() sets a zero timeout for them.
+    for (uint32_t count = 0; count < OTBR_DBUS_DISPATCH_BUDGET; count++)
+    {
+        if (DBUS_DISPATCH_DATA_REMAINS != dbus_connection_get_dispatch_status(mConnection.get()) ||
+            !dbus_connection_read_write_dispatch(mConnection.get(), 0))
+        {
+            break;
+        }
+    }
 }
 
 } // namespace DBus
@@ -31,15 +31,30 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 #include <sys/select.h>
 
+#include "common/event_poller.hpp"
+#include "common/mainloop.h"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/server/dbus_capture.hpp"
 #include "dbus/server/dbus_object.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
 
 #include "agent/ncp_openthread.hpp"
 
+/**
+ * The maximum number of dbus messages dispatched in one mainloop iteration.
+ *
+ * The remaining messages are dispatched in the next iterations, which do not wait for events meanwhile, so that a burst
+ * of dbus calls doesn't delay the radio.
+ *
+ */
+#ifndef OTBR_DBUS_DISPATCH_BUDGET
+#define OTBR_DBUS_DISPATCH_BUDGET 16
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -58,41 +73,39 @@ public:
     /**
      * This method initializes the dbus agent.
      *
+     * The method calls are recorded to the d-bus capture file of the instance parameters, if any.
+     *
      * @returns The intialization error.
      *
      */
     otbrError Init(void);
 
     /**
-     * This method performs the dbus select update.
+     * This method updates the timeout for mainloop.
+     *
+     * The dbus file descriptors are watched by the event poller.
      *
-     * @param[out]      aReadFdSet   The read file descriptors.
-     * @param[out]      aWriteFdSet  The write file descriptors.
-     * @param[out]      aErorFdSet   The error file descriptors.
-     * @param[inout]    aMaxFd       The max file descriptor.
-     * @param[inout]    aTimeOut     The select timeout.
+     * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
      *
      */
-    void UpdateFdSet(fd_set &        aReadFdSet,
-                     fd_set &        aWriteFdSet,
-                     fd_set &        aErrorFdSet,
-                     int &           aMaxFd,
-                     struct timeval &aTimeOut);
+    void UpdateFdSet(otSysMainloopContext &aMainloop);
 
     /**
-     * This method processes the dbus I/O.
+     * This method dispatches at most OTBR_DBUS_DISPATCH_BUDGET pending dbus messages.
      *
-     * @param[in]       aReadFdSet   The read file descriptors.
-     * @param[in]       aWriteFdSet  The write file descriptors.
-     * @param[in]       aErorFdSet   The error file descriptors.
+     * @param[in]       aMainloop   A reference to OpenThread mainloop context.
      *
      */
-    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
+    void Process(const otSysMainloopContext &aMainloop);
 
 private:
     static dbus_bool_t AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void        RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void        ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static void        HandleDBusEvent(void *aContext, int aFd, uint32_t aEvents);
+    void               HandleDBusEvent(int aFd, uint32_t aEvents);
+    void               UpdateWatchFd(int aFd);
+    void               UpdateMemoryStats(void) const;
 
     static const struct timeval kPollTimeout;
 
@@ -101,6 +114,7 @@ private:
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
     UniqueDBusConnection             mConnection;
     otbr::Ncp::ControllerOpenThread *mNcp;
+    DBusCapture                      mCapture;
 
     /**
      * This map is used to track DBusWatch-es.
@@ -108,6 +122,8 @@ private:
      */
     using WatchMap = std::map<DBusWatch *, bool>;
     WatchMap mWatches;
+
+    std::vector<DBusWatch *> mReadyWatches;
 };
 
 } // namespace DBus
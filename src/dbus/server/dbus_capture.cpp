@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary capture of d-bus method calls.
+ */
+
+#include "dbus/server/dbus_capture.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "dbus/common/constants.hpp"
+
+namespace otbr {
+namespace DBus {
+
+namespace {
+
+// The methods whose arguments include the network key, the PSKc or a joiner PSKd.
+const char *const kSecretMethods[] = {
+    OTBR_DBUS_ATTACH_METHOD,
+    OTBR_DBUS_ATTACH_DATASET_METHOD,
+    OTBR_DBUS_JOINER_START_METHOD,
+    OTBR_DBUS_ADD_COMMISSIONING_JOINERS_METHOD,
+};
+
+} // namespace
+
+DBusCapture::DBusCapture(void)
+    : mFile(nullptr)
+{
+}
+
+DBusCapture::~DBusCapture(void)
+{
+    Close();
+}
+
+otbrError DBusCapture::Open(const char *aPath)
+{
+    otbrError             error = OTBR_ERROR_ERRNO;
+    otbrDBusCaptureHeader header;
+    int                   fd;
+
+    Close();
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.mMagic, OTBR_DBUS_CAPTURE_MAGIC, sizeof(OTBR_DBUS_CAPTURE_MAGIC));
+    header.mVersion = OTBR_DBUS_CAPTURE_VERSION;
+
+    fd = open(aPath, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    VerifyOrExit(fd >= 0);
+    mFile = fdopen(fd, "wb");
+    VerifyOrExit(mFile != nullptr, close(fd));
+    VerifyOrExit(fwrite(&header, sizeof(header), 1, mFile) == 1);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to open the d-bus capture file %s: %s", aPath, strerror(errno));
+        Close();
+    }
+    return error;
+}
+
+void DBusCapture::Record(DBusMessage &aMessage, uint64_t aTimestamp, uint64_t aLatency)
+{
+    char *                buffer = nullptr;
+    int                   length = 0;
+    otbrDBusCaptureRecord record;
+
+    VerifyOrExit(mFile != nullptr);
+    VerifyOrExit(!IsSecret(aMessage));
+    VerifyOrExit(dbus_message_marshal(&aMessage, &buffer, &length));
+
+    record.mTimestamp = aTimestamp;
+    record.mLatency   = aLatency > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(aLatency);
+    record.mLength    = static_cast<uint32_t>(length);
+
+    if (fwrite(&record, sizeof(record), 1, mFile) != 1 || fwrite(buffer, 1, record.mLength, mFile) != record.mLength)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to write the d-bus capture file: %s", strerror(errno));
+        Close();
+    }
+
+exit:
+    dbus_free(buffer);
+}
+
+bool DBusCapture::IsSecret(DBusMessage &aMessage)
+{
+    const char *interface = dbus_message_get_interface(&aMessage);
+    const char *member    = dbus_message_get_member(&aMessage);
+    bool        secret    = false;
+
+    VerifyOrExit(interface != nullptr && member != nullptr && strcmp(interface, OTBR_DBUS_THREAD_INTERFACE) == 0);
+
+    for (const char *method : kSecretMethods)
+    {
+        if (strcmp(member, method) == 0)
+        {
+            ExitNow(secret = true);
+        }
+    }
+
+exit:
+    return secret;
+}
+
+void DBusCapture::Close(void)
+{
+    VerifyOrExit(mFile != nullptr);
+    fclose(mFile);
+    mFile = nullptr;
+
+exit:
+    return;
+}
+
+} // namespace DBus
+} // namespace otbr
@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary capture of d-bus method calls.
+ */
+
+#ifndef OTBR_DBUS_SERVER_DBUS_CAPTURE_HPP_
+#define OTBR_DBUS_SERVER_DBUS_CAPTURE_HPP_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <dbus/dbus.h>
+
+#include "common/types.hpp"
+
+#define OTBR_DBUS_CAPTURE_MAGIC "OTBRDBC"
+#define OTBR_DBUS_CAPTURE_VERSION 1
+
+/**
+ * This structure represents the header of a capture file, all fields are in host byte order.
+ *
+ */
+struct otbrDBusCaptureHeader
+{
+    char     mMagic[8]; ///< OTBR_DBUS_CAPTURE_MAGIC, null terminated.
+    uint32_t mVersion;  ///< OTBR_DBUS_CAPTURE_VERSION.
+    uint32_t mReserved; ///< Zero.
+};
+
+/**
+ * This structure represents a captured method call, followed by the method call message in the d-bus wire format.
+ *
+ */
+struct otbrDBusCaptureRecord
+{
+    uint64_t mTimestamp; ///< The real time in microseconds the method call was received.
+    uint32_t mLatency;   ///< The handling latency in microseconds, saturated to UINT32_MAX.
+    uint32_t mLength;    ///< The length of the method call message.
+};
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class appends the method calls handled by the d-bus objects to a capture file.
+ *
+ * The capture keeps the arguments of the method calls, which may be sensitive, e.g. network parameters and joiner
+ * identifiers. The calls carrying credentials (Attach, AttachDataset, JoinerStart and AddCommissioningJoiners) are
+ * not recorded, so they are not replayed either.
+ *
+ */
+class DBusCapture
+{
+public:
+    /**
+     * The constructor of a closed capture.
+     *
+     */
+    DBusCapture(void);
+
+    /**
+     * The destructor closes the capture file.
+     *
+     */
+    ~DBusCapture(void);
+
+    /**
+     * This method creates a capture file.
+     *
+     * The file is only readable by the agent user. It must not exist, so that an existing file or a link planted in a
+     * shared directory is never written to.
+     *
+     * @param[in]   aPath   The path of the capture file.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully opened the capture file.
+     * @retval  OTBR_ERROR_ERRNO    Failed to create or write the file.
+     *
+     */
+    otbrError Open(const char *aPath);
+
+    /**
+     * This method records a method call.
+     *
+     * The latency is the time the method handler ran, the replies sent later by asynchronous handlers are not
+     * included. The method calls carrying credentials are skipped. The capture is closed if the file can't be
+     * written.
+     *
+     * @param[in]   aMessage    The method call message.
+     * @param[in]   aTimestamp  The real time in microseconds the method call was received.
+     * @param[in]   aLatency    The handling latency in microseconds.
+     *
+     */
+    void Record(DBusMessage &aMessage, uint64_t aTimestamp, uint64_t aLatency);
+
+    /**
+     * This method indicates whether method calls are recorded.
+     *
+     */
+    bool IsOpen(void) const { return mFile != nullptr; }
+
+    /**
+     * This method indicates whether a method call carries credentials and is not recorded.
+     *
+     * @param[in]   aMessage    The method call message.
+     *
+     * @returns Whether the method call carries credentials.
+     *
+     */
+    static bool IsSecret(DBusMessage &aMessage);
+
+    /**
+     * This method writes the buffered records and closes the capture file.
+     *
+     */
+    void Close(void);
+
+private:
+    FILE *mFile;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_SERVER_DBUS_CAPTURE_HPP_
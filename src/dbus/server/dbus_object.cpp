@@ -30,9 +30,13 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <chrono>
+
 #include <dbus/dbus.h>
 
 #include "common/logging.hpp"
+#include "common/metrics_registry.hpp"
+#include "common/trace.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_object.hpp"
 
@@ -41,8 +45,24 @@ using std::placeholders::_1;
 namespace otbr {
 namespace DBus {
 
+const uint64_t DBusObject::kLatencyBucketBounds[kNumLatencyBuckets] = {100,   250,   500,    1000,   2500,
+                                                                       10000, 50000, 100000, 500000, 1000000};
+
+namespace {
+
+// Subscribes to the disconnections of d-bus clients, so that their signal subscriptions are dropped.
+const char kNameOwnerChangedMatchRule[] = "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS
+                                          "',member='NameOwnerChanged'";
+
+const char kSubscribeAll[] = "*";
+
+} // namespace
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
-    : mConnection(aConnection)
+    : mDeferredSignalTimer(HandleDeferredSignalTimer, this)
+    , mFilterAdded(false)
+    , mCapture(nullptr)
+    , mConnection(aConnection)
     , mObjectPath(aObjectPath)
 {
 }
@@ -58,6 +78,11 @@ otbrError DBusObject::Init(void)
 
     VerifyOrExit(dbus_connection_register_object_path(mConnection, mObjectPath.c_str(), &vTable, this),
                  error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_connection_add_filter(mConnection, DBusObject::sNameOwnerChangedFilter, this, nullptr),
+                 error = OTBR_ERROR_DBUS);
+    mFilterAdded = true;
+    // The match rule is only added once the filter is, so that no disconnection is missed.
+    dbus_bus_add_match(mConnection, kNameOwnerChangedMatchRule, nullptr);
     RegisterMethod(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD,
                    std::bind(&DBusObject::GetPropertyMethodHandler, this, _1));
     RegisterMethod(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_SET_METHOD,
@@ -118,13 +143,92 @@ DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMe
         {
             DumpDBusMessage(*aMessage);
         }
-        (iter->second)(request);
+
+        {
+            auto                      start     = std::chrono::steady_clock::now();
+            auto                      timestamp = std::chrono::system_clock::now().time_since_epoch();
+            const char *              method    = dbus_message_get_member(aMessage);
+            std::chrono::microseconds latency;
+
+            (iter->second)(request);
+            latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            RecordMethodCall(memberName, static_cast<uint64_t>(latency.count()));
+            otbrTrace(OTBR_TRACE_DBUS_REQUEST, static_cast<uint32_t>(latency.count()), method,
+                      static_cast<uint16_t>(strlen(method)));
+
+            if (mCapture != nullptr)
+            {
+                mCapture->Record(
+                    *aMessage,
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(timestamp).count()),
+                    static_cast<uint64_t>(latency.count()));
+            }
+        }
         handled = DBUS_HANDLER_RESULT_HANDLED;
     }
 
     return handled;
 }
 
+void DBusObject::RecordMethodCall(const std::string &aMemberName, uint64_t aLatency)
+{
+    static MetricsRegistry::HistogramFamily sMethodDurations("otbr_dbus_method_duration_seconds",
+                                                             "Time spent handling D-Bus method calls, by method.",
+                                                             kLatencyBucketBounds, kNumLatencyBuckets,
+                                                             MetricsRegistry::kUnitMicroseconds);
+
+    MethodStats &stats = mMethodStats[aMemberName];
+
+    sMethodDurations.Get(MetricsRegistry::FormatLabel("method", aMemberName)).Add(aLatency);
+
+    for (size_t index = 0; index < kNumLatencyBuckets; index++)
+    {
+        if (aLatency <= kLatencyBucketBounds[index])
+        {
+            stats.mLatencyBuckets[index]++;
+            break;
+        }
+    }
+
+    stats.mCalls++;
+    stats.mLatencySum += aLatency;
+    if (aLatency > stats.mLatencyMax)
+    {
+        stats.mLatencyMax = aLatency;
+    }
+
+    if (aLatency > OTBR_DBUS_SLOW_METHOD_THRESHOLD * 1000ull)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Method %s took %llu ms", aMemberName.c_str(),
+                static_cast<unsigned long long>(aLatency / 1000));
+    }
+}
+
+otError DBusObject::GetMethodCallCountersHandler(DBusMessageIter &aIter)
+{
+    MethodCallCounters counters;
+    otError            error = OT_ERROR_NONE;
+
+    counters.mLatencyBucketBounds.assign(kLatencyBucketBounds, kLatencyBucketBounds + kNumLatencyBuckets);
+
+    for (const auto &entry : mMethodStats)
+    {
+        MethodCallStats stats;
+
+        stats.mName       = entry.first;
+        stats.mCalls      = entry.second.mCalls;
+        stats.mLatencySum = entry.second.mLatencySum;
+        stats.mLatencyMax = entry.second.mLatencyMax;
+        stats.mLatencyBuckets.assign(entry.second.mLatencyBuckets, entry.second.mLatencyBuckets + kNumLatencyBuckets);
+        counters.mMethods.push_back(std::move(stats));
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
 {
     UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
@@ -212,6 +316,50 @@ exit:
     }
 }
 
+void DBusObject::GetPropertiesMethodHandler(DBusRequest &aRequest)
+{
+    UniqueDBusMessage        reply{dbus_message_new_method_return(aRequest.GetMessage())};
+    DBusMessageIter          iter, subIter;
+    std::string              interfaceName = dbus_message_get_interface(aRequest.GetMessage());
+    std::vector<std::string> propertyNames;
+    auto                     args  = std::tie(propertyNames);
+    otError                  error = OT_ERROR_NONE;
+
+    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+    dbus_message_iter_init_append(reply.get(), &iter);
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, DBUS_TYPE_VARIANT_AS_STRING, &subIter),
+                 error = OT_ERROR_NO_BUFS);
+
+    // All handlers run in this call, so the values are read from the same state.
+    for (const std::string &propertyName : propertyNames)
+    {
+        const PropertyHandlerType *handler = FindGetPropertyHandler(interfaceName, propertyName);
+
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+        SuccessOrExit(error = (*handler)(subIter));
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OT_ERROR_NO_BUFS);
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        {
+            otbrLog(OTBR_LOG_DEBUG, "GetProperties %s reply:", interfaceName.c_str());
+            DumpDBusMessage(*reply);
+        }
+
+        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+    }
+    else
+    {
+        otbrLog(OTBR_LOG_WARNING, "GetProperties %s error:%s", interfaceName.c_str(), ConvertToDBusErrorName(error));
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
 {
     DBusMessageIter iter;
@@ -243,8 +391,310 @@ exit:
     return;
 }
 
+void DBusObject::SubscribeSignalsMethodHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(UpdateSubscriptions(aRequest, /* aSubscribe */ true));
+}
+
+void DBusObject::UnsubscribeSignalsMethodHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(UpdateSubscriptions(aRequest, /* aSubscribe */ false));
+}
+
+otError DBusObject::UpdateSubscriptions(DBusRequest &aRequest, bool aSubscribe)
+{
+    const char *             sender        = dbus_message_get_sender(aRequest.GetMessage());
+    std::string              interfaceName = dbus_message_get_interface(aRequest.GetMessage());
+    std::vector<std::string> names;
+    auto                     args  = std::tie(names);
+    otError                  error = OT_ERROR_NONE;
+
+    // Peer-to-peer connections have no sender, their subscriptions could not be dropped.
+    VerifyOrExit(sender != nullptr, error = OT_ERROR_NOT_CAPABLE);
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+
+    for (const std::string &name : names)
+    {
+        std::string fullPath = interfaceName + "." + name;
+
+        if (aSubscribe)
+        {
+            mSubscribers[fullPath].insert(sender);
+        }
+        else
+        {
+            auto iter = mSubscribers.find(fullPath);
+
+            if (iter != mSubscribers.end())
+            {
+                iter->second.erase(sender);
+
+                if (iter->second.empty())
+                {
+                    mSubscribers.erase(iter);
+                }
+            }
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "%s %s to %zu signals", sender, aSubscribe ? "subscribed" : "unsubscribed", names.size());
+
+exit:
+    return error;
+}
+
+bool DBusObject::IsSubscribed(const std::string &aInterfaceName, const std::string &aName) const
+{
+    return mSubscribers.find(aInterfaceName + "." + aName) != mSubscribers.end() ||
+           mSubscribers.find(aInterfaceName + "." + kSubscribeAll) != mSubscribers.end();
+}
+
+void DBusObject::RequireSubscription(const std::string &aInterfaceName, const std::string &aName)
+{
+    mSubscriptionRequired.insert(aInterfaceName + "." + aName);
+}
+
+bool DBusObject::IsSignaled(const std::string &aInterfaceName, const std::string &aName) const
+{
+    return mSubscriptionRequired.find(aInterfaceName + "." + aName) == mSubscriptionRequired.end() ||
+           IsSubscribed(aInterfaceName, aName);
+}
+
+void DBusObject::RemoveSubscriber(const std::string &aSubscriber)
+{
+    for (auto iter = mSubscribers.begin(); iter != mSubscribers.end();)
+    {
+        iter->second.erase(aSubscriber);
+
+        if (iter->second.empty())
+        {
+            iter = mSubscribers.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+DBusHandlerResult DBusObject::sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
+{
+    OTBR_UNUSED_VARIABLE(aConnection);
+
+    return static_cast<DBusObject *>(aData)->NameOwnerChangedFilter(aMessage);
+}
+
+DBusHandlerResult DBusObject::NameOwnerChangedFilter(DBusMessage *aMessage)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+    auto        args = std::tie(name, oldOwner, newOwner);
+
+    VerifyOrExit(!mSubscribers.empty());
+    VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged"));
+    VerifyOrExit(DBusMessageToTuple(*aMessage, args) == OTBR_ERROR_NONE);
+
+    // A unique name losing its owner is a client disconnecting from the bus.
+    if (newOwner.empty() && !oldOwner.empty())
+    {
+        RemoveSubscriber(oldOwner);
+    }
+
+exit:
+    // Other filters and objects may be interested in the signal too.
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+otbrError DBusObject::SignalPropertiesChanged(const std::string &             aInterfaceName,
+                                              const std::vector<std::string> &aPropertyNames)
+{
+    UniqueDBusMessage signalMsg{
+        dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
+    DBusMessageIter iter, subIter, dictEntryIter;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!aPropertyNames.empty());
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const std::string &propertyName : aPropertyNames)
+    {
+        const PropertyHandlerType *handler = FindGetPropertyHandler(aInterfaceName, propertyName);
+
+        VerifyOrExit(handler != nullptr, error = OTBR_ERROR_NOT_FOUND);
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, propertyName));
+        VerifyOrExit((*handler)(dictEntryIter) == OT_ERROR_NONE, error = OTBR_ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "Signal %s properties changed", aInterfaceName.c_str());
+        DumpDBusMessage(*signalMsg);
+    }
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+otbrError DBusObject::SignalModifiedPropertiesChanged(const std::string &             aInterfaceName,
+                                                      const std::vector<std::string> &aPropertyNames)
+{
+    std::vector<std::string> modifiedNames;
+    Timer::Clock::time_point now = Timer::Clock::now();
+
+    for (const std::string &propertyName : aPropertyNames)
+    {
+        std::string value;
+        std::string fullPath = aInterfaceName + "." + propertyName;
+
+        if (!IsSignaled(aInterfaceName, propertyName))
+        {
+            // Changes are not tracked meanwhile, a new subscriber is signaled the value at the next check.
+            mSignaledValues.erase(fullPath);
+            continue;
+        }
+
+        {
+            auto timeIter = mSignaledTimes.find(fullPath);
+
+            if (timeIter != mSignaledTimes.end() &&
+                now - timeIter->second < std::chrono::milliseconds(OTBR_DBUS_SIGNAL_MIN_INTERVAL))
+            {
+                mDeferredProperties[aInterfaceName].insert(propertyName);
+
+                if (!mDeferredSignalTimer.IsRunning())
+                {
+                    mDeferredSignalTimer.Start(std::chrono::milliseconds(OTBR_DBUS_SIGNAL_MIN_INTERVAL));
+                }
+
+                continue;
+            }
+        }
+
+        if (EncodeProperty(aInterfaceName, propertyName, value) != OTBR_ERROR_NONE)
+        {
+            // The property is not available in the current state.
+            continue;
+        }
+
+        {
+            auto valueIter = mSignaledValues.find(fullPath);
+
+            if (valueIter == mSignaledValues.end())
+            {
+                mSignaledValues.emplace(fullPath, std::move(value));
+                modifiedNames.push_back(propertyName);
+            }
+            else if (valueIter->second != value)
+            {
+                valueIter->second = std::move(value);
+                modifiedNames.push_back(propertyName);
+            }
+            else
+            {
+                continue;
+            }
+        }
+
+        mSignaledTimes[fullPath] = now;
+    }
+
+    return SignalPropertiesChanged(aInterfaceName, modifiedNames);
+}
+
+void DBusObject::HandleDeferredSignalTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<DBusObject *>(aContext)->HandleDeferredSignalTimer();
+}
+
+void DBusObject::HandleDeferredSignalTimer(void)
+{
+    std::map<std::string, std::set<std::string>> deferredProperties;
+
+    // Properties within the interval again are deferred to a new map and timer.
+    deferredProperties.swap(mDeferredProperties);
+
+    for (const auto &entry : deferredProperties)
+    {
+        std::vector<std::string> propertyNames(entry.second.begin(), entry.second.end());
+
+        if (SignalModifiedPropertiesChanged(entry.first, propertyNames) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to signal deferred properties of %s", entry.first.c_str());
+        }
+    }
+}
+
+otbrError DBusObject::EncodeProperty(const std::string &aInterfaceName,
+                                     const std::string &aPropertyName,
+                                     std::string &      aValue)
+{
+    const PropertyHandlerType *handler = FindGetPropertyHandler(aInterfaceName, aPropertyName);
+    UniqueDBusMessage          msg{dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), "Scratch")};
+    DBusMessageIter            iter;
+    char *                     buffer = nullptr;
+    int                        length = 0;
+    otbrError                  error  = OTBR_ERROR_NONE;
+
+    VerifyOrExit(handler != nullptr, error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(msg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(msg.get(), &iter);
+    VerifyOrExit((*handler)(iter) == OT_ERROR_NONE, error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_message_marshal(msg.get(), &buffer, &length), error = OTBR_ERROR_DBUS);
+    aValue.assign(buffer, static_cast<size_t>(length));
+    dbus_free(buffer);
+
+exit:
+    return error;
+}
+
+const DBusObject::PropertyHandlerType *DBusObject::FindGetPropertyHandler(const std::string &aInterfaceName,
+                                                                          const std::string &aPropertyName) const
+{
+    const PropertyHandlerType *handler       = nullptr;
+    auto                       interfaceIter = mGetPropertyHandlers.find(aInterfaceName);
+
+    VerifyOrExit(interfaceIter != mGetPropertyHandlers.end());
+
+    {
+        auto propertyIter = interfaceIter->second.find(aPropertyName);
+
+        VerifyOrExit(propertyIter != interfaceIter->second.end());
+        handler = &propertyIter->second;
+    }
+
+exit:
+    return handler;
+}
+
 DBusObject::~DBusObject(void)
 {
+    if (mFilterAdded)
+    {
+        dbus_connection_remove_filter(mConnection, DBusObject::sNameOwnerChangedFilter, this);
+    }
 }
 
 } // namespace DBus
@@ -30,20 +30,42 @@
 #define OTBR_DBUS_DBUS_OBJECT_HPP_
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <dbus/dbus.h>
 
 #include "common/code_utils.hpp"
+#include "common/timer.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/server/dbus_capture.hpp"
 #include "dbus/server/dbus_request.hpp"
 
+/**
+ * The handling latency in milliseconds above which a d-bus method call is logged as slow.
+ *
+ */
+#ifndef OTBR_DBUS_SLOW_METHOD_THRESHOLD
+#define OTBR_DBUS_SLOW_METHOD_THRESHOLD 50
+#endif
+
+/**
+ * The minimum interval in milliseconds between two property changed signals of the same property, sent by
+ * `SignalModifiedPropertiesChanged()`. A property changing again within the interval is signaled once it elapsed.
+ *
+ */
+#ifndef OTBR_DBUS_SIGNAL_MIN_INTERVAL
+#define OTBR_DBUS_SIGNAL_MIN_INTERVAL 100
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -90,6 +112,41 @@ public:
                         const std::string &      aMethodName,
                         const MethodHandlerType &aHandler);
 
+    /**
+     * This method registers a method handler taking the decoded arguments of the call.
+     *
+     * The d-bus signature of the arguments is derived from the parameter types of @p aHandler. A call of another
+     * signature is replied with OT_ERROR_INVALID_ARGS without calling @p aHandler.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aMethodName       The method name.
+     * @param[in]   aObject           The object of the method handler.
+     * @param[in]   aHandler          The method handler, taking the request and the arguments of the call.
+     *
+     */
+    template <typename ObjectType, typename... ArgTypes>
+    void RegisterMethod(const std::string &aInterfaceName,
+                        const std::string &aMethodName,
+                        ObjectType *       aObject,
+                        void (ObjectType::*aHandler)(DBusRequest &, ArgTypes...))
+    {
+        RegisterMethod(aInterfaceName, aMethodName, [aObject, aHandler](DBusRequest &aRequest) {
+            std::tuple<typename std::decay<ArgTypes>::type...> args;
+
+            if (!dbus_message_has_signature(aRequest.GetMessage(),
+                                            DBusSignature<typename std::decay<ArgTypes>::type...>::Get().c_str()) ||
+                ExtractArguments(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+            {
+                aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+            }
+            else
+            {
+                CallMethodHandler(aObject, aHandler, aRequest, args,
+                                  typename MakeIndexSequence<sizeof...(ArgTypes)>::Type());
+            }
+        });
+    }
+
     /**
      * This method registers the get handler for a property.
      *
@@ -115,13 +172,13 @@ public:
                                     const PropertyHandlerType &aHandler);
 
     /**
-     * This method sends a signal.
+     * This method sends a signal, unless it requires a subscription and no d-bus client subscribed to it.
      *
      * @param[in]   aInterfaceName    The interface name.
      * @param[in]   aSignalName       The signal name.
      * @param[in]   aArgs             The tuple to be encoded into the signal.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
+     * @retval OTBR_ERROR_NONE  Signal successfully sent, or not subscribed.
      * @retval OTBR_ERROR_DBUS  Failed to send the signal.
      *
      */
@@ -134,8 +191,41 @@ public:
             dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str())};
         otbrError error = OTBR_ERROR_NONE;
 
+        VerifyOrExit(IsSignaled(aInterfaceName, aSignalName));
+        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+
+        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method sends a signal to a single d-bus client, which needs no subscription to it.
+     *
+     * @param[in]   aDestination      The unique bus name of the client.
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aSignalName       The signal name.
+     * @param[in]   aArgs             The tuple to be encoded into the signal.
+     *
+     * @retval OTBR_ERROR_NONE  Signal successfully sent.
+     * @retval OTBR_ERROR_DBUS  Failed to send the signal.
+     *
+     */
+    template <typename... FieldTypes>
+    otbrError SignalTo(const std::string &              aDestination,
+                       const std::string &              aInterfaceName,
+                       const std::string &              aSignalName,
+                       const std::tuple<FieldTypes...> &aArgs)
+    {
+        UniqueDBusMessage signalMsg{
+            dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str())};
+        otbrError error = OTBR_ERROR_NONE;
+
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        VerifyOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+        VerifyOrExit(dbus_message_set_destination(signalMsg.get(), aDestination.c_str()), error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
 
         VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
 
@@ -144,13 +234,14 @@ public:
     }
 
     /**
-     * This method sends a property changed signal.
+     * This method sends a property changed signal, unless the property requires a subscription and no d-bus client
+     * subscribed to it.
      *
      * @param[in]   aInterfaceName    The interface name.
      * @param[in]   aPropertyName     The property name.
      * @param[in]   aValue            New value of the property.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
+     * @retval OTBR_ERROR_NONE  Signal successfully sent, or not subscribed.
      * @retval OTBR_ERROR_DBUS  Failed to send the signal.
      *
      */
@@ -159,11 +250,13 @@ public:
                                     const std::string &aPropertyName,
                                     const ValueType &  aValue)
     {
-        UniqueDBusMessage signalMsg{
-            dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
-        DBusMessageIter iter, subIter, dictEntryIter;
-        otbrError       error = OTBR_ERROR_NONE;
+        UniqueDBusMessage signalMsg;
+        DBusMessageIter   iter, subIter, dictEntryIter;
+        otbrError         error = OTBR_ERROR_NONE;
 
+        VerifyOrExit(IsSignaled(aInterfaceName, aPropertyName));
+        signalMsg.reset(
+            dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
         dbus_message_iter_init_append(signalMsg.get(), &iter);
 
@@ -199,6 +292,123 @@ public:
         return error;
     }
 
+    /**
+     * This method sends a property changed signal of several properties, encoded by their get handlers.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyNames    The names of the changed properties.
+     *
+     * @retval OTBR_ERROR_NONE        Signal successfully sent, or no property is given.
+     * @retval OTBR_ERROR_NOT_FOUND   A property has no get handler.
+     * @retval OTBR_ERROR_DBUS        Failed to encode or send the signal.
+     *
+     */
+    otbrError SignalPropertiesChanged(const std::string &             aInterfaceName,
+                                      const std::vector<std::string> &aPropertyNames);
+
+    /**
+     * This method sends a property changed signal of the properties changed since the last call of this method.
+     *
+     * The value of each property is compared with the value encoded at the last call, so that properties read from
+     * counters are signaled only when they changed. Properties which fail to be encoded are skipped, and properties
+     * no d-bus client subscribed to are not encoded at all.
+     *
+     * A property signaled less than OTBR_DBUS_SIGNAL_MIN_INTERVAL ago is checked again once the interval elapsed.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyNames    The names of the properties to be checked.
+     *
+     * @retval OTBR_ERROR_NONE        Signal successfully sent, or no property changed.
+     * @retval OTBR_ERROR_DBUS        Failed to encode or send the signal.
+     *
+     */
+    otbrError SignalModifiedPropertiesChanged(const std::string &             aInterfaceName,
+                                              const std::vector<std::string> &aPropertyNames);
+
+    /**
+     * This method handles a method call reading several properties of the interface of the call in one reply.
+     *
+     * The method takes an array of property names and replies an array of variants in the same order.
+     *
+     * @param[in]   aRequest    The method call request.
+     *
+     */
+    void GetPropertiesMethodHandler(DBusRequest &aRequest);
+
+    /**
+     * This method handles a method call subscribing the caller to signals of the interface of the call.
+     *
+     * The method takes an array of signal or property names, "*" subscribes to all of them. The signals requiring a
+     * subscription are only sent while a d-bus client is subscribed to them, the subscriptions of a client are
+     * dropped when it disconnects from the bus.
+     *
+     * @param[in]   aRequest    The method call request.
+     *
+     */
+    void SubscribeSignalsMethodHandler(DBusRequest &aRequest);
+
+    /**
+     * This method handles a method call unsubscribing the caller from signals of the interface of the call.
+     *
+     * The method takes an array of signal or property names, as given to the subscribe method.
+     *
+     * @param[in]   aRequest    The method call request.
+     *
+     */
+    void UnsubscribeSignalsMethodHandler(DBusRequest &aRequest);
+
+    /**
+     * This method indicates whether a d-bus client is subscribed to a signal or a property changed signal.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aName             The signal or property name.
+     *
+     * @returns Whether a d-bus client is subscribed.
+     *
+     */
+    bool IsSubscribed(const std::string &aInterfaceName, const std::string &aName) const;
+
+    /**
+     * This method makes a signal or a property changed signal only sent while a d-bus client is subscribed to it.
+     *
+     * The other signals are sent to all the d-bus clients matching them, like before subscriptions existed.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aName             The signal or property name.
+     *
+     */
+    void RequireSubscription(const std::string &aInterfaceName, const std::string &aName);
+
+    /**
+     * This method indicates whether a signal or a property changed signal is sent.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aName             The signal or property name.
+     *
+     * @returns Whether the signal needs no subscription or a d-bus client is subscribed to it.
+     *
+     */
+    bool IsSignaled(const std::string &aInterfaceName, const std::string &aName) const;
+
+    /**
+     * This method encodes the number and the handling latency of the method calls of this object to a variant.
+     *
+     * @param[out]  aIter   The message iterator pointing to the variant.
+     *
+     * @retval OT_ERROR_NONE          Successfully encoded the counters.
+     * @retval OT_ERROR_INVALID_ARGS  Failed to encode the counters.
+     *
+     */
+    otError GetMethodCallCountersHandler(DBusMessageIter &aIter);
+
+    /**
+     * This method sets the capture the method calls of this object are recorded to.
+     *
+     * @param[in]   aCapture    A pointer to the capture, nullptr to stop recording.
+     *
+     */
+    void SetCapture(DBusCapture *aCapture) { mCapture = aCapture; }
+
     /**
      * The destructor of a d-bus object.
      *
@@ -206,6 +416,59 @@ public:
     virtual ~DBusObject(void);
 
 private:
+    template <typename... FieldTypes>
+    static otbrError ExtractArguments(DBusMessage &aMessage, std::tuple<FieldTypes...> &aArgs)
+    {
+        return DBusMessageToTuple(aMessage, aArgs);
+    }
+
+    static otbrError ExtractArguments(DBusMessage &aMessage, std::tuple<> &aArgs)
+    {
+        OTBR_UNUSED_VARIABLE(aMessage);
+        OTBR_UNUSED_VARIABLE(aArgs);
+
+        return OTBR_ERROR_NONE;
+    }
+
+    template <typename ObjectType, typename... ArgTypes, typename... FieldTypes, size_t... Indexes>
+    static void CallMethodHandler(ObjectType *aObject,
+                                  void (ObjectType::*aHandler)(DBusRequest &, ArgTypes...),
+                                  DBusRequest &              aRequest,
+                                  std::tuple<FieldTypes...> &aArgs,
+                                  IndexSequence<Indexes...>)
+    {
+        OTBR_UNUSED_VARIABLE(aArgs);
+
+        (aObject->*aHandler)(aRequest, std::get<Indexes>(aArgs)...);
+    }
+
+    static constexpr size_t kNumLatencyBuckets = 10;
+    static const uint64_t   kLatencyBucketBounds[kNumLatencyBuckets];
+
+    struct MethodStats
+    {
+        uint64_t mCalls;
+        uint64_t mLatencySum;
+        uint64_t mLatencyMax;
+        uint64_t mLatencyBuckets[kNumLatencyBuckets];
+    };
+
+    void RecordMethodCall(const std::string &aMemberName, uint64_t aLatency);
+
+    otError UpdateSubscriptions(DBusRequest &aRequest, bool aSubscribe);
+    void    RemoveSubscriber(const std::string &aSubscriber);
+
+    static DBusHandlerResult sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
+    DBusHandlerResult        NameOwnerChangedFilter(DBusMessage *aMessage);
+
+    static void HandleDeferredSignalTimer(Timer &aTimer, void *aContext);
+    void        HandleDeferredSignalTimer(void);
+
+    otbrError EncodeProperty(const std::string &aInterfaceName, const std::string &aPropertyName, std::string &aValue);
+
+    const PropertyHandlerType *FindGetPropertyHandler(const std::string &aInterfaceName,
+                                                      const std::string &aPropertyName) const;
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
 
     void GetPropertyMethodHandler(DBusRequest &aRequest);
@@ -218,6 +481,15 @@ private:
     std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
     std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
     std::unordered_map<std::string, PropertyHandlerType>                                  mSetPropertyHandlers;
+    std::unordered_map<std::string, std::string>                                          mSignaledValues;
+    std::unordered_map<std::string, Timer::Clock::time_point>                             mSignaledTimes;
+    std::map<std::string, std::set<std::string>>                                          mDeferredProperties;
+    std::unordered_map<std::string, std::set<std::string>>                                mSubscribers;
+    std::set<std::string>                                                                 mSubscriptionRequired;
+    Timer                                                                                 mDeferredSignalTimer;
+    bool                                                                                  mFilterAdded;
+    std::map<std::string, MethodStats>                                                    mMethodStats;
+    DBusCapture *                                                                         mCapture;
     DBusConnection *                                                                      mConnection;
     std::string                                                                           mObjectPath;
 };
@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+
 #include <assert.h>
 #include <string.h>
 
@@ -39,16 +41,27 @@
 #include <openthread/thread_ftd.h>
 #include <openthread/platform/radio.h>
 
+#include "agent/radio_link_counters.hpp"
+#if OTBR_ENABLE_BACKBONE_ROUTER
+#include "backbone_router/nd_proxy_counters.hpp"
+#endif
 #include "common/byteswap.hpp"
+#include "common/health.hpp"
+#include "common/memory_stats.hpp"
+#include "common/metrics_registry.hpp"
 #include "common/region_code.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
+#if OTBR_ENABLE_REST_SERVER
+#include "rest/rest_web_server.hpp"
+#endif
 
 #if OTBR_ENABLE_LEGACY
 #include <ot-legacy-pairing-ext.h>
 #endif
 
+using otbr::Ncp::NodeState;
 using std::placeholders::_1;
 using std::placeholders::_2;
 
@@ -89,14 +102,319 @@ static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue)
     return val;
 }
 
+static otbr::SteeringData::Eui64 ConvertToEui64(uint64_t aValue)
+{
+    otbr::SteeringData::Eui64 eui64;
+
+    for (size_t i = eui64.size(); i > 0; i--)
+    {
+        eui64[i - 1] = static_cast<uint8_t>(aValue);
+        aValue >>= 8;
+    }
+    return eui64;
+}
+
+static otIp6Prefix ConvertToOtIp6Prefix(const otbr::DBus::Ip6Prefix &aPrefix)
+{
+    otIp6Prefix prefix;
+
+    // size is guaranteed by parsing
+    std::copy(aPrefix.mPrefix.begin(), aPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
+    prefix.mLength = aPrefix.mLength;
+
+    return prefix;
+}
+
+static otBorderRouterConfig ConvertToOtBorderRouterConfig(const otbr::DBus::OnMeshPrefix &aOnMeshPrefix)
+{
+    otBorderRouterConfig config;
+
+    config.mPrefix       = ConvertToOtIp6Prefix(aOnMeshPrefix.mPrefix);
+    config.mPreference   = aOnMeshPrefix.mPreference;
+    config.mSlaac        = aOnMeshPrefix.mSlaac;
+    config.mDhcp         = aOnMeshPrefix.mDhcp;
+    config.mConfigure    = aOnMeshPrefix.mConfigure;
+    config.mDefaultRoute = aOnMeshPrefix.mDefaultRoute;
+    config.mOnMesh       = aOnMeshPrefix.mOnMesh;
+    config.mStable       = aOnMeshPrefix.mStable;
+
+    return config;
+}
+
+static otExternalRouteConfig ConvertToOtExternalRouteConfig(const otbr::DBus::ExternalRoute &aRoute)
+{
+    otExternalRouteConfig route;
+
+    route.mPrefix     = ConvertToOtIp6Prefix(aRoute.mPrefix);
+    route.mPreference = aRoute.mPreference;
+    route.mStable     = aRoute.mStable;
+
+    return route;
+}
+
+// Reads the on-mesh prefixes and external routes of the local network data, i.e. those of this border router.
+static void GetLocalNetworkData(otInstance *                        aInstance,
+                                std::vector<otBorderRouterConfig> & aPrefixes,
+                                std::vector<otExternalRouteConfig> &aRoutes)
+{
+    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    otBorderRouterConfig  prefix;
+    otExternalRouteConfig route;
+
+    aPrefixes.clear();
+    while (otBorderRouterGetNextOnMeshPrefix(aInstance, &iterator, &prefix) == OT_ERROR_NONE)
+    {
+        aPrefixes.push_back(prefix);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    aRoutes.clear();
+    while (otBorderRouterGetNextRoute(aInstance, &iterator, &route) == OT_ERROR_NONE)
+    {
+        aRoutes.push_back(route);
+    }
+}
+
+// Replaces the on-mesh prefixes and external routes of the local network data, without registering them.
+static void SetLocalNetworkData(otInstance *                              aInstance,
+                                const std::vector<otBorderRouterConfig> & aPrefixes,
+                                const std::vector<otExternalRouteConfig> &aRoutes)
+{
+    std::vector<otBorderRouterConfig>  currentPrefixes;
+    std::vector<otExternalRouteConfig> currentRoutes;
+
+    GetLocalNetworkData(aInstance, currentPrefixes, currentRoutes);
+
+    for (const otBorderRouterConfig &prefix : currentPrefixes)
+    {
+        otBorderRouterRemoveOnMeshPrefix(aInstance, &prefix.mPrefix);
+    }
+
+    for (const otExternalRouteConfig &route : currentRoutes)
+    {
+        otBorderRouterRemoveRoute(aInstance, &route.mPrefix);
+    }
+
+    for (const otBorderRouterConfig &prefix : aPrefixes)
+    {
+        otBorderRouterAddOnMeshPrefix(aInstance, &prefix);
+    }
+
+    for (const otExternalRouteConfig &route : aRoutes)
+    {
+        otBorderRouterAddRoute(aInstance, &route);
+    }
+}
+
+static otbr::DBus::MacCounters ConvertMacCounters(const otMacCounters &aCounters)
+{
+    otbr::DBus::MacCounters counters;
+
+    counters.mTxTotal              = aCounters.mTxTotal;
+    counters.mTxUnicast            = aCounters.mTxUnicast;
+    counters.mTxBroadcast          = aCounters.mTxBroadcast;
+    counters.mTxAckRequested       = aCounters.mTxAckRequested;
+    counters.mTxAcked              = aCounters.mTxAcked;
+    counters.mTxNoAckRequested     = aCounters.mTxNoAckRequested;
+    counters.mTxData               = aCounters.mTxData;
+    counters.mTxDataPoll           = aCounters.mTxDataPoll;
+    counters.mTxBeacon             = aCounters.mTxBeacon;
+    counters.mTxBeaconRequest      = aCounters.mTxBeaconRequest;
+    counters.mTxOther              = aCounters.mTxOther;
+    counters.mTxRetry              = aCounters.mTxRetry;
+    counters.mTxErrCca             = aCounters.mTxErrCca;
+    counters.mTxErrAbort           = aCounters.mTxErrAbort;
+    counters.mTxErrBusyChannel     = aCounters.mTxErrBusyChannel;
+    counters.mRxTotal              = aCounters.mRxTotal;
+    counters.mRxUnicast            = aCounters.mRxUnicast;
+    counters.mRxBroadcast          = aCounters.mRxBroadcast;
+    counters.mRxData               = aCounters.mRxData;
+    counters.mRxDataPoll           = aCounters.mRxDataPoll;
+    counters.mRxBeacon             = aCounters.mRxBeacon;
+    counters.mRxBeaconRequest      = aCounters.mRxBeaconRequest;
+    counters.mRxOther              = aCounters.mRxOther;
+    counters.mRxAddressFiltered    = aCounters.mRxAddressFiltered;
+    counters.mRxDestAddrFiltered   = aCounters.mRxDestAddrFiltered;
+    counters.mRxDuplicated         = aCounters.mRxDuplicated;
+    counters.mRxErrNoFrame         = aCounters.mRxErrNoFrame;
+    counters.mRxErrUnknownNeighbor = aCounters.mRxErrUnknownNeighbor;
+    counters.mRxErrInvalidSrcAddr  = aCounters.mRxErrInvalidSrcAddr;
+    counters.mRxErrSec             = aCounters.mRxErrSec;
+    counters.mRxErrFcs             = aCounters.mRxErrFcs;
+    counters.mRxErrOther           = aCounters.mRxErrOther;
+
+    return counters;
+}
+
+static otbr::DBus::ActiveScanResult ConvertActiveScanResult(const otActiveScanResult &aScanResult)
+{
+    otbr::DBus::ActiveScanResult result;
+
+    result.mExtAddress    = ConvertOpenThreadUint64(aScanResult.mExtAddress.m8);
+    result.mExtendedPanId = ConvertOpenThreadUint64(aScanResult.mExtendedPanId.m8);
+    result.mNetworkName   = aScanResult.mNetworkName.m8;
+    result.mSteeringData  = std::vector<uint8_t>(aScanResult.mSteeringData.m8,
+                                                aScanResult.mSteeringData.m8 + aScanResult.mSteeringData.mLength);
+    result.mPanId         = aScanResult.mPanId;
+    result.mJoinerUdpPort = aScanResult.mJoinerUdpPort;
+    result.mChannel       = aScanResult.mChannel;
+    result.mRssi          = aScanResult.mRssi;
+    result.mLqi           = aScanResult.mLqi;
+    result.mVersion       = aScanResult.mVersion;
+    result.mIsNative      = aScanResult.mIsNative;
+    result.mIsJoinable    = aScanResult.mIsJoinable;
+
+    return result;
+}
+
+static otbr::DBus::ChildInfo ConvertChildInfo(const otChildInfo &aChildInfo)
+{
+    otbr::DBus::ChildInfo info;
+
+    info.mExtAddress         = ConvertOpenThreadUint64(aChildInfo.mExtAddress.m8);
+    info.mTimeout            = aChildInfo.mTimeout;
+    info.mAge                = aChildInfo.mAge;
+    info.mRloc16             = aChildInfo.mRloc16;
+    info.mChildId            = aChildInfo.mChildId;
+    info.mNetworkDataVersion = aChildInfo.mNetworkDataVersion;
+    info.mLinkQualityIn      = aChildInfo.mLinkQualityIn;
+    info.mAverageRssi        = aChildInfo.mAverageRssi;
+    info.mLastRssi           = aChildInfo.mLastRssi;
+    info.mFrameErrorRate     = aChildInfo.mFrameErrorRate;
+    info.mMessageErrorRate   = aChildInfo.mMessageErrorRate;
+    info.mRxOnWhenIdle       = aChildInfo.mRxOnWhenIdle;
+    info.mFullThreadDevice   = aChildInfo.mFullThreadDevice;
+    info.mFullNetworkData    = aChildInfo.mFullNetworkData;
+    info.mIsStateRestoring   = aChildInfo.mIsStateRestoring;
+
+    return info;
+}
+
+static otbr::DBus::NeighborInfo ConvertNeighborInfo(const otNeighborInfo &aNeighborInfo)
+{
+    otbr::DBus::NeighborInfo info;
+
+    info.mExtAddress       = ConvertOpenThreadUint64(aNeighborInfo.mExtAddress.m8);
+    info.mAge              = aNeighborInfo.mAge;
+    info.mRloc16           = aNeighborInfo.mRloc16;
+    info.mLinkFrameCounter = aNeighborInfo.mLinkFrameCounter;
+    info.mMleFrameCounter  = aNeighborInfo.mMleFrameCounter;
+    info.mLinkQualityIn    = aNeighborInfo.mLinkQualityIn;
+    info.mAverageRssi      = aNeighborInfo.mAverageRssi;
+    info.mLastRssi         = aNeighborInfo.mLastRssi;
+    info.mFrameErrorRate   = aNeighborInfo.mFrameErrorRate;
+    info.mMessageErrorRate = aNeighborInfo.mMessageErrorRate;
+    info.mRxOnWhenIdle     = aNeighborInfo.mRxOnWhenIdle;
+    info.mFullThreadDevice = aNeighborInfo.mFullThreadDevice;
+    info.mFullNetworkData  = aNeighborInfo.mFullNetworkData;
+    info.mIsChild          = aNeighborInfo.mIsChild;
+
+    return info;
+}
+
+template <typename EntryType, typename InfoType, typename ConvertType>
+static void GetTableChanges(const std::vector<EntryType> &  aTable,
+                            const otbr::Ncp::TableVersions &aVersions,
+                            uint32_t                        aSince,
+                            ConvertType                     aConvert,
+                            bool &                          aFull,
+                            std::vector<InfoType> &         aAdded,
+                            std::vector<InfoType> &         aUpdated,
+                            std::vector<uint64_t> &         aRemoved)
+{
+    otbr::Ncp::TableVersions::Changes changes;
+
+    aVersions.GetChanges(aSince, nullptr, changes);
+    aFull = changes.mFull;
+
+    for (size_t index : changes.mAdded)
+    {
+        aAdded.push_back(aConvert(aTable[index]));
+    }
+
+    for (size_t index : changes.mUpdated)
+    {
+        aUpdated.push_back(aConvert(aTable[index]));
+    }
+
+    for (size_t index : changes.mRemoved)
+    {
+        aRemoved.push_back(ConvertOpenThreadUint64(aVersions.mRemovals[index].mExtAddress.m8));
+    }
+}
+
+static otbr::DBus::IpCounters ConvertIpCounters(const otIpCounters &aCounters)
+{
+    otbr::DBus::IpCounters counters;
+
+    counters.mTxSuccess = aCounters.mTxSuccess;
+    counters.mTxFailure = aCounters.mTxFailure;
+    counters.mRxSuccess = aCounters.mRxSuccess;
+    counters.mRxFailure = aCounters.mRxFailure;
+
+    return counters;
+}
+
 namespace otbr {
 namespace DBus {
 
+namespace {
+
+// Secret properties such as the master key are never signaled, their values would be broadcast to every listener.
+struct PropertyChangedFlags
+{
+    const char *   mPropertyName;
+    otChangedFlags mFlags;
+};
+
+const PropertyChangedFlags kPropertyChangedFlags[] = {
+    {OTBR_DBUS_PROPERTY_LINK_MODE, OT_CHANGED_THREAD_LINK_MODE},
+    {OTBR_DBUS_PROPERTY_NETWORK_NAME, OT_CHANGED_THREAD_NETWORK_NAME},
+    {OTBR_DBUS_PROPERTY_PANID, OT_CHANGED_THREAD_PANID},
+    {OTBR_DBUS_PROPERTY_EXTPANID, OT_CHANGED_THREAD_EXT_PANID},
+    {OTBR_DBUS_PROPERTY_CHANNEL, OT_CHANGED_THREAD_CHANNEL},
+    {OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK, OT_CHANGED_SUPPORTED_CHANNEL_MASK},
+    {OTBR_DBUS_PROPERTY_RLOC16, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED},
+    {OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS, OT_CHANGED_THREAD_LL_ADDR},
+    {OTBR_DBUS_PROPERTY_ROUTER_ID, OT_CHANGED_THREAD_ROLE},
+    {OTBR_DBUS_PROPERTY_LEADER_DATA,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY, OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY, OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_NETWORK_DATA_VERSION, OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_VERSION, OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID},
+    {OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES, OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES, OT_CHANGED_THREAD_NETDATA},
+    {OTBR_DBUS_PROPERTY_CHILD_TABLE,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED},
+    {OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED},
+};
+
+// Properties changing without a state changed flag, checked every OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL. Encoding them
+// is not free, they are only signaled while a d-bus client is subscribed to them.
+const char *const kCounterProperties[] = {
+    OTBR_DBUS_PROPERTY_LINK_COUNTERS,
+    OTBR_DBUS_PROPERTY_IP6_COUNTERS,
+    OTBR_DBUS_PROPERTY_CCA_FAILURE_RATE,
+    OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
+    OTBR_DBUS_PROPERTY_CHILD_TABLE,
+    OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
+    OTBR_DBUS_PROPERTY_RADIO_LINK_COUNTERS,
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS,
+#endif
+};
+
+} // namespace
+
 DBusThreadObject::DBusThreadObject(DBusConnection *                 aConnection,
                                    const std::string &              aInterfaceName,
                                    otbr::Ncp::ControllerOpenThread *aNcp)
     : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mNcp(aNcp)
+    , mCountersTimer(HandleCountersTimer, this)
 {
 }
 
@@ -107,11 +425,16 @@ otbrError DBusThreadObject::Init(void)
 
     threadHelper->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
     mNcp->RegisterResetHandler(std::bind(&DBusThreadObject::NcpResetHandler, this));
+    mNcp->AddThreadStateChangedCallback(std::bind(&DBusThreadObject::ThreadStateChangedHandler, this, _1));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
                    std::bind(&DBusThreadObject::ScanHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_STREAM_METHOD,
+                   std::bind(&DBusThreadObject::ScanStreamHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
                    std::bind(&DBusThreadObject::AttachHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_DATASET_METHOD,
+                   std::bind(&DBusThreadObject::AttachDatasetHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_FACTORY_RESET_METHOD,
                    std::bind(&DBusThreadObject::FactoryResetHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RESET_METHOD,
@@ -121,15 +444,43 @@ otbrError DBusThreadObject::Init(void)
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_STOP_METHOD,
                    std::bind(&DBusThreadObject::JoinerStopHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD,
-                   std::bind(&DBusThreadObject::PermitUnsecureJoinHandler, this, _1));
+                   this, &DBusThreadObject::PermitUnsecureJoinHandler);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD,
-                   std::bind(&DBusThreadObject::AddOnMeshPrefixHandler, this, _1));
+                   this, &DBusThreadObject::AddOnMeshPrefixHandler);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_ON_MESH_PREFIX_METHOD,
-                   std::bind(&DBusThreadObject::RemoveOnMeshPrefixHandler, this, _1));
+                   this, &DBusThreadObject::RemoveOnMeshPrefixHandler);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD,
-                   std::bind(&DBusThreadObject::AddExternalRouteHandler, this, _1));
+                   this, &DBusThreadObject::AddExternalRouteHandler);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD,
-                   std::bind(&DBusThreadObject::RemoveExternalRouteHandler, this, _1));
+                   this, &DBusThreadObject::RemoveExternalRouteHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+                   this, &DBusThreadObject::UpdateNetworkDataHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD,
+                   std::bind(&DBusThreadObject::GetPropertiesMethodHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_START_COMMISSIONING_METHOD,
+                   std::bind(&DBusThreadObject::StartCommissioningHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_STOP_COMMISSIONING_METHOD,
+                   std::bind(&DBusThreadObject::StopCommissioningHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_COMMISSIONING_JOINERS_METHOD,
+                   this, &DBusThreadObject::AddCommissioningJoinersHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_COMMISSIONING_JOINER_METHOD,
+                   this, &DBusThreadObject::RemoveCommissioningJoinerHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD,
+                   std::bind(&DBusThreadObject::SubscribeSignalsMethodHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UNSUBSCRIBE_SIGNALS_METHOD,
+                   std::bind(&DBusThreadObject::UnsubscribeSignalsMethodHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_COUNTERS_HISTORY_METHOD,
+                   this, &DBusThreadObject::GetCountersHistoryHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_CHANNEL_OCCUPANCY_HISTORY_METHOD,
+                   this, &DBusThreadObject::GetChannelOccupancyHistoryHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_CHILD_TABLE_CHANGES_METHOD,
+                   this, &DBusThreadObject::GetChildTableChangesHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_NEIGHBOR_TABLE_CHANGES_METHOD,
+                   this, &DBusThreadObject::GetNeighborTableChangesHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_CHILD_TABLE_PAGE_METHOD,
+                   this, &DBusThreadObject::GetChildTablePageHandler);
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_NEIGHBOR_TABLE_PAGE_METHOD,
+                   this, &DBusThreadObject::GetNeighborTablePageHandler);
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObject::IntrospectHandler, this, _1));
@@ -178,6 +529,10 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetNetworkDataHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
                                std::bind(&DBusThreadObject::GetStableNetworkDataHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DATA_VERSION,
+                               std::bind(&DBusThreadObject::GetNetworkDataVersionHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_VERSION,
+                               std::bind(&DBusThreadObject::GetStableNetworkDataVersionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT,
                                std::bind(&DBusThreadObject::GetLocalLeaderWeightHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT,
@@ -188,6 +543,8 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetChildTableHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
                                std::bind(&DBusThreadObject::GetNeighborTableHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_LINK_QUALITY,
+                               std::bind(&DBusThreadObject::GetNeighborLinkQualityHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
                                std::bind(&DBusThreadObject::GetPartitionIDHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_INSTANT_RSSI,
@@ -196,8 +553,45 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetRadioTxPowerHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES,
                                std::bind(&DBusThreadObject::GetExternalRoutesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES,
+                               std::bind(&DBusThreadObject::GetOnMeshPrefixesHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_REGION,
                                std::bind(&DBusThreadObject::GetRegionHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX,
+                               std::bind(&DBusThreadObject::GetMeshLocalPrefixHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EUI64,
+                               std::bind(&DBusThreadObject::GetEui64Handler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
+                               std::bind(&DBusThreadObject::GetOtHostVersionHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_METHOD_CALL_COUNTERS,
+                               std::bind(&DBusThreadObject::GetMethodCallCountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_LINK_COUNTERS,
+                               std::bind(&DBusThreadObject::GetRadioLinkCountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MEMORY_USAGE,
+                               std::bind(&DBusThreadObject::GetMemoryUsageHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_METRICS,
+                               std::bind(&DBusThreadObject::GetMetricsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_HEALTH,
+                               std::bind(&DBusThreadObject::GetHealthHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_COMMISSIONING_STATE,
+                               std::bind(&DBusThreadObject::GetCommissioningStateHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_COMMISSIONING_JOINERS,
+                               std::bind(&DBusThreadObject::GetCommissioningJoinersHandler, this, _1));
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS,
+                               std::bind(&DBusThreadObject::GetNdProxyCountersHandler, this, _1));
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MESH_COUNTERS,
+                               std::bind(&DBusThreadObject::GetMeshCountersHandler, this, _1));
+#endif
+
+    for (const char *propertyName : kCounterProperties)
+    {
+        RequireSubscription(OTBR_DBUS_THREAD_INTERFACE, propertyName);
+    }
+
+    mCountersTimer.Start(std::chrono::milliseconds(OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL));
 
     return error;
 }
@@ -209,11 +603,48 @@ void DBusThreadObject::DeviceRoleHandler(otDeviceRole aDeviceRole)
 
 void DBusThreadObject::NcpResetHandler(void)
 {
-    mNcp->GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
+    // The device role handler is kept by the thread helper across resets.
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                           GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
 }
 
+void DBusThreadObject::ThreadStateChangedHandler(otChangedFlags aFlags)
+{
+    std::vector<std::string> propertyNames;
+
+    for (const PropertyChangedFlags &entry : kPropertyChangedFlags)
+    {
+        if (aFlags & entry.mFlags)
+        {
+            propertyNames.emplace_back(entry.mPropertyName);
+        }
+    }
+
+    if (SignalModifiedPropertiesChanged(OTBR_DBUS_THREAD_INTERFACE, propertyNames) != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to signal changed properties");
+    }
+}
+
+void DBusThreadObject::HandleCountersTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<DBusThreadObject *>(aContext)->HandleCountersTimer();
+}
+
+void DBusThreadObject::HandleCountersTimer(void)
+{
+    std::vector<std::string> propertyNames(std::begin(kCounterProperties), std::end(kCounterProperties));
+
+    if (SignalModifiedPropertiesChanged(OTBR_DBUS_THREAD_INTERFACE, propertyNames) != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to signal changed counters");
+    }
+
+    mCountersTimer.Start(std::chrono::milliseconds(OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL));
+}
+
 void DBusThreadObject::ScanHandler(DBusRequest &aRequest)
 {
     auto threadHelper = mNcp->GetThreadHelper();
@@ -234,29 +665,52 @@ void DBusThreadObject::ReplyScanResult(DBusRequest &                          aR
     {
         for (const auto &r : aResult)
         {
-            ActiveScanResult result;
-
-            result.mExtAddress    = ConvertOpenThreadUint64(r.mExtAddress.m8);
-            result.mExtendedPanId = ConvertOpenThreadUint64(r.mExtendedPanId.m8);
-            result.mNetworkName   = r.mNetworkName.m8;
-            result.mSteeringData =
-                std::vector<uint8_t>(r.mSteeringData.m8, r.mSteeringData.m8 + r.mSteeringData.mLength);
-            result.mPanId         = r.mPanId;
-            result.mJoinerUdpPort = r.mJoinerUdpPort;
-            result.mChannel       = r.mChannel;
-            result.mRssi          = r.mRssi;
-            result.mLqi           = r.mLqi;
-            result.mVersion       = r.mVersion;
-            result.mIsNative      = r.mIsNative;
-            result.mIsJoinable    = r.mIsJoinable;
-
-            results.emplace_back(result);
+            results.emplace_back(ConvertActiveScanResult(r));
         }
 
         aRequest.Reply(std::tie(results));
     }
 }
 
+void DBusThreadObject::ScanStreamHandler(DBusRequest &aRequest)
+{
+    auto        threadHelper = mNcp->GetThreadHelper();
+    const char *sender       = dbus_message_get_sender(aRequest.GetMessage());
+
+    // The results are signaled to the caller only, peer-to-peer connections have no sender to address them to.
+    if (sender == nullptr)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_NOT_CAPABLE);
+    }
+    else
+    {
+        std::string destination = sender;
+
+        threadHelper->Scan(
+            [aRequest](otError aError, const std::vector<otActiveScanResult> &aResult) mutable {
+                uint32_t count = static_cast<uint32_t>(aResult.size());
+
+                if (aError != OT_ERROR_NONE)
+                {
+                    aRequest.ReplyOtResult(aError);
+                }
+                else
+                {
+                    aRequest.Reply(std::tie(count));
+                }
+            },
+            [this, destination](const otActiveScanResult &aResult) {
+                ActiveScanResult result = ConvertActiveScanResult(aResult);
+
+                if (SignalTo(destination, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL, std::tie(result)) !=
+                    OTBR_ERROR_NONE)
+                {
+                    otbrLog(OTBR_LOG_WARNING, "Failed to signal a scan result to %s", destination.c_str());
+                }
+            });
+    }
+}
+
 void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
 {
     auto                 threadHelper = mNcp->GetThreadHelper();
@@ -280,6 +734,23 @@ void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
     }
 }
 
+void DBusThreadObject::AttachDatasetHandler(DBusRequest &aRequest)
+{
+    auto                 threadHelper = mNcp->GetThreadHelper();
+    std::vector<uint8_t> datasetTlvs;
+    auto                 args = std::tie(datasetTlvs);
+
+    if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        threadHelper->AttachDataset(datasetTlvs,
+                                    [aRequest](otError aError) mutable { aRequest.ReplyOtResult(aError); });
+    }
+}
+
 void DBusThreadObject::FactoryResetHandler(DBusRequest &aRequest)
 {
     aRequest.ReplyOtResult(OT_ERROR_NONE);
@@ -318,48 +789,25 @@ void DBusThreadObject::JoinerStopHandler(DBusRequest &aRequest)
     aRequest.ReplyOtResult(OT_ERROR_NONE);
 }
 
-void DBusThreadObject::PermitUnsecureJoinHandler(DBusRequest &aRequest)
+void DBusThreadObject::PermitUnsecureJoinHandler(DBusRequest &aRequest, uint16_t aPort, uint32_t aTimeout)
 {
 #ifdef OTBR_ENABLE_UNSECURE_JOIN
-    auto     threadHelper = mNcp->GetThreadHelper();
-    uint16_t port;
-    uint32_t timeout;
-    auto     args = std::tie(port, timeout);
+    auto threadHelper = mNcp->GetThreadHelper();
 
-    if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
-    {
-        aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
-    }
-    else
-    {
-        aRequest.ReplyOtResult(threadHelper->PermitUnsecureJoin(port, timeout));
-    }
+    aRequest.ReplyOtResult(threadHelper->PermitUnsecureJoin(aPort, aTimeout));
 #else
+    OTBR_UNUSED_VARIABLE(aPort);
+    OTBR_UNUSED_VARIABLE(aTimeout);
+
     aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
 #endif
 }
 
-void DBusThreadObject::AddOnMeshPrefixHandler(DBusRequest &aRequest)
+void DBusThreadObject::AddOnMeshPrefixHandler(DBusRequest &aRequest, const OnMeshPrefix &aOnMeshPrefix)
 {
     auto                 threadHelper = mNcp->GetThreadHelper();
-    OnMeshPrefix         onMeshPrefix;
-    auto                 args  = std::tie(onMeshPrefix);
-    otError              error = OT_ERROR_NONE;
-    otBorderRouterConfig config;
-
-    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.mPrefix.end(),
-              &config.mPrefix.mPrefix.mFields.m8[0]);
-    config.mPrefix.mLength = onMeshPrefix.mPrefix.mLength;
-    config.mPreference     = onMeshPrefix.mPreference;
-    config.mSlaac          = onMeshPrefix.mSlaac;
-    config.mDhcp           = onMeshPrefix.mDhcp;
-    config.mConfigure      = onMeshPrefix.mConfigure;
-    config.mDefaultRoute   = onMeshPrefix.mDefaultRoute;
-    config.mOnMesh         = onMeshPrefix.mOnMesh;
-    config.mStable         = onMeshPrefix.mStable;
+    otError              error        = OT_ERROR_NONE;
+    otBorderRouterConfig config       = ConvertToOtBorderRouterConfig(aOnMeshPrefix);
 
     SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(threadHelper->GetInstance(), &config));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
@@ -368,18 +816,11 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
-void DBusThreadObject::RemoveOnMeshPrefixHandler(DBusRequest &aRequest)
+void DBusThreadObject::RemoveOnMeshPrefixHandler(DBusRequest &aRequest, const Ip6Prefix &aOnMeshPrefix)
 {
     auto        threadHelper = mNcp->GetThreadHelper();
-    Ip6Prefix   onMeshPrefix;
-    auto        args  = std::tie(onMeshPrefix);
-    otError     error = OT_ERROR_NONE;
-    otIp6Prefix prefix;
-
-    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = onMeshPrefix.mLength;
+    otError     error        = OT_ERROR_NONE;
+    otIp6Prefix prefix       = ConvertToOtIp6Prefix(aOnMeshPrefix);
 
     SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
@@ -388,25 +829,14 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
-void DBusThreadObject::AddExternalRouteHandler(DBusRequest &aRequest)
+void DBusThreadObject::AddExternalRouteHandler(DBusRequest &aRequest, const ExternalRoute &aRoute)
 {
     auto                  threadHelper = mNcp->GetThreadHelper();
-    ExternalRoute         route;
-    auto                  args  = std::tie(route);
-    otError               error = OT_ERROR_NONE;
-    otExternalRouteConfig otRoute;
-    otIp6Prefix &         prefix = otRoute.mPrefix;
-
-    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-    // size is guaranteed by parsing
-    std::copy(route.mPrefix.mPrefix.begin(), route.mPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength      = route.mPrefix.mLength;
-    otRoute.mPreference = route.mPreference;
-    otRoute.mStable     = route.mStable;
+    otError               error        = OT_ERROR_NONE;
+    otExternalRouteConfig otRoute      = ConvertToOtExternalRouteConfig(aRoute);
 
     SuccessOrExit(error = otBorderRouterAddRoute(threadHelper->GetInstance(), &otRoute));
-    if (route.mStable)
+    if (aRoute.mStable)
     {
         SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
     }
@@ -415,19 +845,11 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
-void DBusThreadObject::RemoveExternalRouteHandler(DBusRequest &aRequest)
+void DBusThreadObject::RemoveExternalRouteHandler(DBusRequest &aRequest, const Ip6Prefix &aRoutePrefix)
 {
     auto        threadHelper = mNcp->GetThreadHelper();
-    Ip6Prefix   routePrefix;
-    auto        args  = std::tie(routePrefix);
-    otError     error = OT_ERROR_NONE;
-    otIp6Prefix prefix;
-
-    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-    // size is guaranteed by parsing
-    std::copy(routePrefix.mPrefix.begin(), routePrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = routePrefix.mLength;
+    otError     error        = OT_ERROR_NONE;
+    otIp6Prefix prefix       = ConvertToOtIp6Prefix(aRoutePrefix);
 
     SuccessOrExit(error = otBorderRouterRemoveRoute(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
@@ -436,6 +858,225 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
+void DBusThreadObject::UpdateNetworkDataHandler(DBusRequest &                     aRequest,
+                                                const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                                const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                                const std::vector<ExternalRoute> &aAddedRoutes,
+                                                const std::vector<Ip6Prefix> &    aRemovedRoutes)
+{
+    otInstance *                       instance = mNcp->GetThreadHelper()->GetInstance();
+    otError                            error    = OT_ERROR_NONE;
+    std::vector<otBorderRouterConfig>  prefixes;
+    std::vector<otExternalRouteConfig> routes;
+
+    // Keep the local network data as it is, to restore it if any of the changes fails.
+    GetLocalNetworkData(instance, prefixes, routes);
+
+    for (const Ip6Prefix &removed : aRemovedPrefixes)
+    {
+        otIp6Prefix prefix = ConvertToOtIp6Prefix(removed);
+
+        SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(instance, &prefix));
+    }
+
+    for (const Ip6Prefix &removed : aRemovedRoutes)
+    {
+        otIp6Prefix prefix = ConvertToOtIp6Prefix(removed);
+
+        SuccessOrExit(error = otBorderRouterRemoveRoute(instance, &prefix));
+    }
+
+    for (const OnMeshPrefix &added : aAddedPrefixes)
+    {
+        otBorderRouterConfig config = ConvertToOtBorderRouterConfig(added);
+
+        SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(instance, &config));
+    }
+
+    for (const ExternalRoute &added : aAddedRoutes)
+    {
+        otExternalRouteConfig route = ConvertToOtExternalRouteConfig(added);
+
+        SuccessOrExit(error = otBorderRouterAddRoute(instance, &route));
+    }
+
+    // All the changes are registered to the leader at once.
+    SuccessOrExit(error = otBorderRouterRegister(instance));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        SetLocalNetworkData(instance, prefixes, routes);
+    }
+
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusThreadObject::StartCommissioningHandler(DBusRequest &aRequest)
+{
+    auto threadHelper = mNcp->GetThreadHelper();
+
+    aRequest.ReplyOtResult(threadHelper->GetCommissioningOrchestrator().Start());
+}
+
+void DBusThreadObject::StopCommissioningHandler(DBusRequest &aRequest)
+{
+    auto threadHelper = mNcp->GetThreadHelper();
+
+    aRequest.ReplyOtResult(threadHelper->GetCommissioningOrchestrator().Stop());
+}
+
+void DBusThreadObject::AddCommissioningJoinersHandler(DBusRequest &                            aRequest,
+                                                      const std::vector<CommissioningJoiner> &aJoiners)
+{
+    auto                                                         threadHelper = mNcp->GetThreadHelper();
+    std::vector<agent::CommissioningOrchestrator::JoinerRequest> requests;
+
+    for (const CommissioningJoiner &joiner : aJoiners)
+    {
+        requests.push_back({ConvertToEui64(joiner.mEui64), joiner.mPskd});
+    }
+
+    aRequest.ReplyOtResult(threadHelper->GetCommissioningOrchestrator().AddJoiners(requests));
+}
+
+void DBusThreadObject::RemoveCommissioningJoinerHandler(DBusRequest &aRequest, uint64_t aEui64)
+{
+    auto threadHelper = mNcp->GetThreadHelper();
+
+    aRequest.ReplyOtResult(threadHelper->GetCommissioningOrchestrator().RemoveJoiner(ConvertToEui64(aEui64)));
+}
+
+void DBusThreadObject::GetCountersHistoryHandler(DBusRequest &aRequest,
+                                                 uint32_t     aPeriod,
+                                                 uint64_t     aSince,
+                                                 uint64_t     aUntil)
+{
+    std::vector<Ncp::CountersHistory::Sample> samples;
+    std::vector<CountersSample>               reply;
+    uint8_t                                   resolution;
+
+    VerifyOrExit(mNcp->GetCountersHistory().FindResolution(aPeriod, resolution),
+                 aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    mNcp->GetCountersHistory().Query(resolution, aSince, (aUntil == 0 ? UINT64_MAX : aUntil), samples);
+    for (const Ncp::CountersHistory::Sample &sample : samples)
+    {
+        reply.push_back({sample.mTime, ConvertMacCounters(sample.mMacCounters), ConvertIpCounters(sample.mIpCounters)});
+    }
+
+    aRequest.Reply(std::tie(reply));
+
+exit:
+    return;
+}
+
+void DBusThreadObject::GetChannelOccupancyHistoryHandler(DBusRequest &aRequest,
+                                                         uint32_t     aPeriod,
+                                                         uint64_t     aSince,
+                                                         uint64_t     aUntil)
+{
+    std::vector<Ncp::ChannelHistory::Window> windows;
+    std::vector<ChannelOccupancyWindow>      reply;
+    uint8_t                                  resolution;
+
+    VerifyOrExit(mNcp->GetChannelHistory().FindResolution(aPeriod, resolution),
+                 aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    mNcp->GetChannelHistory().Query(resolution, aSince, (aUntil == 0 ? UINT64_MAX : aUntil), windows);
+    for (const Ncp::ChannelHistory::Window &window : windows)
+    {
+        ChannelOccupancyWindow occupancies;
+
+        occupancies.mTime = window.mTime;
+
+        for (uint8_t i = 0; i < Ncp::ChannelHistory::kNumChannels; i++)
+        {
+            const Ncp::ChannelHistory::Occupancy &occupancy = window.mChannels[i];
+
+            if (occupancy.mCount > 0)
+            {
+                occupancies.mChannels.push_back({static_cast<uint8_t>(Ncp::ChannelHistory::kMinChannel + i),
+                                                 occupancy.mMin, occupancy.GetAverage(), occupancy.mMax});
+            }
+        }
+
+        reply.push_back(std::move(occupancies));
+    }
+
+    aRequest.Reply(std::tie(reply));
+
+exit:
+    return;
+}
+
+void DBusThreadObject::GetChildTableChangesHandler(DBusRequest &aRequest, uint32_t aSince)
+{
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    bool                             full;
+    std::vector<ChildInfo>           added;
+    std::vector<ChildInfo>           updated;
+    std::vector<uint64_t>            removed;
+
+    GetTableChanges(state->mChildren, state->mChildVersions, aSince, &ConvertChildInfo, full, added, updated, removed);
+    aRequest.Reply(std::tie(state->mChildVersions.mVersion, full, added, updated, removed));
+}
+
+void DBusThreadObject::GetNeighborTableChangesHandler(DBusRequest &aRequest, uint32_t aSince)
+{
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    bool                             full;
+    std::vector<NeighborInfo>        added;
+    std::vector<NeighborInfo>        updated;
+    std::vector<uint64_t>            removed;
+
+    GetTableChanges(state->mNeighbors, state->mNeighborVersions, aSince, &ConvertNeighborInfo, full, added, updated,
+                    removed);
+    aRequest.Reply(std::tie(state->mNeighborVersions.mVersion, full, added, updated, removed));
+}
+
+void DBusThreadObject::GetChildTablePageHandler(DBusRequest &aRequest, uint64_t aCursor, uint16_t aLimit)
+{
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    std::vector<size_t>              page;
+    std::vector<ChildInfo>           children;
+    uint64_t                         next;
+
+    VerifyOrExit(aLimit > 0, aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    next = state->GetChildPage(aCursor, std::min<size_t>(aLimit, OTBR_DBUS_TABLE_PAGE_MAX_LIMIT), page);
+    for (size_t index : page)
+    {
+        children.push_back(ConvertChildInfo(state->mChildren[index]));
+    }
+
+    aRequest.Reply(std::tie(children, next));
+
+exit:
+    return;
+}
+
+void DBusThreadObject::GetNeighborTablePageHandler(DBusRequest &aRequest, uint64_t aCursor, uint16_t aLimit)
+{
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    std::vector<size_t>              page;
+    std::vector<NeighborInfo>        neighbors;
+    uint64_t                         next;
+
+    VerifyOrExit(aLimit > 0, aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    next = state->GetNeighborPage(aCursor, std::min<size_t>(aLimit, OTBR_DBUS_TABLE_PAGE_MAX_LIMIT), page);
+    for (size_t index : page)
+    {
+        neighbors.push_back(ConvertNeighborInfo(state->mNeighbors[index]));
+    }
+
+    aRequest.Reply(std::tie(neighbors, next));
+
+exit:
+    return;
+}
+
 void DBusThreadObject::IntrospectHandler(DBusRequest &aRequest)
 {
     std::string xmlString(
@@ -526,10 +1167,8 @@ exit:
 
 otError DBusThreadObject::GetDeviceRoleHandler(DBusMessageIter &aIter)
 {
-    auto         threadHelper = mNcp->GetThreadHelper();
-    otDeviceRole role         = otThreadGetDeviceRole(threadHelper->GetInstance());
-    std::string  roleName     = GetDeviceRoleName(role);
-    otError      error        = OT_ERROR_NONE;
+    std::string roleName = GetDeviceRoleName(mNcp->GetNodeState()->mRole);
+    otError     error    = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, roleName) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -539,9 +1178,8 @@ exit:
 
 otError DBusThreadObject::GetNetworkNameHandler(DBusMessageIter &aIter)
 {
-    auto        threadHelper = mNcp->GetThreadHelper();
-    std::string networkName  = otThreadGetNetworkName(threadHelper->GetInstance());
-    otError     error        = OT_ERROR_NONE;
+    std::string networkName = mNcp->GetNodeState()->mNetworkName;
+    otError     error       = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkName) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -563,12 +1201,8 @@ exit:
 
 otError DBusThreadObject::GetExtPanIdHandler(DBusMessageIter &aIter)
 {
-    auto                   threadHelper = mNcp->GetThreadHelper();
-    const otExtendedPanId *extPanId     = otThreadGetExtendedPanId(threadHelper->GetInstance());
-    uint64_t               extPanIdVal;
-    otError                error = OT_ERROR_NONE;
-
-    extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
+    uint64_t extPanIdVal = ConvertOpenThreadUint64(mNcp->GetNodeState()->mExtPanId.m8);
+    otError  error       = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, extPanIdVal) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -615,43 +1249,8 @@ exit:
 
 otError DBusThreadObject::GetLinkCountersHandler(DBusMessageIter &aIter)
 {
-    auto                 threadHelper = mNcp->GetThreadHelper();
-    const otMacCounters *otCounters   = otLinkGetCounters(threadHelper->GetInstance());
-    MacCounters          counters;
-    otError              error = OT_ERROR_NONE;
-
-    counters.mTxTotal              = otCounters->mTxTotal;
-    counters.mTxUnicast            = otCounters->mTxUnicast;
-    counters.mTxBroadcast          = otCounters->mTxBroadcast;
-    counters.mTxAckRequested       = otCounters->mTxAckRequested;
-    counters.mTxAcked              = otCounters->mTxAcked;
-    counters.mTxNoAckRequested     = otCounters->mTxNoAckRequested;
-    counters.mTxData               = otCounters->mTxData;
-    counters.mTxDataPoll           = otCounters->mTxDataPoll;
-    counters.mTxBeacon             = otCounters->mTxBeacon;
-    counters.mTxBeaconRequest      = otCounters->mTxBeaconRequest;
-    counters.mTxOther              = otCounters->mTxOther;
-    counters.mTxRetry              = otCounters->mTxRetry;
-    counters.mTxErrCca             = otCounters->mTxErrCca;
-    counters.mTxErrAbort           = otCounters->mTxErrAbort;
-    counters.mTxErrBusyChannel     = otCounters->mTxErrBusyChannel;
-    counters.mRxTotal              = otCounters->mRxTotal;
-    counters.mRxUnicast            = otCounters->mTxUnicast;
-    counters.mRxBroadcast          = otCounters->mRxBroadcast;
-    counters.mRxData               = otCounters->mRxData;
-    counters.mRxDataPoll           = otCounters->mTxDataPoll;
-    counters.mRxBeacon             = otCounters->mRxBeacon;
-    counters.mRxBeaconRequest      = otCounters->mRxBeaconRequest;
-    counters.mRxOther              = otCounters->mRxOther;
-    counters.mRxAddressFiltered    = otCounters->mRxAddressFiltered;
-    counters.mRxDestAddrFiltered   = otCounters->mRxDestAddrFiltered;
-    counters.mRxDuplicated         = otCounters->mRxDuplicated;
-    counters.mRxErrNoFrame         = otCounters->mRxErrNoFrame;
-    counters.mRxErrUnknownNeighbor = otCounters->mRxErrUnknownNeighbor;
-    counters.mRxErrInvalidSrcAddr  = otCounters->mRxErrInvalidSrcAddr;
-    counters.mRxErrSec             = otCounters->mRxErrSec;
-    counters.mRxErrFcs             = otCounters->mRxErrFcs;
-    counters.mRxErrOther           = otCounters->mRxErrOther;
+    MacCounters counters = ConvertMacCounters(mNcp->GetNodeState()->mMacCounters);
+    otError     error    = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -661,15 +1260,8 @@ exit:
 
 otError DBusThreadObject::GetIp6CountersHandler(DBusMessageIter &aIter)
 {
-    auto                threadHelper = mNcp->GetThreadHelper();
-    const otIpCounters *otCounters   = otThreadGetIp6Counters(threadHelper->GetInstance());
-    IpCounters          counters;
-    otError             error = OT_ERROR_NONE;
-
-    counters.mTxSuccess = otCounters->mTxSuccess;
-    counters.mTxFailure = otCounters->mTxFailure;
-    counters.mRxSuccess = otCounters->mRxSuccess;
-    counters.mRxFailure = otCounters->mRxFailure;
+    IpCounters counters = ConvertIpCounters(mNcp->GetNodeState()->mIpCounters);
+    otError    error    = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -681,7 +1273,7 @@ otError DBusThreadObject::GetSupportedChannelMaskHandler(DBusMessageIter &aIter)
 {
     auto     threadHelper = mNcp->GetThreadHelper();
     uint32_t channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance()) &
-                           GetSupportedChannelMaskForRegion(mNcp->GetRegionCode());
+                           mNcp->GetRegionInfo().mSupportedChannelMask;
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, channelMask) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
@@ -692,9 +1284,8 @@ exit:
 
 otError DBusThreadObject::GetRloc16Handler(DBusMessageIter &aIter)
 {
-    auto     threadHelper = mNcp->GetThreadHelper();
-    otError  error        = OT_ERROR_NONE;
-    uint16_t rloc16       = otThreadGetRloc16(threadHelper->GetInstance());
+    otError  error  = OT_ERROR_NONE;
+    uint16_t rloc16 = mNcp->GetNodeState()->mRloc16;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, rloc16) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -704,10 +1295,8 @@ exit:
 
 otError DBusThreadObject::GetExtendedAddressHandler(DBusMessageIter &aIter)
 {
-    auto                threadHelper    = mNcp->GetThreadHelper();
-    otError             error           = OT_ERROR_NONE;
-    const otExtAddress *addr            = otLinkGetExtendedAddress(threadHelper->GetInstance());
-    uint64_t            extendedAddress = ConvertOpenThreadUint64(addr->m8);
+    otError  error           = OT_ERROR_NONE;
+    uint64_t extendedAddress = ConvertOpenThreadUint64(mNcp->GetNodeState()->mExtAddress.m8);
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, extendedAddress) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -732,12 +1321,12 @@ exit:
 
 otError DBusThreadObject::GetLeaderDataHandler(DBusMessageIter &aIter)
 {
-    auto                threadHelper = mNcp->GetThreadHelper();
-    otError             error        = OT_ERROR_NONE;
-    struct otLeaderData data;
-    LeaderData          leaderData;
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    otError                          error = OT_ERROR_NONE;
+    const otLeaderData &             data  = state->mLeaderData;
+    LeaderData                       leaderData;
 
-    SuccessOrExit(error = otThreadGetLeaderData(threadHelper->GetInstance(), &data));
+    VerifyOrExit(state->mLeaderDataValid, error = OT_ERROR_DETACHED);
     leaderData.mPartitionId       = data.mPartitionId;
     leaderData.mWeighting         = data.mWeighting;
     leaderData.mDataVersion       = data.mDataVersion;
@@ -751,16 +1340,14 @@ exit:
 
 otError DBusThreadObject::GetNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mNcp->GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    otError                                 error       = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
 
-    SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/false, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    // The TLVs are read from the snapshot, which is updated on each network data version change.
+    VerifyOrExit(networkData != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(DBusMessageEncodePrimitiveToVariant(&aIter, networkData->mData.data(), networkData->mData.size()) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -768,16 +1355,41 @@ exit:
 
 otError DBusThreadObject::GetStableNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mNcp->GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    otError                                 error       = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
+
+    VerifyOrExit(networkData != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(DBusMessageEncodePrimitiveToVariant(&aIter, networkData->mStableData.data(),
+                                                     networkData->mStableData.size()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetNetworkDataVersionHandler(DBusMessageIter &aIter)
+{
+    otError                                 error       = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
+
+    VerifyOrExit(networkData != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(networkData->mVersionValid, error = OT_ERROR_DETACHED);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData->mVersion) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetStableNetworkDataVersionHandler(DBusMessageIter &aIter)
+{
+    otError                                 error       = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
 
-    SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/true, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(networkData != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(networkData->mVersionValid, error = OT_ERROR_DETACHED);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData->mStableVersion) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -843,35 +1455,22 @@ exit:
 
 otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
 {
-    auto                   threadHelper = mNcp->GetThreadHelper();
-    otError                error        = OT_ERROR_NONE;
-    uint16_t               childIndex   = 0;
-    otChildInfo            childInfo;
-    std::vector<ChildInfo> childTable;
+    std::shared_ptr<const NodeState> state      = mNcp->GetNodeState();
+    otError                          error      = OT_ERROR_NONE;
+    size_t                           childIndex = 0;
+    auto                             nextChild  = [&state, &childIndex](ChildInfo &aInfo) {
+        bool found = (childIndex < state->mChildren.size());
 
-    while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
-    {
-        ChildInfo info;
+        if (found)
+        {
+            aInfo = ConvertChildInfo(state->mChildren[childIndex++]);
+        }
 
-        info.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8);
-        info.mTimeout            = childInfo.mTimeout;
-        info.mAge                = childInfo.mAge;
-        info.mChildId            = childInfo.mChildId;
-        info.mNetworkDataVersion = childInfo.mNetworkDataVersion;
-        info.mLinkQualityIn      = childInfo.mLinkQualityIn;
-        info.mAverageRssi        = childInfo.mAverageRssi;
-        info.mLastRssi           = childInfo.mLastRssi;
-        info.mFrameErrorRate     = childInfo.mFrameErrorRate;
-        info.mMessageErrorRate   = childInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle       = childInfo.mRxOnWhenIdle;
-        info.mFullThreadDevice   = childInfo.mFullThreadDevice;
-        info.mFullNetworkData    = childInfo.mFullNetworkData;
-        info.mIsStateRestoring   = childInfo.mIsStateRestoring;
-        childTable.push_back(info);
-        childIndex++;
-    }
+        return found;
+    };
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, childTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<ChildInfo>(&aIter, nextChild) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -879,34 +1478,61 @@ exit:
 
 otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
 {
-    auto                      threadHelper = mNcp->GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
-    otNeighborInfoIterator    iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    otNeighborInfo            neighborInfo;
-    std::vector<NeighborInfo> neighborTable;
+    std::shared_ptr<const NodeState> state         = mNcp->GetNodeState();
+    otError                          error         = OT_ERROR_NONE;
+    size_t                           neighborIndex = 0;
+    auto                             nextNeighbor  = [&state, &neighborIndex](NeighborInfo &aInfo) {
+        bool found = (neighborIndex < state->mNeighbors.size());
 
-    while (otThreadGetNextNeighborInfo(threadHelper->GetInstance(), &iter, &neighborInfo) == OT_ERROR_NONE)
-    {
-        NeighborInfo info;
+        if (found)
+        {
+            aInfo = ConvertNeighborInfo(state->mNeighbors[neighborIndex++]);
+        }
 
-        info.mExtAddress       = ConvertOpenThreadUint64(neighborInfo.mExtAddress.m8);
-        info.mAge              = neighborInfo.mAge;
-        info.mRloc16           = neighborInfo.mRloc16;
-        info.mLinkFrameCounter = neighborInfo.mLinkFrameCounter;
-        info.mMleFrameCounter  = neighborInfo.mMleFrameCounter;
-        info.mLinkQualityIn    = neighborInfo.mLinkQualityIn;
-        info.mAverageRssi      = neighborInfo.mAverageRssi;
-        info.mLastRssi         = neighborInfo.mLastRssi;
-        info.mFrameErrorRate   = neighborInfo.mFrameErrorRate;
-        info.mMessageErrorRate = neighborInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle     = neighborInfo.mRxOnWhenIdle;
-        info.mFullThreadDevice = neighborInfo.mFullThreadDevice;
-        info.mFullNetworkData  = neighborInfo.mFullNetworkData;
-        info.mIsChild          = neighborInfo.mIsChild;
-        neighborTable.push_back(info);
+        return found;
+    };
+
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<NeighborInfo>(&aIter, nextNeighbor) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetNeighborLinkQualityHandler(DBusMessageIter &aIter)
+{
+    otError                                     error = OT_ERROR_NONE;
+    std::vector<Ncp::LinkQualityTracker::Stats> stats;
+    std::vector<NeighborLinkQuality>            linkQualities;
+
+    mNcp->GetLinkQualityTracker().Get(stats);
+
+    for (const Ncp::LinkQualityTracker::Stats &neighbor : stats)
+    {
+        NeighborLinkQuality linkQuality;
+
+        linkQuality.mExtAddress = ConvertOpenThreadUint64(neighbor.mExtAddress.m8);
+        linkQuality.mRloc16     = neighbor.mRloc16;
+        linkQuality.mIsChild    = neighbor.mIsChild;
+        linkQuality.mSamples    = neighbor.mSamples;
+        linkQuality.mRssiHistogram.assign(neighbor.mRssiHistogram,
+                                          neighbor.mRssiHistogram + Ncp::LinkQualityTracker::kNumRssiBuckets);
+        linkQuality.mLinkQualityHistogram.assign(neighbor.mLinkQualityHistogram,
+                                                 neighbor.mLinkQualityHistogram +
+                                                     Ncp::LinkQualityTracker::kNumLinkQualities);
+        linkQuality.mMinRssi               = neighbor.mMinRssi;
+        linkQuality.mAverageRssi           = neighbor.GetAverageRssi();
+        linkQuality.mMaxRssi               = neighbor.mMaxRssi;
+        linkQuality.mRecentRssi            = neighbor.GetRecentRssi();
+        linkQuality.mBaselineRssi          = neighbor.GetBaselineRssi();
+        linkQuality.mFrameErrorRate        = neighbor.mFrameErrorRate;
+        linkQuality.mAverageFrameErrorRate = neighbor.GetAverageFrameErrorRate();
+        linkQuality.mMessageErrorRate      = neighbor.mMessageErrorRate;
+        linkQuality.mDegraded              = neighbor.mDegraded;
+        linkQualities.push_back(std::move(linkQuality));
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, linkQualities) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -914,9 +1540,8 @@ exit:
 
 otError DBusThreadObject::GetPartitionIDHandler(DBusMessageIter &aIter)
 {
-    auto     threadHelper = mNcp->GetThreadHelper();
-    otError  error        = OT_ERROR_NONE;
-    uint32_t partitionId  = otThreadGetPartitionId(threadHelper->GetInstance());
+    otError  error       = OT_ERROR_NONE;
+    uint32_t partitionId = mNcp->GetNodeState()->mPartitionId;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, partitionId) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -952,24 +1577,27 @@ exit:
 
 otError DBusThreadObject::GetExternalRoutesHandler(DBusMessageIter &aIter)
 {
-    auto                       threadHelper = mNcp->GetThreadHelper();
-    otError                    error        = OT_ERROR_NONE;
-    otNetworkDataIterator      iter         = OT_NETWORK_DATA_ITERATOR_INIT;
-    otExternalRouteConfig      config;
-    std::vector<ExternalRoute> externalRouteTable;
+    otError                                 error       = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
+    std::vector<ExternalRoute>              externalRouteTable;
 
-    while (otNetDataGetNextRoute(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
+    // The routes are read from the snapshot, which is updated on each network data change.
+    VerifyOrExit(networkData != nullptr, error = OT_ERROR_INVALID_STATE);
+    for (const auto &entry : networkData->mExternalRoutes.GetEntries())
     {
-        ExternalRoute route;
-
-        route.mPrefix.mPrefix      = std::vector<uint8_t>(&config.mPrefix.mPrefix.mFields.m8[0],
-                                                     &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
-        route.mPrefix.mLength      = config.mPrefix.mLength;
-        route.mRloc16              = config.mRloc16;
-        route.mPreference          = config.mPreference;
-        route.mStable              = config.mStable;
-        route.mNextHopIsThisDevice = config.mNextHopIsThisDevice;
-        externalRouteTable.push_back(route);
+        for (const otExternalRouteConfig &config : entry.second)
+        {
+            ExternalRoute route;
+
+            route.mPrefix.mPrefix      = std::vector<uint8_t>(&config.mPrefix.mPrefix.mFields.m8[0],
+                                                         &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
+            route.mPrefix.mLength      = config.mPrefix.mLength;
+            route.mRloc16              = config.mRloc16;
+            route.mPreference          = config.mPreference;
+            route.mStable              = config.mStable;
+            route.mNextHopIsThisDevice = config.mNextHopIsThisDevice;
+            externalRouteTable.push_back(route);
+        }
     }
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, externalRouteTable) == OTBR_ERROR_NONE,
@@ -979,6 +1607,40 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetOnMeshPrefixesHandler(DBusMessageIter &aIter)
+{
+    otError                                 error       = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
+    std::vector<OnMeshPrefix>               onMeshPrefixes;
+
+    VerifyOrExit(networkData != nullptr, error = OT_ERROR_INVALID_STATE);
+    for (const auto &entry : networkData->mOnMeshPrefixes.GetEntries())
+    {
+        for (const otBorderRouterConfig &config : entry.second)
+        {
+            OnMeshPrefix prefix;
+
+            prefix.mPrefix.mPrefix = std::vector<uint8_t>(&config.mPrefix.mPrefix.mFields.m8[0],
+                                                          &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
+            prefix.mPrefix.mLength = config.mPrefix.mLength;
+            prefix.mPreference     = config.mPreference;
+            prefix.mPreferred      = config.mPreferred;
+            prefix.mSlaac          = config.mSlaac;
+            prefix.mDhcp           = config.mDhcp;
+            prefix.mConfigure      = config.mConfigure;
+            prefix.mDefaultRoute   = config.mDefaultRoute;
+            prefix.mOnMesh         = config.mOnMesh;
+            prefix.mStable         = config.mStable;
+            onMeshPrefixes.push_back(prefix);
+        }
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, onMeshPrefixes) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObject::GetRegionHandler(DBusMessageIter &aIter)
 {
     otError     error = OT_ERROR_NONE;
@@ -990,5 +1652,255 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetMeshLocalPrefixHandler(DBusMessageIter &aIter)
+{
+    auto                                      threadHelper = mNcp->GetThreadHelper();
+    const otMeshLocalPrefix *                 prefix       = otThreadGetMeshLocalPrefix(threadHelper->GetInstance());
+    std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> data;
+    otError                                   error        = OT_ERROR_NONE;
+
+    memcpy(&data.front(), prefix->m8, sizeof(prefix->m8));
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetEui64Handler(DBusMessageIter &aIter)
+{
+    auto         threadHelper = mNcp->GetThreadHelper();
+    otError      error        = OT_ERROR_NONE;
+    otExtAddress extAddr;
+    uint64_t     eui64;
+
+    otLinkGetFactoryAssignedIeeeEui64(threadHelper->GetInstance(), &extAddr);
+    eui64 = ConvertOpenThreadUint64(extAddr.m8);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, eui64) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetOtHostVersionHandler(DBusMessageIter &aIter)
+{
+    otError     error = OT_ERROR_NONE;
+    std::string version(otGetVersionString());
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, version) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetRadioLinkCountersHandler(DBusMessageIter &aIter)
+{
+    typedef Ncp::RadioLinkCounters NcpRadioLinkCounters;
+
+    NcpRadioLinkCounters &            ncpCounters = NcpRadioLinkCounters::Get();
+    RadioLinkCounters                 counters;
+    MetricsRegistry::Histogram::Value latency;
+    otError                           error = OT_ERROR_NONE;
+
+    ncpCounters.Update(mNcp->GetInstance());
+
+    counters.mTxFrames     = ncpCounters.mLink.mTxFrames;
+    counters.mRxFrames     = ncpCounters.mLink.mRxFrames;
+    counters.mTxRetries    = ncpCounters.mLink.mTxRetries;
+    counters.mTxErrors     = ncpCounters.mLink.mTxErrors;
+    counters.mRxErrors     = ncpCounters.mLink.mRxErrors;
+    counters.mTxBytes      = ncpCounters.mLink.mTxBytes;
+    counters.mRxBytes      = ncpCounters.mLink.mRxBytes;
+    counters.mDeviceErrors = ncpCounters.mLink.mDeviceErrors;
+    counters.mResets       = ncpCounters.mResets;
+    counters.mLatencyBucketBounds.assign(NcpRadioLinkCounters::kLatencyBucketBounds,
+                                         NcpRadioLinkCounters::kLatencyBucketBounds +
+                                             NcpRadioLinkCounters::kNumLatencyBuckets);
+    ncpCounters.mRxLatency.GetValue(latency);
+    counters.mLatencyBuckets.assign(latency.mBuckets, latency.mBuckets + NcpRadioLinkCounters::kNumLatencyBuckets);
+    counters.mLatencyCount = latency.mCount;
+    counters.mLatencySum   = latency.mSum;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetMemoryUsageHandler(DBusMessageIter &aIter)
+{
+    MemoryStats::Usage process;
+    MemoryUsage        usage;
+    otError            error = OT_ERROR_NONE;
+
+    MemoryStats::GetProcessUsage(process);
+    usage.mResident     = process.mCurrent;
+    usage.mResidentPeak = process.mPeak;
+
+    for (uint8_t index = 0; index < MemoryStats::kNumSubsystems; index++)
+    {
+        MemoryStats::Subsystem subsystem = static_cast<MemoryStats::Subsystem>(index);
+        MemoryStats::Usage     current   = MemoryStats::Get().GetUsage(subsystem);
+
+        usage.mSubsystems.push_back(SubsystemMemoryUsage{MemoryStats::GetName(subsystem), current.mCurrent,
+                                                         current.mPeak});
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, usage) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetMetricsHandler(DBusMessageIter &aIter)
+{
+    std::vector<std::pair<std::string, int64_t>> values;
+    std::vector<MetricValue>                     metrics;
+    otError                                      error = OT_ERROR_NONE;
+
+    MetricsRegistry::Get().GetValues(values);
+
+    metrics.reserve(values.size());
+    for (auto &value : values)
+    {
+        metrics.push_back(MetricValue{std::move(value.first), value.second});
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, metrics) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetHealthHandler(DBusMessageIter &aIter)
+{
+    Health::Status health;
+    HealthStatus   status;
+    otError        error = OT_ERROR_NONE;
+
+    Health::Get().GetStatus(health);
+    status.mLive             = health.mLive;
+    status.mReady            = health.mAllReady;
+    status.mHeartbeatAge     = health.mHeartbeatAge;
+    status.mRadioActivityAge = health.mRadioActivityAge;
+
+    for (uint8_t index = 0; index < Health::kNumSubsystems; index++)
+    {
+        if (health.mReported & (1U << index))
+        {
+            status.mSubsystems.push_back(SubsystemHealth{Health::GetName(static_cast<Health::Subsystem>(index)),
+                                                         (health.mReady & (1U << index)) != 0});
+        }
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, status) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetCommissioningStateHandler(DBusMessageIter &aIter)
+{
+    auto    threadHelper = mNcp->GetThreadHelper();
+    otError error        = OT_ERROR_NONE;
+    uint8_t state        = threadHelper->GetCommissioningOrchestrator().GetProgress()->mState;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, state) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetCommissioningJoinersHandler(DBusMessageIter &aIter)
+{
+    typedef agent::CommissioningOrchestrator Orchestrator;
+    typedef std::chrono::milliseconds        Milliseconds;
+
+    auto                                          threadHelper = mNcp->GetThreadHelper();
+    std::shared_ptr<const Orchestrator::Progress> progress = threadHelper->GetCommissioningOrchestrator().GetProgress();
+    Timer::Clock::time_point                      now      = Timer::Clock::now();
+    std::vector<CommissioningJoinerProgress>      joiners;
+    otError                                       error = OT_ERROR_NONE;
+
+    for (const Orchestrator::JoinerProgress &joiner : progress->mJoiners)
+    {
+        bool                        queued     = (joiner.mState == Orchestrator::kJoinerQueued);
+        bool                        done       = (joiner.mState >= Orchestrator::kJoinerJoined);
+        Timer::Clock::time_point    activeTime = (queued ? now : joiner.mActiveTime);
+        Timer::Clock::time_point    endTime    = (done ? joiner.mEndTime : now);
+        CommissioningJoinerProgress entry;
+
+        entry.mEui64     = ConvertOpenThreadUint64(joiner.mEui64.data());
+        entry.mState     = joiner.mState;
+        entry.mAttempts  = joiner.mAttempts;
+        entry.mQueueTime = std::chrono::duration_cast<Milliseconds>(activeTime - joiner.mQueuedTime).count();
+        entry.mJoinTime  = std::chrono::duration_cast<Milliseconds>(endTime - activeTime).count();
+        joiners.push_back(entry);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, joiners) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+otError DBusThreadObject::GetNdProxyCountersHandler(DBusMessageIter &aIter)
+{
+    typedef BackboneRouter::NdProxyCounters BbrNdProxyCounters;
+
+    const BbrNdProxyCounters &        bbrCounters = BbrNdProxyCounters::Get();
+    NdProxyCounters                   counters;
+    MetricsRegistry::Histogram::Value latency;
+    otError                           error = OT_ERROR_NONE;
+
+    counters.mMulticastNsReceived = bbrCounters.mMulticastNsReceived;
+    counters.mUnicastNsReceived   = bbrCounters.mUnicastNsReceived;
+    counters.mNsMatched           = bbrCounters.mNsMatched;
+    counters.mNaSent              = bbrCounters.mNaSent;
+    counters.mNaFailed            = bbrCounters.mNaFailed;
+    counters.mGroupJoins          = bbrCounters.mGroupJoins;
+    counters.mGroupLeaves         = bbrCounters.mGroupLeaves;
+    counters.mLatencyBucketBounds.assign(BbrNdProxyCounters::kLatencyBucketBounds,
+                                         BbrNdProxyCounters::kLatencyBucketBounds +
+                                             BbrNdProxyCounters::kNumLatencyBuckets);
+    bbrCounters.mNaLatency.GetValue(latency);
+    counters.mLatencyBuckets.assign(latency.mBuckets, latency.mBuckets + BbrNdProxyCounters::kNumLatencyBuckets);
+    counters.mLatencyCount = latency.mCount;
+    counters.mLatencySum   = latency.mSum;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+#endif
+
+#if OTBR_ENABLE_REST_SERVER
+otError DBusThreadObject::GetMeshCountersHandler(DBusMessageIter &aIter)
+{
+    // The REST server keeps refreshing the diagnostics of the nodes, their MAC counters are summed as they change.
+    rest::MeshCounters restCounters = rest::RestWebServer::GetRestWebServer(mNcp)->GetResource().GetMeshCounters();
+    MeshCounters       counters;
+    otError            error = OT_ERROR_NONE;
+
+    counters.mNumNodes           = restCounters.mNumNodes;
+    counters.mIfInUnknownProtos  = restCounters.mIfInUnknownProtos;
+    counters.mIfInErrors         = restCounters.mIfInErrors;
+    counters.mIfOutErrors        = restCounters.mIfOutErrors;
+    counters.mIfInUcastPkts      = restCounters.mIfInUcastPkts;
+    counters.mIfInBroadcastPkts  = restCounters.mIfInBroadcastPkts;
+    counters.mIfInDiscards       = restCounters.mIfInDiscards;
+    counters.mIfOutUcastPkts     = restCounters.mIfOutUcastPkts;
+    counters.mIfOutBroadcastPkts = restCounters.mIfOutBroadcastPkts;
+    counters.mIfOutDiscards      = restCounters.mIfOutDiscards;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+#endif
+
 } // namespace DBus
 } // namespace otbr
@@ -34,8 +34,25 @@
 #include <openthread/link.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "common/timer.hpp"
 #include "dbus/server/dbus_object.hpp"
 
+/**
+ * The interval in milliseconds between two checks of the counter properties, which are signaled only when changed.
+ *
+ */
+#ifndef OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL
+#define OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL 1000
+#endif
+
+/**
+ * The largest number of entries of a page of the child table or the neighbor table.
+ *
+ */
+#ifndef OTBR_DBUS_TABLE_PAGE_MAX_LIMIT
+#define OTBR_DBUS_TABLE_PAGE_MAX_LIMIT 100
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -67,19 +84,40 @@ public:
 private:
     void DeviceRoleHandler(otDeviceRole aDeviceRole);
     void NcpResetHandler(void);
+    void ThreadStateChangedHandler(otChangedFlags aFlags);
+
+    static void HandleCountersTimer(Timer &aTimer, void *aContext);
+    void        HandleCountersTimer(void);
 
     void ScanHandler(DBusRequest &aRequest);
+    void ScanStreamHandler(DBusRequest &aRequest);
     void AttachHandler(DBusRequest &aRequest);
+    void AttachDatasetHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
     void FactoryResetHandler(DBusRequest &aRequest);
     void ResetHandler(DBusRequest &aRequest);
     void JoinerStartHandler(DBusRequest &aRequest);
     void JoinerStopHandler(DBusRequest &aRequest);
-    void PermitUnsecureJoinHandler(DBusRequest &aRequest);
-    void AddOnMeshPrefixHandler(DBusRequest &aRequest);
-    void RemoveOnMeshPrefixHandler(DBusRequest &aRequest);
-    void AddExternalRouteHandler(DBusRequest &aRequest);
-    void RemoveExternalRouteHandler(DBusRequest &aRequest);
+    void PermitUnsecureJoinHandler(DBusRequest &aRequest, uint16_t aPort, uint32_t aTimeout);
+    void AddOnMeshPrefixHandler(DBusRequest &aRequest, const OnMeshPrefix &aOnMeshPrefix);
+    void RemoveOnMeshPrefixHandler(DBusRequest &aRequest, const Ip6Prefix &aOnMeshPrefix);
+    void AddExternalRouteHandler(DBusRequest &aRequest, const ExternalRoute &aRoute);
+    void RemoveExternalRouteHandler(DBusRequest &aRequest, const Ip6Prefix &aRoutePrefix);
+    void UpdateNetworkDataHandler(DBusRequest &                     aRequest,
+                                  const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                  const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                  const std::vector<ExternalRoute> &aAddedRoutes,
+                                  const std::vector<Ip6Prefix> &    aRemovedRoutes);
+    void StartCommissioningHandler(DBusRequest &aRequest);
+    void StopCommissioningHandler(DBusRequest &aRequest);
+    void AddCommissioningJoinersHandler(DBusRequest &aRequest, const std::vector<CommissioningJoiner> &aJoiners);
+    void RemoveCommissioningJoinerHandler(DBusRequest &aRequest, uint64_t aEui64);
+    void GetCountersHistoryHandler(DBusRequest &aRequest, uint32_t aPeriod, uint64_t aSince, uint64_t aUntil);
+    void GetChannelOccupancyHistoryHandler(DBusRequest &aRequest, uint32_t aPeriod, uint64_t aSince, uint64_t aUntil);
+    void GetChildTableChangesHandler(DBusRequest &aRequest, uint32_t aSince);
+    void GetNeighborTableChangesHandler(DBusRequest &aRequest, uint32_t aSince);
+    void GetChildTablePageHandler(DBusRequest &aRequest, uint64_t aCursor, uint16_t aLimit);
+    void GetNeighborTablePageHandler(DBusRequest &aRequest, uint64_t aCursor, uint16_t aLimit);
 
     void IntrospectHandler(DBusRequest &aRequest);
 
@@ -105,20 +143,40 @@ private:
     otError GetLeaderDataHandler(DBusMessageIter &aIter);
     otError GetNetworkDataHandler(DBusMessageIter &aIter);
     otError GetStableNetworkDataHandler(DBusMessageIter &aIter);
+    otError GetNetworkDataVersionHandler(DBusMessageIter &aIter);
+    otError GetStableNetworkDataVersionHandler(DBusMessageIter &aIter);
     otError GetLocalLeaderWeightHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorSampleCountHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter);
     otError GetChildTableHandler(DBusMessageIter &aIter);
     otError GetNeighborTableHandler(DBusMessageIter &aIter);
+    otError GetNeighborLinkQualityHandler(DBusMessageIter &aIter);
     otError GetPartitionIDHandler(DBusMessageIter &aIter);
     otError GetInstantRssiHandler(DBusMessageIter &aIter);
     otError GetRadioTxPowerHandler(DBusMessageIter &aIter);
     otError GetExternalRoutesHandler(DBusMessageIter &aIter);
+    otError GetOnMeshPrefixesHandler(DBusMessageIter &aIter);
     otError GetRegionHandler(DBusMessageIter &aIter);
+    otError GetMeshLocalPrefixHandler(DBusMessageIter &aIter);
+    otError GetEui64Handler(DBusMessageIter &aIter);
+    otError GetOtHostVersionHandler(DBusMessageIter &aIter);
+    otError GetRadioLinkCountersHandler(DBusMessageIter &aIter);
+    otError GetMemoryUsageHandler(DBusMessageIter &aIter);
+    otError GetMetricsHandler(DBusMessageIter &aIter);
+    otError GetHealthHandler(DBusMessageIter &aIter);
+    otError GetCommissioningStateHandler(DBusMessageIter &aIter);
+    otError GetCommissioningJoinersHandler(DBusMessageIter &aIter);
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    otError GetNdProxyCountersHandler(DBusMessageIter &aIter);
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    otError GetMeshCountersHandler(DBusMessageIter &aIter);
+#endif
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
 
     otbr::Ncp::ControllerOpenThread *mNcp;
+    Timer                            mCountersTimer;
 };
 
 } // namespace DBus
@@ -0,0 +1,278 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the table of the hosts and services advertised for SRP.
+ */
+
+#include "mdns/advertised_hosts.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+AdvertisedHosts::AdvertisedHosts(Publisher &aPublisher)
+    : mPublisher(aPublisher)
+{
+}
+
+bool AdvertisedHosts::StripDomain(const char *aFullName, const char *aDomain, std::string &aName)
+{
+    size_t fullLength   = strlen(aFullName);
+    size_t domainLength = strlen(aDomain);
+    bool   found        = false;
+
+    VerifyOrExit(fullLength > domainLength + 1 && aFullName[fullLength - domainLength - 1] == '.');
+    VerifyOrExit(strcmp(aFullName + fullLength - domainLength, aDomain) == 0);
+    found = true;
+    aName.assign(aFullName, fullLength - domainLength - 1);
+
+exit:
+    return found;
+}
+
+bool AdvertisedHosts::SplitServiceName(const std::string &aName, std::string &aInstanceName, std::string &aType)
+{
+    size_t protocol = aName.rfind('.');
+    size_t type     = (protocol != std::string::npos && protocol > 0 ? aName.rfind('.', protocol - 1) : protocol);
+    bool   found    = (type != std::string::npos && type > 0);
+
+    if (found)
+    {
+        aInstanceName = aName.substr(0, type);
+        aType         = aName.substr(type + 1);
+    }
+
+    return found;
+}
+
+Publisher::TxtList AdvertisedHosts::ParseTxtData(const std::vector<uint8_t> &aTxtData)
+{
+    Publisher::TxtList txtList;
+
+    for (size_t offset = 0; offset < aTxtData.size();)
+    {
+        size_t      length = aTxtData[offset++];
+        const char *entry;
+        const char *equal;
+
+        VerifyOrExit(length <= aTxtData.size() - offset);
+        entry = reinterpret_cast<const char *>(aTxtData.data() + offset);
+        equal = static_cast<const char *>(memchr(entry, '=', length));
+
+        // Boolean attributes and empty values are not supported by all the MDNS backends.
+        if (equal != nullptr && equal != entry && equal + 1 < entry + length)
+        {
+            txtList.emplace_back(std::string(entry, equal).c_str(), reinterpret_cast<const uint8_t *>(equal + 1),
+                                 static_cast<size_t>(entry + length - equal - 1));
+        }
+
+        offset += length;
+    }
+
+exit:
+    return txtList;
+}
+
+otbrError AdvertisedHosts::Update(const std::string &              aName,
+                                  std::vector<Ip6Address>          aAddresses,
+                                  const std::vector<Registration> &aRegistrations)
+{
+    Host &                   host  = mHosts[aName];
+    otbrError                error = OTBR_ERROR_NONE;
+    std::vector<std::string> seen;
+
+    if (aAddresses != host.mAddresses)
+    {
+        host.mAddresses = std::move(aAddresses);
+        host.mPublished = false;
+    }
+
+    for (const Registration &registration : aRegistrations)
+    {
+        std::string instanceName;
+        std::string type;
+        auto        it = host.mServices.find(registration.mName);
+
+        if (!SplitServiceName(registration.mName, instanceName, type))
+        {
+            otbrLog(OTBR_LOG_WARNING, "Ignore service %s of host %s", registration.mName.c_str(), aName.c_str());
+            error = OTBR_ERROR_PARSE;
+            continue;
+        }
+
+        seen.push_back(registration.mName);
+
+        if (it == host.mServices.end())
+        {
+            it = host.mServices
+                     .emplace(registration.mName, Service{instanceName, type, 0, {}, kInvalidServiceHandle, true})
+                     .first;
+        }
+
+        // The refreshes of the registrations are not announced again.
+        if (it->second.mPort != registration.mPort || it->second.mTxtData != registration.mTxtData)
+        {
+            it->second.mPort    = registration.mPort;
+            it->second.mTxtData = registration.mTxtData;
+            it->second.mPending = true;
+        }
+    }
+
+    // The services deleted or no longer registered are withdrawn.
+    for (auto it = host.mServices.begin(); it != host.mServices.end();)
+    {
+        if (std::find(seen.begin(), seen.end(), it->first) == seen.end())
+        {
+            if (it->second.mHandle != kInvalidServiceHandle)
+            {
+                mPublisher.UnpublishService(it->second.mHandle);
+            }
+
+            it = host.mServices.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    {
+        otbrError publishError = Publish(aName, host);
+
+        if (publishError != OTBR_ERROR_NONE)
+        {
+            error = publishError;
+        }
+    }
+
+    return error;
+}
+
+void AdvertisedHosts::Remove(const std::string &aName)
+{
+    auto it = mHosts.find(aName);
+
+    if (it != mHosts.end())
+    {
+        Unpublish(it->first, it->second);
+        mHosts.erase(it);
+    }
+}
+
+void AdvertisedHosts::Clear(void)
+{
+    for (auto &host : mHosts)
+    {
+        Unpublish(host.first, host.second);
+    }
+
+    mHosts.clear();
+}
+
+void AdvertisedHosts::PublishPending(void)
+{
+    for (auto &host : mHosts)
+    {
+        bool pending = !host.second.mPublished;
+
+        for (const auto &service : host.second.mServices)
+        {
+            pending = pending || service.second.mPending;
+        }
+
+        if (pending)
+        {
+            otbrLogResult(Publish(host.first, host.second), "Publish host %s", host.first.c_str());
+        }
+    }
+}
+
+otbrError AdvertisedHosts::Publish(const std::string &aName, Host &aHost)
+{
+    otbrError error;
+
+    mPublisher.BeginBatch();
+
+    if (!aHost.mPublished)
+    {
+        mPublisher.PublishHost(aName.c_str(), aHost.mAddresses);
+    }
+
+    for (auto &entry : aHost.mServices)
+    {
+        Service &service = entry.second;
+
+        if (service.mPending)
+        {
+            mPublisher.PublishService(aName.c_str(), service.mPort, service.mName.c_str(), service.mType.c_str(),
+                                      ParseTxtData(service.mTxtData), &service.mHandle);
+        }
+    }
+
+    error = mPublisher.EndBatch();
+
+    // The publication failed is not known, all of them are published again when the MDNS service becomes ready.
+    if (error == OTBR_ERROR_NONE)
+    {
+        aHost.mPublished = true;
+
+        for (auto &entry : aHost.mServices)
+        {
+            entry.second.mPending = false;
+        }
+    }
+
+    return error;
+}
+
+void AdvertisedHosts::Unpublish(const std::string &aName, Host &aHost)
+{
+    for (auto &entry : aHost.mServices)
+    {
+        if (entry.second.mHandle != kInvalidServiceHandle)
+        {
+            mPublisher.UnpublishService(entry.second.mHandle);
+        }
+    }
+
+    aHost.mServices.clear();
+    mPublisher.UnpublishHost(aName.c_str());
+}
+
+} // namespace Mdns
+
+} // namespace otbr
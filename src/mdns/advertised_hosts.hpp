@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the table of the hosts and services advertised for SRP.
+ */
+
+#ifndef OTBR_MDNS_ADVERTISED_HOSTS_HPP_
+#define OTBR_MDNS_ADVERTISED_HOSTS_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements the table of the hosts and services advertised with a MDNS publisher.
+ *
+ * Each update of a host is published in one batch of the publisher, and only the addresses and services changed
+ * since the previous update of the host are sent again.
+ *
+ */
+class AdvertisedHosts
+{
+public:
+    /**
+     * This structure represents a service registered by a host.
+     *
+     */
+    struct Registration
+    {
+        std::string          mName;    ///< The service name without the domain, e.g. "instance._type._udp".
+        uint16_t             mPort;    ///< The port of the service.
+        std::vector<uint8_t> mTxtData; ///< The encoded text record of the service.
+    };
+
+    /**
+     * The constructor to initialize the table.
+     *
+     * @param[in]   aPublisher      A reference to the MDNS publisher.
+     *
+     */
+    explicit AdvertisedHosts(Publisher &aPublisher);
+
+    /**
+     * This method updates a host and publishes its changes.
+     *
+     * The services of the host which are not in @p aRegistrations are withdrawn.
+     *
+     * @param[in]   aName           The host name without the domain.
+     * @param[in]   aAddresses      The addresses of the host.
+     * @param[in]   aRegistrations  The services of the host.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published the changes.
+     * @retval  OTBR_ERROR_PARSE    A service name is not valid, the other services are still published.
+     * @retval  ...                 The error of the publisher, the changes are kept to be published again.
+     *
+     */
+    otbrError Update(const std::string &              aName,
+                     std::vector<Ip6Address>          aAddresses,
+                     const std::vector<Registration> &aRegistrations);
+
+    /**
+     * This method withdraws a host and its services.
+     *
+     * @param[in]   aName           The host name without the domain.
+     *
+     */
+    void Remove(const std::string &aName);
+
+    /**
+     * This method withdraws all the hosts and services.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method publishes the hosts and services failed to be published.
+     *
+     */
+    void PublishPending(void);
+
+    /**
+     * This method strips the domain, with the dot before it, from a full name.
+     *
+     * @param[in]   aFullName       The full name, e.g. "host.default.service.arpa.".
+     * @param[in]   aDomain         The domain, e.g. "default.service.arpa.".
+     * @param[out]  aName           The name without the domain.
+     *
+     * @returns Whether the full name is in the domain.
+     *
+     */
+    static bool StripDomain(const char *aFullName, const char *aDomain, std::string &aName);
+
+    /**
+     * This method splits a service name into the instance name, which may contain dots, and the service type.
+     *
+     * @param[in]   aName           The service name, e.g. "instance._type._udp".
+     * @param[out]  aInstanceName   The instance name.
+     * @param[out]  aType           The service type.
+     *
+     * @returns Whether the service name is valid.
+     *
+     */
+    static bool SplitServiceName(const std::string &aName, std::string &aInstanceName, std::string &aType);
+
+    /**
+     * This method parses an encoded text record.
+     *
+     * The boolean attributes and the empty values are skipped, and the parsing stops at the first truncated entry.
+     *
+     * @param[in]   aTxtData        The encoded text record.
+     *
+     * @returns The text entries.
+     *
+     */
+    static Publisher::TxtList ParseTxtData(const std::vector<uint8_t> &aTxtData);
+
+private:
+    struct Service
+    {
+        std::string          mName;
+        std::string          mType;
+        uint16_t             mPort;
+        std::vector<uint8_t> mTxtData;
+        ServiceHandle        mHandle;  ///< The handle in the publisher, or invalid if never recorded.
+        bool                 mPending; ///< Whether the latest port and text record are to be published.
+    };
+
+    struct Host
+    {
+        std::vector<Ip6Address>                  mAddresses;
+        std::unordered_map<std::string, Service> mServices;  ///< The services by instance name and type.
+        bool                                     mPublished; ///< Whether the addresses are published.
+    };
+
+    otbrError Publish(const std::string &aName, Host &aHost);
+    void      Unpublish(const std::string &aName, Host &aHost);
+
+    Publisher &                           mPublisher;
+    std::unordered_map<std::string, Host> mHosts; ///< The hosts by name without the domain.
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_MDNS_ADVERTISED_HOSTS_HPP_
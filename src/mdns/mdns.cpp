@@ -0,0 +1,755 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the common parts of MDNS publishers.
+ */
+
+#include "mdns/mdns.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/memory_stats.hpp"
+#include "common/metrics_registry.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+// The time to wait for an instance to be resolved, as the mDNSResponder resolver never gives up by itself.
+static const std::chrono::seconds kResolveTimeout(5);
+
+static size_t GetTxtListSize(const Publisher::TxtList &aTxtList)
+{
+    size_t size = MemoryStats::VectorSize(aTxtList);
+
+    for (const Publisher::TxtEntry &entry : aTxtList)
+    {
+        size += entry.mName.capacity() + MemoryStats::VectorSize(entry.mValue);
+    }
+
+    return size;
+}
+
+// Counts a registration of a service, or of a host if `aType` is empty.
+static void CountPublish(const std::string &aType, otbrError aError)
+{
+    static MetricsRegistry::CounterFamily sPublishes("otbr_mdns_publish_total",
+                                                     "Registrations of services and hosts, by type and result.");
+
+    sPublishes
+        .Get(MetricsRegistry::FormatLabel("type", aType) + "," +
+             MetricsRegistry::FormatLabel("result", aError == OTBR_ERROR_NONE ? "ok" : "error"))
+        .Add(1);
+}
+
+static void CountResolve(const std::string &aType, const char *aResult)
+{
+    static MetricsRegistry::CounterFamily sResolves("otbr_mdns_resolve_total",
+                                                    "Resolutions of service instances, by service type and result.");
+
+    sResolves.Get(MetricsRegistry::FormatLabel("type", aType) + "," + MetricsRegistry::FormatLabel("result", aResult))
+        .Add(1);
+}
+
+Publisher::Publisher(void)
+    : mNextHandle(kInvalidServiceHandle + 1)
+    , mBatchDepth(0)
+    , mResolveTimer(HandleResolveTimer, this)
+{
+}
+
+otbrError Publisher::PublishService(uint16_t aPort, const char *aName, const char *aType, ...)
+{
+    TxtList txtList;
+    va_list args;
+
+    va_start(args, aType);
+
+    for (const char *name = va_arg(args, const char *); name; name = va_arg(args, const char *))
+    {
+        const uint8_t *value       = va_arg(args, const uint8_t *);
+        size_t         valueLength = va_arg(args, size_t);
+
+        txtList.emplace_back(name, value, valueLength);
+    }
+
+    va_end(args);
+
+    return PublishService(aPort, aName, aType, txtList);
+}
+
+std::string Publisher::ServiceKey(const char *aName, const char *aType)
+{
+    std::string key(aName);
+
+    // Neither a service name nor a type contains a null character.
+    key.push_back('\0');
+    key.append(aType);
+
+    return key;
+}
+
+otbrError Publisher::PublishService(const char *   aHostName,
+                                    uint16_t       aPort,
+                                    const char *   aName,
+                                    const char *   aType,
+                                    const TxtList &aTxtList,
+                                    ServiceHandle *aHandle)
+{
+    std::string   key    = ServiceKey(aName, aType);
+    auto          it     = mServiceHandles.find(key);
+    ServiceHandle handle = (it != mServiceHandles.end() ? it->second : kInvalidServiceHandle);
+    otbrError     error;
+
+    if (handle == kInvalidServiceHandle)
+    {
+        handle = mNextHandle++;
+
+        if (mNextHandle == kInvalidServiceHandle)
+        {
+            ++mNextHandle;
+        }
+
+        mServices[handle].mName      = aName;
+        mServices[handle].mType      = aType;
+        mServices[handle].mPublished = false;
+        mServiceHandles[key]         = handle;
+    }
+
+    mServices[handle].mHostName = (aHostName != nullptr ? aHostName : "");
+    mServices[handle].mPort     = aPort;
+
+    error = Publish(handle, aTxtList);
+
+    if (aHandle != nullptr)
+    {
+        *aHandle = (mServices.count(handle) ? handle : kInvalidServiceHandle);
+    }
+
+    return error;
+}
+
+otbrError Publisher::UpdateService(ServiceHandle aHandle, const TxtList &aTxtList)
+{
+    otbrError error;
+
+    VerifyOrExit(mServices.count(aHandle), error = OTBR_ERROR_NOT_FOUND);
+    error = Publish(aHandle, aTxtList);
+
+exit:
+    return error;
+}
+
+otbrError Publisher::UnpublishService(ServiceHandle aHandle)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mServices.find(aHandle);
+
+    VerifyOrExit(it != mServices.end(), error = OTBR_ERROR_NOT_FOUND);
+
+    for (auto pending = mBatch.begin(); pending != mBatch.end(); ++pending)
+    {
+        if (pending->mHandle == aHandle)
+        {
+            mBatch.erase(pending);
+            break;
+        }
+    }
+
+    if (it->second.mPublished)
+    {
+        DoUnpublishService(aHandle);
+    }
+
+    mServiceHandles.erase(ServiceKey(it->second.mName.c_str(), it->second.mType.c_str()));
+    mServices.erase(it);
+    UpdateMemoryStats();
+
+exit:
+    return error;
+}
+
+otbrError Publisher::Publish(ServiceHandle aHandle, const TxtList &aTxtList)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    ServiceInfo &info  = mServices[aHandle];
+
+    if (mBatchDepth > 0)
+    {
+        for (PendingService &pending : mBatch)
+        {
+            if (pending.mHandle == aHandle)
+            {
+                pending.mTxtList = aTxtList;
+                ExitNow();
+            }
+        }
+
+        mBatch.push_back(PendingService{aHandle, aTxtList});
+        ExitNow();
+    }
+
+    // Kept even if publishing fails, so a replay publishes the latest entries.
+    info.mTxtList = aTxtList;
+    error = DoPublishService(aHandle, info.mHostName.empty() ? nullptr : info.mHostName.c_str(), info.mPort,
+                             info.mName.c_str(), info.mType.c_str(), aTxtList);
+    CountPublish(info.mType, error);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        info.mPublished = true;
+    }
+    else if (!info.mPublished)
+    {
+        // Release the handle of a service that never made it.
+        mServiceHandles.erase(ServiceKey(info.mName.c_str(), info.mType.c_str()));
+        mServices.erase(aHandle);
+    }
+
+exit:
+    UpdateMemoryStats();
+    return error;
+}
+
+otbrError Publisher::PublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mHosts.find(aName);
+
+    if (it != mHosts.end())
+    {
+        // An unchanged host is not announced again.
+        VerifyOrExit(!it->second.mPublished || it->second.mAddresses != aAddresses);
+        it->second.mAddresses = aAddresses;
+    }
+    else
+    {
+        it = mHosts.emplace(aName, HostInfo{aAddresses, false}).first;
+    }
+
+    if (mBatchDepth > 0)
+    {
+        if (std::find(mHostBatch.begin(), mHostBatch.end(), it->first) == mHostBatch.end())
+        {
+            mHostBatch.push_back(it->first);
+        }
+
+        ExitNow();
+    }
+
+    error = PublishHost(it->first);
+
+exit:
+    return error;
+}
+
+otbrError Publisher::PublishHost(const std::string &aName)
+{
+    auto      it    = mHosts.find(aName);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(it != mHosts.end());
+
+    error = DoPublishHost(aName.c_str(), it->second.mAddresses);
+    CountPublish("", error);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        it->second.mPublished = true;
+    }
+    else if (!it->second.mPublished)
+    {
+        mHosts.erase(it);
+    }
+
+exit:
+    UpdateMemoryStats();
+    return error;
+}
+
+otbrError Publisher::UnpublishHost(const char *aName)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mHosts.find(aName);
+
+    VerifyOrExit(it != mHosts.end(), error = OTBR_ERROR_NOT_FOUND);
+
+    mHostBatch.erase(std::remove(mHostBatch.begin(), mHostBatch.end(), it->first), mHostBatch.end());
+
+    if (it->second.mPublished)
+    {
+        DoUnpublishHost(aName);
+    }
+
+    mHosts.erase(it);
+    UpdateMemoryStats();
+
+exit:
+    return error;
+}
+
+otbrError Publisher::EndBatch(void)
+{
+    otbrError                   error = OTBR_ERROR_NONE;
+    std::vector<PendingService> batch;
+    std::vector<std::string>    hostBatch;
+
+    VerifyOrExit(mBatchDepth > 0 && --mBatchDepth == 0);
+
+    batch.swap(mBatch);
+    hostBatch.swap(mHostBatch);
+
+    // The hosts are published first, as their services refer to them.
+    for (const std::string &name : hostBatch)
+    {
+        otbrError publishError = PublishHost(name);
+
+        if (publishError != OTBR_ERROR_NONE)
+        {
+            error = publishError;
+        }
+    }
+
+    for (const PendingService &pending : batch)
+    {
+        otbrError publishError = Publish(pending.mHandle, pending.mTxtList);
+
+        if (publishError != OTBR_ERROR_NONE)
+        {
+            error = publishError;
+        }
+    }
+
+exit:
+    return error;
+}
+
+otbrError Publisher::ReplayServices(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    for (const auto &host : mHosts)
+    {
+        if (host.second.mPublished && DoPublishHost(host.first.c_str(), host.second.mAddresses) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to replay host %s", host.first.c_str());
+            error = OTBR_ERROR_MDNS;
+        }
+    }
+
+    for (const auto &service : mServices)
+    {
+        const ServiceInfo &info = service.second;
+        otbrError          publishError;
+
+        if (!info.mPublished)
+        {
+            continue;
+        }
+
+        publishError = DoPublishService(service.first, info.mHostName.empty() ? nullptr : info.mHostName.c_str(),
+                                        info.mPort, info.mName.c_str(), info.mType.c_str(), info.mTxtList);
+
+        if (publishError != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to replay service %s.%s", info.mName.c_str(), info.mType.c_str());
+            error = publishError;
+        }
+    }
+
+    return error;
+}
+
+otbrError Publisher::Browse(const char *aType, BrowseHandler aHandler, void *aContext)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    BrowseState &state = mBrowsers[aType];
+
+    if (state.mBrowsers.empty() && (error = DoBrowse(aType)) != OTBR_ERROR_NONE)
+    {
+        mBrowsers.erase(aType);
+        ExitNow();
+    }
+
+    state.mBrowsers.push_back(Browser{aHandler, aContext});
+
+exit:
+    return error;
+}
+
+void Publisher::StopBrowse(const char *aType, BrowseHandler aHandler, void *aContext)
+{
+    auto it = mBrowsers.find(aType);
+
+    VerifyOrExit(it != mBrowsers.end());
+
+    for (auto browser = it->second.mBrowsers.begin(); browser != it->second.mBrowsers.end(); ++browser)
+    {
+        if (browser->mHandler == aHandler && browser->mContext == aContext)
+        {
+            it->second.mBrowsers.erase(browser);
+            break;
+        }
+    }
+
+    if (it->second.mBrowsers.empty())
+    {
+        mBrowsers.erase(it);
+        DoStopBrowse(aType);
+    }
+
+exit:
+    return;
+}
+
+otbrError Publisher::Resolve(const char *aName, const char *aType, ResolveHandler aHandler, void *aContext)
+{
+    otbrError                error  = OTBR_ERROR_NONE;
+    std::string              key    = ServiceKey(aName, aType);
+    auto                     cached = mCache.find(key);
+    Timer::Clock::time_point now    = Timer::Clock::now();
+
+    if (cached != mCache.end())
+    {
+        if (now < cached->second.mExpireTime)
+        {
+            DiscoveredInstanceInfo instance = cached->second.mInstance;
+
+            instance.mTtl = static_cast<uint32_t>(
+                std::chrono::duration_cast<std::chrono::seconds>(cached->second.mExpireTime - now).count());
+            CountResolve(aType, "cached");
+            aHandler(aContext, OTBR_ERROR_NONE, aType, instance);
+            ExitNow();
+        }
+
+        mCache.erase(cached);
+        UpdateMemoryStats();
+    }
+
+    if (mResolutions.count(key))
+    {
+        mResolutions[key].mResolvers.push_back(Resolver{aHandler, aContext});
+        ExitNow();
+    }
+
+    {
+        Resolution &resolution = mResolutions[key];
+
+        resolution.mName     = aName;
+        resolution.mType     = aType;
+        resolution.mDeadline = now + kResolveTimeout;
+        resolution.mResolvers.push_back(Resolver{aHandler, aContext});
+    }
+
+    error = DoResolve(aName, aType);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        mResolutions.erase(key);
+        ExitNow();
+    }
+
+    if (!mResolveTimer.IsRunning())
+    {
+        mResolveTimer.Start(kResolveTimeout);
+    }
+
+exit:
+    return error;
+}
+
+void Publisher::StartDiscovery(void)
+{
+    for (auto &browse : mBrowsers)
+    {
+        otbrError error = DoBrowse(browse.first.c_str());
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to browse %s: %s", browse.first.c_str(), otbrErrorString(error));
+        }
+    }
+}
+
+void Publisher::StopDiscovery(void)
+{
+    std::vector<std::string> keys;
+
+    mCache.clear();
+    mResolveTimer.Stop();
+    UpdateMemoryStats();
+
+    for (auto &browse : mBrowsers)
+    {
+        browse.second.mInstances.clear();
+    }
+
+    for (const auto &resolution : mResolutions)
+    {
+        keys.push_back(resolution.first);
+    }
+
+    for (const std::string &key : keys)
+    {
+        FinishResolution(key, OTBR_ERROR_MDNS, DiscoveredInstanceInfo());
+    }
+}
+
+void Publisher::HandleServiceFound(const char *aType, const char *aName)
+{
+    auto it = mBrowsers.find(aType);
+
+    VerifyOrExit(it != mBrowsers.end());
+    VerifyOrExit(it->second.mInstances[aName]++ == 0);
+
+    {
+        // Copy the browsers and names, as a handler may stop browsing.
+        std::vector<Browser> browsers = it->second.mBrowsers;
+        std::string          type     = aType;
+        std::string          name     = aName;
+
+        for (const Browser &browser : browsers)
+        {
+            browser.mHandler(browser.mContext, type.c_str(), name.c_str(), true);
+        }
+    }
+
+exit:
+    return;
+}
+
+void Publisher::HandleServiceRemoved(const char *aType, const char *aName)
+{
+    auto it = mBrowsers.find(aType);
+
+    VerifyOrExit(it != mBrowsers.end());
+
+    {
+        auto instance = it->second.mInstances.find(aName);
+
+        VerifyOrExit(instance != it->second.mInstances.end());
+        VerifyOrExit(--instance->second == 0);
+        it->second.mInstances.erase(instance);
+    }
+
+    mCache.erase(ServiceKey(aName, aType));
+    UpdateMemoryStats();
+
+    {
+        std::vector<Browser> browsers = it->second.mBrowsers;
+        std::string          type     = aType;
+        std::string          name     = aName;
+
+        for (const Browser &browser : browsers)
+        {
+            browser.mHandler(browser.mContext, type.c_str(), name.c_str(), false);
+        }
+    }
+
+exit:
+    return;
+}
+
+void Publisher::HandleServiceResolved(const char *aType, const DiscoveredInstanceInfo &aInstance)
+{
+    // Copy the result, as it may be owned by the resolver to be stopped.
+    DiscoveredInstanceInfo instance = aInstance;
+    std::string            type     = aType;
+    std::string            key      = ServiceKey(instance.mName.c_str(), aType);
+
+    if (instance.mTtl > 0)
+    {
+        CacheEntry &entry = mCache[key];
+
+        entry.mInstance   = instance;
+        entry.mExpireTime = Timer::Clock::now() + std::chrono::seconds(instance.mTtl);
+        TrimCache(OTBR_MDNS_CACHE_MAX_BYTES);
+        UpdateMemoryStats();
+    }
+
+    DoStopResolve(instance.mName.c_str(), type.c_str());
+    FinishResolution(key, OTBR_ERROR_NONE, instance);
+}
+
+size_t Publisher::GetCacheSize(void) const
+{
+    size_t size = MemoryStats::HashTableSize(mCache);
+
+    for (const auto &cached : mCache)
+    {
+        const DiscoveredInstanceInfo &instance = cached.second.mInstance;
+
+        size += cached.first.capacity() + instance.mName.capacity() + instance.mHostName.capacity() +
+                MemoryStats::VectorSize(instance.mAddresses) + GetTxtListSize(instance.mTxtList);
+    }
+
+    return size;
+}
+
+void Publisher::TrimCache(size_t aMaxBytes)
+{
+    while (!mCache.empty() && GetCacheSize() > aMaxBytes)
+    {
+        auto oldest = std::min_element(mCache.begin(), mCache.end(),
+                                       [](const std::pair<const std::string, CacheEntry> &aFirst,
+                                          const std::pair<const std::string, CacheEntry> &aSecond) {
+                                           return aFirst.second.mExpireTime < aSecond.second.mExpireTime;
+                                       });
+
+        otbrLog(OTBR_LOG_INFO, "Evicted cached instance %s", oldest->first.c_str());
+        mCache.erase(oldest);
+    }
+}
+
+void Publisher::UpdateMemoryStats(void) const
+{
+    size_t size = MemoryStats::HashTableSize(mServices) + MemoryStats::HashTableSize(mServiceHandles) +
+                  MemoryStats::VectorSize(mBatch) + MemoryStats::HashTableSize(mHosts) + GetCacheSize();
+
+    for (const auto &service : mServices)
+    {
+        size += service.second.mHostName.capacity() + service.second.mName.capacity() +
+                service.second.mType.capacity() + GetTxtListSize(service.second.mTxtList);
+    }
+
+    for (const auto &host : mHosts)
+    {
+        size += host.first.capacity() + MemoryStats::VectorSize(host.second.mAddresses);
+    }
+
+    for (const auto &handle : mServiceHandles)
+    {
+        size += handle.first.capacity();
+    }
+
+    MemoryStats::Get().Update(MemoryStats::kSubsystemMdnsServices, size);
+}
+
+void Publisher::HandleServiceResolveFailed(const char *aType, const char *aName)
+{
+    std::string name = aName;
+    std::string type = aType;
+
+    DoStopResolve(name.c_str(), type.c_str());
+    FinishResolution(ServiceKey(name.c_str(), type.c_str()), OTBR_ERROR_MDNS, DiscoveredInstanceInfo());
+}
+
+void Publisher::HandleResolveTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<Publisher *>(aContext)->HandleResolveTimer();
+}
+
+void Publisher::HandleResolveTimer(void)
+{
+    Timer::Clock::time_point now = Timer::Clock::now();
+    std::vector<std::string> expired;
+
+    for (const auto &resolution : mResolutions)
+    {
+        if (resolution.second.mDeadline <= now)
+        {
+            expired.push_back(resolution.first);
+        }
+    }
+
+    for (const std::string &key : expired)
+    {
+        auto it = mResolutions.find(key);
+
+        // A handler of an earlier resolution may have changed the resolutions.
+        if (it == mResolutions.end() || it->second.mDeadline > now)
+        {
+            continue;
+        }
+
+        otbrLog(OTBR_LOG_INFO, "MDNS resolving %s timed out", it->second.mName.c_str());
+        DoStopResolve(it->second.mName.c_str(), it->second.mType.c_str());
+        FinishResolution(key, OTBR_ERROR_NOT_FOUND, DiscoveredInstanceInfo());
+    }
+
+    for (const auto &resolution : mResolutions)
+    {
+        if (!mResolveTimer.IsRunning() || resolution.second.mDeadline < mResolveTimer.GetFireTime())
+        {
+            mResolveTimer.StartAt(resolution.second.mDeadline);
+        }
+    }
+}
+
+void Publisher::FinishResolution(const std::string &aKey, otbrError aError, const DiscoveredInstanceInfo &aInstance)
+{
+    auto                  it = mResolutions.find(aKey);
+    std::string           type;
+    std::vector<Resolver> resolvers;
+
+    VerifyOrExit(it != mResolutions.end());
+
+    type = it->second.mType;
+    resolvers.swap(it->second.mResolvers);
+    mResolutions.erase(it);
+
+    CountResolve(type, aError == OTBR_ERROR_NONE ? "ok" : (aError == OTBR_ERROR_NOT_FOUND ? "timeout" : "error"));
+
+    for (const Resolver &resolver : resolvers)
+    {
+        resolver.mHandler(resolver.mContext, aError, type.c_str(), aInstance);
+    }
+
+exit:
+    return;
+}
+
+void Publisher::AppendTxtEntry(const uint8_t *aEntry, size_t aLength, TxtList &aTxtList)
+{
+    const uint8_t *separator   = static_cast<const uint8_t *>(memchr(aEntry, '=', aLength));
+    const uint8_t *value       = (separator != nullptr ? separator + 1 : aEntry + aLength);
+    size_t         valueLength = static_cast<size_t>(aEntry + aLength - value);
+    std::string    name(reinterpret_cast<const char *>(aEntry), separator != nullptr ? separator - aEntry : aLength);
+
+    // An entry without a key is to be ignored, see RFC 6763 section 6.4.
+    VerifyOrExit(!name.empty());
+
+    aTxtList.emplace_back(name.c_str(), value, valueLength);
+
+exit:
+    return;
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -34,10 +34,24 @@
 #ifndef OTBR_AGENT_MDNS_HPP_
 #define OTBR_AGENT_MDNS_HPP_
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <string.h>
 #include <sys/select.h>
 
+#include "common/timer.hpp"
 #include "common/types.hpp"
 
+/**
+ * The maximum memory of the resolved instances cached, in bytes. The instances closest to expiring are evicted first.
+ *
+ */
+#ifndef OTBR_MDNS_CACHE_MAX_BYTES
+#define OTBR_MDNS_CACHE_MAX_BYTES 65536
+#endif
+
 namespace otbr {
 
 namespace Mdns {
@@ -61,6 +75,14 @@ enum State
  */
 typedef void (*StateHandler)(void *aContext, State aState);
 
+/**
+ * This type represents the handle of a published service.
+ *
+ */
+typedef uint32_t ServiceHandle;
+
+static const ServiceHandle kInvalidServiceHandle = 0; ///< The handle never given to a service.
+
 /**
  * @addtogroup border-router-mdns
  *
@@ -101,20 +123,277 @@ public:
      */
     virtual bool IsStarted(void) const = 0;
 
+    /**
+     * This class represents a key/value entry of a text record.
+     *
+     */
+    class TxtEntry
+    {
+    public:
+        /**
+         * The constructor of an entry with a string value.
+         *
+         * @param[in]   aName       The key of the entry.
+         * @param[in]   aValue      A pointer to the null-terminated value.
+         *
+         */
+        TxtEntry(const char *aName, const char *aValue)
+            : TxtEntry(aName, reinterpret_cast<const uint8_t *>(aValue), strlen(aValue))
+        {
+        }
+
+        /**
+         * The constructor of an entry with a binary value.
+         *
+         * @param[in]   aName           The key of the entry.
+         * @param[in]   aValue          A pointer to the value.
+         * @param[in]   aValueLength    The length of the value.
+         *
+         */
+        TxtEntry(const char *aName, const uint8_t *aValue, size_t aValueLength)
+            : mName(aName)
+            , mValue(aValue, aValue + aValueLength)
+        {
+        }
+
+        /**
+         * The constructor of an entry with a fixed size binary value, such as an extended PAN ID.
+         *
+         * @param[in]   aName       The key of the entry.
+         * @param[in]   aValue      A reference to the value.
+         *
+         */
+        template <size_t kSize>
+        TxtEntry(const char *aName, const uint8_t (&aValue)[kSize])
+            : TxtEntry(aName, aValue, kSize)
+        {
+        }
+
+        std::string          mName;  ///< The key of the entry.
+        std::vector<uint8_t> mValue; ///< The value of the entry.
+    };
+
+    typedef std::vector<TxtEntry> TxtList;
+
     /**
      * This method publishes or updates a service.
      *
+     * @param[in]   aPort               The port number of this service.
      * @param[in]   aName               The name of this service.
      * @param[in]   aType               The type of this service.
-     * @param[in]   aPort               The port number of this service.
-     * @param[in]   ...                 Pointers to null-terminated string of key and value for text record.
-     *                                  The last argument must be nullptr.
+     * @param[in]   ...                 Pointers to null-terminated string of key, pointer to value and size_t length
+     *                                  of value for text record. The last argument must be nullptr.
      *
      * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
      * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
      *
      */
-    virtual otbrError PublishService(uint16_t aPort, const char *aName, const char *aType, ...) = 0;
+    otbrError PublishService(uint16_t aPort, const char *aName, const char *aType, ...);
+
+    /**
+     * This method publishes or updates a service.
+     *
+     * A service is identified by its name and type, and keeps its handle until unpublished, also across restarts of
+     * the MDNS service. Within a batch, the service is only recorded and published when the batch ends, and a later
+     * call for the same service replaces the text record of an earlier one.
+     *
+     * @param[in]   aPort               The port number of this service.
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aTxtList            The entries of the text record.
+     * @param[out]  aHandle             A pointer to receive the handle of this service, may be nullptr.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published, updated or recorded the service.
+     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
+     * @retval  OTBR_ERROR_MDNS     Failed to publish or update the service.
+     *
+     */
+    otbrError PublishService(uint16_t       aPort,
+                             const char *   aName,
+                             const char *   aType,
+                             const TxtList &aTxtList,
+                             ServiceHandle *aHandle = nullptr)
+    {
+        return PublishService(nullptr, aPort, aName, aType, aTxtList, aHandle);
+    }
+
+    /**
+     * This method publishes or updates a service of a host, which may be another host than this one.
+     *
+     * The host of a service may change between calls with the same name and type.
+     *
+     * @param[in]   aHostName           The name of the host without the domain, or nullptr for this host.
+     * @param[in]   aPort               The port number of this service.
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aTxtList            The entries of the text record.
+     * @param[out]  aHandle             A pointer to receive the handle of this service, may be nullptr.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published, updated or recorded the service.
+     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
+     * @retval  OTBR_ERROR_MDNS     Failed to publish or update the service.
+     *
+     */
+    otbrError PublishService(const char *   aHostName,
+                             uint16_t       aPort,
+                             const char *   aName,
+                             const char *   aType,
+                             const TxtList &aTxtList,
+                             ServiceHandle *aHandle = nullptr);
+
+    /**
+     * This method updates the text record of a published service.
+     *
+     * @param[in]   aHandle             The handle of the service.
+     * @param[in]   aTxtList            The entries of the text record.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully updated or recorded the service.
+     * @retval  OTBR_ERROR_NOT_FOUND    No service has the handle.
+     * @retval  OTBR_ERROR_ERRNO        Failed to update the service.
+     * @retval  OTBR_ERROR_MDNS         Failed to update the service.
+     *
+     */
+    otbrError UpdateService(ServiceHandle aHandle, const TxtList &aTxtList);
+
+    /**
+     * This method unpublishes a service and releases its handle.
+     *
+     * @param[in]   aHandle             The handle of the service.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully unpublished the service.
+     * @retval  OTBR_ERROR_NOT_FOUND    No service has the handle.
+     *
+     */
+    otbrError UnpublishService(ServiceHandle aHandle);
+
+    /**
+     * This method publishes or updates the addresses of another host, so that its services can be published.
+     *
+     * A host is identified by its name and kept until unpublished, also across restarts of the MDNS service. Nothing
+     * is sent if the addresses of a published host are unchanged. Within a batch, the host is only recorded and
+     * published when the batch ends, before the services of the batch.
+     *
+     * @param[in]   aName               The name of the host without the domain.
+     * @param[in]   aAddresses          The IPv6 addresses of the host.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published, updated or recorded the host.
+     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the host.
+     * @retval  OTBR_ERROR_MDNS     Failed to publish or update the host.
+     *
+     */
+    otbrError PublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses);
+
+    /**
+     * This method unpublishes a host. Its services are expected to be unpublished first.
+     *
+     * @param[in]   aName               The name of the host without the domain.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully unpublished the host.
+     * @retval  OTBR_ERROR_NOT_FOUND    No host has the name.
+     *
+     */
+    otbrError UnpublishHost(const char *aName);
+
+    /**
+     * This structure represents a resolved service instance.
+     *
+     */
+    struct DiscoveredInstanceInfo
+    {
+        std::string             mName;      ///< The instance name.
+        std::string             mHostName;  ///< The host name of the instance.
+        std::vector<Ip6Address> mAddresses; ///< The IPv6 addresses of the host.
+        uint16_t                mPort;      ///< The port of the instance.
+        TxtList                 mTxtList;   ///< The entries of the text record.
+        uint32_t                mTtl;       ///< The time in seconds the information stays valid.
+    };
+
+    /**
+     * This function pointer is called when an instance of a browsed service type appears or disappears.
+     *
+     * @param[in]   aContext        A pointer to application-specific context.
+     * @param[in]   aType           The service type.
+     * @param[in]   aName           The instance name.
+     * @param[in]   aAdded          Whether the instance appeared or disappeared.
+     *
+     */
+    typedef void (*BrowseHandler)(void *aContext, const char *aType, const char *aName, bool aAdded);
+
+    /**
+     * This function pointer is called when a service instance is resolved.
+     *
+     * @param[in]   aContext        A pointer to application-specific context.
+     * @param[in]   aError          OTBR_ERROR_NONE if resolved, OTBR_ERROR_NOT_FOUND if timed out, or
+     *                              OTBR_ERROR_MDNS if the MDNS service failed or stopped.
+     * @param[in]   aType           The service type.
+     * @param[in]   aInstance       The resolved instance, only valid when @p aError is OTBR_ERROR_NONE.
+     *
+     */
+    typedef void (*ResolveHandler)(void *                        aContext,
+                                   otbrError                     aError,
+                                   const char *                  aType,
+                                   const DiscoveredInstanceInfo &aInstance);
+
+    /**
+     * This method starts browsing instances of a service type.
+     *
+     * The browsing goes on across restarts of the MDNS service until stopped.
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aHandler        The function to be called when an instance appears or disappears.
+     * @param[in]   aContext        A pointer to application-specific context.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully started browsing.
+     * @retval  OTBR_ERROR_MDNS     Failed to start browsing.
+     *
+     */
+    otbrError Browse(const char *aType, BrowseHandler aHandler, void *aContext);
+
+    /**
+     * This method stops browsing a service type for a handler.
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aHandler        The function given to Browse().
+     * @param[in]   aContext        The context given to Browse().
+     *
+     */
+    void StopBrowse(const char *aType, BrowseHandler aHandler, void *aContext);
+
+    /**
+     * This method resolves a service instance.
+     *
+     * A result still within its TTL is answered from the cache, calling @p aHandler before this method returns.
+     * Otherwise one query is sent for all callers resolving the same instance.
+     *
+     * @param[in]   aName           The instance name.
+     * @param[in]   aType           The service type.
+     * @param[in]   aHandler        The function to be called with the result.
+     * @param[in]   aContext        A pointer to application-specific context.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully answered or started resolving.
+     * @retval  OTBR_ERROR_ERRNO    Failed to start resolving.
+     * @retval  OTBR_ERROR_MDNS     Failed to start resolving.
+     *
+     */
+    otbrError Resolve(const char *aName, const char *aType, ResolveHandler aHandler, void *aContext);
+
+    /**
+     * This method begins a batch of service publications.
+     *
+     * Batches may be nested, and the services are published when the outermost batch ends.
+     *
+     */
+    void BeginBatch(void) { ++mBatchDepth; }
+
+    /**
+     * This method ends a batch of service publications, publishing each service recorded in the batch once.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published all recorded services, or the batch is still nested.
+     * @retval  OTBR_ERROR_ERRNO    Failed to publish some service.
+     * @retval  OTBR_ERROR_MDNS     Failed to publish some service.
+     *
+     */
+    otbrError EndBatch(void);
 
     /**
      * This method performs the MDNS processing.
@@ -170,6 +449,266 @@ public:
      *
      */
     static void Destroy(Publisher *aPublisher);
+
+protected:
+    Publisher(void);
+
+    /**
+     * This method publishes or updates a service immediately.
+     *
+     * The port and the host of a service may change between calls with the same handle.
+     *
+     * @param[in]   aHandle             The handle of this service.
+     * @param[in]   aHostName           The name of the host without the domain, or nullptr for this host.
+     * @param[in]   aPort               The port number of this service.
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aTxtList            The entries of the text record.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
+     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
+     * @retval  OTBR_ERROR_MDNS     Failed to publish or update the service.
+     *
+     */
+    virtual otbrError DoPublishService(ServiceHandle  aHandle,
+                                       const char *   aHostName,
+                                       uint16_t       aPort,
+                                       const char *   aName,
+                                       const char *   aType,
+                                       const TxtList &aTxtList) = 0;
+
+    /**
+     * This method withdraws a service immediately. Nothing happens if the service is not published.
+     *
+     * @param[in]   aHandle             The handle of this service.
+     *
+     */
+    virtual void DoUnpublishService(ServiceHandle aHandle) = 0;
+
+    /**
+     * This method publishes or updates the addresses of a host immediately.
+     *
+     * @param[in]   aName               The name of the host without the domain.
+     * @param[in]   aAddresses          The IPv6 addresses of the host.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully published or updated the host.
+     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the host.
+     * @retval  OTBR_ERROR_MDNS     Failed to publish or update the host.
+     *
+     */
+    virtual otbrError DoPublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses) = 0;
+
+    /**
+     * This method withdraws a host immediately. Nothing happens if the host is not published.
+     *
+     * @param[in]   aName               The name of the host without the domain.
+     *
+     */
+    virtual void DoUnpublishHost(const char *aName) = 0;
+
+    /**
+     * This method starts browsing a service type in the MDNS service. If the MDNS service is not ready, browsing is
+     * expected to start when StartDiscovery() is called.
+     *
+     * @param[in]   aType           The service type.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully started or deferred browsing.
+     * @retval  OTBR_ERROR_MDNS     Failed to start browsing.
+     *
+     */
+    virtual otbrError DoBrowse(const char *aType) = 0;
+
+    /**
+     * This method stops browsing a service type in the MDNS service.
+     *
+     * @param[in]   aType           The service type.
+     *
+     */
+    virtual void DoStopBrowse(const char *aType) = 0;
+
+    /**
+     * This method starts resolving a service instance in the MDNS service.
+     *
+     * @param[in]   aName           The instance name.
+     * @param[in]   aType           The service type.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully started resolving.
+     * @retval  OTBR_ERROR_ERRNO    Failed to start resolving.
+     * @retval  OTBR_ERROR_MDNS     Failed to start resolving.
+     *
+     */
+    virtual otbrError DoResolve(const char *aName, const char *aType) = 0;
+
+    /**
+     * This method stops resolving a service instance in the MDNS service.
+     *
+     * @param[in]   aName           The instance name.
+     * @param[in]   aType           The service type.
+     *
+     */
+    virtual void DoStopResolve(const char *aName, const char *aType) = 0;
+
+    /**
+     * This method publishes all registered hosts and services again, when the MDNS service has lost them.
+     *
+     * Hosts and services never published yet are left to their pending publication.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully published all services.
+     * @retval ...              The error of the last service failed to publish.
+     *
+     */
+    otbrError ReplayServices(void);
+
+    /**
+     * This method starts browsing all browsed service types, when the MDNS service becomes ready.
+     *
+     */
+    void StartDiscovery(void);
+
+    /**
+     * This method fails all pending resolutions and clears the cache, when the MDNS service stops.
+     *
+     * The backend is expected to have dropped all its browsers and resolvers.
+     *
+     */
+    void StopDiscovery(void);
+
+    /**
+     * This method reports an instance appeared in browsing.
+     *
+     * The backend may report an instance once per interface and protocol, which is only told once to handlers.
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aName           The instance name.
+     *
+     */
+    void HandleServiceFound(const char *aType, const char *aName);
+
+    /**
+     * This method reports an instance disappeared in browsing, which also drops it from the cache.
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aName           The instance name.
+     *
+     */
+    void HandleServiceRemoved(const char *aType, const char *aName);
+
+    /**
+     * This method reports the result of resolving an instance. The resolver is stopped by DoStopResolve().
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aInstance       The resolved instance.
+     *
+     */
+    void HandleServiceResolved(const char *aType, const DiscoveredInstanceInfo &aInstance);
+
+    /**
+     * This method reports the failure of resolving an instance. The resolver is stopped by DoStopResolve().
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aName           The instance name.
+     *
+     */
+    void HandleServiceResolveFailed(const char *aType, const char *aName);
+
+    /**
+     * This method appends an entry of a text record in the "key=value" format.
+     *
+     * @param[in]   aEntry          A pointer to the entry.
+     * @param[in]   aLength         The length of the entry.
+     * @param[out]  aTxtList        The list to append to.
+     *
+     */
+    static void AppendTxtEntry(const uint8_t *aEntry, size_t aLength, TxtList &aTxtList);
+
+    /**
+     * This method returns the key identifying a service instance.
+     *
+     * @param[in]   aName           The instance name.
+     * @param[in]   aType           The service type.
+     *
+     * @returns The key of the instance.
+     *
+     */
+    static std::string ServiceKey(const char *aName, const char *aType);
+
+private:
+    struct ServiceInfo
+    {
+        std::string mHostName; ///< The name of the host, empty for this host.
+        std::string mName;
+        std::string mType;
+        uint16_t    mPort;
+        TxtList     mTxtList;   ///< The latest TXT entries, for replaying the service.
+        bool        mPublished; ///< Whether the service has been published once.
+    };
+
+    struct PendingService
+    {
+        ServiceHandle mHandle;
+        TxtList       mTxtList;
+    };
+
+    struct HostInfo
+    {
+        std::vector<Ip6Address> mAddresses;
+        bool                    mPublished; ///< Whether the host has been published once.
+    };
+
+    otbrError Publish(ServiceHandle aHandle, const TxtList &aTxtList);
+    otbrError PublishHost(const std::string &aName);
+
+    struct Browser
+    {
+        BrowseHandler mHandler;
+        void *        mContext;
+    };
+
+    struct BrowseState
+    {
+        std::vector<Browser>                         mBrowsers;
+        std::unordered_map<std::string, unsigned int> mInstances; ///< The number of times each instance is found.
+    };
+
+    struct Resolver
+    {
+        ResolveHandler mHandler;
+        void *         mContext;
+    };
+
+    struct Resolution
+    {
+        std::string              mName;
+        std::string              mType;
+        Timer::Clock::time_point mDeadline;
+        std::vector<Resolver>    mResolvers;
+    };
+
+    struct CacheEntry
+    {
+        DiscoveredInstanceInfo   mInstance;
+        Timer::Clock::time_point mExpireTime;
+    };
+
+    static void HandleResolveTimer(Timer &aTimer, void *aContext);
+    void        HandleResolveTimer(void);
+    void        FinishResolution(const std::string &aKey, otbrError aError, const DiscoveredInstanceInfo &aInstance);
+    size_t      GetCacheSize(void) const;
+    void        TrimCache(size_t aMaxBytes);
+    void        UpdateMemoryStats(void) const;
+
+    std::unordered_map<ServiceHandle, ServiceInfo> mServices;
+    std::unordered_map<std::string, ServiceHandle> mServiceHandles;
+    ServiceHandle                                  mNextHandle;
+    std::vector<PendingService>                    mBatch;
+    unsigned int                                   mBatchDepth;
+    std::unordered_map<std::string, HostInfo>      mHosts;
+    std::vector<std::string>                       mHostBatch; ///< The hosts recorded in the batch.
+
+    std::unordered_map<std::string, BrowseState> mBrowsers; ///< The browsers by service type.
+    std::unordered_map<std::string, Resolution>  mResolutions;
+    std::unordered_map<std::string, CacheEntry>  mCache;
+    Timer                                        mResolveTimer;
 };
 
 /**
@@ -33,6 +33,8 @@
 
 #include "mdns/mdns_avahi.hpp"
 
+#include <algorithm>
+
 #include <avahi-common/alternative.h>
 #include <avahi-common/error.h>
 #include <avahi-common/malloc.h>
@@ -44,28 +46,44 @@
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
 #include "common/logging.hpp"
-#include "common/time.hpp"
 #include "utils/strcpy_utils.hpp"
 
 AvahiTimeout::AvahiTimeout(const struct timeval *aTimeout,
                            AvahiTimeoutCallback  aCallback,
                            void *                aContext,
                            void *                aPoller)
-    : mCallback(aCallback)
+    : mTimer(HandleTimer, this)
+    , mCallback(aCallback)
     , mContext(aContext)
     , mPoller(aPoller)
 {
-    if (aTimeout)
+    Update(aTimeout);
+}
+
+void AvahiTimeout::Update(const struct timeval *aTimeout)
+{
+    if (aTimeout == nullptr)
     {
-        mTimeout = otbr::GetNow() + otbr::GetTimestamp(*aTimeout);
+        mTimer.Stop();
     }
     else
     {
-        mTimeout = 0;
+        // avahi_age() returns the microseconds elapsed since the given time, negative when it is in the future.
+        mTimer.Start(std::chrono::microseconds(-avahi_age(aTimeout)));
     }
 }
 
+void AvahiTimeout::HandleTimer(otbr::Timer &aTimer, void *aContext)
+{
+    AvahiTimeout *avahiTimeout = static_cast<AvahiTimeout *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    avahiTimeout->mCallback(avahiTimeout, avahiTimeout->mContext);
+}
+
 namespace otbr {
 
 namespace Mdns {
@@ -94,16 +112,29 @@ AvahiWatch *Poller::WatchNew(const struct AvahiPoll *aPoller,
 
 AvahiWatch *Poller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback aCallback, void *aContext)
 {
+    AvahiWatch *watch = nullptr;
+    Watches &   watches = mWatches[aFd];
+
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, this));
+    if (watches.empty() && EventPoller::Get().Register(aFd, 0, HandleEvent, this) != OTBR_ERROR_NONE)
+    {
+        mWatches.erase(aFd);
+        ExitNow();
+    }
 
-    return mWatches.back();
+    watch = new AvahiWatch(aFd, aEvent, aCallback, aContext, this);
+    watches.push_back(watch);
+    UpdateWatches(aFd);
+
+exit:
+    return watch;
 }
 
 void Poller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
 {
     aWatch->mEvents = aEvent;
+    static_cast<Poller *>(aWatch->mPoller)->UpdateWatches(aWatch->mFd);
 }
 
 AvahiWatchEvent Poller::WatchGetEvents(AvahiWatch *aWatch)
@@ -118,191 +149,104 @@ void Poller::WatchFree(AvahiWatch *aWatch)
 
 void Poller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
-    {
-        if (*it == &aWatch)
-        {
-            mWatches.erase(it);
-            delete &aWatch;
-            break;
-        }
-    }
-}
+    int      fd      = aWatch.mFd;
+    Watches &watches = mWatches[fd];
 
-AvahiTimeout *Poller::TimeoutNew(const AvahiPoll *     aPoller,
-                                 const struct timeval *aTimeout,
-                                 AvahiTimeoutCallback  aCallback,
-                                 void *                aContext)
-{
-    assert(aPoller && aCallback);
-    return static_cast<Poller *>(aPoller->userdata)->TimeoutNew(aTimeout, aCallback, aContext);
-}
+    watches.erase(std::remove(watches.begin(), watches.end(), &aWatch), watches.end());
+    delete &aWatch;
 
-AvahiTimeout *Poller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
-{
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, this));
-    return mTimers.back();
-}
-
-void Poller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
-{
-    if (aTimeout == nullptr)
+    if (watches.empty())
     {
-        aTimer->mTimeout = 0;
+        EventPoller::Get().Unregister(fd);
+        mWatches.erase(fd);
     }
     else
     {
-        aTimer->mTimeout = otbr::GetNow() + otbr::GetTimestamp(*aTimeout);
+        UpdateWatches(fd);
     }
 }
 
-void Poller::TimeoutFree(AvahiTimeout *aTimer)
-{
-    static_cast<Poller *>(aTimer->mPoller)->TimeoutFree(*aTimer);
-}
-
-void Poller::TimeoutFree(AvahiTimeout &aTimer)
+void Poller::UpdateWatches(int aFd)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
-    {
-        if (*it == &aTimer)
-        {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
-        }
-    }
-}
+    uint32_t events = 0;
 
-void Poller::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout)
-{
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    for (const AvahiWatch *watch : mWatches[aFd])
     {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
-
-        if (AVAHI_WATCH_IN & events)
-        {
-            FD_SET(fd, &aReadFdSet);
-        }
-
-        if (AVAHI_WATCH_OUT & events)
-        {
-            FD_SET(fd, &aWriteFdSet);
-        }
-
-        if (AVAHI_WATCH_ERR & events)
+        if (watch->mEvents & AVAHI_WATCH_IN)
         {
-            FD_SET(fd, &aErrorFdSet);
+            events |= EventPoller::kEventReadable;
         }
 
-        if (AVAHI_WATCH_HUP & events)
+        if (watch->mEvents & AVAHI_WATCH_OUT)
         {
-            // TODO what do with this event type?
+            events |= EventPoller::kEventWritable;
         }
 
-        if (aMaxFd < fd)
+        if (watch->mEvents & (AVAHI_WATCH_ERR | AVAHI_WATCH_HUP))
         {
-            aMaxFd = fd;
+            events |= EventPoller::kEventError;
         }
-
-        (*it)->mHappened = 0;
     }
 
-    unsigned long now = GetNow();
-
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
-    {
-        unsigned long timeout = (*it)->mTimeout;
-
-        if (timeout == 0)
-        {
-            continue;
-        }
-
-        if (static_cast<long>(timeout - now) <= 0)
-        {
-            aTimeout.tv_usec = 0;
-            aTimeout.tv_sec  = 0;
-            break;
-        }
-        else
-        {
-            time_t      sec;
-            suseconds_t usec;
-
-            timeout -= now;
-            sec  = static_cast<time_t>(timeout / 1000);
-            usec = static_cast<suseconds_t>((timeout % 1000) * 1000);
-
-            if (sec < aTimeout.tv_sec)
-            {
-                aTimeout.tv_sec = sec;
-            }
-            else if (sec == aTimeout.tv_sec)
-            {
-                if (usec < aTimeout.tv_usec)
-                {
-                    aTimeout.tv_usec = usec;
-                }
-            }
-        }
-    }
+    EventPoller::Get().Update(aFd, events);
 }
 
-void Poller::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+void Poller::HandleEvent(void *aContext, int aFd, uint32_t aEvents)
 {
-    unsigned long now = GetNow();
+    static_cast<Poller *>(aContext)->HandleEvent(aFd, aEvents);
+}
 
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
-    {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
+void Poller::HandleEvent(int aFd, uint32_t aEvents)
+{
+    int happened = 0;
 
-        (*it)->mHappened = 0;
+    happened |= (aEvents & EventPoller::kEventReadable) ? AVAHI_WATCH_IN : 0;
+    happened |= (aEvents & EventPoller::kEventWritable) ? AVAHI_WATCH_OUT : 0;
+    happened |= (aEvents & EventPoller::kEventError) ? (AVAHI_WATCH_ERR | AVAHI_WATCH_HUP) : 0;
 
-        if ((AVAHI_WATCH_IN & events) && FD_ISSET(fd, &aReadFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_IN;
-        }
+    for (size_t i = 0;; i++)
+    {
+        // A callback may free watches of this file descriptor, look them up again each time.
+        auto        it = mWatches.find(aFd);
+        AvahiWatch *watch;
 
-        if ((AVAHI_WATCH_OUT & events) && FD_ISSET(fd, &aWriteFdSet))
+        if (it == mWatches.end() || i >= it->second.size())
         {
-            (*it)->mHappened |= AVAHI_WATCH_OUT;
+            break;
         }
 
-        if ((AVAHI_WATCH_ERR & events) && FD_ISSET(fd, &aErrorFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_ERR;
-        }
+        watch            = it->second[i];
+        watch->mHappened = happened & watch->mEvents;
 
-        // TODO hup events
-        if ((*it)->mHappened)
+        if (watch->mHappened != 0)
         {
-            (*it)->mCallback(*it, (*it)->mFd, static_cast<AvahiWatchEvent>((*it)->mHappened), (*it)->mContext);
+            watch->mCallback(watch, aFd, static_cast<AvahiWatchEvent>(watch->mHappened), watch->mContext);
         }
     }
+}
 
-    std::vector<AvahiTimeout *> expired;
+AvahiTimeout *Poller::TimeoutNew(const AvahiPoll *     aPoller,
+                                 const struct timeval *aTimeout,
+                                 AvahiTimeoutCallback  aCallback,
+                                 void *                aContext)
+{
+    assert(aPoller && aCallback);
+    return static_cast<Poller *>(aPoller->userdata)->TimeoutNew(aTimeout, aCallback, aContext);
+}
 
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
-    {
-        if ((*it)->mTimeout == 0)
-        {
-            continue;
-        }
+AvahiTimeout *Poller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
+{
+    return new AvahiTimeout(aTimeout, aCallback, aContext, this);
+}
 
-        if (static_cast<long>((*it)->mTimeout - now) <= 0)
-        {
-            expired.push_back(*it);
-        }
-    }
+void Poller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
+{
+    aTimer->Update(aTimeout);
+}
 
-    for (std::vector<AvahiTimeout *>::iterator it = expired.begin(); it != expired.end(); ++it)
-    {
-        AvahiTimeout *avahiTimeout = *it;
-        avahiTimeout->mCallback(avahiTimeout, avahiTimeout->mContext);
-    }
+void Poller::TimeoutFree(AvahiTimeout *aTimer)
+{
+    delete aTimer;
 }
 
 PublisherAvahi::PublisherAvahi(int          aProtocol,
@@ -311,7 +255,6 @@ PublisherAvahi::PublisherAvahi(int          aProtocol,
                                StateHandler aHandler,
                                void *       aContext)
     : mClient(nullptr)
-    , mGroup(nullptr)
     , mProtocol(aProtocol == AF_INET6 ? AVAHI_PROTO_INET6
                                       : aProtocol == AF_INET ? AVAHI_PROTO_INET : AVAHI_PROTO_UNSPEC)
     , mHost(aHost)
@@ -319,6 +262,8 @@ PublisherAvahi::PublisherAvahi(int          aProtocol,
     , mState(kStateIdle)
     , mStateHandler(aHandler)
     , mContext(aContext)
+    , mRetryTimer(HandleRetryTimer, this)
+    , mRetryDelay(kMinRetryDelay)
 {
 }
 
@@ -349,26 +294,114 @@ bool PublisherAvahi::IsStarted(void) const
 
 void PublisherAvahi::Stop(void)
 {
+    mRetryTimer.Stop();
+    mRetryDelay = kMinRetryDelay;
+    DiscardServices();
+
+    if (mClient)
+    {
+        mState = kStateIdle;
+        DiscardDiscovery();
+        avahi_client_free(mClient);
+        mClient = nullptr;
+        mStateHandler(mContext, mState);
+    }
+}
+
+void PublisherAvahi::DiscardServices(void)
+{
+    for (Services::value_type &service : mServices)
+    {
+        int error = avahi_entry_group_free(service.second.mGroup);
+
+        if (error)
+        {
+            otbrLog(OTBR_LOG_ERR, "Failed to free entry group: %s!", avahi_strerror(error));
+        }
+    }
+
     mServices.clear();
 
-    if (mGroup)
+    for (auto &host : mHostGroups)
     {
-        int error = avahi_entry_group_reset(mGroup);
+        int error = avahi_entry_group_free(host.second);
 
         if (error)
         {
-            otbrLog(OTBR_LOG_ERR, "Failed to reset entry group: %s!", avahi_strerror(error));
+            otbrLog(OTBR_LOG_ERR, "Failed to free entry group: %s!", avahi_strerror(error));
         }
     }
 
-    if (mClient)
+    mHostGroups.clear();
+}
+
+std::string PublisherAvahi::GetHostFullName(const char *aHostName) const
+{
+    return std::string(aHostName) + "." + (mDomain != nullptr ? mDomain : "local");
+}
+
+void PublisherAvahi::ScheduleRetry(void)
+{
+    VerifyOrExit(!mRetryTimer.IsRunning());
+
+    otbrLog(OTBR_LOG_INFO, "Retry avahi in %u ms", mRetryDelay);
+    mRetryTimer.Start(std::chrono::milliseconds(mRetryDelay));
+    mRetryDelay = std::min<uint32_t>(mRetryDelay * 2, kMaxRetryDelay);
+
+exit:
+    return;
+}
+
+void PublisherAvahi::HandleRetryTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<PublisherAvahi *>(aContext)->HandleRetryTimer();
+}
+
+void PublisherAvahi::HandleRetryTimer(void)
+{
+    if (mState == kStateReady)
+    {
+        if (ReplayServices() != OTBR_ERROR_NONE)
+        {
+            ScheduleRetry();
+        }
+
+        ExitNow();
+    }
+
+    // The failed client is freed here rather than in its own callback.
+    if (mClient != nullptr)
     {
         avahi_client_free(mClient);
         mClient = nullptr;
-        mGroup  = nullptr;
-        mState  = kStateIdle;
-        mStateHandler(mContext, mState);
     }
+
+    if (Start() != OTBR_ERROR_NONE)
+    {
+        ScheduleRetry();
+    }
+
+exit:
+    return;
+}
+
+void PublisherAvahi::DiscardDiscovery(void)
+{
+    for (auto &browser : mServiceBrowsers)
+    {
+        avahi_service_browser_free(browser.second->mBrowser);
+    }
+
+    for (auto &resolver : mServiceResolvers)
+    {
+        avahi_service_resolver_free(resolver.second->mResolver);
+    }
+
+    mServiceBrowsers.clear();
+    mServiceResolvers.clear();
+    StopDiscovery();
 }
 
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext)
@@ -383,10 +416,7 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
 void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState)
 {
-    assert(mGroup == aGroup || mGroup == nullptr);
-
     otbrLog(OTBR_LOG_INFO, "Avahi group change to state %d.", aState);
-    mGroup = aGroup;
 
     /* Called whenever the entry group state changes */
     switch (aState)
@@ -417,19 +447,6 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
     }
 }
 
-void PublisherAvahi::CreateGroup(AvahiClient *aClient)
-{
-    VerifyOrExit(mGroup == nullptr);
-
-    VerifyOrExit((mGroup = avahi_entry_group_new(aClient, HandleGroupState, this)) != nullptr);
-
-exit:
-    if (mGroup == nullptr)
-    {
-        otbrLog(OTBR_LOG_ERR, "avahi_entry_group_new() failed: %s", avahi_strerror(avahi_client_errno(aClient)));
-    }
-}
-
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
 {
     otbrLog(OTBR_LOG_INFO, "Avahi client state changed to %d.", aState);
@@ -439,19 +456,28 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         /* The server has startup successfully and registered its host
          * name on the network, so it's time to create our services */
         otbrLog(OTBR_LOG_INFO, "Avahi client ready.");
-        mState = kStateReady;
-        CreateGroup(aClient);
-        mStateHandler(mContext, mState);
-        if (mGroup)
+        // This may be called before avahi_client_new() returns.
+        mClient     = aClient;
+        mState      = kStateReady;
+        mRetryDelay = kMinRetryDelay;
+
+        // Services known before a restart of the daemon are back at once, without waiting for their owners.
+        if (ReplayServices() != OTBR_ERROR_NONE)
         {
-            avahi_entry_group_commit(mGroup);
+            ScheduleRetry();
         }
+
+        mStateHandler(mContext, mState);
+        StartDiscovery();
         break;
 
     case AVAHI_CLIENT_FAILURE:
         otbrLog(OTBR_LOG_ERR, "Client failure: %s", avahi_strerror(avahi_client_errno(aClient)));
+        DiscardServices();
         mState = kStateIdle;
+        DiscardDiscovery();
         mStateHandler(mContext, mState);
+        ScheduleRetry();
         break;
 
     case AVAHI_CLIENT_S_COLLISION:
@@ -466,15 +492,22 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         /* The server records are now being established. This
          * might be caused by a host name change. We need to wait
          * for our own records to register until the host name is
-         * properly esatblished. */
-        if (mGroup)
-        {
-            avahi_entry_group_reset(mGroup);
-        }
+         * properly esatblished. The services are published again
+         * when the server is running. */
+        DiscardServices();
         break;
 
     case AVAHI_CLIENT_CONNECTING:
+        // The daemon is gone, and the client reconnects by itself as soon as it is back.
         otbrLog(OTBR_LOG_DEBUG, "Connecting to avahi server");
+
+        if (mState == kStateReady)
+        {
+            DiscardServices();
+            mState = kStateIdle;
+            DiscardDiscovery();
+            mStateHandler(mContext, mState);
+        }
         break;
 
     default:
@@ -489,45 +522,56 @@ void PublisherAvahi::UpdateFdSet(fd_set & aReadFdSet,
                                  int &    aMaxFd,
                                  timeval &aTimeout)
 {
-    mPoller.UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
+    // Watches are registered to the shared event poller, and timeouts to the shared timer scheduler.
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
+    OTBR_UNUSED_VARIABLE(aWriteFdSet);
+    OTBR_UNUSED_VARIABLE(aErrorFdSet);
+    OTBR_UNUSED_VARIABLE(aMaxFd);
+    OTBR_UNUSED_VARIABLE(aTimeout);
 }
 
 void PublisherAvahi::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
-    mPoller.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
+    OTBR_UNUSED_VARIABLE(aWriteFdSet);
+    OTBR_UNUSED_VARIABLE(aErrorFdSet);
 }
 
-otbrError PublisherAvahi::PublishService(uint16_t aPort, const char *aName, const char *aType, ...)
+otbrError PublisherAvahi::DoPublishService(ServiceHandle  aHandle,
+                                           const char *   aHostName,
+                                           uint16_t       aPort,
+                                           const char *   aName,
+                                           const char *   aType,
+                                           const TxtList &aTxtList)
 {
     otbrError ret   = OTBR_ERROR_ERRNO;
     int       error = 0;
     // aligned with AvahiStringList
-    AvahiStringList  buffer[kMaxSizeOfTxtRecord / sizeof(AvahiStringList)];
-    AvahiStringList *last = nullptr;
-    AvahiStringList *curr = buffer;
-    va_list          args;
-    size_t           used = 0;
-
-    va_start(args, aType);
+    AvahiStringList    buffer[kMaxSizeOfTxtRecord / sizeof(AvahiStringList)];
+    AvahiStringList *  last  = nullptr;
+    AvahiStringList *  curr  = buffer;
+    size_t             used  = 0;
+    AvahiEntryGroup *  group = nullptr;
+    Services::iterator it;
+    std::string        hostName = (aHostName != nullptr ? aHostName : "");
+    std::string        fullHostName;
 
     VerifyOrExit(mState == kStateReady, errno = EAGAIN);
-    VerifyOrExit(mGroup != nullptr, ret = OTBR_ERROR_MDNS);
 
-    for (const char *name = va_arg(args, const char *); name; name = va_arg(args, const char *))
+    for (const TxtEntry &entry : aTxtList)
     {
-        int         rval;
-        const char *value       = va_arg(args, const char *);
-        size_t      valueLength = va_arg(args, size_t);
+        size_t valueLength = entry.mValue.size();
         // +1 for the size of "=", avahi doesn't need '\0' at the end of the entry
-        size_t needed = sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + strlen(name) + valueLength + 1;
+        size_t needed =
+            sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + entry.mName.size() + valueLength + 1;
 
         VerifyOrExit(used + needed <= sizeof(buffer), errno = EMSGSIZE);
         curr->next = last;
         last       = curr;
-        rval       = sprintf(reinterpret_cast<char *>(curr->text), "%s=", name);
-        assert(rval > 0);
-        memcpy(curr->text + rval, value, valueLength);
-        curr->size = valueLength + static_cast<size_t>(rval);
+        memcpy(curr->text, entry.mName.data(), entry.mName.size());
+        curr->text[entry.mName.size()] = '=';
+        memcpy(curr->text + entry.mName.size() + 1, entry.mValue.data(), valueLength);
+        curr->size = entry.mName.size() + 1 + valueLength;
         {
             const uint8_t *next = curr->text + curr->size;
             curr                = OTBR_ALIGNED(next, AvahiStringList *);
@@ -535,37 +579,53 @@ otbrError PublisherAvahi::PublishService(uint16_t aPort, const char *aName, cons
         used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(buffer));
     }
 
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
+    it = mServices.find(aHandle);
+
+    if (it != mServices.end() && it->second.mPort == aPort && it->second.mHostName == hostName)
     {
-        if (!strncmp(it->mName, aName, sizeof(it->mName)) && !strncmp(it->mType, aType, sizeof(it->mType)) &&
-            it->mPort == aPort)
-        {
-            otbrLog(OTBR_LOG_INFO, "MDNS update service %s", aName);
-            error = avahi_entry_group_update_service_txt_strlst(
-                mGroup, AVAHI_IF_UNSPEC, mProtocol, static_cast<AvahiPublishFlags>(0), aName, aType, mDomain, last);
-            SuccessOrExit(error);
-            ret = OTBR_ERROR_NONE;
-            ExitNow();
-        }
+        otbrLog(OTBR_LOG_INFO, "MDNS update service %s", aName);
+        error = avahi_entry_group_update_service_txt_strlst(it->second.mGroup, AVAHI_IF_UNSPEC, mProtocol,
+                                                            static_cast<AvahiPublishFlags>(0), aName, aType, mDomain,
+                                                            last);
+        SuccessOrExit(error);
+        ret = OTBR_ERROR_NONE;
+        ExitNow();
     }
 
-    otbrLog(OTBR_LOG_INFO, "MDNS create service %s", aName);
-    error = avahi_entry_group_add_service_strlst(mGroup, AVAHI_IF_UNSPEC, mProtocol, static_cast<AvahiPublishFlags>(0),
-                                                 aName, aType, mDomain, mHost, aPort, last);
-    SuccessOrExit(error);
+    if (it != mServices.end())
+    {
+        // A new port or host takes registering the service again.
+        group = it->second.mGroup;
+        mServices.erase(it);
+        SuccessOrExit(error = avahi_entry_group_reset(group));
+    }
+    else
+    {
+        group = avahi_entry_group_new(mClient, HandleGroupState, this);
+        VerifyOrExit(group != nullptr, error = avahi_client_errno(mClient));
+    }
 
+    if (aHostName != nullptr)
     {
-        Service service;
-        strcpy_safe(service.mName, sizeof(service.mName), aName);
-        strcpy_safe(service.mType, sizeof(service.mType), aType);
-        service.mPort = aPort;
-        mServices.push_back(service);
+        fullHostName = GetHostFullName(aHostName);
     }
 
-    ret = OTBR_ERROR_NONE;
+    otbrLog(OTBR_LOG_INFO, "MDNS create service %s", aName);
+    error = avahi_entry_group_add_service_strlst(group, AVAHI_IF_UNSPEC, mProtocol, static_cast<AvahiPublishFlags>(0),
+                                                 aName, aType, mDomain,
+                                                 aHostName != nullptr ? fullHostName.c_str() : mHost, aPort, last);
+    SuccessOrExit(error);
+    SuccessOrExit(error = avahi_entry_group_commit(group));
+
+    mServices[aHandle] = Service{group, aPort, hostName};
+    group              = nullptr;
+    ret                = OTBR_ERROR_NONE;
 
 exit:
-    va_end(args);
+    if (group != nullptr)
+    {
+        avahi_entry_group_free(group);
+    }
 
     if (error)
     {
@@ -581,6 +641,281 @@ exit:
     return ret;
 }
 
+void PublisherAvahi::DoUnpublishService(ServiceHandle aHandle)
+{
+    Services::iterator it = mServices.find(aHandle);
+
+    VerifyOrExit(it != mServices.end());
+
+    otbrLog(OTBR_LOG_INFO, "MDNS remove service %u", aHandle);
+    avahi_entry_group_free(it->second.mGroup);
+    mServices.erase(it);
+
+exit:
+    return;
+}
+
+otbrError PublisherAvahi::DoPublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses)
+{
+    otbrError        ret          = OTBR_ERROR_ERRNO;
+    int              error        = 0;
+    std::string      fullHostName = GetHostFullName(aName);
+    AvahiEntryGroup *group        = nullptr;
+    auto             it           = mHostGroups.find(aName);
+
+    VerifyOrExit(mState == kStateReady, errno = EAGAIN);
+
+    if (it != mHostGroups.end())
+    {
+        // The addresses of a group cannot be changed, the group is filled again.
+        group = it->second;
+        mHostGroups.erase(it);
+        SuccessOrExit(error = avahi_entry_group_reset(group));
+    }
+    else
+    {
+        group = avahi_entry_group_new(mClient, HandleGroupState, this);
+        VerifyOrExit(group != nullptr, error = avahi_client_errno(mClient));
+    }
+
+    otbrLog(OTBR_LOG_INFO, "MDNS publish host %s with %zu addresses", aName, aAddresses.size());
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        AvahiAddress avahiAddress;
+
+        avahiAddress.proto = AVAHI_PROTO_INET6;
+        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(avahiAddress.data.ipv6.address));
+
+        // The reverse mapping of the addresses is left to the host, which may have several names.
+        error = avahi_entry_group_add_address(group, AVAHI_IF_UNSPEC, mProtocol, AVAHI_PUBLISH_NO_REVERSE,
+                                              fullHostName.c_str(), &avahiAddress);
+        SuccessOrExit(error);
+    }
+
+    SuccessOrExit(error = avahi_entry_group_commit(group));
+
+    mHostGroups[aName] = group;
+    group              = nullptr;
+    ret                = OTBR_ERROR_NONE;
+
+exit:
+    if (group != nullptr)
+    {
+        avahi_entry_group_free(group);
+    }
+
+    if (error)
+    {
+        ret = OTBR_ERROR_MDNS;
+        otbrLog(OTBR_LOG_ERR, "Failed to publish host for avahi error: %s!", avahi_strerror(error));
+    }
+
+    if (ret == OTBR_ERROR_ERRNO)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to publish host: %s!", strerror(errno));
+    }
+
+    return ret;
+}
+
+void PublisherAvahi::DoUnpublishHost(const char *aName)
+{
+    auto it = mHostGroups.find(aName);
+
+    VerifyOrExit(it != mHostGroups.end());
+
+    otbrLog(OTBR_LOG_INFO, "MDNS remove host %s", aName);
+    avahi_entry_group_free(it->second);
+    mHostGroups.erase(it);
+
+exit:
+    return;
+}
+
+otbrError PublisherAvahi::DoBrowse(const char *aType)
+{
+    otbrError                       error = OTBR_ERROR_NONE;
+    std::unique_ptr<ServiceBrowser> browser;
+
+    // Browsing starts when the client is running.
+    VerifyOrExit(mState == kStateReady);
+    VerifyOrExit(!mServiceBrowsers.count(aType));
+
+    browser.reset(new ServiceBrowser{this, aType, nullptr});
+    browser->mBrowser = avahi_service_browser_new(mClient, AVAHI_IF_UNSPEC, mProtocol, aType, mDomain,
+                                                  static_cast<AvahiLookupFlags>(0), HandleBrowseResult, browser.get());
+    VerifyOrExit(browser->mBrowser != nullptr, error = OTBR_ERROR_MDNS);
+
+    otbrLog(OTBR_LOG_INFO, "MDNS browse %s", aType);
+    mServiceBrowsers[aType] = std::move(browser);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to browse %s: %s!", aType, avahi_strerror(avahi_client_errno(mClient)));
+    }
+
+    return error;
+}
+
+void PublisherAvahi::DoStopBrowse(const char *aType)
+{
+    auto it = mServiceBrowsers.find(aType);
+
+    VerifyOrExit(it != mServiceBrowsers.end());
+
+    avahi_service_browser_free(it->second->mBrowser);
+    mServiceBrowsers.erase(it);
+
+exit:
+    return;
+}
+
+void PublisherAvahi::HandleBrowseResult(AvahiServiceBrowser *  aBrowser,
+                                        AvahiIfIndex           aInterfaceIndex,
+                                        AvahiProtocol          aProtocol,
+                                        AvahiBrowserEvent      aEvent,
+                                        const char *           aName,
+                                        const char *           aType,
+                                        const char *           aDomain,
+                                        AvahiLookupResultFlags aFlags,
+                                        void *                 aContext)
+{
+    ServiceBrowser *browser = static_cast<ServiceBrowser *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aBrowser);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    browser->mPublisher->HandleBrowseResult(*browser, aEvent, aName);
+}
+
+void PublisherAvahi::HandleBrowseResult(ServiceBrowser &aBrowser, AvahiBrowserEvent aEvent, const char *aName)
+{
+    switch (aEvent)
+    {
+    case AVAHI_BROWSER_NEW:
+        HandleServiceFound(aBrowser.mType.c_str(), aName);
+        break;
+
+    case AVAHI_BROWSER_REMOVE:
+        HandleServiceRemoved(aBrowser.mType.c_str(), aName);
+        break;
+
+    case AVAHI_BROWSER_FAILURE:
+        otbrLog(OTBR_LOG_ERR, "Failed to browse %s: %s!", aBrowser.mType.c_str(),
+                avahi_strerror(avahi_client_errno(mClient)));
+        break;
+
+    default:
+        break;
+    }
+}
+
+otbrError PublisherAvahi::DoResolve(const char *aName, const char *aType)
+{
+    otbrError                        error = OTBR_ERROR_NONE;
+    std::unique_ptr<ServiceResolver> resolver;
+
+    VerifyOrExit(mState == kStateReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
+
+    resolver.reset(new ServiceResolver{this, aName, aType, nullptr});
+    resolver->mResolver =
+        avahi_service_resolver_new(mClient, AVAHI_IF_UNSPEC, mProtocol, aName, aType, mDomain, AVAHI_PROTO_INET6,
+                                   static_cast<AvahiLookupFlags>(0), HandleResolveResult, resolver.get());
+    VerifyOrExit(resolver->mResolver != nullptr, error = OTBR_ERROR_MDNS);
+
+    otbrLog(OTBR_LOG_INFO, "MDNS resolve %s.%s", aName, aType);
+    mServiceResolvers[ServiceKey(aName, aType)] = std::move(resolver);
+
+exit:
+    if (error == OTBR_ERROR_MDNS)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to resolve %s: %s!", aName, avahi_strerror(avahi_client_errno(mClient)));
+    }
+
+    return error;
+}
+
+void PublisherAvahi::DoStopResolve(const char *aName, const char *aType)
+{
+    auto it = mServiceResolvers.find(ServiceKey(aName, aType));
+
+    VerifyOrExit(it != mServiceResolvers.end());
+
+    avahi_service_resolver_free(it->second->mResolver);
+    mServiceResolvers.erase(it);
+
+exit:
+    return;
+}
+
+void PublisherAvahi::HandleResolveResult(AvahiServiceResolver * aResolver,
+                                         AvahiIfIndex           aInterfaceIndex,
+                                         AvahiProtocol          aProtocol,
+                                         AvahiResolverEvent     aEvent,
+                                         const char *           aName,
+                                         const char *           aType,
+                                         const char *           aDomain,
+                                         const char *           aHostName,
+                                         const AvahiAddress *   aAddress,
+                                         uint16_t               aPort,
+                                         AvahiStringList *      aTxt,
+                                         AvahiLookupResultFlags aFlags,
+                                         void *                 aContext)
+{
+    ServiceResolver *resolver = static_cast<ServiceResolver *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aResolver);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    resolver->mPublisher->HandleResolveResult(*resolver, aEvent, aHostName, aAddress, aPort, aTxt);
+}
+
+void PublisherAvahi::HandleResolveResult(ServiceResolver &   aResolver,
+                                         AvahiResolverEvent  aEvent,
+                                         const char *        aHostName,
+                                         const AvahiAddress *aAddress,
+                                         uint16_t            aPort,
+                                         AvahiStringList *   aTxt)
+{
+    DiscoveredInstanceInfo instance;
+
+    // The resolver is freed when the result is handled.
+    VerifyOrExit(aEvent == AVAHI_RESOLVER_FOUND,
+                 HandleServiceResolveFailed(aResolver.mType.c_str(), aResolver.mName.c_str()));
+
+    instance.mName     = aResolver.mName;
+    instance.mHostName = aHostName;
+    instance.mPort     = aPort;
+    // Avahi doesn't tell the TTLs of the records.
+    instance.mTtl = kResolvedTtl;
+
+    if (aAddress != nullptr && aAddress->proto == AVAHI_PROTO_INET6)
+    {
+        instance.mAddresses.push_back(Ip6Address(aAddress->data.ipv6.address));
+    }
+
+    for (AvahiStringList *entry = aTxt; entry != nullptr; entry = avahi_string_list_get_next(entry))
+    {
+        AppendTxtEntry(avahi_string_list_get_text(entry), avahi_string_list_get_size(entry), instance.mTxtList);
+    }
+
+    HandleServiceResolved(aResolver.mType.c_str(), instance);
+
+exit:
+    return;
+}
+
 Publisher *Publisher::Create(int aFamily, const char *aHost, const char *aDomain, StateHandler aHandler, void *aContext)
 {
     return new PublisherAvahi(aFamily, aHost, aDomain, aHandler, aContext);
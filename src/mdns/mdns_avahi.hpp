@@ -34,13 +34,18 @@
 #ifndef OTBR_AGENT_MDNS_AVAHI_HPP_
 #define OTBR_AGENT_MDNS_AVAHI_HPP_
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <avahi-client/client.h>
+#include <avahi-client/lookup.h>
 #include <avahi-client/publish.h>
 #include <avahi-common/domain.h>
 #include <avahi-common/watch.h>
 
+#include "common/timer.hpp"
 #include "mdns.hpp"
 
 /**
@@ -78,6 +83,7 @@ struct AvahiWatch
     AvahiWatch(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext, void *aPoller)
         : mFd(aFd)
         , mEvents(aEvents)
+        , mHappened(0)
         , mCallback(aCallback)
         , mContext(aContext)
         , mPoller(aPoller)
@@ -91,7 +97,7 @@ struct AvahiWatch
  */
 struct AvahiTimeout
 {
-    unsigned long        mTimeout;  ///< Absolute time when this timer timeout.
+    otbr::Timer          mTimer;    ///< The timer scheduling this timeout.
     AvahiTimeoutCallback mCallback; ///< The function to be called when timeout.
     void *               mContext;  ///< The pointer to application-specific context.
     void *               mPoller;   ///< The poller created this timer.
@@ -99,13 +105,24 @@ struct AvahiTimeout
     /**
      * The constructor to initialize an AvahiTimeout.
      *
-     * @param[in]   aTimeout    A pointer to the time after which the callback should be called.
+     * @param[in]   aTimeout    A pointer to the absolute time when the callback should be called, nullptr to disable.
      * @param[in]   aCallback   The function to be called after timeout.
      * @param[in]   aContext    A pointer to application-specific context.
      * @param[in]   aPoller     The Poller this timeout belongs to.
      *
      */
     AvahiTimeout(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext, void *aPoller);
+
+    /**
+     * This method starts or stops this timeout.
+     *
+     * @param[in]   aTimeout    A pointer to the absolute time when the callback should be called, nullptr to disable.
+     *
+     */
+    void Update(const struct timeval *aTimeout);
+
+private:
+    static void HandleTimer(otbr::Timer &aTimer, void *aContext);
 };
 
 namespace otbr {
@@ -115,6 +132,10 @@ namespace Mdns {
 /**
  * This class implements the AvahiPoll.
  *
+ * Watches are registered to the shared event poller and timeouts are scheduled by the shared timer scheduler, so
+ * nothing is scanned in the mainloop. Avahi may watch a file descriptor more than once, e.g. for reading and for
+ * writing, so the watches are grouped by file descriptor and the file descriptor is registered once.
+ *
  */
 class Poller
 {
@@ -125,28 +146,6 @@ public:
      */
     Poller(void);
 
-    /**
-     * This method updates the fd_set and timeout for mainloop.
-     *
-     * @param[inout]    aReadFdSet      A reference to fd_set for polling read.
-     * @param[inout]    aWriteFdSet     A reference to fd_set for polling write.
-     * @param[inout]    aErrorFdSet     A reference to fd_set for polling error.
-     * @param[inout]    aMaxFd          A reference to the max file descriptor.
-     * @param[inout]    aTimeout        A reference to the timeout.
-     *
-     */
-    void UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout);
-
-    /**
-     * This method performs avahi poll processing.
-     *
-     * @param[in]   aReadFdSet   A reference to read file descriptors.
-     * @param[in]   aWriteFdSet  A reference to write file descriptors.
-     * @param[in]   aErrorFdSet  A reference to error file descriptors.
-     *
-     */
-    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
-
     /**
      * This method returns the AvahiPoll.
      *
@@ -156,8 +155,11 @@ public:
     const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoller; }
 
 private:
-    typedef std::vector<AvahiWatch *>   Watches;
-    typedef std::vector<AvahiTimeout *> Timers;
+    typedef std::vector<AvahiWatch *> Watches;
+
+    static void HandleEvent(void *aContext, int aFd, uint32_t aEvents);
+    void        HandleEvent(int aFd, uint32_t aEvents);
+    void        UpdateWatches(int aFd);
 
     static AvahiWatch *    WatchNew(const struct AvahiPoll *aPoller,
                                     int                     aFd,
@@ -176,11 +178,9 @@ private:
     AvahiTimeout *         TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext);
     static void            TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout);
     static void            TimeoutFree(AvahiTimeout *aTimer);
-    void                   TimeoutFree(AvahiTimeout &aTimer);
 
-    Watches   mWatches;
-    Timers    mTimers;
-    AvahiPoll mAvahiPoller;
+    std::unordered_map<int, Watches> mWatches;
+    AvahiPoll                        mAvahiPoller;
 };
 
 /**
@@ -205,23 +205,6 @@ public:
 
     ~PublisherAvahi(void);
 
-    /**
-     * This method publishes or updates a service.
-     *
-     * @note only text record can be updated.
-     *
-     * @param[in]   aName               The name of this service.
-     * @param[in]   aType               The type of this service.
-     * @param[in]   aPort               The port number of this service.
-     * @param[in]   ...                 Pointers to null-terminated string of key and value for text record.
-     *                                  The last argument must be nullptr.
-     *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
-     *
-     */
-    otbrError PublishService(uint16_t aPort, const char *aName, const char *aType, ...);
-
     /**
      * This method starts the MDNS service.
      *
@@ -247,7 +230,7 @@ public:
     void Stop(void);
 
     /**
-     * This method performs avahi poll processing.
+     * This method performs avahi poll processing, which is done by the shared event poller and timer scheduler.
      *
      * @param[in]   aReadFdSet          A reference to read file descriptors.
      * @param[in]   aWriteFdSet         A reference to write file descriptors.
@@ -268,6 +251,21 @@ public:
      */
     void UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout);
 
+protected:
+    otbrError DoPublishService(ServiceHandle  aHandle,
+                               const char *   aHostName,
+                               uint16_t       aPort,
+                               const char *   aName,
+                               const char *   aType,
+                               const TxtList &aTxtList);
+    void      DoUnpublishService(ServiceHandle aHandle);
+    otbrError DoPublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses);
+    void      DoUnpublishHost(const char *aName);
+    otbrError DoBrowse(const char *aType);
+    void      DoStopBrowse(const char *aType);
+    otbrError DoResolve(const char *aName, const char *aType);
+    void      DoStopResolve(const char *aName, const char *aType);
+
 private:
     enum
     {
@@ -276,34 +274,91 @@ private:
         kMaxSizeOfHost        = AVAHI_LABEL_MAX,
         kMaxSizeOfDomain      = AVAHI_LABEL_MAX,
         kMaxSizeOfServiceType = AVAHI_LABEL_MAX,
+        kResolvedTtl          = 120,   ///< The TTL in seconds of resolved instances, the host record TTL of RFC 6762.
+        kMinRetryDelay        = 250,   ///< The first delay in milliseconds to reconnect or replay services.
+        kMaxRetryDelay        = 32000, ///< The longest delay in milliseconds to reconnect or replay services.
     };
 
     struct Service
     {
-        char     mName[kMaxSizeOfServiceName];
-        char     mType[kMaxSizeOfServiceType];
-        uint16_t mPort;
+        AvahiEntryGroup *mGroup; ///< Each service has its own group, so that it can be withdrawn alone.
+        uint16_t         mPort;
+        std::string      mHostName;
+    };
+
+    typedef std::unordered_map<ServiceHandle, Service> Services;
+
+    struct ServiceBrowser
+    {
+        PublisherAvahi *     mPublisher;
+        std::string          mType;
+        AvahiServiceBrowser *mBrowser;
+    };
+
+    struct ServiceResolver
+    {
+        PublisherAvahi *      mPublisher;
+        std::string           mName;
+        std::string           mType;
+        AvahiServiceResolver *mResolver;
     };
 
-    typedef std::vector<Service> Services;
+    static void HandleBrowseResult(AvahiServiceBrowser *  aBrowser,
+                                   AvahiIfIndex           aInterfaceIndex,
+                                   AvahiProtocol          aProtocol,
+                                   AvahiBrowserEvent      aEvent,
+                                   const char *           aName,
+                                   const char *           aType,
+                                   const char *           aDomain,
+                                   AvahiLookupResultFlags aFlags,
+                                   void *                 aContext);
+    void        HandleBrowseResult(ServiceBrowser &aBrowser, AvahiBrowserEvent aEvent, const char *aName);
+    static void HandleResolveResult(AvahiServiceResolver * aResolver,
+                                    AvahiIfIndex           aInterfaceIndex,
+                                    AvahiProtocol          aProtocol,
+                                    AvahiResolverEvent     aEvent,
+                                    const char *           aName,
+                                    const char *           aType,
+                                    const char *           aDomain,
+                                    const char *           aHostName,
+                                    const AvahiAddress *   aAddress,
+                                    uint16_t               aPort,
+                                    AvahiStringList *      aTxt,
+                                    AvahiLookupResultFlags aFlags,
+                                    void *                 aContext);
+    void        HandleResolveResult(ServiceResolver &   aResolver,
+                                    AvahiResolverEvent  aEvent,
+                                    const char *        aHostName,
+                                    const AvahiAddress *aAddress,
+                                    uint16_t            aPort,
+                                    AvahiStringList *   aTxt);
+    void        DiscardDiscovery(void);
 
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
-    void        CreateGroup(AvahiClient *aClient);
+    void        DiscardServices(void);
+    std::string GetHostFullName(const char *aHostName) const;
+    void        ScheduleRetry(void);
+    static void HandleRetryTimer(Timer &aTimer, void *aContext);
+    void        HandleRetryTimer(void);
     static void HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void        HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
 
-    Services         mServices;
-    AvahiClient *    mClient;
-    AvahiEntryGroup *mGroup;
-    Poller           mPoller;
-    int              mProtocol;
-    const char *     mHost;
-    const char *     mDomain;
-    State            mState;
-    StateHandler     mStateHandler;
-    void *           mContext;
+    Services                                                          mServices;
+    std::unordered_map<std::string, AvahiEntryGroup *>                mHostGroups; ///< The groups by host name.
+    std::unordered_map<std::string, std::unique_ptr<ServiceBrowser>>  mServiceBrowsers;  ///< The browsers by type.
+    std::unordered_map<std::string, std::unique_ptr<ServiceResolver>> mServiceResolvers; ///< The resolvers by key.
+    AvahiClient *                                                     mClient;
+    Poller                                                            mPoller;
+    int                                                               mProtocol;
+    const char *                                                      mHost;
+    const char *                                                      mDomain;
+    State                                                             mState;
+    StateHandler                                                      mStateHandler;
+    void *                                                            mContext;
+    Timer                                                             mRetryTimer; ///< Reconnecting or replaying.
+    uint32_t                                                          mRetryDelay; ///< In milliseconds.
 };
 
 } // namespace Mdns
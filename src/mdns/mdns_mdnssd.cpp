@@ -36,6 +36,7 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <errno.h>
+#include <netinet/in.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -167,7 +168,9 @@ PublisherMDnsSd::PublisherMDnsSd(int          aProtocol,
                                  const char * aDomain,
                                  StateHandler aHandler,
                                  void *       aContext)
-    : mHost(aHost)
+    : mConnection(nullptr)
+    , mHostConnection(nullptr)
+    , mHost(aHost)
     , mDomain(aDomain)
     , mState(kStateIdle)
     , mStateHandler(aHandler)
@@ -183,9 +186,29 @@ PublisherMDnsSd::~PublisherMDnsSd(void)
 
 otbrError PublisherMDnsSd::Start(void)
 {
+    otbrError ret = OTBR_ERROR_NONE;
+
+#if OTBR_ENABLE_MDNSSD_SHARE_CONNECTION
+    DNSServiceErrorType error = DNSServiceCreateConnection(&mConnection);
+
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to connect to mDNSResponder: %s!", DNSErrorToString(error));
+        mConnection = nullptr;
+        ExitNow(ret = OTBR_ERROR_MDNS);
+    }
+
+    AddServiceRef(mConnection);
+#endif
+
     mState = kStateReady;
     mStateHandler(mContext, kStateReady);
-    return OTBR_ERROR_NONE;
+    StartDiscovery();
+
+#if OTBR_ENABLE_MDNSSD_SHARE_CONNECTION
+exit:
+#endif
+    return ret;
 }
 
 bool PublisherMDnsSd::IsStarted(void) const
@@ -199,12 +222,45 @@ void PublisherMDnsSd::Stop(void)
 
     for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
     {
-        otbrLog(OTBR_LOG_INFO, "MDNS remove service %s", it->mName);
-        DNSServiceRefDeallocate(it->mService);
+        otbrLog(OTBR_LOG_INFO, "MDNS remove service %s", it->second.mName);
+        RemoveServiceRef(it->second.mService);
     }
 
     mServices.clear();
 
+    for (auto &browser : mServiceBrowsers)
+    {
+        RemoveServiceRef(browser.second->mServiceRef);
+    }
+
+    for (auto &resolver : mServiceResolvers)
+    {
+        RemoveServiceRef(resolver.second->mServiceRef);
+    }
+
+    mServiceBrowsers.clear();
+    mServiceResolvers.clear();
+
+    // The records are released with their connection.
+    mHostRecords.clear();
+
+    if (mHostConnection != nullptr && mHostConnection != mConnection)
+    {
+        RemoveServiceRef(mHostConnection);
+    }
+
+    mHostConnection = nullptr;
+
+    // The shared connection goes last, as it invalidates all references sharing it.
+    if (mConnection != nullptr)
+    {
+        RemoveServiceRef(mConnection);
+        mConnection = nullptr;
+    }
+
+    mState = kStateIdle;
+    StopDiscovery();
+
 exit:
     return;
 }
@@ -219,41 +275,40 @@ void PublisherMDnsSd::UpdateFdSet(fd_set & aReadFdSet,
     (void)aErrorFdSet;
     (void)aTimeout;
 
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
+    for (auto &polled : mPolledServiceRefs)
     {
-        int fd = DNSServiceRefSockFD(it->mService);
+        FD_SET(polled.first, &aReadFdSet);
+        polled.second.mPolled = true;
 
-        assert(fd != -1);
-
-        FD_SET(fd, &aReadFdSet);
-
-        if (fd > aMaxFd)
+        if (polled.first > aMaxFd)
         {
-            aMaxFd = fd;
+            aMaxFd = polled.first;
         }
     }
 }
 
 void PublisherMDnsSd::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
-    std::vector<DNSServiceRef> readyServices;
+    int fd = -1;
 
     (void)aWriteFdSet;
     (void)aErrorFdSet;
 
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
+    // Results may add or remove references, so look up the next socket each time instead of keeping an iterator.
+    for (PolledServiceRefs::iterator it = mPolledServiceRefs.begin(); it != mPolledServiceRefs.end();
+         it = mPolledServiceRefs.upper_bound(fd))
     {
-        int fd = DNSServiceRefSockFD(it->mService);
+        DNSServiceErrorType error;
 
-        if (FD_ISSET(fd, &aReadFdSet))
+        fd = it->first;
+
+        // A reference added since the fd_set was updated may reuse the socket number of a removed one.
+        if (!it->second.mPolled || !FD_ISSET(fd, &aReadFdSet))
         {
-            readyServices.push_back(it->mService);
+            continue;
         }
-    }
 
-    for (std::vector<DNSServiceRef>::iterator it = readyServices.begin(); it != readyServices.end(); ++it)
-    {
-        DNSServiceErrorType error = DNSServiceProcessResult(*it);
+        error = DNSServiceProcessResult(it->second.mServiceRef);
 
         if (error != kDNSServiceErr_NoError)
         {
@@ -262,6 +317,41 @@ void PublisherMDnsSd::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSe
     }
 }
 
+DNSServiceFlags PublisherMDnsSd::PrepareServiceRef(DNSServiceRef &aServiceRef) const
+{
+    DNSServiceFlags flags = 0;
+
+    aServiceRef = mConnection;
+
+    if (mConnection != nullptr)
+    {
+        flags = kDNSServiceFlagsShareConnection;
+    }
+
+    return flags;
+}
+
+void PublisherMDnsSd::AddServiceRef(DNSServiceRef aServiceRef)
+{
+    // References sharing the connection have no socket of their own.
+    VerifyOrExit(mConnection == nullptr || aServiceRef == mConnection);
+
+    mPolledServiceRefs[DNSServiceRefSockFD(aServiceRef)] = PolledServiceRef{aServiceRef, false};
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::RemoveServiceRef(DNSServiceRef aServiceRef)
+{
+    if (mConnection == nullptr || aServiceRef == mConnection)
+    {
+        mPolledServiceRefs.erase(DNSServiceRefSockFD(aServiceRef));
+    }
+
+    DNSServiceRefDeallocate(aServiceRef);
+}
+
 void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService,
                                                   const DNSServiceFlags aFlags,
                                                   DNSServiceErrorType   aError,
@@ -288,85 +378,75 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
         if (aFlags & kDNSServiceFlagsAdd)
         {
             otbrLog(OTBR_LOG_INFO, "MDNS added service %s", aName);
-            RecordService(aName, aType, aServiceRef);
+            assert(FindService(aServiceRef) != mServices.end());
         }
         else
         {
             otbrLog(OTBR_LOG_INFO, "MDNS remove service %s", aName);
-            DiscardService(aName, aType, aServiceRef);
+            DiscardService(aServiceRef);
         }
     }
     else
     {
         otbrLog(OTBR_LOG_ERR, "Failed to register service %s: %s", aName, DNSErrorToString(aError));
-        DiscardService(aName, aType, aServiceRef);
+        DiscardService(aServiceRef);
     }
 }
 
-void PublisherMDnsSd::DiscardService(const char *aName, const char *aType, DNSServiceRef aServiceRef)
+PublisherMDnsSd::Services::iterator PublisherMDnsSd::FindService(DNSServiceRef aServiceRef)
 {
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
+    Services::iterator it = mServices.begin();
+
+    while (it != mServices.end() && it->second.mService != aServiceRef)
     {
-        if (!strncmp(it->mName, aName, sizeof(it->mName)) && !strncmp(it->mType, aType, sizeof(it->mType)))
-        {
-            assert(aServiceRef == it->mService);
-            mServices.erase(it);
-            DNSServiceRefDeallocate(aServiceRef);
-            aServiceRef = nullptr;
-            break;
-        }
+        ++it;
     }
 
-    assert(aServiceRef == nullptr);
+    return it;
 }
 
-void PublisherMDnsSd::RecordService(const char *aName, const char *aType, DNSServiceRef aServiceRef)
+void PublisherMDnsSd::DiscardService(DNSServiceRef aServiceRef)
 {
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
-    {
-        if (!strncmp(it->mName, aName, sizeof(it->mName)) && !strncmp(it->mType, aType, sizeof(it->mType)))
-        {
-            assert(aServiceRef == it->mService);
-            ExitNow();
-        }
-    }
+    Services::iterator it = FindService(aServiceRef);
 
-    {
-        Service service;
+    assert(it != mServices.end());
+    VerifyOrExit(it != mServices.end());
 
-        strcpy_safe(service.mName, sizeof(service.mName), aName);
-        strcpy_safe(service.mType, sizeof(service.mType), aType);
-        service.mService = aServiceRef;
-        mServices.push_back(service);
-    }
+    mServices.erase(it);
+    RemoveServiceRef(aServiceRef);
 
 exit:
     return;
 }
 
-otbrError PublisherMDnsSd::PublishService(uint16_t aPort, const char *aName, const char *aType, ...)
+otbrError PublisherMDnsSd::DoPublishService(ServiceHandle  aHandle,
+                                            const char *   aHostName,
+                                            uint16_t       aPort,
+                                            const char *   aName,
+                                            const char *   aType,
+                                            const TxtList &aTxtList)
 {
-    otbrError     ret   = OTBR_ERROR_NONE;
-    int           error = 0;
-    va_list       args;
-    uint8_t       txt[kMaxSizeOfTxtRecord];
-    uint8_t *     cur        = txt;
-    DNSServiceRef serviceRef = nullptr;
-
-    va_start(args, aType);
-
-    for (const char *name = va_arg(args, const char *); name; name = va_arg(args, const char *))
+    otbrError          ret   = OTBR_ERROR_NONE;
+    int                error = 0;
+    uint8_t            txt[kMaxSizeOfTxtRecord];
+    uint8_t *          cur        = txt;
+    DNSServiceRef      serviceRef = nullptr;
+    DNSServiceFlags    flags;
+    Services::iterator it;
+    std::string        hostName = (aHostName != nullptr ? aHostName : "");
+    std::string        fullHostName;
+
+    for (const TxtEntry &entry : aTxtList)
     {
-        const char * value        = va_arg(args, const char *);
-        const size_t nameLength   = strlen(name);
-        const size_t valueLength  = va_arg(args, size_t);
+        const size_t nameLength   = entry.mName.size();
+        const size_t valueLength  = entry.mValue.size();
         size_t       recordLength = nameLength + 1 + valueLength;
 
         assert(nameLength > 0 && valueLength > 0 && recordLength < kMaxTextRecordSize);
 
         if (cur + recordLength >= txt + sizeof(txt))
         {
-            otbrLog(OTBR_LOG_WARNING, "Skip text record too much long: %s=%s", name, value);
+            otbrLog(OTBR_LOG_WARNING, "Skip text record too much long: %s", entry.mName.c_str());
             continue;
         }
 
@@ -374,47 +454,412 @@ otbrError PublisherMDnsSd::PublishService(uint16_t aPort, const char *aName, con
         cur[0] = static_cast<uint8_t>(recordLength);
         cur += 1;
 
-        memcpy(cur, name, nameLength);
+        memcpy(cur, entry.mName.data(), nameLength);
         cur += nameLength;
 
         cur[0] = '=';
         cur += 1;
 
-        memcpy(cur, value, valueLength);
+        memcpy(cur, entry.mValue.data(), valueLength);
         cur += valueLength;
     }
 
-    va_end(args);
+    it = mServices.find(aHandle);
+
+    if (it != mServices.end() && it->second.mPort == aPort && it->second.mHostName == hostName)
+    {
+        otbrLog(OTBR_LOG_INFO, "MDNS update service %s", aName);
+        SuccessOrExit(error = DNSServiceUpdateRecord(it->second.mService, nullptr, 0, static_cast<uint16_t>(cur - txt),
+                                                     txt, 0));
+        ExitNow();
+    }
+
+    if (it != mServices.end())
+    {
+        // A new port or host takes registering the service again.
+        otbrLog(OTBR_LOG_INFO, "MDNS remove current service %s", aName);
+        RemoveServiceRef(it->second.mService);
+        mServices.erase(it);
+    }
+
+    if (aHostName != nullptr)
+    {
+        fullHostName = GetHostFullName(aHostName);
+    }
+
+    flags = PrepareServiceRef(serviceRef);
+    SuccessOrExit(error = DNSServiceRegister(&serviceRef, flags, kDNSServiceInterfaceIndexAny, aName, aType, mDomain,
+                                             aHostName != nullptr ? fullHostName.c_str() : mHost, htons(aPort),
+                                             static_cast<uint16_t>(cur - txt), txt, HandleServiceRegisterResult,
+                                             this));
+    AddServiceRef(serviceRef);
 
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
     {
-        if (!strncmp(it->mName, aName, sizeof(it->mName)) && !strncmp(it->mType, aType, sizeof(it->mType)))
+        Service &service = mServices[aHandle];
+
+        strcpy_safe(service.mName, sizeof(service.mName), aName);
+        service.mService  = serviceRef;
+        service.mPort     = aPort;
+        service.mHostName = hostName;
+    }
+
+exit:
+
+    if (error != kDNSServiceErr_NoError)
+    {
+        ret = OTBR_ERROR_MDNS;
+        otbrLog(OTBR_LOG_ERR, "Failed to publish service for mdnssd error: %s!", DNSErrorToString(error));
+    }
+
+    return ret;
+}
+
+void PublisherMDnsSd::DoUnpublishService(ServiceHandle aHandle)
+{
+    Services::iterator it = mServices.find(aHandle);
+
+    VerifyOrExit(it != mServices.end());
+
+    otbrLog(OTBR_LOG_INFO, "MDNS remove service %s", it->second.mName);
+    RemoveServiceRef(it->second.mService);
+    mServices.erase(it);
+
+exit:
+    return;
+}
+
+std::string PublisherMDnsSd::GetHostFullName(const char *aHostName) const
+{
+    return std::string(aHostName) + "." + (mDomain != nullptr ? mDomain : "local") + ".";
+}
+
+otbrError PublisherMDnsSd::DoPublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses)
+{
+    otbrError                  ret          = OTBR_ERROR_NONE;
+    DNSServiceErrorType        error        = kDNSServiceErr_NoError;
+    std::string                fullHostName = GetHostFullName(aName);
+    std::vector<DNSRecordRef> &records      = mHostRecords[aName];
+
+    // Records can only be registered with a connection, the shared one is used if any.
+    if (mHostConnection == nullptr)
+    {
+        if (mConnection != nullptr)
+        {
+            mHostConnection = mConnection;
+        }
+        else
         {
-            otbrLog(OTBR_LOG_INFO, "MDNS remove current service %s", aName);
-            DNSServiceUpdateRecord(it->mService, nullptr, 0, static_cast<uint16_t>(cur - txt), txt, 0);
-            ExitNow();
+            SuccessOrExit(error = DNSServiceCreateConnection(&mHostConnection));
+            AddServiceRef(mHostConnection);
         }
     }
 
-    SuccessOrExit(error = DNSServiceRegister(&serviceRef, 0, kDNSServiceInterfaceIndexAny, aName, aType, mDomain, mHost,
-                                             htons(aPort), static_cast<uint16_t>(cur - txt), txt,
-                                             HandleServiceRegisterResult, this));
-    if (serviceRef != nullptr)
+    // The records of the previous addresses are replaced, as a host has few addresses.
+    RemoveHostRecords(records);
+
+    otbrLog(OTBR_LOG_INFO, "MDNS publish host %s with %zu addresses", aName, aAddresses.size());
+
+    for (const Ip6Address &address : aAddresses)
     {
-        RecordService(aName, aType, serviceRef);
+        DNSRecordRef record = nullptr;
+
+        SuccessOrExit(error = DNSServiceRegisterRecord(mHostConnection, &record, kDNSServiceFlagsUnique,
+                                                       kDNSServiceInterfaceIndexAny, fullHostName.c_str(),
+                                                       kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8),
+                                                       address.m8, 0, HandleRegisterRecordResult, this));
+        records.push_back(record);
     }
 
 exit:
+    if (error != kDNSServiceErr_NoError)
+    {
+        // A host is published with all its addresses or not at all.
+        RemoveHostRecords(records);
+        mHostRecords.erase(aName);
 
+        ret = OTBR_ERROR_MDNS;
+        otbrLog(OTBR_LOG_ERR, "Failed to publish host for mdnssd error: %s!", DNSErrorToString(error));
+    }
+
+    return ret;
+}
+
+void PublisherMDnsSd::DoUnpublishHost(const char *aName)
+{
+    auto it = mHostRecords.find(aName);
+
+    VerifyOrExit(it != mHostRecords.end());
+
+    otbrLog(OTBR_LOG_INFO, "MDNS remove host %s", aName);
+    RemoveHostRecords(it->second);
+    mHostRecords.erase(it);
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::RemoveHostRecords(std::vector<DNSRecordRef> &aRecords)
+{
+    for (DNSRecordRef record : aRecords)
+    {
+        DNSServiceRemoveRecord(mHostConnection, record, 0);
+    }
+
+    aRecords.clear();
+}
+
+void PublisherMDnsSd::HandleRegisterRecordResult(DNSServiceRef       aServiceRef,
+                                                 DNSRecordRef        aRecordRef,
+                                                 DNSServiceFlags     aFlags,
+                                                 DNSServiceErrorType aError,
+                                                 void *              aContext)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aRecordRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aContext);
+
+    if (aError != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to register host record: %s!", DNSErrorToString(aError));
+    }
+}
+
+otbrError PublisherMDnsSd::DoBrowse(const char *aType)
+{
+    DNSServiceErrorType             error = kDNSServiceErr_NoError;
+    std::unique_ptr<ServiceBrowser> browser;
+
+    // Browsing starts when the publisher is started.
+    VerifyOrExit(mState == kStateReady);
+    VerifyOrExit(!mServiceBrowsers.count(aType));
+
+    browser.reset(new ServiceBrowser{this, aType, nullptr});
+    SuccessOrExit(error = DNSServiceBrowse(&browser->mServiceRef, PrepareServiceRef(browser->mServiceRef),
+                                           kDNSServiceInterfaceIndexAny, aType, mDomain, HandleBrowseResult,
+                                           browser.get()));
+    AddServiceRef(browser->mServiceRef);
+
+    otbrLog(OTBR_LOG_INFO, "MDNS browse %s", aType);
+    mServiceBrowsers[aType] = std::move(browser);
+
+exit:
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to browse %s: %s!", aType, DNSErrorToString(error));
+    }
+
+    return error == kDNSServiceErr_NoError ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
+}
+
+void PublisherMDnsSd::DoStopBrowse(const char *aType)
+{
+    ServiceBrowsers::iterator it = mServiceBrowsers.find(aType);
+
+    VerifyOrExit(it != mServiceBrowsers.end());
+
+    RemoveServiceRef(it->second->mServiceRef);
+    mServiceBrowsers.erase(it);
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::HandleBrowseResult(DNSServiceRef       aServiceRef,
+                                         DNSServiceFlags     aFlags,
+                                         uint32_t            aInterfaceIndex,
+                                         DNSServiceErrorType aError,
+                                         const char *        aName,
+                                         const char *        aType,
+                                         const char *        aDomain,
+                                         void *              aContext)
+{
+    ServiceBrowser *browser = static_cast<ServiceBrowser *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    browser->mPublisher->HandleBrowseResult(*browser, aFlags, aError, aName);
+}
+
+void PublisherMDnsSd::HandleBrowseResult(ServiceBrowser &    aBrowser,
+                                         DNSServiceFlags     aFlags,
+                                         DNSServiceErrorType aError,
+                                         const char *        aName)
+{
+    if (aError != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to browse %s: %s!", aBrowser.mType.c_str(), DNSErrorToString(aError));
+    }
+    else if (aFlags & kDNSServiceFlagsAdd)
+    {
+        HandleServiceFound(aBrowser.mType.c_str(), aName);
+    }
+    else
+    {
+        HandleServiceRemoved(aBrowser.mType.c_str(), aName);
+    }
+}
+
+otbrError PublisherMDnsSd::DoResolve(const char *aName, const char *aType)
+{
+    otbrError                        ret   = OTBR_ERROR_NONE;
+    DNSServiceErrorType              error = kDNSServiceErr_NoError;
+    std::unique_ptr<ServiceResolver> resolver;
+
+    VerifyOrExit(mState == kStateReady, errno = EAGAIN, ret = OTBR_ERROR_ERRNO);
+
+    resolver.reset(new ServiceResolver{this, aName, aType, nullptr, DiscoveredInstanceInfo()});
+    SuccessOrExit(error = DNSServiceResolve(&resolver->mServiceRef, PrepareServiceRef(resolver->mServiceRef),
+                                            kDNSServiceInterfaceIndexAny, aName, aType,
+                                            mDomain != nullptr ? mDomain : "local.", HandleResolveResult,
+                                            resolver.get()));
+    AddServiceRef(resolver->mServiceRef);
+
+    otbrLog(OTBR_LOG_INFO, "MDNS resolve %s.%s", aName, aType);
+    mServiceResolvers[ServiceKey(aName, aType)] = std::move(resolver);
+
+exit:
     if (error != kDNSServiceErr_NoError)
     {
         ret = OTBR_ERROR_MDNS;
-        otbrLog(OTBR_LOG_ERR, "Failed to publish service for mdnssd error: %s!", DNSErrorToString(error));
+        otbrLog(OTBR_LOG_ERR, "Failed to resolve %s: %s!", aName, DNSErrorToString(error));
     }
 
     return ret;
 }
 
+void PublisherMDnsSd::DoStopResolve(const char *aName, const char *aType)
+{
+    ServiceResolvers::iterator it = mServiceResolvers.find(ServiceKey(aName, aType));
+
+    VerifyOrExit(it != mServiceResolvers.end());
+
+    RemoveServiceRef(it->second->mServiceRef);
+    mServiceResolvers.erase(it);
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::HandleResolveResult(DNSServiceRef        aServiceRef,
+                                          DNSServiceFlags      aFlags,
+                                          uint32_t             aInterfaceIndex,
+                                          DNSServiceErrorType  aError,
+                                          const char *         aFullName,
+                                          const char *         aHostTarget,
+                                          uint16_t             aPort,
+                                          uint16_t             aTxtLength,
+                                          const unsigned char *aTxtRecord,
+                                          void *               aContext)
+{
+    ServiceResolver *resolver = static_cast<ServiceResolver *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aFullName);
+
+    resolver->mPublisher->HandleResolveResult(*resolver, aInterfaceIndex, aError, aHostTarget, aPort, aTxtLength,
+                                              aTxtRecord);
+}
+
+void PublisherMDnsSd::HandleResolveResult(ServiceResolver &    aResolver,
+                                          uint32_t             aInterfaceIndex,
+                                          DNSServiceErrorType  aError,
+                                          const char *         aHostTarget,
+                                          uint16_t             aPort,
+                                          uint16_t             aTxtLength,
+                                          const unsigned char *aTxtRecord)
+{
+    DNSServiceRef addrInfoRef = nullptr;
+
+    SuccessOrExit(aError);
+
+    aResolver.mInstance.mName     = aResolver.mName;
+    aResolver.mInstance.mHostName = aHostTarget;
+    aResolver.mInstance.mPort     = ntohs(aPort);
+    aResolver.mInstance.mTxtList.clear();
+
+    for (uint16_t offset = 0; offset < aTxtLength; offset += 1 + aTxtRecord[offset])
+    {
+        uint8_t length = aTxtRecord[offset];
+
+        VerifyOrExit(offset + 1 + length <= aTxtLength, aError = kDNSServiceErr_Invalid);
+        AppendTxtEntry(aTxtRecord + offset + 1, length, aResolver.mInstance.mTxtList);
+    }
+
+    // Go on resolving the addresses of the host, the reference of the instance is not needed any more.
+    SuccessOrExit(aError = DNSServiceGetAddrInfo(&addrInfoRef, PrepareServiceRef(addrInfoRef), aInterfaceIndex,
+                                                 kDNSServiceProtocol_IPv6, aHostTarget, HandleAddrInfoResult,
+                                                 &aResolver));
+    AddServiceRef(addrInfoRef);
+    RemoveServiceRef(aResolver.mServiceRef);
+    aResolver.mServiceRef = addrInfoRef;
+
+exit:
+    if (aError != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to resolve %s: %s!", aResolver.mName.c_str(), DNSErrorToString(aError));
+        HandleServiceResolveFailed(aResolver.mType.c_str(), aResolver.mName.c_str());
+    }
+}
+
+void PublisherMDnsSd::HandleAddrInfoResult(DNSServiceRef          aServiceRef,
+                                           DNSServiceFlags        aFlags,
+                                           uint32_t               aInterfaceIndex,
+                                           DNSServiceErrorType    aError,
+                                           const char *           aHostName,
+                                           const struct sockaddr *aAddress,
+                                           uint32_t               aTtl,
+                                           void *                 aContext)
+{
+    ServiceResolver *resolver = static_cast<ServiceResolver *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aHostName);
+
+    resolver->mPublisher->HandleAddrInfoResult(*resolver, aFlags, aError, aAddress, aTtl);
+}
+
+void PublisherMDnsSd::HandleAddrInfoResult(ServiceResolver &      aResolver,
+                                           DNSServiceFlags        aFlags,
+                                           DNSServiceErrorType    aError,
+                                           const struct sockaddr *aAddress,
+                                           uint32_t               aTtl)
+{
+    DiscoveredInstanceInfo &instance = aResolver.mInstance;
+
+    if (aError != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to resolve %s: %s!", instance.mHostName.c_str(), DNSErrorToString(aError));
+        HandleServiceResolveFailed(aResolver.mType.c_str(), aResolver.mName.c_str());
+        ExitNow();
+    }
+
+    if ((aFlags & kDNSServiceFlagsAdd) && aAddress != nullptr && aAddress->sa_family == AF_INET6)
+    {
+        const ::sockaddr_in6 *address = reinterpret_cast<const ::sockaddr_in6 *>(aAddress);
+
+        // The instance is valid as long as its shortest lived record.
+        if (instance.mAddresses.empty() || aTtl < instance.mTtl)
+        {
+            instance.mTtl = aTtl;
+        }
+
+        instance.mAddresses.push_back(Ip6Address(address->sin6_addr.s6_addr));
+    }
+
+    // The resolver is freed when the result is handled.
+    VerifyOrExit(!(aFlags & kDNSServiceFlagsMoreComing) && !instance.mAddresses.empty());
+    HandleServiceResolved(aResolver.mType.c_str(), instance);
+
+exit:
+    return;
+}
+
 Publisher *Publisher::Create(int aFamily, const char *aHost, const char *aDomain, StateHandler aHandler, void *aContext)
 {
     return new PublisherMDnsSd(aFamily, aHost, aDomain, aHandler, aContext);
@@ -34,6 +34,10 @@
 #ifndef OTBR_AGENT_MDNS_MDNSSD_HPP_
 #define OTBR_AGENT_MDNS_MDNSSD_HPP_
 
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <dns_sd.h>
@@ -67,23 +71,6 @@ public:
 
     ~PublisherMDnsSd(void);
 
-    /**
-     * This method publishes or updates a service.
-     *
-     * @note only text record can be updated.
-     *
-     * @param[in]   aName               The name of this service.
-     * @param[in]   aType               The type of this service.
-     * @param[in]   aPort               The port number of this service.
-     * @param[in]   ...                 Pointers to null-terminated string of key and value for text record.
-     *                                  The last argument must be nullptr.
-     *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
-     *
-     */
-    otbrError PublishService(uint16_t aPort, const char *aName, const char *aType, ...);
-
     /**
      * This method starts the MDNS service.
      *
@@ -130,24 +117,22 @@ public:
      */
     void UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout);
 
-private:
-    void DiscardService(const char *aName, const char *aType, DNSServiceRef aServiceRef);
-    void RecordService(const char *aName, const char *aType, DNSServiceRef aServiceRef);
-
-    static void HandleServiceRegisterResult(DNSServiceRef         aService,
-                                            const DNSServiceFlags aFlags,
-                                            DNSServiceErrorType   aError,
-                                            const char *          aName,
-                                            const char *          aType,
-                                            const char *          aDomain,
-                                            void *                aContext);
-    void        HandleServiceRegisterResult(DNSServiceRef         aService,
-                                            const DNSServiceFlags aFlags,
-                                            DNSServiceErrorType   aError,
-                                            const char *          aName,
-                                            const char *          aType,
-                                            const char *          aDomain);
+protected:
+    otbrError DoPublishService(ServiceHandle  aHandle,
+                               const char *   aHostName,
+                               uint16_t       aPort,
+                               const char *   aName,
+                               const char *   aType,
+                               const TxtList &aTxtList);
+    void      DoUnpublishService(ServiceHandle aHandle);
+    otbrError DoPublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses);
+    void      DoUnpublishHost(const char *aName);
+    otbrError DoBrowse(const char *aType);
+    void      DoStopBrowse(const char *aType);
+    otbrError DoResolve(const char *aName, const char *aType);
+    void      DoStopResolve(const char *aName, const char *aType);
 
+private:
     enum
     {
         kMaxSizeOfTxtRecord   = 128,
@@ -160,19 +145,125 @@ private:
 
     struct Service
     {
-        char          mName[kMaxSizeOfServiceName];
-        char          mType[kMaxSizeOfServiceType];
+        char          mName[kMaxSizeOfServiceName]; ///< The name for logging.
         DNSServiceRef mService;
+        uint16_t      mPort;
+        std::string   mHostName;
+    };
+
+    typedef std::unordered_map<ServiceHandle, Service> Services;
+
+    struct ServiceBrowser
+    {
+        PublisherMDnsSd *mPublisher;
+        std::string      mType;
+        DNSServiceRef    mServiceRef;
+    };
+
+    struct ServiceResolver
+    {
+        PublisherMDnsSd *      mPublisher;
+        std::string            mName;
+        std::string            mType;
+        DNSServiceRef          mServiceRef; ///< Resolving the instance, and then the addresses of its host.
+        DiscoveredInstanceInfo mInstance;
     };
 
-    typedef std::vector<Service> Services;
+    typedef std::unordered_map<std::string, std::unique_ptr<ServiceBrowser>>  ServiceBrowsers;
+    typedef std::unordered_map<std::string, std::unique_ptr<ServiceResolver>> ServiceResolvers;
+
+    struct PolledServiceRef
+    {
+        DNSServiceRef mServiceRef;
+        bool          mPolled; ///< Whether the socket has been added to the fd_set being processed.
+    };
+
+    typedef std::map<int, PolledServiceRef> PolledServiceRefs;
+
+    static void HandleBrowseResult(DNSServiceRef       aServiceRef,
+                                   DNSServiceFlags     aFlags,
+                                   uint32_t            aInterfaceIndex,
+                                   DNSServiceErrorType aError,
+                                   const char *        aName,
+                                   const char *        aType,
+                                   const char *        aDomain,
+                                   void *              aContext);
+    void        HandleBrowseResult(ServiceBrowser &    aBrowser,
+                                   DNSServiceFlags     aFlags,
+                                   DNSServiceErrorType aError,
+                                   const char *        aName);
+    static void HandleResolveResult(DNSServiceRef        aServiceRef,
+                                    DNSServiceFlags      aFlags,
+                                    uint32_t             aInterfaceIndex,
+                                    DNSServiceErrorType  aError,
+                                    const char *         aFullName,
+                                    const char *         aHostTarget,
+                                    uint16_t             aPort,
+                                    uint16_t             aTxtLength,
+                                    const unsigned char *aTxtRecord,
+                                    void *               aContext);
+    void        HandleResolveResult(ServiceResolver &    aResolver,
+                                    uint32_t             aInterfaceIndex,
+                                    DNSServiceErrorType  aError,
+                                    const char *         aHostTarget,
+                                    uint16_t             aPort,
+                                    uint16_t             aTxtLength,
+                                    const unsigned char *aTxtRecord);
+    static void HandleAddrInfoResult(DNSServiceRef          aServiceRef,
+                                     DNSServiceFlags        aFlags,
+                                     uint32_t               aInterfaceIndex,
+                                     DNSServiceErrorType    aError,
+                                     const char *           aHostName,
+                                     const struct sockaddr *aAddress,
+                                     uint32_t               aTtl,
+                                     void *                 aContext);
+    void        HandleAddrInfoResult(ServiceResolver &      aResolver,
+                                     DNSServiceFlags        aFlags,
+                                     DNSServiceErrorType    aError,
+                                     const struct sockaddr *aAddress,
+                                     uint32_t               aTtl);
+
+    DNSServiceFlags PrepareServiceRef(DNSServiceRef &aServiceRef) const;
+    void            AddServiceRef(DNSServiceRef aServiceRef);
+    void            RemoveServiceRef(DNSServiceRef aServiceRef);
+
+    Services::iterator FindService(DNSServiceRef aServiceRef);
+    void               DiscardService(DNSServiceRef aServiceRef);
+    std::string        GetHostFullName(const char *aHostName) const;
+    void               RemoveHostRecords(std::vector<DNSRecordRef> &aRecords);
+
+    static void HandleRegisterRecordResult(DNSServiceRef       aServiceRef,
+                                           DNSRecordRef        aRecordRef,
+                                           DNSServiceFlags     aFlags,
+                                           DNSServiceErrorType aError,
+                                           void *              aContext);
+
+    static void HandleServiceRegisterResult(DNSServiceRef         aService,
+                                            const DNSServiceFlags aFlags,
+                                            DNSServiceErrorType   aError,
+                                            const char *          aName,
+                                            const char *          aType,
+                                            const char *          aDomain,
+                                            void *                aContext);
+    void        HandleServiceRegisterResult(DNSServiceRef         aService,
+                                            const DNSServiceFlags aFlags,
+                                            DNSServiceErrorType   aError,
+                                            const char *          aName,
+                                            const char *          aType,
+                                            const char *          aDomain);
 
-    Services     mServices;
-    const char * mHost;
-    const char * mDomain;
-    State        mState;
-    StateHandler mStateHandler;
-    void *       mContext;
+    Services          mServices;
+    ServiceBrowsers   mServiceBrowsers;   ///< The browsers by type.
+    ServiceResolvers  mServiceResolvers;  ///< The resolvers by key.
+    PolledServiceRefs mPolledServiceRefs; ///< The references owning a socket, by socket.
+    DNSServiceRef     mConnection;        ///< The connection shared by all references, or nullptr.
+    DNSServiceRef     mHostConnection;    ///< The connection the host records are registered with, or nullptr.
+    std::unordered_map<std::string, std::vector<DNSRecordRef>> mHostRecords; ///< The address records by host name.
+    const char *      mHost;
+    const char *      mDomain;
+    State             mState;
+    StateHandler      mStateHandler;
+    void *            mContext;
 };
 
 /**
@@ -32,7 +32,8 @@
 
 #include "openwrt/ubus/otubus.hpp"
 
-#include <mutex>
+#include <errno.h>
+#include <string.h>
 
 #include <sys/eventfd.h>
 
@@ -42,6 +43,10 @@
 
 #include "agent/ncp_openthread.hpp"
 #include "common/logging.hpp"
+#include "common/metrics_registry.hpp"
+#if OTBR_ENABLE_REST_SERVER
+#include "rest/rest_web_server.hpp"
+#endif
 
 #include <unistd.h>
 
@@ -52,24 +57,63 @@ static UbusServer *sUbusServerInstance = nullptr;
 static int         sUbusEfd            = -1;
 static void *      sJsonUri            = nullptr;
 static int         sBufNum;
-static std::mutex *sNcpThreadMutex;
 
 const static int PANID_LENGTH     = 10;
 const static int XPANID_LENGTH    = 64;
 const static int MASTERKEY_LENGTH = 64;
 
+const UbusServer::GetInformationAction UbusServer::kGetInformationActions[] = {
+    {"networkname", &UbusServer::RenderNetworkName, OT_CHANGED_THREAD_NETWORK_NAME},
+    {"state", &UbusServer::RenderState, OT_CHANGED_THREAD_ROLE},
+    {"channel", &UbusServer::RenderChannel, OT_CHANGED_THREAD_CHANNEL},
+    {"panid", &UbusServer::RenderPanId, OT_CHANGED_THREAD_PANID},
+    {"rloc16", &UbusServer::RenderRloc16,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED},
+    // The secrets are not kept in the cache, they are read from the instance for each request.
+    {"masterkey", &UbusServer::RenderMasterkey, 0},
+    {"pskc", &UbusServer::RenderPskc, 0},
+    {"extpanid", &UbusServer::RenderExtPanId, OT_CHANGED_THREAD_EXT_PANID},
+    {"mode", &UbusServer::RenderMode, OT_CHANGED_THREAD_LINK_MODE},
+    {"partitionid", &UbusServer::RenderPartitionId, OT_CHANGED_THREAD_PARTITION_ID},
+    {"leaderdata", &UbusServer::RenderLeaderData,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA},
+    {"joinernum", &UbusServer::RenderJoinerNum, 0},
+    {"macfilterstate", &UbusServer::RenderMacfilterState, 0},
+    {"macfilteraddr", &UbusServer::RenderMacfilterAddr, 0},
+};
+
 UbusServer::UbusServer(Ncp::ControllerOpenThread *aController)
     : mIfFinishScan(false)
+    , mScanError(OT_ERROR_NONE)
     , mContext(nullptr)
     , mSockPath(nullptr)
     , mController(aController)
     , mSecond(0)
+    , mScanList(nullptr)
+#if OTBR_ENABLE_UBUS_INLINE
+    , mReconnectTimer(HandleReconnectTimer, this)
+#endif
+    , mCachedReplies(ARRAY_SIZE(kGetInformationActions))
+    , mHasSubscribers(false)
 {
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
     memset(&mBuf, 0, sizeof(mBuf));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
+    memset(&mNotificationBuf, 0, sizeof(mNotificationBuf));
+    memset(&mNotificationFd, 0, sizeof(mNotificationFd));
 
     blob_buf_init(&mBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
+    blob_buf_init(&mScanBuf, 0);
+    blob_buf_init(&mNotificationBuf, 0);
+
+#if OTBR_ENABLE_UBUS_INLINE
+    // The notifications are sent by the mainloop.
+    mNotificationFd.fd = -1;
+#else
+    mNotificationFd.cb = &UbusServer::HandleNotificationEvent;
+    mNotificationFd.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
 }
 
 UbusServer &UbusServer::GetInstance(void)
@@ -80,8 +124,21 @@ UbusServer &UbusServer::GetInstance(void)
 void UbusServer::Initialize(Ncp::ControllerOpenThread *aController)
 {
     sUbusServerInstance = new UbusServer(aController);
+#if !OTBR_ENABLE_REST_SERVER
+    // The REST server owns the diagnostic responses when enabled, the network data is read from its diagnostics.
     otThreadSetReceiveDiagnosticGetCallback(aController->GetInstance(), &UbusServer::HandleDiagnosticGetResponse,
                                             sUbusServerInstance);
+#endif
+    aController->AddThreadStateChangedCallback(
+        [](otChangedFlags aFlags) { GetInstance().HandleThreadStateChanged(aFlags); });
+    aController->RegisterResetHandler([]() {
+#if !OTBR_ENABLE_REST_SERVER
+        // The instance callbacks are lost with the reinitialized instance.
+        otThreadSetReceiveDiagnosticGetCallback(GetInstance().mController->GetInstance(),
+                                                &UbusServer::HandleDiagnosticGetResponse, sUbusServerInstance);
+#endif
+        GetInstance().HandleThreadStateChanged(~static_cast<otChangedFlags>(0));
+    });
 }
 
 enum
@@ -262,7 +319,7 @@ static struct ubus_object otbr = {
     id : 0,
     path : nullptr,
     type : &otbrObjType,
-    subscribe_cb : nullptr,
+    subscribe_cb : UbusServer::HandleSubscribersChanged,
     has_subscribers : false,
     methods : otbrMethods,
     n_methods : ARRAY_SIZE(otbrMethods),
@@ -270,21 +327,71 @@ static struct ubus_object otbr = {
 
 void UbusServer::ProcessScan(void)
 {
-    otError  error        = OT_ERROR_NONE;
-    uint32_t scanChannels = 0;
-    uint16_t scanDuration = 0;
+    auto handleScanDone = [this](otError aError, const std::vector<otActiveScanResult> &) {
+        if (aError != OT_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "active scan failed: %s", otThreadErrorToString(aError));
+        }
 
-    sNcpThreadMutex->lock();
-    SuccessOrExit(error = otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration,
-                                           &UbusServer::HandleActiveScanResult, this));
-exit:
-    sNcpThreadMutex->unlock();
-    return;
+        {
+            std::lock_guard<std::mutex> lock(mScanMutex);
+
+            mScanError = aError;
+        }
+        HandleActiveScanResultDetail(nullptr);
+    };
+    auto handleScanResult = [this](const otActiveScanResult &aResult) { HandleActiveScanResultDetail(&aResult); };
+
+    // The scan results are waited for on the ubus thread, so only the scan request runs on the mainloop.
+    Enqueue([this, handleScanDone, handleScanResult]() {
+        mController->GetThreadHelper()->Scan(handleScanDone, handleScanResult);
+    });
 }
 
-void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
+void UbusServer::Enqueue(std::function<void(void)> aTask)
 {
-    static_cast<UbusServer *>(aContext)->HandleActiveScanResultDetail(aResult);
+#if OTBR_ENABLE_UBUS_INLINE
+    // The handlers already run on the mainloop.
+    aTask();
+#else
+    uint64_t eventNum = 1;
+
+    {
+        std::lock_guard<std::mutex> lock(mTasksMutex);
+
+        mTasks.push_back(std::move(aTask));
+    }
+
+    if (write(sUbusEfd, &eventNum, sizeof(uint64_t)) != sizeof(uint64_t))
+    {
+        otbrLog(OTBR_LOG_ERR, "failed to wake up the mainloop: %s", strerror(errno));
+    }
+#endif
+}
+
+void UbusServer::ProcessTasks(void)
+{
+    std::vector<std::function<void(void)>> tasks;
+
+    {
+        std::lock_guard<std::mutex> lock(mTasksMutex);
+
+        tasks.swap(mTasks);
+    }
+
+    for (std::function<void(void)> &task : tasks)
+    {
+        task();
+    }
+}
+
+int UbusServer::RunOnMainloop(std::function<int(void)> aHandler)
+{
+#if OTBR_ENABLE_UBUS_INLINE
+    return aHandler();
+#else
+    return GetInstance().Post<int>(std::move(aHandler)).get();
+#endif
 }
 
 void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
@@ -297,13 +404,57 @@ void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutp
     }
 }
 
+void UbusServer::AddHexString(const char *aName, const uint8_t *aBytes, uint8_t aLength)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+    char *            output       = static_cast<char *>(blobmsg_alloc_string_buffer(&mBuf, aName, aLength * 2U + 1));
+
+    VerifyOrExit(output != nullptr);
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        *output++ = kHexDigits[aBytes[i] >> 4];
+        *output++ = kHexDigits[aBytes[i] & 0x0f];
+    }
+    *output = '\0';
+
+    blobmsg_add_string_buffer(&mBuf);
+
+exit:
+    return;
+}
+
+void UbusServer::AddMode(bool aRxOnWhenIdle, bool aFullThreadDevice, bool aFullNetworkData)
+{
+    char   mode[4];
+    size_t length = 0;
+
+    if (aRxOnWhenIdle)
+    {
+        mode[length++] = 'r';
+    }
+
+    if (aFullThreadDevice)
+    {
+        mode[length++] = 'd';
+    }
+
+    if (aFullNetworkData)
+    {
+        mode[length++] = 'n';
+    }
+    mode[length] = '\0';
+
+    blobmsg_add_string(&mBuf, "Mode", mode);
+}
+
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
 {
     blobmsg_add_u16(&mBuf, "Error", aError);
     ubus_send_reply(aContext, aRequest, mBuf.head);
 }
 
-void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
+void UbusServer::HandleActiveScanResultDetail(const otActiveScanResult *aResult)
 {
     void *jsonList = nullptr;
 
@@ -312,30 +463,47 @@ void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
-        mIfFinishScan = true;
+        blobmsg_close_array(&mScanBuf, mScanList);
+
+#if OTBR_ENABLE_UBUS_INLINE
+        blobmsg_add_u16(&mScanBuf, "Error", mScanError);
+
+        for (struct ubus_request_data &request : mScanRequests)
+        {
+            ubus_send_reply(mContext, &request, mScanBuf.head);
+            ubus_complete_deferred_request(mContext, &request, UBUS_STATUS_OK);
+        }
+        mScanRequests.clear();
+#else
+        {
+            std::lock_guard<std::mutex> lock(mScanMutex);
+
+            mIfFinishScan = true;
+        }
+        mScanFinished.notify_all();
+#endif
         goto exit;
     }
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    jsonList = blobmsg_open_table(&mScanBuf, nullptr);
 
-    blobmsg_add_u32(&mBuf, "IsJoinable", aResult->mIsJoinable);
+    blobmsg_add_u32(&mScanBuf, "IsJoinable", aResult->mIsJoinable);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    blobmsg_add_string(&mScanBuf, "NetworkName", aResult->mNetworkName.m8);
 
     OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    blobmsg_add_string(&mScanBuf, "ExtendedPanId", xpanidstring);
 
     sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_string(&mScanBuf, "PanId", panidstring);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    blobmsg_add_u32(&mScanBuf, "Channel", aResult->mChannel);
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+    blobmsg_add_u32(&mScanBuf, "Rssi", aResult->mRssi);
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
+    blobmsg_add_u32(&mScanBuf, "Lqi", aResult->mLqi);
 
-    blobmsg_close_table(&mBuf, jsonList);
+    blobmsg_close_table(&mScanBuf, jsonList);
 
 exit:
     return;
@@ -360,31 +528,40 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
-
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+#if OTBR_ENABLE_UBUS_INLINE
+    struct ubus_request_data request;
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
+    // The mainloop can't wait for the scan, the requests received meanwhile are all replied once it ends.
+    ubus_defer_request(aContext, aRequest, &request);
+    mScanRequests.push_back(request);
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
+    if (mScanRequests.size() == 1)
     {
-        error = OT_ERROR_FAILED;
-        goto exit;
+        blob_buf_init(&mScanBuf, 0);
+        mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
+
+        ProcessScan();
     }
+#else
+    otError error = OT_ERROR_NONE;
+
+    blob_buf_init(&mScanBuf, 0);
+    mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
+
+    mIfFinishScan = false;
+
+    ProcessScan();
 
-    while (!mIfFinishScan)
     {
-        sleep(1);
+        std::unique_lock<std::mutex> lock(mScanMutex);
+
+        mScanFinished.wait(lock, [this]() { return mIfFinishScan; });
+        error = mScanError;
     }
 
-exit:
-    AppendResult(error, aContext, aRequest);
+    blobmsg_add_u16(&mScanBuf, "Error", error);
+    ubus_send_reply(aContext, aRequest, mScanBuf.head);
+#endif
     return 0;
 }
 
@@ -403,7 +580,8 @@ int UbusServer::UbusSetChannelHandler(struct ubus_context *     aContext,
                                       const char *              aMethod,
                                       struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "channel");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "channel"); });
 }
 
 int UbusServer::UbusJoinerNumHandler(struct ubus_context *     aContext,
@@ -430,7 +608,8 @@ int UbusServer::UbusSetNetworknameHandler(struct ubus_context *     aContext,
                                           const char *              aMethod,
                                           struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkname");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkname"); });
 }
 
 int UbusServer::UbusStateHandler(struct ubus_context *     aContext,
@@ -466,7 +645,8 @@ int UbusServer::UbusSetPanIdHandler(struct ubus_context *     aContext,
                                     const char *              aMethod,
                                     struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "panid");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "panid"); });
 }
 
 int UbusServer::UbusExtPanIdHandler(struct ubus_context *     aContext,
@@ -484,7 +664,8 @@ int UbusServer::UbusSetExtPanIdHandler(struct ubus_context *     aContext,
                                        const char *              aMethod,
                                        struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "extpanid");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "extpanid"); });
 }
 
 int UbusServer::UbusPskcHandler(struct ubus_context *     aContext,
@@ -502,7 +683,8 @@ int UbusServer::UbusSetPskcHandler(struct ubus_context *     aContext,
                                    const char *              aMethod,
                                    struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "pskc");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "pskc"); });
 }
 
 int UbusServer::UbusMasterkeyHandler(struct ubus_context *     aContext,
@@ -520,7 +702,8 @@ int UbusServer::UbusSetMasterkeyHandler(struct ubus_context *     aContext,
                                         const char *              aMethod,
                                         struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "masterkey");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "masterkey"); });
 }
 
 int UbusServer::UbusThreadStartHandler(struct ubus_context *     aContext,
@@ -529,7 +712,8 @@ int UbusServer::UbusThreadStartHandler(struct ubus_context *     aContext,
                                        const char *              aMethod,
                                        struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusThreadHandler(aContext, aObj, aRequest, aMethod, aMsg, "start");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusThreadHandler(aContext, aObj, aRequest, aMethod, aMsg, "start"); });
 }
 
 int UbusServer::UbusThreadStopHandler(struct ubus_context *     aContext,
@@ -538,7 +722,8 @@ int UbusServer::UbusThreadStopHandler(struct ubus_context *     aContext,
                                       const char *              aMethod,
                                       struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusThreadHandler(aContext, aObj, aRequest, aMethod, aMsg, "stop");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusThreadHandler(aContext, aObj, aRequest, aMethod, aMsg, "stop"); });
 }
 
 int UbusServer::UbusParentHandler(struct ubus_context *     aContext,
@@ -574,7 +759,8 @@ int UbusServer::UbusSetModeHandler(struct ubus_context *     aContext,
                                    const char *              aMethod,
                                    struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "mode");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "mode"); });
 }
 
 int UbusServer::UbusPartitionIdHandler(struct ubus_context *     aContext,
@@ -592,7 +778,8 @@ int UbusServer::UbusLeaveHandler(struct ubus_context *     aContext,
                                  const char *              aMethod,
                                  struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusLeaveHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusLeaveHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg); });
 }
 
 int UbusServer::UbusLeaderdataHandler(struct ubus_context *     aContext,
@@ -610,7 +797,8 @@ int UbusServer::UbusNetworkdataHandler(struct ubus_context *     aContext,
                                        const char *              aMethod,
                                        struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkdata");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusNetworkdataHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg); });
 }
 
 int UbusServer::UbusCommissionerStartHandler(struct ubus_context *     aContext,
@@ -619,7 +807,8 @@ int UbusServer::UbusCommissionerStartHandler(struct ubus_context *     aContext,
                                              const char *              aMethod,
                                              struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "start");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "start"); });
 }
 
 int UbusServer::UbusJoinerRemoveHandler(struct ubus_context *     aContext,
@@ -628,7 +817,8 @@ int UbusServer::UbusJoinerRemoveHandler(struct ubus_context *     aContext,
                                         const char *              aMethod,
                                         struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joinerremove");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joinerremove"); });
 }
 
 int UbusServer::UbusMgmtsetHandler(struct ubus_context *     aContext,
@@ -637,7 +827,7 @@ int UbusServer::UbusMgmtsetHandler(struct ubus_context *     aContext,
                                    const char *              aMethod,
                                    struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusMgmtset(aContext, aObj, aRequest, aMethod, aMsg);
+    return RunOnMainloop([&]() { return GetInstance().UbusMgmtset(aContext, aObj, aRequest, aMethod, aMsg); });
 }
 
 int UbusServer::UbusJoinerAddHandler(struct ubus_context *     aContext,
@@ -646,7 +836,8 @@ int UbusServer::UbusJoinerAddHandler(struct ubus_context *     aContext,
                                      const char *              aMethod,
                                      struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joineradd");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joineradd"); });
 }
 
 int UbusServer::UbusMacfilterAddrHandler(struct ubus_context *     aContext,
@@ -673,7 +864,8 @@ int UbusServer::UbusMacfilterAddHandler(struct ubus_context *     aContext,
                                         const char *              aMethod,
                                         struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilteradd");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilteradd"); });
 }
 
 int UbusServer::UbusMacfilterRemoveHandler(struct ubus_context *     aContext,
@@ -682,7 +874,8 @@ int UbusServer::UbusMacfilterRemoveHandler(struct ubus_context *     aContext,
                                            const char *              aMethod,
                                            struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterremove");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterremove"); });
 }
 
 int UbusServer::UbusMacfilterSetStateHandler(struct ubus_context *     aContext,
@@ -691,7 +884,9 @@ int UbusServer::UbusMacfilterSetStateHandler(struct ubus_context *     aContext,
                                              const char *              aMethod,
                                              struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfiltersetstate");
+    return RunOnMainloop([&]() {
+        return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfiltersetstate");
+    });
 }
 
 int UbusServer::UbusMacfilterClearHandler(struct ubus_context *     aContext,
@@ -700,7 +895,8 @@ int UbusServer::UbusMacfilterClearHandler(struct ubus_context *     aContext,
                                           const char *              aMethod,
                                           struct blob_attr *        aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterclear");
+    return RunOnMainloop(
+        [&]() { return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterclear"); });
 }
 
 int UbusServer::UbusLeaveHandlerDetail(struct ubus_context *     aContext,
@@ -713,25 +909,11 @@ int UbusServer::UbusLeaveHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    sNcpThreadMutex->lock();
     otInstanceFactoryReset(mController->GetInstance());
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
-
     blob_buf_init(&mBuf, 0);
-
-exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -752,19 +934,16 @@ int UbusServer::UbusThreadHandler(struct ubus_context *     aContext,
 
     if (!strcmp(aAction, "start"))
     {
-        sNcpThreadMutex->lock();
         SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), true));
         SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), true));
     }
     else if (!strcmp(aAction, "stop"))
     {
-        sNcpThreadMutex->lock();
         SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), false));
         SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), false));
     }
 
 exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -779,30 +958,26 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError      error = OT_ERROR_NONE;
+    otError      error;
     otRouterInfo parentInfo;
-    char         extAddress[XPANID_LENGTH] = "";
-    char         transfer[XPANID_LENGTH]   = "";
-    void *       jsonList                  = nullptr;
-    void *       jsonArray                 = nullptr;
+    void *       jsonList  = nullptr;
+    void *       jsonArray = nullptr;
+
+    // Only the parent is copied on the mainloop, the reply is encoded on the ubus thread.
+    error = Post<otError>([this, &parentInfo]() {
+                return otThreadGetParentInfo(mController->GetInstance(), &parentInfo);
+            }).get();
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
-    SuccessOrExit(error = otThreadGetParentInfo(mController->GetInstance(), &parentInfo));
+    SuccessOrExit(error);
 
     jsonArray = blobmsg_open_array(&mBuf, "parent_list");
     jsonList  = blobmsg_open_table(&mBuf, "parent");
     blobmsg_add_string(&mBuf, "Role", "R");
-
-    sprintf(transfer, "0x%04x", parentInfo.mRloc16);
-    blobmsg_add_string(&mBuf, "Rloc16", transfer);
-
-    sprintf(transfer, "%3d", parentInfo.mAge);
-    blobmsg_add_string(&mBuf, "Age", transfer);
-
-    OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
-    blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+    blobmsg_printf(&mBuf, "Rloc16", "0x%04x", parentInfo.mRloc16);
+    blobmsg_printf(&mBuf, "Age", "%3d", parentInfo.mAge);
+    AddHexString("ExtAddress", parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8));
 
     blobmsg_add_u16(&mBuf, "LinkQualityIn", parentInfo.mLinkQualityIn);
 
@@ -810,7 +985,6 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
     blobmsg_close_array(&mBuf, jsonArray);
 
 exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return error;
 }
@@ -825,67 +999,36 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError                error = OT_ERROR_NONE;
-    otNeighborInfo         neighborInfo;
-    otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    char                   transfer[XPANID_LENGTH]   = "";
-    void *                 jsonList                  = nullptr;
-    char                   mode[5]                   = "";
-    char                   extAddress[XPANID_LENGTH] = "";
+    otError                               error    = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NodeState> state    = mController->GetNodeState();
+    void *                                jsonList = nullptr;
 
+    // The neighbor table of the node state snapshot is immutable, the reply is encoded without the mainloop.
     blob_buf_init(&mBuf, 0);
 
+    VerifyOrExit(state != nullptr, error = OT_ERROR_INVALID_STATE);
+
     sJsonUri = blobmsg_open_array(&mBuf, "neighbor_list");
 
-    sNcpThreadMutex->lock();
-    while (otThreadGetNextNeighborInfo(mController->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
+    for (const otNeighborInfo &neighborInfo : state->mNeighbors)
     {
         jsonList = blobmsg_open_table(&mBuf, nullptr);
 
         blobmsg_add_string(&mBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
-
-        sprintf(transfer, "0x%04x", neighborInfo.mRloc16);
-        blobmsg_add_string(&mBuf, "Rloc16", transfer);
-
-        sprintf(transfer, "%3d", neighborInfo.mAge);
-        blobmsg_add_string(&mBuf, "Age", transfer);
-
-        sprintf(transfer, "%8d", neighborInfo.mAverageRssi);
-        blobmsg_add_string(&mBuf, "AvgRssi", transfer);
-
-        sprintf(transfer, "%9d", neighborInfo.mLastRssi);
-        blobmsg_add_string(&mBuf, "LastRssi", transfer);
-
-        if (neighborInfo.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
-
-        if (neighborInfo.mFullThreadDevice)
-        {
-            strcat(mode, "d");
-        }
-
-        if (neighborInfo.mFullNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
-
-        OutputBytes(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8), extAddress);
-        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
-
+        blobmsg_printf(&mBuf, "Rloc16", "0x%04x", neighborInfo.mRloc16);
+        blobmsg_printf(&mBuf, "Age", "%3d", neighborInfo.mAge);
+        blobmsg_printf(&mBuf, "AvgRssi", "%8d", neighborInfo.mAverageRssi);
+        blobmsg_printf(&mBuf, "LastRssi", "%9d", neighborInfo.mLastRssi);
+        AddMode(neighborInfo.mRxOnWhenIdle, neighborInfo.mFullThreadDevice, neighborInfo.mFullNetworkData);
+        AddHexString("ExtAddress", neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8));
         blobmsg_add_u16(&mBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
 
         blobmsg_close_table(&mBuf, jsonList);
-
-        memset(mode, 0, sizeof(mode));
-        memset(extAddress, 0, sizeof(extAddress));
     }
 
     blobmsg_close_array(&mBuf, sJsonUri);
 
-    sNcpThreadMutex->unlock();
+exit:
 
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -981,7 +1124,6 @@ int UbusServer::UbusCommissioner(struct ubus_context *     aContext,
 
     otError error = OT_ERROR_NONE;
 
-    sNcpThreadMutex->lock();
 
     if (!strcmp(aAction, "start"))
     {
@@ -1047,7 +1189,6 @@ int UbusServer::UbusCommissioner(struct ubus_context *     aContext,
     }
 
 exit:
-    sNcpThreadMutex->unlock();
     blob_buf_init(&mBuf, 0);
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -1087,26 +1228,47 @@ void UbusServer::HandleJoinerEvent(otCommissionerJoinerEvent aEvent,
                                    const otExtAddress *      aJoinerId)
 {
     OT_UNUSED_VARIABLE(aJoinerInfo);
-    OT_UNUSED_VARIABLE(aJoinerId);
+
+    const char *event                   = nullptr;
+    char        joinerId[XPANID_LENGTH] = "";
 
     switch (aEvent)
     {
     case OT_COMMISSIONER_JOINER_START:
         otbrLog(OTBR_LOG_INFO, "joiner start");
+        event = "start";
         break;
     case OT_COMMISSIONER_JOINER_CONNECTED:
         otbrLog(OTBR_LOG_INFO, "joiner connected");
+        event = "connected";
         break;
     case OT_COMMISSIONER_JOINER_FINALIZE:
         otbrLog(OTBR_LOG_INFO, "joiner finalize");
+        event = "finalize";
         break;
     case OT_COMMISSIONER_JOINER_END:
         otbrLog(OTBR_LOG_INFO, "joiner end");
+        event = "end";
         break;
     case OT_COMMISSIONER_JOINER_REMOVED:
         otbrLog(OTBR_LOG_INFO, "joiner remove");
+        event = "removed";
         break;
     }
+
+    VerifyOrExit(event != nullptr && mHasSubscribers.load(std::memory_order_relaxed));
+
+    blob_buf_init(&mNotificationBuf, 0);
+    blobmsg_add_string(&mNotificationBuf, "Event", event);
+    if (aJoinerId != nullptr)
+    {
+        OutputBytes(aJoinerId->m8, sizeof(aJoinerId->m8), joinerId);
+        blobmsg_add_string(&mNotificationBuf, "JoinerId", joinerId);
+    }
+    Notify("joiner");
+
+exit:
+    return;
 }
 
 int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
@@ -1120,218 +1282,440 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError error = OT_ERROR_NONE;
+    static MetricsRegistry::CounterFamily sRequests("otbr_ubus_get_information_total",
+                                                    "Information requests served, by action and reply cache result.");
 
-    blob_buf_init(&mBuf, 0);
+    const GetInformationAction *action = nullptr;
+    std::vector<uint8_t>        reply;
 
-    sNcpThreadMutex->lock();
-    if (!strcmp(aAction, "networkname"))
-        blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(mController->GetInstance()));
-    else if (!strcmp(aAction, "state"))
+    for (const GetInformationAction &candidate : kGetInformationActions)
     {
-        char state[10];
-        GetState(mController->GetInstance(), state);
-        blobmsg_add_string(&mBuf, "State", state);
+        if (!strcmp(aAction, candidate.mName))
+        {
+            action = &candidate;
+            break;
+        }
     }
-    else if (!strcmp(aAction, "channel"))
-        blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mController->GetInstance()));
-    else if (!strcmp(aAction, "panid"))
+
+    if (action == nullptr)
     {
-        char panIdString[PANID_LENGTH];
-        sprintf(panIdString, "0x%04x", otLinkGetPanId(mController->GetInstance()));
-        blobmsg_add_string(&mBuf, "PanId", panIdString);
+        perror("invalid argument in get information ubus\n");
+        blob_buf_init(&mBuf, 0);
+        AppendResult(OT_ERROR_INVALID_ARGS, aContext, aRequest);
+        ExitNow();
     }
-    else if (!strcmp(aAction, "rloc16"))
+
     {
-        char rloc[PANID_LENGTH];
-        sprintf(rloc, "0x%04x", otThreadGetRloc16(mController->GetInstance()));
-        blobmsg_add_string(&mBuf, "rloc16", rloc);
+        std::lock_guard<std::mutex> lock(mCacheMutex);
+
+        reply = mCachedReplies[static_cast<size_t>(action - kGetInformationActions)];
     }
-    else if (!strcmp(aAction, "masterkey"))
+
+    sRequests
+        .Get(MetricsRegistry::FormatLabel("action", action->mName) + "," +
+             MetricsRegistry::FormatLabel("cache", reply.empty() ? "miss" : "hit"))
+        .Add(1);
+
+    if (reply.empty())
     {
-        char           outputKey[MASTERKEY_LENGTH] = "";
-        const uint8_t *key = reinterpret_cast<const uint8_t *>(otThreadGetMasterKey(mController->GetInstance()));
-        OutputBytes(key, OT_MASTER_KEY_SIZE, outputKey);
-        blobmsg_add_string(&mBuf, "Masterkey", outputKey);
+        Post<otError>([this, action]() { return RenderGetInformation(*action); }).get();
+        ubus_send_reply(aContext, aRequest, mBuf.head);
     }
-    else if (!strcmp(aAction, "pskc"))
+    else
     {
-        char          outputPskc[MASTERKEY_LENGTH] = "";
-        const otPskc *pskc                         = otThreadGetPskc(mController->GetInstance());
-        OutputBytes(pskc->m8, OT_MASTER_KEY_SIZE, outputPskc);
-        blobmsg_add_string(&mBuf, "pskc", outputPskc);
+        ubus_send_reply(aContext, aRequest, reinterpret_cast<struct blob_attr *>(&reply[0]));
     }
-    else if (!strcmp(aAction, "extpanid"))
+
+exit:
+    return 0;
+}
+
+otError UbusServer::RenderGetInformation(const GetInformationAction &aAction)
+{
+    otError error;
+
+    blob_buf_init(&mBuf, 0);
+    error = (this->*aAction.mRender)();
+    blobmsg_add_u16(&mBuf, "Error", error);
+
+    if (error == OT_ERROR_NONE && aAction.mFlags != 0)
     {
-        char           outputExtPanId[XPANID_LENGTH] = "";
-        const uint8_t *extPanId =
-            reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mController->GetInstance()));
-        OutputBytes(extPanId, OT_EXT_PAN_ID_SIZE, outputExtPanId);
-        blobmsg_add_string(&mBuf, "ExtPanId", outputExtPanId);
+        const uint8_t *             head = reinterpret_cast<const uint8_t *>(mBuf.head);
+        std::lock_guard<std::mutex> lock(mCacheMutex);
+
+        mCachedReplies[static_cast<size_t>(&aAction - kGetInformationActions)].assign(head,
+                                                                                       head + blob_raw_len(mBuf.head));
     }
-    else if (!strcmp(aAction, "mode"))
-    {
-        otLinkModeConfig linkMode;
-        char             mode[5] = "";
 
-        memset(&linkMode, 0, sizeof(otLinkModeConfig));
+    return error;
+}
 
-        linkMode = otThreadGetLinkMode(mController->GetInstance());
+void UbusServer::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    {
+        std::lock_guard<std::mutex> lock(mCacheMutex);
 
-        if (linkMode.mRxOnWhenIdle)
+        for (size_t i = 0; i < ARRAY_SIZE(kGetInformationActions); i++)
         {
-            strcat(mode, "r");
+            if (kGetInformationActions[i].mFlags & aFlags)
+            {
+                mCachedReplies[i].clear();
+            }
         }
+    }
 
-        if (linkMode.mDeviceType)
-        {
-            strcat(mode, "d");
-        }
+    // The notifications are only encoded while a client is subscribed to the otbr object.
+    VerifyOrExit(mHasSubscribers.load(std::memory_order_relaxed));
 
-        if (linkMode.mNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        char state[10];
+
+        GetState(otThreadGetDeviceRole(mController->GetInstance()), state);
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_string(&mNotificationBuf, "State", state);
+        Notify("state");
     }
-    else if (!strcmp(aAction, "partitionid"))
+
+    if (aFlags & OT_CHANGED_THREAD_CHANNEL)
     {
-        blobmsg_add_u32(&mBuf, "Partitionid", otThreadGetPartitionId(mController->GetInstance()));
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_u32(&mNotificationBuf, "Channel", otLinkGetChannel(mController->GetInstance()));
+        Notify("channel");
     }
-    else if (!strcmp(aAction, "leaderdata"))
+
+    if (aFlags & OT_CHANGED_THREAD_NETWORK_NAME)
     {
-        otLeaderData leaderData;
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_string(&mNotificationBuf, "NetworkName", otThreadGetNetworkName(mController->GetInstance()));
+        Notify("networkname");
+    }
 
-        SuccessOrExit(error = otThreadGetLeaderData(mController->GetInstance(), &leaderData));
+    if (aFlags & OT_CHANGED_THREAD_PARTITION_ID)
+    {
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_u32(&mNotificationBuf, "Partitionid", otThreadGetPartitionId(mController->GetInstance()));
+        Notify("partitionid");
+    }
 
-        sJsonUri = blobmsg_open_table(&mBuf, "leaderdata");
+exit:
+    return;
+}
 
-        blobmsg_add_u32(&mBuf, "PartitionId", leaderData.mPartitionId);
-        blobmsg_add_u32(&mBuf, "Weighting", leaderData.mWeighting);
-        blobmsg_add_u32(&mBuf, "DataVersion", leaderData.mDataVersion);
-        blobmsg_add_u32(&mBuf, "StableDataVersion", leaderData.mStableDataVersion);
-        blobmsg_add_u32(&mBuf, "LeaderRouterId", leaderData.mLeaderRouterId);
+void UbusServer::Notify(const char *aType)
+{
+#if OTBR_ENABLE_UBUS_INLINE
+    // Subscribers are notified without waiting for them.
+    ubus_notify(mContext, &otbr, aType, mNotificationBuf.head, -1);
+#else
+    const uint8_t *head     = reinterpret_cast<const uint8_t *>(mNotificationBuf.head);
+    uint64_t       eventNum = 1;
+
+    {
+        std::lock_guard<std::mutex> lock(mNotificationsMutex);
 
-        blobmsg_close_table(&mBuf, sJsonUri);
+        mNotifications.emplace_back(aType, std::vector<uint8_t>(head, head + blob_raw_len(mNotificationBuf.head)));
     }
-    else if (!strcmp(aAction, "networkdata"))
+
+    if (write(mNotificationFd.fd, &eventNum, sizeof(uint64_t)) != sizeof(uint64_t))
     {
-        ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
-        if (time(nullptr) - mSecond > 10)
-        {
-            struct otIp6Address address;
-            uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
-            uint8_t             count             = 0;
-            char                multicastAddr[10] = "ff03::2";
+        otbrLog(OTBR_LOG_WARNING, "failed to wake up the ubus thread: %s", strerror(errno));
+    }
+#endif
+}
+
+void UbusServer::HandleNotificationEvent(struct uloop_fd *aFd, unsigned int aEvents)
+{
+    OT_UNUSED_VARIABLE(aFd);
+    OT_UNUSED_VARIABLE(aEvents);
 
-            blob_buf_init(&mNetworkdataBuf, 0);
+    GetInstance().HandleNotificationEvent();
+}
 
-            SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+void UbusServer::HandleNotificationEvent(void)
+{
+    uint64_t                  eventNum;
+    std::vector<Notification> notifications;
 
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+    if (read(mNotificationFd.fd, &eventNum, sizeof(uint64_t)) < 0 && errno != EAGAIN)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to read the ubus notification eventfd: %s", strerror(errno));
+    }
 
-            sBufNum = 0;
-            otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count);
-            mSecond = time(nullptr);
-        }
-        goto exit;
+    {
+        std::lock_guard<std::mutex> lock(mNotificationsMutex);
+
+        notifications.swap(mNotifications);
     }
-    else if (!strcmp(aAction, "joinernum"))
+
+    for (Notification &notification : notifications)
     {
-        void *       jsonTable = nullptr;
-        void *       jsonArray = nullptr;
-        otJoinerInfo joinerInfo;
-        uint16_t     iterator        = 0;
-        int          joinerNum       = 0;
-        char         eui64[EXTPANID] = "";
+        // Subscribers are notified without waiting for them.
+        ubus_notify(mContext, &otbr, notification.first.c_str(),
+                    reinterpret_cast<struct blob_attr *>(&notification.second[0]), -1);
+    }
+}
 
-        blob_buf_init(&mBuf, 0);
+void UbusServer::HandleSubscribersChanged(struct ubus_context *aContext, struct ubus_object *aObj)
+{
+    OT_UNUSED_VARIABLE(aContext);
 
-        jsonArray = blobmsg_open_array(&mBuf, "joinerList");
-        while (otCommissionerGetNextJoinerInfo(mController->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
-        {
-            memset(eui64, 0, sizeof(eui64));
+    GetInstance().mHasSubscribers.store(aObj->has_subscribers, std::memory_order_relaxed);
+}
 
-            jsonTable = blobmsg_open_table(&mBuf, nullptr);
+otError UbusServer::RenderNetworkName(void)
+{
+    blobmsg_add_string(&mBuf, "NetworkName", mController->GetNodeState()->mNetworkName.c_str());
 
-            blobmsg_add_string(&mBuf, "pskd", joinerInfo.mPskd.m8);
+    return OT_ERROR_NONE;
+}
 
-            switch (joinerInfo.mType)
-            {
-            case OT_JOINER_INFO_TYPE_ANY:
-                blobmsg_add_u16(&mBuf, "isAny", 1);
-                break;
-            case OT_JOINER_INFO_TYPE_EUI64:
-                blobmsg_add_u16(&mBuf, "isAny", 0);
-                OutputBytes(joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8), eui64);
-                blobmsg_add_string(&mBuf, "eui64", eui64);
-                break;
-            case OT_JOINER_INFO_TYPE_DISCERNER:
-                blobmsg_add_u16(&mBuf, "isAny", 0);
-                blobmsg_add_u64(&mBuf, "discernerValue", joinerInfo.mSharedId.mDiscerner.mValue);
-                blobmsg_add_u16(&mBuf, "discernerLength", joinerInfo.mSharedId.mDiscerner.mLength);
-                break;
-            }
+otError UbusServer::RenderState(void)
+{
+    char state[10];
 
-            blobmsg_close_table(&mBuf, jsonTable);
+    GetState(mController->GetNodeState()->mRole, state);
+    blobmsg_add_string(&mBuf, "State", state);
 
-            joinerNum++;
-        }
-        blobmsg_close_array(&mBuf, jsonArray);
+    return OT_ERROR_NONE;
+}
 
-        blobmsg_add_u32(&mBuf, "joinernum", joinerNum);
-    }
-    else if (!strcmp(aAction, "macfilterstate"))
+otError UbusServer::RenderChannel(void)
+{
+    blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mController->GetInstance()));
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderPanId(void)
+{
+    blobmsg_printf(&mBuf, "PanId", "0x%04x", otLinkGetPanId(mController->GetInstance()));
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderRloc16(void)
+{
+    blobmsg_printf(&mBuf, "rloc16", "0x%04x", mController->GetNodeState()->mRloc16);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderMasterkey(void)
+{
+    const uint8_t *key = reinterpret_cast<const uint8_t *>(otThreadGetMasterKey(mController->GetInstance()));
+
+    AddHexString("Masterkey", key, OT_MASTER_KEY_SIZE);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderPskc(void)
+{
+    const otPskc *pskc = otThreadGetPskc(mController->GetInstance());
+
+    AddHexString("pskc", pskc->m8, OT_MASTER_KEY_SIZE);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderExtPanId(void)
+{
+    AddHexString("ExtPanId", mController->GetNodeState()->mExtPanId.m8, OT_EXT_PAN_ID_SIZE);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderMode(void)
+{
+    otLinkModeConfig linkMode = otThreadGetLinkMode(mController->GetInstance());
+
+    AddMode(linkMode.mRxOnWhenIdle, linkMode.mDeviceType, linkMode.mNetworkData);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderPartitionId(void)
+{
+    blobmsg_add_u32(&mBuf, "Partitionid", mController->GetNodeState()->mPartitionId);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderLeaderData(void)
+{
+    otError                               error      = OT_ERROR_NONE;
+    std::shared_ptr<const Ncp::NodeState> state      = mController->GetNodeState();
+    const otLeaderData &                  leaderData = state->mLeaderData;
+
+    VerifyOrExit(state->mLeaderDataValid, error = OT_ERROR_DETACHED);
+
+    sJsonUri = blobmsg_open_table(&mBuf, "leaderdata");
+
+    blobmsg_add_u32(&mBuf, "PartitionId", leaderData.mPartitionId);
+    blobmsg_add_u32(&mBuf, "Weighting", leaderData.mWeighting);
+    blobmsg_add_u32(&mBuf, "DataVersion", leaderData.mDataVersion);
+    blobmsg_add_u32(&mBuf, "StableDataVersion", leaderData.mStableDataVersion);
+    blobmsg_add_u32(&mBuf, "LeaderRouterId", leaderData.mLeaderRouterId);
+
+    blobmsg_close_table(&mBuf, sJsonUri);
+
+exit:
+    return error;
+}
+
+otError UbusServer::RenderJoinerNum(void)
+{
+    void *       jsonTable = nullptr;
+    void *       jsonArray = nullptr;
+    otJoinerInfo joinerInfo;
+    uint16_t     iterator  = 0;
+    int          joinerNum = 0;
+
+    jsonArray = blobmsg_open_array(&mBuf, "joinerList");
+    while (otCommissionerGetNextJoinerInfo(mController->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
     {
-        otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mController->GetInstance());
+        jsonTable = blobmsg_open_table(&mBuf, nullptr);
 
-        blob_buf_init(&mBuf, 0);
+        blobmsg_add_string(&mBuf, "pskd", joinerInfo.mPskd.m8);
 
-        if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
+        switch (joinerInfo.mType)
         {
-            blobmsg_add_string(&mBuf, "state", "disable");
-        }
-        else if (mode == OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST)
-        {
-            blobmsg_add_string(&mBuf, "state", "allowlist");
-        }
-        else if (mode == OT_MAC_FILTER_ADDRESS_MODE_DENYLIST)
-        {
-            blobmsg_add_string(&mBuf, "state", "denylist");
-        }
-        else
-        {
-            blobmsg_add_string(&mBuf, "state", "error");
+        case OT_JOINER_INFO_TYPE_ANY:
+            blobmsg_add_u16(&mBuf, "isAny", 1);
+            break;
+        case OT_JOINER_INFO_TYPE_EUI64:
+            blobmsg_add_u16(&mBuf, "isAny", 0);
+            AddHexString("eui64", joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8));
+            break;
+        case OT_JOINER_INFO_TYPE_DISCERNER:
+            blobmsg_add_u16(&mBuf, "isAny", 0);
+            blobmsg_add_u64(&mBuf, "discernerValue", joinerInfo.mSharedId.mDiscerner.mValue);
+            blobmsg_add_u16(&mBuf, "discernerLength", joinerInfo.mSharedId.mDiscerner.mLength);
+            break;
         }
+
+        blobmsg_close_table(&mBuf, jsonTable);
+
+        joinerNum++;
+    }
+    blobmsg_close_array(&mBuf, jsonArray);
+
+    blobmsg_add_u32(&mBuf, "joinernum", joinerNum);
+
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderMacfilterState(void)
+{
+    otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mController->GetInstance());
+
+    if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
+    {
+        blobmsg_add_string(&mBuf, "state", "disable");
+    }
+    else if (mode == OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST)
+    {
+        blobmsg_add_string(&mBuf, "state", "allowlist");
     }
-    else if (!strcmp(aAction, "macfilteraddr"))
+    else if (mode == OT_MAC_FILTER_ADDRESS_MODE_DENYLIST)
     {
-        otMacFilterEntry    entry;
-        otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
+        blobmsg_add_string(&mBuf, "state", "denylist");
+    }
+    else
+    {
+        blobmsg_add_string(&mBuf, "state", "error");
+    }
 
-        blob_buf_init(&mBuf, 0);
+    return OT_ERROR_NONE;
+}
+
+otError UbusServer::RenderMacfilterAddr(void)
+{
+    otMacFilterEntry    entry;
+    otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
+
+    sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
+
+    while (otLinkFilterGetNextAddress(mController->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
+    {
+        AddHexString("addr", entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8));
+    }
+
+    blobmsg_close_array(&mBuf, sJsonUri);
+
+    return OT_ERROR_NONE;
+}
+
+int UbusServer::UbusNetworkdataHandlerDetail(struct ubus_context *     aContext,
+                                             struct ubus_object *      aObj,
+                                             struct ubus_request_data *aRequest,
+                                             const char *              aMethod,
+                                             struct blob_attr *        aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+#if OTBR_ENABLE_REST_SERVER
+    // Reply the diagnostics aggregated by the REST server, which keeps refreshing them for all its clients, instead
+    // of sending another mesh-wide query.
+    const rest::DiagStore &diagnostics =
+        rest::RestWebServer::GetRestWebServer(mController)->GetResource().GetDiagnostics();
+    int count = 0;
 
-        sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
+    blob_buf_init(&mNetworkdataBuf, 0);
 
-        while (otLinkFilterGetNextAddress(mController->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
+    for (const rest::DiagInfo &info : diagnostics)
+    {
+        char             networkdata[20];
+        char             xrloc[10];
+        size_t           offset = 0;
+        otNetworkDiagTlv diagTlv;
+
+        sprintf(networkdata, "networkdata%d", count++);
+        sJsonUri = blobmsg_open_table(&mNetworkdataBuf, networkdata);
+
+        sprintf(xrloc, "0x%04x", info.mRloc16);
+        blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
+
+        while (rest::DiagStore::GetNextTlv(info, offset, diagTlv))
         {
-            char extAddress[XPANID_LENGTH] = "";
-            OutputBytes(entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8), extAddress);
-            blobmsg_add_string(&mBuf, "addr", extAddress);
+            AppendNetworkdataTlv(info.mRloc16, diagTlv);
         }
 
-        blobmsg_close_array(&mBuf, sJsonUri);
+        blobmsg_close_table(&mNetworkdataBuf, sJsonUri);
     }
-    else
+
+    ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
+
+    return 0;
+#else
+    otError error = OT_ERROR_NONE;
+
+    ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
+    if (time(nullptr) - mSecond > 10)
     {
-        perror("invalid argument in get information ubus\n");
+        struct otIp6Address address;
+        uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
+        uint8_t             count             = 0;
+        char                multicastAddr[10] = "ff03::2";
+
+        blob_buf_init(&mNetworkdataBuf, 0);
+
+        SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+
+        tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
+        tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+
+        sBufNum = 0;
+        otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count);
+        mSecond = time(nullptr);
     }
 
-    AppendResult(error, aContext, aRequest);
 exit:
-    sNcpThreadMutex->unlock();
     return 0;
+#endif
 }
 
 void UbusServer::HandleDiagnosticGetResponse(otError              aError,
@@ -1356,10 +1740,7 @@ static bool IsRoutingLocator(const otIp6Address *aAddress)
 
 void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
-    uint16_t              rloc16;
     uint16_t              sockRloc16 = 0;
-    void *                jsonArray  = nullptr;
-    void *                jsonItem   = nullptr;
     char                  xrloc[10];
     otNetworkDiagTlv      diagTlv;
     otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
@@ -1380,74 +1761,84 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
 
     while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
     {
-        switch (diagTlv.mType)
-        {
-        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
-        {
-            const otNetworkDiagRoute &route = diagTlv.mData.mRoute;
+        AppendNetworkdataTlv(sockRloc16, diagTlv);
+    }
 
-            jsonArray = blobmsg_open_array(&mNetworkdataBuf, "routedata");
+    blobmsg_close_table(&mNetworkdataBuf, sJsonUri);
 
-            for (uint16_t i = 0; i < route.mRouteCount; ++i)
-            {
-                uint8_t in, out;
-                in  = route.mRouteData[i].mLinkQualityIn;
-                out = route.mRouteData[i].mLinkQualityOut;
-                if (in != 0 && out != 0)
-                {
-                    jsonItem = blobmsg_open_table(&mNetworkdataBuf, "router");
-                    rloc16   = route.mRouteData[i].mRouterId << 10;
-                    blobmsg_add_u32(&mNetworkdataBuf, "routerid", route.mRouteData[i].mRouterId);
-                    sprintf(xrloc, "0x%04x", rloc16);
-                    blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
-                    blobmsg_close_table(&mNetworkdataBuf, jsonItem);
-                }
-            }
-            blobmsg_close_array(&mNetworkdataBuf, jsonArray);
-            break;
-        }
+exit:
+    if (aError != OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to receive diagnostic response: %s", otThreadErrorToString(aError));
+    }
+}
 
-        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
-        {
-            jsonArray = blobmsg_open_array(&mNetworkdataBuf, "childdata");
-            for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-            {
-                enum
-                {
-                    kModeRxOnWhenIdle     = 1 << 3, ///< If the device has its receiver on when not transmitting.
-                    kModeFullThreadDevice = 1 << 1, ///< If the device is an FTD.
-                    kModeFullNetworkData  = 1 << 0, ///< If the device requires the full Network Data.
-                };
-                const otNetworkDiagChildEntry &entry = diagTlv.mData.mChildTable.mTable[i];
+void UbusServer::AppendNetworkdataTlv(uint16_t aRloc16, const otNetworkDiagTlv &aTlv)
+{
+    uint16_t rloc16;
+    void *   jsonArray = nullptr;
+    void *   jsonItem  = nullptr;
+    char     xrloc[10];
 
-                uint8_t mode = 0;
+    switch (aTlv.mType)
+    {
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+    {
+        const otNetworkDiagRoute &route = aTlv.mData.mRoute;
 
-                jsonItem = blobmsg_open_table(&mNetworkdataBuf, "child");
-                sprintf(xrloc, "0x%04x", (sockRloc16 | entry.mChildId));
-                blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
+        jsonArray = blobmsg_open_array(&mNetworkdataBuf, "routedata");
 
-                mode = (entry.mMode.mRxOnWhenIdle ? kModeRxOnWhenIdle : 0) |
-                       (entry.mMode.mDeviceType ? kModeFullThreadDevice : 0) |
-                       (entry.mMode.mNetworkData ? kModeFullNetworkData : 0);
-                blobmsg_add_u16(&mNetworkdataBuf, "mode", mode);
+        for (uint16_t i = 0; i < route.mRouteCount; ++i)
+        {
+            uint8_t in, out;
+            in  = route.mRouteData[i].mLinkQualityIn;
+            out = route.mRouteData[i].mLinkQualityOut;
+            if (in != 0 && out != 0)
+            {
+                jsonItem = blobmsg_open_table(&mNetworkdataBuf, "router");
+                rloc16   = route.mRouteData[i].mRouterId << 10;
+                blobmsg_add_u32(&mNetworkdataBuf, "routerid", route.mRouteData[i].mRouterId);
+                sprintf(xrloc, "0x%04x", rloc16);
+                blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
                 blobmsg_close_table(&mNetworkdataBuf, jsonItem);
             }
-            blobmsg_close_array(&mNetworkdataBuf, jsonArray);
-            break;
         }
+        blobmsg_close_array(&mNetworkdataBuf, jsonArray);
+        break;
+    }
 
-        default:
-            // Ignore other network diagnostics data.
-            break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+    {
+        jsonArray = blobmsg_open_array(&mNetworkdataBuf, "childdata");
+        for (uint16_t i = 0; i < aTlv.mData.mChildTable.mCount; ++i)
+        {
+            enum
+            {
+                kModeRxOnWhenIdle     = 1 << 3, ///< If the device has its receiver on when not transmitting.
+                kModeFullThreadDevice = 1 << 1, ///< If the device is an FTD.
+                kModeFullNetworkData  = 1 << 0, ///< If the device requires the full Network Data.
+            };
+            const otNetworkDiagChildEntry &entry = aTlv.mData.mChildTable.mTable[i];
+
+            uint8_t mode = 0;
+
+            jsonItem = blobmsg_open_table(&mNetworkdataBuf, "child");
+            sprintf(xrloc, "0x%04x", (aRloc16 | entry.mChildId));
+            blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
+
+            mode = (entry.mMode.mRxOnWhenIdle ? kModeRxOnWhenIdle : 0) |
+                   (entry.mMode.mDeviceType ? kModeFullThreadDevice : 0) |
+                   (entry.mMode.mNetworkData ? kModeFullNetworkData : 0);
+            blobmsg_add_u16(&mNetworkdataBuf, "mode", mode);
+            blobmsg_close_table(&mNetworkdataBuf, jsonItem);
         }
+        blobmsg_close_array(&mNetworkdataBuf, jsonArray);
+        break;
     }
 
-    blobmsg_close_table(&mNetworkdataBuf, sJsonUri);
-
-exit:
-    if (aError != OT_ERROR_NONE)
-    {
-        otbrLog(OTBR_LOG_WARNING, "failed to receive diagnostic response: %s", otThreadErrorToString(aError));
+    default:
+        // Ignore other network diagnostics data.
+        break;
     }
 }
 
@@ -1466,7 +1857,6 @@ int UbusServer::UbusSetInformation(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
     if (!strcmp(aAction, "networkname"))
     {
         struct blob_attr *tb[SET_NETWORK_MAX];
@@ -1640,14 +2030,13 @@ int UbusServer::UbusSetInformation(struct ubus_context *     aContext,
     }
 
 exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
 
-void UbusServer::GetState(otInstance *aInstance, char *aState)
+void UbusServer::GetState(otDeviceRole aRole, char *aState)
 {
-    switch (otThreadGetDeviceRole(aInstance))
+    switch (aRole)
     {
     case OT_DEVICE_ROLE_DISABLED:
         strcpy(aState, "disabled");
@@ -1676,8 +2065,12 @@ void UbusServer::GetState(otInstance *aInstance, char *aState)
 
 void UbusServer::UbusAddFd()
 {
+#if OTBR_ENABLE_UBUS_INLINE
+    // The socket is polled by the mainloop, see `UpdateFdSet()`.
+#else
     // ubus library function
     ubus_add_uloop(mContext);
+#endif
 
 #ifdef FD_CLOEXEC
     fcntl(mContext->sock.fd, F_SETFD, fcntl(mContext->sock.fd, F_GETFD) | FD_CLOEXEC);
@@ -1722,12 +2115,74 @@ void UbusServer::UbusConnectionLost(struct ubus_context *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
 
+#if OTBR_ENABLE_UBUS_INLINE
+    GetInstance().Reconnect();
+#else
     UbusReconnTimer(nullptr);
+#endif
 }
 
+#if OTBR_ENABLE_UBUS_INLINE
+void UbusServer::HandleReconnectTimer(Timer &aTimer, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+
+    static_cast<UbusServer *>(aContext)->Reconnect();
+}
+
+void UbusServer::Reconnect(void)
+{
+    if (ubus_reconnect(mContext, mSockPath) != 0)
+    {
+        mReconnectTimer.Start(std::chrono::seconds(kReconnectInterval));
+        ExitNow();
+    }
+
+    UbusAddFd();
+
+exit:
+    return;
+}
+
+void UbusServer::UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
+{
+    VerifyOrExit(mContext != nullptr && !mContext->sock.eof && mContext->sock.fd >= 0);
+
+    FD_SET(mContext->sock.fd, &aReadFdSet);
+
+    if (aMaxFd < mContext->sock.fd)
+    {
+        aMaxFd = mContext->sock.fd;
+    }
+
+exit:
+    return;
+}
+
+void UbusServer::Process(const fd_set &aReadFdSet)
+{
+    VerifyOrExit(mContext != nullptr && !mContext->sock.eof && mContext->sock.fd >= 0);
+    VerifyOrExit(FD_ISSET(mContext->sock.fd, &aReadFdSet));
+
+    // Reads the messages received and runs their handlers, a lost connection is reported to `UbusConnectionLost()`.
+    ubus_handle_event(mContext);
+
+exit:
+    return;
+}
+
+void UbusServer::UninstallUbusObject(void)
+{
+    mReconnectTimer.Stop();
+    DisplayUbusDone();
+}
+#endif
+
 int UbusServer::DisplayUbusInit(const char *aPath)
 {
+#if !OTBR_ENABLE_UBUS_INLINE
     uloop_init();
+#endif
     signal(SIGPIPE, SIG_IGN);
 
     mSockPath = aPath;
@@ -1752,6 +2207,13 @@ int UbusServer::DisplayUbusInit(const char *aPath)
         return -1;
     }
 
+#if !OTBR_ENABLE_UBUS_INLINE
+    if (mNotificationFd.fd == -1 || uloop_fd_add(&mNotificationFd, ULOOP_READ) != 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "ubus notifications are disabled: %s", strerror(errno));
+    }
+#endif
+
     return 0;
 }
 
@@ -1774,12 +2236,16 @@ void UbusServer::InstallUbusObject(void)
         return;
     }
 
+#if OTBR_ENABLE_UBUS_INLINE
+    otbrLog(OTBR_LOG_INFO, "ubus handled on the mainloop");
+#else
     otbrLog(OTBR_LOG_INFO, "uloop run");
     uloop_run();
 
     DisplayUbusDone();
 
     uloop_done();
+#endif
 }
 
 otError UbusServer::ParseLong(char *aString, long &aLong)
@@ -1843,10 +2309,13 @@ exit:
 } // namespace ubus
 } // namespace otbr
 
-void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aNcpThreadMutex)
+void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController)
 {
-    otbr::ubus::sNcpThreadMutex = aNcpThreadMutex;
-    otbr::ubus::sUbusEfd        = eventfd(0, 0);
+#if OTBR_ENABLE_UBUS_INLINE
+    // The handlers run on the mainloop, no task is submitted to it.
+    otbr::ubus::UbusServer::Initialize(aController);
+#else
+    otbr::ubus::sUbusEfd = eventfd(0, 0);
 
     otbr::ubus::UbusServer::Initialize(aController);
 
@@ -1855,6 +2324,7 @@ void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aN
         perror("Failed to create eventfd for ubus");
         exit(EXIT_FAILURE);
     }
+#endif
 }
 
 void UbusServerRun(void)
@@ -1862,8 +2332,18 @@ void UbusServerRun(void)
     otbr::ubus::UbusServer::GetInstance().InstallUbusObject();
 }
 
+#if OTBR_ENABLE_UBUS_INLINE
+void UbusServerStop(void)
+{
+    otbr::ubus::UbusServer::GetInstance().UninstallUbusObject();
+}
+#endif
+
 void UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
 {
+#if OTBR_ENABLE_UBUS_INLINE
+    otbr::ubus::UbusServer::GetInstance().UpdateFdSet(aReadFdSet, aMaxFd);
+#else
     VerifyOrExit(otbr::ubus::sUbusEfd != -1);
 
     FD_SET(otbr::ubus::sUbusEfd, &aReadFdSet);
@@ -1875,10 +2355,14 @@ void UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
 
 exit:
     return;
+#endif
 }
 
 void UbusProcess(const fd_set &aReadFdSet)
 {
+#if OTBR_ENABLE_UBUS_INLINE
+    otbr::ubus::UbusServer::GetInstance().Process(aReadFdSet);
+#else
     ssize_t  retval;
     uint64_t num;
 
@@ -1892,9 +2376,11 @@ void UbusProcess(const fd_set &aReadFdSet)
             perror("read ubus eventfd failed\n");
             exit(EXIT_FAILURE);
         }
-        goto exit;
+
+        otbr::ubus::UbusServer::GetInstance().ProcessTasks();
     }
 
 exit:
     return;
+#endif
 }
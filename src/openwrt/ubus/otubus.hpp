@@ -31,15 +31,27 @@
 
 #include "openthread-br/config.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <stdarg.h>
 #include <time.h>
 
+#include <openthread/instance.h>
 #include <openthread/ip6.h>
 #include <openthread/link.h>
 #include <openthread/netdiag.h>
 #include <openthread/udp.h>
 
 #include "common/code_utils.hpp"
+#include "common/timer.hpp"
 
 extern "C" {
 #include <libubox/blobmsg_json.h>
@@ -85,9 +97,37 @@ public:
     /**
      * This method install ubus object onto OpenWRT.
      *
+     * With `OTBR_ENABLE_UBUS_INLINE`, this method only connects to ubus and returns, the requests are then handled by
+     * the mainloop. Otherwise this method runs the uloop of the ubus thread.
+     *
      */
     void InstallUbusObject(void);
 
+#if OTBR_ENABLE_UBUS_INLINE
+    /**
+     * This method adds the socket of the ubus context to the read fd set of the mainloop.
+     *
+     * @param[inout]  aReadFdSet  The read fd set of the mainloop.
+     * @param[inout]  aMaxFd      The highest fd of the mainloop.
+     *
+     */
+    void UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd);
+
+    /**
+     * This method handles the ubus messages received, running their handlers inline on the mainloop.
+     *
+     * @param[in]  aReadFdSet  The read fd set of the mainloop.
+     *
+     */
+    void Process(const fd_set &aReadFdSet);
+
+    /**
+     * This method disconnects from ubus when the mainloop exits.
+     *
+     */
+    void UninstallUbusObject(void);
+#endif
+
     /**
      * This method handle ubus scan function request.
      *
@@ -760,17 +800,103 @@ public:
      */
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+    /**
+     * This method appends the routes or the children of a diagnostic TLV to the network data of a node.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     * @param[in]   aTlv        The diagnostic TLV, other types are ignored.
+     *
+     */
+    void AppendNetworkdataTlv(uint16_t aRloc16, const otNetworkDiagTlv &aTlv);
+
+    /**
+     * This method tracks whether a client is subscribed to the otbr object, notifications are only encoded if so.
+     *
+     */
+    static void HandleSubscribersChanged(struct ubus_context *aContext, struct ubus_object *aObj);
+
+    /**
+     * This method submits a task to the mainloop, which owns the OpenThread instance.
+     *
+     * The mainloop is woken up through the ubus eventfd and runs the task in `ProcessTasks()`. This method must not be
+     * called from the mainloop, which would never get to run the task, unless with `OTBR_ENABLE_UBUS_INLINE` where the
+     * task runs before this method returns.
+     *
+     * @param[in]  aTask  The task to run on the mainloop.
+     *
+     * @returns A future of the result of @p aTask.
+     *
+     */
+    template <typename ResultType> std::future<ResultType> Post(std::function<ResultType(void)> aTask)
+    {
+        auto task   = std::make_shared<std::packaged_task<ResultType(void)>>(std::move(aTask));
+        auto result = task->get_future();
+
+        Enqueue([task]() { (*task)(); });
+
+        return result;
+    }
+
+    /**
+     * This method runs the tasks submitted to the mainloop.
+     *
+     * This method must be called from the mainloop once the ubus eventfd is readable.
+     *
+     */
+    void ProcessTasks(void);
+
 private:
+    /**
+     * This structure represents an action of the ubus get information request.
+     *
+     */
+    typedef otError (UbusServer::*GetInformationRenderer)(void);
+
+    struct GetInformationAction
+    {
+        const char *           mName;   ///< The name of the action.
+        GetInformationRenderer mRender; ///< The method rendering the reply of the action into `mBuf`.
+        otChangedFlags         mFlags;  ///< The flags invalidating the cached reply, not cached if no flag is set.
+    };
+
+    static const GetInformationAction kGetInformationActions[];
+
     bool                       mIfFinishScan;
+    otError                    mScanError;
     struct ubus_context *      mContext;
     const char *               mSockPath;
     struct blob_buf            mBuf;
     struct blob_buf            mNetworkdataBuf;
     Ncp::ControllerOpenThread *mController;
     time_t                     mSecond;
+
+    std::mutex              mScanMutex;
+    std::condition_variable mScanFinished;
+    struct blob_buf         mScanBuf;  ///< The reply of the scan, filled on the mainloop as the results arrive.
+    void *                  mScanList; ///< The cookie of the array of the scan results in `mScanBuf`.
+#if OTBR_ENABLE_UBUS_INLINE
+    std::vector<struct ubus_request_data> mScanRequests; ///< The deferred scan requests, replied once the scan ends.
+    Timer                                 mReconnectTimer;
+#endif
+
+    std::mutex                             mTasksMutex;
+    std::vector<std::function<void(void)>> mTasks;
+
+    std::mutex                        mCacheMutex;
+    std::vector<std::vector<uint8_t>> mCachedReplies; ///< The replies of kGetInformationActions, empty if not cached.
+
+    typedef std::pair<std::string, std::vector<uint8_t>> Notification; ///< The type and the message of a notification.
+
+    struct blob_buf           mNotificationBuf; ///< The message of a notification, only encoded on the mainloop.
+    struct uloop_fd           mNotificationFd;  ///< The eventfd waking up the ubus thread to send the notifications.
+    std::mutex                mNotificationsMutex;
+    std::vector<Notification> mNotifications;  ///< The notifications not sent yet, in order.
+    std::atomic<bool>         mHasSubscribers; ///< Whether a client is subscribed to the otbr object.
+
     enum
     {
         kDefaultJoinerTimeout = 120,
+        kReconnectInterval    = 2, ///< The interval in seconds between attempts to reconnect to ubus.
     };
 
     /**
@@ -781,11 +907,105 @@ private:
     UbusServer(Ncp::ControllerOpenThread *aController);
 
     /**
-     * This method start scan.
+     * This method starts a scan shared with the other scan requests of the agent, the results are rendered into
+     * `mBuf` as they arrive.
      *
      */
     void ProcessScan(void);
 
+    /**
+     * This method renders the reply of a get information action into `mBuf` and caches it if the action is cached.
+     *
+     * This method must be called from the mainloop.
+     *
+     * @param[in]   aAction     The get information action.
+     *
+     * @returns The error of rendering the reply.
+     *
+     */
+    otError RenderGetInformation(const GetInformationAction &aAction);
+
+    /**
+     * This method invalidates the cached replies depending on the changed state, and notifies the subscribers of the
+     * otbr object of the changed state.
+     *
+     * The notifications "state", "channel", "networkname" and "partitionid" carry the same fields as the replies of
+     * the methods with the same names.
+     *
+     * @param[in]   aFlags      The flags of the changed state.
+     *
+     */
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+
+    /**
+     * This method queues the message in `mNotificationBuf` as a notification to be sent by the ubus thread.
+     *
+     * This method must be called from the mainloop.
+     *
+     * @param[in]   aType       The type of the notification.
+     *
+     */
+    void Notify(const char *aType);
+
+    /**
+     * This method sends the queued notifications, it is called on the ubus thread once the eventfd is readable.
+     *
+     */
+    static void HandleNotificationEvent(struct uloop_fd *aFd, unsigned int aEvents);
+    void        HandleNotificationEvent(void);
+
+    otError RenderNetworkName(void);
+    otError RenderState(void);
+    otError RenderChannel(void);
+    otError RenderPanId(void);
+    otError RenderRloc16(void);
+    otError RenderMasterkey(void);
+    otError RenderPskc(void);
+    otError RenderExtPanId(void);
+    otError RenderMode(void);
+    otError RenderPartitionId(void);
+    otError RenderLeaderData(void);
+    otError RenderJoinerNum(void);
+    otError RenderMacfilterState(void);
+    otError RenderMacfilterAddr(void);
+
+    /**
+     * This method replies the network data collected by diagnostic get, and refreshes it at most every 10 seconds.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    int UbusNetworkdataHandlerDetail(struct ubus_context *     aContext,
+                                     struct ubus_object *      aObj,
+                                     struct ubus_request_data *aRequest,
+                                     const char *              aMethod,
+                                     struct blob_attr *        aMsg);
+
+    /**
+     * This method queues a task for the mainloop and wakes it up, or runs it with `OTBR_ENABLE_UBUS_INLINE`.
+     *
+     * @param[in]  aTask  The task to run on the mainloop.
+     *
+     */
+    void Enqueue(std::function<void(void)> aTask);
+
+    /**
+     * This method runs a ubus handler on the mainloop and waits for its result, or runs it with
+     * `OTBR_ENABLE_UBUS_INLINE`.
+     *
+     * @param[in]  aHandler  The ubus handler to run.
+     *
+     * @returns The result of @p aHandler.
+     *
+     */
+    static int RunOnMainloop(std::function<int(void)> aHandler);
+
     /**
      * This method detailly start scan.
      *
@@ -805,21 +1025,12 @@ private:
                               struct blob_attr *        aMsg);
 
     /**
-     * This method handle scan result (callback function).
-     *
-     * @param[in]   aResult     A pointer to result.
-     * @param[in]   aContext    A pointer to context.
-     *
-     */
-    static void HandleActiveScanResult(otActiveScanResult *aResult, void *aContext);
-
-    /**
-     * This method detailly handler the scan result, called by HandleActiveScanResult.
+     * This method detailly handler the scan result, called for each result and with nullptr once the scan completes.
      *
      * @param[in]   aResult     A pointer to result.
      *
      */
-    void HandleActiveScanResultDetail(otActiveScanResult *aResult);
+    void HandleActiveScanResultDetail(const otActiveScanResult *aResult);
 
     /**
      * This method detailly handler get neighbor information.
@@ -1005,7 +1216,7 @@ private:
                                   void *                    aContext);
 
     /**
-     * This method handle joiner event.
+     * This method handle joiner event, and notifies the subscribers of the otbr object with a "joiner" notification.
      *
      * @param[in]  aEvent       The joiner event type.
      * @param[in]  aJoinerInfo  A pointer to the Joiner Info.
@@ -1019,11 +1230,11 @@ private:
     /**
      * This method convert thread network state to string.
      *
-     * @param[in]   aInstance   A pointer to the instance.
+     * @param[in]   aRole       The device role.
      * @param[out]  aState      A pointer to the string address.
      *
      */
-    void GetState(otInstance *aInstance, char *aState);
+    void GetState(otDeviceRole aRole, char *aState);
 
     /**
      * This method add fd of ubus object.
@@ -1055,6 +1266,15 @@ private:
      */
     static void UbusConnectionLost(struct ubus_context *aContext);
 
+#if OTBR_ENABLE_UBUS_INLINE
+    /**
+     * This method reconnects to ubus, and retries on the mainloop timer if it fails.
+     *
+     */
+    static void HandleReconnectTimer(Timer &aTimer, void *aContext);
+    void        Reconnect(void);
+#endif
+
     /**
      * This method connect and display ubus.
      *
@@ -1104,6 +1324,26 @@ private:
      */
     void OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput);
 
+    /**
+     * This method adds bytes as a hex string to `mBuf`, formatted in place.
+     *
+     * @param[in]   aName   The name of the field.
+     * @param[in]   aBytes  A pointer to the bytes.
+     * @param[in]   aLength The length of the bytes.
+     *
+     */
+    void AddHexString(const char *aName, const uint8_t *aBytes, uint8_t aLength);
+
+    /**
+     * This method adds the "Mode" field of a link mode, as the `rdn` flags of the CLI, to `mBuf`.
+     *
+     * @param[in]   aRxOnWhenIdle       Whether the receiver is on when idle.
+     * @param[in]   aFullThreadDevice   Whether the device is a full Thread device.
+     * @param[in]   aFullNetworkData    Whether the full network data is requested.
+     *
+     */
+    void AddMode(bool aRxOnWhenIdle, bool aFullThreadDevice, bool aFullNetworkData);
+
     /**
      * This method append result in message passed to ubus.
      *
@@ -28,10 +28,19 @@
 
 #include "rest/connection.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 #include <assert.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+
+#include "common/mainloop_clock.hpp"
+#include "rest/metrics.hpp"
+
+#if OTBR_ENABLE_GZIP
+#include "utils/gzip.hpp"
+#endif
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -44,175 +53,270 @@ namespace rest {
 // The timeout (in microseconds) since a connection is in wait callback state
 static const uint32_t kCallbackTimeout = 10000000;
 
-// The time interval (in microseconds) for checking again if there is a connection need callback.
-static const uint32_t kCallbackCheckInterval = 500000;
-
 // The timeout (in microseconds) since a connection is in wait write state
 static const uint32_t kWriteTimeout = 10000000;
 
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+// The timeout (in microseconds) for a persistent connection waiting for its next request
+static const uint32_t kIdleTimeout = 10000000;
+
+// Maximum number of requests served on one persistent connection.
+static const uint32_t kMaxRequestsPerConnection = 100;
+
+// Maximum size of the received data kept for the current request and the pipelined ones, in bytes.
+static const size_t kMaxPendingInputSize = 2 * (OTBR_REST_MAX_HEADER_SIZE + OTBR_REST_MAX_BODY_SIZE);
+
+// Number of bytes read from the socket at once.
+static const size_t kReadSize = 2048;
+
+// The interval (in microseconds) of sending a comment to keep an idle event stream open
+static const uint32_t kStreamHeartbeatInterval = 15000000;
+
+// Maximum size of events not yet sent to a slow event stream client, in bytes.
+static const size_t kMaxStreamBacklog = 65536;
+
+Connection::Connection(steady_clock::time_point aStartTime,
+                       Resource *               aResource,
+                       int                      aFd,
+                       const std::string &      aClientAddress)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
+    , mClientAddress(aClientAddress)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mWriteOffset(0)
+    , mTimer(&Connection::HandleTimer, this)
+    , mParsedOffset(0)
+    , mRequestCount(0)
+    , mIdle(false)
+    , mRequestStart(aStartTime)
+    , mHandleStart(aStartTime)
+    , mWriteStart(aStartTime)
+    , mTimedOut(false)
+    , mStreamSent(0)
+#if OTBR_ENABLE_REST_TLS
+    , mTlsEnabled(false)
+#endif
 {
+    mRequest.SetInput(mPendingInput);
 }
 
 void Connection::Init(void)
 {
     mParser.Init();
-}
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
-{
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
+    if (EventPoller::Get().Register(mFd, EventPoller::kEventReadable, &Connection::HandleEvent, this,
+                                    EventPoller::kPriorityLow) != OTBR_ERROR_NONE)
     {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        Disconnect();
+        ExitNow();
     }
+
+    mTimer.StartAt(mTimeStamp + microseconds(kReadTimeout));
+
+    // Initial state, directly read for the first time.
+    ProcessWaitRead();
+
+exit:
+    return;
+}
+
+void Connection::Reset(steady_clock::time_point aStartTime, int aFd, const std::string &aClientAddress)
+{
+    assert(IsComplete());
+
+    mTimeStamp     = aStartTime;
+    mFd            = aFd;
+    mClientAddress = aClientAddress;
+    mState         = ConnectionState::kInit;
+    mRequest.Reset();
+    mResponse.Reset();
+    mParser.Reset();
+    mWriteHeader.clear();
+    mWriteOffset = 0;
+    mPendingInput.clear();
+    mParsedOffset = 0;
+    mRequestCount = 0;
+    mIdle         = false;
+    mRequestStart = aStartTime;
+    mHandleStart  = aStartTime;
+    mWriteStart   = aStartTime;
+    mTimedOut     = false;
+    mStreamOutput.clear();
+    mStreamSent = 0;
 }
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
+#if OTBR_ENABLE_REST_TLS
+void Connection::SetTls(const TlsServer *aServer)
 {
-    if (mState == ConnectionState::kWriteWait)
+    mTlsEnabled = (aServer != nullptr);
+
+    // A session failing to reset is replaced, rather than kept with the state of the previous connection.
+    if (mTlsEnabled && (mTls == nullptr || mTls->Reset(mFd) != OTBR_ERROR_NONE))
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        mTls.reset(new TlsSession(*aServer));
+        mTls->Reset(mFd);
     }
 }
+#endif
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+const std::string &Connection::GetClientAddress(void) const
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    return mClientAddress;
+}
 
-    switch (mState)
+void Connection::HandleEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+
+    static_cast<Connection *>(aContext)->HandleEvent(aEvents);
+}
+
+void Connection::HandleEvent(uint32_t aEvents)
+{
+    if (aEvents & EventPoller::kEventError)
     {
-    case ConnectionState::kReadWait:
-        timeoutLen = kReadTimeout;
-        break;
-    case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
-        break;
-    case ConnectionState::kWriteWait:
-        timeoutLen = kWriteTimeout;
-        break;
-    case ConnectionState::kComplete:
-        timeoutLen = 0;
-        break;
-    default:
-        break;
+        Disconnect();
     }
-
-    if (duration <= timeoutLen)
+    else if ((aEvents & GetReadEvents()) && (mState == ConnectionState::kInit || mState == ConnectionState::kReadWait))
     {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
+        ProcessWaitRead();
     }
-    else
+    else if ((aEvents & EventPoller::kEventWritable) && mState == ConnectionState::kWriteWait)
     {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
+        Write();
     }
-
-    if (timercmp(&timeout, &aTimeout, <))
+    else if (mState == ConnectionState::kStreaming)
     {
-        aTimeout = timeout;
+        ProcessStream(aEvents);
     }
 }
 
-void Connection::UpdateFdSet(otSysMainloopContext &aMainloop) const
-{
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
-}
-
-void Connection::Disconnect(void)
+void Connection::HandleTimer(Timer &aTimer, void *aContext)
 {
-    mState = ConnectionState::kComplete;
+    OTBR_UNUSED_VARIABLE(aTimer);
 
-    if (mFd != -1)
-    {
-        close(mFd);
-        mFd = -1;
-    }
+    static_cast<Connection *>(aContext)->HandleTimer();
 }
 
-void Connection::Process(fd_set &aReadFdSet, fd_set &aWriteFdSet)
+void Connection::HandleTimer(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-
     switch (mState)
     {
-    // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aReadFdSet);
+        if (mIdle)
+        {
+            // No further request on a persistent connection.
+            Disconnect();
+        }
+        else
+        {
+            // Reach a read timeout, send response about this timeout.
+            mTimedOut = true;
+            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusRequestTimeout);
+            Write();
+        }
         break;
     case ConnectionState::kCallbackWait:
-        //  Wait for Callback process.
+        // Reach a callback timeout.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aWriteFdSet);
+        // Reach a write timeout.
+        mTimedOut = true;
+        RecordMetrics(true);
+        Disconnect();
+        break;
+    case ConnectionState::kStreaming:
+        PushStream(": heartbeat\n\n");
+        if (mState == ConnectionState::kStreaming)
+        {
+            mTimer.Start(microseconds(kStreamHeartbeatInterval));
+        }
         break;
     default:
-        assert(false);
+        break;
     }
+}
 
-    if (error != OTBR_ERROR_NONE)
+void Connection::Disconnect(void)
+{
+    if (mState == ConnectionState::kStreaming)
     {
-        Disconnect();
+        mResource->RemoveEventListener(&Connection::HandleStreamEvent, this);
+    }
+    else if (mState == ConnectionState::kCallbackWait)
+    {
+        mResource->RemoveCallbackWaiter(&Connection::HandleCallbackReady, this);
+    }
+
+    mState = ConnectionState::kComplete;
+    mTimer.Stop();
+
+    if (mFd != -1)
+    {
+#if OTBR_ENABLE_REST_TLS
+        if (mTlsEnabled)
+        {
+            mTls->CloseNotify();
+        }
+#endif
+        EventPoller::Get().Unregister(mFd);
+        close(mFd);
+        mFd = -1;
     }
 }
 
-void Connection::ProcessWaitRead(fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(void)
 {
     otbrError error    = OTBR_ERROR_NONE;
-    int32_t   received = 0, err;
-    char      buf[2048];
-    auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    int32_t   received = 0, err = 0;
 
-    // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
-
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    mState = ConnectionState::kReadWait;
 
     do
     {
-        mState   = ConnectionState::kReadWait;
-        received = read(mFd, buf, sizeof(buf));
+        size_t length = mPendingInput.size();
+
+        // Read directly into the input buffer, which the request refers to.
+        mPendingInput.resize(length + kReadSize);
+        received = Receive(&mPendingInput[length], kReadSize);
         err      = errno;
+        mPendingInput.resize(length + static_cast<size_t>(std::max(received, 0)));
+
         if (received > 0)
         {
-            mParser.Process(buf, received);
+            ProcessPendingInput();
         }
-    } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
+    } while (mState == ConnectionState::kReadWait && (received > 0 || (received < 0 && err == EINTR)));
 
-    if (mRequest.IsComplete())
-    {
-        Handle();
-    }
+    // The request has been handled.
+    VerifyOrExit(mState == ConnectionState::kReadWait);
 
     // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
     // and at the same time, the request has not been parsed completely.
-    VerifyOrExit(received != 0 || mRequest.IsComplete(), error = OTBR_ERROR_REST);
+    VerifyOrExit(received != 0, error = OTBR_ERROR_REST);
 
     // Check second  failure situation : received = -1 error(indicates that our system call read raise an error )
     // then try to send back a response that there is an internal error.
-    VerifyOrExit(received > 0 || (received == -1 && (err == EAGAIN || err == EWOULDBLOCK)), error = OTBR_ERROR_REST);
+    VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+
+    // A TLS handshake may wait for the socket to be writable.
+    EventPoller::Get().Update(mFd, GetReadEvents());
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        if (received < 0)
+        if (received == 0 && mIdle)
+        {
+            // The client closed a persistent connection.
+            Disconnect();
+        }
+        else if (received < 0)
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
             Write();
@@ -225,20 +329,71 @@ exit:
     }
 }
 
+void Connection::ProcessPendingInput(void)
+{
+    size_t consumed;
+
+    VerifyOrExit(mParsedOffset < mPendingInput.size());
+
+    if (mIdle)
+    {
+        // The next request has started arriving.
+        mIdle         = false;
+        mRequestStart = steady_clock::now();
+        mTimer.Start(microseconds(kReadTimeout));
+    }
+
+    // The parsed data is kept until the next request, as the request refers to it.
+    consumed = mParser.Process(mPendingInput.data() + mParsedOffset, mPendingInput.size() - mParsedOffset);
+    mParsedOffset += consumed;
+
+    if (mRequest.IsComplete())
+    {
+        Handle();
+    }
+    else if (mParser.HasError() || mPendingInput.size() > kMaxPendingInputSize)
+    {
+        // Malformed or too large request, the rest of the stream can't be parsed.
+        mResource->ErrorHandler(mResponse, mRequest.GetParseError());
+        mPendingInput.clear();
+        mParsedOffset = 0;
+        Write();
+    }
+
+exit:
+    return;
+}
+
 void Connection::Handle(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error     = OTBR_ERROR_NONE;
+    bool      keepAlive = mRequest.IsKeepAlive() && (mRequestCount + 1 < kMaxRequestsPerConnection);
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    mRequestCount++;
+    mHandleStart = steady_clock::now();
 
+    mRequest.SetClientAddress(mClientAddress);
     mResource->Handle(mRequest, mResponse);
 
+    keepAlive = keepAlive && !mResponse.IsStream();
+    mResponse.SetKeepAlive(keepAlive);
+
+    // Try to close server read side here, because we will no longer read from socket after this request. An event
+    // stream still reads to find out when the client goes away.
+    VerifyOrExit(keepAlive || mResponse.IsStream() || (shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+
     if (mResponse.NeedCallback())
     {
         mState     = ConnectionState::kCallbackWait;
-        mTimeStamp = steady_clock::now();
+        mTimeStamp = MainloopClock::Now();
+        mTimer.Start(microseconds(kCallbackTimeout));
+
+        // The resource wakes this connection up when the response may be ready.
+        mResource->AddCallbackWaiter(&Connection::HandleCallbackReady, this);
+
+        // Pipelined requests are not read until this one is responded, and a shut down read side would be reported
+        // readable all the time.
+        EventPoller::Get().Update(mFd, 0);
     }
     else
     {
@@ -255,93 +410,292 @@ exit:
     }
 }
 
+void Connection::WaitNextRequest(void)
+{
+    mRequest.Reset();
+    mPendingInput.erase(0, mParsedOffset);
+    mParsedOffset = 0;
+    mResponse.Reset();
+    mParser.Reset();
+    mWriteHeader.clear();
+    mWriteOffset = 0;
+    mTimedOut    = false;
+
+    mState     = ConnectionState::kReadWait;
+    mTimeStamp = MainloopClock::Now();
+    mIdle      = true;
+    mTimer.Start(microseconds(kIdleTimeout));
+    EventPoller::Get().Update(mFd, EventPoller::kEventReadable);
+
+    // Handle pipelined request already received.
+    ProcessPendingInput();
+}
+
 void Connection::ProcessWaitCallback(void)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto duration = duration_cast<microseconds>(MainloopClock::Now() - mTimeStamp).count();
 
     mResource->HandleCallback(mRequest, mResponse);
 
-    if (mResponse.IsComplete())
+    if (!mResponse.IsComplete() && duration >= kCallbackTimeout)
     {
-        Write();
+        mTimedOut = true;
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
     }
-    else
+
+    if (mResponse.IsComplete())
     {
-        if (duration >= kCallbackTimeout)
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
-        }
+        mResource->RemoveCallbackWaiter(&Connection::HandleCallbackReady, this);
+        Write();
     }
 }
 
-void Connection::ProcessWaitWrite(fd_set &aWriteFdSet)
+void Connection::HandleCallbackReady(void *aContext)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    static_cast<Connection *>(aContext)->ProcessWaitCallback();
+}
 
-    if (duration <= kWriteTimeout)
-    {
-        if (FD_ISSET(mFd, &aWriteFdSet))
-        {
-            Write();
-        }
-    }
-    else
+void Connection::Render(bool aCompress)
+{
+    // Nothing touches this connection on the mainloop until the worker thread is done with the response.
+    mState = ConnectionState::kRenderWait;
+    mTimer.Stop();
+    EventPoller::Get().Update(mFd, 0);
+
+    WorkerPool::Get().Post([this, aCompress]() { PrepareBody(aCompress); }, [this]() { Write(); });
+}
+
+void Connection::PrepareBody(bool aCompress)
+{
+    mResponse.RenderBody();
+
+#if OTBR_ENABLE_GZIP
+    if (aCompress)
     {
-        Disconnect();
+        mResponse.Compress();
     }
+#else
+    OTBR_UNUSED_VARIABLE(aCompress);
+#endif
 }
 
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError          error = OTBR_ERROR_NONE;
+    const std::string *body;
+    struct iovec       iov[2];
+    int                iovCount = 0;
+    size_t             totalLength;
+    ssize_t            sendLength;
+    int32_t            err;
 
     if (mState != ConnectionState::kWriteWait)
     {
+        if (mState != ConnectionState::kRenderWait)
+        {
+            bool compress = false;
+
+#if OTBR_ENABLE_GZIP
+            compress = Utils::AcceptsGzip(mRequest.GetHeaderValue("Accept-Encoding"));
+#endif
+            if (WorkerPool::Get().IsEnabled() &&
+                (mResponse.HasBodyRenderer() ||
+                 (compress && mResponse.GetBody().size() >= OTBR_REST_GZIP_MIN_LENGTH)))
+            {
+                Render(compress);
+                ExitNow();
+            }
+
+            PrepareBody(compress);
+        }
+
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState       = ConnectionState::kWriteWait;
+        mTimeStamp   = MainloopClock::Now();
+        mWriteStart  = steady_clock::now();
+        mWriteHeader = mResponse.SerializeHeader();
+        mWriteOffset = 0;
+        EventPoller::Get().Update(mFd, EventPoller::kEventWritable);
+        mTimer.Start(microseconds(kWriteTimeout));
     }
 
+    // Compressing may replace a shared body by a copy owned by the response, only get the body once it is prepared.
+    body        = &mResponse.GetBody();
+    totalLength = mWriteHeader.size() + body->size();
+
     // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
+    VerifyOrExit(mWriteOffset < totalLength, error = OTBR_ERROR_REST);
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
-    err        = errno;
+    // Send the rest of the headers and the body in one system call without copying them.
+    if (mWriteOffset < mWriteHeader.size())
+    {
+        iov[iovCount].iov_base = const_cast<char *>(mWriteHeader.data()) + mWriteOffset;
+        iov[iovCount].iov_len  = mWriteHeader.size() - mWriteOffset;
+        iovCount++;
+    }
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
+    if (!body->empty())
     {
-        // Normal Exit
-        Disconnect();
+        size_t bodyOffset = mWriteOffset > mWriteHeader.size() ? mWriteOffset - mWriteHeader.size() : 0;
+
+        iov[iovCount].iov_base = const_cast<char *>(body->data()) + bodyOffset;
+        iov[iovCount].iov_len  = body->size() - bodyOffset;
+        iovCount++;
     }
-    else if (sendLength > 0)
+
+    do
+    {
+        sendLength = Send(iov, iovCount);
+        err        = errno;
+    } while (sendLength < 0 && err == EINTR);
+
+    if (sendLength < 0)
     {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
+        // There is an error when we write, if this, we directly disconnect this connection.
+        VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+        ExitNow();
     }
-    else
+
+    mWriteOffset += static_cast<size_t>(sendLength);
+
+    // Write successfully
+    if (mWriteOffset == totalLength)
     {
-        if (errno == EINTR)
+        RecordMetrics(false);
+
+        if (mResponse.IsStream())
         {
-            // Try again
-            Write();
+            StartStream();
+        }
+        else if (mResponse.IsKeepAlive())
+        {
+            WaitNextRequest();
         }
         else
         {
-            // There is an error when we write, if this, we directly disconnect this connection.
-            VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            // Normal Exit
+            Disconnect();
         }
     }
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
+        RecordMetrics(true);
+        Disconnect();
+    }
+}
+
+void Connection::RecordMetrics(bool aFailed)
+{
+    steady_clock::time_point now = steady_clock::now();
+    // A request rejected before it is complete, e.g. malformed or timed out, is not handled by any resource.
+    steady_clock::time_point handleStart = mRequest.IsComplete() ? mHandleStart : mWriteStart;
+    Metrics::Sample          sample;
+
+    sample.mResource                         = mResponse.GetRoute();
+    sample.mStatus                           = mResponse.GetStatusCode();
+    sample.mDurations[Metrics::kPhaseRead]   = duration_cast<microseconds>(handleStart - mRequestStart).count();
+    sample.mDurations[Metrics::kPhaseHandle] = duration_cast<microseconds>(mWriteStart - handleStart).count();
+    sample.mDurations[Metrics::kPhaseWrite]  = duration_cast<microseconds>(now - mWriteStart).count();
+    sample.mBytesWritten                     = mWriteOffset;
+    sample.mTimedOut                         = mTimedOut;
+    sample.mFailed                           = aFailed;
+
+    Metrics::Get().Record(sample);
+}
+
+void Connection::StartStream(void)
+{
+    mState      = ConnectionState::kStreaming;
+    mTimeStamp  = MainloopClock::Now();
+    mStreamSent = 0;
+    mStreamOutput.clear();
+    mTimer.Start(microseconds(kStreamHeartbeatInterval));
+    EventPoller::Get().Update(mFd, EventPoller::kEventReadable);
+    mResource->AddEventListener(&Connection::HandleStreamEvent, this);
+}
+
+void Connection::HandleStreamEvent(void *aContext, const std::string &aEvent)
+{
+    static_cast<Connection *>(aContext)->PushStream(aEvent);
+}
+
+void Connection::PushStream(const std::string &aEvent)
+{
+    // Drop what has been sent before appending.
+    mStreamOutput.erase(0, mStreamSent);
+    mStreamSent = 0;
+
+    if (mStreamOutput.size() + aEvent.size() > kMaxStreamBacklog)
+    {
+        otbrLog(OTBR_LOG_WARNING, "REST event stream client is too slow, disconnect");
         Disconnect();
+        ExitNow();
+    }
+
+    mStreamOutput += aEvent;
+    WriteStream();
+
+exit:
+    return;
+}
+
+void Connection::ProcessStream(uint32_t aEvents)
+{
+    if (aEvents & EventPoller::kEventReadable)
+    {
+        char    buf[256];
+        ssize_t received;
+
+        // Requests are not expected on an event stream, only wait for the client to close it.
+        do
+        {
+            received = Receive(buf, sizeof(buf));
+        } while (received > 0 || (received < 0 && errno == EINTR));
+
+        VerifyOrExit(received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK), Disconnect());
+    }
+
+    if (aEvents & EventPoller::kEventWritable)
+    {
+        WriteStream();
+    }
+
+exit:
+    return;
+}
+
+void Connection::WriteStream(void)
+{
+    ssize_t      sendLength;
+    struct iovec iov;
+
+    while (mStreamSent < mStreamOutput.size())
+    {
+        iov.iov_base = const_cast<char *>(mStreamOutput.data()) + mStreamSent;
+        iov.iov_len  = mStreamOutput.size() - mStreamSent;
+        sendLength   = Send(&iov, 1);
+
+        if (sendLength < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        // Wait for writable if the socket buffer is full, disconnect on other errors.
+        VerifyOrExit(sendLength >= 0 || errno == EAGAIN || errno == EWOULDBLOCK, Disconnect());
+        VerifyOrExit(sendLength >= 0);
+
+        mStreamSent += static_cast<size_t>(sendLength);
+    }
+
+exit:
+    if (mState == ConnectionState::kStreaming)
+    {
+        // Only wait for writable while there is something left to send.
+        EventPoller::Get().Update(mFd, mStreamSent < mStreamOutput.size()
+                                           ? (EventPoller::kEventReadable | EventPoller::kEventWritable)
+                                           : EventPoller::kEventReadable);
     }
 }
 
@@ -350,5 +704,59 @@ bool Connection::IsComplete() const
     return mState == ConnectionState::kComplete;
 }
 
+size_t Connection::GetMemoryUsage(void) const
+{
+    size_t size = sizeof(*this) + mClientAddress.capacity() + mRequest.GetMemoryUsage() +
+                  mResponse.GetMemoryUsage() + mWriteHeader.capacity() + mPendingInput.capacity() +
+                  mStreamOutput.capacity();
+
+#if OTBR_ENABLE_REST_TLS
+    if (mTls != nullptr)
+    {
+        size += mTls->GetMemoryUsage();
+    }
+#endif
+
+    return size;
+}
+
+ssize_t Connection::Receive(void *aBuffer, size_t aLength)
+{
+#if OTBR_ENABLE_REST_TLS
+    if (mTlsEnabled)
+    {
+        return mTls->Read(aBuffer, aLength);
+    }
+#endif
+
+    return read(mFd, aBuffer, aLength);
+}
+
+ssize_t Connection::Send(const struct iovec *aIov, int aIovCount)
+{
+#if OTBR_ENABLE_REST_TLS
+    if (mTlsEnabled)
+    {
+        return mTls->Writev(aIov, aIovCount);
+    }
+#endif
+
+    return writev(mFd, aIov, aIovCount);
+}
+
+uint32_t Connection::GetReadEvents(void) const
+{
+    uint32_t events = EventPoller::kEventReadable;
+
+#if OTBR_ENABLE_REST_TLS
+    if (mTlsEnabled && mTls->WantsWrite())
+    {
+        events |= EventPoller::kEventWritable;
+    }
+#endif
+
+    return events;
+}
+
 } // namespace rest
 } // namespace otbr
@@ -36,9 +36,17 @@
 
 #include <string.h>
 #include <unistd.h>
+#include <sys/uio.h>
 
+#include "common/event_poller.hpp"
+#include "common/timer.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
+#include "rest/worker_pool.hpp"
+
+#if OTBR_ENABLE_REST_TLS
+#include "rest/tls.hpp"
+#endif
 
 using std::chrono::steady_clock;
 
@@ -55,13 +63,14 @@ public:
     /**
      * The constructor is to initialize a socket connection instance.
      *
-     * @param[in]   aStartTime  The reference start time of a conneciton which is set when created for the first time
-     * and maybe reset when transfer to wait callback or wait write state.
-     * @param[in]   aResource   A pointer to the resource handler.
-     * @param[in]   aFd         The file descriptor for the conneciton.
+     * @param[in]   aStartTime      The reference start time of a conneciton which is set when created for the first
+     * time and maybe reset when transfer to wait callback or wait write state.
+     * @param[in]   aResource       A pointer to the resource handler.
+     * @param[in]   aFd             The file descriptor for the conneciton.
+     * @param[in]   aClientAddress  The address of the client.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd, const std::string &aClientAddress);
 
     /**
      * This method initializes the connection.
@@ -71,21 +80,36 @@ public:
     void Init(void);
 
     /**
-     * This method performs processing.
+     * This method resets a completed connection in place, so that it could serve a new socket connection.
+     *
+     * Buffers allocated for the previous socket connection are kept. The connection should be initialized again by
+     * `Init()` after resetting.
      *
-     * @param[in]       aReadFdSet    The read file descriptors.
-     * @param[in]       aWriteFdSet   The write file descriptors.
+     * @param[in]   aStartTime      The reference start time of the new socket connection.
+     * @param[in]   aFd             The file descriptor for the new socket connection.
+     * @param[in]   aClientAddress  The address of the client of the new socket connection.
      *
      */
-    void Process(fd_set &aReadFdSet, fd_set &aWriteFdSet);
+    void Reset(steady_clock::time_point aStartTime, int aFd, const std::string &aClientAddress);
 
+#if OTBR_ENABLE_REST_TLS
     /**
-     * This method updates the file descriptor sets and timeout for mainloop.
+     * This method sets whether the next socket connection is served over TLS, it should be called before `Init()`.
+     *
+     * The TLS session is kept when the connection is reset, along with its record buffers, unless it fails to reset.
+     *
+     * @param[in]   aServer     The TLS configuration, which must outlive the connection, nullptr for plaintext.
      *
-     * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
+     */
+    void SetTls(const TlsServer *aServer);
+#endif
+
+    /**
+     * This method returns the address of the client of this connection.
      *
+     * @returns A string contains the address of the client.
      */
-    void UpdateFdSet(otSysMainloopContext &aMainloop) const;
+    const std::string &GetClientAddress(void) const;
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -96,16 +120,38 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method returns the memory held by this connection, including the buffers kept for its next use.
+     *
+     * @returns The number of bytes allocated.
+     *
+     */
+    size_t GetMemoryUsage(void) const;
+
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
-    void Disconnect(void);
+    static void HandleEvent(void *aContext, int aFd, uint32_t aEvents);
+    void        HandleEvent(uint32_t aEvents);
+    static void HandleTimer(Timer &aTimer, void *aContext);
+    void        HandleTimer(void);
+    void        ProcessWaitRead(void);
+    void        ProcessPendingInput(void);
+    void        ProcessWaitCallback(void);
+    static void HandleCallbackReady(void *aContext);
+    void        WaitNextRequest(void);
+    void        Write(void);
+    void        Render(bool aCompress);
+    void        PrepareBody(bool aCompress);
+    void        Handle(void);
+    void        Disconnect(void);
+    void        StartStream(void);
+    static void HandleStreamEvent(void *aContext, const std::string &aEvent);
+    void        PushStream(const std::string &aEvent);
+    void        ProcessStream(uint32_t aEvents);
+    void        WriteStream(void);
+    void        RecordMetrics(bool aFailed);
+    ssize_t     Receive(void *aBuffer, size_t aLength);
+    ssize_t     Send(const struct iovec *aIov, int aIovCount);
+    uint32_t    GetReadEvents(void) const;
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
@@ -113,6 +159,9 @@ private:
     // File descriptor for this connection
     int mFd;
 
+    // Address of the client, requests are rate limited per client
+    std::string mClientAddress;
+
     // Enum indicates the state of this connection
     ConnectionState mState;
 
@@ -128,8 +177,49 @@ private:
     // Resource handler instance
     Resource *mResource;
 
-    // Write buffer in case write multiple times
-    std::string mWriteContent;
+    // Serialized status line and headers of the response, sent before the response body
+    std::string mWriteHeader;
+
+    // Number of bytes of the response (headers and body) already sent
+    size_t mWriteOffset;
+
+    // Timer for the timeout of current state
+    Timer mTimer;
+
+    // Received data of the current request, which refers to it, followed by data not parsed yet, e.g. pipelined
+    // requests
+    std::string mPendingInput;
+
+    // Number of bytes of the received data parsed for the current request
+    size_t mParsedOffset;
+
+    // Number of requests served on this connection
+    uint32_t mRequestCount;
+
+    // Whether this persistent connection is waiting for its next request
+    bool mIdle;
+
+    // Time when the current request started arriving, was handed to its resource, and its response started sending
+    steady_clock::time_point mRequestStart;
+    steady_clock::time_point mHandleStart;
+    steady_clock::time_point mWriteStart;
+
+    // Whether the current request reached a timeout
+    bool mTimedOut;
+
+    // Events to be sent on an event stream
+    std::string mStreamOutput;
+
+    // Number of bytes of `mStreamOutput` already sent
+    size_t mStreamSent;
+
+#if OTBR_ENABLE_REST_TLS
+    // TLS session, allocated for the first socket connection served over TLS
+    std::unique_ptr<TlsSession> mTls;
+
+    // Whether the socket connection is served over TLS
+    bool mTlsEnabled;
+#endif
 };
 
 } // namespace rest
@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the policy adapting the diagnostics refresh of the RESTful HTTP server.
+ */
+
+#include "rest/diag_policy.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+namespace rest {
+
+// Number of routers for each query waiting for a response at the same time
+static const uint16_t kRoutersPerQuery = 4;
+
+DiagPolicy::DiagPolicy(uint32_t aPeriod,
+                       uint32_t aMinPeriod,
+                       uint32_t aMaxPeriod,
+                       uint8_t  aMaxWindow,
+                       uint16_t aAirtimeBudget)
+    : mPeriod(aPeriod)
+    , mMinPeriod(std::min(aMinPeriod, aPeriod))
+    , mMaxPeriod(std::max(aMaxPeriod, aPeriod))
+    , mWindow(aMaxWindow > 0 ? aMaxWindow : 1)
+    , mMaxWindow(aMaxWindow > 0 ? aMaxWindow : 1)
+    , mAirtimeBudget(aAirtimeBudget)
+    , mResponses(0)
+    , mChanged(0)
+    , mGivenUp(0)
+{
+}
+
+void DiagPolicy::HandleResponse(bool aChanged)
+{
+    mResponses++;
+    mChanged += aChanged ? 1 : 0;
+}
+
+void DiagPolicy::HandleGivenUp(uint32_t aCount)
+{
+    mGivenUp += aCount;
+}
+
+void DiagPolicy::Update(uint16_t aNumRouters, uint64_t aAirtime)
+{
+    uint64_t queried = static_cast<uint64_t>(mResponses) + mGivenUp;
+    bool     lossy   = mGivenUp * 10ull > queried;
+    uint8_t  window  = static_cast<uint8_t>(
+        std::min<uint32_t>(mMaxWindow, std::max<uint32_t>(1, (aNumRouters + kRoutersPerQuery - 1) / kRoutersPerQuery)));
+    uint64_t period = mPeriod;
+
+    // The window backs off fast on losses and grows slowly, as the congestion window of TCP.
+    if (lossy)
+    {
+        mWindow = static_cast<uint8_t>(std::max(1, mWindow / 2));
+        period *= 2;
+    }
+    else if (queried > 0)
+    {
+        mWindow = static_cast<uint8_t>(mWindow + 1);
+
+        if (mChanged * 10ull < mResponses)
+        {
+            period += period / 2;
+        }
+        else if (mChanged * 2ull > mResponses)
+        {
+            period /= 2;
+        }
+    }
+
+    mWindow = std::min(mWindow, window);
+    period  = std::min<uint64_t>(std::max<uint64_t>(period, mMinPeriod), mMaxPeriod);
+
+    // The airtime budget is a hard limit, even above the maximum period.
+    if (mAirtimeBudget > 0)
+    {
+        uint64_t airtime = std::max<uint64_t>(aAirtime, (aNumRouters + 1ull) * kQueryAirtime);
+
+        period = std::max<uint64_t>(period, airtime / mAirtimeBudget);
+    }
+
+    mPeriod    = static_cast<uint32_t>(std::min<uint64_t>(period, UINT32_MAX));
+    mResponses = 0;
+    mChanged   = 0;
+    mGivenUp   = 0;
+}
+
+} // namespace rest
+} // namespace otbr
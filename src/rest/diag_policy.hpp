@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the policy adapting the diagnostics refresh of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_DIAG_POLICY_HPP_
+#define OTBR_REST_DIAG_POLICY_HPP_
+
+#include <stdint.h>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class adapts the period of refreshing the diagnostics and the number of concurrent queries to the network.
+ *
+ * At each refresh, the responses received and the nodes given up since the previous refresh are accounted:
+ * - A loss of more than a tenth of the queries halves the window and doubles the period, otherwise the window grows
+ *   by one, up to a window per four routers.
+ * - The period grows by half when less than a tenth of the responses changed, and halves when more than half of them
+ *   changed, within the minimum and the maximum periods.
+ * - The period is never shorter than the airtime of a refresh divided by the airtime budget, the airtime being the
+ *   one measured since the previous refresh or estimated from the number of routers, whichever is larger.
+ *
+ */
+class DiagPolicy
+{
+public:
+    /**
+     * The estimated airtime (in microseconds) of a query and its response, used before any query is measured.
+     *
+     */
+    static constexpr uint32_t kQueryAirtime = 20000;
+
+    /**
+     * The constructor of a diagnostics refresh policy.
+     *
+     * @param[in]   aPeriod         The initial period (in milliseconds) of refreshing the diagnostics.
+     * @param[in]   aMinPeriod      The minimum period (in milliseconds), unless the airtime budget requires more.
+     * @param[in]   aMaxPeriod      The maximum period (in milliseconds), unless the airtime budget requires more.
+     * @param[in]   aMaxWindow      The maximum number of queries waiting for a response at the same time.
+     * @param[in]   aAirtimeBudget  The share in permille of the time the queries and their responses may take, 0 for
+     *                              no limit.
+     *
+     */
+    DiagPolicy(uint32_t aPeriod, uint32_t aMinPeriod, uint32_t aMaxPeriod, uint8_t aMaxWindow, uint16_t aAirtimeBudget);
+
+    /**
+     * This method accounts a diagnostic response.
+     *
+     * @param[in]   aChanged    Whether the TLVs of the response changed from those received before.
+     *
+     */
+    void HandleResponse(bool aChanged);
+
+    /**
+     * This method accounts the nodes which did not respond to a diagnostic query.
+     *
+     * @param[in]   aCount  The number of nodes given up.
+     *
+     */
+    void HandleGivenUp(uint32_t aCount);
+
+    /**
+     * This method updates the period and the window from the responses and the nodes given up since the previous
+     * update.
+     *
+     * @param[in]   aNumRouters     The number of routers of the Thread network.
+     * @param[in]   aAirtime        The estimated airtime (in microseconds) of the queries sent since the previous
+     *                              update.
+     *
+     */
+    void Update(uint16_t aNumRouters, uint64_t aAirtime);
+
+    /**
+     * This method returns the period of refreshing the diagnostics.
+     *
+     * @returns The period in milliseconds.
+     *
+     */
+    uint32_t GetPeriod(void) const { return mPeriod; }
+
+    /**
+     * This method returns the maximum number of queries waiting for a response at the same time.
+     *
+     * @returns The window.
+     *
+     */
+    uint8_t GetWindow(void) const { return mWindow; }
+
+private:
+    uint32_t mPeriod;
+    uint32_t mMinPeriod;
+    uint32_t mMaxPeriod;
+    uint8_t  mWindow;
+    uint8_t  mMaxWindow;
+    uint16_t mAirtimeBudget;
+
+    // Accounted since the previous update
+    uint32_t mResponses;
+    uint32_t mChanged;
+    uint32_t mGivenUp;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAG_POLICY_HPP_
@@ -0,0 +1,224 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the scheduler of the diagnostic queries of the RESTful HTTP server.
+ */
+
+#include "rest/diag_scheduler.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Delay (in milliseconds) before sending again after failing to send a query
+static const uint32_t kSendRetryDelay = 100;
+
+DiagScheduler::DiagScheduler(uint8_t aWindow, uint8_t aMaxAttempts, uint32_t aTimeout)
+    : mWindow(aWindow > 0 ? aWindow : 1)
+    , mMaxAttempts(aMaxAttempts > 0 ? aMaxAttempts : 1)
+    , mTimeout(aTimeout)
+    , mAirtimeBudget(0)
+    , mAirtime(0)
+{
+}
+
+DiagScheduler::Query *DiagScheduler::FindPending(uint16_t aRloc16)
+{
+    auto it = std::find_if(mPending.begin(), mPending.end(),
+                           [aRloc16](const Query &aQuery) { return aQuery.mRloc16 == aRloc16; });
+
+    return it != mPending.end() ? &*it : nullptr;
+}
+
+std::vector<DiagScheduler::Query>::iterator DiagScheduler::FindInFlight(uint16_t aRloc16)
+{
+    return std::find_if(mInFlight.begin(), mInFlight.end(),
+                        [aRloc16](const Query &aQuery) { return aQuery.mRloc16 == aRloc16; });
+}
+
+void DiagScheduler::Add(uint16_t aRloc16, uint32_t aTlvMask, uint32_t aAirtime, bool aOnDemand)
+{
+    Query *pending  = FindPending(aRloc16);
+    auto   inFlight = FindInFlight(aRloc16);
+    Query  query    = {aRloc16, aTlvMask, 0, aAirtime, aOnDemand, steady_clock::time_point()};
+
+    if (pending != nullptr)
+    {
+        query.mTlvMask |= pending->mTlvMask;
+        query.mAttempts = pending->mAttempts;
+        query.mAirtime  = std::max(pending->mAirtime, aAirtime);
+        query.mOnDemand = pending->mOnDemand || aOnDemand;
+
+        if (query.mOnDemand == pending->mOnDemand)
+        {
+            *pending = query;
+            ExitNow();
+        }
+
+        mPending.erase(mPending.begin() + (pending - &mPending.front()));
+    }
+    else if (inFlight != mInFlight.end() && (aTlvMask & ~inFlight->mTlvMask) == 0)
+    {
+        // A query waiting for a response answers the new one unless it misses some TLV types.
+        ExitNow();
+    }
+
+    // Queries on demand are sent after those already on demand, before the background ones.
+    if (query.mOnDemand)
+    {
+        mPending.insert(std::find_if(mPending.begin(), mPending.end(),
+                                     [](const Query &aQuery) { return !aQuery.mOnDemand; }),
+                        query);
+    }
+    else
+    {
+        mPending.push_back(query);
+    }
+
+exit:
+    return;
+}
+
+uint32_t DiagScheduler::HandleResponse(uint16_t aRloc16)
+{
+    auto     inFlight = FindInFlight(aRloc16);
+    uint32_t tlvMask  = 0;
+
+    if (inFlight != mInFlight.end())
+    {
+        tlvMask = inFlight->mTlvMask;
+        mInFlight.erase(inFlight);
+    }
+
+    // A late response answers the query sent again after timing out.
+    mPending.erase(std::remove_if(mPending.begin(), mPending.end(),
+                                  [aRloc16](const Query &aQuery) {
+                                      return aQuery.mRloc16 == aRloc16 && aQuery.mAttempts > 0;
+                                  }),
+                   mPending.end());
+
+    return tlvMask;
+}
+
+uint32_t DiagScheduler::Process(steady_clock::time_point aNow, Sender aSender, void *aContext)
+{
+    uint32_t givenUp = 0;
+
+    for (auto it = mInFlight.begin(); it != mInFlight.end();)
+    {
+        if (aNow < it->mDeadline)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->mAttempts < mMaxAttempts)
+        {
+            Query *pending = FindPending(it->mRloc16);
+
+            // The query is sent again after those already scheduled.
+            if (pending != nullptr)
+            {
+                pending->mTlvMask |= it->mTlvMask;
+                pending->mAttempts = std::max(pending->mAttempts, it->mAttempts);
+                pending->mAirtime  = std::max(pending->mAirtime, it->mAirtime);
+            }
+            else
+            {
+                mPending.push_back(*it);
+            }
+        }
+        else
+        {
+            ++givenUp;
+        }
+
+        it = mInFlight.erase(it);
+    }
+
+    while (aNow >= mBlockedUntil && mInFlight.size() < mWindow && !mPending.empty() &&
+           (aNow >= mAirtimeUntil || mPending.front().mOnDemand))
+    {
+        Query &query = mPending.front();
+
+        ++query.mAttempts;
+
+        if (!aSender(query.mRloc16, query.mTlvMask, aContext))
+        {
+            // Sending fails for lack of buffers or while detached, wait for a while rather than failing all queries.
+            if (query.mAttempts >= mMaxAttempts)
+            {
+                mPending.pop_front();
+                ++givenUp;
+            }
+
+            mBlockedUntil = aNow + std::chrono::milliseconds(kSendRetryDelay);
+            break;
+        }
+
+        query.mDeadline = aNow + mTimeout;
+        mAirtime += query.mAirtime;
+
+        // The next background query waits until the airtime of this one is within the budget.
+        if (mAirtimeBudget > 0)
+        {
+            mAirtimeUntil = std::max(mAirtimeUntil, aNow) +
+                            std::chrono::microseconds(static_cast<uint64_t>(query.mAirtime) * 1000 / mAirtimeBudget);
+        }
+
+        mInFlight.push_back(query);
+        mPending.pop_front();
+    }
+
+    return givenUp;
+}
+
+steady_clock::time_point DiagScheduler::GetNextTime(void) const
+{
+    steady_clock::time_point next = steady_clock::time_point::max();
+
+    for (const Query &query : mInFlight)
+    {
+        next = std::min(next, query.mDeadline);
+    }
+
+    if (!mPending.empty() && mInFlight.size() < mWindow)
+    {
+        next = std::min(next, mPending.front().mOnDemand ? mBlockedUntil : std::max(mBlockedUntil, mAirtimeUntil));
+    }
+
+    return next;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,207 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the scheduler of the diagnostic queries of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_DIAG_SCHEDULER_HPP_
+#define OTBR_REST_DIAG_SCHEDULER_HPP_
+
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include <stdint.h>
+
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a scheduler of unicast diagnostic queries.
+ *
+ * Queries are sent to the nodes in turn, with no more than a window of them waiting for a response at the same time,
+ * so the responses do not arrive all at once. A query which is not answered within the timeout is sent again, until
+ * the maximum number of attempts is reached.
+ *
+ * The estimated airtime of the queries sent can be limited to a share of the time, each query then delays the next
+ * one by its airtime divided by the share. Queries on demand of a client are not delayed, they are sent before the
+ * others and only delay the next background query.
+ *
+ */
+class DiagScheduler
+{
+public:
+    /**
+     * This function pointer is called to send a diagnostic query.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node to query.
+     * @param[in]   aTlvMask    The bit mask of the TLV types to query.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     * @retval  true     The query is sent.
+     * @retval  false    The query failed to be sent, e.g. for lack of message buffers.
+     *
+     */
+    typedef bool (*Sender)(uint16_t aRloc16, uint32_t aTlvMask, void *aContext);
+
+    /**
+     * The constructor of a diagnostic scheduler.
+     *
+     * @param[in]   aWindow         The maximum number of queries waiting for a response at the same time.
+     * @param[in]   aMaxAttempts    The maximum number of times a query is sent to a node.
+     * @param[in]   aTimeout        The time (in milliseconds) to wait for a response before sending the query again.
+     *
+     */
+    DiagScheduler(uint8_t aWindow, uint8_t aMaxAttempts, uint32_t aTimeout);
+
+    /**
+     * This method sets the maximum number of queries waiting for a response at the same time.
+     *
+     * The queries already waiting for a response are kept when the window shrinks below their number.
+     *
+     * @param[in]   aWindow     The maximum number of queries waiting for a response at the same time.
+     *
+     */
+    void SetWindow(uint8_t aWindow) { mWindow = aWindow > 0 ? aWindow : 1; }
+
+    /**
+     * This method returns the maximum number of queries waiting for a response at the same time.
+     *
+     * @returns The maximum number of queries waiting for a response at the same time.
+     *
+     */
+    uint8_t GetWindow(void) const { return mWindow; }
+
+    /**
+     * This method sets the share of the time the estimated airtime of the queries sent is limited to.
+     *
+     * @param[in]   aBudget     The share of the time in permille, 0 for no limit.
+     *
+     */
+    void SetAirtimeBudget(uint16_t aBudget) { mAirtimeBudget = aBudget; }
+
+    /**
+     * This method returns the total estimated airtime of the queries sent.
+     *
+     * @returns The total estimated airtime in microseconds.
+     *
+     */
+    uint64_t GetAirtime(void) const { return mAirtime; }
+
+    /**
+     * This method schedules a query of a node.
+     *
+     * A node already scheduled is queried once, for the TLV types of both queries.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node to query.
+     * @param[in]   aTlvMask    The bit mask of the TLV types to query.
+     * @param[in]   aAirtime    The estimated airtime (in microseconds) of the query and its response.
+     * @param[in]   aOnDemand   Whether a client waits for the query, which is then not delayed by the airtime budget.
+     *
+     */
+    void Add(uint16_t aRloc16, uint32_t aTlvMask, uint32_t aAirtime = 0, bool aOnDemand = false);
+
+    /**
+     * This method handles a response of a node, which frees its place in the window.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the responding node.
+     *
+     * @returns The bit mask of the TLV types queried from the node, 0 if no query of the node waits for a response.
+     *
+     */
+    uint32_t HandleResponse(uint16_t aRloc16);
+
+    /**
+     * This method sends the queries the window has room for, and again those not answered in time.
+     *
+     * @param[in]   aNow        The current time.
+     * @param[in]   aSender     The function to send a query.
+     * @param[in]   aContext    A pointer to application-specific context passed to @p aSender.
+     *
+     * @returns The number of nodes given up in this call, after the maximum number of attempts.
+     *
+     */
+    uint32_t Process(steady_clock::time_point aNow, Sender aSender, void *aContext);
+
+    /**
+     * This method indicates whether some query is still scheduled or waiting for a response.
+     *
+     * @retval  true     Some query is not done.
+     * @retval  false    All queries are answered or given up.
+     *
+     */
+    bool IsBusy(void) const { return !mPending.empty() || !mInFlight.empty(); }
+
+    /**
+     * This method returns the time `Process()` should be called next.
+     *
+     * @returns The earliest time a query times out or a failed query is sent again, only valid when busy.
+     *
+     */
+    steady_clock::time_point GetNextTime(void) const;
+
+private:
+    struct Query
+    {
+        uint16_t                 mRloc16;   ///< The RLOC16 of the node.
+        uint32_t                 mTlvMask;  ///< The bit mask of the TLV types to query.
+        uint8_t                  mAttempts; ///< The number of times the query was sent or failed to be sent.
+        uint32_t                 mAirtime;  ///< The estimated airtime in microseconds of the query and its response.
+        bool                     mOnDemand; ///< Whether a client waits for the query.
+        steady_clock::time_point mDeadline; ///< The time the response is given up, or the query is sent again.
+    };
+
+    Query *                      FindPending(uint16_t aRloc16);
+    std::vector<Query>::iterator FindInFlight(uint16_t aRloc16);
+
+    uint8_t                   mWindow;
+    uint8_t                   mMaxAttempts;
+    std::chrono::milliseconds mTimeout;
+
+    // Queries to send, in order
+    std::deque<Query> mPending;
+    // Queries waiting for a response
+    std::vector<Query> mInFlight;
+    // Time to send the pending queries again after failing to send one, the epoch if none failed
+    steady_clock::time_point mBlockedUntil;
+    // Share of the time in permille the airtime of the queries is limited to, 0 for no limit
+    uint16_t mAirtimeBudget;
+    // Total estimated airtime in microseconds of the queries sent
+    uint64_t mAirtime;
+    // Time the airtime of the queries sent fits in the budget
+    steady_clock::time_point mAirtimeUntil;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAG_SCHEDULER_HPP_
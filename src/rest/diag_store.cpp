@@ -0,0 +1,578 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the diagnostics store of the RESTful HTTP server.
+ */
+
+#include "rest/diag_store.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Size of the type and length of a packed TLV.
+static const size_t kTlvHeaderSize = 3;
+
+// Size of the RLOC16, the TLV mask, the receive time and the TLVs length of a node saved to the state cache.
+static const size_t kSavedNodeHeaderSize = sizeof(uint16_t) + sizeof(uint32_t) + sizeof(int64_t) + sizeof(uint16_t);
+
+// Returns the bit of a TLV type in a TLV mask, types out of the mask are never answered.
+static uint32_t TypeMask(uint8_t aType)
+{
+    return aType < kNumMaskTypes ? (1u << aType) : 0;
+}
+
+static size_t TlvSize(const uint8_t *aTlv)
+{
+    return kTlvHeaderSize + ((static_cast<size_t>(aTlv[1]) << 8) | aTlv[2]);
+}
+
+// Returns the offset of the next TLV of a type from an offset, the size of the TLVs if none.
+static size_t FindTlv(const std::vector<uint8_t> &aTlvs, uint8_t aType, size_t aOffset)
+{
+    while (aOffset + kTlvHeaderSize <= aTlvs.size() && aTlvs[aOffset] != aType)
+    {
+        aOffset += TlvSize(&aTlvs[aOffset]);
+    }
+
+    return aOffset + kTlvHeaderSize <= aTlvs.size() ? aOffset : aTlvs.size();
+}
+
+// Returns the bit mask of the TLV types of a mask whose TLVs differ between two packed TLVs, in order.
+static uint32_t ChangedTypes(const std::vector<uint8_t> &aOld, const std::vector<uint8_t> &aNew, uint32_t aTlvMask)
+{
+    uint32_t changed = 0;
+
+    for (uint8_t type = 0; type < kNumMaskTypes; type++)
+    {
+        size_t oldOffset;
+        size_t newOffset;
+
+        if ((aTlvMask & TypeMask(type)) == 0)
+        {
+            continue;
+        }
+
+        oldOffset = FindTlv(aOld, type, 0);
+        newOffset = FindTlv(aNew, type, 0);
+
+        while (oldOffset < aOld.size() && newOffset < aNew.size())
+        {
+            size_t size = TlvSize(&aOld[oldOffset]);
+
+            if (size != TlvSize(&aNew[newOffset]) || oldOffset + size > aOld.size() ||
+                newOffset + size > aNew.size() || memcmp(&aOld[oldOffset], &aNew[newOffset], size) != 0)
+            {
+                break;
+            }
+
+            oldOffset = FindTlv(aOld, type, oldOffset + size);
+            newOffset = FindTlv(aNew, type, newOffset + size);
+        }
+
+        if (oldOffset < aOld.size() || newOffset < aNew.size())
+        {
+            changed |= TypeMask(type);
+        }
+    }
+
+    return changed;
+}
+
+// Returns the number of TLV types in a TLV mask.
+static size_t CountTypes(uint32_t aTlvMask)
+{
+    size_t count = 0;
+
+    for (; aTlvMask != 0; aTlvMask &= aTlvMask - 1)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+// Returns a duration in milliseconds, saturated to the range of a TLV age.
+static uint32_t ToAge(steady_clock::duration aDuration)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    int64_t age = duration_cast<milliseconds>(aDuration).count();
+
+    return static_cast<uint32_t>(std::min<int64_t>(std::max<int64_t>(age, 0), UINT32_MAX));
+}
+
+// Returns the wall clock time in milliseconds, which unlike the steady clock is kept across restarts.
+static int64_t GetWallClockMilliseconds(void)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    return duration_cast<milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Returns the number of bytes of the value of a TLV in use, i.e. up to the last entry of a list.
+static size_t GetTlvValueLength(const otNetworkDiagTlv &aTlv)
+{
+    const uint8_t *value = reinterpret_cast<const uint8_t *>(&aTlv.mData);
+    const void *   end;
+
+    switch (aTlv.mType)
+    {
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        end = &aTlv.mData.mExtAddress + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+        end = &aTlv.mData.mAddr16 + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+        end = &aTlv.mData.mMode + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+        end = &aTlv.mData.mTimeout + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+        end = &aTlv.mData.mConnectivity + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+        end = &aTlv.mData.mRoute.mRouteData[aTlv.mData.mRoute.mRouteCount];
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+        end = &aTlv.mData.mLeaderData + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+        end = &aTlv.mData.mNetworkData.m8[aTlv.mData.mNetworkData.mCount];
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+        end = &aTlv.mData.mIp6AddrList.mList[aTlv.mData.mIp6AddrList.mCount];
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+        end = &aTlv.mData.mMacCounters + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+        end = &aTlv.mData.mBatteryLevel + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+        end = &aTlv.mData.mSupplyVoltage + 1;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+        end = &aTlv.mData.mChildTable.mTable[aTlv.mData.mChildTable.mCount];
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+        end = &aTlv.mData.mChannelPages.m8[aTlv.mData.mChannelPages.mCount];
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+        end = &aTlv.mData.mMaxChildTimeout + 1;
+        break;
+    default:
+        end = value;
+        break;
+    }
+
+    return std::min(static_cast<size_t>(static_cast<const uint8_t *>(end) - value), sizeof(aTlv.mData));
+}
+
+static bool IsRloc16Less(const DiagInfo &aInfo, uint16_t aRloc16)
+{
+    return aInfo.mRloc16 < aRloc16;
+}
+
+static bool IsReceivedEarlier(const DiagInfo &aFirst, const DiagInfo &aSecond)
+{
+    return aFirst.mStartTime < aSecond.mStartTime;
+}
+
+void DiagStore::AppendTlv(std::vector<uint8_t> &aTlvs, const otNetworkDiagTlv &aTlv)
+{
+    const uint8_t *value  = reinterpret_cast<const uint8_t *>(&aTlv.mData);
+    size_t         length = GetTlvValueLength(aTlv);
+
+    aTlvs.push_back(aTlv.mType);
+    aTlvs.push_back(static_cast<uint8_t>(length >> 8));
+    aTlvs.push_back(static_cast<uint8_t>(length & 0xff));
+    aTlvs.insert(aTlvs.end(), value, value + length);
+}
+
+bool DiagStore::GetNextTlv(const DiagInfo &aInfo, size_t &aOffset, otNetworkDiagTlv &aTlv)
+{
+    const std::vector<uint8_t> &tlvs = aInfo.mDiagContent;
+    bool                        found = false;
+    size_t                      length;
+
+    VerifyOrExit(aOffset + kTlvHeaderSize <= tlvs.size());
+
+    length = (static_cast<size_t>(tlvs[aOffset + 1]) << 8) | tlvs[aOffset + 2];
+    VerifyOrExit(length <= sizeof(aTlv.mData) && aOffset + kTlvHeaderSize + length <= tlvs.size());
+
+    // The packed value is not aligned, unpack it into the TLV rather than pointing into the store.
+    aTlv.mType = tlvs[aOffset];
+    memcpy(&aTlv.mData, &tlvs[aOffset + kTlvHeaderSize], length);
+    aOffset += kTlvHeaderSize + length;
+    found = true;
+
+exit:
+    return found;
+}
+
+const DiagInfo *DiagStore::Find(uint16_t aRloc16) const
+{
+    const DiagInfo *info = nullptr;
+    auto            it   = std::lower_bound(mNodes.begin(), mNodes.end(), aRloc16, IsRloc16Less);
+
+    if (it != mNodes.end() && it->mRloc16 == aRloc16)
+    {
+        info = &*it;
+    }
+
+    return info;
+}
+
+steady_clock::time_point DiagStore::GetTlvTime(const DiagInfo &aInfo, uint8_t aType)
+{
+    uint32_t age = (aType < kNumMaskTypes) ? aInfo.mTlvAges[aType] : 0;
+
+    return aInfo.mStartTime - std::chrono::milliseconds(age);
+}
+
+DiagInfo &DiagStore::Update(uint16_t                 aRloc16,
+                            std::vector<uint8_t> &   aTlvs,
+                            uint32_t                 aTlvMask,
+                            steady_clock::time_point aTime,
+                            uint32_t *               aChanged)
+{
+    auto     it       = std::lower_bound(mNodes.begin(), mNodes.end(), aRloc16, IsRloc16Less);
+    uint32_t answered = aTlvMask;
+    size_t   offset   = 0;
+    uint32_t age;
+
+    if (it == mNodes.end() || it->mRloc16 != aRloc16)
+    {
+        it             = mNodes.insert(it, DiagInfo());
+        it->mRloc16    = aRloc16;
+        it->mTlvMask   = 0;
+        it->mStartTime = aTime;
+    }
+
+    for (size_t i = 0; i + kTlvHeaderSize <= aTlvs.size();)
+    {
+        answered |= TypeMask(aTlvs[i]);
+        i += kTlvHeaderSize + ((static_cast<size_t>(aTlvs[i + 1]) << 8) | aTlvs[i + 2]);
+    }
+
+    if (aChanged != nullptr)
+    {
+        *aChanged = ChangedTypes(it->mDiagContent, aTlvs, answered);
+    }
+
+    // A query of some TLV types only answers those, keep the TLVs of the other types.
+    while (offset + kTlvHeaderSize <= it->mDiagContent.size())
+    {
+        const uint8_t *tlv  = &it->mDiagContent[offset];
+        size_t         size = kTlvHeaderSize + ((static_cast<size_t>(tlv[1]) << 8) | tlv[2]);
+
+        if (TypeMask(tlv[0]) != 0 && (answered & TypeMask(tlv[0])) == 0)
+        {
+            aTlvs.insert(aTlvs.end(), tlv, tlv + size);
+        }
+
+        offset += size;
+    }
+
+    // The ages are relative to the latest response, a response received out of order is older than it.
+    if (aTime > it->mStartTime)
+    {
+        age = ToAge(aTime - it->mStartTime);
+
+        for (uint8_t type = 0; type < kNumMaskTypes; type++)
+        {
+            it->mTlvAges[type] = (UINT32_MAX - it->mTlvAges[type] > age) ? it->mTlvAges[type] + age : UINT32_MAX;
+        }
+
+        it->mStartTime = aTime;
+    }
+
+    age = ToAge(it->mStartTime - aTime);
+
+    for (uint8_t type = 0; type < kNumMaskTypes; type++)
+    {
+        if (answered & TypeMask(type))
+        {
+            it->mTlvAges[type] = age;
+        }
+    }
+
+    it->mTlvMask |= answered;
+    SetContent(*it, aTlvs);
+
+    return *it;
+}
+
+void DiagStore::SetContent(DiagInfo &aInfo, std::vector<uint8_t> &aTlvs)
+{
+    UpdateMeshCounters(aInfo.mDiagContent, false);
+    mTlvBytes -= aInfo.mDiagContent.capacity();
+    aInfo.mDiagContent.swap(aTlvs);
+    aInfo.mDiagContent.shrink_to_fit();
+    mTlvBytes += aInfo.mDiagContent.capacity();
+    UpdateMeshCounters(aInfo.mDiagContent, true);
+    mVersion++;
+}
+
+void DiagStore::Remove(const DiagInfo &aInfo)
+{
+    UpdateMeshCounters(aInfo.mDiagContent, false);
+    mTlvBytes -= aInfo.mDiagContent.capacity();
+    mVersion++;
+}
+
+void DiagStore::UpdateMeshCounters(const std::vector<uint8_t> &aTlvs, bool aAdd)
+{
+    size_t                   offset = FindTlv(aTlvs, OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS, 0);
+    otNetworkDiagMacCounters counters;
+
+    VerifyOrExit(offset < aTlvs.size() && TlvSize(&aTlvs[offset]) == kTlvHeaderSize + sizeof(counters) &&
+                 offset + kTlvHeaderSize + sizeof(counters) <= aTlvs.size());
+    memcpy(&counters, &aTlvs[offset + kTlvHeaderSize], sizeof(counters));
+
+    // The sums are unsigned, subtracting the counters added before never wraps them.
+    if (aAdd)
+    {
+        mMeshCounters.mIfInUnknownProtos += counters.mIfInUnknownProtos;
+        mMeshCounters.mIfInErrors += counters.mIfInErrors;
+        mMeshCounters.mIfOutErrors += counters.mIfOutErrors;
+        mMeshCounters.mIfInUcastPkts += counters.mIfInUcastPkts;
+        mMeshCounters.mIfInBroadcastPkts += counters.mIfInBroadcastPkts;
+        mMeshCounters.mIfInDiscards += counters.mIfInDiscards;
+        mMeshCounters.mIfOutUcastPkts += counters.mIfOutUcastPkts;
+        mMeshCounters.mIfOutBroadcastPkts += counters.mIfOutBroadcastPkts;
+        mMeshCounters.mIfOutDiscards += counters.mIfOutDiscards;
+        mMeshCounters.mNumNodes++;
+    }
+    else
+    {
+        mMeshCounters.mIfInUnknownProtos -= counters.mIfInUnknownProtos;
+        mMeshCounters.mIfInErrors -= counters.mIfInErrors;
+        mMeshCounters.mIfOutErrors -= counters.mIfOutErrors;
+        mMeshCounters.mIfInUcastPkts -= counters.mIfInUcastPkts;
+        mMeshCounters.mIfInBroadcastPkts -= counters.mIfInBroadcastPkts;
+        mMeshCounters.mIfInDiscards -= counters.mIfInDiscards;
+        mMeshCounters.mIfOutUcastPkts -= counters.mIfOutUcastPkts;
+        mMeshCounters.mIfOutBroadcastPkts -= counters.mIfOutBroadcastPkts;
+        mMeshCounters.mIfOutDiscards -= counters.mIfOutDiscards;
+        mMeshCounters.mNumNodes--;
+    }
+
+exit:
+    return;
+}
+
+void DiagStore::EraseOlderThan(steady_clock::time_point aTime)
+{
+    mNodes.erase(std::remove_if(mNodes.begin(), mNodes.end(),
+                                [this, aTime](const DiagInfo &aInfo) {
+                                    bool expired = aInfo.mStartTime < aTime;
+
+                                    if (expired)
+                                    {
+                                        Remove(aInfo);
+                                    }
+
+                                    return expired;
+                                }),
+                 mNodes.end());
+}
+
+bool DiagStore::EraseTlvsOlderThan(steady_clock::time_point aTime, uint32_t aTlvMask)
+{
+    bool erased = false;
+
+    for (DiagInfo &info : mNodes)
+    {
+        uint32_t             expired = 0;
+        std::vector<uint8_t> tlvs;
+        size_t               offset = 0;
+
+        for (uint8_t type = 0; type < kNumMaskTypes; type++)
+        {
+            if ((info.mTlvMask & aTlvMask & TypeMask(type)) != 0 && GetTlvTime(info, type) < aTime)
+            {
+                expired |= TypeMask(type);
+            }
+        }
+
+        if (expired == 0)
+        {
+            continue;
+        }
+
+        while (offset + kTlvHeaderSize <= info.mDiagContent.size())
+        {
+            const uint8_t *tlv  = &info.mDiagContent[offset];
+            size_t         size = kTlvHeaderSize + ((static_cast<size_t>(tlv[1]) << 8) | tlv[2]);
+
+            if ((expired & TypeMask(tlv[0])) == 0)
+            {
+                tlvs.insert(tlvs.end(), tlv, tlv + size);
+            }
+
+            offset += size;
+        }
+
+        info.mTlvMask &= ~expired;
+        SetContent(info, tlvs);
+        erased = true;
+    }
+
+    return erased;
+}
+
+uint16_t DiagStore::EraseOldest(void)
+{
+    auto     oldest = std::min_element(mNodes.begin(), mNodes.end(), IsReceivedEarlier);
+    uint16_t rloc16;
+
+    assert(oldest != mNodes.end());
+
+    rloc16 = oldest->mRloc16;
+    Remove(*oldest);
+    mNodes.erase(oldest);
+
+    return rloc16;
+}
+
+void DiagStore::Save(std::vector<uint8_t> &aRecord, size_t aMaxLength) const
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    steady_clock::time_point now     = steady_clock::now();
+    int64_t                  wallNow = GetWallClockMilliseconds();
+
+    aRecord.clear();
+
+    for (const DiagInfo &info : mNodes)
+    {
+        int64_t  received = wallNow - duration_cast<milliseconds>(now - info.mStartTime).count();
+        uint16_t length   = static_cast<uint16_t>(info.mDiagContent.size());
+        size_t   ages     = CountTypes(info.mTlvMask) * sizeof(uint32_t);
+        uint8_t  header[kSavedNodeHeaderSize];
+
+        if (info.mDiagContent.size() > UINT16_MAX || aRecord.size() + sizeof(header) + ages + length > aMaxLength)
+        {
+            break;
+        }
+
+        memcpy(header, &info.mRloc16, sizeof(uint16_t));
+        memcpy(header + sizeof(uint16_t), &info.mTlvMask, sizeof(uint32_t));
+        memcpy(header + sizeof(uint16_t) + sizeof(uint32_t), &received, sizeof(int64_t));
+        memcpy(header + sizeof(uint16_t) + sizeof(uint32_t) + sizeof(int64_t), &length, sizeof(uint16_t));
+
+        aRecord.insert(aRecord.end(), header, header + sizeof(header));
+
+        // The ages of the answered TLV types follow the header, in the order of the types.
+        for (uint8_t type = 0; type < kNumMaskTypes; type++)
+        {
+            if (info.mTlvMask & TypeMask(type))
+            {
+                const uint8_t *age = reinterpret_cast<const uint8_t *>(&info.mTlvAges[type]);
+
+                aRecord.insert(aRecord.end(), age, age + sizeof(uint32_t));
+            }
+        }
+
+        aRecord.insert(aRecord.end(), info.mDiagContent.begin(), info.mDiagContent.end());
+    }
+}
+
+size_t DiagStore::Restore(const std::vector<uint8_t> &aRecord, steady_clock::time_point aExpired)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    steady_clock::time_point now      = steady_clock::now();
+    int64_t                  wallNow  = GetWallClockMilliseconds();
+    int64_t                  maxAge   = duration_cast<milliseconds>(now - aExpired).count();
+    size_t                   restored = 0;
+
+    for (size_t offset = 0; offset + kSavedNodeHeaderSize <= aRecord.size();)
+    {
+        const uint8_t *header = &aRecord[offset];
+        uint16_t       rloc16;
+        uint32_t       tlvMask;
+        int64_t        received;
+        int64_t        age;
+        uint16_t       length;
+        size_t         ages;
+
+        memcpy(&rloc16, header, sizeof(uint16_t));
+        memcpy(&tlvMask, header + sizeof(uint16_t), sizeof(uint32_t));
+        memcpy(&received, header + sizeof(uint16_t) + sizeof(uint32_t), sizeof(int64_t));
+        memcpy(&length, header + sizeof(uint16_t) + sizeof(uint32_t) + sizeof(int64_t), sizeof(uint16_t));
+        ages = CountTypes(tlvMask) * sizeof(uint32_t);
+        VerifyOrExit(offset + kSavedNodeHeaderSize + ages + length <= aRecord.size());
+
+        // A wall clock set back is taken as no time elapsed.
+        age = std::max<int64_t>(wallNow - received, 0);
+
+        if (age < maxAge)
+        {
+            const uint8_t *      tlvAge = header + kSavedNodeHeaderSize;
+            std::vector<uint8_t> tlvs(tlvAge + ages, tlvAge + ages + length);
+            DiagInfo &           info = Update(rloc16, tlvs, tlvMask, now - milliseconds(age));
+
+            for (uint8_t type = 0; type < kNumMaskTypes; type++)
+            {
+                if (tlvMask & TypeMask(type))
+                {
+                    memcpy(&info.mTlvAges[type], tlvAge, sizeof(uint32_t));
+                    tlvAge += sizeof(uint32_t);
+                }
+            }
+
+            info.mTlvMask = tlvMask;
+            restored++;
+        }
+
+        offset += kSavedNodeHeaderSize + ages + length;
+    }
+
+exit:
+    return restored;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,257 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the diagnostics store of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_DIAG_STORE_HPP_
+#define OTBR_REST_DIAG_STORE_HPP_
+
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class stores the diagnostic TLVs received from each node, ordered by the RLOC16 of the node.
+ *
+ * Only the TLVs received are stored, each packed as its type, its length and the used part of its value, so a node
+ * costs a few hundred bytes instead of a full `otNetworkDiagTlv` per TLV type.
+ *
+ * The TLVs of a response are merged into those received before, and the time each TLV type was answered is kept, so
+ * TLV types changing often can be queried more often than the others.
+ *
+ * The MAC counters of all nodes are summed as their TLVs are merged and removed, so the mesh-wide counters are read
+ * without walking the nodes.
+ *
+ */
+class DiagStore
+{
+public:
+    typedef std::vector<DiagInfo>::const_iterator ConstIterator;
+
+    /**
+     * The constructor of an empty store.
+     *
+     */
+    DiagStore(void)
+        : mTlvBytes(0)
+        , mMeshCounters()
+        , mVersion(0)
+    {
+    }
+
+    /**
+     * This method appends a TLV to packed TLVs.
+     *
+     * @param[inout]    aTlvs   The packed TLVs.
+     * @param[in]       aTlv    The TLV to append.
+     *
+     */
+    static void AppendTlv(std::vector<uint8_t> &aTlvs, const otNetworkDiagTlv &aTlv);
+
+    /**
+     * This method unpacks the next TLV of a node.
+     *
+     * @param[in]       aInfo     The diagnostics of the node.
+     * @param[inout]    aOffset   The offset of the next TLV in the packed TLVs, 0 for the first TLV.
+     * @param[out]      aTlv      The unpacked TLV.
+     *
+     * @retval  true    A TLV was unpacked.
+     * @retval  false   There is no more TLV.
+     *
+     */
+    static bool GetNextTlv(const DiagInfo &aInfo, size_t &aOffset, otNetworkDiagTlv &aTlv);
+
+    /**
+     * This method finds the diagnostics of a node.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     *
+     * @returns A pointer to the diagnostics, or nullptr if there is none. It is invalidated by any update.
+     *
+     */
+    const DiagInfo *Find(uint16_t aRloc16) const;
+
+    /**
+     * This method returns the time a TLV type of a node was answered.
+     *
+     * @param[in]   aInfo   The diagnostics of the node.
+     * @param[in]   aType   The TLV type, which must be in the TLV mask of the node.
+     *
+     * @returns The time of the latest response answering the TLV type.
+     *
+     */
+    static steady_clock::time_point GetTlvTime(const DiagInfo &aInfo, uint8_t aType);
+
+    /**
+     * This method merges the TLVs received from a node into its diagnostics.
+     *
+     * The TLVs received replace the stored TLVs of the answered types, the stored TLVs of other types are kept.
+     *
+     * @param[in]       aRloc16     The RLOC16 of the node.
+     * @param[inout]    aTlvs       The packed TLVs received, they are moved into the store.
+     * @param[in]       aTlvMask    The bit mask of the TLV types answered, including those the node has none of. The
+     *                              types of the TLVs received are always answered.
+     * @param[in]       aTime       The time the TLVs were received.
+     * @param[out]      aChanged    A pointer to the bit mask of the answered TLV types whose TLVs differ from those
+     *                              stored, may be nullptr.
+     *
+     * @returns A reference to the diagnostics of the node.
+     *
+     */
+    DiagInfo &Update(uint16_t                 aRloc16,
+                     std::vector<uint8_t> &   aTlvs,
+                     uint32_t                 aTlvMask,
+                     steady_clock::time_point aTime,
+                     uint32_t *               aChanged = nullptr);
+
+    /**
+     * This method removes the diagnostics received before a time.
+     *
+     * @param[in]   aTime   The time.
+     *
+     */
+    void EraseOlderThan(steady_clock::time_point aTime);
+
+    /**
+     * This method removes the TLVs of some types answered before a time, from all nodes.
+     *
+     * The nodes themselves are kept, as the TLVs of other types may still be fresh.
+     *
+     * @param[in]   aTime       The time.
+     * @param[in]   aTlvMask    The bit mask of the TLV types.
+     *
+     * @retval  true    Some TLV type of some node was removed.
+     * @retval  false   No TLV type was removed.
+     *
+     */
+    bool EraseTlvsOlderThan(steady_clock::time_point aTime, uint32_t aTlvMask);
+
+    /**
+     * This method removes the diagnostics received the longest time ago.
+     *
+     * @returns The RLOC16 of the node removed, the store must not be empty.
+     *
+     */
+    uint16_t EraseOldest(void);
+
+    /**
+     * This method saves the diagnostics to a record of the state cache, until the record is full.
+     *
+     * The packed TLVs and the times their types were answered are saved as they are stored, they are only restored by
+     * the same build.
+     *
+     * @param[out]  aRecord     The record.
+     * @param[in]   aMaxLength  The maximum length of the record in bytes.
+     *
+     */
+    void Save(std::vector<uint8_t> &aRecord, size_t aMaxLength) const;
+
+    /**
+     * This method restores the diagnostics saved to a record of the state cache.
+     *
+     * The time the diagnostics were received is kept across the restart, those received before a time are skipped.
+     *
+     * @param[in]   aRecord     The record.
+     * @param[in]   aExpired    The time before which the diagnostics are expired.
+     *
+     * @returns The number of nodes restored.
+     *
+     */
+    size_t Restore(const std::vector<uint8_t> &aRecord, steady_clock::time_point aExpired);
+
+    /**
+     * This method returns the memory held by the store.
+     *
+     * @returns The number of bytes allocated for the nodes and their packed TLVs.
+     *
+     */
+    size_t GetMemoryUsage(void) const { return mNodes.capacity() * sizeof(DiagInfo) + mTlvBytes; }
+
+    /**
+     * This method indicates whether the store is empty.
+     *
+     * @retval  true    No diagnostics is stored.
+     * @retval  false   The diagnostics of at least one node is stored.
+     *
+     */
+    bool IsEmpty(void) const { return mNodes.empty(); }
+
+    /**
+     * This method returns the sums of the MAC counters of the nodes.
+     *
+     * @returns A reference to the sums, updated by any change of the store.
+     *
+     */
+    const MeshCounters &GetMeshCounters(void) const { return mMeshCounters; }
+
+    /**
+     * This method returns the version of the store, which is bumped by any change of the stored diagnostics.
+     *
+     * @returns The version.
+     *
+     */
+    uint32_t GetVersion(void) const { return mVersion; }
+
+    /**
+     * This method returns an iterator to the diagnostics of the node with the lowest RLOC16.
+     *
+     */
+    ConstIterator begin(void) const { return mNodes.begin(); }
+
+    /**
+     * This method returns an iterator past the diagnostics of the last node.
+     *
+     */
+    ConstIterator end(void) const { return mNodes.end(); }
+
+private:
+    void SetContent(DiagInfo &aInfo, std::vector<uint8_t> &aTlvs);
+    void Remove(const DiagInfo &aInfo);
+    void UpdateMeshCounters(const std::vector<uint8_t> &aTlvs, bool aAdd);
+
+    std::vector<DiagInfo> mNodes;
+    size_t                mTlvBytes;     ///< Bytes allocated for the packed TLVs of all nodes.
+    MeshCounters          mMeshCounters; ///< Sums of the MAC counters TLVs of all nodes.
+    uint32_t              mVersion;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAG_STORE_HPP_
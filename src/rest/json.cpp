@@ -30,449 +30,918 @@
 
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
-
-extern "C" {
-#include <cJSON.h>
-}
+#include "rest/diag_store.hpp"
+#include "rest/json_writer.hpp"
 
 namespace otbr {
 namespace rest {
 namespace Json {
 
-static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
+static void Mode2Json(JsonWriter &aWriter, const otLinkModeConfig &aMode)
 {
-    char hex[2 * aLength + 1];
-
-    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
-    hex[2 * aLength] = '\0';
-
-    return cJSON_CreateString(hex);
+    aWriter.BeginObject();
+    aWriter.Member("RxOnWhenIdle", aMode.mRxOnWhenIdle);
+    aWriter.Member("DeviceType", aMode.mDeviceType);
+    aWriter.Member("NetworkData", aMode.mNetworkData);
+    aWriter.EndObject();
 }
 
-std::string String2JsonString(const std::string &aString)
+void IpAddr2Json(JsonWriter &aWriter, const otIp6Address &aAddress)
 {
-    std::string ret;
-    cJSON *     json    = nullptr;
-    char *      jsonOut = nullptr;
-
-    VerifyOrExit(aString.size() > 0);
+    Ip6Address addr(aAddress.mFields.m8);
+    char       buffer[Ip6Address::kStringSize];
 
-    json    = cJSON_CreateString(aString.c_str());
-    jsonOut = cJSON_Print(json);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
+    aWriter.String(buffer, addr.ToString(buffer));
+}
 
-    cJSON_Delete(json);
+static void ChildTableEntry2Json(JsonWriter &aWriter, const otNetworkDiagChildEntry &aChildEntry)
+{
+    aWriter.BeginObject();
+    aWriter.Member("ChildId", aChildEntry.mChildId);
+    aWriter.Member("Timeout", aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    Mode2Json(aWriter, aChildEntry.mMode);
+    aWriter.EndObject();
+}
 
-exit:
-    return ret;
+static void MacCounters2Json(JsonWriter &aWriter, const otNetworkDiagMacCounters &aMacCounters)
+{
+    aWriter.BeginObject();
+    aWriter.Member("IfInUnknownProtos", aMacCounters.mIfInUnknownProtos);
+    aWriter.Member("IfInErrors", aMacCounters.mIfInErrors);
+    aWriter.Member("IfOutErrors", aMacCounters.mIfOutErrors);
+    aWriter.Member("IfInUcastPkts", aMacCounters.mIfInUcastPkts);
+    aWriter.Member("IfInBroadcastPkts", aMacCounters.mIfInBroadcastPkts);
+    aWriter.Member("IfInDiscards", aMacCounters.mIfInDiscards);
+    aWriter.Member("IfOutUcastPkts", aMacCounters.mIfOutUcastPkts);
+    aWriter.Member("IfOutBroadcastPkts", aMacCounters.mIfOutBroadcastPkts);
+    aWriter.Member("IfOutDiscards", aMacCounters.mIfOutDiscards);
+    aWriter.EndObject();
 }
 
-std::string Json2String(const cJSON *aJson)
+static void Connectivity2Json(JsonWriter &aWriter, const otNetworkDiagConnectivity &aConnectivity)
 {
-    std::string ret;
-    char *      jsonOut = nullptr;
+    aWriter.BeginObject();
+    aWriter.Key("ParentPriority");
+    aWriter.SignedNumber(aConnectivity.mParentPriority);
+    aWriter.Member("LinkQuality3", aConnectivity.mLinkQuality3);
+    aWriter.Member("LinkQuality2", aConnectivity.mLinkQuality2);
+    aWriter.Member("LinkQuality1", aConnectivity.mLinkQuality1);
+    aWriter.Member("LeaderCost", aConnectivity.mLeaderCost);
+    aWriter.Member("IdSequence", aConnectivity.mIdSequence);
+    aWriter.Member("ActiveRouters", aConnectivity.mActiveRouters);
+    aWriter.Member("SedBufferSize", aConnectivity.mSedBufferSize);
+    aWriter.Member("SedDatagramCount", aConnectivity.mSedDatagramCount);
+    aWriter.EndObject();
+}
 
-    VerifyOrExit(aJson != nullptr);
+static void RouteData2Json(JsonWriter &aWriter, const otNetworkDiagRouteData &aRouteData)
+{
+    aWriter.BeginObject();
+    aWriter.Member("RouteId", aRouteData.mRouterId);
+    aWriter.Member("LinkQualityOut", aRouteData.mLinkQualityOut);
+    aWriter.Member("LinkQualityIn", aRouteData.mLinkQualityIn);
+    aWriter.Member("RouteCost", aRouteData.mRouteCost);
+    aWriter.EndObject();
+}
 
-    jsonOut = cJSON_Print(aJson);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
+static void Route2Json(JsonWriter &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.BeginObject();
+    aWriter.Member("IdSequence", aRoute.mIdSequence);
+    aWriter.Key("RouteData");
+    aWriter.BeginArray();
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
     {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
+        RouteData2Json(aWriter, aRoute.mRouteData[i]);
     }
-
-exit:
-    return ret;
+    aWriter.EndArray();
+    aWriter.EndObject();
 }
 
-static cJSON *CString2Json(const char *aString)
+void LeaderData2Json(JsonWriter &aWriter, const otLeaderData &aLeaderData)
 {
-    return cJSON_CreateString(aString);
+    aWriter.BeginObject();
+    aWriter.Member("PartitionId", aLeaderData.mPartitionId);
+    aWriter.Member("Weighting", aLeaderData.mWeighting);
+    aWriter.Member("DataVersion", aLeaderData.mDataVersion);
+    aWriter.Member("StableDataVersion", aLeaderData.mStableDataVersion);
+    aWriter.Member("LeaderRouterId", aLeaderData.mLeaderRouterId);
+    aWriter.EndObject();
 }
 
-static cJSON *Mode2Json(const otLinkModeConfig &aMode)
+static void DiagTlv2Json(JsonWriter &aWriter, const otNetworkDiagTlv &aDiagTlv)
 {
-    cJSON *mode = cJSON_CreateObject();
+    switch (aDiagTlv.mType)
+    {
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
 
-    cJSON_AddItemToObject(mode, "RxOnWhenIdle", cJSON_CreateNumber(aMode.mRxOnWhenIdle));
-    cJSON_AddItemToObject(mode, "DeviceType", cJSON_CreateNumber(aMode.mDeviceType));
-    cJSON_AddItemToObject(mode, "NetworkData", cJSON_CreateNumber(aMode.mNetworkData));
+        aWriter.Key("ExtAddress");
+        aWriter.HexString(aDiagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
 
-    return mode;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
 
-static cJSON *IpAddr2Json(const otIp6Address &aAddress)
-{
-    Ip6Address addr(aAddress.mFields.m8);
+        aWriter.Member("Rloc16", aDiagTlv.mData.mAddr16);
 
-    return cJSON_CreateString(addr.ToString().c_str());
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
 
-static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
-{
-    cJSON *childEntry = cJSON_CreateObject();
+        aWriter.Key("Mode");
+        Mode2Json(aWriter, aDiagTlv.mData.mMode);
 
-    cJSON_AddItemToObject(childEntry, "ChildId", cJSON_CreateNumber(aChildEntry.mChildId));
-    cJSON_AddItemToObject(childEntry, "Timeout", cJSON_CreateNumber(aChildEntry.mTimeout));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
 
-    cJSON *mode = Mode2Json(aChildEntry.mMode);
-    cJSON_AddItemToObject(childEntry, "Mode", mode);
+        aWriter.Member("Timeout", aDiagTlv.mData.mTimeout);
 
-    return childEntry;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
 
-static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
-{
-    cJSON *macCounters = cJSON_CreateObject();
+        aWriter.Key("Connectivity");
+        Connectivity2Json(aWriter, aDiagTlv.mData.mConnectivity);
 
-    cJSON_AddItemToObject(macCounters, "IfInUnknownProtos", cJSON_CreateNumber(aMacCounters.mIfInUnknownProtos));
-    cJSON_AddItemToObject(macCounters, "IfInErrors", cJSON_CreateNumber(aMacCounters.mIfInErrors));
-    cJSON_AddItemToObject(macCounters, "IfOutErrors", cJSON_CreateNumber(aMacCounters.mIfOutErrors));
-    cJSON_AddItemToObject(macCounters, "IfInUcastPkts", cJSON_CreateNumber(aMacCounters.mIfInUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfInBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInDiscards", cJSON_CreateNumber(aMacCounters.mIfInDiscards));
-    cJSON_AddItemToObject(macCounters, "IfOutUcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutDiscards", cJSON_CreateNumber(aMacCounters.mIfOutDiscards));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
 
-    return macCounters;
-}
+        aWriter.Key("Route");
+        Route2Json(aWriter, aDiagTlv.mData.mRoute);
 
-static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
-{
-    cJSON *connectivity = cJSON_CreateObject();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
 
-    cJSON_AddItemToObject(connectivity, "ParentPriority", cJSON_CreateNumber(aConnectivity.mParentPriority));
-    cJSON_AddItemToObject(connectivity, "LinkQuality3", cJSON_CreateNumber(aConnectivity.mLinkQuality3));
-    cJSON_AddItemToObject(connectivity, "LinkQuality2", cJSON_CreateNumber(aConnectivity.mLinkQuality2));
-    cJSON_AddItemToObject(connectivity, "LinkQuality1", cJSON_CreateNumber(aConnectivity.mLinkQuality1));
-    cJSON_AddItemToObject(connectivity, "LeaderCost", cJSON_CreateNumber(aConnectivity.mLeaderCost));
-    cJSON_AddItemToObject(connectivity, "IdSequence", cJSON_CreateNumber(aConnectivity.mIdSequence));
-    cJSON_AddItemToObject(connectivity, "ActiveRouters", cJSON_CreateNumber(aConnectivity.mActiveRouters));
-    cJSON_AddItemToObject(connectivity, "SedBufferSize", cJSON_CreateNumber(aConnectivity.mSedBufferSize));
-    cJSON_AddItemToObject(connectivity, "SedDatagramCount", cJSON_CreateNumber(aConnectivity.mSedDatagramCount));
+        aWriter.Key("LeaderData");
+        LeaderData2Json(aWriter, aDiagTlv.mData.mLeaderData);
 
-    return connectivity;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
 
-static cJSON *RouteData2Json(const otNetworkDiagRouteData &aRouteData)
-{
-    cJSON *routeData = cJSON_CreateObject();
+        aWriter.Key("NetworkData");
+        aWriter.HexString(aDiagTlv.mData.mNetworkData.m8, aDiagTlv.mData.mNetworkData.mCount);
 
-    cJSON_AddItemToObject(routeData, "RouteId", cJSON_CreateNumber(aRouteData.mRouterId));
-    cJSON_AddItemToObject(routeData, "LinkQualityOut", cJSON_CreateNumber(aRouteData.mLinkQualityOut));
-    cJSON_AddItemToObject(routeData, "LinkQualityIn", cJSON_CreateNumber(aRouteData.mLinkQualityIn));
-    cJSON_AddItemToObject(routeData, "RouteCost", cJSON_CreateNumber(aRouteData.mRouteCost));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
 
-    return routeData;
-}
+        aWriter.Key("IP6AddressList");
+        aWriter.BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mIp6AddrList.mCount; ++i)
+        {
+            IpAddr2Json(aWriter, aDiagTlv.mData.mIp6AddrList.mList[i]);
+        }
+        aWriter.EndArray();
 
-static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
-{
-    cJSON *route = cJSON_CreateObject();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
 
-    cJSON_AddItemToObject(route, "IdSequence", cJSON_CreateNumber(aRoute.mIdSequence));
+        aWriter.Key("MACCounters");
+        MacCounters2Json(aWriter, aDiagTlv.mData.mMacCounters);
 
-    cJSON *RouteData = cJSON_CreateArray();
-    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
-    {
-        cJSON *RouteDatavalue = RouteData2Json(aRoute.mRouteData[i]);
-        cJSON_AddItemToArray(RouteData, RouteDatavalue);
-    }
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
 
-    cJSON_AddItemToObject(route, "RouteData", RouteData);
+        aWriter.Member("BatteryLevel", aDiagTlv.mData.mBatteryLevel);
 
-    return route;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
 
-static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
-{
-    cJSON *leaderData = cJSON_CreateObject();
+        aWriter.Member("SupplyVoltage", aDiagTlv.mData.mSupplyVoltage);
 
-    cJSON_AddItemToObject(leaderData, "PartitionId", cJSON_CreateNumber(aLeaderData.mPartitionId));
-    cJSON_AddItemToObject(leaderData, "Weighting", cJSON_CreateNumber(aLeaderData.mWeighting));
-    cJSON_AddItemToObject(leaderData, "DataVersion", cJSON_CreateNumber(aLeaderData.mDataVersion));
-    cJSON_AddItemToObject(leaderData, "StableDataVersion", cJSON_CreateNumber(aLeaderData.mStableDataVersion));
-    cJSON_AddItemToObject(leaderData, "LeaderRouterId", cJSON_CreateNumber(aLeaderData.mLeaderRouterId));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
 
-    return leaderData;
+        aWriter.Key("ChildTable");
+        aWriter.BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mChildTable.mCount; ++i)
+        {
+            ChildTableEntry2Json(aWriter, aDiagTlv.mData.mChildTable.mTable[i]);
+        }
+        aWriter.EndArray();
+
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+
+        aWriter.Key("ChannelPages");
+        aWriter.HexString(aDiagTlv.mData.mChannelPages.m8, aDiagTlv.mData.mChannelPages.mCount);
+
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+
+        aWriter.Member("MaxChildTimeout", aDiagTlv.mData.mMaxChildTimeout);
+
+        break;
+    default:
+        break;
+    }
 }
 
-std::string IpAddr2JsonString(const otIp6Address &aAddress)
+void Diag2Json(JsonWriter &aWriter, const std::vector<otNetworkDiagTlv> &aDiagContent)
 {
-    std::string ret;
-    cJSON *     ipAddr = IpAddr2Json(aAddress);
+    aWriter.BeginObject();
+    for (const otNetworkDiagTlv &diagTlv : aDiagContent)
+    {
+        DiagTlv2Json(aWriter, diagTlv);
+    }
+    aWriter.EndObject();
+}
 
-    ret = Json2String(ipAddr);
-    cJSON_Delete(ipAddr);
+void DiagInfo2Json(JsonWriter &aWriter, const DiagInfo &aDiagInfo, uint64_t aAge, uint32_t aTlvMask)
+{
+    otNetworkDiagTlv diagTlv;
+    size_t           offset = 0;
 
-    return ret;
+    aWriter.BeginObject();
+    while (DiagStore::GetNextTlv(aDiagInfo, offset, diagTlv))
+    {
+        if (diagTlv.mType >= 32 || (aTlvMask & (1u << diagTlv.mType)) != 0)
+        {
+            DiagTlv2Json(aWriter, diagTlv);
+        }
+    }
+    aWriter.Member("Age", aAge);
+    aWriter.EndObject();
 }
 
-std::string Node2JsonString(const NodeInfo &aNode)
+void MeshCounters2Json(JsonWriter &aWriter, const MeshCounters &aCounters)
 {
-    cJSON *     node = cJSON_CreateObject();
-    std::string ret;
+    aWriter.BeginObject();
+    aWriter.Member("Nodes", aCounters.mNumNodes);
+    aWriter.Member("IfInUnknownProtos", aCounters.mIfInUnknownProtos);
+    aWriter.Member("IfInErrors", aCounters.mIfInErrors);
+    aWriter.Member("IfOutErrors", aCounters.mIfOutErrors);
+    aWriter.Member("IfInUcastPkts", aCounters.mIfInUcastPkts);
+    aWriter.Member("IfInBroadcastPkts", aCounters.mIfInBroadcastPkts);
+    aWriter.Member("IfInDiscards", aCounters.mIfInDiscards);
+    aWriter.Member("IfOutUcastPkts", aCounters.mIfOutUcastPkts);
+    aWriter.Member("IfOutBroadcastPkts", aCounters.mIfOutBroadcastPkts);
+    aWriter.Member("IfOutDiscards", aCounters.mIfOutDiscards);
+    aWriter.EndObject();
+}
 
-    cJSON_AddItemToObject(node, "State", cJSON_CreateNumber(aNode.mRole));
-    cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
-    cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
-    cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
-    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
-    cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
+void Topology2Json(JsonWriter &aWriter, const Topology &aTopology, uint32_t aSince)
+{
+    bool full = (aSince == 0) || !aTopology.HasChangesSince(aSince);
 
-    ret = Json2String(node);
-    cJSON_Delete(node);
+    if (full)
+    {
+        aSince = 0;
+    }
 
-    return ret;
+    aWriter.BeginObject();
+    aWriter.Member("Version", aTopology.GetVersion());
+    aWriter.Key("Full");
+    aWriter.Bool(full);
+    aWriter.Key("Nodes");
+    aWriter.BeginArray();
+    for (const Topology::Node &node : aTopology)
+    {
+        if (node.mRemoved || node.mVersion <= aSince)
+        {
+            continue;
+        }
+
+        aWriter.BeginObject();
+        aWriter.Member("Rloc16", node.mRloc16);
+        aWriter.Key("RouteData");
+        aWriter.BeginArray();
+        for (const otNetworkDiagRouteData &route : node.mRoutes)
+        {
+            RouteData2Json(aWriter, route);
+        }
+        aWriter.EndArray();
+        aWriter.Key("ChildTable");
+        aWriter.BeginArray();
+        for (const otNetworkDiagChildEntry &child : node.mChildren)
+        {
+            ChildTableEntry2Json(aWriter, child);
+        }
+        aWriter.EndArray();
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.Key("Removed");
+    aWriter.BeginArray();
+    for (const Topology::Node &node : aTopology)
+    {
+        if (node.mRemoved && node.mVersion > aSince && !full)
+        {
+            aWriter.Number(node.mRloc16);
+        }
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+static void Prefix2Json(JsonWriter &aWriter, const otIp6Prefix &aPrefix)
 {
-    cJSON *     diagInfo          = cJSON_CreateArray();
-    cJSON *     diagInfoOfOneNode = nullptr;
-    cJSON *     addrList          = nullptr;
-    cJSON *     tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
+    Ip6Prefix prefix;
+
+    prefix.Set(aPrefix);
+    aWriter.String(prefix.ToString());
+}
 
-    for (auto diagItem : aDiagSet)
+void NetworkData2Json(JsonWriter &aWriter, const Ncp::NetworkData &aNetworkData)
+{
+    aWriter.BeginObject();
+    aWriter.Member("Version", aNetworkData.mVersion);
+    aWriter.Member("StableVersion", aNetworkData.mStableVersion);
+    aWriter.Key("OnMeshPrefixes");
+    aWriter.BeginArray();
+    for (const auto &entry : aNetworkData.mOnMeshPrefixes.GetEntries())
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
+        for (const otBorderRouterConfig &config : entry.second)
         {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+            aWriter.BeginObject();
+            aWriter.Key("Prefix");
+            Prefix2Json(aWriter, config.mPrefix);
+            aWriter.Member("Rloc16", config.mRloc16);
+            aWriter.Key("Preference");
+            aWriter.SignedNumber(config.mPreference);
+            aWriter.Key("Preferred");
+            aWriter.Bool(config.mPreferred);
+            aWriter.Key("Slaac");
+            aWriter.Bool(config.mSlaac);
+            aWriter.Key("Dhcp");
+            aWriter.Bool(config.mDhcp);
+            aWriter.Key("Configure");
+            aWriter.Bool(config.mConfigure);
+            aWriter.Key("DefaultRoute");
+            aWriter.Bool(config.mDefaultRoute);
+            aWriter.Key("OnMesh");
+            aWriter.Bool(config.mOnMesh);
+            aWriter.Key("Stable");
+            aWriter.Bool(config.mStable);
+            aWriter.Key("NdDns");
+            aWriter.Bool(config.mNdDns);
+            aWriter.Key("DomainPrefix");
+            aWriter.Bool(config.mDp);
+            aWriter.EndObject();
+        }
+    }
+    aWriter.EndArray();
+    aWriter.Key("ExternalRoutes");
+    aWriter.BeginArray();
+    for (const auto &entry : aNetworkData.mExternalRoutes.GetEntries())
+    {
+        for (const otExternalRouteConfig &config : entry.second)
+        {
+            aWriter.BeginObject();
+            aWriter.Key("Prefix");
+            Prefix2Json(aWriter, config.mPrefix);
+            aWriter.Member("Rloc16", config.mRloc16);
+            aWriter.Key("Preference");
+            aWriter.SignedNumber(config.mPreference);
+            aWriter.Key("Stable");
+            aWriter.Bool(config.mStable);
+            aWriter.Key("NextHopIsThisDevice");
+            aWriter.Bool(config.mNextHopIsThisDevice);
+            aWriter.EndObject();
+        }
+    }
+    aWriter.EndArray();
+    aWriter.Key("Services");
+    aWriter.BeginArray();
+    for (const otServiceConfig &config : aNetworkData.mServices)
+    {
+        aWriter.BeginObject();
+        aWriter.Member("ServiceId", config.mServiceId);
+        aWriter.Member("EnterpriseNumber", config.mEnterpriseNumber);
+        aWriter.Key("ServiceData");
+        aWriter.HexString(config.mServiceData, config.mServiceDataLength);
+        aWriter.Member("Rloc16", config.mServerConfig.mRloc16);
+        aWriter.Key("ServerData");
+        aWriter.HexString(config.mServerConfig.mServerData, config.mServerConfig.mServerDataLength);
+        aWriter.Key("Stable");
+        aWriter.Bool(config.mServerConfig.mStable);
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.Key("BorderRouters");
+    aWriter.BeginArray();
+    for (uint16_t rloc16 : aNetworkData.mBorderRouters)
+    {
+        aWriter.Number(rloc16);
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+static const char *CommissionerState2String(otCommissionerState aState)
+{
+    const char *state = "disabled";
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+    switch (aState)
+    {
+    case OT_COMMISSIONER_STATE_DISABLED:
+        break;
+    case OT_COMMISSIONER_STATE_PETITION:
+        state = "petition";
+        break;
+    case OT_COMMISSIONER_STATE_ACTIVE:
+        state = "active";
+        break;
+    }
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
+    return state;
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+void Commissioning2Json(JsonWriter &                                      aWriter,
+                        const agent::CommissioningOrchestrator::Progress &aProgress,
+                        Timer::Clock::time_point                          aNow)
+{
+    typedef agent::CommissioningOrchestrator Orchestrator;
+    typedef std::chrono::milliseconds        Milliseconds;
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
+    static const char *const kJoinerStates[] = {"queued", "active", "connected", "finalizing", "joined", "failed"};
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+    uint64_t counts[sizeof(kJoinerStates) / sizeof(kJoinerStates[0])] = {};
 
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
+    for (const Orchestrator::JoinerProgress &joiner : aProgress.mJoiners)
+    {
+        counts[joiner.mState]++;
+    }
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+    aWriter.BeginObject();
+    aWriter.Key("State");
+    aWriter.String(CommissionerState2String(aProgress.mState));
+    aWriter.Member("Queued", counts[Orchestrator::kJoinerQueued]);
+    aWriter.Member("Active", counts[Orchestrator::kJoinerActive] + counts[Orchestrator::kJoinerConnected] +
+                                 counts[Orchestrator::kJoinerFinalizing]);
+    aWriter.Member("Joined", counts[Orchestrator::kJoinerJoined]);
+    aWriter.Member("Failed", counts[Orchestrator::kJoinerFailed]);
+    aWriter.Key("Joiners");
+    aWriter.BeginArray();
+    for (const Orchestrator::JoinerProgress &joiner : aProgress.mJoiners)
+    {
+        bool                     queued     = (joiner.mState == Orchestrator::kJoinerQueued);
+        bool                     done       = (joiner.mState >= Orchestrator::kJoinerJoined);
+        Timer::Clock::time_point activeTime = (queued ? aNow : joiner.mActiveTime);
+        Timer::Clock::time_point endTime    = (done ? joiner.mEndTime : aNow);
+
+        aWriter.BeginObject();
+        aWriter.Key("Eui64");
+        aWriter.HexString(joiner.mEui64.data(), static_cast<uint16_t>(joiner.mEui64.size()));
+        aWriter.Key("State");
+        aWriter.String(kJoinerStates[joiner.mState]);
+        aWriter.Member("Attempts", joiner.mAttempts);
+        aWriter.Member("QueueTime", std::chrono::duration_cast<Milliseconds>(activeTime - joiner.mQueuedTime).count());
+        aWriter.Member("JoinTime", std::chrono::duration_cast<Milliseconds>(endTime - activeTime).count());
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+static void ChildInfo2Json(JsonWriter &aWriter, const otChildInfo &aChildInfo)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ExtAddress");
+    aWriter.HexString(aChildInfo.mExtAddress.m8, sizeof(aChildInfo.mExtAddress.m8));
+    aWriter.Member("Rloc16", aChildInfo.mRloc16);
+    aWriter.Member("ChildId", aChildInfo.mChildId);
+    aWriter.Member("Timeout", aChildInfo.mTimeout);
+    aWriter.Member("Age", aChildInfo.mAge);
+    aWriter.Member("NetworkDataVersion", aChildInfo.mNetworkDataVersion);
+    aWriter.Member("LinkQualityIn", aChildInfo.mLinkQualityIn);
+    aWriter.Key("AverageRssi");
+    aWriter.SignedNumber(aChildInfo.mAverageRssi);
+    aWriter.Key("LastRssi");
+    aWriter.SignedNumber(aChildInfo.mLastRssi);
+    aWriter.Member("FrameErrorRate", aChildInfo.mFrameErrorRate);
+    aWriter.Member("MessageErrorRate", aChildInfo.mMessageErrorRate);
+    aWriter.Key("RxOnWhenIdle");
+    aWriter.Bool(aChildInfo.mRxOnWhenIdle);
+    aWriter.Key("FullThreadDevice");
+    aWriter.Bool(aChildInfo.mFullThreadDevice);
+    aWriter.Key("FullNetworkData");
+    aWriter.Bool(aChildInfo.mFullNetworkData);
+    aWriter.Key("IsStateRestoring");
+    aWriter.Bool(aChildInfo.mIsStateRestoring);
+    aWriter.EndObject();
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+static void NeighborInfo2Json(JsonWriter &aWriter, const otNeighborInfo &aNeighborInfo)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ExtAddress");
+    aWriter.HexString(aNeighborInfo.mExtAddress.m8, sizeof(aNeighborInfo.mExtAddress.m8));
+    aWriter.Member("Rloc16", aNeighborInfo.mRloc16);
+    aWriter.Member("Age", aNeighborInfo.mAge);
+    aWriter.Member("LinkFrameCounter", aNeighborInfo.mLinkFrameCounter);
+    aWriter.Member("MleFrameCounter", aNeighborInfo.mMleFrameCounter);
+    aWriter.Member("LinkQualityIn", aNeighborInfo.mLinkQualityIn);
+    aWriter.Key("AverageRssi");
+    aWriter.SignedNumber(aNeighborInfo.mAverageRssi);
+    aWriter.Key("LastRssi");
+    aWriter.SignedNumber(aNeighborInfo.mLastRssi);
+    aWriter.Member("FrameErrorRate", aNeighborInfo.mFrameErrorRate);
+    aWriter.Member("MessageErrorRate", aNeighborInfo.mMessageErrorRate);
+    aWriter.Key("RxOnWhenIdle");
+    aWriter.Bool(aNeighborInfo.mRxOnWhenIdle);
+    aWriter.Key("FullThreadDevice");
+    aWriter.Bool(aNeighborInfo.mFullThreadDevice);
+    aWriter.Key("FullNetworkData");
+    aWriter.Bool(aNeighborInfo.mFullNetworkData);
+    aWriter.Key("IsChild");
+    aWriter.Bool(aNeighborInfo.mIsChild);
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
+template <typename EntryType, typename Entry2JsonType>
+static void TableChanges2Json(JsonWriter &                  aWriter,
+                              const std::vector<EntryType> &aTable,
+                              const Ncp::TableVersions &    aVersions,
+                              uint32_t                      aSince,
+                              const std::vector<size_t> *   aPage,
+                              Entry2JsonType                aEntry2Json)
+{
+    Ncp::TableVersions::Changes changes;
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+    aVersions.GetChanges(aSince, aPage, changes);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+    aWriter.BeginObject();
+    aWriter.Member("Version", aVersions.mVersion);
+    aWriter.Key("Full");
+    aWriter.Bool(changes.mFull);
+    aWriter.Key("Added");
+    aWriter.BeginArray();
+    for (size_t index : changes.mAdded)
+    {
+        aEntry2Json(aWriter, aTable[index]);
+    }
+    aWriter.EndArray();
+    aWriter.Key("Updated");
+    aWriter.BeginArray();
+    for (size_t index : changes.mUpdated)
+    {
+        aEntry2Json(aWriter, aTable[index]);
+    }
+    aWriter.EndArray();
+    aWriter.Key("Removed");
+    aWriter.BeginArray();
+    for (size_t index : changes.mRemoved)
+    {
+        const otExtAddress &extAddress = aVersions.mRemovals[index].mExtAddress;
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+        aWriter.HexString(extAddress.m8, sizeof(extAddress.m8));
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+void ChildTable2Json(JsonWriter &               aWriter,
+                     const Ncp::NodeState &     aState,
+                     uint32_t                   aSince,
+                     const std::vector<size_t> *aPage)
+{
+    TableChanges2Json(aWriter, aState.mChildren, aState.mChildVersions, aSince, aPage, &ChildInfo2Json);
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+void NeighborTable2Json(JsonWriter &               aWriter,
+                        const Ncp::NodeState &     aState,
+                        uint32_t                   aSince,
+                        const std::vector<size_t> *aPage)
+{
+    TableChanges2Json(aWriter, aState.mNeighbors, aState.mNeighborVersions, aSince, aPage, &NeighborInfo2Json);
+}
 
-                addrList = cJSON_CreateArray();
+void LinkQuality2Json(JsonWriter &aWriter, const std::vector<Ncp::LinkQualityTracker::Stats> &aStats)
+{
+    aWriter.BeginArray();
+    for (const Ncp::LinkQualityTracker::Stats &stats : aStats)
+    {
+        aWriter.BeginObject();
+        aWriter.Key("ExtAddress");
+        aWriter.HexString(stats.mExtAddress.m8, sizeof(stats.mExtAddress.m8));
+        aWriter.Member("Rloc16", stats.mRloc16);
+        aWriter.Key("IsChild");
+        aWriter.Bool(stats.mIsChild);
+        aWriter.Member("FirstSeen", stats.mFirstSeen);
+        aWriter.Member("LastSeen", stats.mLastSeen);
+        aWriter.Member("Samples", stats.mSamples);
+        aWriter.Key("RssiHistogram");
+        aWriter.BeginArray();
+        for (uint16_t count : stats.mRssiHistogram)
+        {
+            aWriter.Number(count);
+        }
+        aWriter.EndArray();
+        aWriter.Key("LinkQualityHistogram");
+        aWriter.BeginArray();
+        for (uint16_t count : stats.mLinkQualityHistogram)
+        {
+            aWriter.Number(count);
+        }
+        aWriter.EndArray();
+        aWriter.Key("MinRssi");
+        aWriter.SignedNumber(stats.mMinRssi);
+        aWriter.Key("AverageRssi");
+        aWriter.SignedNumber(stats.GetAverageRssi());
+        aWriter.Key("MaxRssi");
+        aWriter.SignedNumber(stats.mMaxRssi);
+        aWriter.Key("RecentRssi");
+        aWriter.SignedNumber(stats.GetRecentRssi());
+        aWriter.Key("BaselineRssi");
+        aWriter.SignedNumber(stats.GetBaselineRssi());
+        aWriter.Member("FrameErrorRate", stats.mFrameErrorRate);
+        aWriter.Member("AverageFrameErrorRate", stats.GetAverageFrameErrorRate());
+        aWriter.Member("MessageErrorRate", stats.mMessageErrorRate);
+        aWriter.Key("Degraded");
+        aWriter.Bool(stats.mDegraded);
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+}
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+static void LinkCounters2Json(JsonWriter &aWriter, const otMacCounters &aCounters)
+{
+    aWriter.BeginObject();
+    aWriter.Member("TxTotal", aCounters.mTxTotal);
+    aWriter.Member("TxUnicast", aCounters.mTxUnicast);
+    aWriter.Member("TxBroadcast", aCounters.mTxBroadcast);
+    aWriter.Member("TxAckRequested", aCounters.mTxAckRequested);
+    aWriter.Member("TxAcked", aCounters.mTxAcked);
+    aWriter.Member("TxNoAckRequested", aCounters.mTxNoAckRequested);
+    aWriter.Member("TxData", aCounters.mTxData);
+    aWriter.Member("TxDataPoll", aCounters.mTxDataPoll);
+    aWriter.Member("TxBeacon", aCounters.mTxBeacon);
+    aWriter.Member("TxBeaconRequest", aCounters.mTxBeaconRequest);
+    aWriter.Member("TxOther", aCounters.mTxOther);
+    aWriter.Member("TxRetry", aCounters.mTxRetry);
+    aWriter.Member("TxErrCca", aCounters.mTxErrCca);
+    aWriter.Member("TxErrAbort", aCounters.mTxErrAbort);
+    aWriter.Member("TxErrBusyChannel", aCounters.mTxErrBusyChannel);
+    aWriter.Member("RxTotal", aCounters.mRxTotal);
+    aWriter.Member("RxUnicast", aCounters.mRxUnicast);
+    aWriter.Member("RxBroadcast", aCounters.mRxBroadcast);
+    aWriter.Member("RxData", aCounters.mRxData);
+    aWriter.Member("RxDataPoll", aCounters.mRxDataPoll);
+    aWriter.Member("RxBeacon", aCounters.mRxBeacon);
+    aWriter.Member("RxBeaconRequest", aCounters.mRxBeaconRequest);
+    aWriter.Member("RxOther", aCounters.mRxOther);
+    aWriter.Member("RxAddressFiltered", aCounters.mRxAddressFiltered);
+    aWriter.Member("RxDestAddrFiltered", aCounters.mRxDestAddrFiltered);
+    aWriter.Member("RxDuplicated", aCounters.mRxDuplicated);
+    aWriter.Member("RxErrNoFrame", aCounters.mRxErrNoFrame);
+    aWriter.Member("RxErrUnknownNeighbor", aCounters.mRxErrUnknownNeighbor);
+    aWriter.Member("RxErrInvalidSrcAddr", aCounters.mRxErrInvalidSrcAddr);
+    aWriter.Member("RxErrSec", aCounters.mRxErrSec);
+    aWriter.Member("RxErrFcs", aCounters.mRxErrFcs);
+    aWriter.Member("RxErrOther", aCounters.mRxErrOther);
+    aWriter.EndObject();
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+static void IpCounters2Json(JsonWriter &aWriter, const otIpCounters &aCounters)
+{
+    aWriter.BeginObject();
+    aWriter.Member("TxSuccess", aCounters.mTxSuccess);
+    aWriter.Member("RxSuccess", aCounters.mRxSuccess);
+    aWriter.Member("TxFailure", aCounters.mTxFailure);
+    aWriter.Member("RxFailure", aCounters.mRxFailure);
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+void CountersHistory2Json(JsonWriter &                                     aWriter,
+                          uint32_t                                         aPeriod,
+                          const std::vector<Ncp::CountersHistory::Sample> &aSamples)
+{
+    aWriter.BeginObject();
+    aWriter.Member("Period", aPeriod);
+    aWriter.Key("Samples");
+    aWriter.BeginArray();
+    for (const Ncp::CountersHistory::Sample &sample : aSamples)
+    {
+        aWriter.BeginObject();
+        aWriter.Member("Time", sample.mTime);
+        aWriter.Key("LinkCounters");
+        LinkCounters2Json(aWriter, sample.mMacCounters);
+        aWriter.Key("Ip6Counters");
+        IpCounters2Json(aWriter, sample.mIpCounters);
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+void ChannelHistory2Json(JsonWriter &                                    aWriter,
+                         uint32_t                                        aPeriod,
+                         const std::vector<Ncp::ChannelHistory::Window> &aWindows)
+{
+    aWriter.BeginObject();
+    aWriter.Member("Period", aPeriod);
+    aWriter.Key("Windows");
+    aWriter.BeginArray();
+    for (const Ncp::ChannelHistory::Window &window : aWindows)
+    {
+        aWriter.BeginObject();
+        aWriter.Member("Time", window.mTime);
+        aWriter.Key("Channels");
+        aWriter.BeginArray();
+        for (uint8_t i = 0; i < Ncp::ChannelHistory::kNumChannels; i++)
+        {
+            const Ncp::ChannelHistory::Occupancy &occupancy = window.mChannels[i];
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
+            if (occupancy.mCount == 0)
+            {
+                continue;
+            }
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+            aWriter.BeginObject();
+            aWriter.Member("Channel", Ncp::ChannelHistory::kMinChannel + i);
+            aWriter.Member("Min", occupancy.mMin);
+            aWriter.Member("Average", occupancy.GetAverage());
+            aWriter.Member("Max", occupancy.mMax);
+            aWriter.EndObject();
+        }
+        aWriter.EndArray();
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
+std::string String2JsonString(const std::string &aString)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+    VerifyOrExit(aString.size() > 0);
 
-                tableList = cJSON_CreateArray();
+    writer.String(aString);
 
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+exit:
+    return ret;
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+std::string IpAddr2JsonString(const otIp6Address &aAddress)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+    IpAddr2Json(writer, aAddress);
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+    return ret;
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+void Node2Json(JsonWriter &aWriter, const NodeInfo &aNode)
+{
+    aWriter.BeginObject();
+    aWriter.Member("State", aNode.mRole);
+    aWriter.Member("NumOfRouter", aNode.mNumOfRouter);
+    aWriter.Key("RlocAddress");
+    IpAddr2Json(aWriter, aNode.mRlocAddress);
+    aWriter.Key("ExtAddress");
+    aWriter.HexString(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    aWriter.Key("NetworkName");
+    aWriter.String(aNode.mNetworkName);
+    aWriter.Member("Rloc16", aNode.mRloc16);
+    aWriter.Key("LeaderData");
+    LeaderData2Json(aWriter, aNode.mLeaderData);
+    aWriter.Key("ExtPanId");
+    aWriter.HexString(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    aWriter.EndObject();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+std::string Node2JsonString(const NodeInfo &aNode)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                break;
-            default:
-                break;
-            }
-        }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
-    }
+    Node2Json(writer, aNode);
+
+    return ret;
+}
 
-    ret = Json2String(diagInfo);
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, bool aPretty)
+{
+    std::string ret;
+    JsonWriter  writer(ret, aPretty);
 
-    cJSON_Delete(diagInfo);
+    writer.BeginArray();
+    for (const std::vector<otNetworkDiagTlv> &diagItem : aDiagSet)
+    {
+        Diag2Json(writer, diagItem);
+    }
+    writer.EndArray();
 
     return ret;
 }
 
 std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
 {
-    cJSON *     hex = Bytes2HexJson(aBytes, aLength);
-    std::string ret = Json2String(hex);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(hex);
+    writer.HexString(aBytes, aLength);
 
     return ret;
 }
 
 std::string Number2JsonString(const uint32_t &aNumber)
 {
-    cJSON *     number = cJSON_CreateNumber(aNumber);
-    std::string ret    = Json2String(number);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(number);
+    writer.Number(aNumber);
 
     return ret;
 }
 
 std::string Mode2JsonString(const otLinkModeConfig &aMode)
 {
-    cJSON *     mode = Mode2Json(aMode);
-    std::string ret  = Json2String(mode);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(mode);
+    Mode2Json(writer, aMode);
 
     return ret;
 }
 
 std::string Connectivity2JsonString(const otNetworkDiagConnectivity &aConnectivity)
 {
-    cJSON *     connectivity = Connectivity2Json(aConnectivity);
-    std::string ret          = Json2String(connectivity);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(connectivity);
+    Connectivity2Json(writer, aConnectivity);
 
     return ret;
 }
 
 std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData)
 {
-    cJSON *     routeData = RouteData2Json(aRouteData);
-    std::string ret       = Json2String(routeData);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(routeData);
+    RouteData2Json(writer, aRouteData);
 
     return ret;
 }
 
 std::string Route2JsonString(const otNetworkDiagRoute &aRoute)
 {
-    cJSON *     route = Route2Json(aRoute);
-    std::string ret   = Json2String(route);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(route);
+    Route2Json(writer, aRoute);
 
     return ret;
 }
 
 std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
 {
-    cJSON *     leaderData = LeaderData2Json(aLeaderData);
-    std::string ret        = Json2String(leaderData);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(leaderData);
+    LeaderData2Json(writer, aLeaderData);
 
     return ret;
 }
 
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON *     macCounters = MacCounters2Json(aMacCounters);
-    std::string ret         = Json2String(macCounters);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(macCounters);
+    MacCounters2Json(writer, aMacCounters);
 
     return ret;
 }
 
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON *     childEntry = ChildTableEntry2Json(aChildEntry);
-    std::string ret        = Json2String(childEntry);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(childEntry);
+    ChildTableEntry2Json(writer, aChildEntry);
 
     return ret;
 }
 
 std::string CString2JsonString(const char *aCString)
 {
-    cJSON *     cString = CString2Json(aCString);
-    std::string ret     = Json2String(cString);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(cString);
+    writer.String(aCString);
 
     return ret;
 }
 
+void Error2Json(JsonWriter &aWriter, HttpStatusCode aErrorCode, const std::string &aErrorMessage)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ErrorCode");
+    aWriter.SignedNumber(static_cast<int16_t>(aErrorCode));
+    aWriter.Key("ErrorMessage");
+    aWriter.String(aErrorMessage);
+    aWriter.EndObject();
+}
+
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
 {
     std::string ret;
-    cJSON *     error = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(error, "ErrorCode", cJSON_CreateNumber(static_cast<int16_t>(aErrorCode)));
-    cJSON_AddItemToObject(error, "ErrorMessage", cJSON_CreateString(aErrorMessage.c_str()));
-
-    ret = Json2String(error);
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(error);
+    Error2Json(writer, aErrorCode, aErrorMessage);
 
     return ret;
 }
@@ -37,6 +37,14 @@
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "agent/commissioning_orchestrator.hpp"
+#include "agent/channel_history.hpp"
+#include "agent/counters_history.hpp"
+#include "agent/link_quality.hpp"
+#include "agent/network_data.hpp"
+#include "agent/node_state.hpp"
+#include "rest/json_writer.hpp"
+#include "rest/topology.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
 
@@ -100,15 +108,170 @@ std::string String2JsonString(const std::string &aString);
  */
 std::string Node2JsonString(const NodeInfo &aNode);
 
+/**
+ * This method writes a Node object as a Json object.
+ *
+ * @param[in]   aWriter  A Json writer to write the object to.
+ * @param[in]   aNode    A Node object.
+ *
+ */
+void Node2Json(JsonWriter &aWriter, const NodeInfo &aNode);
+
+/**
+ * This method writes an Ipv6Address as a Json string.
+ *
+ * @param[in]   aWriter   A Json writer to write the string to.
+ * @param[in]   aAddress  An Ip6Address object.
+ *
+ */
+void IpAddr2Json(JsonWriter &aWriter, const otIp6Address &aAddress);
+
+/**
+ * This method writes a LeaderData object as a Json object.
+ *
+ * @param[in]   aWriter      A Json writer to write the object to.
+ * @param[in]   aLeaderData  A LeaderData object.
+ *
+ */
+void LeaderData2Json(JsonWriter &aWriter, const otLeaderData &aLeaderData);
+
 /**
  * This method formats a vector including serveral Diagnostic object to a Json array and serialize it to a string.
  *
  * @param[in]   aDiagSet  A vector including serveral Diagnostic object.
+ * @param[in]   aPretty   Whether to indent the output, or to write it in the compact form.
  *
  * @returns     A string serlialized by a Json array.
  *
  */
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, bool aPretty = true);
+
+/**
+ * This method writes the Diagnostic TLVs of one node as a Json object.
+ *
+ * @param[in]   aWriter       A Json writer to write the object to.
+ * @param[in]   aDiagContent  A vector including the Diagnostic TLVs of one node.
+ *
+ */
+void Diag2Json(JsonWriter &aWriter, const std::vector<otNetworkDiagTlv> &aDiagContent);
+
+/**
+ * This method writes the cached Diagnostic information of one node as a Json object, together with its age.
+ *
+ * @param[in]   aWriter    A Json writer to write the object to.
+ * @param[in]   aDiagInfo  The cached Diagnostic information of one node.
+ * @param[in]   aAge       Milliseconds since the Diagnostic information was received.
+ * @param[in]   aTlvMask   Bit mask of the TLV types to write, by their type numbers.
+ *
+ */
+void DiagInfo2Json(JsonWriter &aWriter, const DiagInfo &aDiagInfo, uint64_t aAge, uint32_t aTlvMask = 0xffffffff);
+
+/**
+ * This method writes the topology of the Thread network as a Json object.
+ *
+ * @param[in]   aWriter    A Json writer to write the object to.
+ * @param[in]   aTopology  The topology.
+ * @param[in]   aSince     The version of the topology known by the client, to only write the nodes changed and
+ *                         removed since then. 0 or a version too old for the changes to be known writes all nodes.
+ *
+ */
+void Topology2Json(JsonWriter &aWriter, const Topology &aTopology, uint32_t aSince);
+
+/**
+ * This method writes the sums of the MAC counters of the nodes as a Json object.
+ *
+ * @param[in]   aWriter    A Json writer to write the object to.
+ * @param[in]   aCounters  The sums of the MAC counters.
+ *
+ */
+void MeshCounters2Json(JsonWriter &aWriter, const MeshCounters &aCounters);
+
+/**
+ * This method writes the decoded network data and its versions as a Json object.
+ *
+ * @param[in]   aWriter       A Json writer to write the object to.
+ * @param[in]   aNetworkData  The snapshot of the network data.
+ *
+ */
+void NetworkData2Json(JsonWriter &aWriter, const Ncp::NetworkData &aNetworkData);
+
+/**
+ * This method writes the progress of the commissioning of the queue of joiners as a Json object.
+ *
+ * @param[in]   aWriter     A Json writer to write the object to.
+ * @param[in]   aProgress   The snapshot of the progress.
+ * @param[in]   aNow        The time the times in the queue and joining of unfinished joiners are written up to.
+ *
+ */
+void Commissioning2Json(JsonWriter &                                      aWriter,
+                        const agent::CommissioningOrchestrator::Progress &aProgress,
+                        Timer::Clock::time_point                          aNow);
+
+/**
+ * This method writes the child table of the node, or its changes since a version, as a Json object.
+ *
+ * @param[in]   aWriter  A Json writer to write the object to.
+ * @param[in]   aState   The snapshot of the node state.
+ * @param[in]   aSince   The version of the child table known by the client, to only write the entries added, updated
+ *                       and removed since then. 0 or a version too old for the changes to be known writes all entries.
+ * @param[in]   aPage    The indices of the entries of the page to write, in order, nullptr for all entries. The
+ *                       removed entries are written with each page.
+ *
+ */
+void ChildTable2Json(JsonWriter &               aWriter,
+                     const Ncp::NodeState &     aState,
+                     uint32_t                   aSince,
+                     const std::vector<size_t> *aPage = nullptr);
+
+/**
+ * This method writes the neighbor table of the node, or its changes since a version, as a Json object.
+ *
+ * @param[in]   aWriter  A Json writer to write the object to.
+ * @param[in]   aState   The snapshot of the node state.
+ * @param[in]   aSince   The version of the neighbor table known by the client, to only write the entries added,
+ *                       updated and removed since then. 0 or a version too old for the changes to be known writes all
+ *                       entries.
+ * @param[in]   aPage    The indices of the entries of the page to write, in order, nullptr for all entries. The
+ *                       removed entries are written with each page.
+ *
+ */
+void NeighborTable2Json(JsonWriter &               aWriter,
+                        const Ncp::NodeState &     aState,
+                        uint32_t                   aSince,
+                        const std::vector<size_t> *aPage = nullptr);
+
+/**
+ * This method writes the link quality statistics of the neighbors as a Json array.
+ *
+ * @param[in]   aWriter  A Json writer to write the array to.
+ * @param[in]   aStats   The statistics of the neighbors.
+ *
+ */
+void LinkQuality2Json(JsonWriter &aWriter, const std::vector<Ncp::LinkQualityTracker::Stats> &aStats);
+
+/**
+ * This method writes samples of the history of the MAC and IPv6 counters as a Json object.
+ *
+ * @param[in]   aWriter     A Json writer to write the object to.
+ * @param[in]   aPeriod     The period (in seconds) of the resolution of the samples.
+ * @param[in]   aSamples    The samples, from the oldest to the latest.
+ *
+ */
+void CountersHistory2Json(JsonWriter &                                     aWriter,
+                          uint32_t                                         aPeriod,
+                          const std::vector<Ncp::CountersHistory::Sample> &aSamples);
+
+/**
+ * This method writes windows of the history of the channel occupancy as a Json object.
+ *
+ * @param[in]   aWriter     A Json writer to write the object to.
+ * @param[in]   aPeriod     The period (in seconds) of the resolution of the windows.
+ * @param[in]   aWindows    The windows, from the oldest to the latest.
+ *
+ */
+void ChannelHistory2Json(JsonWriter &                                    aWriter,
+                         uint32_t                                        aPeriod,
+                         const std::vector<Ncp::ChannelHistory::Window> &aWindows);
 
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
@@ -201,6 +364,16 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
  */
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage);
 
+/**
+ * This method writes an error code and an error message as a Json object.
+ *
+ * @param[in]   aWriter        A Json writer to write the object to.
+ * @param[in]   aErrorCode     An enum HttpStatusCode such as '404'.
+ * @param[in]   aErrorMessage  Error message such as '404 Not Found'.
+ *
+ */
+void Error2Json(JsonWriter &aWriter, HttpStatusCode aErrorCode, const std::string &aErrorMessage);
+
 }; // namespace Json
 
 } // namespace rest
@@ -0,0 +1,384 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the streaming JSON writer for RESTful HTTP server.
+ */
+
+#include "rest/json_writer.hpp"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace otbr {
+namespace rest {
+
+// CBOR major types, and the initial bytes of indefinite-length items.
+static const uint8_t kCborUnsigned   = 0;
+static const uint8_t kCborNegative   = 1;
+static const uint8_t kCborText       = 3;
+static const uint8_t kCborArrayStart = 0x9f;
+static const uint8_t kCborMapStart   = 0xbf;
+static const uint8_t kCborBreak      = 0xff;
+static const uint8_t kCborFalse      = 0xf4;
+static const uint8_t kCborTrue       = 0xf5;
+
+// Arguments below this value are encoded in the initial byte.
+static const uint8_t kCborMaxImmediate = 24;
+
+JsonWriter::JsonWriter(std::string &aOutput, bool aPretty)
+    : mOutput(aOutput)
+    , mPretty(aPretty)
+    , mCbor(false)
+    , mFirst(true)
+    , mAfterKey(false)
+    , mDepth(0)
+    , mArrayMask(0)
+{
+}
+
+JsonWriter::JsonWriter(std::string &aOutput, ContentFormat aFormat)
+    : mOutput(aOutput)
+    , mPretty(aFormat == ContentFormat::kJson)
+    , mCbor(aFormat == ContentFormat::kCbor)
+    , mFirst(true)
+    , mAfterKey(false)
+    , mDepth(0)
+    , mArrayMask(0)
+{
+}
+
+void JsonWriter::CborHead(uint8_t aMajorType, uint64_t aArgument)
+{
+    if (aArgument < kCborMaxImmediate)
+    {
+        mOutput += static_cast<char>((aMajorType << 5) | aArgument);
+    }
+    else
+    {
+        // The argument follows in 1, 2, 4 or 8 bytes, in network byte order.
+        uint8_t size = aArgument <= UINT8_MAX ? 0 : aArgument <= UINT16_MAX ? 1 : aArgument <= UINT32_MAX ? 2 : 3;
+
+        mOutput += static_cast<char>((aMajorType << 5) | (kCborMaxImmediate + size));
+
+        for (int shift = (8 << size) - 8; shift >= 0; shift -= 8)
+        {
+            mOutput += static_cast<char>((aArgument >> shift) & 0xff);
+        }
+    }
+}
+
+void JsonWriter::Indent(uint8_t aDepth)
+{
+    if (mPretty)
+    {
+        mOutput.append(aDepth, '\t');
+    }
+}
+
+void JsonWriter::BeginValue(void)
+{
+    if (mCbor)
+    {
+        // CBOR items need no separator.
+    }
+    else if (mAfterKey)
+    {
+        // Separator is written by Key().
+        mAfterKey = false;
+    }
+    else if (mDepth > 0)
+    {
+        // Array element.
+        if (!mFirst)
+        {
+            mOutput += mPretty ? ", " : ",";
+        }
+        mFirst = false;
+    }
+}
+
+void JsonWriter::Begin(char aBracket, bool aIsArray)
+{
+    BeginValue();
+
+    assert(mDepth < kMaxDepth);
+
+    if (mCbor)
+    {
+        mOutput += static_cast<char>(aIsArray ? kCborArrayStart : kCborMapStart);
+    }
+    else
+    {
+        mOutput += aBracket;
+    }
+
+    if (aIsArray)
+    {
+        mArrayMask |= (uint64_t{1} << mDepth);
+    }
+    else
+    {
+        mArrayMask &= ~(uint64_t{1} << mDepth);
+
+        if (mPretty)
+        {
+            mOutput += '\n';
+        }
+    }
+
+    mDepth++;
+    mFirst = true;
+}
+
+void JsonWriter::End(char aBracket)
+{
+    assert(mDepth > 0);
+
+    mDepth--;
+
+    if (mCbor)
+    {
+        mOutput += static_cast<char>(kCborBreak);
+    }
+    else
+    {
+        if (aBracket == '}')
+        {
+            if (mPretty && !mFirst)
+            {
+                mOutput += '\n';
+            }
+            Indent(mDepth);
+        }
+
+        mOutput += aBracket;
+    }
+
+    mFirst = false;
+}
+
+void JsonWriter::BeginObject(void)
+{
+    Begin('{', false);
+}
+
+void JsonWriter::EndObject(void)
+{
+    End('}');
+}
+
+void JsonWriter::BeginArray(void)
+{
+    Begin('[', true);
+}
+
+void JsonWriter::EndArray(void)
+{
+    End(']');
+}
+
+void JsonWriter::Key(const char *aKey)
+{
+    assert(mDepth > 0 && (mArrayMask & (uint64_t{1} << (mDepth - 1))) == 0);
+
+    if (mCbor)
+    {
+        size_t length = strlen(aKey);
+
+        CborHead(kCborText, length);
+        mOutput.append(aKey, length);
+    }
+    else
+    {
+        if (!mFirst)
+        {
+            mOutput += ',';
+            if (mPretty)
+            {
+                mOutput += '\n';
+            }
+        }
+        mFirst = false;
+
+        Indent(mDepth);
+        mOutput += '"';
+        mOutput += aKey;
+        mOutput += mPretty ? "\":\t" : "\":";
+    }
+
+    mAfterKey = true;
+}
+
+void JsonWriter::Number(uint64_t aValue)
+{
+    char buf[24];
+
+    BeginValue();
+
+    if (mCbor)
+    {
+        CborHead(kCborUnsigned, aValue);
+    }
+    else
+    {
+        mOutput.append(buf, static_cast<size_t>(snprintf(buf, sizeof(buf), "%" PRIu64, aValue)));
+    }
+}
+
+void JsonWriter::SignedNumber(int64_t aValue)
+{
+    char buf[24];
+
+    BeginValue();
+
+    if (mCbor && aValue < 0)
+    {
+        // A negative integer n is encoded as -1 - n.
+        CborHead(kCborNegative, static_cast<uint64_t>(-(aValue + 1)));
+    }
+    else if (mCbor)
+    {
+        CborHead(kCborUnsigned, static_cast<uint64_t>(aValue));
+    }
+    else
+    {
+        mOutput.append(buf, static_cast<size_t>(snprintf(buf, sizeof(buf), "%" PRId64, aValue)));
+    }
+}
+
+void JsonWriter::Bool(bool aValue)
+{
+    BeginValue();
+
+    if (mCbor)
+    {
+        mOutput += static_cast<char>(aValue ? kCborTrue : kCborFalse);
+    }
+    else
+    {
+        mOutput += aValue ? "true" : "false";
+    }
+}
+
+void JsonWriter::String(const char *aString)
+{
+    String(aString, strlen(aString));
+}
+
+void JsonWriter::String(const char *aString, size_t aLength)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    BeginValue();
+
+    if (mCbor)
+    {
+        CborHead(kCborText, aLength);
+        mOutput.append(aString, aLength);
+    }
+    else
+    {
+        mOutput += '"';
+        for (size_t i = 0; i < aLength; i++)
+        {
+            unsigned char c = static_cast<unsigned char>(aString[i]);
+
+            switch (c)
+            {
+            case '"':
+                mOutput += "\\\"";
+                break;
+            case '\\':
+                mOutput += "\\\\";
+                break;
+            case '\b':
+                mOutput += "\\b";
+                break;
+            case '\f':
+                mOutput += "\\f";
+                break;
+            case '\n':
+                mOutput += "\\n";
+                break;
+            case '\r':
+                mOutput += "\\r";
+                break;
+            case '\t':
+                mOutput += "\\t";
+                break;
+            default:
+                if (c < 0x20)
+                {
+                    mOutput += "\\u00";
+                    mOutput += kHexDigits[c >> 4];
+                    mOutput += kHexDigits[c & 0x0f];
+                }
+                else
+                {
+                    mOutput += static_cast<char>(c);
+                }
+                break;
+            }
+        }
+        mOutput += '"';
+    }
+}
+
+void JsonWriter::HexString(const uint8_t *aBytes, uint16_t aLength)
+{
+    static const char kHexDigits[] = "0123456789ABCDEF";
+
+    BeginValue();
+
+    if (mCbor)
+    {
+        CborHead(kCborText, 2 * static_cast<uint64_t>(aLength));
+    }
+    else
+    {
+        mOutput += '"';
+    }
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        mOutput += kHexDigits[aBytes[i] >> 4];
+        mOutput += kHexDigits[aBytes[i] & 0x0f];
+    }
+
+    if (!mCbor)
+    {
+        mOutput += '"';
+    }
+}
+
+} // namespace rest
+} // namespace otbr
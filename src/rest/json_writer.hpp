@@ -0,0 +1,209 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the streaming JSON writer definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_JSON_WRITER_HPP_
+#define OTBR_REST_JSON_WRITER_HPP_
+
+#include <string>
+
+#include <stdint.h>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This enumeration represents the encodings of the values written by `JsonWriter`.
+ *
+ */
+enum class ContentFormat : uint8_t
+{
+    kJson = 0, ///< JSON text, "application/json".
+    kCbor = 1, ///< CBOR (RFC 8949), "application/cbor".
+};
+
+/**
+ * This class implements an append-only JSON writer.
+ *
+ * Values are serialized directly into a caller provided string, so no intermediate tree is built and the output
+ * buffer can be reused across responses. The pretty format is the same as the one produced by cJSON_Print().
+ *
+ * The same values could be encoded as CBOR instead, with indefinite-length arrays and maps so that they are streamed
+ * as well. Hex strings stay text strings, so both encodings share one data model.
+ *
+ */
+class JsonWriter
+{
+public:
+    /**
+     * The constructor of a JSON writer.
+     *
+     * @param[in]   aOutput  A reference to the string the JSON text is appended to.
+     * @param[in]   aPretty  Whether to indent the output, or to write it in the compact form.
+     *
+     */
+    explicit JsonWriter(std::string &aOutput, bool aPretty = true);
+
+    /**
+     * The constructor of a writer of the given encoding, JSON is written in the pretty form.
+     *
+     * @param[in]   aOutput  A reference to the string the encoded values are appended to.
+     * @param[in]   aFormat  The encoding of the values.
+     *
+     */
+    JsonWriter(std::string &aOutput, ContentFormat aFormat);
+
+    /**
+     * This method starts a JSON object.
+     *
+     */
+    void BeginObject(void);
+
+    /**
+     * This method ends the current JSON object.
+     *
+     */
+    void EndObject(void);
+
+    /**
+     * This method starts a JSON array.
+     *
+     */
+    void BeginArray(void);
+
+    /**
+     * This method ends the current JSON array.
+     *
+     */
+    void EndArray(void);
+
+    /**
+     * This method writes the key of the next member of the current object.
+     *
+     * @param[in]   aKey  A C string of the key, it is written as is and must not need escaping.
+     *
+     */
+    void Key(const char *aKey);
+
+    /**
+     * This method writes an unsigned integer value.
+     *
+     * @param[in]   aValue  The value to write.
+     *
+     */
+    void Number(uint64_t aValue);
+
+    /**
+     * This method writes a signed integer value.
+     *
+     * @param[in]   aValue  The value to write.
+     *
+     */
+    void SignedNumber(int64_t aValue);
+
+    /**
+     * This method writes a boolean value.
+     *
+     * @param[in]   aValue  The value to write.
+     *
+     */
+    void Bool(bool aValue);
+
+    /**
+     * This method writes a string value, escaping it as needed.
+     *
+     * @param[in]   aString  A pointer to the characters of the string.
+     * @param[in]   aLength  The number of characters.
+     *
+     */
+    void String(const char *aString, size_t aLength);
+
+    /**
+     * This method writes a string value, escaping it as needed.
+     *
+     * @param[in]   aString  A C string.
+     *
+     */
+    void String(const char *aString);
+
+    /**
+     * This method writes a string value, escaping it as needed.
+     *
+     * @param[in]   aString  A string.
+     *
+     */
+    void String(const std::string &aString) { String(aString.data(), aString.size()); }
+
+    /**
+     * This method writes a byte array as a string of upper case hex digits.
+     *
+     * @param[in]   aBytes   A pointer to the bytes.
+     * @param[in]   aLength  The number of bytes.
+     *
+     */
+    void HexString(const uint8_t *aBytes, uint16_t aLength);
+
+    /**
+     * This method writes a member of the current object with an unsigned integer value.
+     *
+     * @param[in]   aKey    A C string of the key.
+     * @param[in]   aValue  The value to write.
+     *
+     */
+    void Member(const char *aKey, uint64_t aValue)
+    {
+        Key(aKey);
+        Number(aValue);
+    }
+
+private:
+    static constexpr uint8_t kMaxDepth = 64;
+
+    void BeginValue(void);
+    void Begin(char aBracket, bool aIsArray);
+    void End(char aBracket);
+    void Indent(uint8_t aDepth);
+    void CborHead(uint8_t aMajorType, uint64_t aArgument);
+
+    std::string &mOutput;
+    bool         mPretty;
+    bool         mCbor;
+    bool         mFirst;
+    bool         mAfterKey;
+    uint8_t      mDepth;
+    uint64_t     mArrayMask;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_JSON_WRITER_HPP_
@@ -0,0 +1,220 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the metrics of the RESTful HTTP server.
+ */
+
+#include "rest/metrics.hpp"
+
+#if OTBR_ENABLE_MESHCOP_PROXY
+#include "agent/meshcop_proxy.hpp"
+#endif
+#include "agent/radio_link_counters.hpp"
+#include "common/memory_stats.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Upper bounds (in microseconds) of the latency buckets.
+static const uint64_t kBucketBounds[] = {1000,   5000,   10000,   25000,   50000,   100000,
+                                         250000, 500000, 1000000, 2500000, 5000000, 10000000};
+
+// Label of requests not matching any route.
+static const char kUnmatchedResource[] = "unmatched";
+
+static const char *const kPhaseNames[] = {"read", "handle", "write"};
+
+Metrics::Metrics(void)
+    : mRequests("otbr_rest_requests_total", "Requests served, by resource and status code.")
+    , mLatency("otbr_rest_request_duration_seconds",
+               "Time from receiving a request to sending its response.",
+               kBucketBounds,
+               sizeof(kBucketBounds) / sizeof(kBucketBounds[0]),
+               MetricsRegistry::kUnitMicroseconds)
+    , mBytesWritten("otbr_rest_response_bytes_total", "Bytes of responses sent.")
+    , mTimeouts("otbr_rest_timeouts_total", "Requests reaching a read, callback or write timeout.")
+    , mErrors("otbr_rest_errors_total", "Requests failed with a server error or not responded completely.")
+    , mPhases("otbr_rest_phase_duration_seconds",
+              "Time spent in each phase of serving a request.",
+              kBucketBounds,
+              sizeof(kBucketBounds) / sizeof(kBucketBounds[0]),
+              MetricsRegistry::kUnitMicroseconds)
+{
+}
+
+Metrics &Metrics::Get(void)
+{
+    static Metrics sMetrics;
+
+    return sMetrics;
+}
+
+void Metrics::Record(const Sample &aSample)
+{
+    std::string resource =
+        MetricsRegistry::FormatLabel("resource", aSample.mResource != nullptr ? aSample.mResource : kUnmatchedResource);
+    uint64_t latency = 0;
+
+    for (size_t phase = 0; phase < kNumPhases; phase++)
+    {
+        mPhases.Get(MetricsRegistry::FormatLabel("phase", kPhaseNames[phase])).Add(aSample.mDurations[phase]);
+        latency += aSample.mDurations[phase];
+    }
+
+    mRequests.Get(resource + "," + MetricsRegistry::FormatLabel("code", std::to_string(aSample.mStatus))).Add(1);
+    mLatency.Get(resource).Add(latency);
+    mBytesWritten.Get(resource).Add(aSample.mBytesWritten);
+
+    // Every resource has all series, even those still zero.
+    mTimeouts.Get(resource).Add(aSample.mTimedOut ? 1 : 0);
+    mErrors.Get(resource).Add((aSample.mFailed || aSample.mStatus >= 500) ? 1 : 0);
+}
+
+static void WriteCounter(std::string &aOutput, const char *aName, const char *aHelp, uint64_t aValue)
+{
+    aOutput += std::string("# HELP ") + aName + " " + aHelp + "\n# TYPE " + aName + " counter\n";
+    aOutput += std::string(aName) + " " + std::to_string(aValue) + "\n";
+}
+
+void Metrics::Write(std::string &aOutput, uint64_t aResponseCacheHits) const
+{
+    WriteCounter(aOutput, "otbr_rest_response_cache_hits_total", "Responses sharing a cached body.",
+                 aResponseCacheHits);
+    WriteRadioLink(aOutput);
+#if OTBR_ENABLE_MESHCOP_PROXY
+    WriteMeshcopProxy(aOutput);
+#endif
+    WriteMemory(aOutput);
+    MetricsRegistry::Get().WritePrometheus(aOutput);
+}
+
+void Metrics::WriteRadioLink(std::string &aOutput)
+{
+    typedef Ncp::RadioLinkCounters RadioLinkCounters;
+
+    const RadioLinkCounters &counters = RadioLinkCounters::Get();
+
+    // The latency histogram is written by the metrics registry.
+    aOutput += "# HELP otbr_radio_link_frames_total MAC frames exchanged with the RCP, not including retries.\n"
+               "# TYPE otbr_radio_link_frames_total counter\n";
+    aOutput += "otbr_radio_link_frames_total{direction=\"tx\"} " + std::to_string(counters.mLink.mTxFrames) + "\n";
+    aOutput += "otbr_radio_link_frames_total{direction=\"rx\"} " + std::to_string(counters.mLink.mRxFrames) + "\n";
+
+    aOutput += "# HELP otbr_radio_link_bytes_total Bytes exchanged by the radio device, zero if not a UART.\n"
+               "# TYPE otbr_radio_link_bytes_total counter\n";
+    aOutput += "otbr_radio_link_bytes_total{direction=\"tx\"} " + std::to_string(counters.mLink.mTxBytes) + "\n";
+    aOutput += "otbr_radio_link_bytes_total{direction=\"rx\"} " + std::to_string(counters.mLink.mRxBytes) + "\n";
+
+    aOutput += "# HELP otbr_radio_link_errors_total Frames failed to be transmitted or received, and device errors.\n"
+               "# TYPE otbr_radio_link_errors_total counter\n";
+    aOutput += "otbr_radio_link_errors_total{source=\"tx\"} " + std::to_string(counters.mLink.mTxErrors) + "\n";
+    aOutput += "otbr_radio_link_errors_total{source=\"rx\"} " + std::to_string(counters.mLink.mRxErrors) + "\n";
+    aOutput += "otbr_radio_link_errors_total{source=\"device\"} " + std::to_string(counters.mLink.mDeviceErrors) +
+               "\n";
+
+    WriteCounter(aOutput, "otbr_radio_link_retries_total", "MAC frames retransmitted.", counters.mLink.mTxRetries);
+    WriteCounter(aOutput, "otbr_radio_link_resets_total", "RCP resets recovered.", counters.mResets);
+}
+
+#if OTBR_ENABLE_MESHCOP_PROXY
+void Metrics::WriteMeshcopProxy(std::string &aOutput)
+{
+    const MeshcopProxyCounters &counters = MeshcopProxyCounters::Get();
+
+    aOutput += "# HELP otbr_meshcop_proxy_sessions Commissioner sessions open.\n"
+               "# TYPE otbr_meshcop_proxy_sessions gauge\n";
+    aOutput += "otbr_meshcop_proxy_sessions " + std::to_string(counters.mSessions) + "\n";
+
+    WriteCounter(aOutput, "otbr_meshcop_proxy_sessions_opened_total", "Commissioner sessions opened.",
+                 counters.mSessionsOpened);
+    WriteCounter(aOutput, "otbr_meshcop_proxy_sessions_expired_total", "Commissioner sessions closed after being idle.",
+                 counters.mSessionsExpired);
+    WriteCounter(aOutput, "otbr_meshcop_proxy_sessions_evicted_total",
+                 "Idle commissioner sessions closed for new commissioners.", counters.mSessionsEvicted);
+    WriteCounter(aOutput, "otbr_meshcop_proxy_sessions_rejected_total",
+                 "Datagrams of new commissioners dropped as all sessions are in use.", counters.mSessionsRejected);
+
+    aOutput += "# HELP otbr_meshcop_proxy_datagrams_total Datagrams relayed, by direction.\n"
+               "# TYPE otbr_meshcop_proxy_datagrams_total counter\n";
+    aOutput += "otbr_meshcop_proxy_datagrams_total{direction=\"rx\"} " + std::to_string(counters.mRxDatagrams) + "\n";
+    aOutput += "otbr_meshcop_proxy_datagrams_total{direction=\"tx\"} " + std::to_string(counters.mTxDatagrams) + "\n";
+
+    aOutput += "# HELP otbr_meshcop_proxy_bytes_total Bytes relayed, by direction.\n"
+               "# TYPE otbr_meshcop_proxy_bytes_total counter\n";
+    aOutput += "otbr_meshcop_proxy_bytes_total{direction=\"rx\"} " + std::to_string(counters.mRxBytes) + "\n";
+    aOutput += "otbr_meshcop_proxy_bytes_total{direction=\"tx\"} " + std::to_string(counters.mTxBytes) + "\n";
+
+    aOutput += "# HELP otbr_meshcop_proxy_syscalls_total System calls receiving and sending batches of datagrams.\n"
+               "# TYPE otbr_meshcop_proxy_syscalls_total counter\n";
+    aOutput += "otbr_meshcop_proxy_syscalls_total{call=\"recvmmsg\"} " + std::to_string(counters.mReceiveCalls) +
+               "\n";
+    aOutput += "otbr_meshcop_proxy_syscalls_total{call=\"sendmmsg\"} " + std::to_string(counters.mSendCalls) + "\n";
+
+    WriteCounter(aOutput, "otbr_meshcop_proxy_dropped_total", "Datagrams truncated or failed to be relayed.",
+                 counters.mDropped);
+}
+#endif // OTBR_ENABLE_MESHCOP_PROXY
+
+void Metrics::WriteMemory(std::string &aOutput)
+{
+    MemoryStats::Usage process;
+
+    MemoryStats::GetProcessUsage(process);
+
+    aOutput += "# HELP otbr_process_resident_bytes Resident set size of otbr-agent.\n"
+               "# TYPE otbr_process_resident_bytes gauge\n";
+    aOutput += "otbr_process_resident_bytes " + std::to_string(process.mCurrent) + "\n";
+    aOutput += "# HELP otbr_process_resident_peak_bytes High-water mark of the resident set size of otbr-agent.\n"
+               "# TYPE otbr_process_resident_peak_bytes gauge\n";
+    aOutput += "otbr_process_resident_peak_bytes " + std::to_string(process.mPeak) + "\n";
+
+    aOutput += "# HELP otbr_memory_bytes Estimated memory held by each subsystem.\n"
+               "# TYPE otbr_memory_bytes gauge\n";
+    for (uint8_t index = 0; index < MemoryStats::kNumSubsystems; index++)
+    {
+        MemoryStats::Subsystem subsystem = static_cast<MemoryStats::Subsystem>(index);
+
+        aOutput += std::string("otbr_memory_bytes{subsystem=\"") + MemoryStats::GetName(subsystem) + "\"} " +
+                   std::to_string(MemoryStats::Get().GetUsage(subsystem).mCurrent) + "\n";
+    }
+
+    aOutput += "# HELP otbr_memory_peak_bytes Highest estimated memory held by each subsystem.\n"
+               "# TYPE otbr_memory_peak_bytes gauge\n";
+    for (uint8_t index = 0; index < MemoryStats::kNumSubsystems; index++)
+    {
+        MemoryStats::Subsystem subsystem = static_cast<MemoryStats::Subsystem>(index);
+
+        aOutput += std::string("otbr_memory_peak_bytes{subsystem=\"") + MemoryStats::GetName(subsystem) + "\"} " +
+                   std::to_string(MemoryStats::Get().GetUsage(subsystem).mPeak) + "\n";
+    }
+}
+
+} // namespace rest
+} // namespace otbr
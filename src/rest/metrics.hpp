@@ -0,0 +1,127 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the metrics of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_METRICS_HPP_
+#define OTBR_REST_METRICS_HPP_
+
+#include <string>
+
+#include <stdint.h>
+
+#include "common/metrics_registry.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class collects the metrics of served requests in the metrics registry, and writes all metrics in the Prometheus
+ * text format.
+ *
+ * Requests are labeled by the route pattern of their resource, so that the number of series stays bounded.
+ *
+ */
+class Metrics
+{
+public:
+    /**
+     * The phases of serving a request.
+     *
+     */
+    enum Phase : uint8_t
+    {
+        kPhaseRead   = 0, ///< Receiving the request.
+        kPhaseHandle = 1, ///< Handling the request, including waiting for a callback and rendering the body.
+        kPhaseWrite  = 2, ///< Sending the response.
+        kNumPhases   = 3,
+    };
+
+    /**
+     * This structure represents a served request.
+     *
+     */
+    struct Sample
+    {
+        const char *mResource;              ///< The route pattern of the resource, or nullptr if no route matched.
+        uint16_t    mStatus;                ///< The status code of the response.
+        uint64_t    mDurations[kNumPhases]; ///< The time (in microseconds) spent in each phase.
+        uint64_t    mBytesWritten;          ///< The number of bytes of the response sent.
+        bool        mTimedOut;              ///< Whether any phase reached its timeout.
+        bool        mFailed;                ///< Whether the response could not be sent completely.
+    };
+
+    /**
+     * This method returns the singleton metrics.
+     *
+     * @returns A reference to the metrics.
+     *
+     */
+    static Metrics &Get(void);
+
+    /**
+     * This method records a served request.
+     *
+     * @param[in]   aSample     The served request.
+     *
+     */
+    void Record(const Sample &aSample);
+
+    /**
+     * This method writes all metrics in the Prometheus text exposition format.
+     *
+     * @param[out]  aOutput             A reference to the string the metrics are appended to.
+     * @param[in]   aResponseCacheHits  The number of responses which shared a cached body.
+     *
+     */
+    void Write(std::string &aOutput, uint64_t aResponseCacheHits) const;
+
+private:
+    Metrics(void);
+
+    static void WriteRadioLink(std::string &aOutput);
+#if OTBR_ENABLE_MESHCOP_PROXY
+    static void WriteMeshcopProxy(std::string &aOutput);
+#endif
+    static void WriteMemory(std::string &aOutput);
+
+    MetricsRegistry::CounterFamily   mRequests;     ///< Requests, by resource and status code.
+    MetricsRegistry::HistogramFamily mLatency;      ///< Time from receiving a request to sending its response.
+    MetricsRegistry::CounterFamily   mBytesWritten; ///< Bytes of responses, by resource.
+    MetricsRegistry::CounterFamily   mTimeouts;     ///< Requests reaching a timeout, by resource.
+    MetricsRegistry::CounterFamily   mErrors;       ///< Requests failed, by resource.
+    MetricsRegistry::HistogramFamily mPhases;       ///< Time spent in each phase.
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_METRICS_HPP_
@@ -28,42 +28,95 @@
 
 #include "rest/parser.hpp"
 
+#include <limits.h>
+
 #include <string>
 #include <vector>
 
 namespace otbr {
 namespace rest {
 
+// Fails the parsing as soon as the url and the header fields exceed their limit.
+static int CheckHeaderSize(Request *aRequest, size_t aLength)
+{
+    int ret = 0;
+
+    if (aRequest->GetHeaderSize() + aLength > OTBR_REST_MAX_HEADER_SIZE)
+    {
+        aRequest->SetParseError(HttpStatusCode::kStatusRequestHeaderFieldsTooLarge);
+        ret = -1;
+    }
+
+    return ret;
+}
+
 static int OnUrl(http_parser *parser, const char *at, size_t len)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      ret     = CheckHeaderSize(request, len);
 
-    if (len > 0)
+    if (ret == 0 && len > 0)
     {
         request->SetUrl(at, len);
     }
 
-    return 0;
+    return ret;
 }
 
 static int OnBody(http_parser *parser, const char *at, size_t len)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      ret     = 0;
 
-    if (len > 0)
+    if (request->GetBodySize() + len > OTBR_REST_MAX_BODY_SIZE)
+    {
+        request->SetParseError(HttpStatusCode::kStatusPayloadTooLarge);
+        ret = -1;
+    }
+    else if (len > 0)
     {
         request->SetBody(at, len);
     }
 
-    return 0;
+    return ret;
+}
+
+static int OnHeaderField(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+    int      ret     = CheckHeaderSize(request, len);
+
+    if (ret == 0)
+    {
+        request->SetHeaderField(at, len);
+    }
+
+    return ret;
+}
+
+static int OnHeaderValue(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+    int      ret     = CheckHeaderSize(request, len);
+
+    if (ret == 0)
+    {
+        request->SetHeaderValue(at, len);
+    }
+
+    return ret;
 }
 
 static int OnMessageComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
 
+    request->SetKeepAlive(http_should_keep_alive(parser) != 0);
     request->SetReadComplete();
 
+    // Stop right after this request, pipelined requests are parsed after it's handled.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -78,8 +131,19 @@ static int OnMessageBegin(http_parser *parser)
 static int OnHeaderComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      ret     = 0;
+
+    // Reject an announced body too large before receiving it, the length is ULLONG_MAX when not announced.
+    if (parser->content_length != ULLONG_MAX && parser->content_length > OTBR_REST_MAX_BODY_SIZE)
+    {
+        request->SetParseError(HttpStatusCode::kStatusPayloadTooLarge);
+        ExitNow(ret = -1);
+    }
+
     request->SetMethod(parser->method);
-    return 0;
+
+exit:
+    return ret;
 }
 
 static int OnHandlerData(http_parser *, const char *, size_t)
@@ -97,17 +161,29 @@ void Parser::Init(void)
     mSettings.on_message_begin    = OnMessageBegin;
     mSettings.on_url              = OnUrl;
     mSettings.on_status           = OnHandlerData;
-    mSettings.on_header_field     = OnHandlerData;
-    mSettings.on_header_value     = OnHandlerData;
+    mSettings.on_header_field     = OnHeaderField;
+    mSettings.on_header_value     = OnHeaderValue;
     mSettings.on_body             = OnBody;
     mSettings.on_headers_complete = OnHeaderComplete;
     mSettings.on_message_complete = OnMessageComplete;
     http_parser_init(&mParser, HTTP_REQUEST);
 }
 
-void Parser::Process(const char *aBuf, size_t aLength)
+void Parser::Reset(void)
+{
+    http_parser_init(&mParser, HTTP_REQUEST);
+}
+
+size_t Parser::Process(const char *aBuf, size_t aLength)
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    return http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+}
+
+bool Parser::HasError(void) const
+{
+    enum http_errno error = HTTP_PARSER_ERRNO(&mParser);
+
+    return error != HPE_OK && error != HPE_PAUSED;
 }
 
 } // namespace rest
@@ -68,14 +68,33 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method resets the http-parser to parse the next request on the same connection.
+     *
+     */
+    void Reset(void);
+
     /**
      * This method performs a parse process.
      *
+     * The parser stops after a complete request, until `Reset()` is called.
+     *
      * @param[in]    aBuf      A pointer pointing to read buffer.
      * @param[in]    aLength   An integer indicates how much data is to be processed by parser.
      *
+     * @returns The number of bytes consumed by the parser.
+     *
+     */
+    size_t Process(const char *aBuf, size_t aLength);
+
+    /**
+     * This method indicates whether the parser failed to parse the request.
+     *
+     * @retval  true     The request is malformed.
+     * @retval  false    No error occurred.
+     *
      */
-    void Process(const char *aBuf, size_t aLength);
+    bool HasError(void) const;
 
 private:
     http_parser          mParser;
@@ -0,0 +1,119 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the rate limiter of the RESTful HTTP server.
+ */
+
+#include "rest/rate_limiter.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Maximum number of clients with a bucket that is not full.
+static const size_t kMaxLimitedClients = 1024;
+
+RateLimiter::RateLimiter(uint32_t aInterval, uint32_t aBurst)
+    : mInterval(aInterval)
+    , mBurstDuration(static_cast<uint64_t>(aInterval) * aBurst)
+{
+}
+
+bool RateLimiter::Allow(const std::string &aClient, steady_clock::time_point aNow)
+{
+    bool                     allowed = false;
+    auto                     it      = mFullTimes.find(aClient);
+    steady_clock::time_point fullTime;
+
+    VerifyOrExit(!IsExempt(aClient), allowed = true);
+
+    if (it == mFullTimes.end())
+    {
+        if (mFullTimes.size() >= kMaxLimitedClients)
+        {
+            Purge(aNow);
+        }
+
+        // A new client starts with a full bucket, unless there is no room to track it.
+        VerifyOrExit(mFullTimes.size() < kMaxLimitedClients);
+        it = mFullTimes.emplace(aClient, aNow).first;
+    }
+
+    // The bucket is full at `fullTime`, taking a token delays it by an interval.
+    fullTime = std::max(it->second, aNow) + mInterval;
+    VerifyOrExit(fullTime - aNow <= mBurstDuration);
+
+    it->second = fullTime;
+    allowed    = true;
+
+exit:
+    return allowed;
+}
+
+uint32_t RateLimiter::GetRetryAfter(void) const
+{
+    // Round up to whole seconds, at least one.
+    return std::max<uint32_t>(1, static_cast<uint32_t>((mInterval.count() + 999) / 1000));
+}
+
+bool RateLimiter::IsExempt(const std::string &aClient)
+{
+    bool exempt = false;
+
+#if !OTBR_REST_RATE_LIMIT_LOOPBACK
+    exempt = aClient == "::1" || aClient.compare(0, 4, "127.") == 0 || aClient.compare(0, 11, "::ffff:127.") == 0 ||
+             aClient.compare(0, 5, "unix:") == 0;
+#else
+    OTBR_UNUSED_VARIABLE(aClient);
+#endif
+
+    return exempt;
+}
+
+void RateLimiter::Purge(steady_clock::time_point aNow)
+{
+    for (auto it = mFullTimes.begin(); it != mFullTimes.end();)
+    {
+        if (it->second <= aNow)
+        {
+            it = mFullTimes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the rate limiter of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_RATE_LIMITER_HPP_
+#define OTBR_REST_RATE_LIMITER_HPP_
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+#include <stdint.h>
+
+/**
+ * Whether clients on the loopback interface or the Unix domain socket, i.e. applications on the border router itself,
+ * are limited.
+ *
+ */
+#ifndef OTBR_REST_RATE_LIMIT_LOOPBACK
+#define OTBR_REST_RATE_LIMIT_LOOPBACK 0
+#endif
+
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a token bucket per client.
+ *
+ * A bucket holds up to a burst of tokens and gains one token per interval, each admitted request takes one token.
+ * A bucket is kept as the time it becomes full, so an idle client costs nothing and is forgotten.
+ *
+ */
+class RateLimiter
+{
+public:
+    /**
+     * The constructor of a rate limiter.
+     *
+     * @param[in]   aInterval   The interval (in milliseconds) to gain a token.
+     * @param[in]   aBurst      The number of tokens of a full bucket.
+     *
+     */
+    RateLimiter(uint32_t aInterval, uint32_t aBurst);
+
+    /**
+     * This method takes a token of a client if there is any.
+     *
+     * @param[in]   aClient     The client, identified by its address.
+     * @param[in]   aNow        The current time.
+     *
+     * @retval  true     The request is admitted.
+     * @retval  false    The bucket of the client is empty, or too many clients are limited at the same time.
+     *
+     */
+    bool Allow(const std::string &aClient, steady_clock::time_point aNow);
+
+    /**
+     * This method returns how long a rejected client should wait before retrying.
+     *
+     * @returns The time (in seconds) to gain a token.
+     *
+     */
+    uint32_t GetRetryAfter(void) const;
+
+    /**
+     * This method indicates whether a client is exempt from limits.
+     *
+     * @param[in]   aClient     The client, identified by its address.
+     *
+     * @retval  true     The client is never limited.
+     * @retval  false    The client is limited.
+     *
+     */
+    static bool IsExempt(const std::string &aClient);
+
+private:
+    void Purge(steady_clock::time_point aNow);
+
+    std::chrono::milliseconds                                 mInterval;
+    std::chrono::milliseconds                                 mBurstDuration;
+    std::unordered_map<std::string, steady_clock::time_point> mFullTimes;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_RATE_LIMITER_HPP_
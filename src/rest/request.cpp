@@ -28,22 +28,189 @@
 
 #include "rest/request.hpp"
 
+#include <algorithm>
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
 namespace otbr {
 namespace rest {
 
 Request::Request(void)
-    : mComplete(false)
+    : mInput(nullptr)
+    , mUrl(mArena)
+    , mBody(mArena)
+    , mHeaderSize(0)
+    , mParseError(HttpStatusCode::kStatusBadRequest)
+    , mComplete(false)
+    , mKeepAlive(false)
+    , mParsingHeaderValue(false)
+    , mHeaders(ArenaAllocator<Header>(mArena))
+{
+}
+
+void Request::Reset(void)
+{
+    // Drop the memory of the arena before releasing it, deallocation is a no-op.
+    mUrl  = InputString(mArena);
+    mBody = InputString(mArena);
+    ArenaVector<Header>(mHeaders.get_allocator()).swap(mHeaders);
+    mArena.Reset();
+
+    mPathParameters.clear();
+    mHeaderSize         = 0;
+    mParseError         = HttpStatusCode::kStatusBadRequest;
+    mComplete           = false;
+    mKeepAlive          = false;
+    mParsingHeaderValue = false;
+}
+
+void Request::Append(InputString &aString, const char *aData, size_t aLength)
+{
+    size_t offset = static_cast<size_t>(aData - mInput->data());
+
+    if (aString.mLength == 0 && !aString.mCopied)
+    {
+        aString.mOffset = offset;
+    }
+    else if (aString.mCopied || aString.mOffset + aString.mLength != offset)
+    {
+        // The pieces are not adjacent in the input, e.g. the chunks of a body, join them in a copy.
+        if (!aString.mCopied)
+        {
+            aString.mCopy.assign(mInput->data() + aString.mOffset, aString.mLength);
+            aString.mCopied = true;
+        }
+
+        aString.mCopy.append(aData, aLength);
+    }
+
+    aString.mLength += aLength;
+}
+
+const char *Request::GetData(const InputString &aString) const
 {
+    const char *data = nullptr;
+
+    if (aString.mCopied)
+    {
+        data = aString.mCopy.data();
+    }
+    else if (mInput != nullptr && aString.mOffset + aString.mLength <= mInput->size())
+    {
+        data = mInput->data() + aString.mOffset;
+    }
+
+    return data;
+}
+
+std::string Request::ToString(const InputString &aString) const
+{
+    const char *data = GetData(aString);
+
+    return data != nullptr ? std::string(data, aString.mLength) : std::string();
 }
 
 void Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    Append(mUrl, aString, aLength);
+    mHeaderSize += aLength;
 }
 
 void Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    Append(mBody, aString, aLength);
+}
+
+void Request::SetHeaderField(const char *aString, size_t aLength)
+{
+    if (mHeaders.empty() || mParsingHeaderValue)
+    {
+        mHeaders.emplace_back(InputString(mArena), InputString(mArena));
+        mParsingHeaderValue = false;
+    }
+
+    Append(mHeaders.back().first, aString, aLength);
+    mHeaderSize += aLength;
+}
+
+void Request::SetHeaderValue(const char *aString, size_t aLength)
+{
+    if (!mHeaders.empty())
+    {
+        Append(mHeaders.back().second, aString, aLength);
+        mHeaderSize += aLength;
+        mParsingHeaderValue = true;
+    }
+}
+
+std::string Request::GetHeaderValue(const char *aField) const
+{
+    std::string value;
+    size_t      length = strlen(aField);
+
+    for (const auto &header : mHeaders)
+    {
+        const char *field = GetData(header.first);
+
+        if (field != nullptr && header.first.mLength == length && strncasecmp(field, aField, length) == 0)
+        {
+            ExitNow(value = ToString(header.second));
+        }
+    }
+
+exit:
+    return value;
+}
+
+ContentFormat Request::GetPreferredFormat(void) const
+{
+    std::string accept      = GetHeaderValue("Accept");
+    double      cborQuality = 0;
+    double      jsonQuality = 0;
+    size_t      start       = 0;
+
+    while (start < accept.size())
+    {
+        size_t      end = accept.find(',', start);
+        size_t      parameters;
+        std::string range;
+        double      quality = 1;
+
+        if (end == std::string::npos)
+        {
+            end = accept.size();
+        }
+
+        range      = accept.substr(start, end - start);
+        parameters = range.find(';');
+        if (parameters != std::string::npos)
+        {
+            size_t q = range.find("q=", parameters);
+
+            if (q != std::string::npos)
+            {
+                quality = strtod(range.c_str() + q + 2, nullptr);
+            }
+            range.resize(parameters);
+        }
+        range.erase(0, range.find_first_not_of(' '));
+        range.erase(range.find_last_not_of(' ') + 1);
+
+        if (strcasecmp(range.c_str(), "application/cbor") == 0)
+        {
+            cborQuality = std::max(cborQuality, quality);
+        }
+        else if (strcasecmp(range.c_str(), "application/json") == 0 || range == "application/*" || range == "*/*")
+        {
+            jsonQuality = std::max(jsonQuality, quality);
+        }
+
+        start = end + 1;
+    }
+
+    return cborQuality > jsonQuality ? ContentFormat::kCbor : ContentFormat::kJson;
 }
 
 void Request::SetContentLength(size_t aContentLength)
@@ -63,12 +230,12 @@ HttpMethod Request::GetMethod() const
 
 std::string Request::GetBody() const
 {
-    return mBody;
+    return ToString(mBody);
 }
 
 std::string Request::GetUrl(void) const
 {
-    std::string url = mUrl;
+    std::string url = ToString(mUrl);
 
     size_t urlEnd = url.find("?");
 
@@ -87,11 +254,125 @@ exit:
     return url;
 }
 
+static int HexValue(char aChar)
+{
+    int value = -1;
+
+    if (aChar >= '0' && aChar <= '9')
+    {
+        value = aChar - '0';
+    }
+    else if (aChar >= 'a' && aChar <= 'f')
+    {
+        value = aChar - 'a' + 10;
+    }
+    else if (aChar >= 'A' && aChar <= 'F')
+    {
+        value = aChar - 'A' + 10;
+    }
+
+    return value;
+}
+
+static std::string PercentDecode(const char *aString, size_t aLength)
+{
+    std::string ret;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        int high, low;
+
+        if (aString[i] == '%' && i + 2 < aLength && (high = HexValue(aString[i + 1])) >= 0 &&
+            (low = HexValue(aString[i + 2])) >= 0)
+        {
+            ret += static_cast<char>((high << 4) | low);
+            i += 2;
+        }
+        else if (aString[i] == '+')
+        {
+            ret += ' ';
+        }
+        else
+        {
+            ret += aString[i];
+        }
+    }
+
+    return ret;
+}
+
+std::string Request::GetTarget(void) const
+{
+    return ToString(mUrl);
+}
+
+std::string Request::GetQueryParameter(const std::string &aName) const
+{
+    std::string value;
+    const char *data = GetData(mUrl);
+    const char *query;
+
+    VerifyOrExit(data != nullptr);
+
+    query = static_cast<const char *>(memchr(data, '?', mUrl.mLength));
+    VerifyOrExit(query != nullptr);
+
+    for (size_t start = static_cast<size_t>(query - data); start < mUrl.mLength;)
+    {
+        const char *next   = static_cast<const char *>(memchr(data + start + 1, '&', mUrl.mLength - start - 1));
+        const char *equals = static_cast<const char *>(memchr(data + start + 1, '=', mUrl.mLength - start - 1));
+        size_t      end    = (next != nullptr) ? static_cast<size_t>(next - data) : mUrl.mLength;
+        size_t      assign = (equals != nullptr) ? static_cast<size_t>(equals - data) : mUrl.mLength;
+
+        if (assign < end && assign - start - 1 == aName.size() &&
+            memcmp(data + start + 1, aName.data(), aName.size()) == 0)
+        {
+            ExitNow(value = PercentDecode(data + assign + 1, end - assign - 1));
+        }
+
+        start = end;
+    }
+
+exit:
+    return value;
+}
+
+void Request::SetPathParameters(const std::vector<std::pair<std::string, std::string>> &aParameters)
+{
+    mPathParameters = aParameters;
+}
+
+std::string Request::GetPathParameter(const char *aName) const
+{
+    std::string value;
+
+    for (const auto &parameter : mPathParameters)
+    {
+        if (parameter.first == aName)
+        {
+            ExitNow(value = parameter.second);
+        }
+    }
+
+exit:
+    return value;
+}
+
 void Request::SetReadComplete(void)
 {
     mComplete = true;
 }
 
+void Request::SetClientAddress(const std::string &aClientAddress)
+{
+    mClientAddress = aClientAddress;
+}
+
+const std::string &Request::GetClientAddress(void) const
+{
+    return mClientAddress;
+}
+
 void Request::ResetReadComplete(void)
 {
     mComplete = false;
@@ -102,5 +383,15 @@ bool Request::IsComplete(void) const
     return mComplete;
 }
 
+void Request::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
+bool Request::IsKeepAlive(void) const
+{
+    return mKeepAlive;
+}
+
 } // namespace rest
 } // namespace otbr
@@ -37,15 +37,39 @@
 #include <string>
 #include <vector>
 
+#include "common/arena.hpp"
 #include "common/code_utils.hpp"
+#include "rest/json_writer.hpp"
 #include "rest/types.hpp"
 
 namespace otbr {
 namespace rest {
 
+/**
+ * The maximum number of bytes of the url and the header fields of a request, larger requests are rejected with 431
+ * as soon as the limit is crossed.
+ *
+ */
+#ifndef OTBR_REST_MAX_HEADER_SIZE
+#define OTBR_REST_MAX_HEADER_SIZE 8192
+#endif
+
+/**
+ * The maximum number of bytes of the body of a request, larger requests are rejected with 413 as soon as the limit is
+ * crossed or announced by the Content-Length header.
+ *
+ */
+#ifndef OTBR_REST_MAX_BODY_SIZE
+#define OTBR_REST_MAX_BODY_SIZE 16384
+#endif
+
 /**
  * This class implements an instance to host services used by border router.
  *
+ * The url, body and header fields refer to the input buffer of the connection the request is parsed from, which is
+ * kept until the next request. Only a field received in pieces which are not adjacent in the input, e.g. a chunked
+ * body, is copied into an arena of the request.
+ *
  */
 class Request
 {
@@ -56,6 +80,25 @@ public:
      */
     Request(void);
 
+    /**
+     * This method clears the request so that the instance could be reused for the next request.
+     *
+     * The copied fields are allocated from an arena of the request, which is released in one shot here.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method sets the input buffer the request is parsed from.
+     *
+     * The data passed to the setters of the fields must be in this buffer, which must not be shifted or cleared while
+     * the request is used.
+     *
+     * @param[in]  aInput    The input buffer.
+     *
+     */
+    void SetInput(const std::string &aInput) { mInput = &aInput; }
+
     /**
      * This method sets the Url field of a request.
      *
@@ -74,6 +117,24 @@ public:
      */
     void SetBody(const char *aString, size_t aLength);
 
+    /**
+     * This method appends to the name of the header field being parsed, or starts a new header field.
+     *
+     * @param[in]  aString    A pointer points to the header field name string.
+     * @param[in]  aLength    Length of the header field name string
+     *
+     */
+    void SetHeaderField(const char *aString, size_t aLength);
+
+    /**
+     * This method appends to the value of the header field being parsed.
+     *
+     * @param[in]  aString    A pointer points to the header field value string.
+     * @param[in]  aLength    Length of the header field value string
+     *
+     */
+    void SetHeaderValue(const char *aString, size_t aLength);
+
     /**
      * This method sets the content-length field of a request.
      *
@@ -82,6 +143,38 @@ public:
      */
     void SetContentLength(size_t aContentLength);
 
+    /**
+     * This method returns the number of bytes of the url and the header fields received.
+     *
+     * @returns The number of bytes.
+     *
+     */
+    size_t GetHeaderSize(void) const { return mHeaderSize; }
+
+    /**
+     * This method returns the number of bytes of the body received.
+     *
+     * @returns The number of bytes.
+     *
+     */
+    size_t GetBodySize(void) const { return mBody.mLength; }
+
+    /**
+     * This method sets the error to respond with when the request fails to be parsed.
+     *
+     * @param[in]  aError    The HTTP status code.
+     *
+     */
+    void SetParseError(HttpStatusCode aError) { mParseError = aError; }
+
+    /**
+     * This method returns the error to respond with when the request fails to be parsed.
+     *
+     * @returns The HTTP status code set by `SetParseError()`, or 400 if none was set.
+     *
+     */
+    HttpStatusCode GetParseError(void) const { return mParseError; }
+
     /**
      * This method sets the method of the parsed request.
      *
@@ -96,6 +189,14 @@ public:
      */
     void SetReadComplete(void);
 
+    /**
+     * This method sets whether the client wants to keep the connection open after this request.
+     *
+     * @param[in]  aKeepAlive    A boolean indicates whether to keep the connection open.
+     *
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
     /**
      * This method resets the request then it could be set by parser from start.
      *
@@ -123,6 +224,72 @@ public:
      */
     std::string GetUrl(void) const;
 
+    /**
+     * This method returns the target of this request, i.e. the url with the query, as received.
+     *
+     * @returns A string contains the target of this request.
+     */
+    std::string GetTarget(void) const;
+
+    /**
+     * This method returns the value of a query parameter in the url of this request.
+     *
+     * @param[in]  aName    The name of the query parameter.
+     *
+     * @returns A string contains the percent-decoded value, or an empty string if the parameter is not present.
+     */
+    std::string GetQueryParameter(const std::string &aName) const;
+
+    /**
+     * This method sets the address of the client sending this request.
+     *
+     * @param[in]  aClientAddress  The address of the client.
+     *
+     */
+    void SetClientAddress(const std::string &aClientAddress);
+
+    /**
+     * This method returns the address of the client sending this request.
+     *
+     * @returns A string contains the address of the client.
+     */
+    const std::string &GetClientAddress(void) const;
+
+    /**
+     * This method sets the path parameters captured by the route of this request.
+     *
+     * @param[in]  aParameters  The path parameters, as pairs of name and value.
+     *
+     */
+    void SetPathParameters(const std::vector<std::pair<std::string, std::string>> &aParameters);
+
+    /**
+     * This method returns the value of a path parameter captured by the route of this request.
+     *
+     * @param[in]  aName    The name of the path parameter.
+     *
+     * @returns A string contains the value, or an empty string if the parameter is not present.
+     */
+    std::string GetPathParameter(const char *aName) const;
+
+    /**
+     * This method returns the value of a header field of this request.
+     *
+     * @param[in]  aField    The case-insensitive name of the header field.
+     *
+     * @returns A string contains the value, or an empty string if the header field is not present.
+     */
+    std::string GetHeaderValue(const char *aField) const;
+
+    /**
+     * This method returns the encoding of the response body preferred by the Accept header of this request.
+     *
+     * CBOR is only chosen when the client prefers it over JSON, which is the default.
+     *
+     * @returns The preferred encoding of the response body.
+     */
+    ContentFormat GetPreferredFormat(void) const;
+
     /**
      * This method indicates whether this request is parsed completely.
      *
@@ -130,12 +297,63 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method indicates whether the client wants to keep the connection open after this request.
+     *
+     * @retval  true     The connection should be kept open.
+     * @retval  false    The connection should be closed after the response.
+     *
+     */
+    bool IsKeepAlive(void) const;
+
+    /**
+     * This method returns the memory held by the request, including the blocks its arena keeps.
+     *
+     * @returns The number of bytes allocated.
+     *
+     */
+    size_t GetMemoryUsage(void) const { return mArena.GetCapacity() + mClientAddress.capacity(); }
+
 private:
-    int32_t     mMethod;
-    size_t      mContentLength;
-    std::string mUrl;
-    std::string mBody;
-    bool        mComplete;
+    struct InputString
+    {
+        explicit InputString(Arena &aArena)
+            : mOffset(0)
+            , mLength(0)
+            , mCopied(false)
+            , mCopy(ArenaAllocator<char>(aArena))
+        {
+        }
+
+        size_t      mOffset; ///< The offset of the string in the input, unless copied.
+        size_t      mLength; ///< The length of the string.
+        bool        mCopied; ///< Whether the string is copied, as its pieces are not adjacent in the input.
+        ArenaString mCopy;   ///< The copied string.
+    };
+
+    typedef std::pair<InputString, InputString> Header;
+
+    void        Append(InputString &aString, const char *aData, size_t aLength);
+    const char *GetData(const InputString &aString) const;
+    std::string ToString(const InputString &aString) const;
+
+    // Declared first, as the fields below allocate from it
+    Arena mArena;
+
+    const std::string *mInput;
+    int32_t            mMethod;
+    size_t             mContentLength;
+    InputString        mUrl;
+    InputString        mBody;
+    size_t             mHeaderSize;
+    HttpStatusCode     mParseError;
+    std::string        mClientAddress;
+    bool               mComplete;
+    bool               mKeepAlive;
+    bool               mParsingHeaderValue;
+
+    ArenaVector<Header>                              mHeaders;
+    std::vector<std::pair<std::string, std::string>> mPathParameters;
 };
 
 } // namespace rest
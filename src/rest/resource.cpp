@@ -28,12 +28,35 @@
 
 #include "rest/resource.hpp"
 
+#include <algorithm>
+#include <memory>
+
 #include "string.h"
+#include <errno.h>
+#include <stdlib.h>
+
+#include "agent/radio_link_counters.hpp"
+#include "common/health.hpp"
+#include "common/mainloop_clock.hpp"
+#include "common/memory_stats.hpp"
+#include "common/trace.hpp"
+#include "rest/metrics.hpp"
+#include "rest/worker_pool.hpp"
+#include "utils/etag.hpp"
+#include "utils/state_cache.hpp"
 
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOETIC "/diagnostics"
+#define OT_REST_RESOURCE_PATH_DIAGNOETIC_NODE "/diagnostics/{rloc16}"
+#define OT_REST_RESOURCE_PATH_EVENTS "/events"
+#define OT_REST_RESOURCE_PATH_BATCH "/batch"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
+#define OT_REST_RESOURCE_PATH_HEALTH "/health"
+#define OT_REST_RESOURCE_PATH_TOPOLOGY "/topology"
+#define OT_REST_RESOURCE_PATH_MESH_COUNTERS "/mesh/counters"
+#define OT_REST_RESOURCE_PATH_COMMISSIONING "/commissioning"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
@@ -43,19 +66,32 @@
 #define OT_REST_RESOURCE_PATH_NODE_LEADERDATA "/node/leader-data"
 #define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
+#define OT_REST_RESOURCE_PATH_NODE_NETWORKDATA "/node/network-data"
+#define OT_REST_RESOURCE_PATH_NODE_CHILDTABLE "/node/child-table"
+#define OT_REST_RESOURCE_PATH_NODE_NEIGHBORTABLE "/node/neighbor-table"
+#define OT_REST_RESOURCE_PATH_NODE_LINK_QUALITY "/node/neighbor-table/link-quality"
+#define OT_REST_RESOURCE_PATH_NODE_COUNTERS_HISTORY "/node/counters/history"
+#define OT_REST_RESOURCE_PATH_NODE_CHANNEL_HISTORY "/node/channel-occupancy/history"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
+#define OT_REST_HTTP_STATUS_304 "304 Not Modified"
+#define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
 #define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
+#define OT_REST_HTTP_STATUS_413 "413 Payload Too Large"
+#define OT_REST_HTTP_STATUS_429 "429 Too Many Requests"
+#define OT_REST_HTTP_STATUS_431 "431 Request Header Fields Too Large"
 #define OT_REST_HTTP_STATUS_500 "500 Internal Server Error"
+#define OT_REST_HTTP_STATUS_503 "503 Service Unavailable"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
+using std::chrono::milliseconds;
 using std::chrono::steady_clock;
 
 using std::placeholders::_1;
@@ -73,9 +109,30 @@ static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16,
 // Timeout (in Microseconds) for deleting outdated diagnostics
 static const uint32_t kDiagResetTimeout = 3000000;
 
+// Initial period (in Microseconds) for refreshing diagnostics in background
+static const uint64_t kDiagRefreshPeriod = OTBR_REST_DIAG_REFRESH_PERIOD * 1000000ull;
+
+// Period (in Microseconds) for querying the TLVs which rarely change
+static const uint64_t kDiagStaticRefreshPeriod = OTBR_REST_DIAG_STATIC_REFRESH_PERIOD * 1000000ull;
+
+// Payload (in bytes) of a MAC frame carrying a diagnostic response, and the airtime (in Microseconds) of a full frame
+// at 250 kbit/s with its acknowledgment and backoff
+static const uint32_t kDiagFramePayload = 80;
+static const uint32_t kDiagFrameAirtime = 5000;
+
+// TLV types whose changes do not make the diagnostics refreshed more often, the counters change at each response
+static const uint32_t kDiagVolatileTlvMask = 1u << OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+
+// RLOC16 the diagnostics of a node are cached under when its response has no Address16 TLV
+static const uint16_t kUnknownRloc16 = 0xffee;
+
 // Timeout (in Microseconds) for collecting diagnostics
 static const uint32_t kDiagCollectTimeout = 2000000;
 
+// Timeout (in Microseconds) for collecting diagnostics while unicast queries are still sent, within the callback
+// timeout of connections
+static const uint32_t kDiagCollectMaxTimeout = 8000000;
+
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
     std::string httpStatus;
@@ -85,6 +142,12 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusOk:
         httpStatus = OT_REST_HTTP_STATUS_200;
         break;
+    case HttpStatusCode::kStatusNotModified:
+        httpStatus = OT_REST_HTTP_STATUS_304;
+        break;
+    case HttpStatusCode::kStatusBadRequest:
+        httpStatus = OT_REST_HTTP_STATUS_400;
+        break;
     case HttpStatusCode::kStatusResourceNotFound:
         httpStatus = OT_REST_HTTP_STATUS_404;
         break;
@@ -94,133 +157,512 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusRequestTimeout:
         httpStatus = OT_REST_HTTP_STATUS_408;
         break;
+    case HttpStatusCode::kStatusPayloadTooLarge:
+        httpStatus = OT_REST_HTTP_STATUS_413;
+        break;
+    case HttpStatusCode::kStatusTooManyRequests:
+        httpStatus = OT_REST_HTTP_STATUS_429;
+        break;
+    case HttpStatusCode::kStatusRequestHeaderFieldsTooLarge:
+        httpStatus = OT_REST_HTTP_STATUS_431;
+        break;
     case HttpStatusCode::kStatusInternalServerError:
         httpStatus = OT_REST_HTTP_STATUS_500;
         break;
+    case HttpStatusCode::kStatusServiceUnavailable:
+        httpStatus = OT_REST_HTTP_STATUS_503;
+        break;
     }
 
     return httpStatus;
 }
 
-Resource::Resource(ControllerOpenThread *aNcp)
-    : mNcp(aNcp)
+static uint32_t TlvMask(uint8_t aType)
 {
-    mInstance = mNcp->GetThreadHelper()->GetInstance();
+    // Types out of the mask are not filterable, they are never queried.
+    return aType < 32 ? (1u << aType) : 0;
+}
+
+static uint32_t AllTlvMask(void)
+{
+    uint32_t mask = 0;
+
+    for (uint8_t type : kAllTlvTypes)
+    {
+        mask |= TlvMask(type);
+    }
+
+    return mask;
+}
+
+static uint32_t StaticTlvMask(void)
+{
+    // The TLVs of a node which change on its reconfiguration rather than with the traffic or the topology.
+    return TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS) | TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_MODE) |
+           TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT) | TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST) |
+           TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL) | TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE) |
+           TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES) | TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT);
+}
+
+static bool ParseRloc16(const std::string &aString, uint16_t &aRloc16)
+{
+    char *        end;
+    unsigned long value = strtoul(aString.c_str(), &end, 16);
+
+    aRloc16 = static_cast<uint16_t>(value);
+
+    return !aString.empty() && *end == '\0' && value <= 0xffff;
+}
+
+static bool ParseVersion(const std::string &aString, uint32_t &aVersion)
+{
+    char *             end;
+    unsigned long long value = strtoull(aString.c_str(), &end, 10);
+
+    aVersion = static_cast<uint32_t>(value);
+
+    return !aString.empty() && aString[0] != '-' && *end == '\0' && value <= UINT32_MAX;
+}
+
+static bool ParseTime(const std::string &aString, uint64_t &aTime)
+{
+    char *             end;
+    unsigned long long value;
+
+    errno = 0;
+    value = strtoull(aString.c_str(), &end, 10);
+    aTime = static_cast<uint64_t>(value);
+
+    return !aString.empty() && aString[0] != '-' && *end == '\0' && errno != ERANGE;
+}
+
+// A page is requested by a limit, a cursor or both. The cursor is the hexadecimal key of the first entry of the page,
+// as given by the Next-Cursor header of the previous page.
+static bool ParsePage(const Request &aRequest, uint64_t aMaxCursor, uint64_t &aCursor, size_t &aLimit)
+{
+    bool               ret    = false;
+    std::string        cursor = aRequest.GetQueryParameter("cursor");
+    std::string        limit  = aRequest.GetQueryParameter("limit");
+    char *             end;
+    unsigned long long value;
+
+    aCursor = 0;
+    aLimit  = SIZE_MAX;
+
+    if (!cursor.empty())
+    {
+        errno = 0;
+        value = strtoull(cursor.c_str(), &end, 16);
+        VerifyOrExit(cursor[0] != '-' && *end == '\0' && errno != ERANGE && value <= aMaxCursor);
+        aCursor = value;
+        aLimit  = OTBR_REST_PAGE_MAX_LIMIT;
+    }
+
+    if (!limit.empty())
+    {
+        errno = 0;
+        value = strtoull(limit.c_str(), &end, 10);
+        VerifyOrExit(limit[0] != '-' && *end == '\0' && errno != ERANGE && value > 0);
+        aLimit = (value < OTBR_REST_PAGE_MAX_LIMIT) ? static_cast<size_t>(value) : OTBR_REST_PAGE_MAX_LIMIT;
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+// Whether any of the entries has changed since a version, so that a client reading the changes by pages needs them.
+static bool HasChanges(const Ncp::TableVersions &aVersions, uint32_t aSince, const std::vector<size_t> &aIndices)
+{
+    Ncp::TableVersions::Changes changes;
+
+    aVersions.GetChanges(aSince, &aIndices, changes);
+
+    return !changes.mAdded.empty() || !changes.mUpdated.empty();
+}
+
+static bool ParseTlvType(const std::string &aString, uint8_t &aType)
+{
+    bool          ret = false;
+    char *        end;
+    unsigned long value = strtoul(aString.c_str(), &end, 10);
+
+    VerifyOrExit(!aString.empty() && *end == '\0');
+
+    for (uint8_t type : kAllTlvTypes)
+    {
+        if (type == value)
+        {
+            aType = type;
+            ExitNow(ret = true);
+        }
+    }
+
+exit:
+    return ret;
+}
 
-    // Resource Handler
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+Resource::Resource(ControllerOpenThread *aNcp)
+    : mInstance(nullptr)
+    , mNcp(aNcp)
+    , mResponseCache(OTBR_REST_RESPONSE_CACHE_ENTRIES, OTBR_REST_RESPONSE_CACHE_MAX_AGE)
+    , mMeshCounters()
+    , mDiagRefreshTimer(&Resource::HandleDiagRefreshTimer, this)
+    , mDiagQueried(false)
+    , mDiagCollectMask(0)
+    , mDiagCollectTimer(&Resource::HandleDiagCollectTimer, this)
+    , mDiagScheduler(OTBR_REST_DIAG_QUERY_WINDOW, OTBR_REST_DIAG_QUERY_ATTEMPTS, OTBR_REST_DIAG_QUERY_TIMEOUT)
+    , mDiagScheduleTimer(&Resource::HandleDiagScheduleTimer, this)
+    , mDiagScheduling(false)
+    , mDiagPolicy(OTBR_REST_DIAG_REFRESH_PERIOD * 1000,
+                  OTBR_REST_DIAG_REFRESH_MIN_PERIOD * 1000,
+                  OTBR_REST_DIAG_REFRESH_MAX_PERIOD * 1000,
+                  OTBR_REST_DIAG_QUERY_WINDOW,
+                  OTBR_REST_DIAG_AIRTIME_BUDGET)
+    , mDiagAirtime(0)
+    , mRequestLimiter(OTBR_REST_CLIENT_REQUEST_INTERVAL, OTBR_REST_CLIENT_REQUEST_BURST)
+    , mMeshQueryLimiter(OTBR_REST_CLIENT_MESH_QUERY_INTERVAL, OTBR_REST_CLIENT_MESH_QUERY_BURST)
+{
+    mDiagScheduler.SetAirtimeBudget(OTBR_REST_DIAG_AIRTIME_BUDGET);
+
+    // Resource handlers, versioned resources only change with the given state changes
+    AddRoute(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic, &Resource::HandleDiagnosticCallback);
+    AddRoute(OT_REST_RESOURCE_PATH_DIAGNOETIC_NODE, &Resource::NodeDiagnostic, &Resource::HandleNodeDiagnosticCallback);
+    AddRoute(OT_REST_RESOURCE_PATH_EVENTS, &Resource::Events);
+    AddRoute(OT_REST_RESOURCE_PATH_BATCH, &Resource::Batch);
+    AddRoute(OT_REST_RESOURCE_PATH_METRICS, &Resource::ServerMetrics);
+    AddRoute(OT_REST_RESOURCE_PATH_HEALTH, &Resource::ServerHealth);
+    AddRoute(OT_REST_RESOURCE_PATH_TOPOLOGY, &Resource::MeshTopology);
+    AddRoute(OT_REST_RESOURCE_PATH_MESH_COUNTERS, &Resource::MeshCountersResource);
+    AddRoute(OT_REST_RESOURCE_PATH_COMMISSIONING, &Resource::Commissioning);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State, nullptr, OT_CHANGED_THREAD_ROLE);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName, nullptr, OT_CHANGED_THREAD_NETWORK_NAME);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16, nullptr,
+             OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData, nullptr,
+             OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId, nullptr, OT_CHANGED_THREAD_EXT_PANID);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc, nullptr,
+             OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_NETWORKDATA, &Resource::NetworkData, nullptr,
+             OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_CHILDTABLE, &Resource::ChildTable);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_NEIGHBORTABLE, &Resource::NeighborTable);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_LINK_QUALITY, &Resource::LinkQuality);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_COUNTERS_HISTORY, &Resource::CountersHistory);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_CHANNEL_HISTORY, &Resource::ChannelHistory);
+
+    // Entity tags of a previous run must not match.
+    mETagNonce = static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count());
+}
 
-    // Resource callback handler
-    mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::HandleDiagnosticCallback);
+void Resource::AddRoute(const char *            aPath,
+                        ResourceHandler         aHandler,
+                        ResourceCallbackHandler aCallbackHandler,
+                        otChangedFlags          aVersionFlags)
+{
+    mRouter.Add(aPath, HttpMethod::kGet, static_cast<uint16_t>(mRoutes.size()));
+    mRoutes.push_back(Route{aPath, aHandler, aCallbackHandler, ResourceVersion{aVersionFlags, 0}});
 }
 
 void Resource::Init(void)
 {
+    // The NCP is initialized in parallel with the construction of the server.
+    mInstance = mNcp->GetThreadHelper()->GetInstance();
+
+    // The callbacks run on the mainloop, they hand their work over to the thread of the REST server.
     otThreadSetReceiveDiagnosticGetCallback(mInstance, &Resource::DiagnosticResponseHandler, this);
+    mNcp->On<Ncp::kEventNetworkName>(&Resource::HandleNetworkName, this);
+    mNcp->On<Ncp::kEventPartitionId>(&Resource::HandlePartitionId, this);
+    mNcp->GetThreadHelper()->AddDeviceRoleHandler(
+        [this](otDeviceRole aRole) { PostTask([this, aRole]() { HandleDeviceRole(aRole); }); });
+    mNcp->AddThreadStateChangedCallback(
+        [this](otChangedFlags aFlags) { PostTask([this, aFlags]() { HandleThreadStateChanged(aFlags); }); });
+    mNcp->RegisterResetHandler([this]() {
+        // The instance callbacks are lost with the reinitialized instance, those of the controller are kept.
+        mInstance = mNcp->GetInstance();
+        otThreadSetReceiveDiagnosticGetCallback(mInstance, &Resource::DiagnosticResponseHandler, this);
+        PostTask([this]() { HandleThreadStateChanged(~static_cast<otChangedFlags>(0)); });
+    });
+
+    PostTask([this]() {
+        RestoreDiagnostic();
+
+        if (kDiagRefreshPeriod > 0)
+        {
+            mDiagRefreshTimer.Start(microseconds(kDiagRefreshPeriod));
+        }
+    });
+}
+
+void Resource::PostTask(std::function<void(void)> aTask)
+{
+#if OTBR_ENABLE_RADIO_THREAD
+    mTasks.Post(std::move(aTask));
+#else
+    aTask();
+#endif
 }
 
 void Resource::Handle(Request &aRequest, Response &aResponse) const
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    uint16_t           routeId;
+    Router::Parameters parameters;
+    std::string        url    = aRequest.GetUrl();
+    HttpStatusCode     status = mRouter.Match(url, aRequest.GetMethod(), routeId, parameters);
+
+    otbrTrace(OTBR_TRACE_REST_REQUEST,
+              static_cast<uint32_t>(aRequest.GetMethod()) | (static_cast<uint32_t>(status) << 8), url.data(),
+              static_cast<uint16_t>(url.size() < UINT16_MAX ? url.size() : UINT16_MAX));
+
+    aResponse.SetContentFormat(aRequest.GetPreferredFormat());
+
+    // The health is probed often by watchdogs, each probe is cheap and is never limited.
+    VerifyOrExit((status == HttpStatusCode::kStatusOk && mRoutes[routeId].mHandler == &Resource::ServerHealth) ||
+                 Admit(mRequestLimiter, aRequest, aResponse));
+    VerifyOrExit(status == HttpStatusCode::kStatusOk, ErrorHandler(aResponse, status));
+
+    {
+        const Route &route = mRoutes[routeId];
+
+        aRequest.SetPathParameters(parameters);
+        aResponse.SetRoute(route.mPath);
+
+        if (route.mVersion.mFlags != 0)
+        {
+            std::string etag = GetETag(route.mVersion.mVersion, aResponse.GetContentFormat());
+
+            aResponse.SetETag(etag);
+
+            if (Utils::IsETagMatched(aRequest.GetHeaderValue("If-None-Match"), etag))
+            {
+                // The client has the latest body, skip generating it.
+                std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusNotModified);
+
+                aResponse.SetResponsCode(errorCode);
+                aResponse.SetNotModified();
+                ExitNow();
+            }
+        }
+
+        // Concurrent identical requests write from one serialized body.
+        if (!FindSharedResponse(routeId, aRequest, aResponse))
+        {
+            (this->*route.mHandler)(aRequest, aResponse);
+            ShareResponse(routeId, aRequest, aResponse);
+        }
+    }
+
+exit:
+    return;
+}
+
+bool Resource::Admit(RateLimiter &aLimiter, const Request &aRequest, Response &aResponse) const
+{
+    bool admitted = aLimiter.Allow(aRequest.GetClientAddress(), MainloopClock::Now());
+
+    if (!admitted)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusTooManyRequests);
+        aResponse.SetRetryAfter(aLimiter.GetRetryAfter());
+    }
+
+    return admitted;
+}
+
+std::string Resource::GetETag(uint32_t aVersion, ContentFormat aFormat) const
+{
+    char etag[sizeof("\"01234567-4294967295-c\"")];
+
+    // Each encoding is a distinct representation, with its own entity tag.
+    snprintf(etag, sizeof(etag), "\"%08x-%u%s\"", mETagNonce, aVersion,
+             aFormat == ContentFormat::kCbor ? "-c" : "");
+
+    return etag;
+}
+
+bool Resource::GetStateVersion(uint16_t aRouteId, uint32_t &aVersion) const
+{
+    const Route &route  = mRoutes[aRouteId];
+    bool         shared = true;
 
-    if (it != mResourceMap.end())
+    if (route.mVersion.mFlags != 0)
+    {
+        aVersion = route.mVersion.mVersion;
+    }
+    else if (route.mCallbackHandler != nullptr)
     {
-        ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        // The resources collecting diagnostics are serialized from the cached diagnostics.
+        aVersion = mDiagSet.GetVersion();
     }
     else
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
+        // The state of other resources is unknown, e.g. the tables of the node, they are never shared.
+        shared = false;
+    }
+
+    return shared;
+}
+
+bool Resource::FindSharedResponse(uint16_t aRouteId, const Request &aRequest, Response &aResponse) const
+{
+    bool                        found = false;
+    uint32_t                    version;
+    std::shared_ptr<SharedBody> body;
+    std::string                 errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet && GetStateVersion(aRouteId, version));
+
+    body = mResponseCache.Find(aRouteId, aRequest.GetTarget(), aResponse.GetContentFormat(), version,
+                               MainloopClock::Now());
+    VerifyOrExit(body != nullptr);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetSharedBody(std::move(body));
+    found = true;
+
+exit:
+    return found;
+}
+
+void Resource::ShareResponse(uint16_t aRouteId, const Request &aRequest, Response &aResponse) const
+{
+    uint32_t version;
+
+    // Only successful responses with a body and the usual headers are shared, e.g. not a page with a Next-Cursor.
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet && GetStateVersion(aRouteId, version));
+    VerifyOrExit(aResponse.IsComplete() || !aResponse.NeedCallback());
+    VerifyOrExit(aResponse.GetStatusCode() == 200 && !aResponse.IsStream() && aResponse.HasOnlyPredefinedHeaders());
+
+    mResponseCache.Insert(aRouteId, aRequest.GetTarget(), aResponse.GetContentFormat(), version, MainloopClock::Now(),
+                          aResponse.ShareBody());
+
+exit:
+    return;
+}
+
+void Resource::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    for (auto &route : mRoutes)
+    {
+        if (route.mVersion.mFlags & aFlags)
+        {
+            ++route.mVersion.mVersion;
+        }
     }
 }
 
 void Resource::HandleCallback(Request &aRequest, Response &aResponse)
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceCallbackMap.find(url);
+    uint16_t           routeId;
+    Router::Parameters parameters;
+
+    VerifyOrExit(mRouter.Match(aRequest.GetUrl(), aRequest.GetMethod(), routeId, parameters) ==
+                 HttpStatusCode::kStatusOk);
+    VerifyOrExit(mRoutes[routeId].mCallbackHandler != nullptr && IsDiagnosticCollected(aResponse.GetStartTime()));
+
+    DeleteOutDatedDiagnostic();
+    aResponse.SetComplete();
 
-    if (it != mResourceCallbackMap.end())
+    // The requests waiting for the same query are woken up together, the first one serializes the body.
+    if (!FindSharedResponse(routeId, aRequest, aResponse))
     {
-        ResourceCallbackHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        (this->*mRoutes[routeId].mCallbackHandler)(aRequest, aResponse);
+        ShareResponse(routeId, aRequest, aResponse);
     }
+
+exit:
+    return;
 }
 
 void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
 {
-    OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    DiagFilter filter;
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
-    {
-        DeleteOutDatedDiagnostic();
+    // The filter was validated when handling the request.
+    ParseDiagFilter(aRequest, filter);
+    GetDataDiagnostic(filter, aResponse);
+}
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
-        {
-            diagContentSet.push_back(it->second.mDiagContent);
-        }
+void Resource::HandleNodeDiagnosticCallback(const Request &aRequest, Response &aResponse)
+{
+    DiagFilter filter;
 
-        body      = Json::Diag2JsonString(diagContentSet);
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
-        aResponse.SetComplete();
+    if (!ParseNodeDiagFilter(aRequest, filter) || !GetDataNodeDiagnostic(filter, aResponse))
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
     }
 }
 
 void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
 {
     std::string errorMessage = GetHttpStatus(aErrorCode);
-    std::string body         = Json::Error2JsonString(aErrorCode, errorMessage);
+    std::string body;
+    JsonWriter  writer(body, aResponse.GetContentFormat());
 
+    Json::Error2Json(writer, aErrorCode, errorMessage);
+
+    // An error is not cacheable.
+    aResponse.SetETag(std::string());
     aResponse.SetResponsCode(errorMessage);
     aResponse.SetBody(body);
     aResponse.SetComplete();
 }
 
-void Resource::GetNodeInfo(Response &aResponse) const
+void Resource::StartingHandler(Response &aResponse) const
 {
-    otbrError       error = OTBR_ERROR_NONE;
-    struct NodeInfo node;
-    otRouterInfo    routerInfo;
-    uint8_t         maxRouterId;
-    std::string     body;
-    std::string     errorCode;
+    std::string status = GetHttpStatus(HttpStatusCode::kStatusServiceUnavailable);
+    std::string body;
+    JsonWriter  writer(body, aResponse.GetContentFormat());
 
-    VerifyOrExit(otThreadGetLeaderData(mInstance, &node.mLeaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    writer.BeginObject();
+    writer.Key("State");
+    writer.String("starting");
+    writer.EndObject();
 
-    node.mNumOfRouter = 0;
-    maxRouterId       = otThreadGetMaxRouterId(mInstance);
-    for (uint8_t i = 0; i <= maxRouterId; ++i)
-    {
-        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
-        {
-            continue;
-        }
-        ++node.mNumOfRouter;
-    }
+    aResponse.SetETag(std::string());
+    aResponse.SetResponsCode(status);
+    aResponse.SetRetryAfter(1);
+    aResponse.SetBody(body);
+    aResponse.SetComplete();
+}
+
+otbrError Resource::CollectNodeInfo(const NodeState &aState, struct NodeInfo &aNode) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aState.mLeaderDataValid, error = OTBR_ERROR_REST);
+
+    aNode.mLeaderData  = aState.mLeaderData;
+    aNode.mNumOfRouter = static_cast<uint32_t>(aState.mRouters.size());
+    aNode.mRole        = aState.mRole;
+    aNode.mExtAddress  = aState.mExtAddress.m8;
+    aNode.mNetworkName = aState.mNetworkName;
+    aNode.mRloc16      = aState.mRloc16;
+    aNode.mExtPanId    = aState.mExtPanId.m8;
+    aNode.mRlocAddress = aState.mRloc;
+
+exit:
+    return error;
+}
+
+void Resource::GetNodeInfo(Response &aResponse) const
+{
+    otbrError                        error = OTBR_ERROR_NONE;
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    struct NodeInfo                  node;
+    std::string                      body;
+    std::string                      errorCode;
+    JsonWriter                       writer(body, aResponse.GetContentFormat());
 
-    node.mRole        = otThreadGetDeviceRole(mInstance);
-    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    node.mNetworkName = otThreadGetNetworkName(mInstance);
-    node.mRloc16      = otThreadGetRloc16(mInstance);
-    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    node.mRlocAddress = *otThreadGetRloc(mInstance);
+    SuccessOrExit(error = CollectNodeInfo(*state, node));
 
-    body = Json::Node2JsonString(node);
+    Json::Node2Json(writer, node);
     aResponse.SetBody(body);
 
 exit:
@@ -250,10 +692,11 @@ void Resource::NodeInfo(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataExtendedAddr(Response &aResponse) const
 {
-    const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    std::string    errorCode;
-    std::string    body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    std::string                      errorCode;
+    std::string                      body;
 
+    JsonWriter(body, aResponse.GetContentFormat()).HexString(state->mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
@@ -284,8 +727,8 @@ void Resource::GetDataState(Response &aResponse) const
     // 3 : router
     // 4 : leader
 
-    role  = otThreadGetDeviceRole(mInstance);
-    state = Json::Number2JsonString(role);
+    role  = mNcp->GetNodeState()->mRole;
+    JsonWriter(state, aResponse.GetContentFormat()).Number(role);
     aResponse.SetBody(state);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
@@ -308,12 +751,16 @@ void Resource::State(const Request &aRequest, Response &aResponse) const
 void Resource::GetDataNetworkName(Response &aResponse) const
 {
     std::string networkName;
+    std::string body;
     std::string errorCode;
 
-    networkName = otThreadGetNetworkName(mInstance);
-    networkName = Json::String2JsonString(networkName);
+    networkName = mNcp->GetNodeState()->mNetworkName;
+    if (!networkName.empty())
+    {
+        JsonWriter(body, aResponse.GetContentFormat()).String(networkName);
+    }
 
-    aResponse.SetBody(networkName);
+    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -334,14 +781,15 @@ void Resource::NetworkName(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataLeaderData(Response &aResponse) const
 {
-    otbrError    error = OTBR_ERROR_NONE;
-    otLeaderData leaderData;
-    std::string  body;
-    std::string  errorCode;
+    otbrError                        error = OTBR_ERROR_NONE;
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    std::string                      body;
+    std::string                      errorCode;
+    JsonWriter                       writer(body, aResponse.GetContentFormat());
 
-    VerifyOrExit(otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    VerifyOrExit(state->mLeaderDataValid, error = OTBR_ERROR_REST);
 
-    body = Json::LeaderData2JsonString(leaderData);
+    Json::LeaderData2Json(writer, state->mLeaderData);
 
     aResponse.SetBody(body);
 
@@ -370,25 +818,53 @@ void Resource::LeaderData(const Request &aRequest, Response &aResponse) const
     }
 }
 
-void Resource::GetDataNumOfRoute(Response &aResponse) const
+void Resource::GetDataNetworkData(Response &aResponse) const
 {
-    uint8_t      count = 0;
-    uint8_t      maxRouterId;
-    otRouterInfo routerInfo;
-    maxRouterId = otThreadGetMaxRouterId(mInstance);
-    std::string body;
-    std::string errorCode;
+    otbrError                               error       = OTBR_ERROR_NONE;
+    std::shared_ptr<const Ncp::NetworkData> networkData = mNcp->GetNetworkData();
+    std::string                             body;
+    std::string                             errorCode;
+    JsonWriter                              writer(body, aResponse.GetContentFormat());
+
+    // There is no snapshot before the controller is initialized, and the versions are unknown while the node is
+    // detached. Both are transient, the client should retry later.
+    VerifyOrExit(networkData != nullptr && networkData->mVersionValid, error = OTBR_ERROR_REST);
 
-    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    Json::NetworkData2Json(writer, *networkData);
+
+    aResponse.SetBody(body);
+
+exit:
+    if (error == OTBR_ERROR_NONE)
     {
-        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
-        {
-            continue;
-        }
-        ++count;
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusServiceUnavailable);
+    }
+}
+
+void Resource::NetworkData(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataNetworkData(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
     }
+}
+
+void Resource::GetDataNumOfRoute(Response &aResponse) const
+{
+    uint8_t     count = static_cast<uint8_t>(mNcp->GetNodeState()->mRouters.size());
+    std::string body;
+    std::string errorCode;
 
-    body = Json::Number2JsonString(count);
+    JsonWriter(body, aResponse.GetContentFormat()).Number(count);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -411,11 +887,11 @@ void Resource::NumOfRoute(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataRloc16(Response &aResponse) const
 {
-    uint16_t    rloc16 = otThreadGetRloc16(mInstance);
+    uint16_t    rloc16 = mNcp->GetNodeState()->mRloc16;
     std::string body;
     std::string errorCode;
 
-    body = Json::Number2JsonString(rloc16);
+    JsonWriter(body, aResponse.GetContentFormat()).Number(rloc16);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -438,10 +914,11 @@ void Resource::Rloc16(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataExtendedPanId(Response &aResponse) const
 {
-    const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    std::string    body     = Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
-    std::string    errorCode;
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    std::string                      body;
+    std::string                      errorCode;
 
+    JsonWriter(body, aResponse.GetContentFormat()).HexString(state->mExtPanId.m8, OT_EXT_PAN_ID_SIZE);
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
@@ -463,11 +940,12 @@ void Resource::ExtendedPanId(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataRloc(Response &aResponse) const
 {
-    otIp6Address rlocAddress = *otThreadGetRloc(mInstance);
+    otIp6Address rlocAddress = mNcp->GetNodeState()->mRloc;
     std::string  body;
     std::string  errorCode;
+    JsonWriter   writer(body, aResponse.GetContentFormat());
 
-    body = Json::IpAddr2JsonString(rlocAddress);
+    Json::IpAddr2Json(writer, rlocAddress);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -488,63 +966,1345 @@ void Resource::Rloc(const Request &aRequest, Response &aResponse) const
     }
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+Resource::DiagFilter::DiagFilter(void)
+    : mTlvTypes(kAllTlvTypes, kAllTlvTypes + sizeof(kAllTlvTypes))
+    , mTlvMask(AllTlvMask())
+    , mCursor(0)
+    , mLimit(SIZE_MAX)
+{
+}
+
+bool Resource::DiagFilter::IsAll(void) const
+{
+    return mRloc16s.empty() && mTlvMask == AllTlvMask();
+}
+
+bool Resource::ParseDiagFilter(const Request &aRequest, DiagFilter &aFilter)
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
+    bool        ret   = true;
+    std::string tlvs  = aRequest.GetQueryParameter("tlvs");
+    std::string nodes = aRequest.GetQueryParameter("nodes");
+    size_t      start = 0;
+    uint64_t    cursor;
+
+    VerifyOrExit(ParsePage(aRequest, UINT16_MAX, cursor, aFilter.mLimit), ret = false);
+    aFilter.mCursor = static_cast<uint16_t>(cursor);
+
+    if (!tlvs.empty())
     {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+        uint8_t type;
 
-        if (duration >= kDiagResetTimeout)
+        // The RLOC16 is always queried, responses are cached by it.
+        aFilter.mTlvTypes.assign(1, OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+        aFilter.mTlvMask = TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+
+        while (start <= tlvs.size())
         {
-            eraseIt = mDiagSet.erase(eraseIt);
+            size_t end = tlvs.find(',', start);
+
+            if (end == std::string::npos)
+            {
+                end = tlvs.size();
+            }
+
+            VerifyOrExit(ParseTlvType(tlvs.substr(start, end - start), type), ret = false);
+            if ((aFilter.mTlvMask & TlvMask(type)) == 0)
+            {
+                aFilter.mTlvTypes.push_back(type);
+                aFilter.mTlvMask |= TlvMask(type);
+            }
+            start = end + 1;
         }
-        else
+    }
+
+    start = 0;
+    while (!nodes.empty() && start <= nodes.size())
+    {
+        size_t   end = nodes.find(',', start);
+        uint16_t rloc16;
+
+        if (end == std::string::npos)
         {
-            eraseIt++;
+            end = nodes.size();
         }
+
+        VerifyOrExit(ParseRloc16(nodes.substr(start, end - start), rloc16), ret = false);
+        aFilter.mRloc16s.push_back(rloc16);
+        start = end + 1;
     }
+
+exit:
+    return ret;
 }
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
+bool Resource::ParseNodeDiagFilter(const Request &aRequest, DiagFilter &aFilter)
 {
-    DiagInfo value;
+    bool     ret = false;
+    uint16_t rloc16;
+
+    VerifyOrExit(aRequest.GetQueryParameter("nodes").empty() && aRequest.GetQueryParameter("cursor").empty() &&
+                 aRequest.GetQueryParameter("limit").empty() && ParseDiagFilter(aRequest, aFilter));
+    VerifyOrExit(ParseRloc16(aRequest.GetPathParameter("rloc16"), rloc16));
+
+    aFilter.mRloc16s.push_back(rloc16);
+    ret = true;
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+exit:
+    return ret;
 }
 
-void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+void Resource::DeleteOutDatedDiagnostic(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
-    struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
-    struct otIp6Address multicastAddress;
+    steady_clock::time_point now     = MainloopClock::Now();
+    steady_clock::time_point expired = now - microseconds(GetDiagExpireTimeout());
+    bool                     changed = false;
+    bool                     erased;
+
+    for (const DiagInfo &info : mDiagSet)
+    {
+        if (info.mStartTime < expired)
+        {
+            changed = mTopology.Remove(info.mRloc16) || changed;
+        }
+    }
 
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes)) ==
-                     OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes)) ==
-                     OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
+    mDiagSet.EraseOlderThan(expired);
 
-exit:
+    // A node answering some queries still loses the TLVs it stopped answering, each after the timeout of its type.
+    erased = mDiagSet.EraseTlvsOlderThan(expired, ~StaticTlvMask());
+    erased = mDiagSet.EraseTlvsOlderThan(now - microseconds(GetDiagStaticExpireTimeout()), StaticTlvMask()) || erased;
 
-    if (error == OTBR_ERROR_NONE)
+    if (erased)
     {
-        aResponse.SetStartTime(steady_clock::now());
-        aResponse.SetCallback();
+        for (const DiagInfo &info : mDiagSet)
+        {
+            changed = mTopology.Update(info) || changed;
+        }
     }
-    else
+
+    PublishDiagStats();
+
+    if (changed)
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+        EmitTopologyChanged();
+    }
+}
+
+bool Resource::TrimDiagnostic(void)
+{
+    bool changed = false;
+
+    while (!mDiagSet.IsEmpty() && mDiagSet.GetMemoryUsage() > OTBR_REST_DIAG_CACHE_MAX_BYTES)
+    {
+        uint16_t rloc16 = mDiagSet.EraseOldest();
+
+        otbrLog(OTBR_LOG_INFO, "Evicted the diagnostics of node 0x%04x", rloc16);
+        changed = mTopology.Remove(rloc16) || changed;
+    }
+
+    PublishDiagStats();
+
+    return changed;
+}
+
+void Resource::PublishDiagStats(void)
+{
+    MemoryStats::Get().Update(MemoryStats::kSubsystemDiagCache, mDiagSet.GetMemoryUsage());
+
+    std::lock_guard<std::mutex> lock(mMeshCountersMutex);
+
+    mMeshCounters = mDiagSet.GetMeshCounters();
+}
+
+MeshCounters Resource::GetMeshCounters(void) const
+{
+    std::lock_guard<std::mutex> lock(mMeshCountersMutex);
+
+    return mMeshCounters;
+}
+
+void Resource::RestoreDiagnostic(void)
+{
+    std::vector<uint8_t> record;
+    size_t               restored;
+
+    // The state cache and its flush timer belong to the mainloop.
+    mNcp->RunCommand([&record]() {
+        const std::vector<uint8_t> *cached = StateCache::Get().Find(StateCache::kRecordDiagnostics);
+
+        if (cached != nullptr)
+        {
+            record = *cached;
+        }
+    });
+
+    VerifyOrExit(!record.empty());
+
+    // The restored diagnostics are served until the queries of the live network replace them or they expire.
+    restored = mDiagSet.Restore(record, MainloopClock::Now() - microseconds(GetDiagExpireTimeout()));
+
+    for (const DiagInfo &info : mDiagSet)
+    {
+        mTopology.Update(info);
+    }
+
+    TrimDiagnostic();
+    otbrLog(OTBR_LOG_INFO, "Restored the diagnostics of %zu nodes", restored);
+
+exit:
+    return;
+}
+
+void Resource::SaveDiagnostic(void) const
+{
+    std::vector<uint8_t> record;
+
+    mDiagSet.Save(record, StateCache::kMaxRecordLength);
+
+    // The state cache and its flush timer belong to the mainloop.
+    mNcp->RunCommand([&record]() { StateCache::Get().Update(StateCache::kRecordDiagnostics, std::move(record)); });
+}
+
+void Resource::UpdateDiag(uint16_t aRloc16, std::vector<uint8_t> &aTlvs, uint32_t aTlvMask)
+{
+    auto now = MainloopClock::Now();
+
+    // A response to a multicast query answers the TLVs of all queries sent while collecting.
+    if (aTlvMask == 0)
+    {
+        aTlvMask = (now < mDiagCollectEnd) ? mDiagCollectMask : TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+    }
+
+    uint32_t  changedTlvs;
+    DiagInfo &value = mDiagSet.Update(aRloc16, aTlvs, aTlvMask, now, &changedTlvs);
+    bool      changed;
+
+    mDiagPolicy.HandleResponse((changedTlvs & ~kDiagVolatileTlvMask) != 0);
+
+    if (!mEventListeners.empty())
+    {
+        std::string data;
+        JsonWriter  writer(data, false);
+
+        Json::DiagInfo2Json(writer, value, 0);
+        EmitEvent("diagnostic", data);
+    }
+
+    changed = mTopology.Update(value);
+
+    // The node just updated is the last one evicted, `value` is not used after trimming.
+    changed = TrimDiagnostic() || changed;
+
+    if (changed)
+    {
+        EmitTopologyChanged();
+    }
+}
+
+const DiagInfo *Resource::FindDiagnostic(uint16_t aRloc16, uint32_t aTlvMask) const
+{
+    const DiagInfo *info = mDiagSet.Find(aRloc16);
+
+    if (info != nullptr && !IsDiagnosticFresh(*info, aTlvMask))
+    {
+        info = nullptr;
+    }
+
+    return info;
+}
+
+uint64_t Resource::GetDiagExpireTimeout(void) const
+{
+    // A node is kept through missing two refreshes.
+    return std::max<uint64_t>(3ull * mDiagPolicy.GetPeriod() * 1000, kDiagResetTimeout);
+}
+
+uint64_t Resource::GetDiagStaticExpireTimeout(void) const
+{
+    // The TLVs which rarely change are kept through missing two queries of them.
+    return std::max<uint64_t>(3 * kDiagStaticRefreshPeriod, GetDiagExpireTimeout());
+}
+
+bool Resource::IsDiagnosticFresh(const DiagInfo &aInfo, uint32_t aTlvMask) const
+{
+    auto now   = MainloopClock::Now();
+    bool fresh = (aInfo.mTlvMask & aTlvMask) == aTlvMask;
+
+    // Each TLV type expires after the timeout of its type, since the latest response answering it.
+    for (uint8_t type : kAllTlvTypes)
+    {
+        if (fresh && (aTlvMask & TlvMask(type)) != 0)
+        {
+            uint64_t timeout =
+                (StaticTlvMask() & TlvMask(type)) ? GetDiagStaticExpireTimeout() : GetDiagExpireTimeout();
+
+            fresh = static_cast<uint64_t>(
+                        duration_cast<microseconds>(now - DiagStore::GetTlvTime(aInfo, type)).count()) < timeout;
+        }
+    }
+
+    return fresh;
+}
+
+uint32_t Resource::GetQueryTlvMask(uint16_t aRloc16, uint32_t aTlvMask) const
+{
+    const DiagInfo *info = mDiagSet.Find(aRloc16);
+    auto            now  = MainloopClock::Now();
+
+    VerifyOrExit(info != nullptr);
+
+    // The TLVs which rarely change are only queried again after their refresh period.
+    for (uint8_t type : kAllTlvTypes)
+    {
+        uint32_t mask = TlvMask(type);
+
+        if ((aTlvMask & StaticTlvMask() & info->mTlvMask & mask) != 0 &&
+            static_cast<uint64_t>(duration_cast<microseconds>(now - DiagStore::GetTlvTime(*info, type)).count()) <
+                kDiagStaticRefreshPeriod)
+        {
+            aTlvMask &= ~mask;
+        }
+    }
+
+exit:
+    return aTlvMask;
+}
+
+void Resource::ScheduleDiagQuery(const NodeState &aState, uint16_t aRloc16, uint32_t aTlvMask, bool aOnDemand) const
+{
+    uint32_t tlvMask = GetQueryTlvMask(aRloc16, aTlvMask);
+
+    // A node whose TLVs are all still fresh is not queried at all.
+    VerifyOrExit(tlvMask != 0);
+    mDiagScheduler.Add(aRloc16, tlvMask, EstimateDiagAirtime(aState, aRloc16), aOnDemand);
+
+exit:
+    return;
+}
+
+bool Resource::HasDiagnostic(const DiagFilter &aFilter) const
+{
+    bool ret = false;
+
+    if (aFilter.mRloc16s.empty())
+    {
+        for (const DiagInfo &info : mDiagSet)
+        {
+            if (IsDiagnosticFresh(info, aFilter.mTlvMask))
+            {
+                ExitNow(ret = true);
+            }
+        }
+    }
+    else
+    {
+        for (uint16_t rloc16 : aFilter.mRloc16s)
+        {
+            VerifyOrExit(FindDiagnostic(rloc16, aFilter.mTlvMask) != nullptr);
+        }
+
+        ret = true;
+    }
+
+exit:
+    return ret;
+}
+
+void Resource::GetDataDiagnostic(const DiagFilter &aFilter, Response &aResponse) const
+{
+    std::vector<std::pair<const DiagInfo *, uint64_t>> selected;
+    std::string                                         errorCode;
+    uint32_t                                            tlvMask = aFilter.mTlvMask;
+    auto                                                now     = MainloopClock::Now();
+
+    if (aFilter.mRloc16s.empty())
+    {
+        for (const DiagInfo &info : mDiagSet)
+        {
+            auto age = duration_cast<milliseconds>(now - info.mStartTime).count();
+
+            if (static_cast<uint64_t>(age) * 1000 < GetDiagExpireTimeout())
+            {
+                selected.emplace_back(&info, static_cast<uint64_t>(age));
+            }
+        }
+    }
+    else
+    {
+        for (uint16_t rloc16 : aFilter.mRloc16s)
+        {
+            const DiagInfo *info = FindDiagnostic(rloc16, TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS));
+
+            if (info != nullptr)
+            {
+                auto age = duration_cast<milliseconds>(now - info->mStartTime).count();
+
+                selected.emplace_back(info, static_cast<uint64_t>(age));
+            }
+        }
+    }
+
+    if (aFilter.mLimit != SIZE_MAX)
+    {
+        // Pages are keyed by RLOC16, a node joining or leaving between two pages does not shift the others.
+        selected.erase(std::remove_if(selected.begin(), selected.end(),
+                                      [&aFilter](const std::pair<const DiagInfo *, uint64_t> &aEntry) {
+                                          return aEntry.first->mRloc16 < aFilter.mCursor;
+                                      }),
+                       selected.end());
+        std::sort(selected.begin(), selected.end(),
+                  [](const std::pair<const DiagInfo *, uint64_t> &aLeft,
+                     const std::pair<const DiagInfo *, uint64_t> &aRight) {
+                      return aLeft.first->mRloc16 < aRight.first->mRloc16;
+                  });
+
+        if (selected.size() > aFilter.mLimit)
+        {
+            char next[sizeof("FFFF")];
+
+            snprintf(next, sizeof(next), "%04X", selected[aFilter.mLimit].first->mRloc16);
+            aResponse.SetNextCursor(next);
+            selected.resize(aFilter.mLimit);
+        }
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+
+    if (WorkerPool::Get().IsWorthPosting(selected.size()))
+    {
+        // The cache is only accessed on the mainloop, a worker thread serializes a copy of the selected entries.
+        auto snapshot = std::make_shared<std::vector<std::pair<DiagInfo, uint64_t>>>();
+
+        snapshot->reserve(selected.size());
+        for (const auto &entry : selected)
+        {
+            snapshot->emplace_back(*entry.first, entry.second);
+        }
+
+        aResponse.SetBodyRenderer([snapshot, tlvMask](JsonWriter &aWriter) {
+            aWriter.BeginArray();
+            for (const auto &entry : *snapshot)
+            {
+                Json::DiagInfo2Json(aWriter, entry.first, entry.second, tlvMask);
+            }
+            aWriter.EndArray();
+        });
+    }
+    else
+    {
+        std::string body;
+        JsonWriter  writer(body, aResponse.GetContentFormat());
+
+        // Serialize the cached TLVs in place, without copying them into a temporary set.
+        writer.BeginArray();
+        for (const auto &entry : selected)
+        {
+            Json::DiagInfo2Json(writer, *entry.first, entry.second, tlvMask);
+        }
+        writer.EndArray();
+
+        aResponse.SetBody(body);
+    }
+}
+
+bool Resource::GetDataNodeDiagnostic(const DiagFilter &aFilter, Response &aResponse) const
+{
+    bool            found = false;
+    std::string     body;
+    std::string     errorCode;
+    JsonWriter      writer(body, aResponse.GetContentFormat());
+    const DiagInfo *info = FindDiagnostic(aFilter.mRloc16s[0], TlvMask(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS));
+    int64_t         age;
+
+    VerifyOrExit(info != nullptr);
+
+    age = duration_cast<milliseconds>(MainloopClock::Now() - info->mStartTime).count();
+    Json::DiagInfo2Json(writer, *info, static_cast<uint64_t>(age), aFilter.mTlvMask);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+    found = true;
+
+exit:
+    return found;
+}
+
+bool Resource::IsDiagnosticCollecting(void) const
+{
+    return mDiagQueried &&
+           (mDiagScheduling ||
+            duration_cast<microseconds>(MainloopClock::Now() - mDiagQueryTime).count() < kDiagCollectTimeout);
+}
+
+bool Resource::IsDiagnosticCollected(steady_clock::time_point aStartTime) const
+{
+    auto duration = duration_cast<microseconds>(MainloopClock::Now() - aStartTime).count();
+
+    // Responses are still expected while unicast queries are sent, unless they take too long.
+    return duration >= kDiagCollectTimeout && (!mDiagScheduler.IsBusy() || duration >= kDiagCollectMaxTimeout);
+}
+
+otbrError Resource::RequestDiagnostic(const DiagFilter &        aFilter,
+                                      bool                      aOnDemand,
+                                      steady_clock::time_point &aQueryTime) const
+{
+    otbrError                        error = OTBR_ERROR_NONE;
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    auto                             now   = MainloopClock::Now();
+
+    // Coalesce with the query of all diagnostics still collecting responses, which answers any filter.
+    aQueryTime = mDiagQueryTime;
+    VerifyOrExit(!IsDiagnosticCollecting());
+
+    if (!aFilter.mRloc16s.empty())
+    {
+        // Only query the target nodes, at their RLOC addresses.
+        for (uint16_t rloc16 : aFilter.mRloc16s)
+        {
+            ScheduleDiagQuery(*state, rloc16, aFilter.mTlvMask, aOnDemand);
+        }
+    }
+    else if (!state->mRouters.empty())
+    {
+        // Query the routers of the router table in turn, rather than all at once by multicast, so that their
+        // responses do not arrive in a burst the buffers cannot hold.
+        ScheduleDiagQuery(*state, state->mRloc16, aFilter.mTlvMask, aOnDemand);
+        for (const otRouterInfo &router : state->mRouters)
+        {
+            ScheduleDiagQuery(*state, router.mRloc16, aFilter.mTlvMask, aOnDemand);
+        }
+
+        mDiagScheduling = mDiagScheduling || aFilter.IsAll();
+    }
+    else
+    {
+        // The router table is unknown, e.g. while being a child, fall back to querying the routers by multicast.
+        struct otIp6Address multicastAddress;
+        bool                sent  = false;
+        uint8_t             count = static_cast<uint8_t>(aFilter.mTlvTypes.size());
+
+        VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+        mNcp->RunCommand([this, &aFilter, &multicastAddress, count, &sent]() {
+            struct otIp6Address address = *otThreadGetRloc(mInstance);
+
+            sent = otThreadSendDiagnosticGet(mInstance, &address, aFilter.mTlvTypes.data(), count) == OT_ERROR_NONE &&
+                   otThreadSendDiagnosticGet(mInstance, &multicastAddress, aFilter.mTlvTypes.data(), count) ==
+                       OT_ERROR_NONE;
+        });
+        VerifyOrExit(sent, error = OTBR_ERROR_REST);
+    }
+
+    aQueryTime = now;
+
+    if (aFilter.IsAll())
+    {
+        mDiagQueryTime = now;
+        mDiagQueried   = true;
+    }
+
+    // Responses received until the end of collecting answer the TLVs of all queries sent meanwhile.
+    mDiagCollectMask = (now < mDiagCollectEnd ? mDiagCollectMask : 0) | aFilter.mTlvMask;
+    mDiagCollectEnd  = std::max(mDiagCollectEnd, now + microseconds(kDiagCollectTimeout));
+
+    if (!mDiagCollectTimer.IsRunning())
+    {
+        mDiagCollectTimer.StartAt(mDiagCollectEnd);
+    }
+
+    ProcessDiagSchedule();
+
+exit:
+    return error;
+}
+
+uint32_t Resource::EstimateDiagAirtime(const NodeState &aState, uint16_t aRloc16) const
+{
+    const DiagInfo *info  = mDiagSet.Find(aRloc16);
+    size_t          bytes = (info != nullptr) ? info->mDiagContent.size() : 0;
+    uint32_t        hops  = 1;
+    uint32_t        frames;
+
+    // The query takes a frame, its response at least one.
+    frames = 1 + static_cast<uint32_t>(std::max<size_t>(1, (bytes + kDiagFramePayload - 1) / kDiagFramePayload));
+
+    // The query of this node is answered locally.
+    VerifyOrExit(aRloc16 != aState.mRloc16, frames = 0);
+
+    // The route cost to the router of the node approximates the number of hops, a child is one hop further.
+    for (const otRouterInfo &router : aState.mRouters)
+    {
+        if (router.mRouterId == (aRloc16 >> 10) && router.mPathCost > 0 && router.mPathCost < 16)
+        {
+            hops = router.mPathCost;
+        }
+    }
+
+    if ((aRloc16 & 0x1ff) != 0)
+    {
+        hops++;
+    }
+
+exit:
+    return frames * hops * kDiagFrameAirtime;
+}
+
+void Resource::ProcessDiagSchedule(void) const
+{
+    uint32_t givenUp =
+        mDiagScheduler.Process(MainloopClock::Now(), &Resource::SendDiagnosticQuery, const_cast<Resource *>(this));
+
+    if (givenUp > 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "%u nodes did not respond to diagnostic queries", givenUp);
+        mDiagPolicy.HandleGivenUp(givenUp);
+    }
+
+    if (mDiagScheduler.IsBusy())
+    {
+        mDiagScheduleTimer.StartAt(mDiagScheduler.GetNextTime());
+    }
+    else
+    {
+        mDiagScheduleTimer.Stop();
+        mDiagScheduling = false;
+    }
+}
+
+bool Resource::SendDiagnosticQuery(uint16_t aRloc16, uint32_t aTlvMask, void *aContext)
+{
+    return static_cast<const Resource *>(aContext)->SendDiagnosticQuery(aRloc16, aTlvMask);
+}
+
+bool Resource::SendDiagnosticQuery(uint16_t aRloc16, uint32_t aTlvMask) const
+{
+    std::vector<uint8_t> types;
+    bool                 sent;
+
+    for (uint8_t type : kAllTlvTypes)
+    {
+        if (aTlvMask & TlvMask(type))
+        {
+            types.push_back(type);
+        }
+    }
+
+    mNcp->RunCommand([this, aRloc16, &types, &sent]() {
+        struct otIp6Address address = *otThreadGetRloc(mInstance);
+
+        address.mFields.m8[14] = static_cast<uint8_t>(aRloc16 >> 8);
+        address.mFields.m8[15] = static_cast<uint8_t>(aRloc16 & 0xff);
+
+        sent = (otThreadSendDiagnosticGet(mInstance, &address, types.data(), static_cast<uint8_t>(types.size())) ==
+                OT_ERROR_NONE);
+    });
+
+    if (sent)
+    {
+        // Responses are collected until a while after the latest query is sent.
+        mDiagCollectEnd = std::max(mDiagCollectEnd, MainloopClock::Now() + microseconds(kDiagCollectTimeout));
+    }
+
+    return sent;
+}
+
+void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode           status = HttpStatusCode::kStatusOk;
+    DiagFilter               filter;
+    steady_clock::time_point queryTime;
+
+    VerifyOrExit(ParseDiagFilter(aRequest, filter), status = HttpStatusCode::kStatusBadRequest);
+
+    if (HasDiagnostic(filter))
+    {
+        // Serve from the cache, which is refreshed in background.
+        GetDataDiagnostic(filter, aResponse);
+        ExitNow();
+    }
+
+    // Only requests sending queries to the Thread network take a token of the client, not the coalesced ones.
+    VerifyOrExit(IsDiagnosticCollecting() || Admit(mMeshQueryLimiter, aRequest, aResponse));
+    VerifyOrExit(RequestDiagnostic(filter, /* aOnDemand */ true, queryTime) == OTBR_ERROR_NONE,
+                 status = HttpStatusCode::kStatusInternalServerError);
+
+    // Respond when the query is done collecting.
+    aResponse.SetStartTime(queryTime);
+    aResponse.SetCallback();
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::NodeDiagnostic(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode           status = HttpStatusCode::kStatusOk;
+    DiagFilter               filter;
+    steady_clock::time_point queryTime;
+
+    VerifyOrExit(ParseNodeDiagFilter(aRequest, filter), status = HttpStatusCode::kStatusBadRequest);
+
+    if (HasDiagnostic(filter))
+    {
+        GetDataNodeDiagnostic(filter, aResponse);
+        ExitNow();
+    }
+
+    // Only requests sending queries to the Thread network take a token of the client, not the coalesced ones.
+    VerifyOrExit(IsDiagnosticCollecting() || Admit(mMeshQueryLimiter, aRequest, aResponse));
+    VerifyOrExit(RequestDiagnostic(filter, /* aOnDemand */ true, queryTime) == OTBR_ERROR_NONE,
+                 status = HttpStatusCode::kStatusInternalServerError);
+
+    // Respond when the query is done collecting.
+    aResponse.SetStartTime(queryTime);
+    aResponse.SetCallback();
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::HandleDiagRefreshTimer(Timer &aTimer, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+
+    static_cast<Resource *>(aContext)->HandleDiagRefreshTimer();
+}
+
+void Resource::HandleDiagCollectTimer(Timer &aTimer, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+
+    static_cast<Resource *>(aContext)->HandleDiagCollectTimer();
+}
+
+void Resource::HandleDiagScheduleTimer(Timer &aTimer, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+
+    static_cast<Resource *>(aContext)->ProcessDiagSchedule();
+}
+
+void Resource::HandleDiagCollectTimer(void)
+{
+    // Responses to the diagnostic queries are collected, wake up the requests waiting for them.
+    NotifyCallbackWaiters();
+
+    // Wait again for the queries sent since the timer was started.
+    if (mDiagCollectEnd > MainloopClock::Now())
+    {
+        mDiagCollectTimer.StartAt(mDiagCollectEnd);
+    }
+    else
+    {
+        // The diagnostics are saved once per collection rather than per response.
+        SaveDiagnostic();
+    }
+}
+
+void Resource::HandleDiagRefreshTimer(void)
+{
+    otbrError                error;
+    steady_clock::time_point queryTime;
+    uint32_t                 period = mDiagPolicy.GetPeriod();
+    uint8_t                  window = mDiagPolicy.GetWindow();
+
+    // The period and the window adapt to the responses and the airtime of the queries since the latest refresh.
+    mDiagPolicy.Update(static_cast<uint16_t>(mNcp->GetNodeState()->mRouters.size()),
+                       mDiagScheduler.GetAirtime() - mDiagAirtime);
+    mDiagAirtime = mDiagScheduler.GetAirtime();
+    mDiagScheduler.SetWindow(mDiagPolicy.GetWindow());
+
+    if (period != mDiagPolicy.GetPeriod() || window != mDiagPolicy.GetWindow())
+    {
+        otbrLog(OTBR_LOG_INFO, "Diagnostics refreshed every %u ms, %u queries at once", mDiagPolicy.GetPeriod(),
+                mDiagPolicy.GetWindow());
+    }
+
+    DeleteOutDatedDiagnostic();
+
+    if ((error = RequestDiagnostic(DiagFilter(), /* aOnDemand */ false, queryTime)) != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to refresh diagnostics: %s", otbrErrorString(error));
+    }
+
+    mDiagRefreshTimer.Start(milliseconds(mDiagPolicy.GetPeriod()));
+}
+
+const DiagStore &Resource::GetDiagnostics(void)
+{
+    otbrError                error;
+    DiagFilter               filter;
+    steady_clock::time_point queryTime;
+
+    DeleteOutDatedDiagnostic();
+
+    // The refresh timer keeps the cache fresh, only query when refreshing is disabled or a refresh was missed.
+    VerifyOrExit(!HasDiagnostic(filter) && !IsDiagnosticCollecting());
+
+    if ((error = RequestDiagnostic(filter, /* aOnDemand */ true, queryTime)) != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to query diagnostics: %s", otbrErrorString(error));
+    }
+
+exit:
+    return mDiagSet;
+}
+
+bool Resource::WriteBatchItem(JsonWriter &aWriter, const std::string &aPath, const struct NodeInfo &aNode) const
+{
+    bool found = true;
+
+    if (aPath == OT_REST_RESOURCE_PATH_NODE)
+    {
+        aWriter.Key(OT_REST_RESOURCE_PATH_NODE);
+        Json::Node2Json(aWriter, aNode);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_STATE)
+    {
+        aWriter.Member(OT_REST_RESOURCE_PATH_NODE_STATE, aNode.mRole);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_EXTADDRESS)
+    {
+        aWriter.Key(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS);
+        aWriter.HexString(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_NETWORKNAME)
+    {
+        aWriter.Key(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME);
+        aWriter.String(aNode.mNetworkName);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_RLOC16)
+    {
+        aWriter.Member(OT_REST_RESOURCE_PATH_NODE_RLOC16, aNode.mRloc16);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_LEADERDATA)
+    {
+        aWriter.Key(OT_REST_RESOURCE_PATH_NODE_LEADERDATA);
+        Json::LeaderData2Json(aWriter, aNode.mLeaderData);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER)
+    {
+        aWriter.Member(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, aNode.mNumOfRouter);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_EXTPANID)
+    {
+        aWriter.Key(OT_REST_RESOURCE_PATH_NODE_EXTPANID);
+        aWriter.HexString(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    }
+    else if (aPath == OT_REST_RESOURCE_PATH_NODE_RLOC)
+    {
+        aWriter.Key(OT_REST_RESOURCE_PATH_NODE_RLOC);
+        Json::IpAddr2Json(aWriter, aNode.mRlocAddress);
+    }
+    else
+    {
+        found = false;
+    }
+
+    return found;
+}
+
+void Resource::MeshTopology(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode status  = HttpStatusCode::kStatusOk;
+    std::string    since   = aRequest.GetQueryParameter("since");
+    uint32_t       version = 0;
+    std::string    body;
+    std::string    errorCode;
+    JsonWriter     writer(body, aResponse.GetContentFormat());
+
+    VerifyOrExit(since.empty() || ParseVersion(since, version), status = HttpStatusCode::kStatusBadRequest);
+
+    // The topology is derived from the cached diagnostics, which are refreshed in background.
+    Json::Topology2Json(writer, mTopology, version);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::MeshCountersResource(const Request &aRequest, Response &aResponse) const
+{
+    std::string body;
+    std::string errorCode;
+    JsonWriter  writer(body, aResponse.GetContentFormat());
+
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    // The sums are kept as the cached diagnostics change, which are refreshed in background.
+    Json::MeshCounters2Json(writer, mDiagSet.GetMeshCounters());
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+}
+
+void Resource::GetDataCommissioning(Response &aResponse) const
+{
+    std::shared_ptr<const agent::CommissioningOrchestrator::Progress> progress =
+        mNcp->GetThreadHelper()->GetCommissioningOrchestrator().GetProgress();
+    std::string body;
+    std::string errorCode;
+    JsonWriter  writer(body, aResponse.GetContentFormat());
+
+    Json::Commissioning2Json(writer, *progress, Timer::Clock::now());
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+}
+
+void Resource::Commissioning(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataCommissioning(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::ChildTable(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode                   status  = HttpStatusCode::kStatusOk;
+    std::shared_ptr<const NodeState> state   = mNcp->GetNodeState();
+    std::string                      since   = aRequest.GetQueryParameter("since");
+    uint32_t                         version = 0;
+    uint64_t                         cursor;
+    size_t                           limit;
+    std::vector<size_t>              page;
+    std::string                      body;
+    std::string                      errorCode;
+    JsonWriter                       writer(body, aResponse.GetContentFormat());
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet, status = HttpStatusCode::kStatusMethodNotAllowed);
+    VerifyOrExit(since.empty() || ParseVersion(since, version), status = HttpStatusCode::kStatusBadRequest);
+    VerifyOrExit(ParsePage(aRequest, UINT64_MAX, cursor, limit), status = HttpStatusCode::kStatusBadRequest);
+
+    if (limit != SIZE_MAX)
+    {
+        uint64_t            next = state->GetChildPage(cursor, limit, page);
+        std::vector<size_t> rest;
+
+        // With `since`, no more page is needed when the remaining entries are unchanged.
+        if (next != 0 && version != 0)
+        {
+            state->GetChildPage(next, SIZE_MAX, rest);
+            next = HasChanges(state->mChildVersions, version, rest) ? next : 0;
+        }
+
+        if (next != 0)
+        {
+            char nextCursor[sizeof("0123456789ABCDEF")];
+
+            snprintf(nextCursor, sizeof(nextCursor), "%016llX", static_cast<unsigned long long>(next));
+            aResponse.SetNextCursor(nextCursor);
+        }
+    }
+
+    Json::ChildTable2Json(writer, *state, version, limit != SIZE_MAX ? &page : nullptr);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::NeighborTable(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode                   status  = HttpStatusCode::kStatusOk;
+    std::shared_ptr<const NodeState> state   = mNcp->GetNodeState();
+    std::string                      since   = aRequest.GetQueryParameter("since");
+    uint32_t                         version = 0;
+    uint64_t                         cursor;
+    size_t                           limit;
+    std::vector<size_t>              page;
+    std::string                      body;
+    std::string                      errorCode;
+    JsonWriter                       writer(body, aResponse.GetContentFormat());
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet, status = HttpStatusCode::kStatusMethodNotAllowed);
+    VerifyOrExit(since.empty() || ParseVersion(since, version), status = HttpStatusCode::kStatusBadRequest);
+    VerifyOrExit(ParsePage(aRequest, UINT64_MAX, cursor, limit), status = HttpStatusCode::kStatusBadRequest);
+
+    if (limit != SIZE_MAX)
+    {
+        uint64_t            next = state->GetNeighborPage(cursor, limit, page);
+        std::vector<size_t> rest;
+
+        // With `since`, no more page is needed when the remaining entries are unchanged.
+        if (next != 0 && version != 0)
+        {
+            state->GetNeighborPage(next, SIZE_MAX, rest);
+            next = HasChanges(state->mNeighborVersions, version, rest) ? next : 0;
+        }
+
+        if (next != 0)
+        {
+            char nextCursor[sizeof("0123456789ABCDEF")];
+
+            snprintf(nextCursor, sizeof(nextCursor), "%016llX", static_cast<unsigned long long>(next));
+            aResponse.SetNextCursor(nextCursor);
+        }
+    }
+
+    Json::NeighborTable2Json(writer, *state, version, limit != SIZE_MAX ? &page : nullptr);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::LinkQuality(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode                              status = HttpStatusCode::kStatusOk;
+    std::vector<Ncp::LinkQualityTracker::Stats> stats;
+    std::string                                 body;
+    std::string                                 errorCode;
+    JsonWriter                                  writer(body, aResponse.GetContentFormat());
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet, status = HttpStatusCode::kStatusMethodNotAllowed);
+
+    mNcp->GetLinkQualityTracker().Get(stats);
+    Json::LinkQuality2Json(writer, stats);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+template <typename HistoryType>
+void Resource::HistoryHandler(const HistoryType &aHistory,
+                              void (*aHistory2Json)(JsonWriter &,
+                                                    uint32_t,
+                                                    const std::vector<typename HistoryType::Entry> &),
+                              const Request &aRequest,
+                              Response &     aResponse) const
+{
+    HttpStatusCode                           status     = HttpStatusCode::kStatusOk;
+    uint8_t                                  resolution = 0;
+    std::string                              since      = aRequest.GetQueryParameter("since");
+    std::string                              until      = aRequest.GetQueryParameter("until");
+    uint64_t                                 sinceTime  = 0;
+    uint64_t                                 untilTime  = UINT64_MAX;
+    std::vector<typename HistoryType::Entry> entries;
+    std::string                              body;
+    std::string                              errorCode;
+    JsonWriter                               writer(body, aResponse.GetContentFormat());
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet, status = HttpStatusCode::kStatusMethodNotAllowed);
+    VerifyOrExit(aHistory.ParseResolution(aRequest.GetQueryParameter("resolution"), resolution),
+                 status = HttpStatusCode::kStatusBadRequest);
+    VerifyOrExit(since.empty() || ParseTime(since, sinceTime), status = HttpStatusCode::kStatusBadRequest);
+    VerifyOrExit(until.empty() || ParseTime(until, untilTime), status = HttpStatusCode::kStatusBadRequest);
+
+    aHistory.Query(resolution, sinceTime, untilTime, entries);
+    aHistory2Json(writer, aHistory.GetPeriod(resolution), entries);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::CountersHistory(const Request &aRequest, Response &aResponse) const
+{
+    HistoryHandler(mNcp->GetCountersHistory(), Json::CountersHistory2Json, aRequest, aResponse);
+}
+
+void Resource::ChannelHistory(const Request &aRequest, Response &aResponse) const
+{
+    HistoryHandler(mNcp->GetChannelHistory(), Json::ChannelHistory2Json, aRequest, aResponse);
+}
+
+void Resource::ServerHealth(const Request &aRequest, Response &aResponse) const
+{
+    Health::Status health;
+    std::string    body;
+    JsonWriter     writer(body, aResponse.GetContentFormat());
+    std::string    errorCode;
+
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    // Only the state recorded by the mainloop and the subsystems is read, the NCP is never called.
+    Health::Get().GetStatus(health);
+
+    writer.BeginObject();
+    writer.Key("Live");
+    writer.Bool(health.mLive);
+    writer.Key("Ready");
+    writer.Bool(health.mAllReady);
+    writer.Member("HeartbeatAge", health.mHeartbeatAge);
+    if (health.mRadioActivityAge != UINT32_MAX)
+    {
+        writer.Member("RadioActivityAge", health.mRadioActivityAge);
+    }
+    writer.Key("Subsystems");
+    writer.BeginObject();
+    for (uint8_t index = 0; index < Health::kNumSubsystems; index++)
+    {
+        if (health.mReported & (1U << index))
+        {
+            writer.Key(Health::GetName(static_cast<Health::Subsystem>(index)));
+            writer.Bool(health.mReady & (1U << index));
+        }
+    }
+    writer.EndObject();
+    writer.EndObject();
+
+    errorCode = GetHttpStatus(health.mAllReady ? HttpStatusCode::kStatusOk : HttpStatusCode::kStatusServiceUnavailable);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+}
+
+void Resource::ServerMetrics(const Request &aRequest, Response &aResponse) const
+{
+    std::string body;
+    std::string errorCode;
+    uint64_t    cacheHits = mResponseCache.GetHits();
+
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    // The counters of the radio link are updated on the mainloop, the caller waits meanwhile.
+    mNcp->RunCommand([this, &body, cacheHits]() {
+        Ncp::RadioLinkCounters::Get().Update(mInstance);
+        Metrics::Get().Write(body, cacheHits);
+    });
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetContentType("text/plain; version=0.0.4");
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+}
+
+void Resource::Batch(const Request &aRequest, Response &aResponse) const
+{
+    HttpStatusCode                   status = HttpStatusCode::kStatusOk;
+    std::shared_ptr<const NodeState> state  = mNcp->GetNodeState();
+    struct NodeInfo                  node;
+    std::string                      paths = aRequest.GetQueryParameter("paths");
+    std::string                      body;
+    std::string                      errorCode;
+    JsonWriter                       writer(body, aResponse.GetContentFormat());
+    size_t                           start = 0;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet, status = HttpStatusCode::kStatusMethodNotAllowed);
+    VerifyOrExit(!paths.empty(), status = HttpStatusCode::kStatusBadRequest);
+
+    // Read one snapshot, so that all results are consistent with each other.
+    VerifyOrExit(CollectNodeInfo(*state, node) == OTBR_ERROR_NONE, status = HttpStatusCode::kStatusInternalServerError);
+
+    writer.BeginObject();
+    while (start <= paths.size())
+    {
+        size_t end = paths.find(',', start);
+
+        if (end == std::string::npos)
+        {
+            end = paths.size();
+        }
+
+        VerifyOrExit(WriteBatchItem(writer, paths.substr(start, end - start), node),
+                     status = HttpStatusCode::kStatusBadRequest);
+        start = end + 1;
+    }
+    writer.EndObject();
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (status != HttpStatusCode::kStatusOk)
+    {
+        ErrorHandler(aResponse, status);
+    }
+}
+
+void Resource::Events(const Request &aRequest, Response &aResponse) const
+{
+    std::shared_ptr<const NodeState> state = mNcp->GetNodeState();
+    std::string                      body;
+    std::string                      data;
+    std::string                      errorCode;
+    JsonWriter                       writer(data, false);
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    // Start the stream with a snapshot of the state, later events are incremental updates.
+    writer.BeginObject();
+    writer.Member("State", state->mRole);
+    writer.Key("NetworkName");
+    writer.String(state->mNetworkName);
+    writer.Member("PartitionId", state->mPartitionId);
+    writer.EndObject();
+
+    body = "event: state\ndata: " + data + "\n\n";
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetStream();
+    aResponse.SetBody(body);
+
+exit:
+    return;
+}
+
+void Resource::AddEventListener(EventHandler aHandler, void *aContext)
+{
+    mEventListeners.emplace_back(aHandler, aContext);
+}
+
+void Resource::RemoveEventListener(EventHandler aHandler, void *aContext)
+{
+    mEventListeners.remove(std::make_pair(aHandler, aContext));
+}
+
+void Resource::AddCallbackWaiter(CallbackReadyHandler aHandler, void *aContext)
+{
+    mCallbackWaiters.emplace_back(aHandler, aContext);
+}
+
+void Resource::RemoveCallbackWaiter(CallbackReadyHandler aHandler, void *aContext)
+{
+    mCallbackWaiters.remove(std::make_pair(aHandler, aContext));
+}
+
+void Resource::NotifyCallbackWaiters(void)
+{
+    // Copy the waiters, as a waiter unsubscribes once its response is ready.
+    std::list<std::pair<CallbackReadyHandler, void *>> waiters = mCallbackWaiters;
+
+    for (const auto &waiter : waiters)
+    {
+        waiter.first(waiter.second);
+    }
+}
+
+void Resource::EmitEvent(const char *aEvent, const std::string &aData)
+{
+    std::string event = std::string("event: ") + aEvent + "\ndata: " + aData + "\n\n";
+
+    // Copy the listeners, as a listener may unsubscribe while handling the event.
+    std::list<std::pair<EventHandler, void *>> listeners = mEventListeners;
+
+    for (const auto &listener : listeners)
+    {
+        listener.first(listener.second, event);
     }
 }
 
+void Resource::EmitTopologyChanged(void)
+{
+    std::string data;
+    JsonWriter  writer(data, false);
+
+    VerifyOrExit(!mEventListeners.empty());
+
+    // Subscribers fetch the changes with the version they know.
+    writer.Number(mTopology.GetVersion());
+    EmitEvent("topology", data);
+
+exit:
+    return;
+}
+
+void Resource::HandleNetworkName(void *aContext, const char *aNetworkName)
+{
+    Resource *  resource    = static_cast<Resource *>(aContext);
+    std::string networkName = aNetworkName;
+
+    resource->PostTask([resource, networkName]() { resource->HandleNetworkName(networkName.c_str()); });
+}
+
+void Resource::HandleNetworkName(const char *aNetworkName)
+{
+    std::string data;
+    JsonWriter  writer(data, false);
+
+    VerifyOrExit(!mEventListeners.empty());
+
+    writer.String(aNetworkName);
+    EmitEvent("network-name", data);
+
+exit:
+    return;
+}
+
+void Resource::HandlePartitionId(void *aContext, uint32_t aPartitionId)
+{
+    Resource *resource = static_cast<Resource *>(aContext);
+
+    resource->PostTask([resource, aPartitionId]() { resource->HandlePartitionId(aPartitionId); });
+}
+
+void Resource::HandlePartitionId(uint32_t aPartitionId)
+{
+    std::string data;
+    JsonWriter  writer(data, false);
+
+    VerifyOrExit(!mEventListeners.empty());
+
+    writer.Number(aPartitionId);
+    EmitEvent("partition-id", data);
+
+exit:
+    return;
+}
+
+void Resource::HandleDeviceRole(otDeviceRole aRole)
+{
+    std::string data;
+    JsonWriter  writer(data, false);
+
+    VerifyOrExit(!mEventListeners.empty());
+
+    writer.Number(aRole);
+    EmitEvent("state", data);
+
+exit:
+    return;
+}
+
 void Resource::DiagnosticResponseHandler(otError              aError,
                                          otMessage *          aMessage,
                                          const otMessageInfo *aMessageInfo,
@@ -555,27 +2315,27 @@ void Resource::DiagnosticResponseHandler(otError              aError,
 
 void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
-    std::vector<otNetworkDiagTlv> diagSet;
-    otNetworkDiagTlv              diagTlv;
-    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
+    std::vector<uint8_t>  tlvs;
+    otNetworkDiagTlv      diagTlv;
+    otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
+    otError               error;
+    uint16_t              rloc16 = kUnknownRloc16;
 
     SuccessOrExit(aError);
 
     (void)aMessageInfo;
 
+    // Pack each TLV as it is parsed, only the used part of a TLV is copied.
     while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
     {
         if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
         {
-            sprintf(rloc, "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
+            rloc16 = diagTlv.mData.mAddr16;
         }
-        diagSet.push_back(diagTlv);
+        DiagStore::AppendTlv(tlvs, diagTlv);
     }
-    UpdateDiag(keyRloc, diagSet);
+    // The message is only valid in the callback, the parsed TLVs are handed over to the REST server.
+    PostTask(std::bind(&Resource::HandleDiagnosticResponse, this, rloc16, std::move(tlvs)));
 
 exit:
     if (aError != OT_ERROR_NONE)
@@ -584,5 +2344,12 @@ exit:
     }
 }
 
+void Resource::HandleDiagnosticResponse(uint16_t aRloc16, std::vector<uint8_t> &aTlvs)
+{
+    // The response makes room for querying the next node, and answers the TLVs queried from the node.
+    UpdateDiag(aRloc16, aTlvs, mDiagScheduler.HandleResponse(aRloc16));
+    ProcessDiagSchedule();
+}
+
 } // namespace rest
 } // namespace otbr
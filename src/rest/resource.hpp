@@ -34,19 +34,163 @@
 #ifndef OTBR_REST_RESOURCE_HPP_
 #define OTBR_REST_RESOURCE_HPP_
 
-#include <unordered_map>
+#include <functional>
+#include <list>
+#include <mutex>
 
 #include <openthread/border_router.h>
 
 #include "agent/ncp_openthread.hpp"
 #include "agent/thread_helper.hpp"
+#if OTBR_ENABLE_RADIO_THREAD
+#include "common/task_queue.hpp"
+#endif
+#include "common/timer.hpp"
+#include "rest/diag_policy.hpp"
+#include "rest/diag_scheduler.hpp"
+#include "rest/diag_store.hpp"
 #include "rest/json.hpp"
+#include "rest/rate_limiter.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "rest/response_cache.hpp"
+#include "rest/router.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
+using otbr::Ncp::NodeState;
 using std::chrono::steady_clock;
 
+/**
+ * The initial period (in seconds) of refreshing the cached diagnostics in background, 0 to only refresh on demand.
+ *
+ * The period is adapted to the loss of queries and to how often the diagnostics change, between the minimum and the
+ * maximum periods, and is longer if OTBR_REST_DIAG_AIRTIME_BUDGET requires so.
+ *
+ */
+#ifndef OTBR_REST_DIAG_REFRESH_PERIOD
+#define OTBR_REST_DIAG_REFRESH_PERIOD 30
+#endif
+
+/**
+ * The minimum period (in seconds) the refresh period shortens to while the diagnostics often change, unless
+ * OTBR_REST_DIAG_AIRTIME_BUDGET requires a longer one.
+ *
+ */
+#ifndef OTBR_REST_DIAG_REFRESH_MIN_PERIOD
+#define OTBR_REST_DIAG_REFRESH_MIN_PERIOD 10
+#endif
+
+/**
+ * The maximum period (in seconds) the refresh period grows to while the diagnostics rarely change or queries are lost,
+ * unless OTBR_REST_DIAG_AIRTIME_BUDGET requires a longer one.
+ *
+ */
+#ifndef OTBR_REST_DIAG_REFRESH_MAX_PERIOD
+#define OTBR_REST_DIAG_REFRESH_MAX_PERIOD 300
+#endif
+
+/**
+ * The share (in permille) of the airtime of the Thread network the diagnostic queries and their responses may take,
+ * estimated from the size of the responses and the route cost to the nodes, 0 for no limit.
+ *
+ * Only the background refresh is delayed to fit in the budget. The queries a client waits for are sent at once, as
+ * the clients are already rate limited, and their airtime delays the next background queries.
+ *
+ */
+#ifndef OTBR_REST_DIAG_AIRTIME_BUDGET
+#define OTBR_REST_DIAG_AIRTIME_BUDGET 20
+#endif
+
+/**
+ * The period (in seconds) of querying the diagnostic TLVs which rarely change, e.g. the addresses and the mode of a
+ * node, 0 to query them with the others. The other TLVs, e.g. the MAC counters, are queried at each refresh.
+ *
+ */
+#ifndef OTBR_REST_DIAG_STATIC_REFRESH_PERIOD
+#define OTBR_REST_DIAG_STATIC_REFRESH_PERIOD 300
+#endif
+
+/**
+ * The maximum memory (in bytes) of the cached diagnostics, the diagnostics received the longest time ago are evicted
+ * first.
+ *
+ */
+#ifndef OTBR_REST_DIAG_CACHE_MAX_BYTES
+#define OTBR_REST_DIAG_CACHE_MAX_BYTES 262144
+#endif
+
+/**
+ * The maximum number of unicast diagnostic queries waiting for a response at the same time, further nodes are queried
+ * as responses arrive. The window is reduced on small networks and when queries are lost.
+ *
+ */
+#ifndef OTBR_REST_DIAG_QUERY_WINDOW
+#define OTBR_REST_DIAG_QUERY_WINDOW 4
+#endif
+
+/**
+ * The maximum number of times a unicast diagnostic query is sent to a node which does not respond.
+ *
+ */
+#ifndef OTBR_REST_DIAG_QUERY_ATTEMPTS
+#define OTBR_REST_DIAG_QUERY_ATTEMPTS 3
+#endif
+
+/**
+ * The time (in milliseconds) to wait for the response to a unicast diagnostic query before sending it again.
+ *
+ */
+#ifndef OTBR_REST_DIAG_QUERY_TIMEOUT
+#define OTBR_REST_DIAG_QUERY_TIMEOUT 1000
+#endif
+
+/**
+ * The interval (in milliseconds) for a client to gain a request token, and the number of tokens it could save up.
+ *
+ */
+#ifndef OTBR_REST_CLIENT_REQUEST_INTERVAL
+#define OTBR_REST_CLIENT_REQUEST_INTERVAL 50
+#endif
+
+#ifndef OTBR_REST_CLIENT_REQUEST_BURST
+#define OTBR_REST_CLIENT_REQUEST_BURST 40
+#endif
+
+/**
+ * The interval (in milliseconds) for a client to gain a token for a request sending diagnostic queries to the Thread
+ * network, and the number of tokens it could save up. Requests served from the cache do not take these tokens.
+ *
+ */
+#ifndef OTBR_REST_CLIENT_MESH_QUERY_INTERVAL
+#define OTBR_REST_CLIENT_MESH_QUERY_INTERVAL 5000
+#endif
+
+#ifndef OTBR_REST_CLIENT_MESH_QUERY_BURST
+#define OTBR_REST_CLIENT_MESH_QUERY_BURST 4
+#endif
+
+/**
+ * The largest number of entries of a page of the diagnostics, the child table or the neighbor table, which is also
+ * the size of a page requested by a cursor without a limit.
+ *
+ */
+#ifndef OTBR_REST_PAGE_MAX_LIMIT
+#define OTBR_REST_PAGE_MAX_LIMIT 100
+#endif
+
+/**
+ * The number of serialized response bodies kept for identical requests to share, and the time (in milliseconds) a
+ * body is shared for. Only the resources versioned by state changes and those of the cached diagnostics are shared.
+ *
+ */
+#ifndef OTBR_REST_RESPONSE_CACHE_ENTRIES
+#define OTBR_REST_RESPONSE_CACHE_ENTRIES 16
+#endif
+
+#ifndef OTBR_REST_RESPONSE_CACHE_MAX_AGE
+#define OTBR_REST_RESPONSE_CACHE_MAX_AGE 1000
+#endif
+
 namespace otbr {
 namespace rest {
 
@@ -68,10 +212,32 @@ public:
     /**
      * This method initialize the Resource handler.
      *
+     * It is called from the mainloop, as it registers the callbacks of OpenThread.
      *
      */
     void Init(void);
 
+    /**
+     * This method runs a task on the thread of the REST server.
+     *
+     * With `OTBR_ENABLE_RADIO_THREAD`, the task is handed over to the thread of the REST server, e.g. by a callback of
+     * OpenThread on the mainloop. Otherwise the task runs at once.
+     *
+     * @param[in]   aTask   The task.
+     *
+     */
+    void PostTask(std::function<void(void)> aTask);
+
+#if OTBR_ENABLE_RADIO_THREAD
+    /**
+     * This method returns the queue of the tasks run on the thread of the REST server.
+     *
+     * @returns A reference to the task queue.
+     *
+     */
+    TaskQueue &GetTasks(void) { return mTasks; }
+#endif
+
     /**
      * This method is the main entry of resource handler, which find corresponding handler according to request url
      * find the resource and set the content of response.
@@ -91,6 +257,35 @@ public:
      */
     void HandleCallback(Request &aRequest, Response &aResponse);
 
+    /**
+     * This function pointer is called when a response waiting for a callback may be ready, so that the waiting
+     * connection calls `HandleCallback()` again.
+     *
+     * @param[in]   aContext  A pointer to application-specific context.
+     *
+     */
+    typedef void (*CallbackReadyHandler)(void *aContext);
+
+    /**
+     * This method subscribes to the notification of responses waiting for a callback being ready.
+     *
+     * @param[in]   aHandler  The function pointer to be called when responses may be ready.
+     * @param[in]   aContext  A pointer to application-specific context.
+     *
+     */
+    void AddCallbackWaiter(CallbackReadyHandler aHandler, void *aContext);
+
+    /**
+     * This method unsubscribes from the notification of responses waiting for a callback being ready.
+     *
+     * It is safe to call this method from the callback ready handler.
+     *
+     * @param[in]   aHandler  The function pointer passed to `AddCallbackWaiter()`.
+     * @param[in]   aContext  The context passed to `AddCallbackWaiter()`.
+     *
+     */
+    void RemoveCallbackWaiter(CallbackReadyHandler aHandler, void *aContext);
+
     /**
      * This method provides a quick handler, which could directly set response code of a response and set error code and
      * error message to the request body.
@@ -101,9 +296,104 @@ public:
      */
     void ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const;
 
+    /**
+     * This method sets the response telling that the agent is starting, which is served until the NCP is initialized.
+     *
+     * It does not access the NCP and can be called before `Init()`.
+     *
+     * @param[inout]   aResponse  A response instance.
+     *
+     */
+    void StartingHandler(Response &aResponse) const;
+
+    /**
+     * This function pointer is called with each event pushed to event stream subscribers.
+     *
+     * @param[in]   aContext  A pointer to application-specific context.
+     * @param[in]   aEvent    The event, formatted as a Server-Sent Events message.
+     *
+     */
+    typedef void (*EventHandler)(void *aContext, const std::string &aEvent);
+
+    /**
+     * This method subscribes to the events pushed through the event stream resource.
+     *
+     * @param[in]   aHandler  The function pointer to be called for each event.
+     * @param[in]   aContext  A pointer to application-specific context.
+     *
+     */
+    void AddEventListener(EventHandler aHandler, void *aContext);
+
+    /**
+     * This method unsubscribes from the events pushed through the event stream resource.
+     *
+     * It is safe to call this method from the event handler.
+     *
+     * @param[in]   aHandler  The function pointer passed to `AddEventListener()`.
+     * @param[in]   aContext  The context passed to `AddEventListener()`.
+     *
+     */
+    void RemoveEventListener(EventHandler aHandler, void *aContext);
+
+    /**
+     * This method returns the cached diagnostics of the nodes, for other servers of the agent to share them.
+     *
+     * Outdated diagnostics are removed first, and a query of all diagnostics is sent if none is fresh and no query is
+     * still collecting responses, so the caller sees the responses at a later call.
+     *
+     * This method must be called from the thread of the REST server, which is the mainloop unless
+     * `OTBR_ENABLE_RADIO_THREAD`.
+     *
+     * @returns A reference to the cached diagnostics, invalidated by any diagnostic response.
+     *
+     */
+    const DiagStore &GetDiagnostics(void);
+
+    /**
+     * This method returns the sums of the MAC counters of the nodes whose diagnostics are cached.
+     *
+     * Unlike `GetDiagnostics()`, it may be called from any thread and never sends a query.
+     *
+     * @returns A copy of the sums, as of the latest change of the cached diagnostics.
+     *
+     */
+    MeshCounters GetMeshCounters(void) const;
+
 private:
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
+
+    struct ResourceVersion
+    {
+        otChangedFlags mFlags;   ///< The state changes which may change the resource.
+        uint32_t       mVersion; ///< Bumped when any state change in `mFlags` happened.
+    };
+
+    struct DiagFilter
+    {
+        DiagFilter(void);
+        bool IsAll(void) const;
+
+        std::vector<uint8_t>  mTlvTypes; ///< The TLV types to query.
+        uint32_t              mTlvMask;  ///< The bit mask of `mTlvTypes`.
+        std::vector<uint16_t> mRloc16s;  ///< The RLOC16s of the nodes to query, all nodes if empty.
+        uint16_t              mCursor;   ///< The RLOC16 the page of the responses starts at.
+        size_t                mLimit;    ///< The number of responses of the page, SIZE_MAX for all responses.
+    };
+
+    struct Route
+    {
+        const char *            mPath;            ///< The route pattern.
+        ResourceHandler         mHandler;         ///< The handler of the resource.
+        ResourceCallbackHandler mCallbackHandler; ///< The handler once the diagnostics are collected, or nullptr.
+        ResourceVersion         mVersion;         ///< The version, the resource is not versioned if no flag is set.
+    };
+
+    void AddRoute(const char *            aPath,
+                  ResourceHandler         aHandler,
+                  ResourceCallbackHandler aCallbackHandler = nullptr,
+                  otChangedFlags          aVersionFlags    = 0);
+
     void NodeInfo(const Request &aRequest, Response &aResponse) const;
     void ExtendedAddr(const Request &aRequest, Response &aResponse) const;
     void State(const Request &aRequest, Response &aResponse) const;
@@ -113,8 +403,39 @@ private:
     void Rloc16(const Request &aRequest, Response &aResponse) const;
     void ExtendedPanId(const Request &aRequest, Response &aResponse) const;
     void Rloc(const Request &aRequest, Response &aResponse) const;
+    void NetworkData(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
+    void NodeDiagnostic(const Request &aRequest, Response &aResponse) const;
+    void Events(const Request &aRequest, Response &aResponse) const;
+    void Batch(const Request &aRequest, Response &aResponse) const;
+    void ServerHealth(const Request &aRequest, Response &aResponse) const;
+    void ServerMetrics(const Request &aRequest, Response &aResponse) const;
+    void MeshTopology(const Request &aRequest, Response &aResponse) const;
+    void MeshCountersResource(const Request &aRequest, Response &aResponse) const;
+    void Commissioning(const Request &aRequest, Response &aResponse) const;
+    void ChildTable(const Request &aRequest, Response &aResponse) const;
+    void NeighborTable(const Request &aRequest, Response &aResponse) const;
+    void LinkQuality(const Request &aRequest, Response &aResponse) const;
+    void CountersHistory(const Request &aRequest, Response &aResponse) const;
+    void ChannelHistory(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void HandleNodeDiagnosticCallback(const Request &aRequest, Response &aResponse);
+
+    template <typename HistoryType>
+    void HistoryHandler(const HistoryType &aHistory,
+                        void (*aHistory2Json)(JsonWriter &, uint32_t, const std::vector<typename HistoryType::Entry> &),
+                        const Request &aRequest,
+                        Response &     aResponse) const;
+
+    bool        Admit(RateLimiter &aLimiter, const Request &aRequest, Response &aResponse) const;
+    std::string GetETag(uint32_t aVersion, ContentFormat aFormat) const;
+    bool        GetStateVersion(uint16_t aRouteId, uint32_t &aVersion) const;
+    bool        FindSharedResponse(uint16_t aRouteId, const Request &aRequest, Response &aResponse) const;
+    void        ShareResponse(uint16_t aRouteId, const Request &aRequest, Response &aResponse) const;
+    void        HandleThreadStateChanged(otChangedFlags aFlags);
+
+    otbrError CollectNodeInfo(const NodeState &aState, struct NodeInfo &aNode) const;
+    bool      WriteBatchItem(JsonWriter &aWriter, const std::string &aPath, const struct NodeInfo &aNode) const;
 
     void GetNodeInfo(Response &aResponse) const;
     void GetDataExtendedAddr(Response &aResponse) const;
@@ -125,23 +446,128 @@ private:
     void GetDataRloc16(Response &aResponse) const;
     void GetDataExtendedPanId(Response &aResponse) const;
     void GetDataRloc(Response &aResponse) const;
+    void GetDataNetworkData(Response &aResponse) const;
+    void GetDataCommissioning(Response &aResponse) const;
+
+    static bool     ParseDiagFilter(const Request &aRequest, DiagFilter &aFilter);
+    static bool     ParseNodeDiagFilter(const Request &aRequest, DiagFilter &aFilter);
+    bool            IsDiagnosticFresh(const DiagInfo &aInfo, uint32_t aTlvMask) const;
+    uint64_t        GetDiagExpireTimeout(void) const;
+    uint64_t        GetDiagStaticExpireTimeout(void) const;
+    uint32_t        EstimateDiagAirtime(const NodeState &aState, uint16_t aRloc16) const;
+    uint32_t        GetQueryTlvMask(uint16_t aRloc16, uint32_t aTlvMask) const;
+    void            ScheduleDiagQuery(const NodeState &aState,
+                                      uint16_t         aRloc16,
+                                      uint32_t         aTlvMask,
+                                      bool             aOnDemand) const;
+    const DiagInfo *FindDiagnostic(uint16_t aRloc16, uint32_t aTlvMask) const;
+    void            GetDataDiagnostic(const DiagFilter &aFilter, Response &aResponse) const;
+    bool            GetDataNodeDiagnostic(const DiagFilter &aFilter, Response &aResponse) const;
+    bool            HasDiagnostic(const DiagFilter &aFilter) const;
+    bool            IsDiagnosticCollecting(void) const;
+    bool            IsDiagnosticCollected(steady_clock::time_point aStartTime) const;
+    otbrError       RequestDiagnostic(const DiagFilter &        aFilter,
+                                      bool                      aOnDemand,
+                                      steady_clock::time_point &aQueryTime) const;
+    void            DeleteOutDatedDiagnostic(void);
+    void            UpdateDiag(uint16_t aRloc16, std::vector<uint8_t> &aTlvs, uint32_t aTlvMask);
+    bool            TrimDiagnostic(void);
+    void            PublishDiagStats(void);
+    void            RestoreDiagnostic(void);
+    void            SaveDiagnostic(void) const;
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    static void HandleDiagRefreshTimer(Timer &aTimer, void *aContext);
+    void        HandleDiagRefreshTimer(void);
+
+    void        EmitEvent(const char *aEvent, const std::string &aData);
+    void        EmitTopologyChanged(void);
+    static void HandleNetworkName(void *aContext, const char *aNetworkName);
+    void        HandleNetworkName(const char *aNetworkName);
+    static void HandlePartitionId(void *aContext, uint32_t aPartitionId);
+    void        HandlePartitionId(uint32_t aPartitionId);
+    void        HandleDeviceRole(otDeviceRole aRole);
+    static void HandleDiagCollectTimer(Timer &aTimer, void *aContext);
+    void        HandleDiagCollectTimer(void);
+    static void HandleDiagScheduleTimer(Timer &aTimer, void *aContext);
+    void        ProcessDiagSchedule(void) const;
+    static bool SendDiagnosticQuery(uint16_t aRloc16, uint32_t aTlvMask, void *aContext);
+    bool        SendDiagnosticQuery(uint16_t aRloc16, uint32_t aTlvMask) const;
+    void        NotifyCallbackWaiters(void);
 
     static void DiagnosticResponseHandler(otError              aError,
                                           otMessage *          aMessage,
                                           const otMessageInfo *aMessageInfo,
                                           void *               aContext);
     void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void        HandleDiagnosticResponse(uint16_t aRloc16, std::vector<uint8_t> &aTlvs);
 
+    // Only accessed from the mainloop, the REST server calls OpenThread through `ControllerOpenThread::RunCommand()`
     otInstance *          mInstance;
     ControllerOpenThread *mNcp;
 
-    std::unordered_map<std::string, ResourceHandler>         mResourceMap;
-    std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
+#if OTBR_ENABLE_RADIO_THREAD
+    // Tasks handed over to the thread of the REST server
+    TaskQueue mTasks;
+#endif
+
+    // Route table, the handler identifiers are indexes of `mRoutes`
+    Router             mRouter;
+    std::vector<Route> mRoutes;
+
+    // Random part of the entity tags, which distinguishes this run of the server
+    uint32_t mETagNonce;
+
+    // Serialized bodies of the latest responses, shared by identical requests
+    mutable ResponseCache mResponseCache;
+
+    // Cached diagnostics of the nodes
+    DiagStore mDiagSet;
+
+    // Topology of the Thread network, derived from the cached diagnostics
+    Topology mTopology;
+
+    // Copy of the sums of the MAC counters of the cached diagnostics, for other threads than the REST server's
+    mutable std::mutex mMeshCountersMutex;
+    MeshCounters       mMeshCounters;
+
+    // Timer for refreshing the diagnostics in background
+    Timer mDiagRefreshTimer;
+
+    // Time of sending the latest query of all diagnostics, shared by all requests collecting diagnostics
+    mutable steady_clock::time_point mDiagQueryTime;
+
+    // Whether any query of all diagnostics has been sent
+    mutable bool mDiagQueried;
+
+    // End of collecting responses to the diagnostic queries sent
+    mutable steady_clock::time_point mDiagCollectEnd;
+
+    // TLV types requested by the diagnostic queries still collecting responses
+    mutable uint32_t mDiagCollectMask;
+
+    // Timer for the end of collecting responses to the latest diagnostic query
+    mutable Timer mDiagCollectTimer;
+
+    // Unicast diagnostic queries sent in turn, and the timer for sending those due
+    mutable DiagScheduler mDiagScheduler;
+    mutable Timer         mDiagScheduleTimer;
+
+    // Whether a query of all diagnostics is still sending unicast queries
+    mutable bool mDiagScheduling;
+
+    // Adapted refresh period and window, and the airtime of the queries sent until the latest refresh
+    mutable DiagPolicy mDiagPolicy;
+    uint64_t           mDiagAirtime;
+
+    // Token buckets of the clients, for all requests and for requests sending diagnostic queries
+    mutable RateLimiter mRequestLimiter;
+    mutable RateLimiter mMeshQueryLimiter;
+
+    // Connections waiting for a callback
+    std::list<std::pair<CallbackReadyHandler, void *>> mCallbackWaiters;
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    // Subscribers of the event stream
+    std::list<std::pair<EventHandler, void *>> mEventListeners;
 };
 
 } // namespace rest
@@ -29,20 +29,72 @@
 #include "rest/response.hpp"
 
 #include <stdio.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/memory_stats.hpp"
+
+#if OTBR_ENABLE_GZIP
+#include "utils/gzip.hpp"
+#endif
 
 #define OT_REST_RESPONSE_CONTENT_TYPE_JSON "application/json"
+#define OT_REST_RESPONSE_CONTENT_TYPE_CBOR "application/cbor"
+#define OT_REST_RESPONSE_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
     "Access-Control-Allow-Headers, Origin,Accept, X-Requested-With, Content-Type, Access-Control-Request-Method, " \
     "Access-Control-Request-Headers"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD "GET"
+#if OTBR_ENABLE_GZIP
+#define OT_REST_RESPONSE_VARY "Accept, Accept-Encoding"
+#else
+#define OT_REST_RESPONSE_VARY "Accept"
+#endif
 
 namespace otbr {
 namespace rest {
 
+// Number of headers set by the constructor.
+static const size_t kNumPredefinedHeaders = 5;
+
+SharedBody::SharedBody(std::string &aBody)
+    : mFormat(ContentFormat::kJson)
+    , mRendered(true)
+{
+    mBody.swap(aBody);
+}
+
+SharedBody::SharedBody(BodyRenderer aRenderer, ContentFormat aFormat)
+    : mRenderer(std::move(aRenderer))
+    , mFormat(aFormat)
+    , mRendered(false)
+{
+}
+
+void SharedBody::Render(void)
+{
+    // Responses written at the same time on worker threads wait for the first one rendering the body.
+    std::call_once(mRenderOnce, [this]() {
+        if (!mRendered.load())
+        {
+            JsonWriter writer(mBody, mFormat);
+
+            mRenderer(writer);
+            mRenderer = nullptr;
+            mRendered.store(true);
+        }
+    });
+}
+
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mKeepAlive(false)
+    , mStream(false)
+    , mNotModified(false)
+    , mContentFormat(ContentFormat::kJson)
+    , mRoute(nullptr)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1 ";
@@ -59,6 +111,31 @@ Response::Response(void)
 
     mHeaderField.push_back("Access-Control-Allow-Headers");
     mHeaderValue.push_back(OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS);
+
+    // The body is encoded as negotiated by the Accept header, and compressed as negotiated by Accept-Encoding.
+    mHeaderField.push_back("Vary");
+    mHeaderValue.push_back(OT_REST_RESPONSE_VARY);
+}
+
+void Response::Reset(void)
+{
+    // Only the pre-defined headers are kept, an event stream, compression and rejections add more.
+    mHeaderField.resize(kNumPredefinedHeaders);
+    mHeaderValue.resize(kNumPredefinedHeaders);
+    mHeaderValue[0] = OT_REST_RESPONSE_CONTENT_TYPE_JSON;
+
+    mCode.clear();
+    mBody.clear();
+    mETag.clear();
+    mCallback      = false;
+    mComplete      = false;
+    mKeepAlive     = false;
+    mStream        = false;
+    mNotModified   = false;
+    mContentFormat = ContentFormat::kJson;
+    mBodyRenderer  = nullptr;
+    mSharedBody    = nullptr;
+    mRoute         = nullptr;
 }
 
 void Response::SetComplete()
@@ -93,12 +170,186 @@ void Response::SetCallback(void)
 
 void Response::SetBody(std::string &aBody)
 {
-    mBody = aBody;
+    mBody         = aBody;
+    mBodyRenderer = nullptr;
+    mSharedBody   = nullptr;
+}
+
+const std::string &Response::GetBody(void) const
+{
+    return (mSharedBody != nullptr) ? mSharedBody->Get() : mBody;
+}
+
+void Response::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
+bool Response::IsKeepAlive(void) const
+{
+    return mKeepAlive;
+}
+
+void Response::SetETag(const std::string &aETag)
+{
+    mETag = aETag;
+}
+
+void Response::SetNotModified(void)
+{
+    mNotModified = true;
+    mBody.clear();
+    mSharedBody = nullptr;
+}
+
+void Response::SetBodyRenderer(BodyRenderer aRenderer)
+{
+    mBodyRenderer = std::move(aRenderer);
+    mBody.clear();
+    mSharedBody = nullptr;
+}
+
+bool Response::HasBodyRenderer(void) const
+{
+    return mBodyRenderer != nullptr || (mSharedBody != nullptr && !mSharedBody->IsRendered());
+}
+
+void Response::RenderBody(void)
+{
+    if (mSharedBody != nullptr)
+    {
+        mSharedBody->Render();
+    }
+    else if (mBodyRenderer != nullptr)
+    {
+        JsonWriter writer(mBody, mContentFormat);
+
+        mBodyRenderer(writer);
+        mBodyRenderer = nullptr;
+    }
+}
+
+std::shared_ptr<SharedBody> Response::ShareBody(void)
+{
+    if (mSharedBody == nullptr)
+    {
+        if (mBodyRenderer != nullptr)
+        {
+            mSharedBody   = std::make_shared<SharedBody>(std::move(mBodyRenderer), mContentFormat);
+            mBodyRenderer = nullptr;
+        }
+        else
+        {
+            mSharedBody = std::make_shared<SharedBody>(mBody);
+        }
+    }
+
+    return mSharedBody;
+}
+
+void Response::SetSharedBody(std::shared_ptr<SharedBody> aBody)
+{
+    mSharedBody   = std::move(aBody);
+    mBodyRenderer = nullptr;
+    mBody.clear();
+}
+
+bool Response::HasOnlyPredefinedHeaders(void) const
+{
+    return mHeaderField.size() == kNumPredefinedHeaders;
+}
+
+void Response::SetContentType(const char *aContentType)
+{
+    // Content-Type is the first pre-defined header.
+    mHeaderValue[0] = aContentType;
+}
+
+void Response::SetRoute(const char *aRoute)
+{
+    mRoute = aRoute;
+}
+
+const char *Response::GetRoute(void) const
+{
+    return mRoute;
+}
+
+uint16_t Response::GetStatusCode(void) const
+{
+    // The status code leads the reason phrase, e.g. "200 OK".
+    return static_cast<uint16_t>(strtoul(mCode.c_str(), nullptr, 10));
+}
+
+void Response::SetRetryAfter(uint32_t aSeconds)
+{
+    mHeaderField.push_back("Retry-After");
+    mHeaderValue.push_back(std::to_string(aSeconds));
+}
+
+void Response::SetNextCursor(const std::string &aCursor)
+{
+    mHeaderField.push_back("Next-Cursor");
+    mHeaderValue.push_back(aCursor);
+
+    // Browsers only let scripts read the headers exposed.
+    mHeaderField.push_back("Access-Control-Expose-Headers");
+    mHeaderValue.push_back("Next-Cursor");
 }
 
-std::string Response::GetBody(void) const
+void Response::SetStream(void)
 {
-    return mBody;
+    mStream = true;
+
+    // Content-Type is the first pre-defined header.
+    mHeaderValue[0] = OT_REST_RESPONSE_CONTENT_TYPE_EVENT_STREAM;
+
+    mHeaderField.push_back("Cache-Control");
+    mHeaderValue.push_back("no-cache");
+}
+
+void Response::SetContentFormat(ContentFormat aFormat)
+{
+    mContentFormat = aFormat;
+
+    // Content-Type is the first pre-defined header.
+    mHeaderValue[0] =
+        (aFormat == ContentFormat::kCbor) ? OT_REST_RESPONSE_CONTENT_TYPE_CBOR : OT_REST_RESPONSE_CONTENT_TYPE_JSON;
+}
+
+ContentFormat Response::GetContentFormat(void) const
+{
+    return mContentFormat;
+}
+
+#if OTBR_ENABLE_GZIP
+void Response::Compress(void)
+{
+    const std::string &body = GetBody();
+    std::string        compressed;
+
+    VerifyOrExit(!mStream && body.size() >= OTBR_REST_GZIP_MIN_LENGTH);
+    VerifyOrExit(Utils::GzipCompress(body.data(), body.size(), compressed) && compressed.size() < body.size());
+
+    // A shared body is left to the other responses, the compressed copy is owned by this response.
+    mBody.swap(compressed);
+    mSharedBody = nullptr;
+    mHeaderField.push_back("Content-Encoding");
+    mHeaderValue.push_back("gzip");
+
+    if (!mETag.empty())
+    {
+        mETag = "W/" + mETag;
+    }
+
+exit:
+    return;
+}
+#endif
+
+bool Response::IsStream(void) const
+{
+    return mStream;
 }
 
 bool Response::NeedCallback(void)
@@ -106,7 +357,7 @@ bool Response::NeedCallback(void)
     return mCallback;
 }
 
-std::string Response::Serialize(void) const
+std::string Response::SerializeHeader(void) const
 {
     size_t      index;
     std::string spacer = "\r\n";
@@ -116,11 +367,33 @@ std::string Response::Serialize(void) const
     {
         ret += (spacer + mHeaderField[index] + ": " + mHeaderValue[index]);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
+    ret += spacer + "Connection: " + (mKeepAlive ? "keep-alive" : "close");
+    if (!mETag.empty())
+    {
+        ret += spacer + "ETag: " + mETag;
+    }
+    if (!mStream && !mNotModified)
+    {
+        // An event stream has no length, it ends when the connection is closed. A not modified response has no body.
+        ret += spacer + "Content-Length: " + std::to_string(GetBody().size());
+    }
+    ret += (spacer + spacer);
 
     return ret;
 }
 
+size_t Response::GetMemoryUsage(void) const
+{
+    size_t size = MemoryStats::VectorSize(mHeaderField) + MemoryStats::VectorSize(mHeaderValue) + mCode.capacity() +
+                  mProtocol.capacity() + mBody.capacity() + mETag.capacity();
+
+    for (size_t index = 0; index < mHeaderField.size(); index++)
+    {
+        size += mHeaderField[index].capacity() + mHeaderValue[index].capacity();
+    }
+
+    return size;
+}
+
 } // namespace rest
 } // namespace otbr
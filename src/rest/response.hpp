@@ -34,12 +34,21 @@
 #ifndef OTBR_REST_RESPONSE_HPP_
 #define OTBR_REST_RESPONSE_HPP_
 
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "rest/json_writer.hpp"
 #include "rest/types.hpp"
 
+#ifndef OTBR_REST_GZIP_MIN_LENGTH
+#define OTBR_REST_GZIP_MIN_LENGTH 1024 ///< Smaller bodies are not worth compressing.
+#endif
+
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
 using std::chrono::seconds;
@@ -48,6 +57,71 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
+/**
+ * This function renders a response body.
+ *
+ * @param[in]   aWriter  A reference to the writer of the response body.
+ *
+ */
+typedef std::function<void(JsonWriter &aWriter)> BodyRenderer;
+
+/**
+ * This class holds a serialized response body, which the responses of identical requests write from.
+ *
+ * The body is immutable once rendered. A body still to be rendered is rendered once, by the first response written,
+ * possibly on a worker thread, the others wait for it.
+ *
+ */
+class SharedBody
+{
+public:
+    /**
+     * The constructor of a rendered body.
+     *
+     * @param[inout]    aBody   The serialized body, it is moved into the shared body.
+     *
+     */
+    explicit SharedBody(std::string &aBody);
+
+    /**
+     * The constructor of a body still to be rendered.
+     *
+     * @param[in]   aRenderer   The renderer of the body, which must only use data it owns.
+     * @param[in]   aFormat     The encoding of the body.
+     *
+     */
+    SharedBody(BodyRenderer aRenderer, ContentFormat aFormat);
+
+    /**
+     * This method renders the body, unless it is already rendered.
+     *
+     * It may be called from any thread.
+     *
+     */
+    void Render(void);
+
+    /**
+     * This method indicates whether the body is rendered.
+     *
+     * @returns  A bool value indicates whether the body is rendered.
+     */
+    bool IsRendered(void) const { return mRendered.load(); }
+
+    /**
+     * This method returns the serialized body, which must be rendered.
+     *
+     * @returns A reference to the serialized body.
+     */
+    const std::string &Get(void) const { return mBody; }
+
+private:
+    std::string       mBody;
+    BodyRenderer      mRenderer;
+    ContentFormat     mFormat;
+    std::once_flag    mRenderOnce;
+    std::atomic<bool> mRendered;
+};
+
 /**
  * This class implements a response class for OTBR_REST, it could be manipulated by connection instance and resource
  * handler.
@@ -63,6 +137,14 @@ public:
      */
     Response(void);
 
+    /**
+     * This method clears the response so that the instance could be reused for the next response.
+     *
+     * Allocated buffers are kept to avoid reallocating them.
+     *
+     */
+    void Reset(void);
+
     /**
      * This method set the response body.
      *
@@ -74,9 +156,9 @@ public:
     /**
      * This method return a string contains the body field of this response.
      *
-     * @returns A string containing the body field.
+     * @returns A reference to the string containing the body field.
      */
-    std::string GetBody(void) const;
+    const std::string &GetBody(void) const;
 
     /**
      * This method set the response code.
@@ -129,21 +211,199 @@ public:
     steady_clock::time_point GetStartTime() const;
 
     /**
-     * This method serialize a response to a string that could be sent by socket later.
+     * This method sets whether the connection is kept open after this response.
+     *
+     * @param[in] aKeepAlive A bool value indicates whether the connection is kept open.
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
+    /**
+     * This method checks whether the connection is kept open after this response.
+     *
+     * @returns  A bool value indicates whether the connection is kept open.
+     */
+    bool IsKeepAlive(void) const;
+
+    /**
+     * This method sets the entity tag of the response body.
+     *
+     * @param[in]   aETag  A string of the quoted entity tag, or an empty string for no entity tag.
+     *
+     */
+    void SetETag(const std::string &aETag);
+
+    /**
+     * This method labels the response as not modified, so that it is sent without a body.
+     *
+     */
+    void SetNotModified(void);
+
+    typedef rest::BodyRenderer BodyRenderer;
+
+    /**
+     * This method defers rendering the body until the response is written.
+     *
+     * The renderer may run on a worker thread, so it must only use data it owns, never the Resource or OpenThread.
+     *
+     * @param[in]   aRenderer  The renderer of the body.
+     *
+     */
+    void SetBodyRenderer(BodyRenderer aRenderer);
+
+    /**
+     * This method indicates whether the body is still to be rendered.
+     *
+     * @returns  A bool value indicates whether a body renderer is set.
+     */
+    bool HasBodyRenderer(void) const;
+
+    /**
+     * This method renders the body with the body renderer, if any, and releases the renderer.
+     *
+     */
+    void RenderBody(void);
+
+    /**
+     * This method turns the body, rendered or not, into a shared body, which other responses may then write from.
+     *
+     * @returns The shared body.
+     *
+     */
+    std::shared_ptr<SharedBody> ShareBody(void);
+
+    /**
+     * This method sets a shared body as the response body.
+     *
+     * @param[in]   aBody   The shared body.
+     *
+     */
+    void SetSharedBody(std::shared_ptr<SharedBody> aBody);
+
+    /**
+     * This method indicates whether the response only has the headers every response has, e.g. no Next-Cursor.
+     *
+     * @returns  A bool value indicates whether no other header is added.
+     */
+    bool HasOnlyPredefinedHeaders(void) const;
+
+    /**
+     * This method sets the Content-Type header, for a body not encoded by a JsonWriter.
+     *
+     * @param[in]   aContentType  The media type of the body.
+     *
+     */
+    void SetContentType(const char *aContentType);
+
+    /**
+     * This method sets the route pattern of the resource serving this response, which labels its metrics.
+     *
+     * @param[in]   aRoute  The route pattern, it must outlive the response.
+     *
+     */
+    void SetRoute(const char *aRoute);
+
+    /**
+     * This method returns the route pattern of the resource serving this response.
+     *
+     * @returns The route pattern, or nullptr if the request matched no route.
+     */
+    const char *GetRoute(void) const;
+
+    /**
+     * This method returns the status code of the response.
+     *
+     * @returns The status code, or 0 if it is not set yet.
+     */
+    uint16_t GetStatusCode(void) const;
+
+    /**
+     * This method adds the Retry-After header, telling a client rejected for sending too many requests when to retry.
+     *
+     * @param[in]   aSeconds  The time (in seconds) to wait before retrying.
+     *
+     */
+    void SetRetryAfter(uint32_t aSeconds);
+
+    /**
+     * This method adds the Next-Cursor header, telling a client reading a table by pages where the next page starts.
+     *
+     * @param[in]   aCursor  The cursor of the next page.
+     *
+     */
+    void SetNextCursor(const std::string &aCursor);
+
+    /**
+     * This method turns the response into an event stream, which is kept open to push events after the body.
+     *
+     */
+    void SetStream(void);
+
+    /**
+     * This method sets the encoding of the response body, and the Content-Type header accordingly.
+     *
+     * @param[in]   aFormat  The encoding of the response body.
+     *
+     */
+    void SetContentFormat(ContentFormat aFormat);
+
+    /**
+     * This method returns the encoding of the response body.
+     *
+     * @returns The encoding of the response body.
+     */
+    ContentFormat GetContentFormat(void) const;
+
+#if OTBR_ENABLE_GZIP
+    /**
+     * This method compresses the body with gzip and adds the Content-Encoding header.
+     *
+     * Event streams and bodies shorter than OTBR_REST_GZIP_MIN_LENGTH are left as they are, so is a body that does
+     * not get smaller. A compressed body has a weak entity tag, as its bytes depend on the compressor.
+     *
+     */
+    void Compress(void);
+#endif
+
+    /**
+     * This method indicates whether the response is an event stream.
+     *
+     * @returns  A bool value indicates whether the response is an event stream.
+     */
+    bool IsStream(void) const;
+
+    /**
+     * This method serialize the status line and headers of a response to a string that could be sent by socket later.
+     *
+     * The body is not copied, it should be sent right after the returned string.
+     *
+     * @returns  A string contains status line, headers and the empty line ending the headers of a response.
+     */
+    std::string SerializeHeader(void) const;
+
+    /**
+     * This method returns the memory held by the buffers of the response, which are kept when it is reset.
      *
-     * @returns  A string contains status line, headers and body of a response.
+     * @returns  The number of bytes allocated.
      */
-    std::string Serialize(void) const;
+    size_t GetMemoryUsage(void) const;
 
 private:
-    bool                     mCallback;
-    std::vector<std::string> mHeaderField;
-    std::vector<std::string> mHeaderValue;
-    std::string              mCode;
-    std::string              mProtocol;
-    std::string              mBody;
-    bool                     mComplete;
-    steady_clock::time_point mStartTime;
+    bool                        mCallback;
+    std::vector<std::string>    mHeaderField;
+    std::vector<std::string>    mHeaderValue;
+    std::string                 mCode;
+    std::string                 mProtocol;
+    std::string                 mBody;
+    std::string                 mETag;
+    bool                        mComplete;
+    bool                        mKeepAlive;
+    bool                        mStream;
+    bool                        mNotModified;
+    ContentFormat               mContentFormat;
+    BodyRenderer                mBodyRenderer;
+    std::shared_ptr<SharedBody> mSharedBody; ///< The body if it is shared, `mBody` is then unused.
+    const char *                mRoute;
+    steady_clock::time_point    mStartTime;
 };
 
 } // namespace rest
@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the response cache of the RESTful HTTP server.
+ */
+
+#include "rest/response_cache.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+ResponseCache::ResponseCache(size_t aMaxEntries, uint32_t aMaxAge)
+    : mMaxEntries(aMaxEntries)
+    , mMaxAge(aMaxAge)
+    , mHits(0)
+{
+}
+
+ResponseCache::Entry *ResponseCache::FindEntry(uint16_t aRouteId, const std::string &aTarget, ContentFormat aFormat)
+{
+    Entry *found = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (entry.mRouteId == aRouteId && entry.mFormat == aFormat && entry.mTarget == aTarget)
+        {
+            ExitNow(found = &entry);
+        }
+    }
+
+exit:
+    return found;
+}
+
+std::shared_ptr<SharedBody> ResponseCache::Find(uint16_t                 aRouteId,
+                                                const std::string &      aTarget,
+                                                ContentFormat            aFormat,
+                                                uint32_t                 aVersion,
+                                                steady_clock::time_point aNow)
+{
+    std::shared_ptr<SharedBody> body;
+    Entry *                     entry = FindEntry(aRouteId, aTarget, aFormat);
+
+    VerifyOrExit(entry != nullptr && entry->mVersion == aVersion && aNow - entry->mTime < mMaxAge);
+
+    entry->mUsed = aNow;
+    body         = entry->mBody;
+    mHits++;
+
+exit:
+    return body;
+}
+
+void ResponseCache::Insert(uint16_t                    aRouteId,
+                           const std::string &         aTarget,
+                           ContentFormat               aFormat,
+                           uint32_t                    aVersion,
+                           steady_clock::time_point    aNow,
+                           std::shared_ptr<SharedBody> aBody)
+{
+    Entry *entry;
+
+    VerifyOrExit(mMaxEntries > 0);
+
+    // Expired bodies are released, unless responses are still being written from them.
+    mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(),
+                                  [this, aNow](const Entry &aEntry) { return aNow - aEntry.mTime >= mMaxAge; }),
+                   mEntries.end());
+
+    entry = FindEntry(aRouteId, aTarget, aFormat);
+
+    if (entry == nullptr)
+    {
+        if (mEntries.size() < mMaxEntries)
+        {
+            mEntries.emplace_back();
+            entry = &mEntries.back();
+        }
+        else
+        {
+            entry = &*std::min_element(mEntries.begin(), mEntries.end(), [](const Entry &aLeft, const Entry &aRight) {
+                return aLeft.mUsed < aRight.mUsed;
+            });
+        }
+
+        entry->mRouteId = aRouteId;
+        entry->mTarget  = aTarget;
+        entry->mFormat  = aFormat;
+    }
+
+    entry->mVersion = aVersion;
+    entry->mTime    = aNow;
+    entry->mUsed    = aNow;
+    entry->mBody    = std::move(aBody);
+
+exit:
+    return;
+}
+
+} // namespace rest
+} // namespace otbr
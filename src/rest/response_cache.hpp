@@ -0,0 +1,138 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the response cache of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_RESPONSE_CACHE_HPP_
+#define OTBR_REST_RESPONSE_CACHE_HPP_
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rest/response.hpp"
+
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class caches the serialized bodies of the latest responses, so identical requests share one of them.
+ *
+ * An entry is keyed by the route and the target of the request and the encoding of the body, and is only valid for
+ * the version of the state the body was serialized from, and for a short time as bodies may include ages.
+ *
+ */
+class ResponseCache
+{
+public:
+    /**
+     * The constructor of an empty cache.
+     *
+     * @param[in]   aMaxEntries     The maximum number of entries, the entry used the longest time ago is replaced.
+     * @param[in]   aMaxAge         The time (in milliseconds) an entry is valid for.
+     *
+     */
+    ResponseCache(size_t aMaxEntries, uint32_t aMaxAge);
+
+    /**
+     * This method finds the body of a response to an identical request.
+     *
+     * @param[in]   aRouteId    The identifier of the route of the request.
+     * @param[in]   aTarget     The target of the request, including the query.
+     * @param[in]   aFormat     The encoding of the body.
+     * @param[in]   aVersion    The version of the state the body is serialized from.
+     * @param[in]   aNow        The current time.
+     *
+     * @returns The shared body, or nullptr if there is no valid entry.
+     *
+     */
+    std::shared_ptr<SharedBody> Find(uint16_t                 aRouteId,
+                                     const std::string &      aTarget,
+                                     ContentFormat            aFormat,
+                                     uint32_t                 aVersion,
+                                     steady_clock::time_point aNow);
+
+    /**
+     * This method adds the body of a response, replacing any entry of the same request.
+     *
+     * @param[in]   aRouteId    The identifier of the route of the request.
+     * @param[in]   aTarget     The target of the request, including the query.
+     * @param[in]   aFormat     The encoding of the body.
+     * @param[in]   aVersion    The version of the state the body is serialized from.
+     * @param[in]   aNow        The current time.
+     * @param[in]   aBody       The shared body.
+     *
+     */
+    void Insert(uint16_t                    aRouteId,
+                const std::string &         aTarget,
+                ContentFormat               aFormat,
+                uint32_t                    aVersion,
+                steady_clock::time_point    aNow,
+                std::shared_ptr<SharedBody> aBody);
+
+    /**
+     * This method returns the number of responses which shared a cached body.
+     *
+     * @returns The number of hits since the cache was constructed.
+     *
+     */
+    uint64_t GetHits(void) const { return mHits; }
+
+private:
+    struct Entry
+    {
+        uint16_t                    mRouteId;
+        std::string                 mTarget;
+        ContentFormat               mFormat;
+        uint32_t                    mVersion;
+        steady_clock::time_point    mTime; ///< The time the body was serialized.
+        steady_clock::time_point    mUsed; ///< The time the entry was last found or inserted.
+        std::shared_ptr<SharedBody> mBody;
+    };
+
+    Entry *FindEntry(uint16_t aRouteId, const std::string &aTarget, ContentFormat aFormat);
+
+    size_t                    mMaxEntries;
+    std::chrono::milliseconds mMaxAge;
+    std::vector<Entry>        mEntries;
+    uint64_t                  mHits;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_RESPONSE_CACHE_HPP_
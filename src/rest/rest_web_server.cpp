@@ -28,9 +28,28 @@
 
 #include "rest/rest_web_server.hpp"
 
+#include <algorithm>
 #include <cerrno>
+#if OTBR_ENABLE_RADIO_THREAD
+#include <thread>
+#endif
 
+#include <arpa/inet.h>
 #include <fcntl.h>
+#include <grp.h>
+#include <pwd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "agent/instance_params.hpp"
+#include "common/health.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_clock.hpp"
+#include "common/memory_stats.hpp"
+#if OTBR_ENABLE_RADIO_THREAD
+#include "common/timer.hpp"
+#endif
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -40,14 +59,30 @@ namespace otbr {
 namespace rest {
 
 // Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
-// Port number used by Rest server.
-static const uint32_t kPortNumber = 8081;
+static const uint32_t kMaxServeNum = OTBR_REST_MAX_CONNECTIONS;
+// Maximum number of connection of one client a server support at the same time.
+static const uint32_t kMaxClientServeNum = OTBR_REST_MAX_CLIENT_CONNECTIONS;
+// Default port number used by Rest server.
+static const uint16_t kPortNumber = OTBR_REST_LISTEN_PORT;
+// Number of listening sockets for each address.
+static const uint32_t kListenSocketNum = OTBR_REST_LISTEN_SOCKETS;
+// Maximum number of socket connections accepted for one readable event, so that a burst does not starve the mainloop.
+static const uint32_t kMaxAcceptNum = 32;
+#if OTBR_ENABLE_RADIO_THREAD
+// Poll timeout of the thread of the REST server, which retries listening as often.
+static const struct timeval kPollTimeout = {1, 0};
+#endif
 
 RestWebServer::RestWebServer(ControllerOpenThread *aNcp)
-    : mResource(Resource(aNcp))
-    , mListenFd(-1)
+    : mResource(aNcp)
+    , mStarted(false)
+    , mReady(false)
+    , mUnixAllowedGid(static_cast<gid_t>(-1))
+    , mUnixSocketBound(false)
 {
+    mConnections.reserve(kMaxServeNum);
+    mActiveConnections.reserve(kMaxServeNum);
+    mFreeConnections.reserve(kMaxServeNum);
 }
 
 RestWebServer *RestWebServer::GetRestWebServer(ControllerOpenThread *aNcp)
@@ -57,139 +92,530 @@ RestWebServer *RestWebServer::GetRestWebServer(ControllerOpenThread *aNcp)
     return sServer;
 }
 
+otbrError RestWebServer::Start(void)
+{
+    mStarted = true;
+    Health::Get().SetReady(Health::kSubsystemRest, false);
+
+#if OTBR_ENABLE_RADIO_THREAD
+    // The thread runs as long as the mainloop, the server is never destroyed.
+    std::thread(&RestWebServer::Run, this).detach();
+
+    return OTBR_ERROR_NONE;
+#else
+    return Listen();
+#endif
+}
+
+otbrError RestWebServer::Listen(void)
+{
+    Response response;
+
+    mResource.ErrorHandler(response, HttpStatusCode::kStatusServiceUnavailable);
+    mServiceUnavailable = response.SerializeHeader() + response.GetBody();
+
+    response.Reset();
+    mResource.ErrorHandler(response, HttpStatusCode::kStatusTooManyRequests);
+    response.SetRetryAfter(1);
+    mTooManyRequests = response.SerializeHeader() + response.GetBody();
+
+    response.Reset();
+    mResource.StartingHandler(response);
+    mStarting = response.SerializeHeader() + response.GetBody();
+
+    return InitializeListenFds();
+}
+
+#if OTBR_ENABLE_RADIO_THREAD
+void RestWebServer::Run(void)
+{
+    // Failing to listen is retried by `UpdateFdSet()`.
+    if (Listen() != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "rest server failed to listen, retrying");
+    }
+
+    while (true)
+    {
+        otSysMainloopContext mainloop;
+        int                  rval;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = kPollTimeout;
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        // The event poller, the timer scheduler and the clock are those of this thread.
+        MainloopClock::Update();
+        EventPoller::Get().UpdateFdSet(mainloop);
+        TimerScheduler::Get().UpdateTimeout(mainloop.mTimeout);
+        mResource.GetTasks().UpdateFdSet(mainloop);
+        UpdateFdSet(mainloop);
+
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        MainloopClock::Update();
+
+        if (rval >= 0)
+        {
+            EventPoller::Get().Process(mainloop);
+            TimerScheduler::Get().Process();
+            mResource.GetTasks().Process(mainloop);
+            Process(mainloop);
+        }
+        else if (errno != EINTR)
+        {
+            otbrLog(OTBR_LOG_ERR, "rest server select() failed: %s", strerror(errno));
+            break;
+        }
+    }
+}
+#endif
+
 otbrError RestWebServer::Init(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
+    if (!mStarted)
+    {
+        error = Start();
+    }
+
     mResource.Init();
 
-    error = InitializeListenFd();
+    mResource.PostTask([this]() {
+        // The server still works without worker threads, everything is then done on the thread of the server.
+        WorkerPool::Get().Init(OTBR_REST_WORKER_THREADS);
+
+        mReady = true;
+        Health::Get().SetReady(Health::kSubsystemRest, true);
+    });
 
     return error;
 }
 
 void RestWebServer::UpdateFdSet(otSysMainloopContext &aMainloop)
 {
-    if (mListenFd == -1)
-    {
-        VerifyOrExit(InitializeListenFd() == OTBR_ERROR_NONE);
-    }
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    OTBR_UNUSED_VARIABLE(aMainloop);
 
-    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    if (mListenFds.empty())
     {
-        Connection *connection = it->second.get();
-        connection->UpdateFdSet(aMainloop);
+        VerifyOrExit(InitializeListenFds() == OTBR_ERROR_NONE);
     }
-exit:
 
+exit:
     return;
 }
 
 otbrError RestWebServer::Process(otSysMainloopContext &aMainloop)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    Connection *connection;
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    return UpdateConnections();
+}
+
+void RestWebServer::HandleListenEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    RestWebServer *server = static_cast<RestWebServer *>(aContext);
 
-    error = UpdateConnections(aMainloop.mReadFdSet);
+    OTBR_UNUSED_VARIABLE(aEvents);
 
-    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    // Drain the queue of pending socket connections, it could be filled by a burst between two mainloop iterations.
+    for (uint32_t count = 0; count < kMaxAcceptNum; count++)
     {
-        connection = it->second.get();
-        connection->Process(aMainloop.mReadFdSet, aMainloop.mWriteFdSet);
+        if (server->Accept(aFd) != OTBR_ERROR_NONE)
+        {
+            break;
+        }
     }
-
-    return error;
 }
 
-otbrError RestWebServer::UpdateConnections(fd_set &aReadFdSet)
+otbrError RestWebServer::UpdateConnections(void)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    size_t index    = 0;
+    bool   released = false;
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
+    // Release completed connections to the pool
+    while (index < mActiveConnections.size())
     {
-        Connection *connection = eraseIt->second.get();
+        Connection *connection = mActiveConnections[index];
 
         if (connection->IsComplete())
         {
-            eraseIt = mConnectionSet.erase(eraseIt);
+            auto client = mClientConnections.find(connection->GetClientAddress());
+
+            if (client != mClientConnections.end() && --client->second == 0)
+            {
+                mClientConnections.erase(client);
+            }
+
+            mFreeConnections.push_back(connection);
+            mActiveConnections[index] = mActiveConnections.back();
+            mActiveConnections.pop_back();
+            released = true;
         }
         else
         {
-            eraseIt++;
+            index++;
         }
     }
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+    // Buffers of a connection are kept when it is released, so they are sampled then.
+    if (released)
+    {
+        UpdateMemoryStats();
+    }
+
+    return OTBR_ERROR_NONE;
+}
+
+void RestWebServer::UpdateMemoryStats(void) const
+{
+    size_t size = MemoryStats::VectorSize(mConnections) + MemoryStats::VectorSize(mActiveConnections) +
+                  MemoryStats::VectorSize(mFreeConnections) + MemoryStats::HashTableSize(mClientConnections);
+
+    for (const auto &connection : mConnections)
     {
-        error = Accept(mListenFd);
+        size += connection->GetMemoryUsage();
+    }
+
+    MemoryStats::Get().Update(MemoryStats::kSubsystemRestConnections, size);
+}
+
+otbrError RestWebServer::InitializeListenFds(void)
+{
+    otbrError   error     = OTBR_ERROR_NONE;
+    std::string addresses = OTBR_REST_LISTEN_ADDRESSES;
+    size_t      start     = 0;
+
+#if OTBR_ENABLE_REST_TLS
+    // Never fall back to plaintext when TLS is configured, the files are loaded again when listening is retried.
+    if (InstanceParams::Get().GetRestTlsCertFile() != nullptr && !mTlsServer.IsEnabled())
+    {
+        SuccessOrExit(error = mTlsServer.Init(InstanceParams::Get().GetRestTlsCertFile(),
+                                              InstanceParams::Get().GetRestTlsKeyFile()));
+    }
+#endif
+
+    while (start < addresses.size())
+    {
+        size_t      end = addresses.find(',', start);
+        std::string address;
+
+        if (end == std::string::npos)
+        {
+            end = addresses.size();
+        }
+
+        address = addresses.substr(start, end - start);
+        address.erase(0, address.find_first_not_of(' '));
+        address.erase(address.find_last_not_of(' ') + 1);
+
+        for (uint32_t index = 0; index < kListenSocketNum; index++)
+        {
+            SuccessOrExit(error = InitializeListenFd(address));
+        }
+
+        start = end + 1;
+    }
+
+    if (InstanceParams::Get().GetRestUnixSocketPath() != nullptr)
+    {
+        SuccessOrExit(error = InitializeUnixListenFd(InstanceParams::Get().GetRestUnixSocketPath()));
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        // Listen on all addresses or none, the whole set is retried later.
+        CloseListenFds();
     }
 
     return error;
 }
 
-otbrError RestWebServer::InitializeListenFd(void)
+otbrError RestWebServer::InitializeListenFd(const std::string &aAddress)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorMessage;
-    int32_t     ret;
-    int32_t     err    = errno;
-    int32_t     optval = 1;
+    otbrError        error = OTBR_ERROR_NONE;
+    std::string      errorMessage;
+    sockaddr_storage address;
+    socklen_t        addressLength;
+    int32_t          fd  = -1;
+    int32_t          err = errno;
+    int32_t          ret;
+    int32_t          optval = 1;
+    int32_t          v6only = 0;
+    uint16_t         port   = InstanceParams::Get().GetRestListenPort();
+
+    if (port == 0)
+    {
+        port = kPortNumber;
+    }
+
+    memset(&address, 0, sizeof(address));
+
+    if (inet_pton(AF_INET6, aAddress.c_str(), &reinterpret_cast<::sockaddr_in6 &>(address).sin6_addr) == 1)
+    {
+        ::sockaddr_in6 &address6 = reinterpret_cast<::sockaddr_in6 &>(address);
+
+        address6.sin6_family = AF_INET6;
+        address6.sin6_port   = htons(port);
+        addressLength        = sizeof(::sockaddr_in6);
+    }
+    else if (inet_pton(AF_INET, aAddress.c_str(), &reinterpret_cast<sockaddr_in &>(address).sin_addr) == 1)
+    {
+        sockaddr_in &address4 = reinterpret_cast<sockaddr_in &>(address);
 
-    mAddress.sin_family      = AF_INET;
-    mAddress.sin_addr.s_addr = INADDR_ANY;
-    mAddress.sin_port        = htons(kPortNumber);
+        address4.sin_family = AF_INET;
+        address4.sin_port   = htons(port);
+        addressLength       = sizeof(sockaddr_in);
+    }
+    else
+    {
+        ExitNow(err = EINVAL, error = OTBR_ERROR_REST, errorMessage = "address");
+    }
+
+    fd = socket(address.ss_family, SOCK_STREAM, 0);
+
+    if (fd == -1 && errno == EAFNOSUPPORT && aAddress == "::")
+    {
+        // IPv6 is disabled on this host, serve IPv4 only.
+        sockaddr_in &address4 = reinterpret_cast<sockaddr_in &>(address);
 
-    mListenFd = socket(AF_INET, SOCK_STREAM, 0);
-    VerifyOrExit(mListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
+        memset(&address, 0, sizeof(address));
+        address4.sin_family      = AF_INET;
+        address4.sin_addr.s_addr = INADDR_ANY;
+        address4.sin_port        = htons(port);
+        addressLength            = sizeof(sockaddr_in);
 
-    ret = setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&optval), sizeof(optval));
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+    }
+    VerifyOrExit(fd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
+
+    ret = setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&optval), sizeof(optval));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt");
 
-    ret = bind(mListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), sizeof(sockaddr));
+    if (kListenSocketNum > 1)
+    {
+        // The kernel balances socket connections among the listening sockets sharing the address.
+        ret = setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char *>(&optval), sizeof(optval));
+        VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "reuse port");
+    }
+
+    if (address.ss_family == AF_INET6)
+    {
+        // Accept IPv4 connections as IPv4-mapped addresses, regardless of the system default.
+        ret = setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char *>(&v6only), sizeof(v6only));
+        VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "v6 only");
+    }
+
+    ret = bind(fd, reinterpret_cast<struct sockaddr *>(&address), addressLength);
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
 
-    ret = listen(mListenFd, 5);
+    ret = listen(fd, OTBR_REST_LISTEN_BACKLOG);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
-    ret = SetFdNonblocking(mListenFd);
+    ret = SetFdNonblocking(fd);
     VerifyOrExit(ret, err = errno, error = OTBR_ERROR_REST, errorMessage = " set nonblock");
 
+    ret = EventPoller::Get().Register(fd, EventPoller::kEventReadable, &RestWebServer::HandleListenEvent, this,
+                                      EventPoller::kPriorityLow);
+    VerifyOrExit(ret == OTBR_ERROR_NONE, err = errno, error = OTBR_ERROR_REST, errorMessage = "register");
+
+    mListenFds.push_back(fd);
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        if (mListenFd != -1)
+        if (fd != -1)
         {
-            close(mListenFd);
-            mListenFd = -1;
+            close(fd);
         }
-        otbrLog(OTBR_LOG_ERR, "otbr rest server init error %s : %s", errorMessage.c_str(), strerror(err));
+        otbrLog(OTBR_LOG_ERR, "otbr rest server init error %s %s : %s", aAddress.c_str(), errorMessage.c_str(),
+                strerror(err));
     }
 
     return error;
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
+static bool IsUnixSocketServed(const sockaddr_un &aAddress)
 {
-    std::string errorMessage;
-    otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
+    int  fd     = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    bool served = false;
 
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
+    VerifyOrExit(fd != -1);
+
+    // Only a socket nobody listens on refuses, a full backlog of a live server fails with EAGAIN.
+    served = connect(fd, reinterpret_cast<const struct sockaddr *>(&aAddress), sizeof(aAddress)) == 0 ||
+             errno != ECONNREFUSED;
+    close(fd);
+
+exit:
+    return served;
+}
+
+otbrError RestWebServer::InitializeUnixListenFd(const char *aPath)
+{
+    otbrError     error = OTBR_ERROR_NONE;
+    std::string   errorMessage;
+    sockaddr_un   address;
+    struct stat   status;
+    int32_t       fd  = -1;
+    int32_t       err = errno;
+    int32_t       ret;
+    const char *  groupName = OTBR_REST_UNIX_ALLOWED_GROUP;
+    struct group *group;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(strlen(aPath) < sizeof(address.sun_path), err = ENAMETOOLONG, error = OTBR_ERROR_REST,
+                 errorMessage = "path");
+    strcpy(address.sun_path, aPath);
+
+    if (groupName[0] != '\0')
+    {
+        group = getgrnam(groupName);
+        VerifyOrExit(group != nullptr, err = ENOENT, error = OTBR_ERROR_REST, errorMessage = "group");
+        mUnixAllowedGid = group->gr_gid;
+    }
+
+    // The socket of a previous run is replaced unless another instance still serves it, any other file is left alone
+    // and fails binding.
+    if (lstat(aPath, &status) == 0 && S_ISSOCK(status.st_mode))
+    {
+        VerifyOrExit(!IsUnixSocketServed(address), err = EADDRINUSE, error = OTBR_ERROR_REST, errorMessage = "served");
+        unlink(aPath);
+    }
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    VerifyOrExit(fd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
+
+    ret = bind(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address));
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
+    mUnixSocketBound = true;
+
+    // The peer credentials are checked for each socket connection, the file mode keeps others from connecting at all.
+    ret = chmod(aPath, OTBR_REST_UNIX_SOCKET_MODE);
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "chmod");
+
+    if (mUnixAllowedGid != static_cast<gid_t>(-1))
+    {
+        ret = chown(aPath, static_cast<uid_t>(-1), mUnixAllowedGid);
+        VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "chown");
+    }
+
+    ret = listen(fd, OTBR_REST_LISTEN_BACKLOG);
+    VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
+
+    ret = SetFdNonblocking(fd);
+    VerifyOrExit(ret, err = errno, error = OTBR_ERROR_REST, errorMessage = " set nonblock");
+
+    ret = EventPoller::Get().Register(fd, EventPoller::kEventReadable, &RestWebServer::HandleListenEvent, this,
+                                      EventPoller::kPriorityLow);
+    VerifyOrExit(ret == OTBR_ERROR_NONE, err = errno, error = OTBR_ERROR_REST, errorMessage = "register");
+
+    mListenFds.push_back(fd);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        if (fd != -1)
+        {
+            close(fd);
+        }
+        otbrLog(OTBR_LOG_ERR, "otbr rest server init error %s %s : %s", aPath, errorMessage.c_str(), strerror(err));
+    }
+
+    return error;
+}
+
+void RestWebServer::RemoveUnixSocket(void)
+{
+    const char *path = InstanceParams::Get().GetRestUnixSocketPath();
+
+    VerifyOrExit(path != nullptr && mUnixSocketBound);
+    unlink(path);
+    mUnixSocketBound = false;
+
+exit:
+    return;
+}
+
+void RestWebServer::CloseListenFds(void)
+{
+    for (int32_t fd : mListenFds)
+    {
+        EventPoller::Get().Unregister(fd);
+        close(fd);
+    }
+
+    mListenFds.clear();
+}
+
+otbrError RestWebServer::Accept(int aListenFd)
+{
+    std::string      errorMessage;
+    otbrError        error = OTBR_ERROR_NONE;
+    int32_t          err;
+    int32_t          fd;
+    sockaddr_storage address;
+    socklen_t        addrlen = sizeof(address);
+    uint32_t         clientConnections;
+    char             clientAddress[INET6_ADDRSTRLEN] = "";
+    bool             secure;
+
+    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&address), &addrlen);
     err = errno;
 
+    // No more pending socket connections.
+    VerifyOrExit(fd >= 0 || (err != EAGAIN && err != EWOULDBLOCK), error = OTBR_ERROR_ERRNO);
     VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
 
     VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
 
-    CreateNewConnection(fd);
+    if (address.ss_family == AF_INET6)
+    {
+        inet_ntop(AF_INET6, &reinterpret_cast<::sockaddr_in6 &>(address).sin6_addr, clientAddress,
+                  sizeof(clientAddress));
+    }
+    else if (address.ss_family == AF_INET)
+    {
+        inet_ntop(AF_INET, &reinterpret_cast<sockaddr_in &>(address).sin_addr, clientAddress, sizeof(clientAddress));
+    }
+    else if (address.ss_family == AF_UNIX)
+    {
+        VerifyOrExit(IsPeerAllowed(fd, clientAddress, sizeof(clientAddress)), err = EACCES, error = OTBR_ERROR_REST,
+                     errorMessage = "peer");
+    }
+
+    // Local consumers on the Unix domain socket are served in plaintext.
+    secure = IsTlsEnabled() && address.ss_family != AF_UNIX;
+
+    {
+        auto client = mClientConnections.find(clientAddress);
+
+        clientConnections = (client != mClientConnections.end()) ? client->second : 0;
+    }
+
+    if (!mReady)
+    {
+        // The resources rely on the NCP being initialized, only tell that the agent is up and starting.
+        RejectConnection(fd, mStarting, secure);
+    }
+    else if (mActiveConnections.size() >= kMaxServeNum)
+    {
+        RejectConnection(fd, mServiceUnavailable, secure);
+    }
+    else if (clientConnections >= kMaxClientServeNum && !RateLimiter::IsExempt(clientAddress))
+    {
+        RejectConnection(fd, mTooManyRequests, secure);
+    }
+    else
+    {
+        CreateNewConnection(fd, clientAddress, secure);
+    }
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -199,28 +625,117 @@ exit:
             close(fd);
             fd = -1;
         }
-        otbrLog(OTBR_LOG_ERR, "rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
+        if (error == OTBR_ERROR_REST)
+        {
+            otbrLog(OTBR_LOG_ERR, "rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
+        }
     }
 
     return error;
 }
 
-void RestWebServer::CreateNewConnection(int &aFd)
+void RestWebServer::CreateNewConnection(int &aFd, const std::string &aClientAddress, bool aSecure)
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    Connection *connection;
 
-    if (it.second == true)
+    if (mFreeConnections.empty())
     {
-        Connection *connection = it.first->second.get();
-        connection->Init();
+        mConnections.emplace_back(new Connection(MainloopClock::Now(), &mResource, aFd, aClientAddress));
+        connection = mConnections.back().get();
+        UpdateMemoryStats();
     }
     else
     {
-        // failure on inserting new connection
-        close(aFd);
-        aFd = -1;
+        connection = mFreeConnections.back();
+        mFreeConnections.pop_back();
+        connection->Reset(MainloopClock::Now(), aFd, aClientAddress);
+    }
+
+#if OTBR_ENABLE_REST_TLS
+    connection->SetTls(aSecure ? &mTlsServer : nullptr);
+#else
+    OTBR_UNUSED_VARIABLE(aSecure);
+#endif
+
+    mClientConnections[aClientAddress]++;
+    mActiveConnections.push_back(connection);
+    connection->Init();
+}
+
+void RestWebServer::RejectConnection(int &aFd, const std::string &aResponse, bool aSecure)
+{
+    char    buf[2048];
+    ssize_t received;
+
+    // Responding over TLS would take a full handshake, the client only sees the socket connection closed.
+    VerifyOrExit(!aSecure);
+
+    // Best effort: consume the request already received so that closing does not reset the socket connection before
+    // the response is delivered.
+    received = read(aFd, buf, sizeof(buf));
+    OTBR_UNUSED_VARIABLE(received);
+
+    VerifyOrExit(send(aFd, aResponse.c_str(), aResponse.size(), MSG_NOSIGNAL) >= 0,
+                 otbrLog(OTBR_LOG_WARNING, "rest server reject error: %s", strerror(errno)));
+
+exit:
+    close(aFd);
+    aFd = -1;
+}
+
+bool RestWebServer::IsPeerAllowed(int32_t aFd, char *aClientAddress, size_t aLength) const
+{
+    bool         allowed = false;
+    struct ucred credentials;
+    socklen_t    length = sizeof(credentials);
+
+    VerifyOrExit(getsockopt(aFd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) == 0);
+
+    // Local consumers are told apart by their user, e.g. for the connections of each client.
+    snprintf(aClientAddress, aLength, "unix:%u", static_cast<unsigned int>(credentials.uid));
+
+    allowed = credentials.uid == 0 || credentials.uid == geteuid() ||
+              (mUnixAllowedGid != static_cast<gid_t>(-1) && IsInAllowedGroup(credentials.uid, credentials.gid));
+
+exit:
+    return allowed;
+}
+
+bool RestWebServer::IsInAllowedGroup(uid_t aUid, gid_t aGid) const
+{
+    bool               member = (aGid == mUnixAllowedGid);
+    long               size   = sysconf(_SC_GETPW_R_SIZE_MAX);
+    std::vector<char>  buffer(size > 0 ? static_cast<size_t>(size) : 16384);
+    std::vector<gid_t> groups(16);
+    int                count = static_cast<int>(groups.size());
+    struct passwd      user;
+    struct passwd *    result = nullptr;
+
+    VerifyOrExit(!member);
+
+    // The credentials only carry the primary group of the peer, its supplementary groups are those of its user.
+    VerifyOrExit(getpwuid_r(aUid, &user, buffer.data(), buffer.size(), &result) == 0 && result != nullptr);
+
+    if (getgrouplist(user.pw_name, user.pw_gid, groups.data(), &count) < 0)
+    {
+        // The count is updated to the number of groups of the user.
+        groups.resize(static_cast<size_t>(count));
+        VerifyOrExit(getgrouplist(user.pw_name, user.pw_gid, groups.data(), &count) >= 0);
     }
+
+    member = std::find(groups.begin(), groups.begin() + count, mUnixAllowedGid) != groups.begin() + count;
+
+exit:
+    return member;
+}
+
+bool RestWebServer::IsTlsEnabled(void) const
+{
+#if OTBR_ENABLE_REST_TLS
+    return mTlsServer.IsEnabled();
+#else
+    return false;
+#endif
 }
 
 bool RestWebServer::SetFdNonblocking(int32_t fd)
@@ -34,11 +34,80 @@
 #ifndef OTBR_REST_REST_WEB_SERVER_HPP_
 #define OTBR_REST_REST_WEB_SERVER_HPP_
 
+#include <atomic>
+
 #include "rest/connection.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
 using std::chrono::steady_clock;
 
+/**
+ * The maximum number of connections served at the same time, further connections are rejected with 503.
+ *
+ */
+#ifndef OTBR_REST_MAX_CONNECTIONS
+#define OTBR_REST_MAX_CONNECTIONS 500
+#endif
+
+/**
+ * The maximum number of connections of one client served at the same time, further connections of that client are
+ * rejected with 429. Clients exempt from rate limiting are not limited either.
+ *
+ */
+#ifndef OTBR_REST_MAX_CLIENT_CONNECTIONS
+#define OTBR_REST_MAX_CLIENT_CONNECTIONS 32
+#endif
+
+/**
+ * The comma separated addresses to listen on, "::" accepts both IPv6 and IPv4 connections.
+ *
+ */
+#ifndef OTBR_REST_LISTEN_ADDRESSES
+#define OTBR_REST_LISTEN_ADDRESSES "::"
+#endif
+
+/**
+ * The port number to listen on.
+ *
+ */
+#ifndef OTBR_REST_LISTEN_PORT
+#define OTBR_REST_LISTEN_PORT 8081
+#endif
+
+/**
+ * The maximum length of the queue of pending socket connections of each listening socket.
+ *
+ */
+#ifndef OTBR_REST_LISTEN_BACKLOG
+#define OTBR_REST_LISTEN_BACKLOG SOMAXCONN
+#endif
+
+/**
+ * The number of listening sockets sharing each address with SO_REUSEPORT, each has its own queue of pending socket
+ * connections.
+ *
+ */
+#ifndef OTBR_REST_LISTEN_SOCKETS
+#define OTBR_REST_LISTEN_SOCKETS 1
+#endif
+
+/**
+ * The file mode of the Unix domain socket, when local consumers are served on one.
+ *
+ */
+#ifndef OTBR_REST_UNIX_SOCKET_MODE
+#define OTBR_REST_UNIX_SOCKET_MODE 0660
+#endif
+
+/**
+ * The group whose members may connect to the Unix domain socket, besides root and the user of otbr-agent, empty for
+ * none.
+ *
+ */
+#ifndef OTBR_REST_UNIX_ALLOWED_GROUP
+#define OTBR_REST_UNIX_ALLOWED_GROUP ""
+#endif
+
 namespace otbr {
 namespace rest {
 
@@ -60,7 +129,28 @@ public:
     static RestWebServer *GetRestWebServer(ControllerOpenThread *aNcp);
 
     /**
-     * This method initializes the REST server.
+     * This method starts listening before the NCP is initialized, socket connections are answered with a "starting"
+     * response until `Init()` is called.
+     *
+     * It does not access the NCP, so that it can be called while the NCP is initialized on another thread.
+     *
+     * When a TLS certificate is configured, it only listens once the certificate and its key are loaded, and the
+     * socket connections are served over TLS.
+     *
+     * With `OTBR_ENABLE_RADIO_THREAD`, it starts the thread of the REST server instead, which listens and serves the
+     * socket connections on its own mainloop, so the mainloop of the radio never waits for the REST server.
+     * `UpdateFdSet()` and `Process()` are then only called by that thread.
+     *
+     * @retval  OTBR_ERROR_NONE     REST server started successfully.
+     * @retval  OTBR_ERROR_REST     Failed to listen, which is retried by the mainloop.
+     *
+     */
+    otbrError Start(void);
+
+    /**
+     * This method initializes the REST server, starting it first if not started yet.
+     *
+     * It is called from the mainloop once the NCP is initialized.
      *
      * @retval  OTBR_ERROR_NONE     REST server initialized successfully.
      * @retval  OTBR_ERROR_REST     Failed due to rest error .
@@ -69,7 +159,7 @@ public:
     otbrError Init(void);
 
     /**
-     * This method updates the file descriptor sets and timeout for mainloop.
+     * This method updates the mainloop, retrying to listen if the listen sockets failed to initialize.
      *
      * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
      *
@@ -77,29 +167,79 @@ public:
     void UpdateFdSet(otSysMainloopContext &aMainloop);
 
     /**
-     * This method performs processing.
+     * This method performs processing, releasing completed connections.
      *
      * @param[in]       aMainloop   A reference to OpenThread mainloop context.
      *
      */
     otbrError Process(otSysMainloopContext &aMainloop);
 
+    /**
+     * This method returns the resource handler, which collects the diagnostics shared with other servers.
+     *
+     * @returns A reference to the resource handler.
+     *
+     */
+    Resource &GetResource(void) { return mResource; }
+
+    /**
+     * This method removes the Unix domain socket file when otbr-agent exits, so that local consumers fail to connect
+     * at once rather than finding a socket nobody serves.
+     *
+     * It only removes the file, so that it can be called while the thread of the REST server still runs.
+     *
+     */
+    void RemoveUnixSocket(void);
+
 private:
     RestWebServer(ControllerOpenThread *aNcp);
-    otbrError UpdateConnections(fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
-    otbrError Accept(int32_t aListenFd);
-    otbrError InitializeListenFd(void);
-    bool      SetFdNonblocking(int32_t fd);
+    otbrError   Listen(void);
+    void        Run(void);
+    static void HandleListenEvent(void *aContext, int aFd, uint32_t aEvents);
+    otbrError   UpdateConnections(void);
+    void        UpdateMemoryStats(void) const;
+    void        CreateNewConnection(int32_t &aFd, const std::string &aClientAddress, bool aSecure);
+    void        RejectConnection(int32_t &aFd, const std::string &aResponse, bool aSecure);
+    otbrError   Accept(int32_t aListenFd);
+    otbrError   InitializeListenFds(void);
+    otbrError   InitializeListenFd(const std::string &aAddress);
+    otbrError   InitializeUnixListenFd(const char *aPath);
+    void        CloseListenFds(void);
+    bool        SetFdNonblocking(int32_t fd);
+    bool        IsPeerAllowed(int32_t aFd, char *aClientAddress, size_t aLength) const;
+    bool        IsInAllowedGroup(uid_t aUid, gid_t aGid) const;
+    bool        IsTlsEnabled(void) const;
 
     // Resource handler
     Resource mResource;
-    // Struct for server configuration
-    sockaddr_in mAddress;
-    // File descriptor for listening
-    int32_t mListenFd;
-    // Connection List
-    std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    // File descriptors for listening
+    std::vector<int32_t> mListenFds;
+    // Connection pool, connections are allocated on demand and reused once completed
+    std::vector<std::unique_ptr<Connection>> mConnections;
+    // Connections serving a socket connection
+    std::vector<Connection *> mActiveConnections;
+    // Completed connections ready to be reused
+    std::vector<Connection *> mFreeConnections;
+    // Serialized response for rejecting a socket connection when all connections are in use
+    std::string mServiceUnavailable;
+    // Serialized response for rejecting a socket connection when all connections of its client are in use
+    std::string mTooManyRequests;
+    // Serialized response for rejecting a socket connection while the NCP is being initialized
+    std::string mStarting;
+    // Whether the server is started
+    bool mStarted;
+    // Whether the resources are initialized and socket connections are served
+    bool mReady;
+    // Number of connections in use of each client
+    std::unordered_map<std::string, uint32_t> mClientConnections;
+    // Group allowed to connect to the Unix domain socket, -1 for none
+    gid_t mUnixAllowedGid;
+    // Whether the Unix domain socket file was created by this server, rather than left by another instance
+    std::atomic<bool> mUnixSocketBound;
+#if OTBR_ENABLE_REST_TLS
+    // TLS configuration of the connections, socket connections are not accepted unless it is enabled when configured
+    TlsServer mTlsServer;
+#endif
 };
 
 } // namespace rest
@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/router.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+void Router::Add(const char *aPattern, HttpMethod aMethod, uint16_t aHandlerId)
+{
+    std::string pattern(aPattern);
+    Node *      node  = &mRoot;
+    size_t      start = 0;
+
+    while (start < pattern.size())
+    {
+        size_t      end = pattern.find('/', start + 1);
+        std::string segment;
+
+        if (end == std::string::npos)
+        {
+            end = pattern.size();
+        }
+
+        segment = pattern.substr(start + 1, end - start - 1);
+        start   = end;
+
+        if (segment.empty())
+        {
+            continue;
+        }
+
+        if (segment.size() > 2 && segment.front() == '{' && segment.back() == '}')
+        {
+            if (node->mParameter == nullptr)
+            {
+                node->mParameter.reset(new Node());
+                node->mParameterName = segment.substr(1, segment.size() - 2);
+            }
+
+            node = node->mParameter.get();
+        }
+        else
+        {
+            Node *child = nullptr;
+
+            for (auto &it : node->mChildren)
+            {
+                if (it.first == segment)
+                {
+                    child = it.second.get();
+                    break;
+                }
+            }
+
+            if (child == nullptr)
+            {
+                node->mChildren.emplace_back(segment, std::unique_ptr<Node>(new Node()));
+                child = node->mChildren.back().second.get();
+            }
+
+            node = child;
+        }
+    }
+
+    node->mHandlers.emplace_back(aMethod, aHandlerId);
+}
+
+HttpStatusCode Router::Match(const std::string &aPath,
+                             HttpMethod         aMethod,
+                             uint16_t &         aHandlerId,
+                             Parameters &       aParameters) const
+{
+    HttpStatusCode status = HttpStatusCode::kStatusResourceNotFound;
+    const Node *   node;
+
+    aParameters.clear();
+    node = Find(mRoot, aPath, 0, aParameters);
+    VerifyOrExit(node != nullptr);
+
+    status = HttpStatusCode::kStatusMethodNotAllowed;
+
+    for (const auto &handler : node->mHandlers)
+    {
+        if (handler.first == aMethod)
+        {
+            aHandlerId = handler.second;
+            ExitNow(status = HttpStatusCode::kStatusOk);
+        }
+    }
+
+exit:
+    return status;
+}
+
+const Router::Node *Router::Find(const Node &aNode, const std::string &aPath, size_t aOffset, Parameters &aParameters)
+{
+    const Node *found = nullptr;
+    size_t      start = aOffset + 1;
+    size_t      end;
+    size_t      length;
+
+    if (start >= aPath.size())
+    {
+        // All segments are consumed, only a node with handlers is a route.
+        ExitNow(found = aNode.mHandlers.empty() ? nullptr : &aNode);
+    }
+
+    end = aPath.find('/', start);
+    if (end == std::string::npos)
+    {
+        end = aPath.size();
+    }
+    length = end - start;
+
+    for (const auto &child : aNode.mChildren)
+    {
+        if (child.first.size() == length && aPath.compare(start, length, child.first) == 0)
+        {
+            found = Find(*child.second, aPath, end, aParameters);
+            break;
+        }
+    }
+
+    if (found == nullptr && aNode.mParameter != nullptr && length > 0)
+    {
+        aParameters.emplace_back(aNode.mParameterName, aPath.substr(start, length));
+        found = Find(*aNode.mParameter, aPath, end, aParameters);
+
+        if (found == nullptr)
+        {
+            aParameters.pop_back();
+        }
+    }
+
+exit:
+    return found;
+}
+
+} // namespace rest
+} // namespace otbr
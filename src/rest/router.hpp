@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the route table definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_ROUTER_HPP_
+#define OTBR_REST_ROUTER_HPP_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a route table dispatching request paths and methods to handler identifiers.
+ *
+ * Routes are stored in a trie of path segments, so a lookup only compares the segments of the requested path rather
+ * than hashing or scanning every route. A segment of a route pattern written as `{name}` matches any single segment of
+ * a path and captures it as a path parameter. Static segments take precedence over parameters.
+ *
+ */
+class Router
+{
+public:
+    /**
+     * This type represents the path parameters captured by a route, as pairs of name and value.
+     *
+     */
+    typedef std::vector<std::pair<std::string, std::string>> Parameters;
+
+    /**
+     * This method adds a route.
+     *
+     * @param[in]   aPattern    The path pattern of the route, e.g. "/diagnostics/{rloc16}".
+     * @param[in]   aMethod     The method of the route.
+     * @param[in]   aHandlerId  The identifier of the handler of the route.
+     *
+     */
+    void Add(const char *aPattern, HttpMethod aMethod, uint16_t aHandlerId);
+
+    /**
+     * This method looks up the route of a request.
+     *
+     * @param[in]   aPath        The request path, without the query string.
+     * @param[in]   aMethod      The request method.
+     * @param[out]  aHandlerId   The identifier of the handler of the matched route.
+     * @param[out]  aParameters  The path parameters captured by the matched route.
+     *
+     * @retval  kStatusOk                A route matched, @p aHandlerId and @p aParameters are set.
+     * @retval  kStatusResourceNotFound  No route matched the path.
+     * @retval  kStatusMethodNotAllowed  Routes matched the path, but none of them with the method.
+     *
+     */
+    HttpStatusCode Match(const std::string &aPath,
+                         HttpMethod         aMethod,
+                         uint16_t &         aHandlerId,
+                         Parameters &       aParameters) const;
+
+private:
+    struct Node
+    {
+        std::vector<std::pair<std::string, std::unique_ptr<Node>>> mChildren;      ///< Static segments.
+        std::unique_ptr<Node>                                      mParameter;     ///< The parameter segment.
+        std::string                                                mParameterName; ///< Name of the parameter.
+        std::vector<std::pair<HttpMethod, uint16_t>>               mHandlers;      ///< Handlers of this path.
+    };
+
+    static const Node *Find(const Node &aNode, const std::string &aPath, size_t aOffset, Parameters &aParameters);
+
+    Node mRoot;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ROUTER_HPP_
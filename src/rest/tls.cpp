@@ -0,0 +1,313 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements TLS of the RESTful HTTP server.
+ */
+
+#include "rest/tls.hpp"
+
+#include <errno.h>
+#include <sys/socket.h>
+
+#include <mbedtls/net_sockets.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Personalization of the random generator.
+static const unsigned char kDrbgPersonalization[] = "otbr-rest-tls";
+
+// Only forward secret AEAD suites authenticated by an ECDSA certificate, which are cheap on the gateway.
+static const int kCipherSuites[] = {
+    MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+    0,
+};
+
+TlsServer::TlsServer(void)
+    : mEnabled(false)
+{
+    InitContexts();
+}
+
+TlsServer::~TlsServer(void)
+{
+    FreeContexts();
+}
+
+void TlsServer::InitContexts(void)
+{
+    mbedtls_entropy_init(&mEntropy);
+    mbedtls_ctr_drbg_init(&mCtrDrbg);
+    mbedtls_x509_crt_init(&mCert);
+    mbedtls_pk_init(&mKey);
+    mbedtls_ssl_ticket_init(&mTicket);
+    mbedtls_ssl_cache_init(&mCache);
+    mbedtls_ssl_config_init(&mConfig);
+}
+
+void TlsServer::FreeContexts(void)
+{
+    mbedtls_ssl_config_free(&mConfig);
+    mbedtls_ssl_cache_free(&mCache);
+    mbedtls_ssl_ticket_free(&mTicket);
+    mbedtls_pk_free(&mKey);
+    mbedtls_x509_crt_free(&mCert);
+    mbedtls_ctr_drbg_free(&mCtrDrbg);
+    mbedtls_entropy_free(&mEntropy);
+}
+
+otbrError TlsServer::Init(const char *aCertFile, const char *aKeyFile)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    const char *step  = nullptr;
+    int         ret   = 0;
+
+    VerifyOrExit(!mEnabled);
+
+    // Start over from the contexts of a previous attempt.
+    FreeContexts();
+    InitContexts();
+
+    step = "seed";
+    SuccessOrExit(ret = mbedtls_ctr_drbg_seed(&mCtrDrbg, mbedtls_entropy_func, &mEntropy, kDrbgPersonalization,
+                                              sizeof(kDrbgPersonalization) - 1));
+    step = "certificate";
+    SuccessOrExit(ret = mbedtls_x509_crt_parse_file(&mCert, aCertFile));
+    step = "private key";
+    SuccessOrExit(ret = mbedtls_pk_parse_keyfile(&mKey, aKeyFile, nullptr));
+    step = "config";
+    SuccessOrExit(ret = mbedtls_ssl_config_defaults(&mConfig, MBEDTLS_SSL_IS_SERVER, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                                    MBEDTLS_SSL_PRESET_DEFAULT));
+    mbedtls_ssl_conf_rng(&mConfig, mbedtls_ctr_drbg_random, &mCtrDrbg);
+    mbedtls_ssl_conf_min_version(&mConfig, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+    mbedtls_ssl_conf_ciphersuites(&mConfig, kCipherSuites);
+    SuccessOrExit(ret = mbedtls_ssl_conf_own_cert(&mConfig, &mCert, &mKey));
+
+    // Monitoring clients reconnect often, resuming their sessions saves the handshake cost on both sides.
+    step = "session ticket";
+    SuccessOrExit(ret = mbedtls_ssl_ticket_setup(&mTicket, mbedtls_ctr_drbg_random, &mCtrDrbg,
+                                                 MBEDTLS_CIPHER_AES_128_GCM, OTBR_REST_TLS_TICKET_LIFETIME));
+    mbedtls_ssl_conf_session_tickets_cb(&mConfig, mbedtls_ssl_ticket_write, mbedtls_ssl_ticket_parse, &mTicket);
+    mbedtls_ssl_cache_set_max_entries(&mCache, OTBR_REST_TLS_SESSION_CACHE_SIZE);
+    mbedtls_ssl_cache_set_timeout(&mCache, OTBR_REST_TLS_SESSION_CACHE_TIMEOUT);
+    mbedtls_ssl_conf_session_cache(&mConfig, &mCache, mbedtls_ssl_cache_get, mbedtls_ssl_cache_set);
+
+    mEnabled = true;
+    otbrLog(OTBR_LOG_INFO, "REST server TLS enabled with certificate %s", aCertFile);
+
+exit:
+    if (!mEnabled)
+    {
+        error = OTBR_ERROR_REST;
+        otbrLog(OTBR_LOG_ERR, "REST server TLS %s error: -0x%04x", step, static_cast<unsigned int>(-ret));
+    }
+
+    return error;
+}
+
+TlsSession::TlsSession(const TlsServer &aServer)
+    : mFd(-1)
+    , mPendingLength(0)
+    , mSetUp(false)
+    , mWantsWrite(false)
+{
+    int ret;
+
+    mbedtls_ssl_init(&mSsl);
+
+    // The record buffers are allocated once for all the socket connections served by this session.
+    ret    = mbedtls_ssl_setup(&mSsl, &aServer.GetConfig());
+    mSetUp = (ret == 0);
+    if (!mSetUp)
+    {
+        otbrLog(OTBR_LOG_ERR, "REST server TLS session error: -0x%04x", static_cast<unsigned int>(-ret));
+    }
+}
+
+TlsSession::~TlsSession(void)
+{
+    mbedtls_ssl_free(&mSsl);
+}
+
+otbrError TlsSession::Reset(int aFd)
+{
+    mFd            = aFd;
+    mPendingLength = 0;
+    mWantsWrite    = false;
+
+    if (mSetUp)
+    {
+        mSetUp = (mbedtls_ssl_session_reset(&mSsl) == 0);
+        mbedtls_ssl_set_bio(&mSsl, this, &TlsSession::HandleSend, &TlsSession::HandleReceive, nullptr);
+    }
+
+    return mSetUp ? OTBR_ERROR_NONE : OTBR_ERROR_REST;
+}
+
+ssize_t TlsSession::Read(void *aBuffer, size_t aLength)
+{
+    ssize_t ret = -1;
+
+    VerifyOrExit(mSetUp, errno = EPROTO);
+    ret = CheckResult(mbedtls_ssl_read(&mSsl, static_cast<unsigned char *>(aBuffer), aLength));
+
+exit:
+    return ret;
+}
+
+ssize_t TlsSession::Writev(const struct iovec *aIov, int aIovCount)
+{
+    ssize_t written = 0;
+
+    VerifyOrExit(mSetUp, written = -1, errno = EPROTO);
+
+    for (int i = 0; i < aIovCount; i++)
+    {
+        const unsigned char *data   = static_cast<const unsigned char *>(aIov[i].iov_base);
+        size_t               offset = 0;
+
+        while (offset < aIov[i].iov_len)
+        {
+            size_t  length = aIov[i].iov_len - offset;
+            ssize_t ret;
+
+            // A record waiting for the socket is only completed when written again with the same length, mbedtls
+            // would otherwise report the data appended since then as written without sending it.
+            if (mPendingLength > 0)
+            {
+                VerifyOrExit(mPendingLength <= length, written = -1, errno = EPROTO);
+                length = mPendingLength;
+            }
+
+            ret            = CheckResult(mbedtls_ssl_write(&mSsl, data + offset, length));
+            mPendingLength = (ret < 0 && errno == EAGAIN) ? length : 0;
+
+            // Report what is written so far, the rest is written again once the socket is writable.
+            VerifyOrExit(ret > 0, written = (written > 0 ? written : -1));
+            offset += static_cast<size_t>(ret);
+            written += ret;
+        }
+    }
+
+exit:
+    return written;
+}
+
+void TlsSession::CloseNotify(void)
+{
+    if (mSetUp && mFd != -1)
+    {
+        // Best effort, the socket is closed right after.
+        mbedtls_ssl_close_notify(&mSsl);
+    }
+
+    mFd = -1;
+}
+
+size_t TlsSession::GetMemoryUsage(void) const
+{
+    return sizeof(*this) + (mSetUp ? MBEDTLS_SSL_IN_CONTENT_LEN + MBEDTLS_SSL_OUT_CONTENT_LEN : 0);
+}
+
+ssize_t TlsSession::CheckResult(int aResult)
+{
+    ssize_t ret = aResult;
+
+    mWantsWrite = (aResult == MBEDTLS_ERR_SSL_WANT_WRITE);
+
+    if (aResult == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY || aResult == MBEDTLS_ERR_SSL_CONN_EOF)
+    {
+        ret = 0;
+    }
+    else if (aResult == MBEDTLS_ERR_SSL_WANT_READ || aResult == MBEDTLS_ERR_SSL_WANT_WRITE)
+    {
+        ret   = -1;
+        errno = EAGAIN;
+    }
+    else if (aResult < 0)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "REST server TLS error: -0x%04x", static_cast<unsigned int>(-aResult));
+        ret   = -1;
+        errno = EPROTO;
+    }
+
+    return ret;
+}
+
+int TlsSession::HandleSend(void *aContext, const unsigned char *aBuffer, size_t aLength)
+{
+    TlsSession *session = static_cast<TlsSession *>(aContext);
+    ssize_t     ret;
+
+    do
+    {
+        ret = send(session->mFd, aBuffer, aLength, MSG_NOSIGNAL);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        ret = MBEDTLS_ERR_SSL_WANT_WRITE;
+    }
+    else if (ret < 0)
+    {
+        ret = (errno == EPIPE || errno == ECONNRESET) ? MBEDTLS_ERR_NET_CONN_RESET : MBEDTLS_ERR_NET_SEND_FAILED;
+    }
+
+    return static_cast<int>(ret);
+}
+
+int TlsSession::HandleReceive(void *aContext, unsigned char *aBuffer, size_t aLength)
+{
+    TlsSession *session = static_cast<TlsSession *>(aContext);
+    ssize_t     ret;
+
+    do
+    {
+        ret = recv(session->mFd, aBuffer, aLength, 0);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        ret = MBEDTLS_ERR_SSL_WANT_READ;
+    }
+    else if (ret < 0)
+    {
+        ret = (errno == ECONNRESET) ? MBEDTLS_ERR_NET_CONN_RESET : MBEDTLS_ERR_NET_RECV_FAILED;
+    }
+
+    return static_cast<int>(ret);
+}
+
+} // namespace rest
+} // namespace otbr
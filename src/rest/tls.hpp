@@ -0,0 +1,243 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for TLS of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_TLS_HPP_
+#define OTBR_REST_TLS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/pk.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/ssl_cache.h>
+#include <mbedtls/ssl_ticket.h>
+#include <mbedtls/x509_crt.h>
+
+#include "common/types.hpp"
+
+/**
+ * The lifetime in seconds of the session tickets, the ticket keys are rotated as often.
+ *
+ */
+#ifndef OTBR_REST_TLS_TICKET_LIFETIME
+#define OTBR_REST_TLS_TICKET_LIFETIME 86400
+#endif
+
+/**
+ * The maximum number of sessions cached for clients resuming by session id instead of ticket.
+ *
+ */
+#ifndef OTBR_REST_TLS_SESSION_CACHE_SIZE
+#define OTBR_REST_TLS_SESSION_CACHE_SIZE 32
+#endif
+
+/**
+ * The time in seconds a session is cached for resumption by session id.
+ *
+ */
+#ifndef OTBR_REST_TLS_SESSION_CACHE_TIMEOUT
+#define OTBR_REST_TLS_SESSION_CACHE_TIMEOUT 3600
+#endif
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements the TLS configuration shared by the connections of the REST server.
+ *
+ * Resumed sessions skip the key exchange and the signature of a full handshake, either by a session ticket sealed
+ * with a rotated key, or by a session id looked up in a small cache.
+ *
+ */
+class TlsServer
+{
+public:
+    /**
+     * The constructor initializes the TLS configuration, TLS is disabled until `Init()` succeeds.
+     *
+     */
+    TlsServer(void);
+
+    ~TlsServer(void);
+
+    TlsServer(const TlsServer &) = delete;
+    TlsServer &operator=(const TlsServer &) = delete;
+
+    /**
+     * This method loads the certificate and the private key, and sets up the configuration.
+     *
+     * @param[in]   aCertFile   The path of the PEM or DER certificate file, optionally followed by its chain.
+     * @param[in]   aKeyFile    The path of the PEM or DER private key file.
+     *
+     * Calling it again after a failure loads the files again.
+     *
+     * @retval  OTBR_ERROR_NONE     TLS is enabled.
+     * @retval  OTBR_ERROR_REST     Failed to load the files or to set up the configuration.
+     *
+     */
+    otbrError Init(const char *aCertFile, const char *aKeyFile);
+
+    /**
+     * This method indicates whether the connections are served over TLS.
+     *
+     * @retval  true    The connections are served over TLS.
+     * @retval  false   The connections are served in plaintext.
+     *
+     */
+    bool IsEnabled(void) const { return mEnabled; }
+
+    /**
+     * This method returns the configuration the sessions are set up with.
+     *
+     * @returns A reference to the configuration.
+     *
+     */
+    const mbedtls_ssl_config &GetConfig(void) const { return mConfig; }
+
+private:
+    void InitContexts(void);
+    void FreeContexts(void);
+
+    mbedtls_entropy_context    mEntropy;
+    mbedtls_ctr_drbg_context   mCtrDrbg;
+    mbedtls_x509_crt           mCert;
+    mbedtls_pk_context         mKey;
+    mbedtls_ssl_ticket_context mTicket;
+    mbedtls_ssl_cache_context  mCache;
+    mbedtls_ssl_config         mConfig;
+    bool                       mEnabled;
+};
+
+/**
+ * This class implements the TLS session of a socket connection.
+ *
+ * The handshake is driven by the first reads. Reads and writes fail with `EAGAIN` while the session waits for the
+ * socket, `WantsWrite()` then tells whether it waits for the socket to be writable rather than readable.
+ *
+ */
+class TlsSession
+{
+public:
+    /**
+     * The constructor sets up the session with the configuration of @p aServer.
+     *
+     * @param[in]   aServer     The TLS configuration, which must outlive the session.
+     *
+     */
+    explicit TlsSession(const TlsServer &aServer);
+
+    ~TlsSession(void);
+
+    TlsSession(const TlsSession &) = delete;
+    TlsSession &operator=(const TlsSession &) = delete;
+
+    /**
+     * This method resets the session in place for a new socket connection, keeping its record buffers.
+     *
+     * @param[in]   aFd     The file descriptor of the socket connection.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully reset the session.
+     * @retval  OTBR_ERROR_REST     The session is not set up, it may keep the state of the previous connection.
+     *
+     */
+    otbrError Reset(int aFd);
+
+    /**
+     * This method reads application data, like `read()`.
+     *
+     * @param[out]  aBuffer     A pointer to the buffer.
+     * @param[in]   aLength     The size of the buffer.
+     *
+     * @returns The number of bytes read, 0 if the client closed the session, -1 with `errno` set on failure.
+     *
+     */
+    ssize_t Read(void *aBuffer, size_t aLength);
+
+    /**
+     * This method writes application data, like `writev()`.
+     *
+     * After a failure with `EAGAIN`, the data not written must be written again as it was, more data may follow it.
+     *
+     * @param[in]   aIov        A pointer to the buffers.
+     * @param[in]   aIovCount   The number of buffers.
+     *
+     * @returns The number of bytes written, -1 with `errno` set on failure.
+     *
+     */
+    ssize_t Writev(const struct iovec *aIov, int aIovCount);
+
+    /**
+     * This method indicates whether the last read or write waits for the socket to be writable.
+     *
+     * @retval  true    The session waits for the socket to be writable.
+     * @retval  false   The session waits for the socket to be readable, or does not wait.
+     *
+     */
+    bool WantsWrite(void) const { return mWantsWrite; }
+
+    /**
+     * This method sends a close notification, without waiting for the socket.
+     *
+     */
+    void CloseNotify(void);
+
+    /**
+     * This method returns the memory held by the session, including its record buffers.
+     *
+     * @returns The number of bytes allocated.
+     *
+     */
+    size_t GetMemoryUsage(void) const;
+
+private:
+    static int HandleSend(void *aContext, const unsigned char *aBuffer, size_t aLength);
+    static int HandleReceive(void *aContext, unsigned char *aBuffer, size_t aLength);
+    ssize_t    CheckResult(int aResult);
+
+    mbedtls_ssl_context mSsl;
+    int                 mFd;
+    size_t              mPendingLength; // The length of the write waiting for the socket.
+    bool                mSetUp;
+    bool                mWantsWrite;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_TLS_HPP_
@@ -0,0 +1,189 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mesh topology of the RESTful HTTP server.
+ */
+
+#include "rest/topology.hpp"
+
+#include <algorithm>
+
+#include "rest/diag_store.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Maximum number of removed nodes kept for finding the changes since a version.
+static const size_t kMaxRemovedNodes = 64;
+
+static bool IsRloc16Less(const Topology::Node &aNode, uint16_t aRloc16)
+{
+    return aNode.mRloc16 < aRloc16;
+}
+
+static bool IsRouteEqual(const otNetworkDiagRouteData &aFirst, const otNetworkDiagRouteData &aSecond)
+{
+    return aFirst.mRouterId == aSecond.mRouterId && aFirst.mLinkQualityOut == aSecond.mLinkQualityOut &&
+           aFirst.mLinkQualityIn == aSecond.mLinkQualityIn && aFirst.mRouteCost == aSecond.mRouteCost;
+}
+
+static bool IsChildEqual(const otNetworkDiagChildEntry &aFirst, const otNetworkDiagChildEntry &aSecond)
+{
+    return aFirst.mChildId == aSecond.mChildId && aFirst.mTimeout == aSecond.mTimeout &&
+           aFirst.mMode.mRxOnWhenIdle == aSecond.mMode.mRxOnWhenIdle &&
+           aFirst.mMode.mDeviceType == aSecond.mMode.mDeviceType &&
+           aFirst.mMode.mNetworkData == aSecond.mMode.mNetworkData;
+}
+
+Topology::Topology(void)
+    : mVersion(0)
+    , mPrunedVersion(0)
+{
+}
+
+Topology::Node *Topology::FindNode(uint16_t aRloc16)
+{
+    auto it = std::lower_bound(mNodes.begin(), mNodes.end(), aRloc16, IsRloc16Less);
+
+    return (it != mNodes.end() && it->mRloc16 == aRloc16) ? &*it : nullptr;
+}
+
+bool Topology::Update(const DiagInfo &aInfo)
+{
+    std::vector<otNetworkDiagRouteData>  routes;
+    std::vector<otNetworkDiagChildEntry> children;
+    otNetworkDiagTlv                     tlv;
+    size_t                               offset   = 0;
+    bool                                 hasRoute = false;
+    bool                                 hasChild = false;
+    bool                                 changed  = false;
+    Node *                               node     = FindNode(aInfo.mRloc16);
+
+    while (DiagStore::GetNextTlv(aInfo, offset, tlv))
+    {
+        if (tlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_ROUTE)
+        {
+            routes.assign(tlv.mData.mRoute.mRouteData, tlv.mData.mRoute.mRouteData + tlv.mData.mRoute.mRouteCount);
+            hasRoute = true;
+        }
+        else if (tlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE)
+        {
+            children.assign(tlv.mData.mChildTable.mTable, tlv.mData.mChildTable.mTable + tlv.mData.mChildTable.mCount);
+            hasChild = true;
+        }
+    }
+
+    if (node == nullptr)
+    {
+        auto it = std::lower_bound(mNodes.begin(), mNodes.end(), aInfo.mRloc16, IsRloc16Less);
+
+        node           = &*mNodes.insert(it, Node());
+        node->mRloc16  = aInfo.mRloc16;
+        node->mRemoved = false;
+        changed        = true;
+    }
+    else if (node->mRemoved)
+    {
+        node->mRemoved = false;
+        changed        = true;
+    }
+
+    // A filtered query may not answer the route and the child table, keep those known.
+    if (hasRoute && (routes.size() != node->mRoutes.size() ||
+                     !std::equal(routes.begin(), routes.end(), node->mRoutes.begin(), IsRouteEqual)))
+    {
+        node->mRoutes.swap(routes);
+        changed = true;
+    }
+
+    if (hasChild && (children.size() != node->mChildren.size() ||
+                     !std::equal(children.begin(), children.end(), node->mChildren.begin(), IsChildEqual)))
+    {
+        node->mChildren.swap(children);
+        changed = true;
+    }
+
+    if (changed)
+    {
+        node->mVersion = ++mVersion;
+    }
+
+    return changed;
+}
+
+bool Topology::Remove(uint16_t aRloc16)
+{
+    bool  changed = false;
+    Node *node    = FindNode(aRloc16);
+
+    if (node != nullptr && !node->mRemoved)
+    {
+        node->mRemoved = true;
+        node->mVersion = ++mVersion;
+        node->mRoutes.clear();
+        node->mChildren.clear();
+        PruneRemovedNodes();
+        changed = true;
+    }
+
+    return changed;
+}
+
+bool Topology::HasChangesSince(uint32_t aVersion) const
+{
+    return aVersion >= mPrunedVersion && aVersion <= mVersion;
+}
+
+void Topology::PruneRemovedNodes(void)
+{
+    size_t removed = static_cast<size_t>(
+        std::count_if(mNodes.begin(), mNodes.end(), [](const Node &aNode) { return aNode.mRemoved; }));
+
+    while (removed > kMaxRemovedNodes)
+    {
+        auto oldest = mNodes.end();
+
+        for (auto it = mNodes.begin(); it != mNodes.end(); ++it)
+        {
+            if (it->mRemoved && (oldest == mNodes.end() || it->mVersion < oldest->mVersion))
+            {
+                oldest = it;
+            }
+        }
+
+        // The removal of the node is forgotten, changes since an earlier version are no longer known.
+        mPrunedVersion = std::max(mPrunedVersion, oldest->mVersion);
+        mNodes.erase(oldest);
+        removed--;
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,145 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the mesh topology of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_TOPOLOGY_HPP_
+#define OTBR_REST_TOPOLOGY_HPP_
+
+#include <vector>
+
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class maintains the topology of the Thread network, i.e. the routes of each router and its children, derived
+ * from the diagnostics of the nodes.
+ *
+ * Each change bumps the version of the topology and is recorded in the changed node, so the nodes changed since a
+ * version could be found. Removed nodes are kept for a while, so that their removal is found as well.
+ *
+ */
+class Topology
+{
+public:
+    /**
+     * This structure represents a node of the topology.
+     *
+     */
+    struct Node
+    {
+        uint16_t                             mRloc16;   ///< The RLOC16 of the node.
+        uint32_t                             mVersion;  ///< The version of the topology the node last changed at.
+        bool                                 mRemoved;  ///< Whether the node has left the topology.
+        std::vector<otNetworkDiagRouteData>  mRoutes;   ///< The route data, for a router.
+        std::vector<otNetworkDiagChildEntry> mChildren; ///< The child table, for a router.
+    };
+
+    typedef std::vector<Node>::const_iterator ConstIterator;
+
+    /**
+     * The constructor initializes an empty topology.
+     *
+     */
+    Topology(void);
+
+    /**
+     * This method updates a node from its diagnostics.
+     *
+     * @param[in]   aInfo   The diagnostics of the node.
+     *
+     * @retval  true    The topology changed.
+     * @retval  false   The topology did not change.
+     *
+     */
+    bool Update(const DiagInfo &aInfo);
+
+    /**
+     * This method removes a node.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     *
+     * @retval  true    The topology changed.
+     * @retval  false   The topology did not change.
+     *
+     */
+    bool Remove(uint16_t aRloc16);
+
+    /**
+     * This method returns the version of the topology.
+     *
+     * @returns The version, which starts at 0 and is bumped by each change.
+     *
+     */
+    uint32_t GetVersion(void) const { return mVersion; }
+
+    /**
+     * This method indicates whether all changes since a version are known, including the removed nodes.
+     *
+     * @param[in]   aVersion    The version.
+     *
+     * @retval  true    The changes since the version are known.
+     * @retval  false   The version is too old or unknown, a full snapshot is needed.
+     *
+     */
+    bool HasChangesSince(uint32_t aVersion) const;
+
+    /**
+     * This method returns an iterator to the node with the lowest RLOC16, including removed nodes.
+     *
+     */
+    ConstIterator begin(void) const { return mNodes.begin(); }
+
+    /**
+     * This method returns an iterator past the last node.
+     *
+     */
+    ConstIterator end(void) const { return mNodes.end(); }
+
+private:
+    Node *FindNode(uint16_t aRloc16);
+    void  PruneRemovedNodes(void);
+
+    std::vector<Node> mNodes;
+    uint32_t          mVersion;
+    uint32_t          mPrunedVersion;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_TOPOLOGY_HPP_
@@ -58,11 +58,17 @@ enum class HttpMethod : std::uint8_t
 
 enum class HttpStatusCode : std::uint16_t
 {
-    kStatusOk                  = 200,
-    kStatusResourceNotFound    = 404,
-    kStatusMethodNotAllowed    = 405,
-    kStatusRequestTimeout      = 408,
-    kStatusInternalServerError = 500,
+    kStatusOk                          = 200,
+    kStatusNotModified                 = 304,
+    kStatusBadRequest                  = 400,
+    kStatusResourceNotFound            = 404,
+    kStatusMethodNotAllowed            = 405,
+    kStatusRequestTimeout              = 408,
+    kStatusPayloadTooLarge             = 413,
+    kStatusTooManyRequests             = 429,
+    kStatusRequestHeaderFieldsTooLarge = 431,
+    kStatusInternalServerError         = 500,
+    kStatusServiceUnavailable          = 503,
 };
 
 enum class PostError : std::uint8_t
@@ -82,6 +88,8 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kStreaming     = 8, ///< Push events to the client
+    kRenderWait    = 9, ///< Wait for a worker thread to render the response body
 
 };
 struct NodeInfo
@@ -96,10 +104,30 @@ struct NodeInfo
     std::string    mNetworkName;
 };
 
+// Number of TLV types in a TLV mask.
+static constexpr uint8_t kNumMaskTypes = 32;
+
 struct DiagInfo
 {
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
+    steady_clock::time_point mStartTime;              ///< The time of the latest response.
+    std::vector<uint8_t>     mDiagContent;            ///< The TLVs received, packed by `DiagStore`.
+    uint32_t                 mTlvMask;                ///< Bit mask of the TLV types queried, by their type numbers.
+    uint32_t                 mTlvAges[kNumMaskTypes]; ///< Milliseconds each type was answered before `mStartTime`.
+    uint16_t                 mRloc16;
+};
+
+struct MeshCounters
+{
+    uint64_t mIfInUnknownProtos;  ///< The sum of the `mIfInUnknownProtos` MAC counters of the nodes.
+    uint64_t mIfInErrors;         ///< The sum of the `mIfInErrors` MAC counters of the nodes.
+    uint64_t mIfOutErrors;        ///< The sum of the `mIfOutErrors` MAC counters of the nodes.
+    uint64_t mIfInUcastPkts;      ///< The sum of the `mIfInUcastPkts` MAC counters of the nodes.
+    uint64_t mIfInBroadcastPkts;  ///< The sum of the `mIfInBroadcastPkts` MAC counters of the nodes.
+    uint64_t mIfInDiscards;       ///< The sum of the `mIfInDiscards` MAC counters of the nodes.
+    uint64_t mIfOutUcastPkts;     ///< The sum of the `mIfOutUcastPkts` MAC counters of the nodes.
+    uint64_t mIfOutBroadcastPkts; ///< The sum of the `mIfOutBroadcastPkts` MAC counters of the nodes.
+    uint64_t mIfOutDiscards;      ///< The sum of the `mIfOutDiscards` MAC counters of the nodes.
+    uint32_t mNumNodes;           ///< The number of nodes whose MAC counters are summed.
 };
 
 } // namespace rest
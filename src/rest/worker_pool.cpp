@@ -0,0 +1,234 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the worker thread pool of the RESTful HTTP server.
+ */
+
+#include "rest/worker_pool.hpp"
+
+#include <cerrno>
+
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace rest {
+
+WorkerPool &WorkerPool::Get(void)
+{
+    static WorkerPool sWorkerPool;
+
+    return sWorkerPool;
+}
+
+WorkerPool::WorkerPool(void)
+    : mStopping(false)
+    , mDoneJobs(nullptr)
+    , mDoneEventFd(-1)
+{
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+    }
+    mCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+
+    for (Job *job : mPendingJobs)
+    {
+        delete job;
+    }
+
+    for (Job *job = mDoneJobs.exchange(nullptr); job != nullptr;)
+    {
+        Job *next = job->mNext;
+
+        delete job;
+        job = next;
+    }
+
+    // The event poller may already be destroyed at exit, the eventfd is only closed.
+    if (mDoneEventFd != -1)
+    {
+        close(mDoneEventFd);
+    }
+}
+
+otbrError WorkerPool::Init(uint32_t aThreadNum)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aThreadNum > 0 && mThreads.empty());
+
+    mDoneEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mDoneEventFd != -1, error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = EventPoller::Get().Register(mDoneEventFd, EventPoller::kEventReadable,
+                                                      &WorkerPool::HandleDoneEvent, this, EventPoller::kPriorityLow));
+
+    for (uint32_t index = 0; index < aThreadNum; index++)
+    {
+        mThreads.emplace_back(&WorkerPool::Run, this);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "rest worker pool init error: %s", strerror(errno));
+
+        if (mDoneEventFd != -1)
+        {
+            close(mDoneEventFd);
+            mDoneEventFd = -1;
+        }
+    }
+
+    return error;
+}
+
+void WorkerPool::Post(Task aWork, Task aDone, size_t aBatchSize)
+{
+    Job *job;
+
+    if (!IsWorthPosting(aBatchSize))
+    {
+        aWork();
+        aDone();
+        ExitNow();
+    }
+
+    job = new Job{std::move(aWork), std::move(aDone), nullptr};
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mPendingJobs.push_back(job);
+    }
+    mCondition.notify_one();
+
+exit:
+    return;
+}
+
+void WorkerPool::Run(void)
+{
+    while (true)
+    {
+        Job *    job;
+        Job *    head;
+        uint64_t wakeup = 1;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondition.wait(lock, [this] { return mStopping || !mPendingJobs.empty(); });
+            if (mStopping)
+            {
+                break;
+            }
+
+            job = mPendingJobs.front();
+            mPendingJobs.pop_front();
+        }
+
+        job->mWork();
+
+        // Publish the done job, the release ordering makes the results of the work visible to the mainloop.
+        head = mDoneJobs.load(std::memory_order_relaxed);
+        do
+        {
+            job->mNext = head;
+        } while (!mDoneJobs.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+
+        // The mainloop takes all done jobs at once, only the first job after that needs to wake it up.
+        if (head == nullptr && write(mDoneEventFd, &wakeup, sizeof(wakeup)) != sizeof(wakeup))
+        {
+            otbrLog(OTBR_LOG_WARNING, "rest worker pool wakeup error: %s", strerror(errno));
+        }
+    }
+}
+
+void WorkerPool::HandleDoneEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+
+    static_cast<WorkerPool *>(aContext)->HandleDoneEvent();
+}
+
+void WorkerPool::HandleDoneEvent(void)
+{
+    uint64_t count;
+    Job *    job;
+    Job *    ordered = nullptr;
+
+    // Clear the eventfd before taking the jobs, a job pushed afterwards always wakes up the mainloop again.
+    if (read(mDoneEventFd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+    {
+        otbrLog(OTBR_LOG_WARNING, "rest worker pool read error: %s", strerror(errno));
+    }
+
+    job = mDoneJobs.exchange(nullptr, std::memory_order_acquire);
+
+    // The stack holds the latest job first, complete the jobs in the order they were done.
+    while (job != nullptr)
+    {
+        Job *next = job->mNext;
+
+        job->mNext = ordered;
+        ordered    = job;
+        job        = next;
+    }
+
+    while (ordered != nullptr)
+    {
+        Job *next = ordered->mNext;
+
+        ordered->mDone();
+        delete ordered;
+        ordered = next;
+    }
+}
+
+} // namespace rest
+} // namespace otbr
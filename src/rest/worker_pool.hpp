@@ -0,0 +1,166 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the worker thread pool of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_WORKER_POOL_HPP_
+#define OTBR_REST_WORKER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/types.hpp"
+
+/**
+ * The number of worker threads rendering and compressing response bodies, 0 does all the work on the mainloop.
+ *
+ */
+#ifndef OTBR_REST_WORKER_THREADS
+#define OTBR_REST_WORKER_THREADS 0
+#endif
+
+/**
+ * The smallest number of items, e.g. diagnostic entries, a job must process to be posted to a worker thread. Smaller
+ * jobs are done inline on the mainloop, which costs less than waking up a worker thread and then the mainloop.
+ *
+ */
+#ifndef OTBR_REST_WORKER_MIN_BATCH
+#define OTBR_REST_WORKER_MIN_BATCH 8
+#endif
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a pool of worker threads for CPU bound work that does not touch OpenThread.
+ *
+ * Jobs are posted from the mainloop. The work of a job runs on a worker thread, then its completion is handed back
+ * through a lock-free queue and runs on the mainloop, woken up by an eventfd. Anything that calls the OpenThread API
+ * or accesses state shared with the mainloop belongs to the completion.
+ *
+ */
+class WorkerPool
+{
+public:
+    typedef std::function<void(void)> Task;
+
+    /**
+     * This method returns the singleton worker pool.
+     *
+     * @returns A reference to the worker pool.
+     *
+     */
+    static WorkerPool &Get(void);
+
+    /**
+     * This method starts the worker threads.
+     *
+     * @param[in]   aThreadNum  The number of worker threads, 0 leaves the pool disabled.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully started the worker threads.
+     * @retval  OTBR_ERROR_ERRNO    Failed to create the eventfd waking up the mainloop.
+     *
+     */
+    otbrError Init(uint32_t aThreadNum);
+
+    /**
+     * This method indicates whether there are worker threads to post jobs to.
+     *
+     * @retval  true     Jobs run on worker threads.
+     * @retval  false    The pool is disabled.
+     *
+     */
+    bool IsEnabled(void) const { return !mThreads.empty(); }
+
+    /**
+     * This method indicates whether a job processing a number of items is posted to a worker thread.
+     *
+     * @param[in]   aBatchSize  The number of items processed by the job.
+     *
+     * @retval  true     The pool is enabled and @p aBatchSize is at least OTBR_REST_WORKER_MIN_BATCH.
+     * @retval  false    The job is done inline.
+     *
+     */
+    bool IsWorthPosting(size_t aBatchSize) const { return IsEnabled() && aBatchSize >= OTBR_REST_WORKER_MIN_BATCH; }
+
+    /**
+     * This method posts a job, it must be called on the mainloop.
+     *
+     * A job not worth posting, see `IsWorthPosting()`, is done inline: @p aWork then @p aDone run before this method
+     * returns.
+     *
+     * @param[in]   aWork       The work done on a worker thread.
+     * @param[in]   aDone       The completion run on the mainloop after @p aWork is done.
+     * @param[in]   aBatchSize  The number of items processed by the job.
+     *
+     */
+    void Post(Task aWork, Task aDone, size_t aBatchSize = OTBR_REST_WORKER_MIN_BATCH);
+
+    ~WorkerPool(void);
+
+private:
+    struct Job
+    {
+        Task mWork;
+        Task mDone;
+        Job *mNext;
+    };
+
+    WorkerPool(void);
+
+    static void HandleDoneEvent(void *aContext, int aFd, uint32_t aEvents);
+    void        HandleDoneEvent(void);
+    void        Run(void);
+
+    std::vector<std::thread> mThreads;
+
+    // Jobs waiting for a worker thread.
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+    std::deque<Job *>       mPendingJobs;
+    bool                    mStopping;
+
+    // Lock-free stack of done jobs, pushed by worker threads and taken as a whole by the mainloop.
+    std::atomic<Job *> mDoneJobs;
+    int                mDoneEventFd;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_WORKER_POOL_HPP_
@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements building the active operational dataset of a new network.
+ */
+
+#include "utils/active_dataset.hpp"
+
+#include <random>
+
+#include <openthread/dataset.h>
+
+#include "common/code_utils.hpp"
+#include "common/tlv.hpp"
+#include "utils/hex.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+otbrError BuildActiveDataset(const std::string &   aMasterKey,
+                             const std::string &   aNetworkName,
+                             uint16_t              aChannel,
+                             uint64_t              aExtPanId,
+                             uint16_t              aPanId,
+                             const uint8_t *       aPskc,
+                             std::vector<uint8_t> &aDatasetTlvs)
+{
+    static const uint8_t kActiveTimestamp[] = {0, 0, 0, 0, 0, 1, 0, 0};
+    static const uint8_t kSecurityPolicy[]  = {0x02, 0xa0, 0xff};
+    static const uint8_t kChannelMask[]     = {0, 4, 0x00, 0x1f, 0xff, 0xe0};
+
+    uint8_t                                 buffer[OT_OPERATIONAL_DATASET_MAX_LENGTH];
+    TlvWriter                               writer(buffer, sizeof(buffer));
+    uint8_t                                 masterKey[OT_MASTER_KEY_SIZE];
+    uint8_t                                 extPanId[OT_EXT_PAN_ID_SIZE];
+    uint8_t                                 meshLocalPrefix[OT_MESH_LOCAL_PREFIX_SIZE];
+    uint8_t                                 channel[3];
+    std::random_device                      randomDevice;
+    std::uniform_int_distribution<uint16_t> dist(0, UINT8_MAX);
+    otbrError                               error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(Hex2Bytes(aMasterKey.c_str(), masterKey, sizeof(masterKey)) == static_cast<int>(sizeof(masterKey)),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aNetworkName.size() <= OT_NETWORK_NAME_MAX_SIZE, error = OTBR_ERROR_INVALID_ARGS);
+
+    // Channel page 0, then the channel.
+    channel[0] = 0;
+    channel[1] = static_cast<uint8_t>(aChannel >> 8);
+    channel[2] = static_cast<uint8_t>(aChannel & 0xff);
+
+    for (size_t i = 0; i < sizeof(extPanId); i++)
+    {
+        extPanId[i] = static_cast<uint8_t>(aExtPanId >> (8 * (sizeof(extPanId) - 1 - i)));
+    }
+
+    // A random unique local prefix, as OpenThread generates for a new network.
+    meshLocalPrefix[0] = 0xfd;
+    for (size_t i = 1; i < sizeof(meshLocalPrefix); i++)
+    {
+        meshLocalPrefix[i] = static_cast<uint8_t>(dist(randomDevice));
+    }
+
+    writer.Append(Meshcop::kActiveTimestamp, kActiveTimestamp, sizeof(kActiveTimestamp));
+    writer.Append(Meshcop::kChannel, channel, sizeof(channel));
+    writer.Append(Meshcop::kChannelMask, kChannelMask, sizeof(kChannelMask));
+    writer.Append(Meshcop::kExtendedPanId, extPanId, sizeof(extPanId));
+    writer.Append(Meshcop::kMeshLocalPrefix, meshLocalPrefix, sizeof(meshLocalPrefix));
+    writer.Append(Meshcop::kMasterKey, masterKey, sizeof(masterKey));
+    writer.Append(Meshcop::kNetworkName, aNetworkName.data(), static_cast<uint16_t>(aNetworkName.size()));
+    writer.Append(Meshcop::kPanId, aPanId);
+    writer.Append(Meshcop::kPskc, aPskc, OT_PSKC_MAX_SIZE);
+    writer.Append(Meshcop::kSecurityPolicy, kSecurityPolicy, sizeof(kSecurityPolicy));
+    VerifyOrExit(!writer.IsOverflowed(), error = OTBR_ERROR_INVALID_ARGS);
+
+    aDatasetTlvs.assign(buffer, buffer + writer.GetLength());
+
+exit:
+    return error;
+}
+
+} // namespace Utils
+
+} // namespace otbr
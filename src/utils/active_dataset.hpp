@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for building the active operational dataset of a new network.
+ */
+
+#ifndef OTBR_UTILS_ACTIVE_DATASET_HPP_
+#define OTBR_UTILS_ACTIVE_DATASET_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This function builds the TLVs of the active operational dataset of a new network.
+ *
+ * The TLVs are those `dataset init new` would set, with the timestamp of a new network, the defaults of OpenThread
+ * and a random mesh local prefix.
+ *
+ * @param[in]   aMasterKey      The master key, in hex.
+ * @param[in]   aNetworkName    The network name.
+ * @param[in]   aChannel        The channel, on channel page 0.
+ * @param[in]   aExtPanId       The extended PAN ID.
+ * @param[in]   aPanId          The PAN ID.
+ * @param[in]   aPskc           The PSKc, of `OT_PSKC_MAX_SIZE` bytes.
+ * @param[out]  aDatasetTlvs    The TLVs of the dataset.
+ *
+ * @retval  OTBR_ERROR_NONE         The dataset is built.
+ * @retval  OTBR_ERROR_INVALID_ARGS The master key or the network name is invalid.
+ *
+ */
+otbrError BuildActiveDataset(const std::string &   aMasterKey,
+                             const std::string &   aNetworkName,
+                             uint16_t              aChannel,
+                             uint64_t              aExtPanId,
+                             uint16_t              aPanId,
+                             const uint8_t *       aPskc,
+                             std::vector<uint8_t> &aDatasetTlvs);
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_ACTIVE_DATASET_HPP_
@@ -36,29 +36,64 @@
 namespace otbr {
 
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTables(GetTables(aPolynomial))
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+const Crc16::Tables &Crc16::GetTables(Polynomial aPolynomial)
 {
-    uint8_t i;
+    struct PolynomialTables
+    {
+        explicit PolynomialTables(uint16_t aPolynomial) { InitTables(aPolynomial, mTables); }
+
+        Tables mTables;
+    };
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    static const PolynomialTables sCcitt(kCcitt);
+    static const PolynomialTables sAnsi(kAnsi);
+
+    return (aPolynomial == kCcitt ? sCcitt : sAnsi).mTables;
+}
 
-    do
+void Crc16::InitTables(uint16_t aPolynomial, Tables &aTables)
+{
+    for (uint16_t byte = 0; byte < 256; byte++)
     {
-        if (mCrc & 0x8000)
+        uint16_t crc = static_cast<uint16_t>(byte << 8);
+
+        for (uint8_t i = 0; i < 8; i++)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
+            crc = (crc & 0x8000) ? (static_cast<uint16_t>(crc << 1) ^ aPolynomial) : static_cast<uint16_t>(crc << 1);
         }
-        else
+
+        aTables[0][byte] = crc;
+    }
+
+    // Entry k of table i is the CRC of byte k followed by i zero bytes.
+    for (uint16_t byte = 0; byte < 256; byte++)
+    {
+        for (uint8_t i = 1; i < 4; i++)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
+            uint16_t crc = aTables[i - 1][byte];
+
+            aTables[i][byte] = static_cast<uint16_t>(crc << 8) ^ aTables[0][crc >> 8];
         }
-    } while (--i);
+    }
+}
+
+void Crc16::Update(const uint8_t *aBuffer, size_t aLength)
+{
+    for (; aLength >= 4; aBuffer += 4, aLength -= 4)
+    {
+        mCrc = mTables[3][(mCrc >> 8) ^ aBuffer[0]] ^ mTables[2][(mCrc & 0xff) ^ aBuffer[1]] ^ mTables[1][aBuffer[2]] ^
+               mTables[0][aBuffer[3]];
+    }
+
+    for (; aLength > 0; aBuffer++, aLength--)
+    {
+        Update(*aBuffer);
+    }
 }
 
 } // namespace otbr
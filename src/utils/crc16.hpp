@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -73,7 +74,16 @@ public:
      * @param[in]  aByte  The byte value.
      *
      */
-    void Update(uint8_t aByte);
+    void Update(uint8_t aByte) { mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTables[0][(mCrc >> 8) ^ aByte]; }
+
+    /**
+     * This method feeds bytes into the CRC16 computation, four bytes at a time.
+     *
+     * @param[in]  aBuffer  A pointer to the bytes.
+     * @param[in]  aLength  The number of bytes.
+     *
+     */
+    void Update(const uint8_t *aBuffer, size_t aLength);
 
     /**
      * This method gets the current CRC16 value.
@@ -84,8 +94,13 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    typedef uint16_t Tables[4][256];
+
+    static const Tables &GetTables(Polynomial aPolynomial);
+    static void          InitTables(uint16_t aPolynomial, Tables &aTables);
+
+    const Tables &mTables;
+    uint16_t      mCrc;
 };
 
 } // namespace otbr
@@ -0,0 +1,82 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements matching the entity tags of HTTP responses.
+ */
+
+#include "utils/etag.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+bool IsETagMatched(const std::string &aIfNoneMatch, const std::string &aETag)
+{
+    bool   matched = false;
+    size_t start   = 0;
+
+    while (!matched && start < aIfNoneMatch.size())
+    {
+        size_t end;
+
+        start = aIfNoneMatch.find_first_not_of(", \t", start);
+        VerifyOrExit(start != std::string::npos);
+
+        if (aIfNoneMatch.compare(start, 2, "W/") == 0)
+        {
+            start += 2;
+        }
+
+        if (aIfNoneMatch[start] == '"')
+        {
+            // A quoted tag may contain commas.
+            end = aIfNoneMatch.find('"', start + 1);
+            end = (end == std::string::npos) ? aIfNoneMatch.size() : end + 1;
+        }
+        else
+        {
+            end = aIfNoneMatch.find_first_of(", \t", start);
+            end = (end == std::string::npos) ? aIfNoneMatch.size() : end;
+        }
+
+        matched = aIfNoneMatch.compare(start, end - start, "*") == 0 ||
+                  aIfNoneMatch.compare(start, end - start, aETag) == 0;
+        start   = end;
+    }
+
+exit:
+    return matched;
+}
+
+} // namespace Utils
+
+} // namespace otbr
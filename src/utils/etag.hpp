@@ -0,0 +1,62 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for matching the entity tags of HTTP responses.
+ */
+
+#ifndef OTBR_UTILS_ETAG_HPP_
+#define OTBR_UTILS_ETAG_HPP_
+
+#include <string>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This function indicates whether an If-None-Match header value matches an entity tag.
+ *
+ * The header value is "*" or a comma-separated list of entity tags, each compared with the weak comparison: a `W/`
+ * prefix is ignored and the tags must otherwise be equal.
+ *
+ * @param[in]  aIfNoneMatch  The value of the If-None-Match header.
+ * @param[in]  aETag         The entity tag of the response, including its quotes.
+ *
+ * @retval  true     The header matches the entity tag.
+ * @retval  false    The header does not match the entity tag.
+ *
+ */
+bool IsETagMatched(const std::string &aIfNoneMatch, const std::string &aETag);
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_ETAG_HPP_
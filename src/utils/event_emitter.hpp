@@ -33,8 +33,25 @@
 
 #include <list>
 #include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/fixed_containers.hpp"
+#include "common/logging.hpp"
+
+/**
+ * The maximum number of handlers of each event, when built with containers of a fixed capacity.
+ *
+ */
+#ifndef OTBR_EVENT_MAX_HANDLERS
+#define OTBR_EVENT_MAX_HANDLERS 8
+#endif
 
 namespace otbr {
 
@@ -90,6 +107,145 @@ private:
     Events                              mEvents;
 };
 
+/**
+ * This class template holds the handlers of an event whose arguments are the parameters of @p Signature.
+ *
+ */
+template <typename Signature> class EventHandlers;
+
+template <typename... Args> class EventHandlers<void(Args...)>
+{
+public:
+    /**
+     * This function pointer will be called when the event is emitted.
+     *
+     * @param[in]   aContext    A pointer to application-specific context.
+     * @param[in]   aArgs       The arguments of the event.
+     *
+     */
+    typedef void (*Callback)(void *aContext, Args... aArgs);
+
+    /**
+     * This method registers a handler.
+     *
+     * @param[in]   aCallback   The function poiner to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    void On(Callback aCallback, void *aContext)
+    {
+#if OTBR_ENABLE_FIXED_CONTAINERS
+        VerifyOrDie(!mHandlers.full(), "too many event handlers, raise OTBR_EVENT_MAX_HANDLERS");
+#endif
+        mHandlers.emplace_back(aCallback, aContext);
+    }
+
+    /**
+     * This method deregisters a handler.
+     *
+     * @param[in]   aCallback   The function poiner to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    void Off(Callback aCallback, void *aContext)
+    {
+        for (auto it = mHandlers.begin(); it != mHandlers.end(); ++it)
+        {
+            if (it->first == aCallback && it->second == aContext)
+            {
+                mHandlers.erase(it);
+                break;
+            }
+        }
+    }
+
+    /**
+     * This method calls the handlers in the order they were registered.
+     *
+     * @param[in]   aArgs   The arguments of the event.
+     *
+     */
+    void Emit(Args... aArgs) const
+    {
+        // Indexed as handlers may register handlers.
+        for (size_t i = 0; i < mHandlers.size(); i++)
+        {
+            Handler handler = mHandlers[i];
+
+            handler.first(handler.second, aArgs...);
+        }
+    }
+
+private:
+    typedef std::pair<Callback, void *> Handler;
+
+#if OTBR_ENABLE_FIXED_CONTAINERS
+    FixedVector<Handler, OTBR_EVENT_MAX_HANDLERS> mHandlers;
+#else
+    std::vector<Handler> mHandlers;
+#endif
+};
+
+/**
+ * This class template implements an event emitter of a fixed set of events.
+ *
+ * The events are the indices of @p Events, each a function type whose parameters are the arguments of the event.
+ * Registering and emitting are checked against these types at compile time, and emitting calls the handlers of the
+ * event without looking it up.
+ *
+ */
+template <typename... Events> class TypedEventEmitter
+{
+    typedef std::tuple<EventHandlers<Events>...> Handlers;
+
+public:
+    /**
+     * The callback type of event @p kEvent.
+     *
+     */
+    template <size_t kEvent> using Callback = typename std::tuple_element<kEvent, Handlers>::type::Callback;
+
+    static constexpr size_t kNumEvents = sizeof...(Events); ///< The number of events.
+
+    /**
+     * This method registers an event handler for @p kEvent.
+     *
+     * @param[in]   aCallback   The function poiner to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    template <size_t kEvent> void On(Callback<kEvent> aCallback, void *aContext)
+    {
+        std::get<kEvent>(mHandlers).On(aCallback, aContext);
+    }
+
+    /**
+     * This method deregisters an event handler for @p kEvent.
+     *
+     * @param[in]   aCallback   The function poiner to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    template <size_t kEvent> void Off(Callback<kEvent> aCallback, void *aContext)
+    {
+        std::get<kEvent>(mHandlers).Off(aCallback, aContext);
+    }
+
+    /**
+     * This method emits @p kEvent.
+     *
+     * @param[in]   aValues     The arguments of the event.
+     *
+     */
+    template <size_t kEvent, typename... Values> void Emit(Values &&... aValues) const
+    {
+        std::get<kEvent>(mHandlers).Emit(std::forward<Values>(aValues)...);
+    }
+
+private:
+    Handlers mHandlers;
+};
+
 } // namespace otbr
 
 #endif // OTBR_COMMON_EVENT_EMITTER_HPP_
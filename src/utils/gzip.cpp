@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements gzip compression of HTTP bodies.
+ */
+
+#include "utils/gzip.hpp"
+
+#include <stdlib.h>
+#include <strings.h>
+
+#include <zlib.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+enum
+{
+    kGzipWindowBits = 15 + 16, ///< The maximum window size, plus 16 to write a gzip header and trailer.
+    kGzipMemLevel   = 8,       ///< The default memory level of zlib.
+};
+
+bool AcceptsGzip(const std::string &aAcceptEncoding)
+{
+    double gzipQuality = -1;
+    double anyQuality  = -1;
+    size_t start       = 0;
+
+    while (start < aAcceptEncoding.size())
+    {
+        size_t      end = aAcceptEncoding.find(',', start);
+        size_t      parameters;
+        std::string coding;
+        double      quality = 1;
+
+        if (end == std::string::npos)
+        {
+            end = aAcceptEncoding.size();
+        }
+
+        coding     = aAcceptEncoding.substr(start, end - start);
+        parameters = coding.find(';');
+        if (parameters != std::string::npos)
+        {
+            size_t q = coding.find("q=", parameters);
+
+            if (q != std::string::npos)
+            {
+                quality = strtod(coding.c_str() + q + 2, nullptr);
+            }
+            coding.resize(parameters);
+        }
+        coding.erase(0, coding.find_first_not_of(' '));
+        coding.erase(coding.find_last_not_of(' ') + 1);
+
+        if (strcasecmp(coding.c_str(), "gzip") == 0)
+        {
+            gzipQuality = quality;
+        }
+        else if (coding == "*")
+        {
+            anyQuality = quality;
+        }
+
+        start = end + 1;
+    }
+
+    // An explicit "gzip;q=0" refuses gzip even if "*" is accepted.
+    return gzipQuality >= 0 ? gzipQuality > 0 : anyQuality > 0;
+}
+
+bool GzipCompress(const char *aData, size_t aLength, std::string &aOutput)
+{
+    bool     ret = false;
+    z_stream stream;
+
+    stream.zalloc = Z_NULL;
+    stream.zfree  = Z_NULL;
+    stream.opaque = Z_NULL;
+
+    VerifyOrExit(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kGzipWindowBits, kGzipMemLevel,
+                              Z_DEFAULT_STRATEGY) == Z_OK);
+
+    aOutput.resize(deflateBound(&stream, aLength));
+
+    stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(aData));
+    stream.avail_in  = static_cast<uInt>(aLength);
+    stream.next_out  = reinterpret_cast<Bytef *>(&aOutput[0]);
+    stream.avail_out = static_cast<uInt>(aOutput.size());
+
+    // The output buffer is large enough to finish in a single call.
+    if (deflate(&stream, Z_FINISH) == Z_STREAM_END)
+    {
+        aOutput.resize(stream.total_out);
+        ret = true;
+    }
+
+    deflateEnd(&stream);
+
+exit:
+    return ret;
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,75 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for gzip compression of HTTP bodies.
+ */
+
+#ifndef OTBR_UTILS_GZIP_HPP_
+#define OTBR_UTILS_GZIP_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+
+#include <stddef.h>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This function indicates whether an Accept-Encoding header value accepts a gzip coded body.
+ *
+ * @param[in]  aAcceptEncoding  The value of the Accept-Encoding header.
+ *
+ * @retval  true     gzip is accepted with a non-zero quality.
+ * @retval  false    gzip is not accepted.
+ *
+ */
+bool AcceptsGzip(const std::string &aAcceptEncoding);
+
+/**
+ * This function compresses data into the gzip format.
+ *
+ * @param[in]   aData    A pointer to the data to compress.
+ * @param[in]   aLength  The length of the data.
+ * @param[out]  aOutput  A reference to receive the compressed data.
+ *
+ * @retval  true     Successfully compressed the data.
+ * @retval  false    Failed to compress the data.
+ *
+ */
+bool GzipCompress(const char *aData, size_t aLength, std::string &aOutput);
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_GZIP_HPP_
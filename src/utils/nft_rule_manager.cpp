@@ -0,0 +1,669 @@
+/*
+ *  Copyright (c) 2017, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements programming nftables rules through netlink.
+ */
+
+#include "utils/nft_rule_manager.hpp"
+
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+namespace {
+
+const uint8_t  kIcmp6Protocol            = IPPROTO_ICMPV6;
+const uint32_t kSourceAddressOffset      = 8;    ///< Offset of the source address in the IPv6 header.
+const uint32_t kDestinationAddressOffset = 24;   ///< Offset of the destination address in the IPv6 header.
+const size_t   kReceiveBufferSize        = 8192; ///< Size of the buffer receiving the acknowledgments.
+
+size_t PutMessageHeader(std::vector<uint8_t> &aBuffer,
+                        uint16_t              aType,
+                        uint16_t              aFlags,
+                        uint8_t               aFamily,
+                        uint32_t              aSequence,
+                        uint16_t              aResourceId)
+{
+    nlmsghdr header;
+    nfgenmsg message;
+    size_t   offset = aBuffer.size();
+
+    header.nlmsg_len   = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(message));
+    header.nlmsg_type  = aType;
+    header.nlmsg_flags = aFlags;
+    header.nlmsg_seq   = aSequence;
+    header.nlmsg_pid   = 0;
+
+    message.nfgen_family = aFamily;
+    message.version      = NFNETLINK_V0;
+    message.res_id       = htons(aResourceId);
+
+    aBuffer.resize(offset + header.nlmsg_len, 0);
+    memcpy(&aBuffer[offset], &header, sizeof(header));
+    memcpy(&aBuffer[offset + NLMSG_HDRLEN], &message, sizeof(message));
+
+    return offset;
+}
+
+void EndMessageHeader(std::vector<uint8_t> &aBuffer, size_t aOffset)
+{
+    uint32_t length = static_cast<uint32_t>(aBuffer.size() - aOffset);
+
+    memcpy(&aBuffer[aOffset], &length, sizeof(length));
+}
+
+int OpenNetfilterSocket(void)
+{
+    int         fd      = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_NETFILTER);
+    timeval     timeout = {1, 0};
+    sockaddr_nl address;
+
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+
+    VerifyOrExit(fd >= 0);
+    if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0 ||
+        bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        int savedErrno = errno;
+
+        close(fd);
+        fd    = -1;
+        errno = savedErrno;
+    }
+
+exit:
+    return fd;
+}
+
+void PutAttribute(std::vector<uint8_t> &aBuffer, uint16_t aType, const void *aValue, size_t aLength)
+{
+    nlattr attr;
+    size_t offset = aBuffer.size();
+
+    attr.nla_len  = static_cast<uint16_t>(NLA_HDRLEN + aLength);
+    attr.nla_type = aType;
+
+    aBuffer.resize(offset + NLA_HDRLEN + NLA_ALIGN(aLength), 0);
+    memcpy(&aBuffer[offset], &attr, sizeof(attr));
+    if (aLength > 0)
+    {
+        memcpy(&aBuffer[offset + NLA_HDRLEN], aValue, aLength);
+    }
+}
+
+void PutU32(std::vector<uint8_t> &aBuffer, uint16_t aType, uint32_t aValue)
+{
+    uint32_t value = htonl(aValue);
+
+    PutAttribute(aBuffer, aType, &value, sizeof(value));
+}
+
+void PutU16(std::vector<uint8_t> &aBuffer, uint16_t aType, uint16_t aValue)
+{
+    uint16_t value = htons(aValue);
+
+    PutAttribute(aBuffer, aType, &value, sizeof(value));
+}
+
+void PutString(std::vector<uint8_t> &aBuffer, uint16_t aType, const char *aValue)
+{
+    PutAttribute(aBuffer, aType, aValue, strlen(aValue) + 1);
+}
+
+size_t BeginNested(std::vector<uint8_t> &aBuffer, uint16_t aType)
+{
+    size_t offset = aBuffer.size();
+
+    PutAttribute(aBuffer, aType | NLA_F_NESTED, nullptr, 0);
+
+    return offset;
+}
+
+void EndNested(std::vector<uint8_t> &aBuffer, size_t aOffset)
+{
+    uint16_t length = static_cast<uint16_t>(aBuffer.size() - aOffset);
+
+    memcpy(&aBuffer[aOffset], &length, sizeof(length));
+}
+
+void PutData(std::vector<uint8_t> &aBuffer, uint16_t aType, const void *aValue, size_t aLength)
+{
+    size_t data = BeginNested(aBuffer, aType);
+
+    PutAttribute(aBuffer, NFTA_DATA_VALUE, aValue, aLength);
+    EndNested(aBuffer, data);
+}
+
+void AddExpression(std::vector<uint8_t> &aList, const char *aName, const std::vector<uint8_t> &aData)
+{
+    size_t element = BeginNested(aList, NFTA_LIST_ELEM);
+    size_t data;
+
+    PutString(aList, NFTA_EXPR_NAME, aName);
+    data = BeginNested(aList, NFTA_EXPR_DATA);
+    aList.insert(aList.end(), aData.begin(), aData.end());
+    EndNested(aList, data);
+    EndNested(aList, element);
+}
+
+void AddMeta(std::vector<uint8_t> &aList, uint32_t aKey)
+{
+    std::vector<uint8_t> data;
+
+    PutU32(data, NFTA_META_DREG, NFT_REG_1);
+    PutU32(data, NFTA_META_KEY, aKey);
+    AddExpression(aList, "meta", data);
+}
+
+void AddPayload(std::vector<uint8_t> &aList, uint32_t aBase, uint32_t aOffset, uint32_t aLength)
+{
+    std::vector<uint8_t> data;
+
+    PutU32(data, NFTA_PAYLOAD_DREG, NFT_REG_1);
+    PutU32(data, NFTA_PAYLOAD_BASE, aBase);
+    PutU32(data, NFTA_PAYLOAD_OFFSET, aOffset);
+    PutU32(data, NFTA_PAYLOAD_LEN, aLength);
+    AddExpression(aList, "payload", data);
+}
+
+void AddBitwise(std::vector<uint8_t> &aList, const uint8_t *aMask, uint32_t aLength)
+{
+    std::vector<uint8_t> data;
+    uint8_t              zeros[sizeof(Ip6Address)] = {};
+
+    PutU32(data, NFTA_BITWISE_SREG, NFT_REG_1);
+    PutU32(data, NFTA_BITWISE_DREG, NFT_REG_1);
+    PutU32(data, NFTA_BITWISE_LEN, aLength);
+    PutData(data, NFTA_BITWISE_MASK, aMask, aLength);
+    PutData(data, NFTA_BITWISE_XOR, zeros, aLength);
+    AddExpression(aList, "bitwise", data);
+}
+
+void AddCompare(std::vector<uint8_t> &aList, const void *aValue, uint32_t aLength)
+{
+    std::vector<uint8_t> data;
+
+    PutU32(data, NFTA_CMP_SREG, NFT_REG_1);
+    PutU32(data, NFTA_CMP_OP, NFT_CMP_EQ);
+    PutData(data, NFTA_CMP_DATA, aValue, aLength);
+    AddExpression(aList, "cmp", data);
+}
+
+} // namespace
+
+/**
+ * This class builds a netlink batch of nftables messages.
+ *
+ */
+class NftRuleManager::Batch
+{
+public:
+    explicit Batch(uint32_t aSequence)
+        : mFirstSequence(aSequence)
+        , mCount(0)
+    {
+        AddControl(NFNL_MSG_BATCH_BEGIN);
+    }
+
+    size_t BeginMessage(uint16_t aType, uint16_t aFlags)
+    {
+        mCount++;
+
+        return PutMessageHeader(mBuffer, (NFNL_SUBSYS_NFTABLES << 8) | aType, NLM_F_REQUEST | NLM_F_ACK | aFlags,
+                                NFPROTO_IPV6, mFirstSequence + mCount, 0);
+    }
+
+    void EndMessage(size_t aOffset) { EndMessageHeader(mBuffer, aOffset); }
+
+    void Finish(void) { AddControl(NFNL_MSG_BATCH_END); }
+
+    std::vector<uint8_t> &GetBuffer(void) { return mBuffer; }
+    uint32_t              GetFirstSequence(void) const { return mFirstSequence; }
+    uint32_t              GetCount(void) const { return mCount; }
+
+private:
+    void AddControl(uint16_t aType)
+    {
+        uint32_t sequence = (aType == NFNL_MSG_BATCH_BEGIN) ? mFirstSequence : mFirstSequence + mCount + 1;
+
+        PutMessageHeader(mBuffer, aType, NLM_F_REQUEST, AF_UNSPEC, sequence, NFNL_SUBSYS_NFTABLES);
+    }
+
+    std::vector<uint8_t> mBuffer;
+    uint32_t             mFirstSequence; ///< Sequence number of the batch begin message.
+    uint32_t             mCount;         ///< Number of messages between the batch begin and end messages.
+};
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchInterface(uint32_t aKey, const char *aIfName)
+{
+    char name[IFNAMSIZ] = {};
+
+    strncpy(name, aIfName, sizeof(name) - 1);
+    AddMeta(mExpressions, aKey);
+    AddCompare(mExpressions, name, sizeof(name));
+
+    return *this;
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchInputInterface(const char *aIfName)
+{
+    return MatchInterface(NFT_META_IIFNAME, aIfName);
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchOutputInterface(const char *aIfName)
+{
+    return MatchInterface(NFT_META_OIFNAME, aIfName);
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchPrefix(uint32_t aOffset, const Ip6Prefix &aPrefix)
+{
+    uint32_t length = (aPrefix.mLength + 7) / 8;
+    uint8_t  prefix[sizeof(Ip6Address)];
+
+    VerifyOrExit(length > 0);
+
+    memcpy(prefix, aPrefix.mPrefix.m8, length);
+    AddPayload(mExpressions, NFT_PAYLOAD_NETWORK_HEADER, aOffset, length);
+
+    if (aPrefix.mLength % 8 != 0)
+    {
+        uint8_t mask[sizeof(Ip6Address)];
+
+        memset(mask, 0xff, length);
+        mask[length - 1] = static_cast<uint8_t>(0xff << (8 - aPrefix.mLength % 8));
+        prefix[length - 1] &= mask[length - 1];
+        AddBitwise(mExpressions, mask, length);
+    }
+
+    AddCompare(mExpressions, prefix, length);
+
+exit:
+    return *this;
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchSource(const Ip6Prefix &aPrefix)
+{
+    return MatchPrefix(kSourceAddressOffset, aPrefix);
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchDestination(const Ip6Prefix &aPrefix)
+{
+    return MatchPrefix(kDestinationAddressOffset, aPrefix);
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::MatchIcmp6Type(uint8_t aType)
+{
+    AddMeta(mExpressions, NFT_META_L4PROTO);
+    AddCompare(mExpressions, &kIcmp6Protocol, sizeof(kIcmp6Protocol));
+    AddPayload(mExpressions, NFT_PAYLOAD_TRANSPORT_HEADER, 0, sizeof(aType));
+    AddCompare(mExpressions, &aType, sizeof(aType));
+
+    return *this;
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::Queue(uint16_t aQueueNum, bool aBypass)
+{
+    std::vector<uint8_t> data;
+
+    PutU16(data, NFTA_QUEUE_NUM, aQueueNum);
+    PutU16(data, NFTA_QUEUE_TOTAL, 1);
+    PutU16(data, NFTA_QUEUE_FLAGS, aBypass ? NFT_QUEUE_FLAG_BYPASS : 0);
+    AddExpression(mExpressions, "queue", data);
+
+    return *this;
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::Verdict(uint32_t aVerdict)
+{
+    std::vector<uint8_t> data;
+    size_t               value;
+    size_t               verdict;
+
+    PutU32(data, NFTA_IMMEDIATE_DREG, NFT_REG_VERDICT);
+    value   = BeginNested(data, NFTA_IMMEDIATE_DATA);
+    verdict = BeginNested(data, NFTA_DATA_VERDICT);
+    PutU32(data, NFTA_VERDICT_CODE, aVerdict);
+    EndNested(data, verdict);
+    EndNested(data, value);
+    AddExpression(mExpressions, "immediate", data);
+
+    return *this;
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::Accept(void)
+{
+    return Verdict(NF_ACCEPT);
+}
+
+NftRuleManager::Rule &NftRuleManager::Rule::Drop(void)
+{
+    return Verdict(NF_DROP);
+}
+
+NftRuleManager::NftRuleManager(const char *aTable)
+    : mTable(aTable)
+    , mSequence(static_cast<uint32_t>(time(nullptr)))
+{
+}
+
+otbrError NftRuleManager::SetChain(const char *aChain, Hook aHook, int32_t aPriority, const std::vector<Rule> &aRules)
+{
+    Batch                 batch(mSequence);
+    std::vector<uint8_t> &buffer = batch.GetBuffer();
+    size_t                message;
+    size_t                nested;
+    otbrError             error;
+
+    message = batch.BeginMessage(NFT_MSG_NEWTABLE, NLM_F_CREATE);
+    PutString(buffer, NFTA_TABLE_NAME, mTable.c_str());
+    batch.EndMessage(message);
+
+    message = batch.BeginMessage(NFT_MSG_NEWCHAIN, NLM_F_CREATE);
+    PutString(buffer, NFTA_CHAIN_TABLE, mTable.c_str());
+    PutString(buffer, NFTA_CHAIN_NAME, aChain);
+    PutString(buffer, NFTA_CHAIN_TYPE, "filter");
+    nested = BeginNested(buffer, NFTA_CHAIN_HOOK);
+    PutU32(buffer, NFTA_HOOK_HOOKNUM, aHook);
+    PutU32(buffer, NFTA_HOOK_PRIORITY, static_cast<uint32_t>(aPriority));
+    EndNested(buffer, nested);
+    batch.EndMessage(message);
+
+    // Deleting the rules of a chain without a rule handle flushes it.
+    message = batch.BeginMessage(NFT_MSG_DELRULE, 0);
+    PutString(buffer, NFTA_RULE_TABLE, mTable.c_str());
+    PutString(buffer, NFTA_RULE_CHAIN, aChain);
+    batch.EndMessage(message);
+
+    for (const Rule &rule : aRules)
+    {
+        message = batch.BeginMessage(NFT_MSG_NEWRULE, NLM_F_CREATE | NLM_F_APPEND);
+        PutString(buffer, NFTA_RULE_TABLE, mTable.c_str());
+        PutString(buffer, NFTA_RULE_CHAIN, aChain);
+        nested = BeginNested(buffer, NFTA_RULE_EXPRESSIONS);
+        buffer.insert(buffer.end(), rule.mExpressions.begin(), rule.mExpressions.end());
+        EndNested(buffer, nested);
+        batch.EndMessage(message);
+    }
+
+    error = Commit(batch);
+    otbrLogResult(error, "NftRuleManager: set chain %s %s with %zu rules", mTable.c_str(), aChain, aRules.size());
+
+    return error;
+}
+
+otbrError NftRuleManager::RemoveChain(const char *aChain)
+{
+    Batch                 batch(mSequence);
+    std::vector<uint8_t> &buffer = batch.GetBuffer();
+    size_t                message;
+    otbrError             error;
+
+    message = batch.BeginMessage(NFT_MSG_DELRULE, 0);
+    PutString(buffer, NFTA_RULE_TABLE, mTable.c_str());
+    PutString(buffer, NFTA_RULE_CHAIN, aChain);
+    batch.EndMessage(message);
+
+    message = batch.BeginMessage(NFT_MSG_DELCHAIN, 0);
+    PutString(buffer, NFTA_CHAIN_TABLE, mTable.c_str());
+    PutString(buffer, NFTA_CHAIN_NAME, aChain);
+    batch.EndMessage(message);
+
+    error = Commit(batch);
+    if (error == OTBR_ERROR_ERRNO && errno == ENOENT)
+    {
+        error = OTBR_ERROR_NONE;
+    }
+    otbrLogResult(error, "NftRuleManager: remove chain %s %s", mTable.c_str(), aChain);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        error = RemoveTableIfUnused();
+    }
+
+    return error;
+}
+
+otbrError NftRuleManager::RemoveTableIfUnused(void)
+{
+    Batch                 batch(mSequence);
+    std::vector<uint8_t> &buffer = batch.GetBuffer();
+    size_t                message;
+    uint32_t              use = 0;
+    otbrError             error;
+
+    // Agents of other Thread interfaces may have their chains in the table.
+    SuccessOrExit(error = GetTableUse(use));
+    VerifyOrExit(use == 0);
+
+    // The kernel refuses to delete a table still used when not recursive, in case a chain was added meanwhile.
+    message = batch.BeginMessage(NFT_MSG_DELTABLE, NLM_F_NONREC);
+    PutString(buffer, NFTA_TABLE_NAME, mTable.c_str());
+    batch.EndMessage(message);
+
+    error = Commit(batch);
+    otbrLogResult(error, "NftRuleManager: remove table %s", mTable.c_str());
+
+exit:
+    if (error == OTBR_ERROR_ERRNO && (errno == ENOENT || errno == EBUSY))
+    {
+        error = OTBR_ERROR_NONE;
+    }
+
+    return error;
+}
+
+otbrError NftRuleManager::GetTableUse(uint32_t &aUse)
+{
+    otbrError            error    = OTBR_ERROR_ERRNO;
+    uint32_t             sequence = mSequence++;
+    bool                 done     = false;
+    int                  result   = ENOENT; // Until the table is received.
+    std::vector<uint8_t> request;
+    size_t               message;
+    sockaddr_nl          address;
+    int                  fd = -1;
+    ssize_t              rval;
+
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+
+    message = PutMessageHeader(request, (NFNL_SUBSYS_NFTABLES << 8) | NFT_MSG_GETTABLE, NLM_F_REQUEST | NLM_F_ACK,
+                               NFPROTO_IPV6, sequence, 0);
+    PutString(request, NFTA_TABLE_NAME, mTable.c_str());
+    EndMessageHeader(request, message);
+
+    fd = OpenNetfilterSocket();
+    VerifyOrExit(fd >= 0);
+
+    rval = sendto(fd, request.data(), request.size(), 0, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+    VerifyOrExit(rval == static_cast<ssize_t>(request.size()));
+
+    // The kernel replies with the table, then acknowledges the request.
+    while (!done)
+    {
+        alignas(nlmsghdr) uint8_t buffer[kReceiveBufferSize];
+        int                       length;
+
+        rval = recv(fd, buffer, sizeof(buffer), 0);
+        VerifyOrExit(rval > 0, errno = (rval == 0 || errno == EAGAIN) ? ETIMEDOUT : errno);
+        length = static_cast<int>(rval);
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, length);
+             header = NLMSG_NEXT(header, length))
+        {
+            if (header->nlmsg_seq != sequence)
+            {
+                continue;
+            }
+
+            if (header->nlmsg_type == NLMSG_ERROR && header->nlmsg_len >= NLMSG_LENGTH(sizeof(nlmsgerr)))
+            {
+                int status = static_cast<const nlmsgerr *>(NLMSG_DATA(header))->error;
+
+                if (status != 0)
+                {
+                    result = -status;
+                }
+                done = true;
+            }
+            else if (header->nlmsg_type == ((NFNL_SUBSYS_NFTABLES << 8) | NFT_MSG_NEWTABLE) &&
+                     header->nlmsg_len >= NLMSG_LENGTH(NLMSG_ALIGN(sizeof(nfgenmsg))))
+            {
+                const uint8_t *attrs =
+                    static_cast<const uint8_t *>(NLMSG_DATA(header)) + NLMSG_ALIGN(sizeof(nfgenmsg));
+                size_t remain = header->nlmsg_len - NLMSG_LENGTH(NLMSG_ALIGN(sizeof(nfgenmsg)));
+
+                while (remain >= NLA_HDRLEN)
+                {
+                    nlattr attr;
+
+                    memcpy(&attr, attrs, sizeof(attr));
+                    VerifyOrExit(attr.nla_len >= NLA_HDRLEN && attr.nla_len <= remain, errno = EBADMSG);
+
+                    if ((attr.nla_type & NLA_TYPE_MASK) == NFTA_TABLE_USE && attr.nla_len >= NLA_HDRLEN + sizeof(aUse))
+                    {
+                        memcpy(&aUse, attrs + NLA_HDRLEN, sizeof(aUse));
+                        aUse   = ntohl(aUse);
+                        result = 0;
+                    }
+
+                    size_t aligned = NLA_ALIGN(static_cast<size_t>(attr.nla_len));
+
+                    remain = (aligned < remain) ? remain - aligned : 0;
+                    attrs += aligned;
+                }
+            }
+        }
+    }
+
+    VerifyOrExit(result == 0, errno = result);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (fd >= 0)
+    {
+        int savedErrno = errno;
+
+        close(fd);
+        errno = savedErrno;
+    }
+
+    return error;
+}
+
+otbrError NftRuleManager::Commit(Batch &aBatch)
+{
+    otbrError   error   = OTBR_ERROR_ERRNO;
+    int         fd      = -1;
+    int         result  = 0;
+    uint32_t    pending = aBatch.GetCount();
+    sockaddr_nl address;
+    ssize_t     rval;
+
+    aBatch.Finish();
+    mSequence = aBatch.GetFirstSequence() + aBatch.GetCount() + 2;
+
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+
+    fd = OpenNetfilterSocket();
+    VerifyOrExit(fd >= 0);
+
+    rval = sendto(fd, aBatch.GetBuffer().data(), aBatch.GetBuffer().size(), 0, reinterpret_cast<sockaddr *>(&address),
+                  sizeof(address));
+    VerifyOrExit(rval == static_cast<ssize_t>(aBatch.GetBuffer().size()));
+
+    // The kernel acknowledges every message of the batch, unless it rejects the batch begin message.
+    while (pending > 0)
+    {
+        alignas(nlmsghdr) uint8_t buffer[kReceiveBufferSize];
+        int                       length;
+
+        rval = recv(fd, buffer, sizeof(buffer), 0);
+        VerifyOrExit(rval > 0, errno = (rval == 0 || errno == EAGAIN) ? ETIMEDOUT : errno);
+        length = static_cast<int>(rval);
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, length);
+             header = NLMSG_NEXT(header, length))
+        {
+            uint32_t index = header->nlmsg_seq - aBatch.GetFirstSequence();
+            int      status;
+
+            if (header->nlmsg_type != NLMSG_ERROR || index > aBatch.GetCount() ||
+                header->nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr)))
+            {
+                continue;
+            }
+
+            status = static_cast<const nlmsgerr *>(NLMSG_DATA(header))->error;
+            if (result == 0)
+            {
+                result = -status;
+            }
+            pending = (index == 0) ? 0 : pending - 1;
+        }
+    }
+
+    VerifyOrExit(result == 0, errno = result);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (fd >= 0)
+    {
+        int savedErrno = errno;
+
+        close(fd);
+        errno = savedErrno;
+    }
+
+    return error;
+}
+
+} // namespace Utils
+
+} // namespace otbr
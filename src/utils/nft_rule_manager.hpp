@@ -0,0 +1,240 @@
+/*
+ *  Copyright (c) 2017, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for programming nftables rules through netlink.
+ */
+
+#ifndef OTBR_UTILS_NFT_RULE_MANAGER_HPP_
+#define OTBR_UTILS_NFT_RULE_MANAGER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class manages chains of nftables rules in a table of the agent.
+ *
+ * Each update is sent to the kernel as one netlink batch, so that it is applied atomically, without running the
+ * nft or ip6tables commands.
+ *
+ */
+class NftRuleManager
+{
+public:
+    /**
+     * The netfilter hooks of a base chain.
+     *
+     */
+    enum Hook
+    {
+        kHookPrerouting  = 0, ///< NF_INET_PRE_ROUTING.
+        kHookInput       = 1, ///< NF_INET_LOCAL_IN.
+        kHookForward     = 2, ///< NF_INET_FORWARD.
+        kHookOutput      = 3, ///< NF_INET_LOCAL_OUT.
+        kHookPostrouting = 4, ///< NF_INET_POST_ROUTING.
+    };
+
+    /**
+     * The priorities of a base chain, relative to the ip6tables tables.
+     *
+     */
+    enum Priority : int32_t
+    {
+        kPriorityRaw    = -300, ///< The priority of the ip6tables raw table.
+        kPriorityMangle = -150, ///< The priority of the ip6tables mangle table.
+        kPriorityFilter = 0,    ///< The priority of the ip6tables filter table.
+    };
+
+    /**
+     * This class builds a rule, matching packets on all of its conditions and ending with a verdict.
+     *
+     */
+    class Rule
+    {
+    public:
+        /**
+         * This method matches packets received on an interface.
+         *
+         * @param[in] aIfName  The interface name.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &MatchInputInterface(const char *aIfName);
+
+        /**
+         * This method matches packets sent on an interface.
+         *
+         * @param[in] aIfName  The interface name.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &MatchOutputInterface(const char *aIfName);
+
+        /**
+         * This method matches packets whose source address is in a prefix.
+         *
+         * @param[in] aPrefix  The IPv6 prefix.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &MatchSource(const Ip6Prefix &aPrefix);
+
+        /**
+         * This method matches packets whose destination address is in a prefix.
+         *
+         * @param[in] aPrefix  The IPv6 prefix.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &MatchDestination(const Ip6Prefix &aPrefix);
+
+        /**
+         * This method matches ICMPv6 messages of a type.
+         *
+         * @param[in] aType  The ICMPv6 type.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &MatchIcmp6Type(uint8_t aType);
+
+        /**
+         * This method ends the rule by queueing the packets to a netfilter queue.
+         *
+         * @param[in] aQueueNum  The number of the netfilter queue.
+         * @param[in] aBypass    Whether packets are accepted when no process listens to the queue.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &Queue(uint16_t aQueueNum, bool aBypass);
+
+        /**
+         * This method ends the rule by accepting the packets.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &Accept(void);
+
+        /**
+         * This method ends the rule by dropping the packets.
+         *
+         * @returns A reference to this rule.
+         *
+         */
+        Rule &Drop(void);
+
+        /**
+         * This method returns the expressions of the rule, encoded as the payload of a NFTA_RULE_EXPRESSIONS
+         * attribute.
+         *
+         * @returns A reference to the encoded list of expressions.
+         *
+         */
+        const std::vector<uint8_t> &GetExpressions(void) const { return mExpressions; }
+
+    private:
+        friend class NftRuleManager;
+
+        Rule &MatchInterface(uint32_t aKey, const char *aIfName);
+        Rule &MatchPrefix(uint32_t aOffset, const Ip6Prefix &aPrefix);
+        Rule &Verdict(uint32_t aVerdict);
+
+        std::vector<uint8_t> mExpressions; ///< The encoded list of expressions.
+    };
+
+    /**
+     * This constructor initializes a rule manager of an ip6 table.
+     *
+     * @param[in] aTable  The name of the table, created on demand and shared by all chains of the manager.
+     *
+     */
+    explicit NftRuleManager(const char *aTable = "otbr");
+
+    /**
+     * This method creates a base chain, or replaces its rules if it exists.
+     *
+     * The previous rules of the chain are removed in the same batch, so that packets always see either all the
+     * previous rules or all the new ones, and a restarted agent doesn't duplicate the rules of its previous run.
+     *
+     * @param[in] aChain     The name of the chain.
+     * @param[in] aHook      The netfilter hook of the chain.
+     * @param[in] aPriority  The priority of the chain.
+     * @param[in] aRules     The rules of the chain.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully set the chain.
+     * @retval OTBR_ERROR_ERRNO  Failed to set the chain, errno is set.
+     *
+     */
+    otbrError SetChain(const char *aChain, Hook aHook, int32_t aPriority, const std::vector<Rule> &aRules);
+
+    /**
+     * This method removes a chain and its rules.
+     *
+     * The table is deleted with its last chain, unless another process still has chains in it.
+     *
+     * @param[in] aChain  The name of the chain.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully removed the chain, or it didn't exist.
+     * @retval OTBR_ERROR_ERRNO  Failed to remove the chain, errno is set.
+     *
+     */
+    otbrError RemoveChain(const char *aChain);
+
+private:
+    class Batch;
+
+    otbrError Commit(Batch &aBatch);
+    otbrError GetTableUse(uint32_t &aUse);
+    otbrError RemoveTableIfUnused(void);
+
+    std::string mTable;
+    uint32_t    mSequence;
+};
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_NFT_RULE_MANAGER_HPP_
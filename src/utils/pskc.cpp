@@ -33,12 +33,71 @@
 
 #include "utils/pskc.hpp"
 
+#include <mutex>
+
+#include <mbedtls/md.h>
+#include <mbedtls/platform_util.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+enum
+{
+    kCacheKeyLength = 32, ///< Length of the SHA-256 digest keying the cache.
+};
+
+struct PskcCacheEntry
+{
+    uint8_t  mKey[kCacheKeyLength];
+    uint8_t  mPskc[OT_PSKC_LENGTH];
+    uint32_t mLastUsed; ///< Zero if the entry is unused.
+};
+
+static std::mutex     sCacheMutex;
+static PskcCacheEntry sCache[OTBR_PSKC_CACHE_SIZE];
+static uint32_t       sCacheTime = 0;
+
+static bool FindCachedPskc(const uint8_t *aKey, uint8_t *aPskc)
+{
+    std::lock_guard<std::mutex> lock(sCacheMutex);
+    bool                        found = false;
+
+    for (PskcCacheEntry &entry : sCache)
+    {
+        if (entry.mLastUsed != 0 && memcmp(entry.mKey, aKey, sizeof(entry.mKey)) == 0)
+        {
+            entry.mLastUsed = ++sCacheTime;
+            memcpy(aPskc, entry.mPskc, sizeof(entry.mPskc));
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+static void CachePskc(const uint8_t *aKey, const uint8_t *aPskc)
+{
+    std::lock_guard<std::mutex> lock(sCacheMutex);
+    PskcCacheEntry *            oldest = &sCache[0];
+
+    // Replaces the least recently used entry, unused entries are the least recently used.
+    for (PskcCacheEntry &entry : sCache)
+    {
+        if (entry.mLastUsed < oldest->mLastUsed)
+        {
+            oldest = &entry;
+        }
+    }
+
+    memcpy(oldest->mKey, aKey, sizeof(oldest->mKey));
+    memcpy(oldest->mPskc, aPskc, sizeof(oldest->mPskc));
+    oldest->mLastUsed = ++sCacheTime;
+}
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix = "Thread";
@@ -53,31 +112,74 @@ void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
     cur += OT_EXTENDED_PAN_ID_LENGTH;
 
     VerifyOrExit(strlen(aNetworkName) > 0, ret = kPskcStatus_InvalidArgument);
+    VerifyOrExit(strlen(aNetworkName) <= sizeof(mSalt) - cur, ret = kPskcStatus_InvalidArgument);
     memcpy(mSalt + cur, aNetworkName, strlen(aNetworkName));
     cur += strlen(aNetworkName);
 
+exit:
     mSaltLen = static_cast<uint16_t>(cur);
 
-exit:
     if (ret != kPskcStatus_Ok)
     {
-        otbrLog(OTBR_LOG_ERR, "ExtPanId or NetworkName is nullptr");
+        otbrLog(OTBR_LOG_ERR, "NetworkName is empty or too long");
     }
     return;
 }
 
-const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+int Pskc::ComputeCacheKey(const char *aPassphrase, uint8_t *aKey) const
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    size_t  passphraseLen = strlen(aPassphrase);
+    uint8_t input[OT_PBKDF2_SALT_MAX_LENGTH + 1 + OT_PASSPHRASE_MAX_LENGTH];
+    int     ret = MBEDTLS_ERR_MD_BAD_INPUT_DATA;
 
-    SetSalt(aExtPanId, aNetworkName);
+    VerifyOrExit(passphraseLen <= OT_PASSPHRASE_MAX_LENGTH);
+
+    // The salt length separates the network name from the passphrase.
+    memcpy(input, mSalt, mSaltLen);
+    input[mSaltLen] = static_cast<uint8_t>(mSaltLen);
+    memcpy(input + mSaltLen + 1, aPassphrase, passphraseLen);
+
+    ret = mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), input, mSaltLen + 1 + passphraseLen, aKey);
+    mbedtls_platform_zeroize(input, sizeof(input));
+
+exit:
+    return ret;
+}
+
+int Pskc::DerivePskc(const char *aPassphrase)
+{
+    const mbedtls_cipher_info_t *cipherInfo    = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    size_t                       passphraseLen = strlen(aPassphrase);
+    uint32_t                     blockCounter  = 0;
+    uint16_t                     useLen        = 0;
+    uint16_t                     prfBlockLen   = MBEDTLS_CIPHER_BLKSIZE_MAX;
+    uint8_t                      prfKey[OT_PSKC_LENGTH];
+    uint8_t                      prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t                      prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t                      keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint16_t                     keyLen = OT_PSKC_LENGTH;
+    uint8_t *                    pskc   = mPskc;
+    mbedtls_cipher_context_t     cipher;
+    int                          ret;
+
+    mbedtls_cipher_init(&cipher);
+
+    // The AES-CMAC-PRF-128 key as derived by mbedtls_aes_cmac_prf_128(), set up once for all iterations.
+    if (passphraseLen == sizeof(prfKey))
+    {
+        memcpy(prfKey, aPassphrase, sizeof(prfKey));
+    }
+    else
+    {
+        const uint8_t zeroKey[OT_PSKC_LENGTH] = {0};
+
+        SuccessOrExit(ret = mbedtls_cipher_cmac(cipherInfo, zeroKey, sizeof(zeroKey) * 8,
+                                                reinterpret_cast<const uint8_t *>(aPassphrase), passphraseLen,
+                                                prfKey));
+    }
+
+    SuccessOrExit(ret = mbedtls_cipher_setup(&cipher, cipherInfo));
+    SuccessOrExit(ret = mbedtls_cipher_cmac_starts(&cipher, prfKey, sizeof(prfKey) * 8));
 
     while (keyLen)
     {
@@ -89,17 +191,17 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
         prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
+        SuccessOrExit(ret = mbedtls_cipher_cmac_reset(&cipher));
+        SuccessOrExit(ret = mbedtls_cipher_cmac_update(&cipher, prfInput, mSaltLen + 4));
+        SuccessOrExit(ret = mbedtls_cipher_cmac_finish(&cipher, prfOutput));
         memcpy(keyBlock, prfOutput, prfBlockLen);
 
         for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
         {
-            memcpy(prfInput, prfOutput, prfBlockLen);
-
             // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+            SuccessOrExit(ret = mbedtls_cipher_cmac_reset(&cipher));
+            SuccessOrExit(ret = mbedtls_cipher_cmac_update(&cipher, prfOutput, prfBlockLen));
+            SuccessOrExit(ret = mbedtls_cipher_cmac_finish(&cipher, prfOutput));
 
             // xor
             for (uint32_t j = 0; j < prfBlockLen; j++)
@@ -113,6 +215,39 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         pskc += useLen;
         keyLen -= useLen;
     }
+
+exit:
+    mbedtls_cipher_free(&cipher);
+    mbedtls_platform_zeroize(prfKey, sizeof(prfKey));
+    mbedtls_platform_zeroize(keyBlock, sizeof(keyBlock));
+    return ret;
+}
+
+const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+{
+    uint8_t key[kCacheKeyLength];
+    bool    cacheable = false;
+
+    SetSalt(aExtPanId, aNetworkName);
+
+    if (ComputeCacheKey(aPassphrase, key) == 0)
+    {
+        cacheable = true;
+        VerifyOrExit(!FindCachedPskc(key, mPskc));
+    }
+
+    if (DerivePskc(aPassphrase) != 0)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to compute PSKc");
+        ExitNow();
+    }
+
+    if (cacheable)
+    {
+        CachePskc(key, mPskc);
+    }
+
+exit:
     return mPskc;
 }
 
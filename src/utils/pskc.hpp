@@ -42,6 +42,15 @@
 #define OT_PBKDF2_SALT_MAX_LENGTH 30
 #define OT_PSKC_LENGTH 16
 
+/**
+ * The number of recently computed PSKc values remembered by all Pskc instances, keyed by a SHA-256 digest of the
+ * extended PAN ID, network name and passphrase.
+ *
+ */
+#ifndef OTBR_PSKC_CACHE_SIZE
+#define OTBR_PSKC_CACHE_SIZE 16
+#endif
+
 #include <stdint.h>
 #include <string.h>
 
@@ -62,6 +71,8 @@ public:
     /**
      * This method computes the PSKc.
      *
+     * Values computed before are returned from the cache without repeating the derivation.
+     *
      * @param[in]  aExtPanId      a pointer to extended PAN ID.
      * @param[in]  aNetworkName   a pointer to network name.
      * @param[in]  aPassphrase    a pointer to passphrase.
@@ -73,6 +84,8 @@ public:
 
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    int  ComputeCacheKey(const char *aPassphrase, uint8_t *aKey) const;
+    int  DerivePskc(const char *aPassphrase);
 
     char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
     uint16_t mSaltLen;
@@ -0,0 +1,295 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the persistent state cache of otbr-agent.
+ */
+
+#include "utils/state_cache.hpp"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/tlv.hpp"
+#include "utils/crc16.hpp"
+
+namespace otbr {
+
+static const int    kNumSlots = 2;
+static const size_t kFileSize = kNumSlots * OTBR_STATE_CACHE_SLOT_SIZE;
+
+static_assert(OTBR_STATE_CACHE_SLOT_SIZE % 4096 == 0, "OTBR_STATE_CACHE_SLOT_SIZE must be a multiple of the page size");
+
+StateCache &StateCache::Get(void)
+{
+    static StateCache sStateCache;
+
+    return sStateCache;
+}
+
+StateCache::StateCache(void)
+    : mMapping(nullptr)
+    , mFd(-1)
+    , mLatestSlot(kNoSlot)
+    , mSequence(0)
+    , mDirty(false)
+    , mFlushTimer(HandleFlushTimer, this)
+{
+}
+
+std::string StateCache::GetDefaultPath(const char *aInterfaceName)
+{
+    return std::string(OTBR_STATE_CACHE_DIR "/otbr-agent-") + aInterfaceName + ".state";
+}
+
+otbrError StateCache::Open(const std::string &aPath)
+{
+    otbrError   error = OTBR_ERROR_ERRNO;
+    struct stat status;
+    void *      mapping;
+
+    assert(!IsOpen());
+
+    mFd = open(aPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    VerifyOrExit(mFd >= 0);
+    VerifyOrExit(fstat(mFd, &status) == 0);
+
+    // A file of another slot size is resized, its slots don't pass the checks and the cache starts empty.
+    if (static_cast<size_t>(status.st_size) != kFileSize)
+    {
+        VerifyOrExit(ftruncate(mFd, static_cast<off_t>(kFileSize)) == 0);
+    }
+
+    mapping = mmap(nullptr, kFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    VerifyOrExit(mapping != MAP_FAILED);
+    mMapping = static_cast<uint8_t *>(mapping);
+    error    = OTBR_ERROR_NONE;
+
+    for (int slot = 0; slot < kNumSlots; ++slot)
+    {
+        SlotHeader header;
+
+        if (!IsSlotIntact(slot))
+        {
+            continue;
+        }
+
+        memcpy(&header, GetSlot(slot), sizeof(header));
+
+        // The sequence wraps around, the latest slot is the one ahead of the other.
+        if (mLatestSlot == kNoSlot || static_cast<int32_t>(header.mSequence - mSequence) > 0)
+        {
+            mLatestSlot = slot;
+            mSequence   = header.mSequence;
+        }
+    }
+
+    if (mLatestSlot != kNoSlot)
+    {
+        Load(mLatestSlot);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE && mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    otbrLogResult(error, "StateCache: open %s, %zu records restored", aPath.c_str(), mRecords.size());
+    return error;
+}
+
+void StateCache::Close(void)
+{
+    VerifyOrExit(IsOpen());
+
+    Flush();
+    mFlushTimer.Stop();
+
+    munmap(mMapping, kFileSize);
+    close(mFd);
+    mMapping    = nullptr;
+    mFd         = -1;
+    mLatestSlot = kNoSlot;
+    mSequence   = 0;
+    mDirty      = false;
+    mRecords.clear();
+
+exit:
+    return;
+}
+
+bool StateCache::IsSlotIntact(int aSlot) const
+{
+    SlotHeader header;
+
+    memcpy(&header, GetSlot(aSlot), sizeof(header));
+
+    return header.mMagic == kMagic && header.mFormatVersion == kFormatVersion &&
+           header.mLength <= kSlotSize - sizeof(SlotHeader) &&
+           header.mChecksum == ComputeChecksum(header, GetSlot(aSlot) + sizeof(SlotHeader));
+}
+
+void StateCache::Load(int aSlot)
+{
+    SlotHeader header;
+
+    memcpy(&header, GetSlot(aSlot), sizeof(header));
+
+    for (const Tlv &tlv : TlvIterator(GetSlot(aSlot) + sizeof(SlotHeader), header.mLength))
+    {
+        const uint8_t *value = static_cast<const uint8_t *>(tlv.GetValue());
+
+        mRecords[tlv.GetType()].assign(value, value + tlv.GetLength());
+    }
+}
+
+const std::vector<uint8_t> *StateCache::Find(Record aRecord) const
+{
+    auto it = mRecords.find(aRecord);
+
+    return it != mRecords.end() ? &it->second : nullptr;
+}
+
+void StateCache::Update(Record aRecord, std::vector<uint8_t> aValue)
+{
+    auto it = mRecords.find(aRecord);
+
+    assert(aValue.size() <= kMaxRecordLength);
+
+    VerifyOrExit(IsOpen());
+    VerifyOrExit(it == mRecords.end() || it->second != aValue);
+
+    mRecords[aRecord] = std::move(aValue);
+    ScheduleFlush();
+
+exit:
+    return;
+}
+
+void StateCache::Erase(Record aRecord)
+{
+    VerifyOrExit(mRecords.erase(aRecord) > 0);
+    ScheduleFlush();
+
+exit:
+    return;
+}
+
+void StateCache::ScheduleFlush(void)
+{
+    mDirty = true;
+
+    // Later updates within the delay are written together.
+    if (!mFlushTimer.IsRunning())
+    {
+        mFlushTimer.Start(std::chrono::milliseconds(OTBR_STATE_CACHE_FLUSH_DELAY));
+    }
+}
+
+void StateCache::HandleFlushTimer(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+
+    static_cast<StateCache *>(aContext)->Flush();
+}
+
+otbrError StateCache::Flush(void)
+{
+    otbrError  error = OTBR_ERROR_NONE;
+    int        slot  = (mLatestSlot == 0) ? 1 : 0;
+    uint8_t *  records;
+    SlotHeader header;
+
+    VerifyOrExit(IsOpen() && mDirty);
+
+    mFlushTimer.Stop();
+    records = GetSlot(slot) + sizeof(SlotHeader);
+
+    // The slot of the latest state is left untouched until the other one is synced.
+    {
+        TlvWriter writer(records, kSlotSize - sizeof(SlotHeader));
+
+        for (const auto &record : mRecords)
+        {
+            if (!writer.Append(record.first, record.second.data(), static_cast<uint16_t>(record.second.size())))
+            {
+                otbrLog(OTBR_LOG_WARNING, "StateCache: slot is full, records from %u on are not written",
+                        record.first);
+                break;
+            }
+        }
+
+        header.mMagic         = kMagic;
+        header.mFormatVersion = kFormatVersion;
+        header.mSequence      = mSequence + 1;
+        header.mLength        = static_cast<uint32_t>(writer.GetLength());
+        header.mChecksum      = ComputeChecksum(header, records);
+    }
+
+    memcpy(GetSlot(slot), &header, sizeof(header));
+    VerifyOrExit(msync(mMapping, kFileSize, MS_SYNC) == 0, error = OTBR_ERROR_ERRNO);
+
+    mLatestSlot = slot;
+    mSequence   = header.mSequence;
+    mDirty      = false;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        // The slot of the latest state is still intact, the write is retried after the delay.
+        otbrLog(OTBR_LOG_WARNING, "StateCache: failed to sync: %s", strerror(errno));
+        mFlushTimer.Start(std::chrono::milliseconds(OTBR_STATE_CACHE_FLUSH_DELAY));
+    }
+
+    return error;
+}
+
+uint16_t StateCache::ComputeChecksum(const SlotHeader &aHeader, const uint8_t *aRecords)
+{
+    Crc16 crc(Crc16::kCcitt);
+
+    crc.Init();
+    crc.Update(reinterpret_cast<const uint8_t *>(&aHeader.mSequence), sizeof(aHeader.mSequence));
+    crc.Update(reinterpret_cast<const uint8_t *>(&aHeader.mLength), sizeof(aHeader.mLength));
+    crc.Update(aRecords, aHeader.mLength);
+
+    return crc.Get();
+}
+
+} // namespace otbr
@@ -0,0 +1,235 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the persistent state cache of otbr-agent.
+ */
+
+#ifndef OTBR_UTILS_STATE_CACHE_HPP_
+#define OTBR_UTILS_STATE_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/timer.hpp"
+#include "common/types.hpp"
+
+/**
+ * The directory of the state cache files, one for each Thread network interface.
+ *
+ */
+#ifndef OTBR_STATE_CACHE_DIR
+#define OTBR_STATE_CACHE_DIR "/var/lib/thread"
+#endif
+
+/**
+ * The size in bytes of each of the two slots of the state cache file, a multiple of the page size.
+ *
+ */
+#ifndef OTBR_STATE_CACHE_SLOT_SIZE
+#define OTBR_STATE_CACHE_SLOT_SIZE 65536
+#endif
+
+/**
+ * The delay in milliseconds from the first update of the state to its write, so that a burst of updates is written
+ * once.
+ *
+ */
+#ifndef OTBR_STATE_CACHE_FLUSH_DELAY
+#define OTBR_STATE_CACHE_FLUSH_DELAY 1000
+#endif
+
+namespace otbr {
+
+/**
+ * This class implements the persistent state cache, from which the services are restored when otbr-agent restarts,
+ * before the NCP reports the live state.
+ *
+ * Each subsystem keeps one record in its own format. The records are written to a memory-mapped file of two slots,
+ * the slot not holding the latest state is overwritten and synced, so a write interrupted by a crash leaves the
+ * previous state intact. A slot is only loaded if its checksum and format version match.
+ *
+ * The file is local to the host, the records are stored in host byte order. The cache is only accessed from the
+ * mainloop thread.
+ *
+ */
+class StateCache
+{
+public:
+    /**
+     * The records of the subsystems, in the order they are written, so the small ones are kept if the slot is full.
+     *
+     */
+    enum Record : uint8_t
+    {
+        kRecordBorderAgent = 1, ///< The border agent service.
+        kRecordNdProxy     = 2, ///< The DUAs of the ND Proxy.
+        kRecordDiagnostics = 3, ///< The network diagnostics cache of the REST server.
+        kRecordThread      = 4, ///< The last attached role of the Thread interface.
+    };
+
+    /**
+     * The format version of the slots, increased whenever the format of a record changes.
+     *
+     */
+    static const uint16_t kFormatVersion = 1;
+
+    /**
+     * The maximum length in bytes of the value of a record.
+     *
+     */
+    static const size_t kMaxRecordLength = UINT16_MAX;
+
+    /**
+     * This method returns the singleton state cache.
+     *
+     * @returns A reference to the state cache.
+     *
+     */
+    static StateCache &Get(void);
+
+    /**
+     * This method opens the state cache file and loads the latest intact state.
+     *
+     * The file is created if it doesn't exist, the cache is empty if no slot is intact.
+     *
+     * @param[in]   aPath   The path of the state cache file.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully opened the file.
+     * @retval  OTBR_ERROR_ERRNO    Failed to open or map the file, the cache is disabled.
+     *
+     */
+    otbrError Open(const std::string &aPath);
+
+    /**
+     * This method writes the pending updates and closes the state cache file.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method indicates whether the state cache file is open.
+     *
+     * @retval  true    The state cache file is open.
+     * @retval  false   The state cache is disabled.
+     *
+     */
+    bool IsOpen(void) const { return mMapping != nullptr; }
+
+    /**
+     * This method finds a record.
+     *
+     * @param[in]   aRecord     The record.
+     *
+     * @returns A pointer to the value of the record, or nullptr if there is none.
+     *
+     */
+    const std::vector<uint8_t> *Find(Record aRecord) const;
+
+    /**
+     * This method updates a record, the state is written after `OTBR_STATE_CACHE_FLUSH_DELAY`.
+     *
+     * Nothing happens if the value is not changed or the cache is disabled.
+     *
+     * @param[in]   aRecord     The record.
+     * @param[in]   aValue      The value of the record, at most `kMaxRecordLength` bytes.
+     *
+     */
+    void Update(Record aRecord, std::vector<uint8_t> aValue);
+
+    /**
+     * This method erases a record, the state is written after `OTBR_STATE_CACHE_FLUSH_DELAY`.
+     *
+     * @param[in]   aRecord     The record.
+     *
+     */
+    void Erase(Record aRecord);
+
+    /**
+     * This method writes the pending updates now.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully written and synced the state, or nothing is pending.
+     * @retval  OTBR_ERROR_ERRNO    Failed to sync the state.
+     *
+     */
+    otbrError Flush(void);
+
+    /**
+     * This method returns the default path of the state cache file of a Thread network interface.
+     *
+     * @param[in]   aInterfaceName  The Thread network interface name.
+     *
+     * @returns The path of the state cache file.
+     *
+     */
+    static std::string GetDefaultPath(const char *aInterfaceName);
+
+private:
+    struct SlotHeader
+    {
+        uint32_t mMagic;
+        uint16_t mFormatVersion;
+        uint16_t mChecksum; ///< CRC16 of the sequence, the length and the records.
+        uint32_t mSequence; ///< Increased by each write, the latest intact slot is loaded.
+        uint32_t mLength;   ///< Length in bytes of the records following the header.
+    };
+
+    static const uint32_t kMagic    = 0x5342544f; ///< "OTBS" in little endian.
+    static const size_t   kSlotSize = OTBR_STATE_CACHE_SLOT_SIZE;
+    static const int      kNoSlot   = -1;
+
+    StateCache(void);
+
+    uint8_t *GetSlot(int aSlot) const { return mMapping + aSlot * kSlotSize; }
+    bool     IsSlotIntact(int aSlot) const;
+    void     Load(int aSlot);
+    void     ScheduleFlush(void);
+
+    static uint16_t ComputeChecksum(const SlotHeader &aHeader, const uint8_t *aRecords);
+    static void     HandleFlushTimer(Timer &aTimer, void *aContext);
+
+    std::map<uint8_t, std::vector<uint8_t>> mRecords;
+    uint8_t *                               mMapping;
+    int                                     mFd;
+    int                                     mLatestSlot; ///< The slot holding the latest state, or `kNoSlot`.
+    uint32_t                                mSequence;
+    bool                                    mDirty;
+    Timer                                   mFlushTimer;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_STATE_CACHE_HPP_
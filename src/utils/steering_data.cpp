@@ -28,9 +28,12 @@
 
 #include "utils/steering_data.hpp"
 
+#include <thread>
+
 #include <assert.h>
 #include <mbedtls/sha256.h>
 
+#include "common/thread_scheduling.hpp"
 #include "utils/crc16.hpp"
 
 namespace otbr {
@@ -66,15 +69,69 @@ void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
-    {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+    ccitt.Update(aJoinerId, kSizeJoinerId);
+    ansi.Update(aJoinerId, kSizeJoinerId);
 
     SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
     SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
 }
 
+void SteeringData::AddJoiners(const Eui64 *aEui64s, size_t aCount)
+{
+    uint8_t                hash[32];
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init(&sha256);
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        mbedtls_sha256_starts(&sha256, 0);
+        mbedtls_sha256_update(&sha256, aEui64s[i].data(), kSizeEui64);
+        mbedtls_sha256_finish(&sha256, hash);
+
+        hash[0] |= 2;
+        ComputeBloomFilter(hash);
+    }
+
+    mbedtls_sha256_free(&sha256);
+}
+
+void SteeringData::ComputeBloomFilter(const std::vector<Eui64> &aEui64s, unsigned aThreads)
+{
+    size_t                    count = aEui64s.size() / kMinJoinersPerThread;
+    std::vector<SteeringData> partials;
+    std::vector<std::thread>  threads;
+    size_t                    begin = 0;
+
+    count = (count < aThreads ? count : aThreads);
+    count = (count > 1 ? count : 1);
+    partials.resize(count - 1);
+
+    // The last share of joiners is added on this thread, directly to this bloom filter.
+    for (size_t i = 0; i < partials.size(); i++)
+    {
+        size_t end = aEui64s.size() * (i + 1) / count;
+
+        partials[i].Init(mLength);
+        threads.emplace_back([&partials, &aEui64s, i, begin, end]() {
+            // The workers are started by the mainloop, whose real-time priority and CPUs aren't for them.
+            ApplyManagementScheduling();
+            partials[i].AddJoiners(&aEui64s[begin], end - begin);
+        });
+        begin = end;
+    }
+
+    AddJoiners(aEui64s.data() + begin, aEui64s.size() - begin);
+
+    for (size_t i = 0; i < partials.size(); i++)
+    {
+        threads[i].join();
+
+        for (uint8_t j = 0; j < mLength; j++)
+        {
+            mBloomFilter[j] |= partials[i].mBloomFilter[j];
+        }
+    }
+}
+
 } // namespace otbr
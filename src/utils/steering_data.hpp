@@ -36,6 +36,10 @@
 
 #include "openthread-br/config.h"
 
+#include <array>
+#include <vector>
+
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -52,8 +56,11 @@ public:
     {
         kMaxSizeOfBloomFilter = 16, ///< Max length of bloom filter in bytes.
         kSizeJoinerId         = 8,  ///< Size of Extended Joiner ID.
+        kSizeEui64            = 8,  ///< Size of EUI-64.
     };
 
+    typedef std::array<uint8_t, kSizeEui64> Eui64;
+
     /**
      * This method initializes the bloom filter.
      *
@@ -90,6 +97,18 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method computes the Bloom Filter of joiners by their EUI-64s.
+     *
+     * The joiner IDs are computed on up to @p aThreads threads, each adding its share of joiners to its own bloom
+     * filter, and the bloom filters are merged into this one.
+     *
+     * @param[in]  aEui64s    The EUI-64s of the joiners.
+     * @param[in]  aThreads   The maximum number of threads.
+     *
+     */
+    void ComputeBloomFilter(const std::vector<Eui64> &aEui64s, unsigned aThreads = 1);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -114,6 +133,13 @@ public:
     uint8_t GetLength(void) const { return mLength; }
 
 private:
+    enum
+    {
+        kMinJoinersPerThread = 256, ///< The minimum number of joiners worth another thread.
+    };
+
+    void AddJoiners(const Eui64 *aEui64s, size_t aCount);
+
     uint8_t mBloomFilter[kMaxSizeOfBloomFilter];
     uint8_t mLength;
 };
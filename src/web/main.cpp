@@ -76,9 +76,10 @@ int main(int argc, char **argv)
     int         logLevel       = OTBR_LOG_INFO;
     int         ret            = 0;
     int         opt;
-    uint16_t    port = OT_HTTP_PORT;
+    uint16_t    port          = OT_HTTP_PORT;
+    uint32_t    workerThreads = OTBR_WEB_WORKER_THREADS;
 
-    while ((opt = getopt(argc, argv, "d:I:p:va:")) != -1)
+    while ((opt = getopt(argc, argv, "d:I:p:va:w:")) != -1)
     {
         switch (opt)
         {
@@ -103,8 +104,24 @@ int main(int argc, char **argv)
             ExitNow();
             break;
 
+        case 'w':
+        {
+            char *        end;
+            unsigned long value;
+
+            errno = 0;
+            value = strtoul(optarg, &end, 10);
+            VerifyOrExit(errno == 0 && end != optarg && *end == '\0' && optarg[0] != '-' && value >= 1 &&
+                             value <= OTBR_WEB_MAX_WORKER_THREADS,
+                         fprintf(stderr, "Invalid number of worker threads: %s\n", optarg), ret = -1);
+            workerThreads = static_cast<uint32_t>(value);
+            break;
+        }
+
         default:
-            fprintf(stderr, "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-v]\n",
+            fprintf(stderr,
+                    "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-w workerThreads] "
+                    "[-v]\n",
                     argv[0]);
             ExitNow(ret = -1);
             break;
@@ -138,7 +155,7 @@ int main(int argc, char **argv)
     signal(SIGINT, HandleSignal);
 
     sServer.reset(new otbr::Web::WebServer());
-    sServer->StartWebServer(interfaceName, httpListenAddr, port);
+    sServer->StartWebServer(interfaceName, httpListenAddr, port, workerThreads);
 
     otbrLogDeinit();
 
@@ -50,6 +50,25 @@
             };
         });
 
+    // Long requests respond with a job at once, which is polled until it is done with the response of the request.
+    function waitForJob($http, $interval, response, callback) {
+        if (response.data.job === undefined) {
+            callback(response);
+            return;
+        }
+        var poll = $interval(function() {
+            $http.get('/job/' + response.data.job).then(function(jobResponse) {
+                if (jobResponse.data.state == 'done') {
+                    $interval.cancel(poll);
+                    callback(jobResponse);
+                }
+            }, function() {
+                $interval.cancel(poll);
+                callback({data: {error: -1, result: 'failed'}});
+            });
+        }, 500);
+    }
+
     function AppCtrl($scope, $http, $mdDialog, $interval, sharedProperties) {
         $scope.menu = [{
                 title: 'Home',
@@ -107,6 +126,8 @@
 
         $scope.headerTitle = 'Home';
         $scope.status = [];
+        $scope.statusJson = {};
+        $scope.statusPush = null;
 
         $scope.isLoading = false;
 
@@ -128,6 +149,9 @@
                 $scope.menu[i].show = false;
             }
             $scope.menu[index].show = true;
+            if (index != 3) {
+                $scope.closeStatusPush();
+            }
             if (index == 1) {
                 $scope.isLoading = true;
                 $http.get('/available_network').then(function(response) {
@@ -140,20 +164,7 @@
                 });
             }
             if (index == 3) {
-                $http.get('/get_properties').then(function(response) {
-                    console.log(response);
-                    if (response.data.error == 0) {
-                        var statusJson = response.data.result;
-                        $scope.status = [];
-                        for (var i = 0; i < Object.keys(statusJson).length; i++) {
-                            $scope.status.push({
-                                name: Object.keys(statusJson)[i],
-                                value: statusJson[Object.keys(statusJson)[i]],
-                                icon: 'res/img/icon-info.png',
-                            });
-                        }
-                    }
-                });
+                $scope.openStatusPush();
             }
             if (index == 6) {
                 $scope.dataInit();
@@ -161,6 +172,74 @@
             }
         };
 
+        $scope.showStatus = function() {
+            var statusJson = $scope.statusJson;
+            $scope.status = [];
+            for (var i = 0; i < Object.keys(statusJson).length; i++) {
+                $scope.status.push({
+                    name: Object.keys(statusJson)[i],
+                    value: statusJson[Object.keys(statusJson)[i]],
+                    icon: 'res/img/icon-info.png',
+                });
+            }
+        };
+
+        $scope.getStatus = function() {
+            $http.get('/get_properties').then(function(response) {
+                if (response.data.error == 0) {
+                    $scope.statusJson = response.data.result;
+                    $scope.showStatus();
+                }
+            });
+        };
+
+        $scope.openStatusPush = function() {
+            if ($scope.statusPush != null) {
+                return;
+            }
+            if (!window.WebSocket) {
+                $scope.getStatus();
+                return;
+            }
+            var scheme = location.protocol === 'https:' ? 'wss://' : 'ws://';
+            var statusPush = new WebSocket(scheme + location.host + '/status_push');
+            statusPush.onmessage = function(event) {
+                var message = JSON.parse(event.data);
+                if (message.error != 0) {
+                    return;
+                }
+                $scope.$apply(function() {
+                    if (message.full) {
+                        $scope.statusJson = message.result;
+                    } else {
+                        angular.extend($scope.statusJson, message.result);
+                        angular.forEach(message.removed || [], function(name) {
+                            delete $scope.statusJson[name];
+                        });
+                    }
+                    $scope.showStatus();
+                });
+            };
+            statusPush.onerror = function() {
+                $scope.$apply(function() {
+                    $scope.getStatus();
+                });
+            };
+            statusPush.onclose = function() {
+                if ($scope.statusPush === statusPush) {
+                    $scope.statusPush = null;
+                }
+            };
+            $scope.statusPush = statusPush;
+        };
+
+        $scope.closeStatusPush = function() {
+            if ($scope.statusPush != null) {
+                $scope.statusPush.close();
+                $scope.statusPush = null;
+            }
+        };
+
         $scope.showJoinDialog = function(ev, index, item) {
             sharedProperties.setIndex(index);
             sharedProperties.setNetworkInfo(item);
@@ -220,12 +299,14 @@
                 });
 
                 httpRequest.then(function successCallback(response) {
-                    $scope.res = response.data.result;
-                    if (response.data.result == 'successful') {
-                        $mdDialog.hide();
-                    }
-                    $scope.isDisplay = false;
-                    $scope.showAlert(event, response.data.result);
+                    waitForJob($http, $interval, response, function(response) {
+                        $scope.res = response.data.result;
+                        if (response.data.result == 'successful') {
+                            $mdDialog.hide();
+                        }
+                        $scope.isDisplay = false;
+                        $scope.showAlert(event, response.data.result);
+                    });
                 });
             };
 
@@ -270,12 +351,14 @@
                 });
 
                 httpRequest.then(function successCallback(response) {
-                    $scope.res = response.data.result;
-                    if (response.data.result == 'successful') {
-                        $mdDialog.hide();
-                    }
-                    $scope.isForming = false;
-                    $scope.showAlert(event, 'FORM', response.data.result);
+                    waitForJob($http, $interval, response, function(response) {
+                        $scope.res = response.data.result;
+                        if (response.data.result == 'successful') {
+                            $mdDialog.hide();
+                        }
+                        $scope.isForming = false;
+                        $scope.showAlert(event, 'FORM', response.data.result);
+                    });
                 });
             }, function() {
                 $mdDialog.cancel();
@@ -365,12 +448,14 @@
             ev.target.disabled = true;
             
             httpRequest.then(function successCallback(response) {
-                if (response.data.error == 0) {
-                    $scope.showAlert(event, 'Commission', 'success');
-                } else {
-                    $scope.showAlert(event, 'Commission', 'failed');
-                }
-                ev.target.disabled = false;
+                waitForJob($http, $interval, response, function(response) {
+                    if (response.data.error == 0) {
+                        $scope.showAlert(event, 'Commission', 'success');
+                    } else {
+                        $scope.showAlert(event, 'Commission', 'failed');
+                    }
+                    ev.target.disabled = false;
+                });
             });
         };
 
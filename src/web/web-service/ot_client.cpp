@@ -30,6 +30,8 @@
 
 #include <openthread/platform/toolchain.h>
 
+#include <chrono>
+
 #include <errno.h>
 #include <inttypes.h>
 #include <signal.h>
@@ -51,6 +53,11 @@
 #define OPENTHREAD_POSIX_APP_SOCKET_NAME "/tmp/openthread.sock"
 #endif
 
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
 namespace otbr {
 namespace Web {
 
@@ -77,7 +84,10 @@ void OpenThreadClient::Disconnect(void)
 bool OpenThreadClient::Connect(void)
 {
     struct sockaddr_un sockname;
-    int                ret;
+    int                ret = 0;
+
+    // The connection is kept across commands, only reconnect once the daemon closed it.
+    VerifyOrExit(mSocket == -1);
 
     mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
     VerifyOrExit(mSocket != -1, perror("socket"); ret = EXIT_FAILURE);
@@ -91,19 +101,48 @@ bool OpenThreadClient::Connect(void)
     if (ret == -1)
     {
         otbrLog(OTBR_LOG_ERR, "OpenThread daemon is not running.");
+        Disconnect();
     }
 
 exit:
     return ret == 0;
 }
 
-char *OpenThreadClient::Execute(const char *aFormat, ...)
+void OpenThreadClient::DiscardInput(void)
 {
-    va_list args;
-    int     ret;
-    char *  rval = nullptr;
     ssize_t count;
-    size_t  rxLength = 0;
+
+    // Output still pending belongs to a command which timed out, it must not be taken as the output of the next one.
+    while ((count = recv(mSocket, mBuffer, sizeof(mBuffer), MSG_DONTWAIT)) > 0)
+    {
+    }
+
+    if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+    {
+        Disconnect();
+    }
+}
+
+char *OpenThreadClient::Execute(const char *aFormat, ...)
+{
+    static const char kCliPrompt[] = "> ";
+    static const char kDone[]      = "Done\r\n";
+    static const char kError[]     = "Error ";
+
+    va_list                  args;
+    int                      ret;
+    char *                   rval = nullptr;
+    ssize_t                  count;
+    size_t                   rxLength  = 0;
+    size_t                   lineStart = 0;
+    steady_clock::time_point deadline  = steady_clock::now() + milliseconds(mTimeout);
+
+    if (mSocket != -1)
+    {
+        DiscardInput();
+    }
+
+    VerifyOrExit(Connect());
 
     va_start(args, aFormat);
     ret = vsnprintf(&mBuffer[1], sizeof(mBuffer) - 1, aFormat, args);
@@ -131,17 +170,26 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
     {
         mBuffer[ret] = '\0';
         otbrLog(OTBR_LOG_ERR, "Failed to send command: %s", mBuffer);
+        Disconnect();
+        ExitNow();
     }
 
-    for (int i = 0; i < mTimeout; ++i)
+    while (rval == nullptr)
     {
         fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char *  done;
+        timeval timeout;
+        int64_t remaining = duration_cast<microseconds>(deadline - steady_clock::now()).count();
+        char *  lineEnd;
+
+        VerifyOrExit(remaining > 0);
+
+        timeout.tv_sec  = static_cast<time_t>(remaining / 1000000);
+        timeout.tv_usec = static_cast<suseconds_t>(remaining % 1000000);
 
         FD_ZERO(&readFdSet);
         FD_SET(mSocket, &readFdSet);
 
+        // Sleep until output arrives instead of polling, so the command returns as soon as it is done.
         ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
         VerifyOrExit(ret != -1 || errno == EINTR);
         if (ret <= 0)
@@ -149,23 +197,45 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
             continue;
         }
 
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
-        rxLength += count;
+        VerifyOrExit(rxLength < sizeof(mBuffer) - 1,
+                     otbrLog(OTBR_LOG_ERR, "Output exceeds maximum limit: %d", kBufferSize));
+        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - 1 - rxLength);
+        VerifyOrExit(count > 0, Disconnect());
+        rxLength += static_cast<size_t>(count);
 
         mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n");
 
-        if (done != nullptr)
+        // Only the lines completed by this read are parsed, each line of the output is looked at once.
+        while (rval == nullptr && (lineEnd = strchr(&mBuffer[lineStart], '\n')) != nullptr)
         {
-            // remove trailing \r\n
-            if (done - rval > 2)
+            char * line      = &mBuffer[lineStart];
+            size_t outputEnd = lineStart;
+
+            lineStart = static_cast<size_t>(lineEnd - mBuffer) + 1;
+
+            if (strncmp(line, kCliPrompt, sizeof(kCliPrompt) - 1) == 0)
             {
-                done[-2] = '\0';
+                line += sizeof(kCliPrompt) - 1;
             }
 
-            rval = mBuffer;
-            break;
+            if (strncmp(line, kDone, sizeof(kDone) - 1) == 0)
+            {
+                // remove trailing \r\n
+                if (outputEnd >= 2 && mBuffer[outputEnd - 2] == '\r')
+                {
+                    outputEnd -= 2;
+                }
+
+                mBuffer[outputEnd] = '\0';
+                rval               = mBuffer;
+            }
+            else if (strncmp(line, kError, sizeof(kError) - 1) == 0)
+            {
+                // Fail without waiting for the timeout.
+                *lineEnd = '\0';
+                otbrLog(OTBR_LOG_WARNING, "Command failed: %s", line);
+                ExitNow();
+            }
         }
     }
 
@@ -75,6 +75,8 @@ public:
     /**
      * This method connects to OpenThread daemon.
      *
+     * The connection is kept for all the commands executed, this method does nothing if it is still connected.
+     *
      * @retval  true    Successfully connected to the daemon.
      * @retval  false   Failed to connected to the daemon.
      *
@@ -84,6 +86,9 @@ public:
     /**
      * This method executes OpenThread CLI.
      *
+     * This method connects to the daemon again if the connection was closed, and returns as soon as the command is
+     * done or failed.
+     *
      * @param[in]   aFormat     C style format string.
      * @param[in]   ...         C style format arguments.
      *
@@ -111,6 +116,7 @@ public:
 
 private:
     void Disconnect(void);
+    void DiscardInput(void);
 
     enum
     {
@@ -0,0 +1,410 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements pushing the status of the web service to WebSocket clients.
+ */
+
+#include "web/web-service/status_push.hpp"
+
+#include <boost/asio/write.hpp>
+#include <mbedtls/base64.h>
+#include <mbedtls/sha1.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Web {
+
+namespace {
+
+const char kWebSocketGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+const char kBadRequest[]         = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+const char kServiceUnavailable[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+} // namespace
+
+constexpr uint8_t StatusPush::kOpcodeText;
+constexpr uint8_t StatusPush::kOpcodeClose;
+constexpr uint8_t StatusPush::kOpcodePing;
+constexpr uint8_t StatusPush::kOpcodePong;
+
+StatusPush::StatusPush(boost::asio::io_service &aIoService, StatusReader aStatusReader)
+    : mTimer(aIoService)
+    , mStatusReader(std::move(aStatusReader))
+    , mReading(false)
+{
+}
+
+std::string StatusPush::ComputeAcceptKey(const std::string &aKey)
+{
+    std::string   input = aKey + kWebSocketGuid;
+    unsigned char digest[20];
+    unsigned char encoded[32];
+    size_t        length = 0;
+    std::string   accept;
+
+    VerifyOrExit(!aKey.empty());
+    VerifyOrExit(mbedtls_sha1_ret(reinterpret_cast<const unsigned char *>(input.data()), input.size(), digest) == 0);
+    VerifyOrExit(mbedtls_base64_encode(encoded, sizeof(encoded), &length, digest, sizeof(digest)) == 0);
+    accept.assign(reinterpret_cast<const char *>(encoded), length);
+
+exit:
+    return accept;
+}
+
+std::string StatusPush::EncodeFrame(uint8_t aOpcode, const std::string &aPayload)
+{
+    std::string frame;
+    uint64_t    length = aPayload.size();
+
+    frame.reserve(aPayload.size() + 10);
+    frame.push_back(static_cast<char>(0x80 | aOpcode));
+
+    if (length < 126)
+    {
+        frame.push_back(static_cast<char>(length));
+    }
+    else if (length <= 0xffff)
+    {
+        frame.push_back(static_cast<char>(126));
+        frame.push_back(static_cast<char>(length >> 8));
+        frame.push_back(static_cast<char>(length));
+    }
+    else
+    {
+        frame.push_back(static_cast<char>(127));
+        for (int shift = 56; shift >= 0; shift -= 8)
+        {
+            frame.push_back(static_cast<char>(length >> shift));
+        }
+    }
+
+    frame += aPayload;
+
+    return frame;
+}
+
+void StatusPush::AddClient(const std::shared_ptr<Socket> &aSocket, const std::string &aKey)
+{
+    ClientPtr   client = std::make_shared<Client>();
+    std::string accept = ComputeAcceptKey(aKey);
+
+    client->mSocket  = aSocket;
+    client->mClosing = false;
+    client->mSynced  = false;
+
+    if (accept.empty() || mClients.size() >= OTBR_WEB_STATUS_PUSH_MAX_CLIENTS)
+    {
+        client->mClosing = true;
+        Send(client, accept.empty() ? kBadRequest : kServiceUnavailable);
+        ExitNow();
+    }
+
+    mClients.push_back(client);
+    Send(client, "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                 "Sec-WebSocket-Accept: " +
+                     accept + "\r\n\r\n");
+
+    // The status read for the clients already open is sent as is, the first client waits for it to be read.
+    if (!mResponse.isNull())
+    {
+        Send(client, EncodeFrame(kOpcodeText, GetFullStatus()));
+        client->mSynced = true;
+    }
+    else if (!mReading)
+    {
+        ReadStatus();
+    }
+
+    Receive(client);
+
+exit:
+    return;
+}
+
+void StatusPush::Send(const ClientPtr &aClient, std::string aFrame)
+{
+    VerifyOrExit(aClient->mSocket->is_open());
+
+    if (aClient->mFrames.size() >= OTBR_WEB_STATUS_PUSH_MAX_QUEUED)
+    {
+        otbrLog(OTBR_LOG_INFO, "Closing a WebSocket client too slow to receive the status");
+        Close(aClient);
+        ExitNow();
+    }
+
+    aClient->mFrames.push_back(std::move(aFrame));
+
+    if (aClient->mFrames.size() == 1)
+    {
+        WriteFront(aClient);
+    }
+
+exit:
+    return;
+}
+
+void StatusPush::WriteFront(const ClientPtr &aClient)
+{
+    boost::asio::async_write(*aClient->mSocket, boost::asio::buffer(aClient->mFrames.front()),
+                             [this, aClient](const boost::system::error_code &aError, size_t aLength) {
+                                 OTBR_UNUSED_VARIABLE(aLength);
+                                 HandleSent(aClient, aError);
+                             });
+}
+
+void StatusPush::HandleSent(const ClientPtr &aClient, const boost::system::error_code &aError)
+{
+    VerifyOrExit(!aError, Close(aClient));
+    aClient->mFrames.pop_front();
+
+    if (!aClient->mFrames.empty())
+    {
+        WriteFront(aClient);
+    }
+    else if (aClient->mClosing)
+    {
+        Close(aClient);
+    }
+
+exit:
+    return;
+}
+
+void StatusPush::Receive(const ClientPtr &aClient)
+{
+    aClient->mSocket->async_read_some(boost::asio::buffer(aClient->mReadBuffer),
+                                      [this, aClient](const boost::system::error_code &aError, size_t aLength) {
+                                          HandleReceived(aClient, aError, aLength);
+                                      });
+}
+
+void StatusPush::HandleReceived(const ClientPtr &aClient, const boost::system::error_code &aError, size_t aLength)
+{
+    std::vector<uint8_t> &received = aClient->mReceived;
+
+    VerifyOrExit(!aError, Close(aClient));
+    received.insert(received.end(), aClient->mReadBuffer.begin(), aClient->mReadBuffer.begin() + aLength);
+
+    // Frames of clients are masked, the status is pushed regardless of what they send besides close and ping frames.
+    while (received.size() >= 2)
+    {
+        uint8_t     opcode = received[0] & 0x0f;
+        size_t      length = received[1] & 0x7f;
+        size_t      header = 2;
+        std::string payload;
+
+        VerifyOrExit((received[1] & 0x80) && length != 127, Close(aClient));
+
+        if (length == 126)
+        {
+            VerifyOrExit(received.size() >= 4);
+            length = static_cast<size_t>(received[2] << 8 | received[3]);
+            header = 4;
+        }
+
+        VerifyOrExit(length <= OTBR_WEB_STATUS_PUSH_MAX_FRAME, Close(aClient));
+        VerifyOrExit(received.size() >= header + 4 + length);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            payload.push_back(static_cast<char>(received[header + 4 + i] ^ received[header + (i & 3)]));
+        }
+
+        received.erase(received.begin(), received.begin() + static_cast<ptrdiff_t>(header + 4 + length));
+
+        if (opcode == kOpcodeClose)
+        {
+            aClient->mClosing = true;
+            Send(aClient, EncodeFrame(kOpcodeClose, payload.substr(0, 2)));
+            ExitNow();
+        }
+        else if (opcode == kOpcodePing)
+        {
+            Send(aClient, EncodeFrame(kOpcodePong, payload));
+        }
+    }
+
+exit:
+    if (!aError && aClient->mSocket->is_open() && !aClient->mClosing)
+    {
+        Receive(aClient);
+    }
+}
+
+void StatusPush::Close(const ClientPtr &aClient)
+{
+    boost::system::error_code error;
+
+    if (aClient->mSocket->is_open())
+    {
+        aClient->mSocket->shutdown(Socket::shutdown_both, error);
+        aClient->mSocket->close(error);
+    }
+
+    aClient->mFrames.clear();
+    mClients.remove(aClient);
+}
+
+void StatusPush::StartTimer(void)
+{
+    mTimer.expires_from_now(std::chrono::milliseconds(OTBR_WEB_STATUS_PUSH_INTERVAL));
+    mTimer.async_wait([this](const boost::system::error_code &aError) { HandleTimer(aError); });
+}
+
+void StatusPush::HandleTimer(const boost::system::error_code &aError)
+{
+    VerifyOrExit(aError != boost::asio::error::operation_aborted);
+
+    // The status is not read without clients, and read again by the next client.
+    VerifyOrExit(!mClients.empty(), mResponse = Json::Value());
+    ReadStatus();
+
+exit:
+    return;
+}
+
+void StatusPush::ReadStatus(void)
+{
+    mReading = true;
+    mStatusReader([this](const std::string &aStatus) { HandleStatus(aStatus); });
+}
+
+void StatusPush::HandleStatus(const std::string &aStatus)
+{
+    std::string          message;
+    bool                 changed = UpdateStatus(aStatus, message);
+    std::string          frame   = EncodeFrame(kOpcodeText, message);
+    std::string          full;
+    std::list<ClientPtr> clients;
+
+    mReading = false;
+
+    // The status is not read without clients, and read again by the next client.
+    VerifyOrExit(!mClients.empty(), mResponse = Json::Value());
+
+    // Clients too slow are removed while sending.
+    clients = mClients;
+
+    for (const ClientPtr &client : clients)
+    {
+        if (!client->mSynced)
+        {
+            if (full.empty())
+            {
+                full = EncodeFrame(kOpcodeText, GetFullStatus());
+            }
+
+            Send(client, full);
+            client->mSynced = true;
+        }
+        else if (changed)
+        {
+            Send(client, frame);
+        }
+    }
+
+    StartTimer();
+
+exit:
+    return;
+}
+
+std::string StatusPush::GetFullStatus(void) const
+{
+    Json::FastWriter writer;
+    Json::Value      response = mResponse;
+
+    response["full"] = true;
+
+    return writer.write(response);
+}
+
+bool StatusPush::UpdateStatus(const std::string &aStatus, std::string &aMessage)
+{
+    Json::Reader     reader;
+    Json::FastWriter writer;
+    Json::Value      response;
+    Json::Value      message;
+    bool             changed = false;
+
+    if (!reader.parse(aStatus, response) || !response.isObject())
+    {
+        response          = Json::Value(Json::objectValue);
+        response["error"] = -1;
+    }
+
+    if (mResponse.isNull() || !mResponse["result"].isObject() || !response["result"].isObject() ||
+        response["error"] != mResponse["error"])
+    {
+        changed         = (response != mResponse);
+        message         = response;
+        message["full"] = true;
+    }
+    else
+    {
+        const Json::Value &previous = mResponse["result"];
+        const Json::Value &current  = response["result"];
+        Json::Value        diff(Json::objectValue);
+        Json::Value        removed(Json::arrayValue);
+
+        for (const std::string &name : current.getMemberNames())
+        {
+            if (!previous.isMember(name) || previous[name] != current[name])
+            {
+                diff[name] = current[name];
+            }
+        }
+
+        for (const std::string &name : previous.getMemberNames())
+        {
+            if (!current.isMember(name))
+            {
+                removed.append(name);
+            }
+        }
+
+        changed            = !diff.empty() || !removed.empty();
+        message["error"]   = response["error"];
+        message["result"]  = diff;
+        message["removed"] = removed;
+    }
+
+    mResponse = std::move(response);
+    aMessage  = writer.write(message);
+
+    return changed;
+}
+
+} // namespace Web
+} // namespace otbr
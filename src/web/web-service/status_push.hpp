@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for pushing the status of the web service to WebSocket clients.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_STATUS_PUSH_HPP_
+#define OTBR_WEB_WEB_SERVICE_STATUS_PUSH_HPP_
+
+#include "openthread-br/config.h"
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <json/json.h>
+
+#ifndef OTBR_WEB_STATUS_PUSH_INTERVAL
+#define OTBR_WEB_STATUS_PUSH_INTERVAL 2000 ///< Milliseconds between two reads of the status while a client is open.
+#endif
+
+#ifndef OTBR_WEB_STATUS_PUSH_MAX_CLIENTS
+#define OTBR_WEB_STATUS_PUSH_MAX_CLIENTS 32 ///< Further WebSocket clients are rejected with 503.
+#endif
+
+#ifndef OTBR_WEB_STATUS_PUSH_MAX_QUEUED
+#define OTBR_WEB_STATUS_PUSH_MAX_QUEUED 8 ///< A client with more messages not sent yet is closed as too slow.
+#endif
+
+#ifndef OTBR_WEB_STATUS_PUSH_MAX_FRAME
+#define OTBR_WEB_STATUS_PUSH_MAX_FRAME 1024 ///< A client sending a larger frame is closed, it is not expected to send.
+#endif
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class pushes the status of the web service to WebSocket clients.
+ *
+ * The status is read once per OTBR_WEB_STATUS_PUSH_INTERVAL while a client is open, however many clients are open,
+ * and is not read at all without clients. A client receives the whole status when it opens, then the members which
+ * changed only, as a JSON object like the response of the status request, with the names of the removed members in
+ * "removed".
+ *
+ * All methods and handlers run on the thread of the io service, the status is read elsewhere, e.g. on a worker thread,
+ * so that reading it doesn't block the web server.
+ *
+ */
+class StatusPush
+{
+public:
+    typedef boost::asio::ip::tcp::socket Socket;
+    typedef std::function<void(const std::string &)> StatusHandler;
+    typedef std::function<void(StatusHandler)> StatusReader;
+
+    /**
+     * This constructor initializes the status push.
+     *
+     * @param[in]   aIoService      The io service of the web server.
+     * @param[in]   aStatusReader   The function reading the status response, which passes it as serialized JSON to the
+     *                              handler on the thread of the io service.
+     *
+     */
+    StatusPush(boost::asio::io_service &aIoService, StatusReader aStatusReader);
+
+    /**
+     * This method completes the WebSocket handshake of an upgraded HTTP connection and pushes the status to it.
+     *
+     * @param[in]   aSocket     The socket of the HTTP connection, whose upgrade request is read.
+     * @param[in]   aKey        The value of the Sec-WebSocket-Key header of the upgrade request.
+     *
+     */
+    void AddClient(const std::shared_ptr<Socket> &aSocket, const std::string &aKey);
+
+    /**
+     * This method returns the value of the Sec-WebSocket-Accept header answering a Sec-WebSocket-Key header.
+     *
+     * @param[in]   aKey    The value of the Sec-WebSocket-Key header.
+     *
+     * @returns The value of the Sec-WebSocket-Accept header, empty on failure.
+     *
+     */
+    static std::string ComputeAcceptKey(const std::string &aKey);
+
+    /**
+     * This method encodes a message into an unmasked WebSocket frame.
+     *
+     * @param[in]   aOpcode     The opcode of the frame.
+     * @param[in]   aPayload    The payload of the frame.
+     *
+     * @returns The frame.
+     *
+     */
+    static std::string EncodeFrame(uint8_t aOpcode, const std::string &aPayload);
+
+    static constexpr uint8_t kOpcodeText  = 0x1; ///< A text frame.
+    static constexpr uint8_t kOpcodeClose = 0x8; ///< A close frame.
+    static constexpr uint8_t kOpcodePing  = 0x9; ///< A ping frame.
+    static constexpr uint8_t kOpcodePong  = 0xa; ///< A pong frame.
+
+private:
+    struct Client
+    {
+        std::shared_ptr<Socket>  mSocket;
+        std::deque<std::string>  mFrames; ///< The frames to be sent, the one in front is being sent.
+        std::vector<uint8_t>     mReceived;
+        std::array<uint8_t, 256> mReadBuffer;
+        bool                     mClosing; ///< Whether the socket is closed once the frames are sent.
+        bool                     mSynced;  ///< Whether the whole status was sent, the changes are sent next.
+    };
+
+    typedef std::shared_ptr<Client> ClientPtr;
+
+    void Send(const ClientPtr &aClient, std::string aFrame);
+    void HandleSent(const ClientPtr &aClient, const boost::system::error_code &aError);
+    void Receive(const ClientPtr &aClient);
+    void HandleReceived(const ClientPtr &aClient, const boost::system::error_code &aError, size_t aLength);
+    void Close(const ClientPtr &aClient);
+
+    void        WriteFront(const ClientPtr &aClient);
+    void        StartTimer(void);
+    void        HandleTimer(const boost::system::error_code &aError);
+    void        ReadStatus(void);
+    void        HandleStatus(const std::string &aStatus);
+    bool        UpdateStatus(const std::string &aStatus, std::string &aMessage);
+    std::string GetFullStatus(void) const;
+
+    boost::asio::steady_timer mTimer;
+    StatusReader              mStatusReader;
+    std::list<ClientPtr>      mClients;
+    Json::Value               mResponse; ///< The status response pushed last, null if it was not read yet.
+    bool                      mReading;  ///< Whether the status is being read.
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_STATUS_PUSH_HPP_
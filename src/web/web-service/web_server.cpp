@@ -33,12 +33,21 @@
 
 #include "web/web-service/web_server.hpp"
 
+#include <boost/algorithm/string.hpp>
 #define BOOST_NO_CXX11_SCOPED_ENUMS
 #include <boost/filesystem.hpp>
 #undef BOOST_NO_CXX11_SCOPED_ENUMS
 
+#include <inttypes.h>
+
 #include <server_http.hpp>
 
+#include "common/code_utils.hpp"
+#include "utils/etag.hpp"
+#if OTBR_ENABLE_GZIP
+#include "utils/gzip.hpp"
+#endif
+
 #define OT_ADD_PREFIX_PATH "^/add_prefix"
 #define OT_AVAILABLE_NETWORK_PATH "^/available_network$"
 #define OT_DELETE_PREFIX_PATH "^/delete_prefix"
@@ -47,19 +56,53 @@
 #define OT_JOIN_NETWORK_PATH "^/join_network$"
 #define OT_SET_NETWORK_PATH "^/settings$"
 #define OT_COMMISSIONER_START_PATH "^/commission$"
+#define OT_JOB_PATH "^/job/([0-9]+)$"
+#define OT_STATUS_PUSH_PATH "/status_push"
 #define OT_REQUEST_METHOD_GET "GET"
 #define OT_REQUEST_METHOD_POST "POST"
 #define OT_RESPONSE_SUCCESS_STATUS "HTTP/1.1 200 OK\r\n"
+#define OT_RESPONSE_NOT_MODIFIED_STATUS "HTTP/1.1 304 Not Modified"
 #define OT_RESPONSE_HEADER_LENGTH "Content-Length: "
 #define OT_RESPONSE_HEADER_CSS_TYPE "\r\nContent-Type: text/css"
+#define OT_RESPONSE_HEADER_GZIP_ENCODING "\r\nContent-Encoding: gzip"
+#define OT_RESPONSE_HEADER_VARY_ENCODING "\r\nVary: Accept-Encoding"
+#define OT_RESPONSE_HEADER_CACHE_CONTROL "\r\nCache-Control: "
+#define OT_RESPONSE_HEADER_LAST_MODIFIED "\r\nLast-Modified: "
+#define OT_RESPONSE_HEADER_ETAG "\r\nETag: "
 #define OT_RESPONSE_HEADER_TYPE "Content-Type: application/json\r\n charset=utf-8"
 #define OT_RESPONSE_PLACEHOLD "\r\n\r\n"
 #define OT_RESPONSE_FAILURE_STATUS "HTTP/1.1 400 Bad Request\r\n"
+#define OT_RESPONSE_UNAVAILABLE_STATUS "HTTP/1.1 503 Service Unavailable\r\n"
 #define OT_BUFFER_SIZE 1024
 
 namespace otbr {
 namespace Web {
 
+namespace {
+
+// The HTTP server, which serves the requests asking for an upgrade other than the status push as regular requests.
+class UpgradeServer : public HttpServer
+{
+public:
+    void ServeWithoutUpgrade(const std::shared_ptr<SimpleWeb::HTTP> &aSocket, const std::shared_ptr<Request> &aRequest)
+    {
+        aRequest->header.erase("Upgrade");
+        find_resource(aSocket, aRequest);
+    }
+};
+
+} // namespace
+
+static bool HasToken(const std::string &aList, const char *aToken)
+{
+    std::vector<std::string> tokens;
+
+    boost::split(tokens, aList, boost::is_any_of(","));
+
+    return std::any_of(tokens.begin(), tokens.end(),
+                       [aToken](const std::string &aItem) { return boost::iequals(boost::trim_copy(aItem), aToken); });
+}
+
 static void EscapeHtml(std::string &content)
 {
     std::string output;
@@ -94,12 +137,14 @@ static void EscapeHtml(std::string &content)
 }
 
 WebServer::WebServer(void)
-    : mServer(new HttpServer())
+    : mServer(new UpgradeServer())
 {
 }
 
 WebServer::~WebServer(void)
 {
+    // The worker threads post to the io service of the server.
+    mWorkerPool.reset();
     delete mServer;
 }
 
@@ -113,7 +158,7 @@ void WebServer::Init()
     }
 }
 
-void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort)
+void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort, uint32_t aWorkerThreads)
 {
     if (aListenAddr != nullptr)
     {
@@ -121,7 +166,13 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     }
     mServer->config.port = aPort;
     mWpanService.SetInterfaceName(aIfName);
+    // The status push shares the io service of the server, so that it runs on the thread of the server.
+    mServer->io_service = std::make_shared<boost::asio::io_service>();
+    mStatusPush.reset(new StatusPush(*mServer->io_service,
+                                     [this](StatusPush::StatusHandler aHandler) { ReadStatus(aHandler); }));
+    mWorkerPool.reset(new WorkerPool(*mServer->io_service, aWorkerThreads));
     Init();
+    LoadStaticFiles();
     ResponseJoinNetwork();
     ResponseFormNetwork();
     ResponseAddOnMeshPrefix();
@@ -129,6 +180,8 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     ResponseGetStatus();
     ResponseGetAvailableNetwork();
     ResponseCommission();
+    ResponseStatusPush();
+    ResponseJob();
     DefaultHttpResponse();
     mServer->start();
 }
@@ -142,22 +195,157 @@ void WebServer::HandleHttpRequest(const char *aUrl, const char *aMethod, HttpReq
 {
     mServer->resource[aUrl][aMethod] = [aCallback, this](std::shared_ptr<HttpServer::Response> response,
                                                          std::shared_ptr<HttpServer::Request>  request) {
-        try
-        {
-            std::string httpResponse;
-            if (aCallback != nullptr)
-            {
-                httpResponse = aCallback(request->content.string(), this);
-            }
+        std::shared_ptr<Job> job     = std::make_shared<Job>();
+        std::string          content = request->content.string();
+
+        // The response is sent once the completion releases it, on the thread of the server.
+        mWorkerPool->Post([this, aCallback, job, content]() { RunJob(*job, aCallback, content); },
+                          [response, job]() { WriteJobResponse(*response, *job); });
+    };
+}
 
+void WebServer::HandleJobRequest(const char *aUrl, HttpRequestCallback aCallback)
+{
+    mServer->resource[aUrl][OT_REQUEST_METHOD_POST] = [aCallback, this](std::shared_ptr<HttpServer::Response> response,
+                                                                        std::shared_ptr<HttpServer::Request> request) {
+        std::shared_ptr<Job> job     = std::make_shared<Job>();
+        std::string          content = request->content.string();
+        uint32_t             id;
+        Json::Value          root;
+        Json::FastWriter     jsonWriter;
+        std::string          httpResponse;
+
+        ExpireJobs();
+
+        if (mJobs.size() - mDoneJobs.size() >= OTBR_WEB_MAX_RUNNING_JOBS)
+        {
+            *response << OT_RESPONSE_UNAVAILABLE_STATUS << OT_RESPONSE_HEADER_LENGTH << 0 << OT_RESPONSE_PLACEHOLD;
+        }
+        else
+        {
+            id        = NewJobId();
+            mJobs[id] = job;
+            mWorkerPool->Post([this, aCallback, job, content]() { RunJob(*job, aCallback, content); },
+                              [this, id, job]() { HandleJobDone(id, *job); });
+
+            root["error"] = 0;
+            root["job"]   = id;
+            httpResponse  = jsonWriter.write(root);
             *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << httpResponse.length()
                       << OT_RESPONSE_PLACEHOLD << httpResponse;
-        } catch (std::exception &e)
+        }
+    };
+}
+
+void WebServer::RunJob(Job &aJob, HttpRequestCallback aCallback, const std::string &aRequest)
+{
+    // The WPAN service serializes the use of the session to otbr-agent, the other work of the jobs runs in parallel.
+    try
+    {
+        if (aCallback != nullptr)
         {
-            std::string content = e.what();
-            EscapeHtml(content);
-            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << strlen(e.what())
-                      << OT_RESPONSE_PLACEHOLD << content;
+            aJob.mResponse = aCallback(aRequest, this);
+        }
+        aJob.mSucceeded = true;
+    } catch (std::exception &e)
+    {
+        aJob.mResponse = e.what();
+        EscapeHtml(aJob.mResponse);
+        aJob.mSucceeded = false;
+    }
+}
+
+void WebServer::WriteJobResponse(std::ostream &aResponse, const Job &aJob)
+{
+    aResponse << (aJob.mSucceeded ? OT_RESPONSE_SUCCESS_STATUS : OT_RESPONSE_FAILURE_STATUS)
+              << OT_RESPONSE_HEADER_LENGTH << aJob.mResponse.length() << OT_RESPONSE_PLACEHOLD << aJob.mResponse;
+}
+
+void WebServer::HandleJobDone(uint32_t aId, Job &aJob)
+{
+    aJob.mDone     = true;
+    aJob.mDoneTime = std::chrono::steady_clock::now();
+    mDoneJobs.push_back(aId);
+
+    while (mDoneJobs.size() > OTBR_WEB_MAX_DONE_JOBS)
+    {
+        mJobs.erase(mDoneJobs.front());
+        mDoneJobs.pop_front();
+    }
+}
+
+void WebServer::ExpireJobs(void)
+{
+    auto expired = std::chrono::steady_clock::now() - std::chrono::seconds(OTBR_WEB_DONE_JOB_TIMEOUT);
+
+    while (!mDoneJobs.empty() && mJobs.find(mDoneJobs.front())->second->mDoneTime <= expired)
+    {
+        mJobs.erase(mDoneJobs.front());
+        mDoneJobs.pop_front();
+    }
+}
+
+uint32_t WebServer::NewJobId(void)
+{
+    uint32_t id;
+
+    do
+    {
+        id = static_cast<uint32_t>(mRandom());
+    } while (id == 0 || mJobs.count(id) != 0);
+
+    return id;
+}
+
+void WebServer::ReadStatus(const StatusPush::StatusHandler &aHandler)
+{
+    std::shared_ptr<std::string> status = std::make_shared<std::string>(mStatus);
+
+    // The status is read on a worker thread, and is not read again while a job is using the Thread interface.
+    mWorkerPool->Post([this, status]() { mWpanService.TryHandleStatusRequest(*status); },
+                      [this, status, aHandler]() {
+                          mStatus = *status;
+                          aHandler(mStatus);
+                      });
+}
+
+void WebServer::ResponseJob(void)
+{
+    mServer->resource[OT_JOB_PATH][OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
+                                                                   std::shared_ptr<HttpServer::Request>  request) {
+        uint32_t         id = static_cast<uint32_t>(strtoul(request->path_match[1].str().c_str(), nullptr, 10));
+        Json::Value      root;
+        Json::Reader     reader;
+        Json::FastWriter jsonWriter;
+        Job              status;
+        auto             job = mJobs.end();
+
+        ExpireJobs();
+        job = mJobs.find(id);
+
+        if (job == mJobs.end())
+        {
+            status.mResponse = "no such job";
+            WriteJobResponse(*response, status);
+        }
+        else if (!job->second->mDone)
+        {
+            root["job"]      = id;
+            root["state"]    = "running";
+            status.mResponse = jsonWriter.write(root);
+            WriteJobResponse(*response, status);
+        }
+        else if (!job->second->mSucceeded || !reader.parse(job->second->mResponse, root) || !root.isObject())
+        {
+            WriteJobResponse(*response, *job->second);
+        }
+        else
+        {
+            // The response of a done job is the response of its request, with the job and its state.
+            root["job"]      = id;
+            root["state"]    = "done";
+            status.mResponse = jsonWriter.write(root);
+            WriteJobResponse(*response, status);
         }
     };
 }
@@ -195,49 +383,79 @@ void WebServer::DefaultHttpResponse(void)
                                                               std::shared_ptr<HttpServer::Request>  request) {
         try
         {
-            auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
-            auto path        = boost::filesystem::canonical(webRootPath / request->path);
-            // Check if path is within webRootPath
-            if (std::distance(webRootPath.begin(), webRootPath.end()) > std::distance(path.begin(), path.end()) ||
-                !std::equal(webRootPath.begin(), webRootPath.end(), path.begin()))
-            {
-                throw std::invalid_argument("path must be within root path");
-            }
-            if (boost::filesystem::is_directory(path))
-            {
-                path /= "index.html";
-            }
-            if (!(boost::filesystem::exists(path) && boost::filesystem::is_regular_file(path)))
-            {
-                throw std::invalid_argument("file does not exist");
-            }
-
-            std::string cacheControl, etag;
+            std::string   path;
+            StaticFilePtr file = GetStaticFile(request->path, path);
 
-            auto ifs = std::make_shared<std::ifstream>();
-            ifs->open(path.string(), std::ifstream::in | std::ios::binary | std::ios::ate);
-            std::string extension = boost::filesystem::extension(path.string());
-            std::string style     = "";
-            if (extension == ".css")
+            if (file != nullptr)
             {
-                style = OT_RESPONSE_HEADER_CSS_TYPE;
-            }
-
-            if (*ifs)
-            {
-                auto length = ifs->tellg();
-                ifs->seekg(0, std::ios::beg);
+                const std::string *content       = &file->mContent;
+                const std::string *etag          = &file->mETag;
+                const char *       encoding      = "";
+                bool               notModified   = false;
+                auto               ifNoneMatch   = request->header.find("If-None-Match");
+                auto               modifiedSince = request->header.find("If-Modified-Since");
+
+#if OTBR_ENABLE_GZIP
+                auto acceptEncoding = request->header.find("Accept-Encoding");
+
+                if (!file->mGzipContent.empty() && acceptEncoding != request->header.end() &&
+                    Utils::AcceptsGzip(acceptEncoding->second))
+                {
+                    content  = &file->mGzipContent;
+                    etag     = &file->mGzipETag;
+                    encoding = OT_RESPONSE_HEADER_GZIP_ENCODING;
+                }
+#endif
 
-                *response << OT_RESPONSE_SUCCESS_STATUS << cacheControl << etag << OT_RESPONSE_HEADER_LENGTH << length
-                          << style << OT_RESPONSE_PLACEHOLD;
+                // If-Modified-Since is only considered without If-None-Match, and matched as the date it was sent.
+                if (ifNoneMatch != request->header.end())
+                {
+                    notModified = Utils::IsETagMatched(ifNoneMatch->second, *etag);
+                }
+                else if (modifiedSince != request->header.end())
+                {
+                    notModified = modifiedSince->second == file->mLastModified;
+                }
 
-                DefaultResourceSend(*mServer, response, ifs);
+                // A not modified response has no body, and no Content-Length which would be the one of the file.
+                if (notModified)
+                {
+                    *response << OT_RESPONSE_NOT_MODIFIED_STATUS << file->mHeaders << encoding
+                              << OT_RESPONSE_HEADER_ETAG << *etag << OT_RESPONSE_PLACEHOLD;
+                }
+                else
+                {
+                    *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << content->length()
+                              << file->mHeaders << encoding << OT_RESPONSE_HEADER_ETAG << *etag << OT_RESPONSE_PLACEHOLD
+                              << *content;
+                }
             }
             else
             {
-                throw std::invalid_argument("could not read file");
-            }
+                auto ifs = std::make_shared<std::ifstream>();
+                ifs->open(path, std::ifstream::in | std::ios::binary | std::ios::ate);
+                std::string extension = boost::filesystem::extension(path);
+                std::string style     = "";
+                if (extension == ".css")
+                {
+                    style = OT_RESPONSE_HEADER_CSS_TYPE;
+                }
 
+                if (*ifs)
+                {
+                    auto length = ifs->tellg();
+                    ifs->seekg(0, std::ios::beg);
+
+                    *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << length << style
+                              << OT_RESPONSE_PLACEHOLD;
+
+                    DefaultResourceSend(*mServer, response, ifs);
+                }
+                else
+                {
+                    throw std::invalid_argument("could not read file");
+                }
+            }
         } catch (const std::exception &e)
         {
             std::string content = "Could not open path `" + request->path + "`: " + e.what();
@@ -248,6 +466,200 @@ void WebServer::DefaultHttpResponse(void)
     };
 }
 
+void WebServer::LoadStaticFiles(void)
+{
+    boost::system::error_code ec;
+    auto                      webRoot = boost::filesystem::canonical(WEB_FILE_PATH, ec);
+    std::string               root    = webRoot.string();
+
+    VerifyOrExit(!ec, otbrLog(OTBR_LOG_WARNING, "Failed to find the web root: %s", ec.message().c_str()));
+
+    // Directory links are not followed, so the paths iterated are the request paths of the files.
+    for (boost::filesystem::recursive_directory_iterator it(webRoot, ec), end; !ec && it != end; it.increment(ec))
+    {
+        std::string   requestPath = it->path().string().substr(root.length());
+        StaticFilePtr file;
+
+        // A precompressed file is loaded as the gzip variant of the file next to it.
+        if (!boost::filesystem::is_regular_file(it->status()) ||
+            (it->path().extension() == ".gz" &&
+             boost::filesystem::exists(it->path().parent_path() / it->path().stem())))
+        {
+            continue;
+        }
+
+        file        = std::make_shared<StaticFile>();
+        file->mPath = boost::filesystem::canonical(it->path(), ec).string();
+
+        // A link to a file out of the web root is not served.
+        if (ec || file->mPath.compare(0, root.length() + 1, root + "/") != 0 || !LoadStaticFile(*file))
+        {
+            ec.clear();
+            continue;
+        }
+
+        mStaticFiles[requestPath] = file;
+
+        if (it->path().filename() == "index.html")
+        {
+            std::string directory = requestPath.substr(0, requestPath.length() - sizeof("index.html") + 1);
+
+            mStaticFiles[directory] = file;
+            if (directory.length() > 1)
+            {
+                directory.pop_back();
+                mStaticFiles[directory] = file;
+            }
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "Cached %zu static file paths", mStaticFiles.size());
+
+exit:
+    return;
+}
+
+WebServer::StaticFilePtr WebServer::GetStaticFile(const std::string &aRequestPath, std::string &aPath)
+{
+    auto          found = mStaticFiles.find(aRequestPath);
+    StaticFilePtr file;
+
+    if (found == mStaticFiles.end())
+    {
+        auto        webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
+        auto        path        = boost::filesystem::canonical(webRootPath / aRequestPath);
+        std::string requestPath;
+
+        // Check if path is within webRootPath
+        if (std::distance(webRootPath.begin(), webRootPath.end()) > std::distance(path.begin(), path.end()) ||
+            !std::equal(webRootPath.begin(), webRootPath.end(), path.begin()))
+        {
+            throw std::invalid_argument("path must be within root path");
+        }
+        if (boost::filesystem::is_directory(path))
+        {
+            path /= "index.html";
+        }
+        if (!(boost::filesystem::exists(path) && boost::filesystem::is_regular_file(path)))
+        {
+            throw std::invalid_argument("file does not exist");
+        }
+
+        // The file is cached by its canonical request path, other paths of the file are resolved on each request.
+        aPath       = path.string();
+        requestPath = aPath.substr(webRootPath.string().length());
+        found       = mStaticFiles.find(requestPath);
+
+        if (found == mStaticFiles.end())
+        {
+            file        = std::make_shared<StaticFile>();
+            file->mPath = aPath;
+            VerifyOrExit(LoadStaticFile(*file), file = nullptr);
+            mStaticFiles[requestPath] = file;
+            ExitNow();
+        }
+    }
+
+    file = found->second;
+
+    if (std::chrono::steady_clock::now() - file->mChecked >= std::chrono::seconds(OTBR_WEB_STATIC_CHECK_INTERVAL))
+    {
+        boost::system::error_code ec;
+        time_t                    modified = boost::filesystem::last_write_time(file->mPath, ec);
+        uintmax_t                 length   = ec ? 0 : boost::filesystem::file_size(file->mPath, ec);
+
+        file->mChecked = std::chrono::steady_clock::now();
+
+        if (ec || modified != file->mModified || length != file->mLength)
+        {
+            aPath = file->mPath;
+
+            if (!LoadStaticFile(*file))
+            {
+                // The file is served from the disk from now on, or an error if it was removed.
+                for (auto it = mStaticFiles.begin(); it != mStaticFiles.end();)
+                {
+                    it = (it->second == file) ? mStaticFiles.erase(it) : std::next(it);
+                }
+                file = nullptr;
+            }
+        }
+    }
+
+exit:
+    return file;
+}
+
+bool WebServer::LoadStaticFile(StaticFile &aFile)
+{
+    bool                      ret = false;
+    boost::system::error_code ec;
+    std::ifstream             ifs;
+    char                      buffer[64];
+    struct tm                 modified;
+
+    aFile.mChecked  = std::chrono::steady_clock::now();
+    aFile.mModified = boost::filesystem::last_write_time(aFile.mPath, ec);
+    VerifyOrExit(!ec);
+    aFile.mLength = boost::filesystem::file_size(aFile.mPath, ec);
+    VerifyOrExit(!ec);
+    VerifyOrExit(aFile.mLength <= OTBR_WEB_STATIC_MAX_CACHED_LENGTH);
+
+    ifs.open(aFile.mPath, std::ifstream::in | std::ios::binary);
+    VerifyOrExit(ifs.is_open());
+    aFile.mContent.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    VerifyOrExit(!ifs.bad());
+
+    snprintf(buffer, sizeof(buffer), "\"%" PRIxMAX "-%" PRIxMAX "\"", aFile.mLength,
+             static_cast<uintmax_t>(aFile.mModified));
+    aFile.mETag = buffer;
+
+    VerifyOrExit(gmtime_r(&aFile.mModified, &modified) != nullptr);
+    strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S GMT", &modified);
+    aFile.mLastModified = buffer;
+
+    aFile.mHeaders = OT_RESPONSE_HEADER_CACHE_CONTROL OTBR_WEB_STATIC_CACHE_CONTROL OT_RESPONSE_HEADER_LAST_MODIFIED;
+    aFile.mHeaders += aFile.mLastModified;
+    if (boost::filesystem::extension(aFile.mPath) == ".css")
+    {
+        aFile.mHeaders += OT_RESPONSE_HEADER_CSS_TYPE;
+    }
+
+#if OTBR_ENABLE_GZIP
+    {
+        std::string precompressed = aFile.mPath + ".gz";
+
+        aFile.mGzipContent.clear();
+
+        if (boost::filesystem::is_regular_file(precompressed, ec) &&
+            boost::filesystem::last_write_time(precompressed, ec) >= aFile.mModified)
+        {
+            std::ifstream gzip(precompressed, std::ifstream::in | std::ios::binary);
+
+            aFile.mGzipContent.assign(std::istreambuf_iterator<char>(gzip), std::istreambuf_iterator<char>());
+        }
+        else if (aFile.mContent.size() >= OTBR_WEB_GZIP_MIN_LENGTH &&
+                 (!Utils::GzipCompress(aFile.mContent.data(), aFile.mContent.size(), aFile.mGzipContent) ||
+                  aFile.mGzipContent.size() >= aFile.mContent.size()))
+        {
+            aFile.mGzipContent.clear();
+        }
+
+        if (!aFile.mGzipContent.empty())
+        {
+            aFile.mGzipETag = aFile.mETag;
+            aFile.mGzipETag.insert(aFile.mGzipETag.length() - 1, "-gzip");
+            aFile.mHeaders += OT_RESPONSE_HEADER_VARY_ENCODING;
+        }
+    }
+#endif
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
 std::string WebServer::HandleJoinNetworkRequest(const std::string &aJoinRequest, void *aUserData)
 {
     WebServer *webServer = static_cast<WebServer *>(aUserData);
@@ -300,12 +712,12 @@ std::string WebServer::HandleCommission(const std::string &aCommissionRequest, v
 
 void WebServer::ResponseJoinNetwork(void)
 {
-    HandleHttpRequest(OT_JOIN_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleJoinNetworkRequest);
+    HandleJobRequest(OT_JOIN_NETWORK_PATH, HandleJoinNetworkRequest);
 }
 
 void WebServer::ResponseFormNetwork(void)
 {
-    HandleHttpRequest(OT_FORM_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleFormNetworkRequest);
+    HandleJobRequest(OT_FORM_NETWORK_PATH, HandleFormNetworkRequest);
 }
 
 void WebServer::ResponseAddOnMeshPrefix(void)
@@ -330,7 +742,38 @@ void WebServer::ResponseGetAvailableNetwork(void)
 
 void WebServer::ResponseCommission(void)
 {
-    HandleHttpRequest(OT_COMMISSIONER_START_PATH, OT_REQUEST_METHOD_POST, HandleCommission);
+    HandleJobRequest(OT_COMMISSIONER_START_PATH, HandleCommission);
+}
+
+void WebServer::ResponseStatusPush(void)
+{
+    mServer->on_upgrade = [this](std::shared_ptr<SimpleWeb::HTTP>      socket,
+                                 std::shared_ptr<HttpServer::Request> request) {
+        auto        upgrade    = request->header.find("Upgrade");
+        auto        connection = request->header.find("Connection");
+        auto        version    = request->header.find("Sec-WebSocket-Version");
+        auto        key        = request->header.find("Sec-WebSocket-Key");
+        std::string acceptedKey;
+
+        // Other upgrades, e.g. to HTTP/2, are ignored as HTTP/1.1 allows, and the request is served as usual.
+        if (request->path != OT_STATUS_PUSH_PATH || upgrade == request->header.end() ||
+            !HasToken(upgrade->second, "websocket"))
+        {
+            static_cast<UpgradeServer *>(mServer)->ServeWithoutUpgrade(socket, request);
+        }
+        else
+        {
+            // A WebSocket handshake missing a header is answered with 400 Bad Request.
+            if (request->method == OT_REQUEST_METHOD_GET && connection != request->header.end() &&
+                HasToken(connection->second, "upgrade") && version != request->header.end() &&
+                version->second == "13" && key != request->header.end())
+            {
+                acceptedKey = key->second;
+            }
+
+            mStatusPush->AddClient(socket, acceptedKey);
+        }
+    };
 }
 
 std::string WebServer::HandleJoinNetworkRequest(const std::string &aJoinRequest)
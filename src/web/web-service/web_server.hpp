@@ -37,16 +37,25 @@
 #include "openthread-br/config.h"
 
 #include <algorithm>
+#include <chrono>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <string>
 #include <vector>
 
 #include <net/if.h>
 #include <syslog.h>
+#include <time.h>
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include "web/web-service/status_push.hpp"
+#include "web/web-service/worker_pool.hpp"
 #include "web/web-service/wpan_service.hpp"
 
 namespace SimpleWeb {
@@ -59,6 +68,34 @@ namespace Web {
 
 typedef SimpleWeb::Server<SimpleWeb::HTTP> HttpServer;
 
+#ifndef OTBR_WEB_GZIP_MIN_LENGTH
+#define OTBR_WEB_GZIP_MIN_LENGTH 1024 ///< Smaller static files are not worth compressing.
+#endif
+
+#ifndef OTBR_WEB_STATIC_MAX_CACHED_LENGTH
+#define OTBR_WEB_STATIC_MAX_CACHED_LENGTH (1024 * 1024) ///< Larger static files are read from the disk per request.
+#endif
+
+#ifndef OTBR_WEB_STATIC_CHECK_INTERVAL
+#define OTBR_WEB_STATIC_CHECK_INTERVAL 60 ///< Seconds a cached static file is served before checking its modification.
+#endif
+
+#ifndef OTBR_WEB_STATIC_CACHE_CONTROL
+#define OTBR_WEB_STATIC_CACHE_CONTROL "no-cache" ///< Browsers revalidate static files with the ETag.
+#endif
+
+#ifndef OTBR_WEB_MAX_DONE_JOBS
+#define OTBR_WEB_MAX_DONE_JOBS 16 ///< The responses of older done jobs are dropped.
+#endif
+
+#ifndef OTBR_WEB_MAX_RUNNING_JOBS
+#define OTBR_WEB_MAX_RUNNING_JOBS 16 ///< Further job requests are rejected with 503 until a job is done.
+#endif
+
+#ifndef OTBR_WEB_DONE_JOB_TIMEOUT
+#define OTBR_WEB_DONE_JOB_TIMEOUT 300 ///< Seconds the response of a done job is kept for the client to poll it.
+#endif
+
 /**
  * This class implements the http server.
  *
@@ -81,12 +118,13 @@ public:
     /**
      * This method starts the Web Server.
      *
-     * @param[in]  aIfName     The pointer to the Thread interface name.
-     * @param[in]  aListenAddr The http server listen address, can be nullptr for any address.
-     * @param[in]  aPort       The port of http server.
+     * @param[in]  aIfName         The pointer to the Thread interface name.
+     * @param[in]  aListenAddr     The http server listen address, can be nullptr for any address.
+     * @param[in]  aPort           The port of http server.
+     * @param[in]  aWorkerThreads  The number of threads running the requests which reach the Thread interface.
      *
      */
-    void StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort);
+    void StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort, uint32_t aWorkerThreads);
 
     /**
      * This method stops the Web Server.
@@ -113,7 +151,41 @@ private:
     std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest);
     std::string HandleCommission(const std::string &aCommissionRequest);
 
+    struct Job
+    {
+        Job(void)
+            : mSucceeded(false)
+            , mDone(false)
+        {
+        }
+
+        std::string                           mResponse;  ///< The content of the response, or the exception.
+        bool                                  mSucceeded; ///< Whether the request was handled without an exception.
+        bool                                  mDone;      ///< Whether the job is done, only accessed by the server.
+        std::chrono::steady_clock::time_point mDoneTime;  ///< The time the job was done.
+    };
+
+    /**
+     * This method handles a request on a worker thread, and responds once it is handled.
+     *
+     */
     void HandleHttpRequest(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback);
+
+    /**
+     * This method starts a job handling a POST request on a worker thread, and responds with the job ID at once.
+     *
+     * The client polls the job at OT_JOB_PATH until it is done, then gets the response of the request.
+     *
+     */
+    void HandleJobRequest(const char *aUrl, HttpRequestCallback aCallback);
+
+    void        RunJob(Job &aJob, HttpRequestCallback aCallback, const std::string &aRequest);
+    void        HandleJobDone(uint32_t aId, Job &aJob);
+    void        ExpireJobs(void);
+    uint32_t    NewJobId(void);
+    void        ReadStatus(const StatusPush::StatusHandler &aHandler);
+    static void WriteJobResponse(std::ostream &aResponse, const Job &aJob);
+
     void ResponseJoinNetwork(void);
     void ResponseFormNetwork(void);
     void ResponseAddOnMeshPrefix(void);
@@ -122,11 +194,76 @@ private:
     void ResponseGetAvailableNetwork(void);
     void DefaultHttpResponse(void);
     void ResponseCommission(void);
+    void ResponseStatusPush(void);
+    void ResponseJob(void);
 
     void Init(void);
 
-    HttpServer *           mServer;
-    otbr::Web::WpanService mWpanService;
+    struct StaticFile
+    {
+        std::string                           mPath;     ///< The canonical path of the file.
+        time_t                                mModified; ///< The modification time of the cached content.
+        uintmax_t                             mLength;   ///< The length of the file when it was cached.
+        std::chrono::steady_clock::time_point mChecked;  ///< The time the modification was last checked.
+        std::string                           mContent;
+        std::string                           mETag;
+        std::string                           mLastModified;
+        std::string                           mHeaders; ///< The headers shared by both variants, each led by CRLF.
+#if OTBR_ENABLE_GZIP
+        std::string mGzipContent; ///< Empty if the file is too small or does not compress.
+        std::string mGzipETag;
+#endif
+    };
+
+    typedef std::shared_ptr<StaticFile> StaticFilePtr;
+
+    /**
+     * This method caches all the static files under the web root, in order to serve them without disk access.
+     *
+     */
+    void LoadStaticFiles(void);
+
+    /**
+     * This method returns the cached static file of a request path.
+     *
+     * The file is cached on the first request if it was not cached at start up, and the content is reloaded when the
+     * file is found modified, which is checked at most every OTBR_WEB_STATIC_CHECK_INTERVAL seconds.
+     *
+     * @param[in]   aRequestPath  The path of the request.
+     * @param[out]  aPath         The canonical path of the file, set if it is not cached.
+     *
+     * @returns The cached file, or nullptr if the file is too large to be cached.
+     *
+     * @throws std::invalid_argument  The path is not a file within the web root.
+     *
+     */
+    StaticFilePtr GetStaticFile(const std::string &aRequestPath, std::string &aPath);
+
+    /**
+     * This method reads a static file and builds its response headers and variants.
+     *
+     * A `.gz` file next to the static file is used as the gzip variant if it is up to date, otherwise the file is
+     * compressed.
+     *
+     * @param[inout]  aFile  The static file, whose path is set.
+     *
+     * @retval  true     Successfully cached the file.
+     * @retval  false    The file could not be read or is too large to be cached.
+     *
+     */
+    bool LoadStaticFile(StaticFile &aFile);
+
+    std::map<std::string, StaticFilePtr> mStaticFiles; ///< Files by request path, safe when server is on one thread.
+
+    HttpServer *                mServer;
+    otbr::Web::WpanService      mWpanService;
+    std::string                 mStatus; ///< The status read last by the status push.
+    std::unique_ptr<StatusPush> mStatusPush;
+    std::unique_ptr<WorkerPool> mWorkerPool;
+
+    std::map<uint32_t, std::shared_ptr<Job>> mJobs;     ///< Jobs by ID, only accessed on the thread of the server.
+    std::deque<uint32_t>                     mDoneJobs; ///< The IDs of the done jobs, from the oldest.
+    std::random_device                       mRandom;   ///< Job IDs are random, a client cannot poll other jobs.
 };
 
 } // namespace Web
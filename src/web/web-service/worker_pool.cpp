@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the worker thread pool of the web service.
+ */
+
+#include "web/web-service/worker_pool.hpp"
+
+namespace otbr {
+namespace Web {
+
+WorkerPool::WorkerPool(boost::asio::io_service &aIoService, uint32_t aThreadNum)
+    : mIoService(aIoService)
+    , mStopping(false)
+{
+    do
+    {
+        mThreads.emplace_back(&WorkerPool::Run, this);
+    } while (mThreads.size() < aThreadNum);
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+    }
+    mCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void WorkerPool::Post(Task aWork, Task aDone)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mPendingJobs.push_back(Job{std::move(aWork), std::move(aDone)});
+    }
+    mCondition.notify_one();
+}
+
+void WorkerPool::Run(void)
+{
+    while (true)
+    {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondition.wait(lock, [this] { return mStopping || !mPendingJobs.empty(); });
+            if (mStopping)
+            {
+                break;
+            }
+
+            job = std::move(mPendingJobs.front());
+            mPendingJobs.pop_front();
+        }
+
+        job.mWork();
+
+        // The completion is moved, so that what it captures is only released on the thread of the io service.
+        mIoService.post(std::move(job.mDone));
+    }
+}
+
+} // namespace Web
+} // namespace otbr
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the worker thread pool of the web service.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_WORKER_POOL_HPP_
+#define OTBR_WEB_WEB_SERVICE_WORKER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+
+#ifndef OTBR_WEB_WORKER_THREADS
+#define OTBR_WEB_WORKER_THREADS 1 ///< Threads running the requests which reach the Thread interface.
+#endif
+
+#ifndef OTBR_WEB_MAX_WORKER_THREADS
+#define OTBR_WEB_MAX_WORKER_THREADS 64 ///< The largest number of worker threads accepted by `-w`.
+#endif
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class implements a pool of worker threads for requests blocking on the Thread interface.
+ *
+ * Jobs are posted from the thread of the io service. The work of a job runs on a worker thread, then its completion
+ * is posted back to the io service, so that everything shared with the web server is only accessed by the completion.
+ *
+ */
+class WorkerPool
+{
+public:
+    typedef std::function<void(void)> Task;
+
+    /**
+     * This constructor starts the worker threads.
+     *
+     * @param[in]   aIoService  The io service running the completions.
+     * @param[in]   aThreadNum  The number of worker threads, at least one thread is started.
+     *
+     */
+    WorkerPool(boost::asio::io_service &aIoService, uint32_t aThreadNum);
+
+    /**
+     * This destructor waits for the work being done, the jobs not started yet are dropped.
+     *
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method posts a job.
+     *
+     * @param[in]   aWork   The work done on a worker thread.
+     * @param[in]   aDone   The completion run on the thread of the io service after @p aWork is done.
+     *
+     */
+    void Post(Task aWork, Task aDone);
+
+private:
+    struct Job
+    {
+        Task mWork;
+        Task mDone;
+    };
+
+    void Run(void);
+
+    boost::asio::io_service &mIoService;
+    std::vector<std::thread> mThreads;
+    std::mutex               mMutex;
+    std::condition_variable  mCondition;
+    std::deque<Job>          mPendingJobs;
+    bool                     mStopping;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_WORKER_POOL_HPP_
@@ -40,6 +40,8 @@
 
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "utils/active_dataset.hpp"
+#include "utils/strcpy_utils.hpp"
 
 namespace otbr {
 namespace Web {
@@ -52,18 +54,16 @@ const char *WpanService::kBorderAgentPort = "49191";
 
 std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinRequest)
 {
-    Json::Value                 root;
-    Json::Reader                reader;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         index;
-    std::string                 masterKey;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value                  root;
+    Json::Reader                 reader;
+    Json::FastWriter             jsonWriter;
+    std::string                  response;
+    int                          index;
+    std::string                  masterKey;
+    std::string                  prefix;
+    bool                         defaultRoute;
+    int                          ret = kWpanStatus_Ok;
+    std::unique_lock<std::mutex> session(mSessionMutex, std::defer_lock);
 
     VerifyOrExit(reader.parse(aJoinRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     index        = root["index"].asUInt();
@@ -76,12 +76,15 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
-    VerifyOrExit((ret = commitActiveDataset(client, masterKey, mNetworks[index].mNetworkName, mNetworks[index].mChannel,
-                                            mNetworks[index].mExtPanId, mNetworks[index].mPanId)) == kWpanStatus_Ok);
-    VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    session.lock();
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.FactoryReset(), ret = kWpanStatus_LeaveFailed);
+    VerifyOrExit((ret = commitActiveDataset(mClient, masterKey, mNetworks[index].mNetworkName,
+                                            mNetworks[index].mChannel, mNetworks[index].mExtPanId,
+                                            mNetworks[index].mPanId)) == kWpanStatus_Ok);
+    VerifyOrExit(mClient.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+    VerifyOrExit(mClient.Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
+    VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
 
@@ -100,25 +103,27 @@ exit:
 
 std::string WpanService::HandleFormNetworkRequest(const std::string &aFormRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    otbr::Psk::Pskc             psk;
-    char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
-    uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
-    std::string                 masterKey;
-    std::string                 prefix;
-    uint16_t                    channel = 0;
-    std::string                 networkName;
-    std::string                 passphrase;
-    uint16_t                    panId;
-    uint64_t                    extPanId;
-    bool                        defaultRoute = false;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    otbr::Psk::Pskc              psk;
+    const uint8_t *              pskc;
+    char                         pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
+    uint8_t                      extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
+    std::string                  masterKey;
+    std::string                  prefix;
+    uint16_t                     channel = 0;
+    std::string                  networkName;
+    std::string                  passphrase;
+    uint16_t                     panId;
+    uint64_t                     extPanId;
+    bool                         defaultRoute = false;
+    int                          ret = kWpanStatus_Ok;
+    std::unique_lock<std::mutex> session(mSessionMutex, std::defer_lock);
+#if OTBR_ENABLE_DBUS_SERVER
+    std::vector<uint8_t> datasetTlvs;
+#endif
 
     pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
     VerifyOrExit(reader.parse(aFormRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -133,21 +138,32 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     defaultRoute = root["defaultRoute"].asBool();
 
     otbr::Utils::Hex2Bytes(root["extPanId"].asString().c_str(), extPanIdBytes, OT_EXTENDED_PANID_LENGTH);
-    otbr::Utils::Bytes2Hex(psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str()), OT_PSKC_MAX_LENGTH,
-                           pskcStr);
+    pskc = psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str());
+    otbr::Utils::Bytes2Hex(pskc, OT_PSKC_MAX_LENGTH, pskcStr);
 
     if (prefix.find('/') == std::string::npos)
     {
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
-    VerifyOrExit((ret = commitActiveDataset(client, masterKey, networkName, channel, extPanId, panId)) ==
+    // The PSKc is derived before taking the session, so that the other requests do not wait for the derivation.
+    session.lock();
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.FactoryReset(), ret = kWpanStatus_LeaveFailed);
+#if OTBR_ENABLE_DBUS_SERVER
+    // The whole dataset is committed and Thread started in one d-bus call, instead of a CLI command per parameter.
+    VerifyOrExit(otbr::Utils::BuildActiveDataset(masterKey, networkName, channel, extPanId, panId, pskc,
+                                                  datasetTlvs) == OTBR_ERROR_NONE,
+                 ret = kWpanStatus_ParseRequestFailed);
+    VerifyOrExit((ret = FormFromDBus(datasetTlvs)) == kWpanStatus_Ok);
+#else
+    VerifyOrExit((ret = commitActiveDataset(mClient, masterKey, networkName, channel, extPanId, panId)) ==
                  kWpanStatus_Ok);
-    VerifyOrExit(client.Execute("pskc %s", pskcStr) != nullptr, ret = kWpanStatus_SetFailed);
-    VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(mClient.Execute("pskc %s", pskcStr) != nullptr, ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
+    VerifyOrExit(mClient.Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
+#endif
+    VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
 
@@ -229,15 +245,15 @@ std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixReq
     std::string                 prefix;
     bool                        defaultRoute;
     int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
+    std::lock_guard<std::mutex> session(mSessionMutex);
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aAddPrefixRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix       = root["prefix"].asString();
     defaultRoute = root["defaultRoute"].asBool();
 
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetGatewayFailed);
 exit:
 
@@ -262,14 +278,14 @@ std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteReq
     std::string                 response;
     std::string                 prefix;
     int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
+    std::lock_guard<std::mutex> session(mSessionMutex);
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aDeleteRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix = root["prefix"].asString();
 
-    VerifyOrExit(client.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
+    VerifyOrExit(mClient.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
 exit:
 
     root.clear();
@@ -285,19 +301,41 @@ exit:
     return response;
 }
 
-std::string WpanService::HandleStatusRequest()
+std::string WpanService::HandleStatusRequest(void)
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response, networkName, extPanId, propertyValue;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-    char *                      rval;
+    std::lock_guard<std::mutex> session(mSessionMutex);
+
+    return ReadStatus();
+}
+
+bool WpanService::TryHandleStatusRequest(std::string &aResponse)
+{
+    std::unique_lock<std::mutex> session(mSessionMutex, std::try_to_lock);
+
+    if (session.owns_lock())
+    {
+        aResponse = ReadStatus();
+    }
+
+    return session.owns_lock();
+}
+
+std::string WpanService::ReadStatus(void)
+{
+    Json::Value      root, networkInfo;
+    Json::FastWriter jsonWriter;
+    std::string      response, networkName, extPanId, propertyValue;
+    int              ret = kWpanStatus_Ok;
 
     networkInfo["WPAN service"] = "uninitialized";
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+#if OTBR_ENABLE_DBUS_SERVER
+    VerifyOrExit((ret = GetStatusFromDBus(networkInfo)) == kWpanStatus_Ok);
+#else
+    char *rval;
+
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
 
-    VerifyOrExit((rval = client.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["NCP:State"] = rval;
 
     if (!strcmp(rval, "disabled"))
@@ -315,25 +353,25 @@ std::string WpanService::HandleStatusRequest()
         networkInfo["WPAN service"] = "associated";
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["NCP:Version"] = rval;
 
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["NCP:HardwareAddress"] = rval;
 
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["NCP:Channel"] = rval;
 
-    VerifyOrExit((rval = client.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:NodeType"] = rval;
+    // The node type is the state queried above.
+    networkInfo["Network:NodeType"] = networkInfo["NCP:State"];
 
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:Name"] = rval;
 
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:XPANID"] = rval;
 
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = mClient.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:PANID"] = rval;
 
     {
@@ -341,7 +379,7 @@ std::string WpanService::HandleStatusRequest()
         static const char kMeshLocalAddressTokenLocator[] = "0:ff:fe00:";
         std::string       meshLocalPrefix;
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = mClient.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
         rval = strstr(rval, kMeshLocalPrefixLocator);
         rval += sizeof(kMeshLocalPrefixLocator) - 1;
         *strstr(rval, "\r\n") = '\0';
@@ -351,7 +389,7 @@ std::string WpanService::HandleStatusRequest()
         meshLocalPrefix = rval;
         meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = mClient.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
 
         for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
@@ -377,6 +415,7 @@ std::string WpanService::HandleStatusRequest()
         }
         networkInfo["IPv6:MeshLocalAddress"] = rval;
     }
+#endif
 
 exit:
     root["result"] = networkInfo;
@@ -397,11 +436,17 @@ std::string WpanService::HandleAvailableNetworkRequest()
     Json::FastWriter            jsonWriter;
     std::string                 response;
     int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
+    std::lock_guard<std::mutex> session(mSessionMutex);
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
-    VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
+#if OTBR_ENABLE_DBUS_SERVER
+    VerifyOrExit(GetThreadApi() != nullptr, ret = kWpanStatus_ScanFailed);
+    VerifyOrExit((mNetworksCount = ScanFromDBus(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
                  ret = kWpanStatus_NetworkNotFound);
+#else
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_ScanFailed);
+    VerifyOrExit((mNetworksCount = mClient.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
+                 ret = kWpanStatus_NetworkNotFound);
+#endif
 
     for (int i = 0; i < mNetworksCount; i++)
     {
@@ -432,12 +477,40 @@ exit:
 
 int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
 {
-    int                         status = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-    const char *                rval;
+    std::lock_guard<std::mutex> session(mSessionMutex);
+
+#if OTBR_ENABLE_DBUS_SERVER
+    int                        status = kWpanStatus_Ok;
+    otbr::DBus::ThreadApiDBus *api    = GetThreadApi();
+    std::string                role;
+    uint64_t                   extPanId;
+    char                       extPanIdString[OT_EXTENDED_PANID_LENGTH * 2 + 1];
+
+    VerifyOrExit(api != nullptr, status = kWpanStatus_Uninitialized);
+    VerifyOrExit(api->GetProperties({OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                     OTBR_DBUS_PROPERTY_EXTPANID},
+                                    role, aNetworkName, extPanId) == otbr::DBus::ClientError::ERROR_NONE,
+                 status = kWpanStatus_Down);
+
+    if (role == OTBR_ROLE_NAME_DISABLED)
+    {
+        status = kWpanStatus_Offline;
+    }
+    else if (role == OTBR_ROLE_NAME_DETACHED)
+    {
+        status = kWpanStatus_Associating;
+    }
+    else
+    {
+        sprintf(extPanIdString, "%016" PRIx64, extPanId);
+        aExtPanId = extPanIdString;
+    }
+#else
+    int         status = kWpanStatus_Ok;
+    const char *rval;
 
-    VerifyOrExit(client.Connect(), status = kWpanStatus_Uninitialized);
-    rval = client.Execute("state");
+    VerifyOrExit(mClient.Connect(), status = kWpanStatus_Uninitialized);
+    rval = mClient.Execute("state");
     VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
     if (!strcmp(rval, "disabled"))
     {
@@ -449,14 +522,15 @@ int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aE
     }
     else
     {
-        rval = client.Execute("networkname");
+        rval = mClient.Execute("networkname");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aNetworkName = rval;
 
-        rval = client.Execute("extpanid");
+        rval = mClient.Execute("extpanid");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aExtPanId = rval;
     }
+#endif
 
 exit:
 
@@ -465,23 +539,24 @@ exit:
 
 std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
 {
-    Json::Value  root;
-    Json::Reader reader;
-    Json::FastWriter jsonWriter;
-    int          ret = kWpanStatus_Ok;
-    std::string  pskd;
-    std::string  response;
+    Json::Value                  root;
+    Json::Reader                 reader;
+    Json::FastWriter             jsonWriter;
+    int                          ret = kWpanStatus_Ok;
+    std::string                  pskd;
+    std::string                  response;
+    std::unique_lock<std::mutex> session(mSessionMutex, std::defer_lock);
 
     VerifyOrExit(reader.parse(aCommissionRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     pskd = root["pskd"].asString();
     {
-        otbr::Web::OpenThreadClient client;
-        const char *                rval;
+        const char *rval;
 
-        VerifyOrExit(client.Connect(), ret = kWpanStatus_Uninitialized);
-        rval = client.Execute("commissioner start");
+        session.lock();
+        VerifyOrExit(mClient.Connect(), ret = kWpanStatus_Uninitialized);
+        rval = mClient.Execute("commissioner start");
         // VerifyOrExit(rval != nullptr, ret = kWpanStatus_Down); // No need to check, repeated execution of the command will definitely fail. 
-        rval = client.Execute("commissioner joiner add * %s", pskd.c_str());
+        rval = mClient.Execute("commissioner joiner add * %s", pskd.c_str());
         VerifyOrExit(rval != nullptr, ret = kWpanStatus_Down);
         root["error"] = ret;
     }
@@ -496,6 +571,167 @@ exit:
     return response;
 }
 
+#if OTBR_ENABLE_DBUS_SERVER
+otbr::DBus::ThreadApiDBus *WpanService::GetThreadApi(void) const
+{
+    DBusError error;
+
+    dbus_error_init(&error);
+
+    if (mThreadApi == nullptr)
+    {
+        mDBusConnection.reset(dbus_bus_get(DBUS_BUS_SYSTEM, &error));
+        VerifyOrExit(mDBusConnection != nullptr,
+                     otbrLog(OTBR_LOG_ERR, "Failed to connect to d-bus: %s", error.message));
+        mThreadApi.reset(new otbr::DBus::ThreadApiDBus(mDBusConnection.get(), mIfName));
+    }
+
+    // The signals received since the last request are not handled, drop them instead of queuing them forever.
+    dbus_connection_read_write(mDBusConnection.get(), 0);
+    while (dbus_connection_dispatch(mDBusConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+    }
+
+exit:
+    dbus_error_free(&error);
+    return mThreadApi.get();
+}
+
+int WpanService::ScanFromDBus(WpanNetworkInfo *aNetworks, int aLength)
+{
+    otbr::DBus::ThreadApiDBus *api   = GetThreadApi();
+    bool                       done  = false;
+    int                        count = 0;
+
+    // The agent shares the radio scan with the other scan requests and may answer from its recent results.
+    VerifyOrExit(api->Scan([&](const std::vector<otbr::DBus::ActiveScanResult> &aResults) {
+        for (const otbr::DBus::ActiveScanResult &result : aResults)
+        {
+            if (count >= aLength)
+            {
+                break;
+            }
+
+            WpanNetworkInfo &network = aNetworks[count];
+
+            strcpy_safe(network.mNetworkName, sizeof(network.mNetworkName), result.mNetworkName.c_str());
+            network.mAllowingJoin = result.mIsJoinable;
+            network.mPanId        = result.mPanId;
+            network.mChannel      = result.mChannel;
+            network.mExtPanId     = result.mExtendedPanId;
+            network.mRssi         = result.mRssi;
+
+            for (size_t i = 0; i < sizeof(network.mHardwareAddress); i++)
+            {
+                network.mHardwareAddress[i] = static_cast<uint8_t>(result.mExtAddress >> (8 * (7 - i)));
+            }
+
+            ++count;
+        }
+
+        done = true;
+    }) == otbr::DBus::ClientError::ERROR_NONE);
+
+    // The reply, or the error once the call times out, is handled while dispatching.
+    while (!done && dbus_connection_read_write_dispatch(mDBusConnection.get(), -1))
+    {
+    }
+
+exit:
+    return count;
+}
+
+int WpanService::FormFromDBus(const std::vector<uint8_t> &aDatasetTlvs)
+{
+    otbr::DBus::ThreadApiDBus *api = GetThreadApi();
+    int                        ret = kWpanStatus_Ok;
+
+    VerifyOrExit(api != nullptr, ret = kWpanStatus_FormFailed);
+
+    // Without a handler, the call returns once the device is the leader of the new network.
+    VerifyOrExit(api->AttachDataset(aDatasetTlvs, nullptr) == otbr::DBus::ClientError::ERROR_NONE,
+                 ret = kWpanStatus_FormFailed);
+
+exit:
+    return ret;
+}
+
+int WpanService::GetStatusFromDBus(Json::Value &aNetworkInfo) const
+{
+    int                                       ret = kWpanStatus_Ok;
+    otbr::DBus::ThreadApiDBus *               api = GetThreadApi();
+    std::string                               role;
+    std::string                               version;
+    std::string                               networkName;
+    uint64_t                                  eui64;
+    uint64_t                                  extPanId;
+    uint16_t                                  panId;
+    uint16_t                                  channel;
+    uint16_t                                  rloc16;
+    std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> meshLocalPrefix;
+    char                                      buffer[64];
+    std::string                               prefix;
+
+    VerifyOrExit(api != nullptr, ret = kWpanStatus_SetFailed);
+
+    // All the fields of the status page are read at once, with typed values instead of parsing the CLI output.
+    VerifyOrExit(api->GetProperties({OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
+                                     OTBR_DBUS_PROPERTY_EUI64, OTBR_DBUS_PROPERTY_CHANNEL,
+                                     OTBR_DBUS_PROPERTY_NETWORK_NAME, OTBR_DBUS_PROPERTY_EXTPANID,
+                                     OTBR_DBUS_PROPERTY_PANID, OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX,
+                                     OTBR_DBUS_PROPERTY_RLOC16},
+                                    role, version, eui64, channel, networkName, extPanId, panId, meshLocalPrefix,
+                                    rloc16) == otbr::DBus::ClientError::ERROR_NONE,
+                 ret = kWpanStatus_GetPropertyFailed);
+
+    aNetworkInfo["NCP:State"] = role;
+
+    if (role == OTBR_ROLE_NAME_DISABLED)
+    {
+        aNetworkInfo["WPAN service"] = "offline";
+        ExitNow();
+    }
+    else if (role == OTBR_ROLE_NAME_DETACHED)
+    {
+        aNetworkInfo["WPAN service"] = "associating";
+        ExitNow();
+    }
+    else
+    {
+        aNetworkInfo["WPAN service"] = "associated";
+    }
+
+    // The values are formatted as the CLI outputs them.
+    aNetworkInfo["NCP:Version"] = version;
+
+    sprintf(buffer, "%016" PRIx64, eui64);
+    aNetworkInfo["NCP:HardwareAddress"] = buffer;
+
+    aNetworkInfo["NCP:Channel"]      = std::to_string(channel);
+    aNetworkInfo["Network:NodeType"] = role;
+    aNetworkInfo["Network:Name"]     = networkName;
+
+    sprintf(buffer, "%016" PRIx64, extPanId);
+    aNetworkInfo["Network:XPANID"] = buffer;
+
+    sprintf(buffer, "0x%04x", panId);
+    aNetworkInfo["Network:PANID"] = buffer;
+
+    sprintf(buffer, "%x:%x:%x:%x", (meshLocalPrefix[0] << 8) | meshLocalPrefix[1],
+            (meshLocalPrefix[2] << 8) | meshLocalPrefix[3], (meshLocalPrefix[4] << 8) | meshLocalPrefix[5],
+            (meshLocalPrefix[6] << 8) | meshLocalPrefix[7]);
+    prefix                              = buffer;
+    aNetworkInfo["IPv6:MeshLocalPrefix"] = prefix + "::/64";
+
+    // The routing locator, which is the mesh local address the CLI based status picks.
+    sprintf(buffer, ":0:ff:fe00:%x", rloc16);
+    aNetworkInfo["IPv6:MeshLocalAddress"] = prefix + buffer;
+
+exit:
+    return ret;
+}
+#endif // OTBR_ENABLE_DBUS_SERVER
+
 int WpanService::commitActiveDataset(otbr::Web::OpenThreadClient &aClient,
                                      const std::string &          aMasterKey,
                                      const std::string &          aNetworkName,
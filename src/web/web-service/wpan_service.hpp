@@ -42,6 +42,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <json/json.h>
 #include <json/writer.h>
 
@@ -50,6 +54,10 @@
 #include "utils/pskc.hpp"
 #include "web/web-service/ot_client.hpp"
 
+#if OTBR_ENABLE_DBUS_SERVER
+#include "dbus/client/thread_api_dbus.hpp"
+#endif
+
 /**
  * WPAN parameter constants
  *
@@ -57,6 +65,9 @@
 
 #define OT_EXTENDED_PANID_LENGTH 8
 #define OT_HARDWARE_ADDRESS_LENGTH 8
+#define OT_MASTER_KEY_LENGTH 16
+#define OT_MESH_LOCAL_PREFIX_LENGTH 8
+#define OT_ACTIVE_DATASET_MAX_LENGTH 254
 #define OT_NETWORK_NAME_LENGTH 16
 #define OT_PANID_LENGTH 2
 #define OT_PSKC_MAX_LENGTH 16
@@ -69,6 +80,9 @@ namespace Web {
 /**
  * This class provides web service to manage WPAN.
  *
+ * The requests can be handled from several threads. otbr-agent serves a single CLI session, so the requests use the
+ * session one at a time, and only parse the request and derive keys concurrently.
+ *
  */
 class WpanService
 {
@@ -121,6 +135,17 @@ public:
      */
     std::string HandleStatusRequest(void);
 
+    /**
+     * This method handles http request to get network status, unless another request is using the session.
+     *
+     * @param[out]  aResponse   The string to the http response of getting status.
+     *
+     * @retval  true    The status is read.
+     * @retval  false   Another request is using the session, @p aResponse is unchanged.
+     *
+     */
+    bool TryHandleStatusRequest(std::string &aResponse);
+
     /**
      * This method handles http request to get available networks.
      *
@@ -181,6 +206,19 @@ private:
                                            uint64_t                     aExtPanId,
                                            uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
+    std::string        ReadStatus(void);
+
+#if OTBR_ENABLE_DBUS_SERVER
+    struct DBusConnectionDeleter
+    {
+        void operator()(DBusConnection *aConnection) { dbus_connection_unref(aConnection); }
+    };
+
+    otbr::DBus::ThreadApiDBus *GetThreadApi(void) const;
+    int                        GetStatusFromDBus(Json::Value &aNetworkInfo) const;
+    int                        ScanFromDBus(WpanNetworkInfo *aNetworks, int aLength);
+    int                        FormFromDBus(const std::vector<uint8_t> &aDatasetTlvs);
+#endif
 
     WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
     int             mNetworksCount;
@@ -188,6 +226,18 @@ private:
     std::string     mNetworkName;
     std::string     mExtPanId;
 
+    // Held while a request uses the session to otbr-agent, through the CLI or d-bus
+    mutable std::mutex mSessionMutex;
+
+    // Connection to the daemon kept across requests, only used while holding mSessionMutex
+    mutable otbr::Web::OpenThreadClient mClient;
+
+#if OTBR_ENABLE_DBUS_SERVER
+    // Client of the otbr-agent d-bus API reading the status, connected on the first request
+    mutable std::unique_ptr<DBusConnection, DBusConnectionDeleter> mDBusConnection;
+    mutable std::unique_ptr<otbr::DBus::ThreadApiDBus>             mThreadApi;
+#endif
+
     enum
     {
         kWpanStatus_Ok = 0,
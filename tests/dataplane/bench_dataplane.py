@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2020, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Data-plane benchmark of the otbr agent.
+
+Packets are sent at a fixed rate from the host to an address reached through
+the Thread interface, either ICMPv6 echo requests whose replies give the round
+trip latency, or UDP datagrams counted by the receiver, which is queried with a
+shell command printing the number of datagrams it received.
+The achieved packet rate, the losses and the CPU time the otbr agent spent per
+packet are reported.
+
+Example:
+
+    bench_dataplane.py --interface wpan0 --mode icmp --target fd00::1 \\
+        --rate 200 --duration 30 --size 64
+    bench_dataplane.py --interface wpan0 --mode udp --target fd00::1 \\
+        --received-command "cat /tmp/received"
+"""
+
+import argparse
+import json
+import os
+import socket
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+ICMPV6_ECHO_REQUEST = 128
+ICMPV6_ECHO_REPLY = 129
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0.0
+
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def find_pid(name):
+    for entry in os.listdir("/proc"):
+        if not entry.isdigit():
+            continue
+        try:
+            with open("/proc/{}/comm".format(entry)) as comm:
+                if comm.read().strip() == name:
+                    return int(entry)
+        except OSError:
+            continue
+
+    return None
+
+
+def read_cpu_seconds(pid):
+    with open("/proc/{}/stat".format(pid)) as stat:
+        # The command name may contain spaces, fields are counted after its closing parenthesis.
+        fields = stat.read().rpartition(")")[2].split()
+
+    # utime and stime are the 14th and 15th fields.
+    return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+
+def read_interface_counter(interface, name):
+    with open("/sys/class/net/{}/statistics/{}".format(interface, name)) as counter:
+        return int(counter.read())
+
+
+def read_received(command):
+    output = subprocess.check_output(command, shell=True, universal_newlines=True).strip()
+
+    return int(output) if output else 0
+
+
+def pace(start_time, index, rate):
+    delay = start_time + index / rate - time.monotonic()
+
+    if delay > 0:
+        time.sleep(delay)
+
+
+class IcmpBench(object):
+
+    def __init__(self, args):
+        self.args = args
+        self.identifier = os.getpid() & 0xffff
+        self.sock = socket.socket(socket.AF_INET6, socket.SOCK_RAW, socket.IPPROTO_ICMPV6)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_BINDTODEVICE, args.interface.encode())
+        self.sock.settimeout(0.1)
+        self.send_times = {}
+        self.latencies = []
+        self.duplicates = 0
+        self.errors = 0
+        self.stopped = False
+
+    def receive(self):
+        while not self.stopped:
+            try:
+                packet = self.sock.recv(65536)
+            except socket.timeout:
+                continue
+
+            receive_time = time.perf_counter()
+
+            if len(packet) < 8:
+                continue
+
+            kind, _, _, identifier, sequence = struct.unpack("!BBHHH", packet[:8])
+            if kind != ICMPV6_ECHO_REPLY or identifier != self.identifier:
+                continue
+
+            send_time = self.send_times.pop(sequence, None)
+            if send_time is None:
+                self.duplicates += 1
+            else:
+                self.latencies.append(receive_time - send_time)
+
+    def run(self, start_time, stop_time):
+        receiver = threading.Thread(target=self.receive)
+        receiver.start()
+        payload = bytes(self.args.size)
+        sent = 0
+
+        while time.monotonic() < stop_time:
+            pace(start_time, sent, self.args.rate)
+            sequence = sent & 0xffff
+            # The kernel computes the checksum of ICMPv6 raw sockets.
+            packet = struct.pack("!BBHHH", ICMPV6_ECHO_REQUEST, 0, 0, self.identifier, sequence) + payload
+            self.send_times[sequence] = time.perf_counter()
+            try:
+                self.sock.sendto(packet, (self.args.target, 0))
+            except OSError:
+                self.send_times.pop(sequence, None)
+                self.errors += 1
+            sent += 1
+
+        time.sleep(self.args.timeout)
+        self.stopped = True
+        receiver.join()
+        self.sock.close()
+
+        return sent
+
+    def summarize(self, sent):
+        latencies = sorted(self.latencies)
+
+        return {
+            "received": len(latencies),
+            "lost": sent - self.errors - len(latencies),
+            "duplicates": self.duplicates,
+            "errors": self.errors,
+            "p50_ms": percentile(latencies, 0.5) * 1000,
+            "p99_ms": percentile(latencies, 0.99) * 1000,
+            "max_ms": (latencies[-1] if latencies else 0.0) * 1000,
+        }
+
+
+class UdpBench(object):
+
+    def __init__(self, args):
+        self.args = args
+        self.sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_BINDTODEVICE, args.interface.encode())
+        self.errors = 0
+        self.forwarded = 0
+        self.dropped = 0
+
+    def run(self, start_time, stop_time):
+        payload = bytes(self.args.size)
+        sent = 0
+        # The tun device only counts what the agent read, the datagrams received are counted by the receiver.
+        forwarded = read_received(self.args.received_command)
+        dropped = read_interface_counter(self.args.interface, "tx_dropped")
+
+        while time.monotonic() < stop_time:
+            pace(start_time, sent, self.args.rate)
+            try:
+                self.sock.sendto(payload, (self.args.target, self.args.port))
+            except OSError:
+                self.errors += 1
+            sent += 1
+
+        time.sleep(self.args.timeout)
+        self.forwarded = read_received(self.args.received_command) - forwarded
+        self.dropped = read_interface_counter(self.args.interface, "tx_dropped") - dropped
+        self.sock.close()
+
+        return sent
+
+    def summarize(self, sent):
+        return {
+            "forwarded": self.forwarded,
+            "dropped": self.dropped,
+            "errors": self.errors,
+        }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Data-plane benchmark of the otbr agent.")
+    parser.add_argument("--interface", default="wpan0", help="Thread interface of the otbr agent")
+    parser.add_argument("--target", required=True, help="IPv6 address reached through the Thread interface")
+    parser.add_argument("--mode", choices=("icmp", "udp"), default="icmp", help="kind of packets sent")
+    parser.add_argument("--port", type=int, default=12345, help="destination port of UDP datagrams")
+    parser.add_argument("--received-command", help="shell command printing the UDP datagrams received by the target")
+    parser.add_argument("--rate", type=float, default=100, help="packets sent per second")
+    parser.add_argument("--size", type=int, default=64, help="payload size of each packet in bytes")
+    parser.add_argument("--duration", type=float, default=10, help="measured duration in seconds")
+    parser.add_argument("--timeout", type=float, default=2, help="wait for the last packets in seconds")
+    parser.add_argument("--agent", default="otbr-agent", help="process name of the otbr agent")
+    parser.add_argument("--json", action="store_true", help="print the results as JSON")
+    args = parser.parse_args()
+
+    if args.mode == "udp" and not args.received_command:
+        parser.error("--received-command is required in udp mode")
+
+    pid = find_pid(args.agent)
+    if pid is None:
+        print("{} is not running".format(args.agent), file=sys.stderr)
+        return 1
+
+    bench = IcmpBench(args) if args.mode == "icmp" else UdpBench(args)
+    start_time = time.monotonic() + 0.5
+    stop_time = start_time + args.duration
+    cpu_seconds = read_cpu_seconds(pid)
+
+    sent = bench.run(start_time, stop_time)
+
+    cpu_seconds = read_cpu_seconds(pid) - cpu_seconds
+    elapsed = max(time.monotonic(), stop_time) - start_time
+    result = {
+        "mode": args.mode,
+        "target": args.target,
+        "size": args.size,
+        "rate": args.rate,
+        "duration": args.duration,
+        "sent": sent,
+        "sent_per_second": sent / args.duration,
+        "agent_cpu_seconds": cpu_seconds,
+        "agent_cpu_us_per_packet": cpu_seconds * 1e6 / sent if sent else 0.0,
+        "agent_cpu_percent": cpu_seconds * 100 / elapsed,
+    }
+    result.update(bench.summarize(sent))
+    delivered = result["received"] if args.mode == "icmp" else result["forwarded"]
+    result["delivered_per_second"] = delivered / args.duration
+
+    if args.json:
+        print(json.dumps(result, indent=2))
+    else:
+        print("{} to {} size {} rate {:.0f}/s duration {:.1f}s".format(args.mode, args.target, args.size, args.rate,
+                                                                       args.duration))
+        for name, value in result.items():
+            if name not in ("mode", "target", "size", "rate", "duration"):
+                print("{:<24} {}".format(name, round(value, 3) if isinstance(value, float) else value))
+
+    return 0 if delivered > 0 else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
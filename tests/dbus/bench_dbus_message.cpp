@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the throughput benchmarks of the d-bus message encoding and decoding.
+ *
+ *   Each benchmark is repeated with a growing number of iterations until it runs for at least the minimum time, and
+ *   the time and rate of one iteration is reported.
+ *
+ *   Usage: otbr-dbus-message-bench [min-seconds [filter]]
+ */
+
+#include <chrono>
+#include <functional>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "dbus/common/dbus_message_helper.hpp"
+
+using otbr::DBus::ActiveScanResult;
+using otbr::DBus::ChildInfo;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::LinkModeConfig;
+using otbr::DBus::NeighborInfo;
+using otbr::DBus::TupleToDBusMessage;
+
+namespace {
+
+constexpr size_t kTableSize = 32;
+
+double      sMinSeconds = 0.5;
+const char *sFilter     = nullptr;
+bool        sFailed     = false;
+
+void Run(const std::string &aName, size_t aItems, const std::function<bool(void)> &aIteration)
+{
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t iterations = 1;
+    double   seconds    = 0;
+
+    if (sFilter != nullptr && aName.find(sFilter) == std::string::npos)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        Clock::time_point begin = Clock::now();
+
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            if (!aIteration())
+            {
+                printf("%-32s FAILED\n", aName.c_str());
+                sFailed = true;
+                return;
+            }
+        }
+
+        seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+        if (seconds >= sMinSeconds || iterations >= (UINT64_MAX >> 1))
+        {
+            break;
+        }
+
+        iterations *= 2;
+    }
+
+    printf("%-32s %12llu %12.1f %14.0f\n", aName.c_str(), static_cast<unsigned long long>(iterations),
+           seconds * 1e9 / iterations, iterations * aItems / seconds);
+}
+
+template <typename ValueType> void BenchEncode(const std::string &aName, const ValueType &aValue, size_t aItems)
+{
+    auto values = std::make_tuple(aValue);
+
+    Run(aName + "/Encode", aItems, [&values]() {
+        DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        bool         ok  = (msg != nullptr && TupleToDBusMessage(*msg, values) == OTBR_ERROR_NONE);
+
+        if (msg != nullptr)
+        {
+            dbus_message_unref(msg);
+        }
+
+        return ok;
+    });
+}
+
+template <typename ValueType> void BenchExtract(const std::string &aName, const ValueType &aValue, size_t aItems)
+{
+    DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+    if (msg == nullptr || TupleToDBusMessage(*msg, std::make_tuple(aValue)) != OTBR_ERROR_NONE)
+    {
+        printf("%-32s FAILED\n", (aName + "/Extract").c_str());
+        sFailed = true;
+    }
+    else
+    {
+        Run(aName + "/Extract", aItems, [msg]() {
+            std::tuple<ValueType> values;
+
+            return DBusMessageToTuple(*msg, values) == OTBR_ERROR_NONE;
+        });
+    }
+
+    if (msg != nullptr)
+    {
+        dbus_message_unref(msg);
+    }
+}
+
+template <typename ValueType> void Bench(const std::string &aName, const ValueType &aValue, size_t aItems)
+{
+    BenchEncode(aName, aValue, aItems);
+    BenchExtract(aName, aValue, aItems);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::vector<ChildInfo>        childTable(kTableSize, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, true, false, true, false});
+    std::vector<NeighborInfo>     neighborTable(kTableSize, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, true, false, true, false});
+    std::vector<ActiveScanResult> scanResults(
+        kTableSize, {1, "OpenThread", 2, {0xff, 0xff, 0xff, 0xff}, 4, 5, 6, 7, 8, 9, true, true});
+    LinkModeConfig linkMode{true, true, false};
+
+    if (argc > 1)
+    {
+        sMinSeconds = strtod(argv[1], nullptr);
+    }
+
+    if (argc > 2)
+    {
+        sFilter = argv[2];
+    }
+
+    printf("%-32s %12s %12s %14s\n", "benchmark", "iterations", "ns/iter", "items/s");
+
+    Bench("ChildInfo[" + std::to_string(kTableSize) + "]", childTable, kTableSize);
+    Bench("NeighborInfo[" + std::to_string(kTableSize) + "]", neighborTable, kTableSize);
+    Bench("ActiveScanResult[" + std::to_string(kTableSize) + "]", scanResults, kTableSize);
+    Bench("LinkModeConfig", linkMode, 1);
+
+    return sFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -39,6 +39,7 @@
 #include "common/code_utils.hpp"
 #include "dbus/client/thread_api_dbus.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
 
 using otbr::DBus::ActiveScanResult;
 using otbr::DBus::ClientError;
@@ -66,6 +67,10 @@ struct DBusConnectionDeleter
 
 using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
 
+static int sDeviceRoleChanges = 0;
+
+static const char kSpoofedNetworkName[] = "Spoofed";
+
 static bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6Prefix &aRhs)
 {
     bool prefixDataEquality = (aLhs.mPrefix.size() == aRhs.mPrefix.size()) &&
@@ -74,6 +79,46 @@ static bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6P
     return prefixDataEquality && aLhs.mLength == aRhs.mLength;
 }
 
+/**
+ * This function sends a message the bus does not reply to, and returns its serial.
+ *
+ * The serials of a connection are incremented for each message sent, the difference between the serials of two markers
+ * minus one is the number of messages sent in between.
+ *
+ */
+static uint32_t SendMarker(DBusConnection *aConnection)
+{
+    DBusMessage *message = dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_PEER, "Ping");
+    uint32_t     serial  = 0;
+
+    TEST_ASSERT(message != nullptr);
+    dbus_message_set_no_reply(message, true);
+    TEST_ASSERT(dbus_connection_send(aConnection, message, &serial));
+    dbus_message_unref(message);
+
+    return serial;
+}
+
+/**
+ * This function sends a scan result signal to the client from another peer than the server.
+ *
+ */
+static void SendSpoofedScanResult(DBusConnection *aConnection, const char *aDestination)
+{
+    DBusMessage *    message = dbus_message_new_signal(OTBR_DBUS_OBJECT_PREFIX "wpan0", OTBR_DBUS_THREAD_INTERFACE,
+                                                   OTBR_DBUS_SCAN_RESULT_SIGNAL);
+    ActiveScanResult result  = {};
+
+    result.mNetworkName = kSpoofedNetworkName;
+
+    TEST_ASSERT(message != nullptr);
+    TEST_ASSERT(dbus_message_set_destination(message, aDestination));
+    TEST_ASSERT(otbr::DBus::TupleToDBusMessage(*message, std::tie(result)) == OTBR_ERROR_NONE);
+    TEST_ASSERT(dbus_connection_send(aConnection, message, nullptr));
+    dbus_connection_flush(aConnection);
+    dbus_message_unref(message);
+}
+
 static void CheckExternalRoute(ThreadApiDBus *aApi, const Ip6Prefix &aPrefix)
 {
     ExternalRoute              route;
@@ -93,12 +138,41 @@ static void CheckExternalRoute(ThreadApiDBus *aApi, const Ip6Prefix &aPrefix)
     TEST_ASSERT(aApi->RemoveExternalRoute(aPrefix) == OTBR_ERROR_NONE);
 }
 
+static void CheckUpdateNetworkData(ThreadApiDBus *aApi, const OnMeshPrefix &aOnMeshPrefix)
+{
+    ExternalRoute              route;
+    std::vector<ExternalRoute> externalRouteTable;
+    std::vector<OnMeshPrefix>  onMeshPrefixes;
+
+    route.mPrefix     = aOnMeshPrefix.mPrefix;
+    route.mStable     = true;
+    route.mPreference = 0;
+
+    TEST_ASSERT(aApi->UpdateNetworkData({aOnMeshPrefix}, {}, {route}, {}) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRouteTable) == OTBR_ERROR_NONE);
+    TEST_ASSERT(externalRouteTable.size() == 1);
+
+    // A failing change leaves the network data as it was.
+    TEST_ASSERT(aApi->UpdateNetworkData({}, {aOnMeshPrefix.mPrefix}, {},
+                                        {aOnMeshPrefix.mPrefix, aOnMeshPrefix.mPrefix}) != OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRouteTable) == OTBR_ERROR_NONE);
+    TEST_ASSERT(externalRouteTable.size() == 1);
+
+    TEST_ASSERT(aApi->UpdateNetworkData({}, {aOnMeshPrefix.mPrefix}, {}, {aOnMeshPrefix.mPrefix}) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRouteTable) == OTBR_ERROR_NONE);
+    TEST_ASSERT(externalRouteTable.empty());
+    TEST_ASSERT(aApi->GetOnMeshPrefixes(onMeshPrefixes) == OTBR_ERROR_NONE);
+    TEST_ASSERT(onMeshPrefixes.empty());
+}
+
 int main()
 {
     DBusError                      error;
     UniqueDBusConnection           connection;
+    UniqueDBusConnection           spoofer;
     std::unique_ptr<ThreadApiDBus> api;
-    uint64_t                       extpanid = 0xdead00beaf00cafe;
+    uint64_t                       extpanid       = 0xdead00beaf00cafe;
+    bool                           scanStreamDone = false;
 
     dbus_error_init(&error);
     connection = UniqueDBusConnection(dbus_bus_get(DBUS_BUS_SYSTEM, &error));
@@ -109,10 +183,32 @@ int main()
 
     api = std::unique_ptr<ThreadApiDBus>(new ThreadApiDBus(connection.get()));
 
-    api->AddDeviceRoleHandler(
-        [](DeviceRole aRole) { printf("Device role changed to %d\n", static_cast<uint8_t>(aRole)); });
+    // The device role is signaled without subscribing to it.
+    api->AddDeviceRoleHandler([](DeviceRole aRole) {
+        printf("Device role changed to %d\n", static_cast<uint8_t>(aRole));
+        sDeviceRoleChanges++;
+    });
+    TEST_ASSERT(api->SubscribeSignals({OTBR_DBUS_PROPERTY_LINK_COUNTERS}) == ClientError::ERROR_NONE);
+
+    // Scan results signaled by another peer than the server are dropped.
+    spoofer = UniqueDBusConnection(dbus_bus_get_private(DBUS_BUS_SYSTEM, &error));
+    TEST_ASSERT(spoofer != nullptr);
+    TEST_ASSERT(api->ScanStream(
+                    [](const ActiveScanResult &aResult) {
+                        TEST_ASSERT(aResult.mNetworkName != kSpoofedNetworkName);
+                    },
+                    [&scanStreamDone](ClientError aError) {
+                        TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                        scanStreamDone = true;
+                    }) == ClientError::ERROR_NONE);
+    SendSpoofedScanResult(spoofer.get(), dbus_bus_get_unique_name(connection.get()));
+    while (!scanStreamDone)
+    {
+        dbus_connection_read_write_dispatch(connection.get(), 0);
+    }
+    dbus_connection_close(spoofer.get());
 
-    api->Scan([&api, extpanid](const std::vector<ActiveScanResult> &aResult) {
+    api->Scan([&api, &connection, extpanid](const std::vector<ActiveScanResult> &aResult) {
         LinkModeConfig       cfg       = {true, false, true};
         std::vector<uint8_t> masterKey = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
                                           0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
@@ -145,8 +241,9 @@ int main()
         TEST_ASSERT((channelMask & (1 << 26)) != 0);
 
         api->Attach("Test", 0x3456, extpanid, masterKey, {}, 1 << channel,
-                    [&api, channel, extpanid](ClientError aError) {
+                    [&api, &connection, channel, extpanid](ClientError aError) {
                         printf("Attach result %d\n", static_cast<int>(aError));
+                        TEST_ASSERT(aError != OTBR_ERROR_NONE || sDeviceRoleChanges > 0);
                         sleep(10);
                         uint64_t extpanidCheck;
                         if (aError == OTBR_ERROR_NONE)
@@ -156,6 +253,8 @@ int main()
                             uint16_t                              rloc16     = 0xffff;
                             std::vector<uint8_t>                  networkData;
                             std::vector<uint8_t>                  stableNetworkData;
+                            uint8_t                               networkDataVersion;
+                            uint8_t                               stableNetworkDataVersion;
                             int8_t                                rssi;
                             int8_t                                txPower;
                             std::vector<otbr::DBus::ChildInfo>    childTable;
@@ -171,15 +270,88 @@ int main()
                             TEST_ASSERT(api->GetExtendedAddress(extAddress) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetNetworkData(networkData) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetStableNetworkData(stableNetworkData) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(api->GetNetworkDataVersion(networkDataVersion) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(api->GetStableNetworkDataVersion(stableNetworkDataVersion) ==
+                                        OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetChildTable(childTable) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetNeighborTable(neighborTable) == OTBR_ERROR_NONE);
                             printf("neighborTable size %zu\n", neighborTable.size());
                             printf("childTable size %zu\n", childTable.size());
                             TEST_ASSERT(neighborTable.size() == 1);
                             TEST_ASSERT(childTable.size() == 1);
+                            {
+                                std::vector<otbr::DBus::NeighborLinkQuality> linkQualities;
+
+                                TEST_ASSERT(api->GetNeighborLinkQuality(linkQualities) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(linkQualities.size() <= neighborTable.size());
+                                for (const auto &linkQuality : linkQualities)
+                                {
+                                    TEST_ASSERT(linkQuality.mRssiHistogram.size() == 8);
+                                    TEST_ASSERT(linkQuality.mLinkQualityHistogram.size() == 4);
+                                    TEST_ASSERT(linkQuality.mMinRssi <= linkQuality.mMaxRssi);
+                                }
+                            }
                             TEST_ASSERT(api->GetPartitionId(partitionId) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetInstantRssi(rssi) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetRadioTxPower(txPower) == OTBR_ERROR_NONE);
+                            {
+                                uint16_t batchRloc16;
+                                uint32_t batchPartitionId;
+
+                                TEST_ASSERT(api->GetProperties({OTBR_DBUS_PROPERTY_RLOC16,
+                                                                OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY},
+                                                               batchRloc16, batchPartitionId) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(batchRloc16 == rloc16);
+                                TEST_ASSERT(batchPartitionId == partitionId);
+                            }
+                            {
+                                std::string cachedName;
+                                uint32_t    serial;
+
+                                TEST_ASSERT(api->EnablePropertyCache({OTBR_DBUS_PROPERTY_NETWORK_NAME}) ==
+                                            OTBR_ERROR_NONE);
+                                serial = SendMarker(connection.get());
+                                TEST_ASSERT(api->GetNetworkName(cachedName) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(SendMarker(connection.get()) == serial + 2);
+
+                                // A cache hit does not send a message.
+                                serial = SendMarker(connection.get());
+                                TEST_ASSERT(api->GetNetworkName(cachedName) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(SendMarker(connection.get()) == serial + 1);
+                                TEST_ASSERT(cachedName == name);
+
+                                // The network name was never signaled, it is read again once its TTL elapsed.
+                                usleep((OTBR_DBUS_CLIENT_PROPERTY_CACHE_TTL + 100) * 1000);
+                                serial = SendMarker(connection.get());
+                                TEST_ASSERT(api->GetNetworkName(cachedName) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(SendMarker(connection.get()) == serial + 2);
+                                TEST_ASSERT(cachedName == name);
+                                api->DisablePropertyCache();
+                            }
+                            {
+                                std::vector<otbr::DBus::CommissioningJoinerProgress> joiners;
+
+                                TEST_ASSERT(api->AddCommissioningJoiners({{0x0123456789abcdef, "J01NME"}}) ==
+                                            OTBR_ERROR_NONE);
+                                TEST_ASSERT(api->AddCommissioningJoiners({{0x0123456789abcdef, "J01NME"}}) !=
+                                            OTBR_ERROR_NONE);
+                                TEST_ASSERT(api->GetCommissioningJoiners(joiners) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(joiners.size() == 1);
+                                TEST_ASSERT(joiners[0].mEui64 == 0x0123456789abcdef);
+                                TEST_ASSERT(joiners[0].mState == 0);
+                                TEST_ASSERT(api->RemoveCommissioningJoiner(0x0123456789abcdef) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(api->GetCommissioningJoiners(joiners) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(joiners.empty());
+                            }
+                            {
+                                auto rloc16Handler = [rloc16](ClientError aErr, const uint16_t &aRloc16) {
+                                    TEST_ASSERT(aErr == ClientError::ERROR_NONE);
+                                    TEST_ASSERT(aRloc16 == rloc16);
+                                };
+
+                                TEST_ASSERT(api->GetPropertyAsync<uint16_t>(OTBR_DBUS_PROPERTY_RLOC16, rloc16Handler) ==
+                                            OTBR_ERROR_NONE);
+                            }
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->GetNetworkName(name) == OTBR_ERROR_NONE);
                             TEST_ASSERT(rloc16 != 0xffff);
@@ -214,6 +386,7 @@ int main()
                             CheckExternalRoute(api.get(), prefix);
                             TEST_ASSERT(api->AddOnMeshPrefix(onMeshPrefix) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->RemoveOnMeshPrefix(onMeshPrefix.mPrefix) == OTBR_ERROR_NONE);
+                            CheckUpdateNetworkData(api.get(), onMeshPrefix);
 
                             exit(static_cast<uint8_t>(aErr));
                         });
@@ -35,9 +35,18 @@
 
 #include <netinet/in.h>
 #include <signal.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/event_poller.hpp"
 #include "common/logging.hpp"
+#include "common/timer.hpp"
 #include "mdns/mdns.hpp"
 
 using namespace otbr;
@@ -46,27 +55,30 @@ static struct Context
 {
     Mdns::Publisher *mPublisher;
     bool             mUpdate;
+    bool             mDone;
 } sContext;
 
 int Mainloop(Mdns::Publisher &aPublisher)
 {
     int rval = 0;
 
-    while (true)
+    while (!sContext.mDone)
     {
-        fd_set         readFdSet;
-        fd_set         writeFdSet;
-        fd_set         errorFdSet;
-        int            maxFd   = -1;
-        struct timeval timeout = {INT_MAX, INT_MAX};
+        otSysMainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {INT_MAX, INT_MAX};
 
-        FD_ZERO(&readFdSet);
-        FD_ZERO(&writeFdSet);
-        FD_ZERO(&errorFdSet);
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
 
-        aPublisher.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, timeout);
-        rval =
-            select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, (timeout.tv_sec == INT_MAX ? nullptr : &timeout));
+        aPublisher.UpdateFdSet(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet, mainloop.mMaxFd,
+                               mainloop.mTimeout);
+        EventPoller::Get().UpdateFdSet(mainloop);
+        TimerScheduler::Get().UpdateTimeout(mainloop.mTimeout);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      (mainloop.mTimeout.tv_sec == INT_MAX ? nullptr : &mainloop.mTimeout));
 
         if (rval < 0)
         {
@@ -74,7 +86,9 @@ int Mainloop(Mdns::Publisher &aPublisher)
             break;
         }
 
-        aPublisher.Process(readFdSet, writeFdSet, errorFdSet);
+        aPublisher.Process(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet);
+        EventPoller::Get().Process(mainloop);
+        TimerScheduler::Get().Process();
     }
 
     return rval;
@@ -102,15 +116,25 @@ void PublishMultipleServices(void *aContext, Mdns::State aState)
     assert(aContext == &sContext);
     if (aState == Mdns::kStateReady)
     {
-        otbrError err = sContext.mPublisher->PublishService(12345, "MultipleService1", "_meshcop._udp.", "nn", "cool1",
-                                                            sizeof("cool1") - 1, "xp",
-                                                            reinterpret_cast<char *>(&xpanid), sizeof(xpanid), nullptr);
+        otbrError err;
 
+        // The services are published together when the batch ends, and the second text record of
+        // MultipleService2 replaces the first one.
+        sContext.mPublisher->BeginBatch();
+        err = sContext.mPublisher->PublishService(12345, "MultipleService1", "_meshcop._udp.", "nn", "cool1",
+                                                  sizeof("cool1") - 1, "xp", reinterpret_cast<char *>(&xpanid),
+                                                  sizeof(xpanid), nullptr);
         assert(err == OTBR_ERROR_NONE);
-        err = sContext.mPublisher->PublishService(12345, "MultipleService2", "_meshcop._udp.", "nn", "cool2",
+        err = sContext.mPublisher->PublishService(12345, "MultipleService2", "_meshcop._udp.", "nn", "cool1",
                                                   sizeof("cool1") - 1, "xp", reinterpret_cast<char *>(&xpanid),
                                                   sizeof(xpanid), nullptr);
         assert(err == OTBR_ERROR_NONE);
+        err = sContext.mPublisher->PublishService(12345, "MultipleService2", "_meshcop._udp.", "nn", "cool2",
+                                                  sizeof("cool2") - 1, "xp", reinterpret_cast<char *>(&xpanid),
+                                                  sizeof(xpanid), nullptr);
+        assert(err == OTBR_ERROR_NONE);
+        err = sContext.mPublisher->EndBatch();
+        assert(err == OTBR_ERROR_NONE);
     }
 }
 
@@ -217,6 +241,211 @@ exit:
     return ret;
 }
 
+// The benchmark publishes services and times them through the same publisher: a service is announced when browsing
+// finds it, and updated when resolving it returns the new text record.
+static const char *   kBenchmarkType    = "_otbrbench._udp.";
+static const uint16_t kBenchmarkPort    = 12345;
+static const uint32_t kBenchmarkTimeout = 60; // seconds
+
+static struct Benchmark
+{
+    uint32_t                                           mCount;
+    uint32_t                                           mAnnounced;
+    uint32_t                                           mResolved;
+    uint32_t                                           mFailed;
+    std::vector<Mdns::ServiceHandle>                   mHandles;
+    std::vector<std::chrono::steady_clock::time_point> mStartTimes;
+    std::vector<double>                                mAnnounceLatencies;
+    std::vector<double>                                mUpdateLatencies;
+    struct rusage                                      mUsage;
+    otbrError                                          mResult;
+} sBenchmark;
+
+static std::string GetBenchmarkName(uint32_t aIndex)
+{
+    return "BenchService" + std::to_string(aIndex);
+}
+
+static bool GetBenchmarkIndex(const std::string &aName, uint32_t &aIndex)
+{
+    static const std::string kPrefix = "BenchService";
+    bool                     found   = false;
+
+    VerifyOrExit(aName.compare(0, kPrefix.size(), kPrefix) == 0);
+    aIndex = static_cast<uint32_t>(strtoul(aName.c_str() + kPrefix.size(), nullptr, 10));
+    found  = (aIndex < sBenchmark.mCount);
+
+exit:
+    return found;
+}
+
+static double GetElapsedMilliseconds(std::chrono::steady_clock::time_point aStart)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - aStart).count();
+}
+
+static void PrintLatencies(const char *aName, std::vector<double> aLatencies)
+{
+    std::sort(aLatencies.begin(), aLatencies.end());
+
+    if (aLatencies.empty())
+    {
+        printf("%-10s count 0\n", aName);
+    }
+    else
+    {
+        printf("%-10s count %zu p50 %.1fms p99 %.1fms max %.1fms\n", aName, aLatencies.size(),
+               aLatencies[aLatencies.size() / 2], aLatencies[(aLatencies.size() - 1) * 99 / 100], aLatencies.back());
+    }
+}
+
+static void ReportBenchmark(otbrError aResult)
+{
+    struct rusage usage;
+    double        user, system;
+
+    getrusage(RUSAGE_SELF, &usage);
+    user   = (usage.ru_utime.tv_sec - sBenchmark.mUsage.ru_utime.tv_sec) * 1000.0 +
+           (usage.ru_utime.tv_usec - sBenchmark.mUsage.ru_utime.tv_usec) / 1000.0;
+    system = (usage.ru_stime.tv_sec - sBenchmark.mUsage.ru_stime.tv_sec) * 1000.0 +
+             (usage.ru_stime.tv_usec - sBenchmark.mUsage.ru_stime.tv_usec) / 1000.0;
+
+    printf("services   %u failed %u\n", sBenchmark.mCount, sBenchmark.mFailed);
+    PrintLatencies("announce", sBenchmark.mAnnounceLatencies);
+    PrintLatencies("update", sBenchmark.mUpdateLatencies);
+    printf("cpu        user %.1fms system %.1fms\n", user, system);
+
+    sBenchmark.mResult = aResult;
+    sContext.mDone     = true;
+}
+
+static void HandleBenchmarkResolve(void *                                         aContext,
+                                   otbrError                                      aError,
+                                   const char *                                   aType,
+                                   const Mdns::Publisher::DiscoveredInstanceInfo &aInstance)
+{
+    uint32_t index   = 0;
+    bool     updated = false;
+
+    OTBR_UNUSED_VARIABLE(aContext);
+    OTBR_UNUSED_VARIABLE(aType);
+
+    if (aError == OTBR_ERROR_NONE && GetBenchmarkIndex(aInstance.mName, index))
+    {
+        for (const Mdns::Publisher::TxtEntry &entry : aInstance.mTxtList)
+        {
+            updated = updated || (entry.mName == "v" && entry.mValue == std::vector<uint8_t>{'1'});
+        }
+    }
+
+    if (updated)
+    {
+        sBenchmark.mUpdateLatencies.push_back(GetElapsedMilliseconds(sBenchmark.mStartTimes[index]));
+    }
+    else
+    {
+        sBenchmark.mFailed++;
+    }
+
+    if (++sBenchmark.mResolved == sBenchmark.mCount)
+    {
+        ReportBenchmark(sBenchmark.mFailed == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS);
+    }
+}
+
+static void UpdateBenchmarkServices(void)
+{
+    const Mdns::Publisher::TxtList txtList = {{"v", "1"}};
+
+    for (uint32_t index = 0; index < sBenchmark.mCount; index++)
+    {
+        otbrError err;
+
+        sBenchmark.mStartTimes[index] = std::chrono::steady_clock::now();
+        err = sContext.mPublisher->UpdateService(sBenchmark.mHandles[index], txtList);
+        assert(err == OTBR_ERROR_NONE);
+        err = sContext.mPublisher->Resolve(GetBenchmarkName(index).c_str(), kBenchmarkType, HandleBenchmarkResolve,
+                                           nullptr);
+        assert(err == OTBR_ERROR_NONE);
+        OTBR_UNUSED_VARIABLE(err);
+    }
+}
+
+static void HandleBenchmarkBrowse(void *aContext, const char *aType, const char *aName, bool aAdded)
+{
+    uint32_t index;
+
+    OTBR_UNUSED_VARIABLE(aContext);
+    OTBR_UNUSED_VARIABLE(aType);
+
+    VerifyOrExit(aAdded && sBenchmark.mAnnounced < sBenchmark.mCount && GetBenchmarkIndex(aName, index));
+
+    sBenchmark.mAnnounceLatencies.push_back(GetElapsedMilliseconds(sBenchmark.mStartTimes[index]));
+
+    if (++sBenchmark.mAnnounced == sBenchmark.mCount)
+    {
+        UpdateBenchmarkServices();
+    }
+
+exit:
+    return;
+}
+
+static void HandleBenchmarkTimeout(Timer &aTimer, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aTimer);
+    OTBR_UNUSED_VARIABLE(aContext);
+
+    sBenchmark.mFailed += sBenchmark.mCount - (sBenchmark.mAnnounced < sBenchmark.mCount ? sBenchmark.mAnnounced
+                                                                                         : sBenchmark.mResolved);
+    ReportBenchmark(OTBR_ERROR_MDNS);
+}
+
+void PublishBenchmarkServices(void *aContext, Mdns::State aState)
+{
+    const Mdns::Publisher::TxtList txtList = {{"v", "0"}};
+
+    assert(aContext == &sContext);
+    VerifyOrExit(aState == Mdns::kStateReady && sBenchmark.mHandles.empty());
+
+    getrusage(RUSAGE_SELF, &sBenchmark.mUsage);
+    sBenchmark.mHandles.resize(sBenchmark.mCount);
+    sBenchmark.mStartTimes.resize(sBenchmark.mCount);
+    SuccessOrDie(sContext.mPublisher->Browse(kBenchmarkType, HandleBenchmarkBrowse, nullptr), "Failed to browse");
+
+    for (uint32_t index = 0; index < sBenchmark.mCount; index++)
+    {
+        otbrError err;
+
+        sBenchmark.mStartTimes[index] = std::chrono::steady_clock::now();
+        err = sContext.mPublisher->PublishService(kBenchmarkPort, GetBenchmarkName(index).c_str(), kBenchmarkType,
+                                                  txtList, &sBenchmark.mHandles[index]);
+        assert(err == OTBR_ERROR_NONE);
+        OTBR_UNUSED_VARIABLE(err);
+    }
+
+exit:
+    return;
+}
+
+otbrError BenchmarkServices(uint32_t aCount)
+{
+    otbrError ret = OTBR_ERROR_NONE;
+    Timer     timer(HandleBenchmarkTimeout, nullptr);
+
+    Mdns::Publisher *pub = Mdns::Publisher::Create(AF_UNSPEC, nullptr, nullptr, PublishBenchmarkServices, &sContext);
+    sContext.mPublisher  = pub;
+    sBenchmark.mCount    = aCount;
+    SuccessOrExit(ret = pub->Start());
+    timer.Start(std::chrono::seconds(kBenchmarkTimeout));
+    VerifyOrExit(Mainloop(*pub) >= 0, ret = OTBR_ERROR_ERRNO);
+    ret = sBenchmark.mResult;
+
+exit:
+    Mdns::Publisher::Destroy(pub);
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
     int ret = 0;
@@ -226,7 +455,8 @@ int main(int argc, char *argv[])
         return 1;
     }
 
-    otbrLogInit("otbr-mdns", OTBR_LOG_DEBUG, true);
+    // Debug logs would take most of the time measured by the benchmark.
+    otbrLogInit("otbr-mdns", (argv[1][0] == 'b' ? OTBR_LOG_WARNING : OTBR_LOG_DEBUG), true);
     // allow quitting elegantly
     signal(SIGTERM, RecoverSignal);
     switch (argv[1][0])
@@ -247,6 +477,10 @@ int main(int argc, char *argv[])
         ret = TestStopService();
         break;
 
+    case 'b':
+        ret = BenchmarkServices(argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 100);
+        break;
+
     default:
         ret = 1;
         break;
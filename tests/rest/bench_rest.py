@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2020, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Load test of the otbr REST server.
+
+Concurrent clients send a weighted mix of requests for a fixed duration,
+reusing each connection for a given number of requests, and the throughput
+and latency percentiles are reported per resource and in total.
+
+Example:
+
+    bench_rest.py --clients 32 --duration 30 --reuse 100 \\
+        --mix /node/state:8,/node/rloc16:8,/diagnostics:1
+"""
+
+import argparse
+import http.client
+import json
+import random
+import socket
+import sys
+import threading
+import time
+
+DEFAULT_MIX = "/node/state:4,/node/rloc16:4,/node:1,/diagnostics:1"
+
+
+class UnixHTTPConnection(http.client.HTTPConnection):
+    """HTTP connection over the Unix domain socket of the REST server."""
+
+    def __init__(self, unix_path, timeout):
+        super().__init__("localhost", timeout=timeout)
+        self.unix_path = unix_path
+
+    def connect(self):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.settimeout(self.timeout)
+        self.sock.connect(self.unix_path)
+
+
+class Stats(object):
+
+    def __init__(self):
+        self.latencies = []
+        self.statuses = {}
+        self.errors = 0
+        self.bytes = 0
+
+    def merge(self, other):
+        self.latencies.extend(other.latencies)
+        for status, count in other.statuses.items():
+            self.statuses[status] = self.statuses.get(status, 0) + count
+        self.errors += other.errors
+        self.bytes += other.bytes
+
+
+def parse_mix(mix):
+    paths = []
+    weights = []
+
+    for item in mix.split(","):
+        path, _, weight = item.partition(":")
+        paths.append(path)
+        weights.append(int(weight) if weight else 1)
+
+    return paths, weights
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0.0
+
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def run_client(args, paths, weights, seed, start_time, stop_time, results):
+    rng = random.Random(seed)
+    stats = {path: Stats() for path in paths}
+    conn = None
+    served = 0
+
+    while time.monotonic() < start_time:
+        time.sleep(0.001)
+
+    while time.monotonic() < stop_time:
+        path = rng.choices(paths, weights)[0]
+
+        if conn is None:
+            if args.unix:
+                conn = UnixHTTPConnection(args.unix, args.timeout)
+            else:
+                conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+            served = 0
+
+        begin = time.perf_counter()
+        try:
+            conn.request("GET", path, headers={"Accept": args.accept})
+            response = conn.getresponse()
+            body = response.read()
+        except (OSError, http.client.HTTPException):
+            stats[path].errors += 1
+            conn.close()
+            conn = None
+            continue
+
+        stats[path].latencies.append(time.perf_counter() - begin)
+        stats[path].statuses[response.status] = stats[path].statuses.get(response.status, 0) + 1
+        stats[path].bytes += len(body)
+        served += 1
+
+        if served >= args.reuse or response.getheader("Connection", "").lower() == "close":
+            conn.close()
+            conn = None
+
+    if conn is not None:
+        conn.close()
+
+    results.append(stats)
+
+
+def format_row(name, stats, elapsed):
+    latencies = sorted(stats.latencies)
+
+    return "{:<24} {:>9} {:>10.1f} {:>9.2f} {:>9.2f} {:>9.2f} {:>7} {}".format(
+        name, len(latencies),
+        len(latencies) / elapsed, percentile(latencies, 0.5) * 1000, percentile(latencies, 0.99) * 1000,
+        (latencies[-1] if latencies else 0.0) * 1000, stats.errors,
+        " ".join("{}:{}".format(status, count) for status, count in sorted(stats.statuses.items())))
+
+
+def summarize(name, stats, elapsed):
+    latencies = sorted(stats.latencies)
+
+    return {
+        "resource": name,
+        "requests": len(latencies),
+        "requests_per_second": len(latencies) / elapsed,
+        "p50_ms": percentile(latencies, 0.5) * 1000,
+        "p99_ms": percentile(latencies, 0.99) * 1000,
+        "max_ms": (latencies[-1] if latencies else 0.0) * 1000,
+        "bytes": stats.bytes,
+        "errors": stats.errors,
+        "statuses": {str(status): count for status, count in stats.statuses.items()},
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load test of the otbr REST server.")
+    parser.add_argument("--host", default="0.0.0.0", help="address of the REST server")
+    parser.add_argument("--port", type=int, default=8081, help="port of the REST server")
+    parser.add_argument("--unix", help="Unix domain socket of the REST server, instead of the host and port")
+    parser.add_argument("--clients", type=int, default=16, help="number of concurrent clients")
+    parser.add_argument("--duration", type=float, default=10, help="measured duration in seconds")
+    parser.add_argument("--warmup", type=float, default=1, help="unmeasured duration before the measurement")
+    parser.add_argument("--reuse", type=int, default=1, help="requests sent on each connection, 1 to never reuse")
+    parser.add_argument("--mix", default=DEFAULT_MIX, help="comma separated resources with optional weights")
+    parser.add_argument("--accept", default="application/json", help="media type of the responses")
+    parser.add_argument("--timeout", type=float, default=10, help="timeout of each request in seconds")
+    parser.add_argument("--seed", type=int, default=0, help="seed of the resource choice of clients")
+    parser.add_argument("--json", action="store_true", help="print the results as JSON")
+    args = parser.parse_args()
+
+    paths, weights = parse_mix(args.mix)
+
+    if args.warmup > 0:
+        warmup_results = []
+        now = time.monotonic()
+        run_client(args, paths, weights, args.seed, now, now + args.warmup, warmup_results)
+
+    results = []
+    start_time = time.monotonic() + 0.5
+    stop_time = start_time + args.duration
+    threads = [
+        threading.Thread(target=run_client,
+                         args=(args, paths, weights, args.seed + i, start_time, stop_time, results))
+        for i in range(args.clients)
+    ]
+
+    for thread in threads:
+        thread.start()
+
+    for thread in threads:
+        thread.join()
+
+    elapsed = max(time.monotonic(), stop_time) - start_time
+    stats = {path: Stats() for path in paths}
+    total = Stats()
+
+    for client in results:
+        for path, client_stats in client.items():
+            stats[path].merge(client_stats)
+            total.merge(client_stats)
+
+    if args.json:
+        print(
+            json.dumps(
+                {
+                    "clients": args.clients,
+                    "duration": elapsed,
+                    "reuse": args.reuse,
+                    "resources": [summarize(path, stats[path], elapsed) for path in paths],
+                    "total": summarize("total", total, elapsed),
+                },
+                indent=2))
+    else:
+        print("clients {} duration {:.1f}s reuse {}".format(args.clients, elapsed, args.reuse))
+        print("{:<24} {:>9} {:>10} {:>9} {:>9} {:>9} {:>7} {}".format("resource", "requests", "req/s", "p50(ms)",
+                                                                      "p99(ms)", "max(ms)", "errors",
+                                                                      "statuses"))
+        for path in paths:
+            print(format_row(path, stats[path], elapsed))
+        print(format_row("total", total, elapsed))
+
+    return 0 if total.latencies and total.errors == 0 else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
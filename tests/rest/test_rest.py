@@ -29,9 +29,12 @@
 
 import urllib.request
 import urllib.error
+import http.client
 import ipaddress
+import gzip
 import json
 import re
+import socket
 from threading import Thread
 
 rest_api_addr = "http://0.0.0.0:8081"
@@ -280,6 +283,53 @@ def node_leader_data_check(data):
     return True
 
 
+def node_network_data_check(data):
+    assert data is not None
+
+    assert (type(data) == dict)
+
+    for key in ["Version", "StableVersion"]:
+        assert (key in data)
+        assert (type(data[key]) == int)
+
+    for key in ["OnMeshPrefixes", "ExternalRoutes", "Services", "BorderRouters"]:
+        assert (key in data)
+        assert (type(data[key]) == list)
+
+    for prefix in data["OnMeshPrefixes"] + data["ExternalRoutes"]:
+        assert (type(prefix["Prefix"]) == str)
+        assert (type(prefix["Rloc16"]) == int)
+        assert (prefix["Rloc16"] in data["BorderRouters"])
+
+    return True
+
+
+def commissioning_check(data):
+    assert data is not None
+
+    assert (type(data) == dict)
+
+    assert (data["State"] in ["disabled", "petition", "active"])
+
+    for key in ["Queued", "Active", "Joined", "Failed"]:
+        assert (key in data)
+        assert (type(data[key]) == int)
+
+    assert (type(data["Joiners"]) == list)
+    assert (len(data["Joiners"]) == data["Queued"] + data["Active"] +
+            data["Joined"] + data["Failed"])
+
+    for joiner in data["Joiners"]:
+        assert (len(joiner["Eui64"]) == 16)
+        assert (joiner["State"] in [
+            "queued", "active", "connected", "finalizing", "joined", "failed"
+        ])
+        for key in ["Attempts", "QueueTime", "JoinTime"]:
+            assert (type(joiner[key]) == int)
+
+    return True
+
+
 def node_num_of_router_check(data):
     assert data is not None
 
@@ -381,6 +431,31 @@ def node_leader_data_test(thread_num):
     print(" /node/leader-data : all {}, valid {} ".format(thread_num, valid))
 
 
+def node_network_data_test(thread_num):
+    url = rest_api_addr + "/node/network-data"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [node_network_data_check(data) for data in response_data
+             ].count(True)
+
+    print(" /node/network-data : all {}, valid {} ".format(thread_num, valid))
+
+
+def commissioning_test(thread_num):
+    url = rest_api_addr + "/commissioning"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [commissioning_check(data) for data in response_data].count(True)
+
+    print(" /commissioning : all {}, valid {} ".format(thread_num, valid))
+
+
 def node_num_of_router_test(thread_num):
     url = rest_api_addr + "/node/num-of-router"
 
@@ -428,6 +503,49 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def node_diagnostics_test(thread_num):
+    rloc16 = [None]
+
+    get_data_from_url(rest_api_addr + "/node/rloc16", rloc16, 0)
+
+    url = rest_api_addr + "/diagnostics/0x{:04x}".format(rloc16[0])
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [
+        diagnostics_check([data]) == 2 and data["Rloc16"] == rloc16[0]
+        for data in response_data
+    ].count(True)
+
+    print(" /diagnostics/{{rloc16}} : all {}, valid {} ".format(
+        thread_num, valid))
+
+
+def filtered_diagnostics_test(thread_num):
+    rloc16 = [None]
+
+    get_data_from_url(rest_api_addr + "/node/rloc16", rloc16, 0)
+
+    # MAC counters (type 9) of this node only.
+    url = rest_api_addr + "/diagnostics?tlvs=9&nodes=0x{:04x}".format(
+        rloc16[0])
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [
+        len(data) == 1 and data[0]["Rloc16"] == rloc16[0] and
+        set(data[0].keys()) == {"Rloc16", "MACCounters", "Age"}
+        for data in response_data
+    ].count(True)
+
+    print(" /diagnostics?tlvs&nodes : all {}, valid {} ".format(
+        thread_num, valid))
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -440,6 +558,325 @@ def error_test(thread_num):
     print(" /v1/hello : all {}, valid {} ".format(thread_num, valid))
 
 
+def keep_alive_test(request_num):
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    valid = 0
+    for i in range(request_num):
+        conn.request("GET", "/node/rloc16")
+        response = conn.getresponse()
+        if response.status == 200 and node_rloc16_check(
+                json.loads(response.read())):
+            valid += 1
+
+    conn.close()
+
+    print(" keep-alive /node/rloc16 : all {}, valid {} ".format(
+        request_num, valid))
+
+
+def pipelining_test(request_num):
+    sock = socket.create_connection(("0.0.0.0", 8081))
+    sock.sendall(b"GET /node/state HTTP/1.1\r\nHost: 0.0.0.0\r\n\r\n" *
+                 request_num)
+
+    received = b""
+    while received.count(b"HTTP/1.1 200 OK") < request_num:
+        data = sock.recv(4096)
+        if not data:
+            break
+        received += data
+
+    sock.close()
+
+    print(" pipelining /node/state : all {}, valid {} ".format(
+        request_num, received.count(b"HTTP/1.1 200 OK")))
+
+
+def etag_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/network-name")
+    response = conn.getresponse()
+    response.read()
+    etag = response.getheader("ETag")
+
+    conn.request("GET", "/node/network-name", headers={"If-None-Match": etag})
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    print(" ETag /node/network-name : valid {} ".format(
+        etag is not None and response.status == 304))
+
+
+def cbor_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/rloc16")
+    response = conn.getresponse()
+    rloc16 = json.loads(response.read())
+
+    conn.request("GET", "/node/rloc16", headers={"Accept": "application/cbor"})
+    response = conn.getresponse()
+    body = response.read()
+
+    conn.close()
+
+    # An unsigned integer, with the value in the initial byte or in the following 1 or 2 bytes.
+    if len(body) > 0 and body[0] < 0x18:
+        value = body[0]
+    else:
+        value = int.from_bytes(body[1:], "big")
+
+    print(" CBOR /node/rloc16 : valid {} ".format(
+        response.getheader("Content-Type") == "application/cbor" and
+        value == rloc16))
+
+
+def gzip_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/diagnostics", headers={"Accept-Encoding": "gzip"})
+    response = conn.getresponse()
+    body = response.read()
+
+    conn.close()
+
+    # Only large bodies are compressed, and only when the server is built with gzip support.
+    if response.getheader("Content-Encoding") == "gzip":
+        body = gzip.decompress(body)
+
+    print(" gzip /diagnostics : valid {} ".format(
+        isinstance(json.loads(body), list) and
+        (response.getheader("Content-Encoding") is None or
+         "Accept-Encoding" in response.getheader("Vary", ""))))
+
+
+def ipv6_test():
+    conn = http.client.HTTPConnection("::1", 8081)
+
+    conn.request("GET", "/node/state")
+    response = conn.getresponse()
+    data = json.loads(response.read())
+
+    conn.close()
+
+    print(" IPv6 /node/state : valid {} ".format(
+        response.status == 200 and node_state_check(data)))
+
+
+def batch_test(thread_num):
+    url = rest_api_addr + "/batch?paths=/node/state,/node/rloc16,/node/leader-data"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [
+        node_state_check(data["/node/state"]) and
+        node_rloc16_check(data["/node/rloc16"]) and
+        node_leader_data_check(data["/node/leader-data"])
+        for data in response_data
+    ].count(True)
+
+    print(" /batch : all {}, valid {} ".format(thread_num, valid))
+
+
+def event_stream_test():
+    sock = socket.create_connection(("0.0.0.0", 8081))
+    sock.sendall(b"GET /events HTTP/1.1\r\nHost: 0.0.0.0\r\n\r\n")
+
+    received = b""
+    while b"event: state\ndata: " not in received:
+        data = sock.recv(4096)
+        if not data:
+            break
+        received += data
+
+    sock.close()
+
+    valid = b"text/event-stream" in received and b"event: state\ndata: " in received
+
+    print(" /events : valid {} ".format(valid))
+
+
+def topology_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/topology")
+    response = conn.getresponse()
+    snapshot = json.loads(response.read())
+
+    # Nothing changed since the snapshot, unless a diagnostic response arrived in between.
+    conn.request("GET", "/topology?since={}".format(snapshot["Version"]))
+    response = conn.getresponse()
+    delta = json.loads(response.read())
+
+    conn.request("GET", "/topology?since=abc")
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    print(" /topology : valid {} ".format(
+        snapshot["Full"] and isinstance(snapshot["Nodes"], list) and
+        (delta["Version"] != snapshot["Version"] or
+         (not delta["Full"] and delta["Nodes"] == [] and delta["Removed"] == [])) and response.status == 400))
+
+
+def mesh_counters_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/mesh/counters")
+    response = conn.getresponse()
+    counters = json.loads(response.read())
+
+    conn.request("POST", "/mesh/counters")
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    # The sums are over the nodes whose diagnostics include MAC counters, none of them is negative.
+    print(" /mesh/counters : valid {} ".format(
+        all(counters[key] >= 0 for key in ("Nodes", "IfInErrors", "IfOutErrors", "IfInDiscards", "IfOutDiscards")) and
+        response.status == 405))
+
+
+def counters_history_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/counters/history?resolution=1s")
+    response = conn.getresponse()
+    history = json.loads(response.read())
+    samples = history["Samples"]
+
+    conn.request("GET", "/node/counters/history?resolution=1d")
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    # A sample is taken with each snapshot of the node state, the previous tests ran for more than a second.
+    print(" /node/counters/history : valid {} ".format(
+        history["Period"] == 1 and len(samples) > 1 and
+        all(earlier["Time"] < later["Time"] for earlier, later in zip(samples, samples[1:])) and
+        "TxTotal" in samples[-1]["LinkCounters"] and "RxSuccess" in samples[-1]["Ip6Counters"] and
+        response.status == 400))
+
+
+def channel_history_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/channel-occupancy/history?resolution=1h")
+    response = conn.getresponse()
+    history = json.loads(response.read())
+    windows = history["Windows"]
+
+    conn.request("GET", "/node/channel-occupancy/history?resolution=1s")
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    # The channel monitor may not have sampled the channels yet, only the layout of the windows is checked.
+    print(" /node/channel-occupancy/history : valid {} ".format(
+        history["Period"] == 3600 and
+        all(earlier["Time"] < later["Time"] for earlier, later in zip(windows, windows[1:])) and
+        all(occupancy["Min"] <= occupancy["Average"] <= occupancy["Max"]
+            for window in windows
+            for occupancy in window["Channels"]) and response.status == 400))
+
+
+def link_quality_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/neighbor-table/link-quality")
+    response = conn.getresponse()
+    neighbors = json.loads(response.read())
+
+    conn.close()
+
+    print(" /node/neighbor-table/link-quality : valid {} ".format(
+        response.status == 200 and all(
+            len(neighbor["RssiHistogram"]) == 8 and len(neighbor["LinkQualityHistogram"]) == 4 and
+            sum(neighbor["RssiHistogram"]) == neighbor["Samples"] and neighbor["MinRssi"] <= neighbor["MaxRssi"]
+            for neighbor in neighbors)))
+
+
+def table_changes_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/child-table")
+    response = conn.getresponse()
+    table = json.loads(response.read())
+
+    conn.request("GET", "/node/child-table?since={}".format(table["Version"]))
+    response = conn.getresponse()
+    changes = json.loads(response.read())
+
+    conn.request("GET", "/node/neighbor-table?since=x")
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    # The table rarely changes between two requests, a later version only adds to the changes.
+    print(" /node/child-table : valid {} ".format(table["Full"] and not table["Removed"] and
+                                                 changes["Version"] >= table["Version"] and
+                                                 (not changes["Full"] or changes["Version"] > table["Version"]) and
+                                                 response.status == 400))
+
+
+def pagination_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/node/neighbor-table")
+    response = conn.getresponse()
+    table = json.loads(response.read())
+
+    paged = []
+    cursor = None
+    while True:
+        conn.request("GET", "/node/neighbor-table?limit=1" + ("&cursor=" + cursor if cursor else ""))
+        response = conn.getresponse()
+        page = json.loads(response.read())
+        paged.extend(page["Added"])
+        cursor = response.getheader("Next-Cursor")
+        if cursor is None or len(paged) > len(table["Added"]):
+            break
+
+    conn.request("GET", "/diagnostics?limit=0")
+    response = conn.getresponse()
+    response.read()
+
+    conn.close()
+
+    # The pages follow the order of the extended addresses, the table does not change between requests here.
+    print(" /node/neighbor-table pages : valid {} ".format(
+        sorted(neighbor["ExtAddress"] for neighbor in table["Added"]) == [neighbor["ExtAddress"] for neighbor in paged]
+        and response.status == 400))
+
+
+def metrics_test():
+    conn = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    conn.request("GET", "/metrics")
+    response = conn.getresponse()
+    body = response.read().decode()
+
+    conn.close()
+
+    # The node requests of the previous tests are counted under their route pattern.
+    print(" /metrics : valid {} ".format(
+        response.status == 200 and
+        response.getheader("Content-Type", "").startswith("text/plain") and
+        'otbr_rest_requests_total{resource="/node/state",code="200"}' in body and
+        "otbr_rest_request_duration_seconds_bucket" in body))
+
+
 def main():
     node_test(200)
     node_rloc_test(200)
@@ -448,10 +885,30 @@ def main():
     node_state_test(200)
     node_network_name_test(200)
     node_leader_data_test(200)
+    node_network_data_test(200)
     node_num_of_router_test(200)
     node_ext_panid_test(200)
+    commissioning_test(20)
     diagnostics_test(20)
+    node_diagnostics_test(20)
+    filtered_diagnostics_test(20)
     error_test(10)
+    batch_test(20)
+    etag_test()
+    cbor_test()
+    gzip_test()
+    ipv6_test()
+    keep_alive_test(10)
+    pipelining_test(10)
+    event_stream_test()
+    topology_test()
+    mesh_counters_test()
+    counters_history_test()
+    channel_history_test()
+    link_quality_test()
+    table_changes_test()
+    pagination_test()
+    metrics_test()
 
     return 0
 
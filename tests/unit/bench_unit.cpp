@@ -0,0 +1,298 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the benchmarks of the REST JSON serialization and of the event emitter dispatch.
+ *
+ *   Each benchmark is repeated with a growing number of iterations until it runs for at least the minimum time, and
+ *   the time and the number of heap allocations of one iteration are reported.
+ *
+ *   Usage: otbr-unit-bench [min-seconds [filter]]
+ */
+
+#include <chrono>
+#include <functional>
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "utils/event_emitter.hpp"
+
+#if OTBR_ENABLE_REST_SERVER
+#include "rest/json.hpp"
+#endif
+
+namespace {
+
+double      sMinSeconds  = 0.5;
+const char *sFilter      = nullptr;
+uint64_t    sAllocations = 0;
+uint64_t    sSink        = 0;
+
+void Run(const std::string &aName, const std::function<void(void)> &aIteration)
+{
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t iterations = 1;
+    uint64_t allocations;
+    double   seconds;
+
+    if (sFilter != nullptr && aName.find(sFilter) == std::string::npos)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        Clock::time_point begin = Clock::now();
+
+        allocations = sAllocations;
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            aIteration();
+        }
+        allocations = sAllocations - allocations;
+
+        seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+        if (seconds >= sMinSeconds || iterations >= (UINT64_MAX >> 1))
+        {
+            break;
+        }
+
+        iterations *= 2;
+    }
+
+    printf("%-32s %12llu %14.1f %12.1f\n", aName.c_str(), static_cast<unsigned long long>(iterations),
+           seconds * 1e9 / iterations, static_cast<double>(allocations) / iterations);
+}
+
+#if OTBR_ENABLE_REST_SERVER
+// The TLVs a full thread device answers to a diagnostic query, with its neighbours numbered by @p aIndex.
+std::vector<otNetworkDiagTlv> MakeDiagContent(uint16_t aIndex)
+{
+    std::vector<otNetworkDiagTlv> content;
+    otNetworkDiagTlv              tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+    memset(tlv.mData.mExtAddress.m8, static_cast<int>(aIndex), sizeof(tlv.mData.mExtAddress.m8));
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = static_cast<uint16_t>(aIndex << 10);
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_MODE;
+    tlv.mData.mMode.mRxOnWhenIdle = true;
+    tlv.mData.mMode.mDeviceType   = true;
+    tlv.mData.mMode.mNetworkData  = true;
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                              = OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY;
+    tlv.mData.mConnectivity.mLinkQuality3  = 3;
+    tlv.mData.mConnectivity.mActiveRouters = 16;
+    tlv.mData.mConnectivity.mSedBufferSize = 1280;
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    tlv.mData.mRoute.mRouteCount = 16;
+    for (uint8_t i = 0; i < tlv.mData.mRoute.mRouteCount; i++)
+    {
+        tlv.mData.mRoute.mRouteData[i].mRouterId       = i;
+        tlv.mData.mRoute.mRouteData[i].mLinkQualityOut = 3;
+        tlv.mData.mRoute.mRouteData[i].mLinkQualityIn  = 3;
+        tlv.mData.mRoute.mRouteData[i].mRouteCost      = 1;
+    }
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                          = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA;
+    tlv.mData.mLeaderData.mPartitionId = 0x12345678;
+    tlv.mData.mLeaderData.mWeighting   = 64;
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST;
+    tlv.mData.mIp6AddrList.mCount = 4;
+    for (uint8_t i = 0; i < tlv.mData.mIp6AddrList.mCount; i++)
+    {
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[0]  = 0xfd;
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[15] = i;
+    }
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                              = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+    tlv.mData.mMacCounters.mIfInUcastPkts  = 123456;
+    tlv.mData.mMacCounters.mIfOutUcastPkts = 654321;
+    content.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    tlv.mData.mChildTable.mCount = 8;
+    for (uint8_t i = 0; i < tlv.mData.mChildTable.mCount; i++)
+    {
+        tlv.mData.mChildTable.mTable[i].mChildId = i;
+        tlv.mData.mChildTable.mTable[i].mTimeout = 10;
+    }
+    content.push_back(tlv);
+
+    return content;
+}
+
+void BenchJson(void)
+{
+    static const uint16_t kNodeCounts[] = {50, 200, 500};
+
+    for (uint16_t count : kNodeCounts)
+    {
+        std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            diagSet.push_back(MakeDiagContent(i));
+        }
+
+        Run("Diag2JsonString[" + std::to_string(count) + "]",
+            [&diagSet]() { sSink += otbr::rest::Json::Diag2JsonString(diagSet).size(); });
+        Run("Diag2JsonString[" + std::to_string(count) + "]/compact",
+            [&diagSet]() { sSink += otbr::rest::Json::Diag2JsonString(diagSet, false).size(); });
+    }
+
+    {
+        static const uint8_t kExtPanId[]   = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+        static const uint8_t kExtAddress[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef};
+        otbr::rest::NodeInfo node;
+
+        memset(&node.mRlocAddress, 0, sizeof(node.mRlocAddress));
+        memset(&node.mLeaderData, 0, sizeof(node.mLeaderData));
+        node.mRole        = 4;
+        node.mNumOfRouter = 16;
+        node.mRloc16      = 0x2c00;
+        node.mExtPanId    = kExtPanId;
+        node.mExtAddress  = kExtAddress;
+        node.mNetworkName = "OpenThread";
+
+        Run("Node2JsonString", [&node]() { sSink += otbr::rest::Json::Node2JsonString(node).size(); });
+    }
+}
+#endif // OTBR_ENABLE_REST_SERVER
+
+void HandleUntypedEvent(void *aContext, int aEvent, va_list aArguments)
+{
+    sSink += static_cast<uint64_t>(aEvent) + va_arg(aArguments, unsigned) + (aContext != nullptr);
+}
+
+void HandleTypedEvent(void *aContext, uint16_t aValue)
+{
+    sSink += aValue + (aContext != nullptr);
+}
+
+void BenchEventEmitter(void)
+{
+    // Within the capacity of the handlers when built with fixed containers.
+    static const size_t kHandlerCounts[] = {1, 4, OTBR_EVENT_MAX_HANDLERS};
+
+    for (size_t count : kHandlerCounts)
+    {
+        otbr::EventEmitter                             untyped;
+        otbr::TypedEventEmitter<void(uint16_t aValue)> typed;
+        std::vector<int>                               contexts(count);
+
+        for (int &context : contexts)
+        {
+            untyped.On(1, HandleUntypedEvent, &context);
+            typed.On<0>(HandleTypedEvent, &context);
+        }
+
+        Run("EventEmitter::Emit[" + std::to_string(count) + "]", [&untyped]() { untyped.Emit(1, 2u); });
+        Run("TypedEventEmitter::Emit[" + std::to_string(count) + "]",
+            [&typed]() { typed.Emit<0>(static_cast<uint16_t>(2)); });
+    }
+}
+
+} // namespace
+
+// Counts the heap allocations of the benchmarks.
+void *operator new(size_t aSize)
+{
+    void *pointer = malloc(aSize == 0 ? 1 : aSize);
+
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    sAllocations++;
+
+    return pointer;
+}
+
+void operator delete(void *aPointer) noexcept
+{
+    free(aPointer);
+}
+
+void operator delete(void *aPointer, size_t) noexcept
+{
+    free(aPointer);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        sMinSeconds = strtod(argv[1], nullptr);
+    }
+
+    if (argc > 2)
+    {
+        sFilter = argv[2];
+    }
+
+    printf("%-32s %12s %14s %12s\n", "benchmark", "iterations", "ns/iter", "allocs/iter");
+
+#if OTBR_ENABLE_REST_SERVER
+    BenchJson();
+#endif
+    BenchEventEmitter();
+
+    printf("%-32s %12llu\n", "checksum", static_cast<unsigned long long>(sSink));
+
+    return EXIT_SUCCESS;
+}
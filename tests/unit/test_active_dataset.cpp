@@ -0,0 +1,121 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/tlv.hpp"
+#include "utils/active_dataset.hpp"
+
+using otbr::Tlv;
+using otbr::TlvIterator;
+namespace Meshcop = otbr::Meshcop;
+
+static const uint8_t kPskc[] = {
+    0xc2, 0x3a, 0x76, 0xe9, 0x8f, 0x1a, 0x64, 0x83, 0x63, 0x9b, 0x1a, 0xc1, 0x27, 0x1e, 0x2e, 0x27,
+};
+
+static const Tlv *FindTlv(const std::vector<uint8_t> &aTlvs, uint8_t aType)
+{
+    const Tlv *tlv = TlvIterator::Find(aTlvs.data(), aTlvs.size(), aType);
+
+    CHECK(tlv != nullptr);
+
+    return tlv;
+}
+
+TEST_GROUP(ActiveDataset){};
+
+TEST(ActiveDataset, TestBuild)
+{
+    static const uint8_t kMasterKey[] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+    static const uint8_t kExtPanId[]        = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+    static const uint8_t kChannel[]         = {0x00, 0x00, 0x0f};
+    static const uint8_t kActiveTimestamp[] = {0, 0, 0, 0, 0, 1, 0, 0};
+    std::vector<uint8_t> tlvs;
+    const Tlv *          tlv;
+    size_t               count = 0;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Utils::BuildActiveDataset("00112233445566778899aabbccddeeff", "OpenThread", 15,
+                                                                 0xdead00beef00cafe, 0x1234, kPskc, tlvs));
+
+    tlv = FindTlv(tlvs, Meshcop::kMasterKey);
+    CHECK_EQUAL(sizeof(kMasterKey), tlv->GetLength());
+    MEMCMP_EQUAL(kMasterKey, tlv->GetValue(), sizeof(kMasterKey));
+
+    tlv = FindTlv(tlvs, Meshcop::kExtendedPanId);
+    MEMCMP_EQUAL(kExtPanId, tlv->GetValue(), sizeof(kExtPanId));
+
+    tlv = FindTlv(tlvs, Meshcop::kChannel);
+    CHECK_EQUAL(sizeof(kChannel), tlv->GetLength());
+    MEMCMP_EQUAL(kChannel, tlv->GetValue(), sizeof(kChannel));
+
+    tlv = FindTlv(tlvs, Meshcop::kPanId);
+    CHECK_EQUAL(0x1234, tlv->GetValueUInt16());
+
+    tlv = FindTlv(tlvs, Meshcop::kNetworkName);
+    CHECK_EQUAL(strlen("OpenThread"), tlv->GetLength());
+    MEMCMP_EQUAL("OpenThread", tlv->GetValue(), tlv->GetLength());
+
+    tlv = FindTlv(tlvs, Meshcop::kPskc);
+    MEMCMP_EQUAL(kPskc, tlv->GetValue(), sizeof(kPskc));
+
+    tlv = FindTlv(tlvs, Meshcop::kActiveTimestamp);
+    MEMCMP_EQUAL(kActiveTimestamp, tlv->GetValue(), sizeof(kActiveTimestamp));
+
+    // A unique local mesh local prefix.
+    tlv = FindTlv(tlvs, Meshcop::kMeshLocalPrefix);
+    CHECK_EQUAL(8, tlv->GetLength());
+    CHECK_EQUAL(0xfd, static_cast<const uint8_t *>(tlv->GetValue())[0]);
+
+    FindTlv(tlvs, Meshcop::kChannelMask);
+    FindTlv(tlvs, Meshcop::kSecurityPolicy);
+
+    for (TlvIterator iterator(tlvs.data(), tlvs.size()); iterator != TlvIterator(); ++iterator)
+    {
+        count++;
+    }
+    CHECK_EQUAL(10, count);
+}
+
+TEST(ActiveDataset, TestInvalidArgs)
+{
+    std::vector<uint8_t> tlvs;
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS,
+                otbr::Utils::BuildActiveDataset("00112233", "OpenThread", 15, 0xdead00beef00cafe, 0x1234, kPskc, tlvs));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS,
+                otbr::Utils::BuildActiveDataset("00112233445566778899aabbccddeeff", "A network name too long", 15,
+                                                0xdead00beef00cafe, 0x1234, kPskc, tlvs));
+    CHECK(tlvs.empty());
+}
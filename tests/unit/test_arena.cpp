@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/arena.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Arena;
+using otbr::ArenaAllocator;
+using otbr::ArenaString;
+using otbr::ArenaVector;
+
+TEST_GROUP(Arena){};
+
+TEST(Arena, TestAllocate)
+{
+    Arena arena(64);
+    void *first  = arena.Allocate(3, 1);
+    void *second = arena.Allocate(8, 8);
+
+    // Allocations are carved from the same block, aligned as requested.
+    CHECK_EQUAL(0u, reinterpret_cast<uintptr_t>(second) % 8);
+    CHECK(static_cast<uint8_t *>(second) > static_cast<uint8_t *>(first));
+    CHECK_EQUAL(64u, arena.GetCapacity());
+
+    // Allocations larger than a block get a block of their own.
+    arena.Allocate(100, 1);
+    CHECK(arena.GetCapacity() > 64u + 100u);
+
+    // The first block is kept across resets.
+    arena.Reset();
+    CHECK_EQUAL(0u, arena.GetUsed());
+    CHECK_EQUAL(64u, arena.GetCapacity());
+    CHECK_EQUAL(first, arena.Allocate(3, 1));
+}
+
+TEST(Arena, TestContainers)
+{
+    Arena                    arena;
+    ArenaAllocator<char>     allocator(arena);
+    ArenaString              string(allocator);
+    ArenaVector<ArenaString> strings(allocator);
+
+    string.append("GET /node/state HTTP/1.1, which does not fit in the small string buffer");
+    strings.emplace_back(string);
+    strings.emplace_back("Accept", allocator);
+
+    CHECK(arena.GetUsed() > string.size());
+    CHECK(strings[0] == string);
+    CHECK(strings[1] == "Accept");
+    CHECK(strings.get_allocator() == string.get_allocator());
+}
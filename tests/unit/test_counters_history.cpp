@@ -0,0 +1,151 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "agent/counters_history.hpp"
+
+using otbr::Ncp::CountersHistory;
+
+static void AddSample(CountersHistory &aHistory, uint64_t aTime, uint32_t aTxTotal)
+{
+    otMacCounters macCounters;
+    otIpCounters  ipCounters;
+
+    memset(&macCounters, 0, sizeof(macCounters));
+    memset(&ipCounters, 0, sizeof(ipCounters));
+    macCounters.mTxTotal  = aTxTotal;
+    ipCounters.mTxSuccess = aTxTotal;
+    aHistory.Add(aTime, macCounters, ipCounters);
+}
+
+TEST_GROUP(CountersHistory){};
+
+TEST(CountersHistory, TestRingWrap)
+{
+    CountersHistory                      history;
+    std::vector<CountersHistory::Sample> samples;
+
+    for (uint32_t i = 0; i < OTBR_COUNTERS_HISTORY_SECONDS + 10; i++)
+    {
+        AddSample(history, 1000 + i, i);
+    }
+
+    history.Query(CountersHistory::kResolutionSecond, 0, UINT64_MAX, samples);
+    CHECK_EQUAL(OTBR_COUNTERS_HISTORY_SECONDS, samples.size());
+    CHECK_EQUAL(1010, samples.front().mTime);
+    CHECK_EQUAL(10, samples.front().mMacCounters.mTxTotal);
+    CHECK_EQUAL(1000 + OTBR_COUNTERS_HISTORY_SECONDS + 9, samples.back().mTime);
+
+    for (size_t i = 1; i < samples.size(); i++)
+    {
+        CHECK_EQUAL(samples[i - 1].mTime + 1, samples[i].mTime);
+    }
+}
+
+TEST(CountersHistory, TestReplaceWithinPeriod)
+{
+    CountersHistory                      history;
+    std::vector<CountersHistory::Sample> samples;
+
+    AddSample(history, 3600, 1);
+    AddSample(history, 3610, 2);
+    AddSample(history, 3659, 3);
+    AddSample(history, 3660, 4);
+
+    history.Query(CountersHistory::kResolutionSecond, 0, UINT64_MAX, samples);
+    CHECK_EQUAL(4, samples.size());
+
+    // The last sample of a period replaces the earlier ones.
+    history.Query(CountersHistory::kResolutionMinute, 0, UINT64_MAX, samples);
+    CHECK_EQUAL(2, samples.size());
+    CHECK_EQUAL(3659, samples[0].mTime);
+    CHECK_EQUAL(3, samples[0].mMacCounters.mTxTotal);
+    CHECK_EQUAL(3, samples[0].mIpCounters.mTxSuccess);
+    CHECK_EQUAL(3660, samples[1].mTime);
+
+    history.Query(CountersHistory::kResolutionHour, 0, UINT64_MAX, samples);
+    CHECK_EQUAL(1, samples.size());
+    CHECK_EQUAL(3660, samples[0].mTime);
+    CHECK_EQUAL(4, samples[0].mMacCounters.mTxTotal);
+}
+
+TEST(CountersHistory, TestClockSetBack)
+{
+    CountersHistory                      history;
+    std::vector<CountersHistory::Sample> samples;
+
+    AddSample(history, 7200, 1);
+    AddSample(history, 7201, 2);
+    AddSample(history, 7300, 3);
+    AddSample(history, 7250, 4);
+
+    for (uint8_t resolution = 0; resolution < CountersHistory::kNumResolutions; resolution++)
+    {
+        history.Query(resolution, 0, UINT64_MAX, samples);
+        CHECK_EQUAL(1, samples.size());
+        CHECK_EQUAL(7250, samples[0].mTime);
+        CHECK_EQUAL(4, samples[0].mMacCounters.mTxTotal);
+    }
+
+    AddSample(history, 7251, 5);
+    history.Query(CountersHistory::kResolutionSecond, 0, UINT64_MAX, samples);
+    CHECK_EQUAL(2, samples.size());
+}
+
+TEST(CountersHistory, TestSinceUntil)
+{
+    CountersHistory                      history;
+    std::vector<CountersHistory::Sample> samples;
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        AddSample(history, 500 + i, i);
+    }
+
+    history.Query(CountersHistory::kResolutionSecond, 503, 506, samples);
+    CHECK_EQUAL(4, samples.size());
+    CHECK_EQUAL(503, samples.front().mTime);
+    CHECK_EQUAL(506, samples.back().mTime);
+
+    history.Query(CountersHistory::kResolutionSecond, 509, 509, samples);
+    CHECK_EQUAL(1, samples.size());
+
+    history.Query(CountersHistory::kResolutionSecond, 510, UINT64_MAX, samples);
+    CHECK_EQUAL(0, samples.size());
+
+    history.Query(CountersHistory::kResolutionSecond, 0, 499, samples);
+    CHECK_EQUAL(0, samples.size());
+
+    history.Query(CountersHistory::kResolutionSecond, 506, 503, samples);
+    CHECK_EQUAL(0, samples.size());
+}
@@ -0,0 +1,64 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/crc16.hpp"
+
+static const uint8_t kCheckInput[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_GROUP(Crc16){};
+
+TEST(Crc16, TestCheckValues)
+{
+    otbr::Crc16 ccitt(otbr::Crc16::kCcitt);
+    otbr::Crc16 ansi(otbr::Crc16::kAnsi);
+
+    ccitt.Update(kCheckInput, sizeof(kCheckInput));
+    ansi.Update(kCheckInput, sizeof(kCheckInput));
+
+    CHECK_EQUAL(0x31c3, ccitt.Get());
+    CHECK_EQUAL(0xfee8, ansi.Get());
+}
+
+TEST(Crc16, TestBulkMatchesBytes)
+{
+    for (size_t length = 0; length <= sizeof(kCheckInput); length++)
+    {
+        otbr::Crc16 bytes(otbr::Crc16::kAnsi);
+        otbr::Crc16 bulk(otbr::Crc16::kAnsi);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            bytes.Update(kCheckInput[i]);
+        }
+
+        bulk.Update(kCheckInput, length);
+        CHECK_EQUAL(bytes.Get(), bulk.Get());
+    }
+}
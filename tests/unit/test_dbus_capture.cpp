@@ -0,0 +1,142 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/server/dbus_capture.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::DBus::DBusCapture;
+
+namespace {
+
+DBusMessage *NewMethodCall(const char *aMethod)
+{
+    return dbus_message_new_method_call(OTBR_DBUS_SERVER_PREFIX "wpan0", OTBR_DBUS_OBJECT_PREFIX "wpan0",
+                                        OTBR_DBUS_THREAD_INTERFACE, aMethod);
+}
+
+} // namespace
+
+TEST_GROUP(DBusCapture)
+{
+    void setup()
+    {
+        char pattern[] = "/tmp/otbr-test-dbus-capture-XXXXXX";
+
+        CHECK(mkdtemp(pattern) != nullptr);
+        mDirectory = pattern;
+        mPath      = mDirectory + "/capture";
+    }
+
+    void teardown()
+    {
+        unlink(mPath.c_str());
+        rmdir(mDirectory.c_str());
+    }
+
+    std::string mDirectory;
+    std::string mPath;
+};
+
+TEST(DBusCapture, TestRoundTrip)
+{
+    DBusCapture           capture;
+    DBusMessage *         message = NewMethodCall(OTBR_DBUS_REMOVE_COMMISSIONING_JOINER_METHOD);
+    DBusMessage *         secret  = NewMethodCall(OTBR_DBUS_JOINER_START_METHOD);
+    DBusMessage *         replayed;
+    std::tuple<uint64_t>  args(0x1122334455667788ULL);
+    std::tuple<uint64_t>  replayedArgs(0);
+    otbrDBusCaptureHeader header;
+    otbrDBusCaptureRecord record;
+    std::vector<char>     buffer;
+    FILE *                file;
+
+    std::tuple<std::string, std::string, std::string, std::string, std::string, std::string> joinerArgs(
+        "J01NME", "", "", "", "", "");
+
+    CHECK(message != nullptr && secret != nullptr);
+    CHECK(otbr::DBus::TupleToDBusMessage(*message, args) == OTBR_ERROR_NONE);
+    CHECK(otbr::DBus::TupleToDBusMessage(*secret, joinerArgs) == OTBR_ERROR_NONE);
+    CHECK(DBusCapture::IsSecret(*secret));
+    CHECK(!DBusCapture::IsSecret(*message));
+
+    CHECK(capture.Open(mPath.c_str()) == OTBR_ERROR_NONE);
+    capture.Record(*secret, 1000, 10);
+    capture.Record(*message, 2000, 20);
+    capture.Close();
+
+    CHECK(access(mPath.c_str(), F_OK) == 0);
+    file = fopen(mPath.c_str(), "rb");
+    CHECK(file != nullptr);
+    CHECK(fread(&header, sizeof(header), 1, file) == 1);
+    CHECK(memcmp(header.mMagic, OTBR_DBUS_CAPTURE_MAGIC, sizeof(OTBR_DBUS_CAPTURE_MAGIC)) == 0);
+    CHECK(header.mVersion == OTBR_DBUS_CAPTURE_VERSION);
+
+    // The secret method call is not recorded.
+    CHECK(fread(&record, sizeof(record), 1, file) == 1);
+    CHECK(record.mTimestamp == 2000);
+    CHECK_EQUAL(20U, record.mLatency);
+    buffer.resize(record.mLength);
+    CHECK(fread(buffer.data(), 1, buffer.size(), file) == buffer.size());
+    CHECK(fread(&record, sizeof(record), 1, file) == 0);
+    fclose(file);
+
+    replayed = dbus_message_demarshal(buffer.data(), static_cast<int>(buffer.size()), nullptr);
+    CHECK(replayed != nullptr);
+    STRCMP_EQUAL(OTBR_DBUS_REMOVE_COMMISSIONING_JOINER_METHOD, dbus_message_get_member(replayed));
+    CHECK(otbr::DBus::DBusMessageToTuple(*replayed, replayedArgs) == OTBR_ERROR_NONE);
+    CHECK(args == replayedArgs);
+
+    dbus_message_unref(replayed);
+    dbus_message_unref(secret);
+    dbus_message_unref(message);
+}
+
+TEST(DBusCapture, TestExistingFile)
+{
+    DBusCapture capture;
+    FILE *      file = fopen(mPath.c_str(), "w");
+
+    // An existing file, or a link in its place, is never written to.
+    CHECK(file != nullptr);
+    fclose(file);
+    CHECK(capture.Open(mPath.c_str()) == OTBR_ERROR_ERRNO);
+    CHECK(!capture.IsOpen());
+}
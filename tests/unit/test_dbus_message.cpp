@@ -279,6 +279,48 @@ TEST(DBusMessage, TestOtbrNeighborInfo)
     dbus_message_unref(msg);
 }
 
+TEST(DBusMessage, TestVariantStreamedArray)
+{
+    DBusMessage *                      msg    = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    const uint8_t                      data[] = {1, 2, 3, 4, 5};
+    std::vector<otbr::DBus::ChildInfo> setTable{
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, true, false, true, false},
+        {12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, false, true, false, true},
+    };
+    size_t                             index = 0;
+    std::vector<uint8_t>               getData;
+    std::vector<otbr::DBus::ChildInfo> getTable;
+    DBusMessageIter                    iter;
+
+    CHECK(msg != nullptr);
+
+    dbus_message_iter_init_append(msg, &iter);
+    CHECK(otbr::DBus::DBusMessageEncodePrimitiveToVariant(&iter, data, sizeof(data)) == OTBR_ERROR_NONE);
+    CHECK(otbr::DBus::DBusMessageEncodeArrayToVariant<otbr::DBus::ChildInfo>(
+              &iter, [&setTable, &index](otbr::DBus::ChildInfo &aInfo) {
+                  bool found = index < setTable.size();
+
+                  if (found)
+                  {
+                      aInfo = setTable[index++];
+                  }
+
+                  return found;
+              }) == OTBR_ERROR_NONE);
+
+    CHECK(dbus_message_iter_init(msg, &iter));
+    CHECK(otbr::DBus::DBusMessageExtractFromVariant(&iter, getData) == OTBR_ERROR_NONE);
+    CHECK(dbus_message_iter_next(&iter));
+    CHECK(otbr::DBus::DBusMessageExtractFromVariant(&iter, getTable) == OTBR_ERROR_NONE);
+
+    CHECK(getData == std::vector<uint8_t>(data, data + sizeof(data)));
+    CHECK(getTable.size() == setTable.size());
+    CHECK(getTable[0] == setTable[0]);
+    CHECK(getTable[1] == setTable[1]);
+
+    dbus_message_unref(msg);
+}
+
 TEST(DBusMessage, TestOtbrLeaderData)
 {
     DBusMessage *                              msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -328,3 +370,44 @@ TEST(DBusMessage, TestOtbrExternalRoute)
 
     dbus_message_unref(msg);
 }
+
+TEST(DBusMessage, TestOtbrCountersSamples)
+{
+    DBusMessage *                                  msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::CountersSample>> setVals(
+        {{1, otbr::DBus::MacCounters(), otbr::DBus::IpCounters({1, 2, 3, 4})}});
+    tuple<std::vector<otbr::DBus::CountersSample>> getVals;
+
+    CHECK(msg != nullptr);
+
+    std::get<0>(setVals)[0].mMacCounters.mRxUnicast = 5;
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    STRCMP_EQUAL(otbr::DBus::DBusSignature<std::vector<otbr::DBus::CountersSample>>::Get().c_str(),
+                 dbus_message_get_signature(msg));
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK_EQUAL(1, std::get<0>(getVals)[0].mTime);
+    CHECK_EQUAL(5, std::get<0>(getVals)[0].mMacCounters.mRxUnicast);
+    CHECK_EQUAL(4, std::get<0>(getVals)[0].mIpCounters.mRxFailure);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestSignature)
+{
+    DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    auto         setVals =
+        std::make_tuple(uint16_t(1), uint32_t(2), otbr::DBus::Ip6Prefix({{0xfa, 0x00, 0x01, 0x02}, 64}));
+
+    CHECK(msg != nullptr);
+
+    STRCMP_EQUAL("", otbr::DBus::DBusSignature<>::Get().c_str());
+    STRCMP_EQUAL("((ayy)y(bbbbbbb))", otbr::DBus::DBusSignature<otbr::DBus::OnMeshPrefix>::Get().c_str());
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    STRCMP_EQUAL(dbus_message_get_signature(msg),
+                 (otbr::DBus::DBusSignature<uint16_t, uint32_t, otbr::DBus::Ip6Prefix>::Get().c_str()));
+
+    dbus_message_unref(msg);
+}
@@ -0,0 +1,61 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <CppUTest/TestHarness.h>
+
+#include "utils/etag.hpp"
+
+using otbr::Utils::IsETagMatched;
+
+static const char kETag[] = "\"0000abcd-1\"";
+
+TEST_GROUP(ETag){};
+
+TEST(ETag, TestMatchesListed)
+{
+    CHECK_TRUE(IsETagMatched("\"0000abcd-1\"", kETag));
+    CHECK_TRUE(IsETagMatched("\"0000abcd-0\", \"0000abcd-1\"", kETag));
+    CHECK_TRUE(IsETagMatched("\"0000abcd-0\",\t\"0000abcd-1\" ,", kETag));
+    CHECK_TRUE(IsETagMatched("W/\"0000abcd-1\"", kETag));
+    CHECK_TRUE(IsETagMatched("*", kETag));
+}
+
+TEST(ETag, TestRejectsSubstrings)
+{
+    // The tag of another version must not match because it contains the tag.
+    CHECK_FALSE(IsETagMatched("\"0000abcd-12\"", kETag));
+    CHECK_FALSE(IsETagMatched("\"x\"0000abcd-1\"\"", kETag));
+    CHECK_FALSE(IsETagMatched("\"0000abcd-1, \"0000abcd-2\"", kETag));
+    CHECK_FALSE(IsETagMatched("", kETag));
+    CHECK_FALSE(IsETagMatched(" , ", kETag));
+}
+
+TEST(ETag, TestQuotedCommas)
+{
+    CHECK_TRUE(IsETagMatched("\"a,b\", \"0000abcd-1\"", kETag));
+    CHECK_FALSE(IsETagMatched("\"a, \"0000abcd-1\"\"", kETag));
+}
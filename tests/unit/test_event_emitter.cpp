@@ -30,6 +30,7 @@
 
 #include <CppUTest/TestHarness.h>
 #include <stdarg.h>
+#include <stdint.h>
 
 static int   sCounter = 0;
 static int   sEvent   = 0;
@@ -177,3 +178,48 @@ TEST(EventEmitter, TestRemoveHandler)
     ee.Emit(event);
     CHECK_EQUAL(3, sCounter);
 }
+
+static void HandleTypedCount(void *aContext, uint16_t aCount)
+{
+    *static_cast<int *>(aContext) += aCount;
+}
+
+static void HandleTypedName(void *aContext, const char *aName)
+{
+    STRCMP_EQUAL("OpenThread", aName);
+    ++*static_cast<int *>(aContext);
+}
+
+TEST(EventEmitter, TestTypedDispatch)
+{
+    otbr::TypedEventEmitter<void(uint16_t aCount), void(const char *aName)> ee;
+    int                                                                     counter = 0;
+    int                                                                     names   = 0;
+
+    ee.On<0>(HandleTypedCount, &counter);
+    ee.On<1>(HandleTypedName, &names);
+
+    ee.Emit<0>(2);
+    ee.Emit<0>(3);
+    ee.Emit<1>("OpenThread");
+
+    CHECK_EQUAL(5, counter);
+    CHECK_EQUAL(1, names);
+}
+
+TEST(EventEmitter, TestTypedRemoveHandler)
+{
+    otbr::TypedEventEmitter<void(uint16_t aCount)> ee;
+    int                                            counter1 = 0;
+    int                                            counter2 = 0;
+
+    ee.On<0>(HandleTypedCount, &counter1);
+    ee.On<0>(HandleTypedCount, &counter2);
+    ee.Emit<0>(1);
+
+    ee.Off<0>(HandleTypedCount, &counter1);
+    ee.Emit<0>(1);
+
+    CHECK_EQUAL(1, counter1);
+    CHECK_EQUAL(2, counter2);
+}
@@ -0,0 +1,221 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "common/event_poller.hpp"
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+#include <unistd.h>
+
+static int              sCounter = 0;
+static uint32_t         sEvents  = 0;
+static std::vector<int> sOrder;
+
+static void HandleEvent(void *aContext, int aFd, uint32_t aEvents)
+{
+    int *fd = static_cast<int *>(aContext);
+
+    CHECK_EQUAL(*fd, aFd);
+
+    sEvents = aEvents;
+    sCounter++;
+}
+
+static void HandleEventAndUnregister(void *aContext, int aFd, uint32_t aEvents)
+{
+    otbr::EventPoller::Get().Unregister(aFd);
+    HandleEvent(aContext, aFd, aEvents);
+}
+
+static void HandleEventInOrder(void *aContext, int aFd, uint32_t aEvents)
+{
+    char data;
+
+    CHECK_EQUAL(1, read(aFd, &data, sizeof(data)));
+    sOrder.push_back(aFd);
+    HandleEvent(aContext, aFd, aEvents);
+}
+
+static void HandleEventOverBudget(void *aContext, int aFd, uint32_t aEvents)
+{
+    usleep(OTBR_EVENT_POLLER_LOW_PRIORITY_BUDGET + 1000);
+    HandleEventInOrder(aContext, aFd, aEvents);
+}
+
+static void Poll(void)
+{
+    otSysMainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::EventPoller::Get().UpdateFdSet(mainloop);
+
+    CHECK(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                 &mainloop.mTimeout) >= 0);
+
+    otbr::EventPoller::Get().Process(mainloop);
+}
+
+TEST_GROUP(EventPoller)
+{
+    int mPipe[2];
+
+    void setup()
+    {
+        CHECK_EQUAL(0, pipe(mPipe));
+        CHECK_EQUAL(0, pipe(mOtherPipe));
+        sCounter = 0;
+        sEvents  = 0;
+        sOrder.clear();
+    }
+
+    void teardown()
+    {
+        otbr::EventPoller::Get().Unregister(mPipe[0]);
+        otbr::EventPoller::Get().Unregister(mPipe[1]);
+        otbr::EventPoller::Get().Unregister(mOtherPipe[0]);
+        close(mPipe[0]);
+        close(mPipe[1]);
+        close(mOtherPipe[0]);
+        close(mOtherPipe[1]);
+    }
+
+    int mOtherPipe[2];
+};
+
+TEST(EventPoller, TestReadable)
+{
+    char data = 'x';
+
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                otbr::EventPoller::Get().Register(mPipe[0], otbr::EventPoller::kEventReadable, HandleEvent, &mPipe[0]));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS,
+                otbr::EventPoller::Get().Register(mPipe[0], otbr::EventPoller::kEventReadable, HandleEvent, &mPipe[0]));
+
+    Poll();
+    CHECK_EQUAL(0, sCounter);
+
+    CHECK_EQUAL(1, write(mPipe[1], &data, sizeof(data)));
+    Poll();
+    CHECK_EQUAL(1, sCounter);
+    CHECK(sEvents & otbr::EventPoller::kEventReadable);
+
+    // Level-triggered, reported again until the data is consumed.
+    Poll();
+    CHECK_EQUAL(2, sCounter);
+
+    CHECK_EQUAL(1, read(mPipe[0], &data, sizeof(data)));
+    Poll();
+    CHECK_EQUAL(2, sCounter);
+}
+
+TEST(EventPoller, TestUpdate)
+{
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, otbr::EventPoller::Get().Update(mPipe[1], otbr::EventPoller::kEventWritable));
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::EventPoller::Get().Register(mPipe[1], 0, HandleEvent, &mPipe[1]));
+
+    Poll();
+    CHECK_EQUAL(0, sCounter);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::EventPoller::Get().Update(mPipe[1], otbr::EventPoller::kEventWritable));
+    Poll();
+    CHECK_EQUAL(1, sCounter);
+    CHECK(sEvents & otbr::EventPoller::kEventWritable);
+}
+
+TEST(EventPoller, TestUnregisterInHandler)
+{
+    char data = 'x';
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::EventPoller::Get().Register(mPipe[0], otbr::EventPoller::kEventReadable,
+                                                                   HandleEventAndUnregister, &mPipe[0]));
+    CHECK_EQUAL(1, write(mPipe[1], &data, sizeof(data)));
+
+    Poll();
+    CHECK_EQUAL(1, sCounter);
+
+    Poll();
+    CHECK_EQUAL(1, sCounter);
+}
+
+TEST(EventPoller, TestPriority)
+{
+    char data = 'x';
+
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                otbr::EventPoller::Get().Register(mPipe[0], otbr::EventPoller::kEventReadable, HandleEventInOrder,
+                                                  &mPipe[0], otbr::EventPoller::kPriorityLow));
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                otbr::EventPoller::Get().Register(mOtherPipe[0], otbr::EventPoller::kEventReadable, HandleEventInOrder,
+                                                  &mOtherPipe[0], otbr::EventPoller::kPriorityHigh));
+    CHECK_EQUAL(1, write(mPipe[1], &data, sizeof(data)));
+    CHECK_EQUAL(1, write(mOtherPipe[1], &data, sizeof(data)));
+
+    Poll();
+    CHECK_EQUAL(2, static_cast<int>(sOrder.size()));
+    CHECK_EQUAL(mOtherPipe[0], sOrder[0]);
+    CHECK_EQUAL(mPipe[0], sOrder[1]);
+}
+
+TEST(EventPoller, TestLowPriorityBudget)
+{
+    char                 data = 'x';
+    otSysMainloopContext mainloop;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                otbr::EventPoller::Get().Register(mPipe[0], otbr::EventPoller::kEventReadable, HandleEventOverBudget,
+                                                  &mPipe[0], otbr::EventPoller::kPriorityLow));
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                otbr::EventPoller::Get().Register(mOtherPipe[0], otbr::EventPoller::kEventReadable,
+                                                  HandleEventOverBudget, &mOtherPipe[0],
+                                                  otbr::EventPoller::kPriorityLow));
+    CHECK_EQUAL(1, write(mPipe[1], &data, sizeof(data)));
+    CHECK_EQUAL(1, write(mOtherPipe[1], &data, sizeof(data)));
+
+    Poll();
+    CHECK_EQUAL(1, sCounter);
+
+    // The deferred event is dispatched without waiting.
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {10, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+    otbr::EventPoller::Get().UpdateFdSet(mainloop);
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_sec);
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_usec);
+
+    Poll();
+    CHECK_EQUAL(2, sCounter);
+    CHECK(sOrder[0] != sOrder[1]);
+}
@@ -0,0 +1,141 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <CppUTest/TestHarness.h>
+
+#include <set>
+
+#include "common/fixed_containers.hpp"
+
+// Collides keys of the same remainder, so that erasing moves elements back across the end of the slots.
+struct CollidingHash
+{
+    size_t operator()(int aKey) const { return static_cast<size_t>(aKey % 4) + 13; }
+};
+
+TEST_GROUP(FixedContainers){};
+
+TEST(FixedContainers, TestVector)
+{
+    otbr::FixedVector<int, 3> vector;
+
+    CHECK(vector.push_back(1));
+    CHECK(vector.emplace_back(2));
+    CHECK(vector.push_back(3));
+    CHECK(!vector.push_back(4));
+    CHECK_EQUAL(3, vector.size());
+
+    CHECK(vector.erase(vector.begin()) == vector.begin());
+    CHECK_EQUAL(2, vector.size());
+    CHECK_EQUAL(2, vector[0]);
+    CHECK_EQUAL(3, vector[1]);
+    CHECK(vector.push_back(4));
+    CHECK_EQUAL(4, vector.back());
+}
+
+TEST(FixedContainers, TestDeque)
+{
+    otbr::FixedDeque<int, 3> deque;
+    int                      values[] = {1, 2, 3, 4};
+
+    deque.assign(values, values + 4);
+    CHECK_EQUAL(3, deque.size());
+
+    // Wraps around the end of the ring.
+    deque.pop_front();
+    deque.pop_front();
+    CHECK(deque.push_back(5));
+    CHECK(deque.push_back(6));
+    CHECK(!deque.push_back(7));
+    CHECK_EQUAL(3, deque.front());
+    deque.pop_front();
+    CHECK_EQUAL(5, deque.front());
+    deque.pop_front();
+    CHECK_EQUAL(6, deque.front());
+}
+
+TEST(FixedContainers, TestHashSet)
+{
+    otbr::FixedHashSet<int, 12, CollidingHash> set;
+    std::multiset<int>                         visited;
+
+    for (int i = 0; i < 12; i++)
+    {
+        CHECK(set.insert(i).second);
+    }
+    CHECK(!set.insert(3).second);
+    CHECK(set.insert(3).first != set.end());
+    CHECK(!set.insert(12).second);
+    CHECK(set.insert(12).first == set.end());
+    CHECK_EQUAL(12, set.size());
+
+    // Every element is visited once while erasing the odd ones.
+    for (auto it = set.begin(); it != set.end();)
+    {
+        visited.insert(*it);
+        it = (*it % 2 == 1) ? set.erase(it) : std::next(it);
+    }
+    CHECK_EQUAL(12, visited.size());
+    for (int i = 0; i < 12; i++)
+    {
+        CHECK_EQUAL(1, visited.count(i));
+        CHECK_EQUAL((i % 2 == 0) ? 1 : 0, set.count(i));
+    }
+
+    CHECK_EQUAL(1, set.erase(4));
+    CHECK_EQUAL(0, set.erase(4));
+    CHECK(set.find(8) != set.end());
+    CHECK(set.find(4) == set.end());
+    CHECK_EQUAL(5, set.size());
+}
+
+TEST(FixedContainers, TestHashMap)
+{
+    otbr::FixedHashMap<int, uint32_t, 4, CollidingHash> map;
+
+    map[1]++;
+    map[5]++;
+    map[5]++;
+    CHECK_EQUAL(2, map.size());
+    CHECK_EQUAL(1, map.find(1)->second);
+    CHECK_EQUAL(2, map.find(5)->second);
+
+    map.erase(map.find(1));
+    CHECK(map.find(1) == map.end());
+    CHECK_EQUAL(2, map.find(5)->second);
+
+    for (const auto &entry : map)
+    {
+        CHECK_EQUAL(5, entry.first);
+    }
+
+    map.clear();
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+}
@@ -0,0 +1,198 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "agent/channel_history.hpp"
+#include "agent/history.hpp"
+
+using otbr::MemoryStats;
+using otbr::Ncp::ChannelHistory;
+using otbr::Ncp::History;
+
+struct TestEntry
+{
+    uint64_t mTime;
+    uint32_t mValue;
+};
+
+typedef History<TestEntry, false> TestSamples;
+typedef History<TestEntry, true>  TestWindows;
+
+static const TestSamples::ResolutionInfo kSampleResolutions[TestSamples::kNumResolutions] = {
+    {1, 4, "1s"},
+    {10, 3, "10s"},
+    {100, 2, "100s"},
+};
+
+static const TestWindows::ResolutionInfo kWindowResolutions[TestWindows::kNumResolutions] = {
+    {10, 3, "10s"},
+    {100, 2, "100s"},
+    {1000, 1, "1000s"},
+};
+
+template <typename HistoryType> static void AddValue(HistoryType &aHistory, uint64_t aTime, uint32_t aValue)
+{
+    aHistory.Add(aTime, [aValue](TestEntry &aEntry) { aEntry.mValue += aValue; });
+}
+
+TEST_GROUP(History){};
+
+TEST(History, TestRingWrap)
+{
+    TestSamples            history(kSampleResolutions, MemoryStats::kSubsystemCountersHistory);
+    std::vector<TestEntry> entries;
+
+    for (uint64_t time = 100; time < 106; time++)
+    {
+        AddValue(history, time, 1);
+    }
+
+    history.Query(0, 0, UINT64_MAX, entries);
+    CHECK_EQUAL(4, entries.size());
+    CHECK_EQUAL(102, entries.front().mTime);
+    CHECK_EQUAL(105, entries.back().mTime);
+
+    // All samples of a period land in the same entry, which keeps the time of the latest one.
+    history.Query(1, 0, UINT64_MAX, entries);
+    CHECK_EQUAL(1, entries.size());
+    CHECK_EQUAL(105, entries[0].mTime);
+    CHECK_EQUAL(6, entries[0].mValue);
+
+    for (uint64_t time = 110; time < 150; time += 10)
+    {
+        AddValue(history, time, 1);
+    }
+
+    history.Query(1, 0, UINT64_MAX, entries);
+    CHECK_EQUAL(3, entries.size());
+    CHECK_EQUAL(120, entries[0].mTime);
+    CHECK_EQUAL(130, entries[1].mTime);
+    CHECK_EQUAL(140, entries[2].mTime);
+}
+
+TEST(History, TestClockSetBack)
+{
+    TestSamples            history(kSampleResolutions, MemoryStats::kSubsystemCountersHistory);
+    std::vector<TestEntry> entries;
+
+    AddValue(history, 200, 1);
+    AddValue(history, 201, 1);
+    AddValue(history, 150, 1);
+
+    history.Query(0, 0, UINT64_MAX, entries);
+    CHECK_EQUAL(1, entries.size());
+    CHECK_EQUAL(150, entries[0].mTime);
+    CHECK_EQUAL(1, entries[0].mValue);
+}
+
+TEST(History, TestSinceUntil)
+{
+    TestSamples            samples(kSampleResolutions, MemoryStats::kSubsystemCountersHistory);
+    TestWindows            windows(kWindowResolutions, MemoryStats::kSubsystemChannelHistory);
+    std::vector<TestEntry> entries;
+
+    for (uint64_t time = 100; time < 104; time++)
+    {
+        AddValue(samples, time, 1);
+    }
+
+    samples.Query(0, 101, 102, entries);
+    CHECK_EQUAL(2, entries.size());
+    CHECK_EQUAL(101, entries[0].mTime);
+    CHECK_EQUAL(102, entries[1].mTime);
+
+    samples.Query(0, 104, UINT64_MAX, entries);
+    CHECK_EQUAL(0, entries.size());
+
+    AddValue(windows, 105, 1);
+    AddValue(windows, 112, 2);
+    AddValue(windows, 127, 3);
+
+    // A window is returned when it overlaps the range.
+    windows.Query(0, 115, 120, entries);
+    CHECK_EQUAL(2, entries.size());
+    CHECK_EQUAL(110, entries[0].mTime);
+    CHECK_EQUAL(2, entries[0].mValue);
+    CHECK_EQUAL(120, entries[1].mTime);
+
+    windows.Query(0, 0, 109, entries);
+    CHECK_EQUAL(1, entries.size());
+    CHECK_EQUAL(100, entries[0].mTime);
+
+    windows.Query(1, 0, UINT64_MAX, entries);
+    CHECK_EQUAL(1, entries.size());
+    CHECK_EQUAL(100, entries[0].mTime);
+    CHECK_EQUAL(6, entries[0].mValue);
+}
+
+TEST(History, TestResolutions)
+{
+    ChannelHistory history;
+    uint8_t        resolution = 0xff;
+
+    CHECK(history.ParseResolution("", resolution));
+    CHECK_EQUAL(ChannelHistory::kResolutionMinute, resolution);
+    CHECK(history.ParseResolution("1d", resolution));
+    CHECK_EQUAL(ChannelHistory::kResolutionDay, resolution);
+    CHECK(!history.ParseResolution("1s", resolution));
+
+    CHECK(history.FindResolution(3600, resolution));
+    CHECK_EQUAL(ChannelHistory::kResolutionHour, resolution);
+    CHECK(!history.FindResolution(1, resolution));
+    CHECK_EQUAL(86400, history.GetPeriod(ChannelHistory::kResolutionDay));
+}
+
+TEST(History, TestChannelOccupancy)
+{
+    ChannelHistory                      history;
+    std::vector<ChannelHistory::Window> windows;
+    uint16_t                            occupancies[ChannelHistory::kNumChannels] = {};
+    uint32_t                            mask = (1U << 11) | (1U << 15);
+
+    occupancies[0] = 100;
+    occupancies[4] = 1000;
+    occupancies[5] = 5000;
+    history.Add(60, mask, occupancies);
+
+    occupancies[0] = 300;
+    occupancies[4] = 500;
+    history.Add(90, mask, occupancies);
+
+    history.Query(ChannelHistory::kResolutionMinute, 0, UINT64_MAX, windows);
+    CHECK_EQUAL(1, windows.size());
+    CHECK_EQUAL(60, windows[0].mTime);
+    CHECK_EQUAL(100, windows[0].mChannels[0].mMin);
+    CHECK_EQUAL(300, windows[0].mChannels[0].mMax);
+    CHECK_EQUAL(200, windows[0].mChannels[0].GetAverage());
+    CHECK_EQUAL(500, windows[0].mChannels[4].mMin);
+    CHECK_EQUAL(2, windows[0].mChannels[4].mCount);
+    CHECK_EQUAL(0, windows[0].mChannels[5].mCount);
+}
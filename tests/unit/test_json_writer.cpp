@@ -0,0 +1,107 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/json_writer.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::JsonWriter;
+
+static void WriteSample(JsonWriter &aWriter)
+{
+    const uint8_t bytes[] = {0xab, 0x01};
+
+    aWriter.BeginArray();
+    aWriter.BeginObject();
+    aWriter.Member("Rloc16", 1024);
+    aWriter.Key("RouteData");
+    aWriter.BeginArray();
+    aWriter.Number(1);
+    aWriter.Number(2);
+    aWriter.EndArray();
+    aWriter.Key("Empty");
+    aWriter.BeginObject();
+    aWriter.EndObject();
+    aWriter.Key("Name");
+    aWriter.String("a\"b\n");
+    aWriter.Key("ExtAddress");
+    aWriter.HexString(bytes, sizeof(bytes));
+    aWriter.Key("ParentPriority");
+    aWriter.SignedNumber(-1);
+    aWriter.EndObject();
+    aWriter.EndArray();
+}
+
+TEST_GROUP(JsonWriter){};
+
+TEST(JsonWriter, TestCompact)
+{
+    std::string output;
+    JsonWriter  writer(output, false);
+
+    WriteSample(writer);
+    STRCMP_EQUAL("[{\"Rloc16\":1024,\"RouteData\":[1,2],\"Empty\":{},\"Name\":\"a\\\"b\\n\",\"ExtAddress\":\"AB01\","
+                 "\"ParentPriority\":-1}]",
+                 output.c_str());
+}
+
+TEST(JsonWriter, TestPretty)
+{
+    std::string output;
+    JsonWriter  writer(output);
+
+    WriteSample(writer);
+    STRCMP_EQUAL("[{\n\t\t\"Rloc16\":\t1024,\n\t\t\"RouteData\":\t[1, 2],\n\t\t\"Empty\":\t{\n\t\t},\n\t\t\"Name\":\t"
+                 "\"a\\\"b\\n\",\n\t\t\"ExtAddress\":\t\"AB01\",\n\t\t\"ParentPriority\":\t-1\n\t}]",
+                 output.c_str());
+}
+
+TEST(JsonWriter, TestAppend)
+{
+    std::string output = "prefix";
+    JsonWriter  writer(output, false);
+
+    writer.Number(42);
+    STRCMP_EQUAL("prefix42", output.c_str());
+}
+
+TEST(JsonWriter, TestCbor)
+{
+    std::string         output;
+    JsonWriter          writer(output, otbr::rest::ContentFormat::kCbor);
+    const unsigned char expected[] = {
+        0x9f, 0xbf, 0x66, 'R',  'l',  'o',  'c',  '1',  '6',  0x19, 0x04, 0x00, 0x69, 'R',  'o',  'u',  't',  'e',
+        'D',  'a',  't',  'a',  0x9f, 0x01, 0x02, 0xff, 0x65, 'E',  'm',  'p',  't',  'y',  0xbf, 0xff, 0x64, 'N',
+        'a',  'm',  'e',  0x64, 'a',  '"',  'b',  '\n', 0x6a, 'E',  'x',  't',  'A',  'd',  'd',  'r',  'e',  's',
+        's',  0x64, 'A',  'B',  '0',  '1',  0x6e, 'P',  'a',  'r',  'e',  'n',  't',  'P',  'r',  'i',  'o',  'r',
+        'i',  't',  'y',  0x20, 0xff, 0xff};
+
+    WriteSample(writer);
+    CHECK_EQUAL(sizeof(expected), output.size());
+    CHECK(output.compare(0, output.size(), reinterpret_cast<const char *>(expected), sizeof(expected)) == 0);
+}
@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "agent/link_quality.hpp"
+
+using otbr::Ncp::LinkQualityTracker;
+
+static otNeighborInfo MakeNeighbor(int8_t aRssi, uint32_t aAge, uint16_t aFrameErrorRate = 0)
+{
+    otNeighborInfo neighbor;
+
+    memset(&neighbor, 0, sizeof(neighbor));
+    neighbor.mExtAddress.m8[7] = 1;
+    neighbor.mRloc16           = 0x0400;
+    neighbor.mLastRssi         = aRssi;
+    neighbor.mAge              = aAge;
+    neighbor.mLinkQualityIn    = 3;
+    neighbor.mFrameErrorRate   = aFrameErrorRate;
+
+    return neighbor;
+}
+
+static LinkQualityTracker::Stats GetStats(const LinkQualityTracker &aTracker)
+{
+    std::vector<LinkQualityTracker::Stats> stats;
+
+    aTracker.Get(stats);
+    CHECK_EQUAL(1, stats.size());
+
+    return stats[0];
+}
+
+TEST_GROUP(LinkQuality){};
+
+TEST(LinkQuality, TestHalving)
+{
+    LinkQualityTracker        tracker;
+    LinkQualityTracker::Stats stats;
+    uint64_t                  time = 1000;
+
+    for (uint32_t i = 0; i < OTBR_LINK_QUALITY_MAX_SAMPLES; i++)
+    {
+        tracker.Add(time, {MakeNeighbor(-50, 0, 0x100)});
+        time += OTBR_LINK_QUALITY_SAMPLE_INTERVAL;
+    }
+
+    stats = GetStats(tracker);
+    CHECK_EQUAL(OTBR_LINK_QUALITY_MAX_SAMPLES, stats.mSamples);
+    CHECK_EQUAL(OTBR_LINK_QUALITY_MAX_SAMPLES, stats.mRssiHistogram[LinkQualityTracker::GetRssiBucket(-50)]);
+
+    tracker.Add(time, {MakeNeighbor(-50, 0, 0x100)});
+
+    // The histograms and the sums are halved before the sample is added, keeping the averages.
+    stats = GetStats(tracker);
+    CHECK_EQUAL(OTBR_LINK_QUALITY_MAX_SAMPLES / 2 + 1, stats.mSamples);
+    CHECK_EQUAL(OTBR_LINK_QUALITY_MAX_SAMPLES / 2 + 1, stats.mRssiHistogram[LinkQualityTracker::GetRssiBucket(-50)]);
+    CHECK_EQUAL(OTBR_LINK_QUALITY_MAX_SAMPLES / 2 + 1, stats.mLinkQualityHistogram[3]);
+    CHECK_EQUAL(-50, stats.GetAverageRssi());
+    CHECK_EQUAL(0x100, stats.GetAverageFrameErrorRate());
+    CHECK_EQUAL(1000, stats.mFirstSeen);
+    CHECK_EQUAL(time, stats.mLastSeen);
+}
+
+TEST(LinkQuality, TestDegradation)
+{
+    LinkQualityTracker        tracker;
+    LinkQualityTracker::Stats stats;
+    uint64_t                  time = 1000;
+
+    // Up to kMinDegradedSamples samples, a high frame error rate does not degrade the link.
+    for (uint8_t i = 0; i + 1 < LinkQualityTracker::kMinDegradedSamples; i++)
+    {
+        tracker.Add(time, {MakeNeighbor(-40, 0, UINT16_MAX)});
+        time += OTBR_LINK_QUALITY_SAMPLE_INTERVAL;
+    }
+    CHECK(!GetStats(tracker).mDegraded);
+
+    tracker.Add(time, {MakeNeighbor(-40, 0, UINT16_MAX)});
+    time += OTBR_LINK_QUALITY_SAMPLE_INTERVAL;
+    CHECK(GetStats(tracker).mDegraded);
+
+    tracker.Add(time, {MakeNeighbor(-40, 0, 0)});
+    time += OTBR_LINK_QUALITY_SAMPLE_INTERVAL;
+    CHECK(!GetStats(tracker).mDegraded);
+
+    // A drop of the RSSI degrades the link once the recent RSSI leaves the baseline behind.
+    for (uint8_t i = 0; i < 20 && !GetStats(tracker).mDegraded; i++)
+    {
+        tracker.Add(time, {MakeNeighbor(-70, 0, 0)});
+        time += OTBR_LINK_QUALITY_SAMPLE_INTERVAL;
+    }
+
+    stats = GetStats(tracker);
+    CHECK(stats.mDegraded);
+    CHECK(stats.GetRecentRssi() + OTBR_LINK_QUALITY_DEGRADED_RSSI_DROP <= stats.GetBaselineRssi());
+    CHECK_EQUAL(-70, stats.mMinRssi);
+    CHECK_EQUAL(-40, stats.mMaxRssi);
+}
+
+TEST(LinkQuality, TestAgeGating)
+{
+    LinkQualityTracker                     tracker;
+    LinkQualityTracker::Stats              stats;
+    std::vector<LinkQualityTracker::Stats> all;
+
+    tracker.Add(1000, {MakeNeighbor(-50, 100)});
+    CHECK_EQUAL(1, GetStats(tracker).mSamples);
+
+    // A table read within the sample interval is ignored.
+    tracker.Add(1000 + OTBR_LINK_QUALITY_SAMPLE_INTERVAL - 1, {MakeNeighbor(-60, 0)});
+    CHECK_EQUAL(1, GetStats(tracker).mSamples);
+    CHECK_EQUAL(1000, GetStats(tracker).mLastSeen);
+
+    // Nothing heard since the previous sample: the neighbor is seen, its RSSI is not sampled again.
+    tracker.Add(1020, {MakeNeighbor(-60, 20, 0x200)});
+    stats = GetStats(tracker);
+    CHECK_EQUAL(1, stats.mSamples);
+    CHECK_EQUAL(1020, stats.mLastSeen);
+    CHECK_EQUAL(0x200, stats.mFrameErrorRate);
+    CHECK_EQUAL(-50, stats.mMaxRssi);
+
+    tracker.Add(1040, {MakeNeighbor(-60, 19)});
+    stats = GetStats(tracker);
+    CHECK_EQUAL(2, stats.mSamples);
+    CHECK_EQUAL(-60, stats.mMinRssi);
+
+    // A neighbor leaving the table is no longer tracked.
+    tracker.Add(1060, {});
+    tracker.Get(all);
+    CHECK_EQUAL(0, all.size());
+}
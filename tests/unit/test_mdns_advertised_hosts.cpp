@@ -0,0 +1,241 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mdns/advertised_hosts.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::Mdns::AdvertisedHosts;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::ServiceHandle;
+
+namespace {
+
+class FakePublisher : public Publisher
+{
+public:
+    otbrError Start(void) { return OTBR_ERROR_NONE; }
+    void      Stop(void) {}
+    bool      IsStarted(void) const { return true; }
+    void      Process(const fd_set &, const fd_set &, const fd_set &) {}
+    void      UpdateFdSet(fd_set &, fd_set &, fd_set &, int &, timeval &) {}
+
+    bool Called(const std::string &aCall) const
+    {
+        return std::find(mCalls.begin(), mCalls.end(), aCall) != mCalls.end();
+    }
+
+    std::vector<std::string> mCalls;
+    otbrError                mError = OTBR_ERROR_NONE;
+
+protected:
+    otbrError DoPublishService(ServiceHandle  aHandle,
+                               const char *   aHostName,
+                               uint16_t       aPort,
+                               const char *   aName,
+                               const char *   aType,
+                               const TxtList &aTxtList)
+    {
+        std::string call = "publish " + std::to_string(aPort) + " " + aName + "." + aType + " @" + aHostName;
+
+        OTBR_UNUSED_VARIABLE(aHandle);
+
+        for (const TxtEntry &entry : aTxtList)
+        {
+            call += " " + entry.mName + "=" + std::string(entry.mValue.begin(), entry.mValue.end());
+        }
+
+        mCalls.push_back(call);
+
+        return mError;
+    }
+
+    void DoUnpublishService(ServiceHandle aHandle)
+    {
+        OTBR_UNUSED_VARIABLE(aHandle);
+        mCalls.push_back("unpublish service");
+    }
+
+    otbrError DoPublishHost(const char *aName, const std::vector<Ip6Address> &aAddresses)
+    {
+        mCalls.push_back(std::string("publish host ") + aName + " " + std::to_string(aAddresses.size()));
+        return mError;
+    }
+
+    void DoUnpublishHost(const char *aName) { mCalls.push_back(std::string("unpublish host ") + aName); }
+
+    otbrError DoBrowse(const char *) { return OTBR_ERROR_NONE; }
+    void      DoStopBrowse(const char *) {}
+    otbrError DoResolve(const char *, const char *) { return OTBR_ERROR_NONE; }
+    void      DoStopResolve(const char *, const char *) {}
+};
+
+std::vector<uint8_t> Txt(const std::string &aData)
+{
+    return std::vector<uint8_t>(aData.begin(), aData.end());
+}
+
+} // namespace
+
+TEST_GROUP(AdvertisedHosts){};
+
+TEST(AdvertisedHosts, TestStripDomain)
+{
+    std::string name;
+
+    CHECK_TRUE(AdvertisedHosts::StripDomain("host.default.service.arpa.", "default.service.arpa.", name));
+    STRCMP_EQUAL("host", name.c_str());
+    CHECK_TRUE(AdvertisedHosts::StripDomain("a.b.default.service.arpa.", "default.service.arpa.", name));
+    STRCMP_EQUAL("a.b", name.c_str());
+
+    name = "unchanged";
+    CHECK(!AdvertisedHosts::StripDomain("default.service.arpa.", "default.service.arpa.", name));
+    CHECK(!AdvertisedHosts::StripDomain(".default.service.arpa.", "default.service.arpa.", name));
+    CHECK(!AdvertisedHosts::StripDomain("hostdefault.service.arpa.", "default.service.arpa.", name));
+    CHECK(!AdvertisedHosts::StripDomain("host.other.arpa.", "default.service.arpa.", name));
+    STRCMP_EQUAL("unchanged", name.c_str());
+}
+
+TEST(AdvertisedHosts, TestSplitServiceName)
+{
+    std::string instance;
+    std::string type;
+
+    CHECK_TRUE(AdvertisedHosts::SplitServiceName("lamp._hap._udp", instance, type));
+    STRCMP_EQUAL("lamp", instance.c_str());
+    STRCMP_EQUAL("_hap._udp", type.c_str());
+
+    // The instance name may contain dots.
+    CHECK_TRUE(AdvertisedHosts::SplitServiceName("my.lamp._hap._udp", instance, type));
+    STRCMP_EQUAL("my.lamp", instance.c_str());
+    STRCMP_EQUAL("_hap._udp", type.c_str());
+
+    CHECK(!AdvertisedHosts::SplitServiceName("_hap._udp", instance, type));
+    CHECK(!AdvertisedHosts::SplitServiceName("._hap._udp", instance, type));
+    CHECK(!AdvertisedHosts::SplitServiceName("lamp", instance, type));
+    CHECK(!AdvertisedHosts::SplitServiceName("", instance, type));
+}
+
+TEST(AdvertisedHosts, TestParseTxtData)
+{
+    Publisher::TxtList txtList;
+
+    txtList = AdvertisedHosts::ParseTxtData(Txt("\x03" "a=1" "\x04" "flag" "\x02" "b=" "\x05" "=abcd" "\x04" "cc=2"));
+    CHECK_EQUAL(2, static_cast<int>(txtList.size()));
+    STRCMP_EQUAL("a", txtList[0].mName.c_str());
+    CHECK(txtList[0].mValue == Txt("1"));
+    STRCMP_EQUAL("cc", txtList[1].mName.c_str());
+    CHECK(txtList[1].mValue == Txt("2"));
+
+    // The parsing stops at an entry longer than the remaining data.
+    txtList = AdvertisedHosts::ParseTxtData(Txt("\x03" "a=1" "\x09" "b=2"));
+    CHECK_EQUAL(1, static_cast<int>(txtList.size()));
+    STRCMP_EQUAL("a", txtList[0].mName.c_str());
+
+    txtList = AdvertisedHosts::ParseTxtData(Txt("\x03"));
+    CHECK_TRUE(txtList.empty());
+    CHECK_TRUE(AdvertisedHosts::ParseTxtData({}).empty());
+}
+
+TEST(AdvertisedHosts, TestUpdateDelta)
+{
+    FakePublisher           publisher;
+    AdvertisedHosts         hosts(publisher);
+    std::vector<Ip6Address> addresses{Ip6Address(1)};
+
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                hosts.Update("host", addresses, {{"a._t._udp", 1, Txt("\x03x=1")}, {"b._t._udp", 2, {}}}));
+    CHECK_EQUAL(3, static_cast<int>(publisher.mCalls.size()));
+    CHECK_TRUE(publisher.Called("publish host host 1"));
+    CHECK_TRUE(publisher.Called("publish 1 a._t._udp @host x=1"));
+    CHECK_TRUE(publisher.Called("publish 2 b._t._udp @host"));
+
+    // A refresh publishes nothing.
+    publisher.mCalls.clear();
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                hosts.Update("host", addresses, {{"a._t._udp", 1, Txt("\x03x=1")}, {"b._t._udp", 2, {}}}));
+    CHECK_TRUE(publisher.mCalls.empty());
+
+    // Only the changed service is published again, and the service no longer registered is withdrawn.
+    CHECK_EQUAL(OTBR_ERROR_NONE, hosts.Update("host", addresses, {{"a._t._udp", 1, Txt("\x03x=2")}}));
+    CHECK_EQUAL(2, static_cast<int>(publisher.mCalls.size()));
+    CHECK_TRUE(publisher.Called("unpublish service"));
+    CHECK_TRUE(publisher.Called("publish 1 a._t._udp @host x=2"));
+
+    // Changed addresses publish the host only.
+    publisher.mCalls.clear();
+    addresses.push_back(Ip6Address(2));
+    CHECK_EQUAL(OTBR_ERROR_NONE, hosts.Update("host", addresses, {{"a._t._udp", 1, Txt("\x03x=2")}}));
+    CHECK_EQUAL(1, static_cast<int>(publisher.mCalls.size()));
+    CHECK_TRUE(publisher.Called("publish host host 2"));
+
+    // An invalid service name is reported and the others are kept.
+    publisher.mCalls.clear();
+    CHECK_EQUAL(OTBR_ERROR_PARSE, hosts.Update("host", addresses, {{"a._t._udp", 1, Txt("\x03x=2")}, {"bad", 3, {}}}));
+    CHECK_TRUE(publisher.mCalls.empty());
+
+    publisher.mCalls.clear();
+    hosts.Remove("host");
+    CHECK_EQUAL(2, static_cast<int>(publisher.mCalls.size()));
+    CHECK_TRUE(publisher.Called("unpublish service"));
+    CHECK_TRUE(publisher.Called("unpublish host host"));
+
+    publisher.mCalls.clear();
+    hosts.Remove("host");
+    CHECK_TRUE(publisher.mCalls.empty());
+}
+
+TEST(AdvertisedHosts, TestPublishPending)
+{
+    FakePublisher           publisher;
+    AdvertisedHosts         hosts(publisher);
+    std::vector<Ip6Address> addresses{Ip6Address(1)};
+
+    publisher.mError = OTBR_ERROR_MDNS;
+    CHECK_EQUAL(OTBR_ERROR_MDNS, hosts.Update("host", addresses, {{"a._t._udp", 1, {}}}));
+
+    // The failed changes are published again, once.
+    publisher.mError = OTBR_ERROR_NONE;
+    publisher.mCalls.clear();
+    hosts.PublishPending();
+    CHECK_EQUAL(2, static_cast<int>(publisher.mCalls.size()));
+    CHECK_TRUE(publisher.Called("publish host host 1"));
+    CHECK_TRUE(publisher.Called("publish 1 a._t._udp @host"));
+
+    publisher.mCalls.clear();
+    hosts.PublishPending();
+    CHECK_TRUE(publisher.mCalls.empty());
+
+    hosts.Clear();
+    CHECK_TRUE(publisher.Called("unpublish host host"));
+}
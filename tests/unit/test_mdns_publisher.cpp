@@ -0,0 +1,280 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mdns/mdns.hpp"
+
+#include <string>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Mdns::kInvalidServiceHandle;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::ServiceHandle;
+
+typedef Publisher::DiscoveredInstanceInfo DiscoveredInstanceInfo;
+
+namespace {
+
+class FakePublisher : public Publisher
+{
+public:
+    otbrError Start(void) { return OTBR_ERROR_NONE; }
+    void      Stop(void) {}
+    bool      IsStarted(void) const { return true; }
+    void      Process(const fd_set &, const fd_set &, const fd_set &) {}
+    void      UpdateFdSet(fd_set &, fd_set &, fd_set &, int &, timeval &) {}
+
+    void StopAll(void) { StopDiscovery(); }
+
+    otbrError Replay(void) { return ReplayServices(); }
+
+    void Resolved(const char *aType, const DiscoveredInstanceInfo &aInstance)
+    {
+        HandleServiceResolved(aType, aInstance);
+    }
+
+    std::vector<std::string> mCalls;
+    otbrError                mError = OTBR_ERROR_NONE;
+
+protected:
+    otbrError DoPublishService(ServiceHandle  aHandle,
+                               const char *   aHostName,
+                               uint16_t       aPort,
+                               const char *   aName,
+                               const char *   aType,
+                               const TxtList &aTxtList)
+    {
+        std::string call = "publish " + std::to_string(aHandle) + " " + std::to_string(aPort) + " " + aName + aType;
+
+        if (aHostName != nullptr)
+        {
+            call += std::string(" @") + aHostName;
+        }
+
+        for (const TxtEntry &entry : aTxtList)
+        {
+            call += " " + entry.mName + "=" + std::string(entry.mValue.begin(), entry.mValue.end());
+        }
+
+        mCalls.push_back(call);
+
+        return mError;
+    }
+
+    void DoUnpublishService(ServiceHandle aHandle) { mCalls.push_back("unpublish " + std::to_string(aHandle)); }
+
+    otbrError DoPublishHost(const char *aName, const std::vector<otbr::Ip6Address> &aAddresses)
+    {
+        mCalls.push_back(std::string("publish host ") + aName + " " + std::to_string(aAddresses.size()));
+        return mError;
+    }
+
+    void DoUnpublishHost(const char *aName) { mCalls.push_back(std::string("unpublish host ") + aName); }
+
+    otbrError DoBrowse(const char *aType)
+    {
+        mCalls.push_back(std::string("browse ") + aType);
+        return OTBR_ERROR_NONE;
+    }
+
+    void DoStopBrowse(const char *aType) { mCalls.push_back(std::string("stop browse ") + aType); }
+
+    otbrError DoResolve(const char *aName, const char *aType)
+    {
+        mCalls.push_back(std::string("resolve ") + aName + aType);
+        return OTBR_ERROR_NONE;
+    }
+
+    void DoStopResolve(const char *aName, const char *aType)
+    {
+        mCalls.push_back(std::string("stop resolve ") + aName + aType);
+    }
+};
+
+struct ResolveResult
+{
+    unsigned    mCount = 0;
+    otbrError   mError = OTBR_ERROR_NONE;
+    std::string mHostName;
+};
+
+void HandleResolved(void *aContext, otbrError aError, const char *aType, const DiscoveredInstanceInfo &aInstance)
+{
+    ResolveResult *result = static_cast<ResolveResult *>(aContext);
+
+    (void)aType;
+
+    result->mCount++;
+    result->mError    = aError;
+    result->mHostName = aInstance.mHostName;
+}
+
+} // namespace
+
+TEST_GROUP(MdnsPublisher){};
+
+TEST(MdnsPublisher, TestHandles)
+{
+    FakePublisher publisher;
+    ServiceHandle first;
+    ServiceHandle second;
+    ServiceHandle again;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(1, "a", "_t._udp", {{"nn", "x"}}, &first));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(1, "b", "_t._udp", {{"nn", "y"}}, &second));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(2, "a", "_t._udp", {{"nn", "z"}}, &again));
+    CHECK(first != kInvalidServiceHandle);
+    CHECK(first != second);
+    CHECK_EQUAL(first, again);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.UpdateService(second, {{"nn", "w"}}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.UnpublishService(first));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, publisher.UnpublishService(first));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, publisher.UpdateService(first, {{"nn", "v"}}));
+
+    CHECK_EQUAL(5, publisher.mCalls.size());
+    STRCMP_EQUAL(("publish " + std::to_string(second) + " 1 b_t._udp nn=w").c_str(), publisher.mCalls[3].c_str());
+    STRCMP_EQUAL(("unpublish " + std::to_string(first)).c_str(), publisher.mCalls[4].c_str());
+
+    // A service failed to publish the first time doesn't keep its handle.
+    publisher.mError = OTBR_ERROR_MDNS;
+    CHECK_EQUAL(OTBR_ERROR_MDNS, publisher.PublishService(1, "c", "_t._udp", {}, &first));
+    CHECK_EQUAL(kInvalidServiceHandle, first);
+}
+
+TEST(MdnsPublisher, TestBatch)
+{
+    FakePublisher publisher;
+    ServiceHandle handle;
+
+    publisher.BeginBatch();
+    publisher.BeginBatch();
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(1, "a", "_t._udp", {{"nn", "x"}}, &handle));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(1, "b", "_t._udp", {{"nn", "y"}}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.UpdateService(handle, {{"nn", "z"}}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.EndBatch());
+    CHECK_EQUAL(0, publisher.mCalls.size());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.EndBatch());
+    CHECK_EQUAL(2, publisher.mCalls.size());
+    STRCMP_EQUAL(("publish " + std::to_string(handle) + " 1 a_t._udp nn=z").c_str(), publisher.mCalls[0].c_str());
+
+    // A service unpublished within the batch is never published.
+    publisher.BeginBatch();
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(1, "c", "_t._udp", {}, &handle));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.UnpublishService(handle));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.EndBatch());
+    CHECK_EQUAL(2, publisher.mCalls.size());
+}
+
+TEST(MdnsPublisher, TestHosts)
+{
+    FakePublisher                 publisher;
+    std::vector<otbr::Ip6Address> addresses{otbr::Ip6Address(1), otbr::Ip6Address(2)};
+    ServiceHandle                 handle;
+
+    // The hosts of a batch are published before their services.
+    publisher.BeginBatch();
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService("h", 1, "a", "_t._udp", {}, &handle));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishHost("h", addresses));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.EndBatch());
+    CHECK_EQUAL(2, publisher.mCalls.size());
+    STRCMP_EQUAL("publish host h 2", publisher.mCalls[0].c_str());
+    STRCMP_EQUAL(("publish " + std::to_string(handle) + " 1 a_t._udp @h").c_str(), publisher.mCalls[1].c_str());
+
+    // An unchanged host is not published again.
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishHost("h", addresses));
+    CHECK_EQUAL(2, publisher.mCalls.size());
+
+    addresses.pop_back();
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishHost("h", addresses));
+    CHECK_EQUAL(3, publisher.mCalls.size());
+    STRCMP_EQUAL("publish host h 1", publisher.mCalls[2].c_str());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.Replay());
+    CHECK_EQUAL(5, publisher.mCalls.size());
+    STRCMP_EQUAL("publish host h 1", publisher.mCalls[3].c_str());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.UnpublishService(handle));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.UnpublishHost("h"));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, publisher.UnpublishHost("h"));
+    STRCMP_EQUAL("unpublish host h", publisher.mCalls[6].c_str());
+}
+
+TEST(MdnsPublisher, TestReplay)
+{
+    FakePublisher publisher;
+    ServiceHandle handle;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(1, "a", "_t._udp", {{"nn", "x"}}, &handle));
+
+    // An update lost by the MDNS service is still replayed.
+    publisher.mError = OTBR_ERROR_MDNS;
+    CHECK_EQUAL(OTBR_ERROR_MDNS, publisher.UpdateService(handle, {{"nn", "y"}}));
+    CHECK_EQUAL(OTBR_ERROR_MDNS, publisher.Replay());
+
+    publisher.mError = OTBR_ERROR_NONE;
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.Replay());
+    CHECK_EQUAL(4, publisher.mCalls.size());
+    STRCMP_EQUAL(("publish " + std::to_string(handle) + " 1 a_t._udp nn=y").c_str(), publisher.mCalls[3].c_str());
+}
+
+TEST(MdnsPublisher, TestResolveCache)
+{
+    FakePublisher          publisher;
+    ResolveResult          result;
+    DiscoveredInstanceInfo instance;
+
+    instance.mName     = "a";
+    instance.mHostName = "host.local.";
+    instance.mPort     = 1;
+    instance.mTtl      = 120;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.Resolve("a", "_t._udp", HandleResolved, &result));
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.Resolve("a", "_t._udp", HandleResolved, &result));
+    CHECK_EQUAL(1, publisher.mCalls.size());
+    CHECK_EQUAL(0, result.mCount);
+
+    publisher.Resolved("_t._udp", instance);
+    CHECK_EQUAL(2, result.mCount);
+    CHECK_EQUAL(OTBR_ERROR_NONE, result.mError);
+    STRCMP_EQUAL("host.local.", result.mHostName.c_str());
+    STRCMP_EQUAL("stop resolve a_t._udp", publisher.mCalls[1].c_str());
+
+    // A cached instance is answered without querying again.
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.Resolve("a", "_t._udp", HandleResolved, &result));
+    CHECK_EQUAL(3, result.mCount);
+    CHECK_EQUAL(2, publisher.mCalls.size());
+
+    // The cache is dropped when discovery stops.
+    publisher.StopAll();
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.Resolve("a", "_t._udp", HandleResolved, &result));
+    CHECK_EQUAL(3, result.mCount);
+    CHECK_EQUAL(3, publisher.mCalls.size());
+}
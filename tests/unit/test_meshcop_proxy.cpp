@@ -0,0 +1,216 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <string.h>
+#include <unistd.h>
+
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "agent/meshcop_proxy.hpp"
+#include "common/event_poller.hpp"
+
+using otbr::MeshcopProxy;
+using otbr::MeshcopProxyCounters;
+
+static void Poll(void)
+{
+    otSysMainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::EventPoller::Get().UpdateFdSet(mainloop);
+
+    CHECK(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                 &mainloop.mTimeout) >= 0);
+
+    otbr::EventPoller::Get().Process(mainloop);
+}
+
+TEST_GROUP(MeshcopProxy)
+{
+    int                   mUpstreamFd;
+    std::vector<int>      mClients;
+    MeshcopProxy *        mProxy;
+    MeshcopProxyCounters *mCounters;
+    uint64_t              mOpened;
+    uint64_t              mEvicted;
+    uint64_t              mRejected;
+
+    void setup()
+    {
+        sockaddr_in6 address;
+        socklen_t    length = sizeof(address);
+
+        // The border agent, on an ephemeral port of the loopback interface.
+        mUpstreamFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        CHECK(mUpstreamFd >= 0);
+        memset(&address, 0, sizeof(address));
+        address.sin6_family = AF_INET6;
+        address.sin6_addr   = in6addr_loopback;
+        CHECK_EQUAL(0, bind(mUpstreamFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+        CHECK_EQUAL(0, getsockname(mUpstreamFd, reinterpret_cast<sockaddr *>(&address), &length));
+
+        mProxy = new MeshcopProxy(ntohs(address.sin6_port));
+        CHECK_EQUAL(OTBR_ERROR_NONE, mProxy->Start());
+
+        // The counters are process-wide, so the tests check their increments.
+        mCounters = &MeshcopProxyCounters::Get();
+        mOpened   = mCounters->mSessionsOpened;
+        mEvicted  = mCounters->mSessionsEvicted;
+        mRejected = mCounters->mSessionsRejected;
+    }
+
+    void teardown()
+    {
+        delete mProxy;
+
+        for (int fd : mClients)
+        {
+            close(fd);
+        }
+        mClients.clear();
+        close(mUpstreamFd);
+    }
+
+    // Commissioners on different hosts are on different IPv4 loopback addresses, i.e. 127.0.0.<aHost>.
+    int AddClient(uint8_t aHost)
+    {
+        int         fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        sockaddr_in address;
+
+        CHECK(fd >= 0);
+        memset(&address, 0, sizeof(address));
+        address.sin_family      = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK - 1 + aHost);
+        CHECK_EQUAL(0, bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+        mClients.push_back(fd);
+
+        return fd;
+    }
+
+    void Send(int aFd)
+    {
+        const char  data = 'x';
+        sockaddr_in proxy;
+
+        memset(&proxy, 0, sizeof(proxy));
+        proxy.sin_family      = AF_INET;
+        proxy.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        proxy.sin_port        = htons(mProxy->GetPort());
+        CHECK_EQUAL(1, sendto(aFd, &data, sizeof(data), 0, reinterpret_cast<sockaddr *>(&proxy), sizeof(proxy)));
+        Poll();
+    }
+
+    size_t Drain(void)
+    {
+        size_t count = 0;
+        char   data;
+
+        while (recv(mUpstreamFd, &data, sizeof(data), 0) == 1)
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    uint64_t Opened(void) const { return mCounters->mSessionsOpened - mOpened; }
+    uint64_t Evicted(void) const { return mCounters->mSessionsEvicted - mEvicted; }
+    uint64_t Rejected(void) const { return mCounters->mSessionsRejected - mRejected; }
+};
+
+TEST(MeshcopProxy, TestHostSessionsCapped)
+{
+    for (int index = 0; index < OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS; index++)
+    {
+        Send(AddClient(1));
+    }
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS, Opened());
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS, Drain());
+
+    // Another port of the same host is rejected, though sessions are free for other hosts.
+    Send(AddClient(1));
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS, Opened());
+    CHECK_EQUAL(1, Rejected());
+    CHECK_EQUAL(0, Drain());
+
+    Send(AddClient(2));
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS + 1, Opened());
+    CHECK_EQUAL(1, Drain());
+
+    // Datagrams of open sessions are still relayed.
+    Send(mClients[0]);
+    CHECK_EQUAL(1, Drain());
+    CHECK_EQUAL(0, Evicted());
+}
+
+TEST(MeshcopProxy, TestIdleSessionEvicted)
+{
+    for (int index = 0; index < OTBR_MESHCOP_PROXY_MAX_SESSIONS; index++)
+    {
+        Send(AddClient(1 + index / OTBR_MESHCOP_PROXY_MAX_HOST_SESSIONS));
+    }
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_SESSIONS, Opened());
+    Drain();
+
+    // No session is idle for long enough yet.
+    Send(AddClient(250));
+    CHECK_EQUAL(1, Rejected());
+    CHECK_EQUAL(0, Evicted());
+
+    std::this_thread::sleep_for(std::chrono::seconds(OTBR_MESHCOP_PROXY_EVICT_IDLE_TIME) +
+                                std::chrono::milliseconds(100));
+
+    // All sessions but the first one are active again, so the first one is the least recently active.
+    for (size_t index = 1; index < OTBR_MESHCOP_PROXY_MAX_SESSIONS; index++)
+    {
+        Send(mClients[index]);
+    }
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_SESSIONS, Opened());
+
+    Send(mClients.back());
+    CHECK_EQUAL(1, Evicted());
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_SESSIONS + 1, Opened());
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_SESSIONS, Drain());
+
+    // The evicted commissioner finds no idle session to take in turn.
+    Send(mClients[0]);
+    CHECK_EQUAL(2, Rejected());
+    CHECK_EQUAL(1, Evicted());
+
+    Send(mClients[1]);
+    CHECK_EQUAL(OTBR_MESHCOP_PROXY_MAX_SESSIONS + 1, Opened());
+    CHECK_EQUAL(1, Drain());
+}
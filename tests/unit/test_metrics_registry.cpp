@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/metrics_registry.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::MetricsRegistry;
+
+static const uint64_t kTestBounds[] = {10, 100, 1000};
+
+static MetricsRegistry::Counter   sTestCounter("otbr_test_events_total", "Events of the test.", "kind=\"a\"");
+static MetricsRegistry::Counter   sTestCounterB("otbr_test_events_total", "Events of the test.", "kind=\"b\"");
+static MetricsRegistry::Gauge     sTestGauge("otbr_test_level", "Level of the test.");
+static MetricsRegistry::Histogram sTestHistogram("otbr_test_latency_seconds",
+                                                 "Latency of the test.",
+                                                 kTestBounds,
+                                                 sizeof(kTestBounds) / sizeof(kTestBounds[0]),
+                                                 MetricsRegistry::kUnitMicroseconds);
+
+static int64_t FindValue(const std::string &aName)
+{
+    std::vector<std::pair<std::string, int64_t>> values;
+
+    MetricsRegistry::Get().GetValues(values);
+
+    for (const auto &value : values)
+    {
+        if (value.first == aName)
+        {
+            return value.second;
+        }
+    }
+
+    return -1;
+}
+
+TEST_GROUP(MetricsRegistry){};
+
+TEST(MetricsRegistry, TestCounterAcrossThreads)
+{
+    static const int kNumThreads = 8;
+    static const int kIncrements = 10000;
+
+    std::vector<std::thread> threads;
+    uint64_t                 start = sTestCounter.GetValue();
+
+    for (int i = 0; i < kNumThreads; i++)
+    {
+        threads.emplace_back([] {
+            for (int j = 0; j < kIncrements; j++)
+            {
+                sTestCounter++;
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK_EQUAL(start + kNumThreads * kIncrements, sTestCounter.GetValue());
+    CHECK_EQUAL(static_cast<int64_t>(sTestCounter.GetValue()), FindValue("otbr_test_events_total{kind=\"a\"}"));
+}
+
+TEST(MetricsRegistry, TestPrometheus)
+{
+    std::string output;
+    size_t      help;
+
+    sTestCounterB += 3;
+    sTestGauge.Set(-5);
+    sTestHistogram.Add(5);
+    sTestHistogram.Add(50);
+    sTestHistogram.Add(5000);
+
+    MetricsRegistry::Get().WritePrometheus(output);
+
+    // The series of a name share one description.
+    help = output.find("# HELP otbr_test_events_total Events of the test.\n# TYPE otbr_test_events_total counter\n");
+    CHECK(help != std::string::npos);
+    CHECK(output.find("# HELP otbr_test_events_total", help + 1) == std::string::npos);
+    CHECK(output.find("otbr_test_events_total{kind=\"b\"} 3\n") != std::string::npos);
+    CHECK(output.find("# TYPE otbr_test_level gauge\notbr_test_level -5\n") != std::string::npos);
+
+    CHECK(output.find("otbr_test_latency_seconds_bucket{le=\"0.000010\"} 1\n"
+                      "otbr_test_latency_seconds_bucket{le=\"0.000100\"} 2\n"
+                      "otbr_test_latency_seconds_bucket{le=\"0.001000\"} 2\n"
+                      "otbr_test_latency_seconds_bucket{le=\"+Inf\"} 3\n"
+                      "otbr_test_latency_seconds_sum 0.005055\n"
+                      "otbr_test_latency_seconds_count 3\n") != std::string::npos);
+
+    CHECK_EQUAL(2, FindValue("otbr_test_latency_seconds_bucket{le=\"100\"}"));
+    CHECK_EQUAL(5055, FindValue("otbr_test_latency_seconds_sum"));
+    CHECK_EQUAL(-5, FindValue("otbr_test_level"));
+}
+
+TEST(MetricsRegistry, TestFamilies)
+{
+    static MetricsRegistry::CounterFamily   sRequests("otbr_test_requests_total", "Requests of the test.");
+    static MetricsRegistry::HistogramFamily sDurations("otbr_test_duration_seconds", "Durations of the test.",
+                                                       kTestBounds, sizeof(kTestBounds) / sizeof(kTestBounds[0]),
+                                                       MetricsRegistry::kUnitMicroseconds);
+
+    std::string output;
+    std::string labels = MetricsRegistry::FormatLabel("path", "/a\"b\\c\n");
+
+    STRCMP_EQUAL("path=\"/a\\\"b\\\\c\\n\"", labels.c_str());
+
+    // The same labels always return the same metric.
+    sRequests.Get(MetricsRegistry::FormatLabel("path", "/x")).Add(2);
+    sRequests.Get(MetricsRegistry::FormatLabel("path", "/x"))++;
+    sRequests.Get(labels)++;
+    CHECK(&sRequests.Get(labels) == &sRequests.Get(labels));
+    sDurations.Get(MetricsRegistry::FormatLabel("path", "/x")).Add(50);
+
+    CHECK_EQUAL(3, FindValue("otbr_test_requests_total{path=\"/x\"}"));
+    CHECK_EQUAL(1, FindValue("otbr_test_requests_total{" + labels + "}"));
+    CHECK_EQUAL(1, FindValue("otbr_test_duration_seconds_bucket{path=\"/x\",le=\"100\"}"));
+
+    MetricsRegistry::Get().WritePrometheus(output);
+
+    CHECK(output.find("# TYPE otbr_test_requests_total counter\n"
+                      "otbr_test_requests_total{path=\"/x\"} 3\n"
+                      "otbr_test_requests_total{" +
+                      labels + "} 1\n") != std::string::npos);
+    CHECK(output.find("otbr_test_duration_seconds_sum{path=\"/x\"} 0.000050\n") != std::string::npos);
+}
@@ -0,0 +1,245 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/nft_rule_manager.hpp"
+
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <string.h>
+
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netlink.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Prefix;
+using otbr::Utils::NftRuleManager;
+
+namespace {
+
+struct Attribute
+{
+    uint16_t             mType;
+    std::vector<uint8_t> mValue;
+};
+
+typedef std::vector<Attribute> Attributes;
+
+struct Expression
+{
+    std::string mName;
+    Attributes  mData;
+};
+
+Attributes ParseAttributes(const std::vector<uint8_t> &aBuffer)
+{
+    Attributes attributes;
+
+    for (size_t offset = 0; offset + NLA_HDRLEN <= aBuffer.size();)
+    {
+        nlattr attr;
+
+        memcpy(&attr, &aBuffer[offset], sizeof(attr));
+        CHECK(attr.nla_len >= NLA_HDRLEN && offset + attr.nla_len <= aBuffer.size());
+        attributes.push_back({static_cast<uint16_t>(attr.nla_type & NLA_TYPE_MASK),
+                              std::vector<uint8_t>(aBuffer.begin() + offset + NLA_HDRLEN,
+                                                   aBuffer.begin() + offset + attr.nla_len)});
+        offset += NLA_ALIGN(attr.nla_len);
+    }
+
+    return attributes;
+}
+
+const std::vector<uint8_t> &Find(const Attributes &aAttributes, uint16_t aType)
+{
+    static const std::vector<uint8_t> kMissing;
+
+    for (const Attribute &attribute : aAttributes)
+    {
+        if (attribute.mType == aType)
+        {
+            return attribute.mValue;
+        }
+    }
+
+    FAIL("missing attribute");
+    return kMissing;
+}
+
+uint32_t FindU32(const Attributes &aAttributes, uint16_t aType)
+{
+    const std::vector<uint8_t> &value = Find(aAttributes, aType);
+    uint32_t                    result;
+
+    CHECK_EQUAL(sizeof(result), value.size());
+    memcpy(&result, value.data(), sizeof(result));
+
+    return ntohl(result);
+}
+
+uint16_t FindU16(const Attributes &aAttributes, uint16_t aType)
+{
+    const std::vector<uint8_t> &value = Find(aAttributes, aType);
+    uint16_t                    result;
+
+    CHECK_EQUAL(sizeof(result), value.size());
+    memcpy(&result, value.data(), sizeof(result));
+
+    return ntohs(result);
+}
+
+// Returns the value of a nested NFTA_DATA_VALUE attribute.
+std::vector<uint8_t> FindData(const Attributes &aAttributes, uint16_t aType)
+{
+    return Find(ParseAttributes(Find(aAttributes, aType)), NFTA_DATA_VALUE);
+}
+
+std::vector<Expression> ParseExpressions(const NftRuleManager::Rule &aRule)
+{
+    std::vector<Expression> expressions;
+
+    for (const Attribute &element : ParseAttributes(aRule.GetExpressions()))
+    {
+        Attributes         attributes = ParseAttributes(element.mValue);
+        const auto &       name       = Find(attributes, NFTA_EXPR_NAME);
+        Expression         expression;
+
+        CHECK_EQUAL(NFTA_LIST_ELEM, element.mType);
+        CHECK(!name.empty() && name.back() == '\0');
+        expression.mName = reinterpret_cast<const char *>(name.data());
+        expression.mData = ParseAttributes(Find(attributes, NFTA_EXPR_DATA));
+        expressions.push_back(expression);
+    }
+
+    return expressions;
+}
+
+} // namespace
+
+TEST_GROUP(NftRuleManager){};
+
+TEST(NftRuleManager, EncodeInterfaceMatchAndQueue)
+{
+    NftRuleManager::Rule    rule;
+    std::vector<Expression> expressions;
+    std::vector<uint8_t>    ifName(IFNAMSIZ, 0);
+
+    rule.MatchInputInterface("eth0").Queue(88, true);
+    expressions = ParseExpressions(rule);
+
+    CHECK_EQUAL(3, expressions.size());
+
+    STRCMP_EQUAL("meta", expressions[0].mName.c_str());
+    CHECK_EQUAL(NFT_REG_1, FindU32(expressions[0].mData, NFTA_META_DREG));
+    CHECK_EQUAL(NFT_META_IIFNAME, FindU32(expressions[0].mData, NFTA_META_KEY));
+
+    // The interface name is compared on all of its IFNAMSIZ bytes, padded with zeros.
+    memcpy(ifName.data(), "eth0", strlen("eth0"));
+    STRCMP_EQUAL("cmp", expressions[1].mName.c_str());
+    CHECK_EQUAL(NFT_REG_1, FindU32(expressions[1].mData, NFTA_CMP_SREG));
+    CHECK_EQUAL(NFT_CMP_EQ, FindU32(expressions[1].mData, NFTA_CMP_OP));
+    CHECK(ifName == FindData(expressions[1].mData, NFTA_CMP_DATA));
+
+    STRCMP_EQUAL("queue", expressions[2].mName.c_str());
+    CHECK_EQUAL(88, FindU16(expressions[2].mData, NFTA_QUEUE_NUM));
+    CHECK_EQUAL(1, FindU16(expressions[2].mData, NFTA_QUEUE_TOTAL));
+    CHECK_EQUAL(NFT_QUEUE_FLAG_BYPASS, FindU16(expressions[2].mData, NFTA_QUEUE_FLAGS));
+}
+
+TEST(NftRuleManager, EncodePrefixMatch)
+{
+    NftRuleManager::Rule    rule;
+    std::vector<Expression> expressions;
+    Ip6Prefix               prefix;
+    const uint8_t           expectedPrefix[] = {0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8};
+    const uint8_t           expectedMask[]   = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8};
+
+    // The bits after the prefix length are masked out of the compared value.
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString("fd00:0:0:bf::", prefix.mPrefix));
+    prefix.mLength = 61;
+    rule.MatchDestination(prefix).Accept();
+    expressions = ParseExpressions(rule);
+
+    CHECK_EQUAL(4, expressions.size());
+
+    STRCMP_EQUAL("payload", expressions[0].mName.c_str());
+    CHECK_EQUAL(NFT_PAYLOAD_NETWORK_HEADER, FindU32(expressions[0].mData, NFTA_PAYLOAD_BASE));
+    CHECK_EQUAL(24, FindU32(expressions[0].mData, NFTA_PAYLOAD_OFFSET));
+    CHECK_EQUAL(8, FindU32(expressions[0].mData, NFTA_PAYLOAD_LEN));
+
+    STRCMP_EQUAL("bitwise", expressions[1].mName.c_str());
+    CHECK_EQUAL(8, FindU32(expressions[1].mData, NFTA_BITWISE_LEN));
+    CHECK(std::vector<uint8_t>(expectedMask, expectedMask + sizeof(expectedMask)) ==
+          FindData(expressions[1].mData, NFTA_BITWISE_MASK));
+    CHECK(std::vector<uint8_t>(8, 0) == FindData(expressions[1].mData, NFTA_BITWISE_XOR));
+
+    STRCMP_EQUAL("cmp", expressions[2].mName.c_str());
+    CHECK(std::vector<uint8_t>(expectedPrefix, expectedPrefix + sizeof(expectedPrefix)) ==
+          FindData(expressions[2].mData, NFTA_CMP_DATA));
+
+    STRCMP_EQUAL("immediate", expressions[3].mName.c_str());
+    CHECK_EQUAL(NFT_REG_VERDICT, FindU32(expressions[3].mData, NFTA_IMMEDIATE_DREG));
+    CHECK_EQUAL(NF_ACCEPT, FindU32(ParseAttributes(Find(ParseAttributes(Find(expressions[3].mData,
+                                                                             NFTA_IMMEDIATE_DATA)),
+                                                        NFTA_DATA_VERDICT)),
+                                   NFTA_VERDICT_CODE));
+}
+
+TEST(NftRuleManager, EncodeIcmp6TypeMatch)
+{
+    NftRuleManager::Rule    rule;
+    std::vector<Expression> expressions;
+    Ip6Prefix               prefix;
+
+    // A prefix on a byte boundary needs no mask.
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString("fd00::", prefix.mPrefix));
+    prefix.mLength = 64;
+    rule.MatchSource(prefix).MatchIcmp6Type(135).Drop();
+    expressions = ParseExpressions(rule);
+
+    CHECK_EQUAL(7, expressions.size());
+    STRCMP_EQUAL("payload", expressions[0].mName.c_str());
+    CHECK_EQUAL(8, FindU32(expressions[0].mData, NFTA_PAYLOAD_OFFSET));
+    STRCMP_EQUAL("cmp", expressions[1].mName.c_str());
+
+    STRCMP_EQUAL("meta", expressions[2].mName.c_str());
+    CHECK_EQUAL(NFT_META_L4PROTO, FindU32(expressions[2].mData, NFTA_META_KEY));
+    CHECK(std::vector<uint8_t>(1, IPPROTO_ICMPV6) == FindData(expressions[3].mData, NFTA_CMP_DATA));
+
+    STRCMP_EQUAL("payload", expressions[4].mName.c_str());
+    CHECK_EQUAL(NFT_PAYLOAD_TRANSPORT_HEADER, FindU32(expressions[4].mData, NFTA_PAYLOAD_BASE));
+    CHECK_EQUAL(0, FindU32(expressions[4].mData, NFTA_PAYLOAD_OFFSET));
+    CHECK_EQUAL(1, FindU32(expressions[4].mData, NFTA_PAYLOAD_LEN));
+    CHECK(std::vector<uint8_t>(1, 135) == FindData(expressions[5].mData, NFTA_CMP_DATA));
+
+    STRCMP_EQUAL("immediate", expressions[6].mName.c_str());
+}
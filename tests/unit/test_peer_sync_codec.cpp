@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "backbone_router/peer_sync_codec.hpp"
+
+#include <string.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::BackboneRouter::PeerSyncCodec;
+
+namespace {
+
+const uint8_t kNetworkKey[] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                               0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+
+const uint16_t kPrimary = 0x4400;
+
+Ip6Address ToAddress(const char *aText)
+{
+    Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(aText, address));
+
+    return address;
+}
+
+} // namespace
+
+TEST_GROUP(PeerSyncCodec){};
+
+TEST(PeerSyncCodec, TestRoundTrip)
+{
+    PeerSyncCodec           codec;
+    std::vector<Ip6Address> addresses{ToAddress("fd00:db8::1"), ToAddress("fd00:db8::2")};
+    std::vector<Ip6Address> decoded;
+    uint8_t                 buffer[PeerSyncCodec::kMaxLength];
+    size_t                  length = 0;
+    uint8_t                 type   = 0;
+
+    codec.SetNetworkKey(kNetworkKey, sizeof(kNetworkKey));
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Encode(PeerSyncCodec::kTypeDuas, kPrimary, addresses.data(), addresses.size(),
+                                              buffer, length));
+    CHECK(length == PeerSyncCodec::kHeaderLength + 2 * sizeof(Ip6Address) + PeerSyncCodec::kTagLength);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Decode(buffer, length, kPrimary, type, decoded));
+    CHECK_EQUAL(PeerSyncCodec::kTypeDuas, type);
+    CHECK(decoded == addresses);
+
+    // An empty table is a valid message.
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Encode(PeerSyncCodec::kTypeListeners, kPrimary, nullptr, 0, buffer, length));
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Decode(buffer, length, kPrimary, type, decoded));
+    CHECK_EQUAL(PeerSyncCodec::kTypeListeners, type);
+    CHECK_TRUE(decoded.empty());
+}
+
+TEST(PeerSyncCodec, TestRejection)
+{
+    PeerSyncCodec           codec;
+    PeerSyncCodec           other;
+    Ip6Address              address = ToAddress("fd00:db8::1");
+    std::vector<Ip6Address> decoded;
+    uint8_t                 buffer[PeerSyncCodec::kMaxLength];
+    uint8_t                 copy[PeerSyncCodec::kMaxLength];
+    uint8_t                 otherKey[sizeof(kNetworkKey)];
+    size_t                  length = 0;
+    uint8_t                 type   = 0;
+
+    // Nothing is encoded nor accepted without the network key.
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, codec.Encode(PeerSyncCodec::kTypeDuas, kPrimary, &address, 1, buffer, length));
+
+    codec.SetNetworkKey(kNetworkKey, sizeof(kNetworkKey));
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Encode(PeerSyncCodec::kTypeDuas, kPrimary, &address, 1, buffer, length));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, other.Decode(buffer, length, kPrimary, type, decoded));
+
+    // Another network key.
+    memcpy(otherKey, kNetworkKey, sizeof(otherKey));
+    otherKey[0] ^= 1;
+    other.SetNetworkKey(otherKey, sizeof(otherKey));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, other.Decode(buffer, length, kPrimary, type, decoded));
+
+    // Not the current Primary, or no Primary.
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, codec.Decode(buffer, length, kPrimary + 1, type, decoded));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, codec.Decode(buffer, length, PeerSyncCodec::kInvalidRloc16, type, decoded));
+
+    // Any modified byte, including the announced sender.
+    for (size_t i = 0; i < length; i++)
+    {
+        memcpy(copy, buffer, length);
+        copy[i] ^= 0x80;
+        CHECK_EQUAL(OTBR_ERROR_PARSE, codec.Decode(copy, length, kPrimary, type, decoded));
+    }
+
+    // Truncated messages, and a count not matching the length.
+    CHECK_EQUAL(OTBR_ERROR_PARSE, codec.Decode(buffer, length - 1, kPrimary, type, decoded));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, codec.Decode(buffer, PeerSyncCodec::kHeaderLength, kPrimary, type, decoded));
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Encode(PeerSyncCodec::kTypeDuas, kPrimary, nullptr, 0, buffer, length));
+    buffer[3] = 1;
+    CHECK_EQUAL(OTBR_ERROR_PARSE, codec.Decode(buffer, length, kPrimary, type, decoded));
+
+    // An unknown type, even when authenticated.
+    CHECK_EQUAL(OTBR_ERROR_NONE, codec.Encode(3, kPrimary, nullptr, 0, buffer, length));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, codec.Decode(buffer, length, kPrimary, type, decoded));
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, codec.Encode(PeerSyncCodec::kTypeDuas, kPrimary, &address,
+                                                      PeerSyncCodec::kMaxEntries + 1, buffer, length));
+}
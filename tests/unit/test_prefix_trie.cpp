@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/prefix_trie.hpp"
+
+static otbr::Ip6Prefix MakePrefix(const char *aAddress, uint8_t aLength)
+{
+    otbr::Ip6Prefix prefix;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(aAddress, prefix.mPrefix));
+    prefix.mLength = aLength;
+
+    return prefix;
+}
+
+static otbr::Ip6Address MakeAddress(const char *aAddress)
+{
+    otbr::Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(aAddress, address));
+
+    return address;
+}
+
+TEST_GROUP(PrefixTrie){};
+
+TEST(PrefixTrie, TestLongestPrefixMatch)
+{
+    otbr::PrefixTrie<int>               trie;
+    const otbr::PrefixTrie<int>::Entry *entry;
+
+    trie[MakePrefix("fd00::", 8)]              = 8;
+    trie[MakePrefix("fd00:1234::", 32)]        = 32;
+    trie[MakePrefix("fd00:1234:5678::", 48)]   = 48;
+    trie[MakePrefix("fd00:1234:5678::1", 128)] = 128;
+    CHECK_EQUAL(4, trie.GetSize());
+
+    CHECK(trie.Lookup(MakeAddress("2001:db8::1")) == nullptr);
+
+    entry = trie.Lookup(MakeAddress("fd99::1"));
+    CHECK(entry != nullptr);
+    CHECK_EQUAL(8, entry->second);
+    CHECK_EQUAL(8, entry->first.mLength);
+
+    CHECK_EQUAL(32, trie.Lookup(MakeAddress("fd00:1234:ffff::1"))->second);
+    CHECK_EQUAL(48, trie.Lookup(MakeAddress("fd00:1234:5678::2"))->second);
+    CHECK_EQUAL(128, trie.Lookup(MakeAddress("fd00:1234:5678::1"))->second);
+
+    trie[MakePrefix("::", 0)] = 0;
+    CHECK_EQUAL(0, trie.Lookup(MakeAddress("2001:db8::1"))->second);
+}
+
+TEST(PrefixTrie, TestFindAndRemove)
+{
+    otbr::PrefixTrie<int> trie;
+
+    // Bits after the prefix length are ignored.
+    trie[MakePrefix("fd00:1234:5678::", 30)] = 30;
+    trie[MakePrefix("fd00:abcd::", 32)]      = 32;
+    CHECK(trie.Find(MakePrefix("fd00:1234::", 30)) != nullptr);
+    STRCMP_EQUAL("fd00:1234::/30", trie.GetEntries()[0].first.ToString().c_str());
+    CHECK(trie.Find(MakePrefix("fd00:1234::", 31)) == nullptr);
+    CHECK(trie.Find(MakePrefix("fd00::", 16)) == nullptr);
+
+    CHECK(trie.Remove(MakePrefix("fd00:1234::", 30)));
+    CHECK(!trie.Remove(MakePrefix("fd00:1234::", 30)));
+    CHECK_EQUAL(1, trie.GetSize());
+    CHECK(trie.Lookup(MakeAddress("fd00:1234::1")) == nullptr);
+    CHECK_EQUAL(32, *trie.Find(MakePrefix("fd00:abcd::", 32)));
+    CHECK_EQUAL(32, trie.Lookup(MakeAddress("fd00:abcd::1"))->second);
+
+    trie.Clear();
+    CHECK_EQUAL(0, trie.GetSize());
+    CHECK(trie.Lookup(MakeAddress("fd00:abcd::1")) == nullptr);
+}
@@ -46,3 +46,22 @@ TEST(Pskc, Test123456_0001020304050607_OpenThread)
     pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
     MEMCMP_EQUAL(expected, pskc, sizeof(expected));
 }
+
+TEST(Pskc, TestCachedAcrossInstances)
+{
+    uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    otbr::Psk::Pskc other;
+    const uint8_t * pskc = nullptr;
+
+    mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
+
+    // Moving characters from the network name to the passphrase must not hit the cached value.
+    pskc = other.ComputePskc(extpanid, "OpenThrea", "d123456");
+    CHECK(memcmp(expected, pskc, sizeof(expected)) != 0);
+
+    pskc = other.ComputePskc(extpanid, "OpenThread", "123456");
+    MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+}
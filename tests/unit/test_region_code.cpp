@@ -0,0 +1,72 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/region_code.hpp"
+
+TEST_GROUP(RegionCode){};
+
+TEST(RegionCode, TestFccRegion)
+{
+    const otbr::RegionInfo &info = otbr::GetRegionInfo("US");
+
+    CHECK_EQUAL(otbr::PackRegionCode('U', 'S'), info.mCode);
+    CHECK_EQUAL(0x3fff800, info.mSupportedChannelMask);
+    CHECK_EQUAL(0x1fff800, info.mPreferredChannelMask);
+    CHECK(&info == &otbr::GetRegionInfo("us"));
+}
+
+TEST(RegionCode, TestEtsiRegion)
+{
+    const otbr::RegionInfo &info = otbr::GetRegionInfo("DE");
+
+    CHECK_EQUAL(otbr::PackRegionCode('D', 'E'), info.mCode);
+    CHECK_EQUAL(0x7fff800, info.mSupportedChannelMask);
+    CHECK_EQUAL(0x7fff800, info.mPreferredChannelMask);
+}
+
+TEST(RegionCode, TestOtherRegions)
+{
+    CHECK_EQUAL(0x7fff800, otbr::GetRegionInfo("AU").mSupportedChannelMask);
+    CHECK_EQUAL(30, otbr::GetRegionInfo("AU").mMaxTxPower);
+    CHECK_EQUAL(0x3fff800, otbr::GetRegionInfo("BR").mSupportedChannelMask);
+    CHECK_EQUAL(20, otbr::GetRegionInfo("CN").mMaxTxPower);
+    CHECK_EQUAL(10, otbr::GetRegionInfo("JP").mMaxTxPower);
+    CHECK_EQUAL(otbr::PackRegionCode('Z', 'A'), otbr::GetRegionInfo("za").mCode);
+}
+
+TEST(RegionCode, TestUnknownRegion)
+{
+    CHECK_EQUAL(0, otbr::PackRegionCode("U"));
+    CHECK_EQUAL(0, otbr::PackRegionCode("USA"));
+    CHECK_EQUAL(0, otbr::PackRegionCode("1A"));
+    CHECK_EQUAL(0, otbr::GetRegionInfo("ZZ").mCode);
+    CHECK_EQUAL(0x7fff800, otbr::GetRegionInfo("").mSupportedChannelMask);
+    CHECK(&otbr::GetRegionInfo("ZZ") == &otbr::GetRegionInfo(""));
+}
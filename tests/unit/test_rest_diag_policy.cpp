@@ -0,0 +1,119 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/diag_policy.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::DiagPolicy;
+
+TEST_GROUP(DiagPolicy){};
+
+TEST(DiagPolicy, TestChangeRate)
+{
+    DiagPolicy policy(30000, 10000, 60000, 4, 0);
+
+    // Diagnostics which rarely change are refreshed less often, up to the maximum period.
+    for (int i = 0; i < 10; i++)
+    {
+        policy.HandleResponse(false);
+    }
+    policy.Update(16, 0);
+    CHECK_EQUAL(45000, policy.GetPeriod());
+    policy.HandleResponse(false);
+    policy.Update(16, 0);
+    CHECK_EQUAL(60000, policy.GetPeriod());
+
+    // Diagnostics which often change are refreshed more often, down to the minimum period.
+    policy.HandleResponse(true);
+    policy.Update(16, 0);
+    CHECK_EQUAL(30000, policy.GetPeriod());
+    policy.HandleResponse(true);
+    policy.Update(16, 0);
+    policy.HandleResponse(true);
+    policy.Update(16, 0);
+    CHECK_EQUAL(10000, policy.GetPeriod());
+
+    // Nothing is learned without responses.
+    policy.Update(16, 0);
+    CHECK_EQUAL(10000, policy.GetPeriod());
+}
+
+TEST(DiagPolicy, TestLoss)
+{
+    DiagPolicy policy(30000, 10000, 300000, 8, 0);
+
+    // The window is limited by the number of routers.
+    policy.HandleResponse(true);
+    policy.Update(32, 0);
+    CHECK_EQUAL(8, policy.GetWindow());
+    policy.HandleResponse(true);
+    policy.Update(8, 0);
+    CHECK_EQUAL(2, policy.GetWindow());
+
+    // Losses halve the window and double the period.
+    policy.HandleResponse(true);
+    policy.Update(32, 0);
+    CHECK_EQUAL(3, policy.GetWindow());
+    CHECK_EQUAL(10000, policy.GetPeriod());
+
+    policy.HandleResponse(true);
+    policy.HandleGivenUp(1);
+    policy.Update(32, 0);
+    CHECK_EQUAL(1, policy.GetWindow());
+    CHECK_EQUAL(20000, policy.GetPeriod());
+
+    // The window grows back by one without losses.
+    policy.HandleResponse(false);
+    policy.Update(32, 0);
+    CHECK_EQUAL(2, policy.GetWindow());
+}
+
+TEST(DiagPolicy, TestAirtimeBudget)
+{
+    DiagPolicy policy(30000, 10000, 60000, 4, 20);
+
+    // The airtime estimated from the routers exceeds the budget over the maximum period.
+    policy.HandleResponse(true);
+    policy.Update(99, 0);
+    CHECK_EQUAL(100 * DiagPolicy::kQueryAirtime / 20, policy.GetPeriod());
+
+    // The airtime measured applies when larger.
+    policy.HandleResponse(true);
+    policy.Update(4, 3000000);
+    CHECK_EQUAL(150000, policy.GetPeriod());
+
+    // The period is back within the maximum once the airtime fits in the budget.
+    policy.HandleResponse(true);
+    policy.Update(4, 100000);
+    CHECK_EQUAL(60000, policy.GetPeriod());
+
+    policy.HandleResponse(true);
+    policy.Update(4, 100000);
+    CHECK_EQUAL(30000, policy.GetPeriod());
+}
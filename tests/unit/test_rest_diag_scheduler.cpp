@@ -0,0 +1,200 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/diag_scheduler.hpp"
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::DiagScheduler;
+using std::chrono::milliseconds;
+
+struct SentQueries
+{
+    std::vector<uint16_t> mRloc16s;
+    std::vector<uint32_t> mTlvMasks;
+    bool                  mFail = false;
+};
+
+static bool SendQuery(uint16_t aRloc16, uint32_t aTlvMask, void *aContext)
+{
+    SentQueries *sent = static_cast<SentQueries *>(aContext);
+
+    if (!sent->mFail)
+    {
+        sent->mRloc16s.push_back(aRloc16);
+        sent->mTlvMasks.push_back(aTlvMask);
+    }
+
+    return !sent->mFail;
+}
+
+TEST_GROUP(DiagScheduler){};
+
+TEST(DiagScheduler, TestWindow)
+{
+    DiagScheduler            scheduler(2, 2, 1000);
+    SentQueries              sent;
+    steady_clock::time_point now = steady_clock::now();
+
+    scheduler.Add(0x0000, 1);
+    scheduler.Add(0x0400, 1);
+    scheduler.Add(0x0800, 1);
+    scheduler.Add(0x0800, 2);
+    CHECK(scheduler.IsBusy());
+
+    // No more than the window is waiting for a response.
+    CHECK_EQUAL(0, scheduler.Process(now, SendQuery, &sent));
+    CHECK_EQUAL(2, sent.mRloc16s.size());
+    CHECK_EQUAL(0x0000, sent.mRloc16s[0]);
+    CHECK_EQUAL(0x0400, sent.mRloc16s[1]);
+    CHECK(scheduler.GetNextTime() == now + milliseconds(1000));
+
+    // A response lets the next query be sent, with the TLV types of both queries of the node.
+    CHECK_EQUAL(1, scheduler.HandleResponse(0x0000));
+    scheduler.Process(now + milliseconds(10), SendQuery, &sent);
+    CHECK_EQUAL(3, sent.mRloc16s.size());
+    CHECK_EQUAL(0x0800, sent.mRloc16s[2]);
+    CHECK_EQUAL(3, sent.mTlvMasks[2]);
+
+    CHECK_EQUAL(1, scheduler.HandleResponse(0x0400));
+    CHECK_EQUAL(3, scheduler.HandleResponse(0x0800));
+    CHECK_EQUAL(0, scheduler.HandleResponse(0x0800));
+    CHECK_FALSE(scheduler.IsBusy());
+}
+
+TEST(DiagScheduler, TestRetry)
+{
+    DiagScheduler            scheduler(4, 2, 1000);
+    SentQueries              sent;
+    steady_clock::time_point now = steady_clock::now();
+
+    scheduler.Add(0x0400, 1);
+    scheduler.Add(0x0800, 1);
+    scheduler.Process(now, SendQuery, &sent);
+    scheduler.HandleResponse(0x0800);
+
+    // An unanswered query is sent again, then given up after the maximum number of attempts.
+    CHECK_EQUAL(0, scheduler.Process(now + milliseconds(1000), SendQuery, &sent));
+    CHECK_EQUAL(3, sent.mRloc16s.size());
+    CHECK_EQUAL(0x0400, sent.mRloc16s[2]);
+
+    CHECK_EQUAL(1, scheduler.Process(now + milliseconds(2000), SendQuery, &sent));
+    CHECK_EQUAL(3, sent.mRloc16s.size());
+    CHECK_FALSE(scheduler.IsBusy());
+}
+
+TEST(DiagScheduler, TestSendFailure)
+{
+    DiagScheduler            scheduler(4, 3, 1000);
+    SentQueries              sent;
+    steady_clock::time_point now = steady_clock::now();
+
+    scheduler.Add(0x0400, 1);
+    scheduler.Add(0x0800, 1);
+
+    // A failure to send defers the queries rather than failing them all.
+    sent.mFail = true;
+    CHECK_EQUAL(0, scheduler.Process(now, SendQuery, &sent));
+    CHECK(scheduler.IsBusy());
+    CHECK(scheduler.GetNextTime() > now);
+
+    sent.mFail = false;
+    scheduler.Process(now, SendQuery, &sent);
+    CHECK_EQUAL(0, sent.mRloc16s.size());
+
+    scheduler.Process(scheduler.GetNextTime(), SendQuery, &sent);
+    CHECK_EQUAL(2, sent.mRloc16s.size());
+}
+
+TEST(DiagScheduler, TestAirtimeBudget)
+{
+    DiagScheduler            scheduler(4, 3, 1000);
+    SentQueries              sent;
+    steady_clock::time_point now = steady_clock::now();
+
+    // 10 ms of airtime within a budget of 10 permille delays the next query by 1 second.
+    scheduler.SetAirtimeBudget(10);
+    scheduler.Add(0x0400, 1, 10000);
+    scheduler.Add(0x0800, 1, 10000);
+
+    scheduler.Process(now, SendQuery, &sent);
+    CHECK_EQUAL(1, sent.mRloc16s.size());
+    CHECK_EQUAL(10000, scheduler.GetAirtime());
+
+    scheduler.HandleResponse(0x0400);
+    scheduler.Process(now + milliseconds(999), SendQuery, &sent);
+    CHECK_EQUAL(1, sent.mRloc16s.size());
+    CHECK(scheduler.GetNextTime() == now + milliseconds(1000));
+
+    scheduler.Process(now + milliseconds(1000), SendQuery, &sent);
+    CHECK_EQUAL(2, sent.mRloc16s.size());
+    CHECK_EQUAL(20000, scheduler.GetAirtime());
+}
+
+TEST(DiagScheduler, TestOnDemandNotDelayed)
+{
+    DiagScheduler            scheduler(4, 3, 1000);
+    SentQueries              sent;
+    steady_clock::time_point now = steady_clock::now();
+
+    scheduler.SetAirtimeBudget(10);
+    scheduler.Add(0x0400, 1, 10000);
+    scheduler.Add(0x0800, 1, 10000);
+
+    scheduler.Process(now, SendQuery, &sent);
+    CHECK_EQUAL(1, sent.mRloc16s.size());
+
+    // A query on demand is sent at once, before the background query delayed by the airtime budget.
+    scheduler.Add(0x0c00, 1, 10000, /* aOnDemand */ true);
+    CHECK(scheduler.GetNextTime() <= now);
+    scheduler.Process(now, SendQuery, &sent);
+    CHECK_EQUAL(2, sent.mRloc16s.size());
+    CHECK_EQUAL(0x0c00, sent.mRloc16s[1]);
+
+    // Scheduled again on demand, a background query is moved ahead and not delayed either.
+    scheduler.Add(0x1000, 1, 10000);
+    scheduler.Add(0x1000, 2, 10000, /* aOnDemand */ true);
+    scheduler.Process(now, SendQuery, &sent);
+    CHECK_EQUAL(3, sent.mRloc16s.size());
+    CHECK_EQUAL(0x1000, sent.mRloc16s[2]);
+    CHECK_EQUAL(3, sent.mTlvMasks[2]);
+
+    // The airtime of the queries on demand delays the background query.
+    scheduler.HandleResponse(0x0400);
+    scheduler.HandleResponse(0x0c00);
+    scheduler.HandleResponse(0x1000);
+    CHECK_EQUAL(30000, scheduler.GetAirtime());
+    CHECK(scheduler.GetNextTime() == now + milliseconds(3000));
+    scheduler.Process(now + milliseconds(2999), SendQuery, &sent);
+    CHECK_EQUAL(3, sent.mRloc16s.size());
+    scheduler.Process(now + milliseconds(3000), SendQuery, &sent);
+    CHECK_EQUAL(4, sent.mRloc16s.size());
+    CHECK_EQUAL(0x0800, sent.mRloc16s[3]);
+}
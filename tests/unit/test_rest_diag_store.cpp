@@ -0,0 +1,310 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/diag_store.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::DiagInfo;
+using otbr::rest::DiagStore;
+
+TEST_GROUP(DiagStore){};
+
+static std::vector<uint8_t> PackRoute(uint8_t aRouteCount, uint16_t aRloc16)
+{
+    std::vector<uint8_t> tlvs;
+    otNetworkDiagTlv     tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = aRloc16;
+    DiagStore::AppendTlv(tlvs, tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    tlv.mData.mRoute.mRouteCount = aRouteCount;
+    for (uint8_t i = 0; i < aRouteCount; i++)
+    {
+        tlv.mData.mRoute.mRouteData[i].mRouterId = i;
+    }
+    DiagStore::AppendTlv(tlvs, tlv);
+
+    return tlvs;
+}
+
+TEST(DiagStore, TestPackedTlvs)
+{
+    DiagStore            store;
+    std::vector<uint8_t> tlvs = PackRoute(2, 0x0400);
+    otNetworkDiagTlv     tlv;
+    size_t               offset = 0;
+    const DiagInfo *     info;
+
+    // Only the route entries in use are stored.
+    CHECK(tlvs.size() < sizeof(otNetworkDiagTlv));
+
+    store.Update(0x0400, tlvs, 0, steady_clock::now());
+    info = store.Find(0x0400);
+    CHECK(info != nullptr);
+    CHECK(store.Find(0x0800) == nullptr);
+
+    CHECK(DiagStore::GetNextTlv(*info, offset, tlv));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, tlv.mType);
+    CHECK_EQUAL(0x0400, tlv.mData.mAddr16);
+
+    CHECK(DiagStore::GetNextTlv(*info, offset, tlv));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE, tlv.mType);
+    CHECK_EQUAL(2, tlv.mData.mRoute.mRouteCount);
+    CHECK_EQUAL(1, tlv.mData.mRoute.mRouteData[1].mRouterId);
+
+    CHECK_FALSE(DiagStore::GetNextTlv(*info, offset, tlv));
+}
+
+TEST(DiagStore, TestMerge)
+{
+    DiagStore            store;
+    std::vector<uint8_t>     tlvs = PackRoute(1, 0x0800);
+    std::vector<uint8_t>     update;
+    otNetworkDiagTlv         tlv;
+    size_t                   offset = 0;
+    int                      count  = 0;
+    steady_clock::time_point now    = steady_clock::now();
+
+    store.Update(0x0800, tlvs, 0, now);
+    tlvs = PackRoute(1, 0x0400);
+    store.Update(0x0400, tlvs, 0, now);
+
+    // Nodes are ordered by RLOC16.
+    CHECK_EQUAL(0x0400, store.begin()->mRloc16);
+    CHECK_EQUAL(0x0800, (store.begin() + 1)->mRloc16);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType          = OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT;
+    tlv.mData.mTimeout = 240;
+    DiagStore::AppendTlv(update, tlv);
+    store.Update(0x0400, update, 0, now);
+
+    // The update is added to the TLVs received before.
+    while (DiagStore::GetNextTlv(*store.Find(0x0400), offset, tlv))
+    {
+        count++;
+    }
+    CHECK_EQUAL(3, count);
+
+    store.EraseOlderThan(now + std::chrono::seconds(1));
+    CHECK(store.begin() == store.end());
+}
+
+TEST(DiagStore, TestTlvTimes)
+{
+    DiagStore                store;
+    std::vector<uint8_t>     tlvs = PackRoute(1, 0x0400);
+    std::vector<uint8_t>     update;
+    otNetworkDiagTlv         tlv;
+    steady_clock::time_point now        = steady_clock::now();
+    uint32_t                 childTable = 1u << OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    const DiagInfo *         info;
+    size_t                   offset = 0;
+
+    // A TLV type queried but absent from the response is answered too.
+    store.Update(0x0400, tlvs, childTable, now - std::chrono::seconds(10));
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = 0x0400;
+    DiagStore::AppendTlv(update, tlv);
+    store.Update(0x0400, update, 0, now);
+
+    // Each TLV type keeps the time it was answered, the route is kept from the first response.
+    info = store.Find(0x0400);
+    CHECK(info->mStartTime == now);
+    CHECK(info->mTlvMask & childTable);
+    CHECK(DiagStore::GetTlvTime(*info, OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS) == now);
+    CHECK(DiagStore::GetTlvTime(*info, OT_NETWORK_DIAGNOSTIC_TLV_ROUTE) == now - std::chrono::seconds(10));
+    CHECK(DiagStore::GetTlvTime(*info, OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE) == now - std::chrono::seconds(10));
+
+    // Only the TLVs of the given types answered before the time are removed.
+    CHECK(store.EraseTlvsOlderThan(now - std::chrono::seconds(5), 1u << OT_NETWORK_DIAGNOSTIC_TLV_ROUTE));
+    CHECK_FALSE(store.EraseTlvsOlderThan(now - std::chrono::seconds(5), 1u << OT_NETWORK_DIAGNOSTIC_TLV_ROUTE));
+    info = store.Find(0x0400);
+    CHECK(info != nullptr);
+    CHECK_FALSE(info->mTlvMask & (1u << OT_NETWORK_DIAGNOSTIC_TLV_ROUTE));
+    CHECK(info->mTlvMask & childTable);
+    CHECK(DiagStore::GetNextTlv(*info, offset, tlv));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, tlv.mType);
+    CHECK_FALSE(DiagStore::GetNextTlv(*info, offset, tlv));
+}
+
+TEST(DiagStore, TestEraseOldest)
+{
+    DiagStore                store;
+    std::vector<uint8_t>     tlvs = PackRoute(4, 0x0400);
+    size_t                   size = tlvs.size();
+    steady_clock::time_point now  = steady_clock::now();
+    size_t                   usage;
+
+    CHECK_EQUAL(0u, store.GetMemoryUsage());
+
+    store.Update(0x0400, tlvs, 0, now);
+
+    tlvs = PackRoute(4, 0x0800);
+    store.Update(0x0800, tlvs, 0, now - std::chrono::seconds(1));
+
+    usage = store.GetMemoryUsage();
+    CHECK(usage >= 2 * (sizeof(DiagInfo) + size));
+
+    // The node received the longest time ago is erased first, releasing its TLVs.
+    CHECK_EQUAL(0x0800, store.EraseOldest());
+    CHECK(store.GetMemoryUsage() <= usage - size);
+    CHECK(store.Find(0x0400) != nullptr);
+
+    store.EraseOlderThan(now + std::chrono::seconds(1));
+    CHECK(store.IsEmpty());
+}
+
+TEST(DiagStore, TestSaveRestore)
+{
+    DiagStore                store;
+    DiagStore                restored;
+    std::vector<uint8_t>     tlvs = PackRoute(3, 0x0400);
+    std::vector<uint8_t>     record;
+    steady_clock::time_point now = steady_clock::now();
+    const DiagInfo *         info;
+
+    store.Update(0x0400, tlvs, 0, now - std::chrono::seconds(20));
+    tlvs = PackRoute(1, 0x0800);
+    store.Update(0x0800, tlvs, 0, now - std::chrono::seconds(100));
+    tlvs.clear();
+    store.Update(0x0400, tlvs, 1u << OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE, now - std::chrono::seconds(10));
+    store.Save(record, SIZE_MAX);
+
+    // The node received before the expiry time is not restored, the other keeps its TLVs and receive time.
+    CHECK_EQUAL(1u, restored.Restore(record, now - std::chrono::seconds(50)));
+    CHECK(restored.Find(0x0800) == nullptr);
+    info = restored.Find(0x0400);
+    CHECK(info != nullptr);
+    CHECK(info->mDiagContent == store.Find(0x0400)->mDiagContent);
+    CHECK(info->mStartTime < now - std::chrono::seconds(9));
+    CHECK(info->mStartTime > now - std::chrono::seconds(11));
+    CHECK_EQUAL(store.Find(0x0400)->mTlvMask, info->mTlvMask);
+    CHECK_EQUAL(10000, info->mTlvAges[OT_NETWORK_DIAGNOSTIC_TLV_ROUTE]);
+    CHECK_EQUAL(0, info->mTlvAges[OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE]);
+
+    // Nodes not fitting in the record are not saved.
+    store.Save(record, record.size() - 1);
+    restored = DiagStore();
+    CHECK_EQUAL(1u, restored.Restore(record, now - std::chrono::seconds(1000)));
+}
+
+TEST(DiagStore, TestChangedTlvs)
+{
+    DiagStore                store;
+    std::vector<uint8_t>     tlvs    = PackRoute(1, 0x0400);
+    uint32_t                 changed = 0;
+    uint32_t                 route   = 1u << OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    uint32_t                 address = 1u << OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    otNetworkDiagTlv         tlv;
+    steady_clock::time_point now     = steady_clock::now();
+
+    // The TLVs of a new node all changed.
+    store.Update(0x0400, tlvs, 0, now, &changed);
+    CHECK_EQUAL(route | address, changed);
+
+    tlvs = PackRoute(1, 0x0400);
+    store.Update(0x0400, tlvs, 0, now, &changed);
+    CHECK_EQUAL(0, changed);
+
+    tlvs = PackRoute(2, 0x0400);
+    store.Update(0x0400, tlvs, 0, now, &changed);
+    CHECK_EQUAL(route, changed);
+
+    // A TLV type answered without any TLV changed when the node had one.
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = 0x0400;
+    tlvs.clear();
+    DiagStore::AppendTlv(tlvs, tlv);
+    store.Update(0x0400, tlvs, route, now, &changed);
+    CHECK_EQUAL(route, changed);
+}
+
+static std::vector<uint8_t> PackMacCounters(uint32_t aInErrors, uint32_t aOutErrors)
+{
+    std::vector<uint8_t> tlvs;
+    otNetworkDiagTlv     tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                           = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+    tlv.mData.mMacCounters.mIfInErrors  = aInErrors;
+    tlv.mData.mMacCounters.mIfOutErrors = aOutErrors;
+    DiagStore::AppendTlv(tlvs, tlv);
+
+    return tlvs;
+}
+
+TEST(DiagStore, TestMeshCounters)
+{
+    DiagStore                store;
+    std::vector<uint8_t>     tlvs = PackMacCounters(0xffffffff, 1);
+    uint32_t                 mac  = 1u << OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+    steady_clock::time_point now  = steady_clock::now();
+
+    CHECK_EQUAL(0u, store.GetMeshCounters().mNumNodes);
+
+    // The sums do not wrap at the range of the counters of a node.
+    store.Update(0x0400, tlvs, 0, now);
+    tlvs = PackMacCounters(2, 3);
+    store.Update(0x0800, tlvs, 0, now - std::chrono::seconds(1));
+    CHECK_EQUAL(2u, store.GetMeshCounters().mNumNodes);
+    CHECK(store.GetMeshCounters().mIfInErrors == 0x100000001ull);
+    CHECK(store.GetMeshCounters().mIfOutErrors == 4);
+
+    // The counters of a response replace those of the node.
+    tlvs = PackMacCounters(5, 6);
+    store.Update(0x0800, tlvs, 0, now);
+    CHECK_EQUAL(2u, store.GetMeshCounters().mNumNodes);
+    CHECK(store.GetMeshCounters().mIfInErrors == 0x100000004ull);
+    CHECK(store.GetMeshCounters().mIfOutErrors == 7);
+
+    // Other TLVs keep the counters, removing them subtracts them.
+    tlvs = PackRoute(1, 0x0400);
+    store.Update(0x0400, tlvs, 0, now);
+    CHECK(store.GetMeshCounters().mIfOutErrors == 7);
+
+    CHECK(store.EraseTlvsOlderThan(now + std::chrono::seconds(1), mac));
+    CHECK_EQUAL(0u, store.GetMeshCounters().mNumNodes);
+    CHECK(store.GetMeshCounters().mIfInErrors == 0);
+
+    tlvs = PackMacCounters(2, 3);
+    store.Update(0x0800, tlvs, 0, now);
+    store.EraseOlderThan(now + std::chrono::seconds(1));
+    CHECK_EQUAL(0u, store.GetMeshCounters().mNumNodes);
+    CHECK(store.GetMeshCounters().mIfOutErrors == 0);
+}
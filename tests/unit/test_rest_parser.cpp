@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include <string>
+
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::HttpStatusCode;
+using otbr::rest::Parser;
+using otbr::rest::Request;
+
+TEST_GROUP(RestParser){};
+
+// Parses the whole input into the request, returns whether the parser failed.
+static bool Parse(const std::string &aInput, Request &aRequest)
+{
+    Parser parser(&aRequest);
+
+    aRequest.SetInput(aInput);
+    parser.Init();
+    parser.Process(aInput.data(), aInput.size());
+
+    return parser.HasError();
+}
+
+static std::string MakeChunkedPost(size_t aBodySize)
+{
+    static const size_t kChunkSize = 1000;
+    std::string         request    = "POST /node/dataset/active HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n";
+    char                chunkSize[16];
+
+    for (size_t sent = 0; sent < aBodySize; sent += kChunkSize)
+    {
+        size_t length = (aBodySize - sent < kChunkSize) ? aBodySize - sent : kChunkSize;
+
+        snprintf(chunkSize, sizeof(chunkSize), "%zx\r\n", length);
+        request += chunkSize;
+        request += std::string(length, 'a') + "\r\n";
+    }
+
+    return request + "0\r\n\r\n";
+}
+
+TEST(RestParser, AcceptRequestWithinLimits)
+{
+    Request     request;
+    std::string body(OTBR_REST_MAX_BODY_SIZE, 'a');
+    std::string input = "PUT /node/state HTTP/1.1\r\nX-Padding: " + std::string(OTBR_REST_MAX_HEADER_SIZE / 2, 'x') +
+                        "\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+
+    CHECK_FALSE(Parse(input, request));
+    CHECK(request.IsComplete());
+    CHECK_EQUAL(body.size(), request.GetBodySize());
+
+    Request chunkedRequest;
+
+    CHECK_FALSE(Parse(MakeChunkedPost(OTBR_REST_MAX_BODY_SIZE), chunkedRequest));
+    CHECK(chunkedRequest.IsComplete());
+    CHECK_EQUAL(OTBR_REST_MAX_BODY_SIZE, chunkedRequest.GetBodySize());
+}
+
+TEST(RestParser, RejectLargeHeaderFields_431)
+{
+    Request     request;
+    std::string input = "GET /node HTTP/1.1\r\nX-Padding: " + std::string(OTBR_REST_MAX_HEADER_SIZE, 'x') + "\r\n\r\n";
+
+    CHECK_TRUE(Parse(input, request));
+    CHECK_FALSE(request.IsComplete());
+    CHECK(request.GetParseError() == HttpStatusCode::kStatusRequestHeaderFieldsTooLarge);
+}
+
+TEST(RestParser, RejectLargeUrl_431)
+{
+    Request     request;
+    std::string input = "GET /node?x=" + std::string(OTBR_REST_MAX_HEADER_SIZE, 'x') + " HTTP/1.1\r\n\r\n";
+
+    CHECK_TRUE(Parse(input, request));
+    CHECK(request.GetParseError() == HttpStatusCode::kStatusRequestHeaderFieldsTooLarge);
+}
+
+TEST(RestParser, RejectAnnouncedLargeBody_413)
+{
+    Request     request;
+    std::string input = "PUT /node/state HTTP/1.1\r\nContent-Length: " + std::to_string(OTBR_REST_MAX_BODY_SIZE + 1) +
+                        "\r\n\r\n";
+
+    // Rejected before any byte of the body is received.
+    CHECK_TRUE(Parse(input, request));
+    CHECK_EQUAL(0, request.GetBodySize());
+    CHECK(request.GetParseError() == HttpStatusCode::kStatusPayloadTooLarge);
+}
+
+TEST(RestParser, RejectLargeChunkedBody_413)
+{
+    Request request;
+
+    CHECK_TRUE(Parse(MakeChunkedPost(OTBR_REST_MAX_BODY_SIZE + 1), request));
+    CHECK_FALSE(request.IsComplete());
+    CHECK(request.GetBodySize() <= OTBR_REST_MAX_BODY_SIZE);
+    CHECK(request.GetParseError() == HttpStatusCode::kStatusPayloadTooLarge);
+}
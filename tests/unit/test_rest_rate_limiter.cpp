@@ -0,0 +1,81 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/rate_limiter.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::RateLimiter;
+using std::chrono::milliseconds;
+
+TEST_GROUP(RateLimiter){};
+
+TEST(RateLimiter, TestBurst)
+{
+    RateLimiter              limiter(100, 3);
+    steady_clock::time_point now = steady_clock::now();
+
+    // A new client has a full bucket.
+    CHECK(limiter.Allow("2001:db8::1", now));
+    CHECK(limiter.Allow("2001:db8::1", now));
+    CHECK(limiter.Allow("2001:db8::1", now));
+    CHECK_FALSE(limiter.Allow("2001:db8::1", now));
+
+    // Other clients have their own buckets.
+    CHECK(limiter.Allow("2001:db8::2", now));
+
+    // One token is gained per interval.
+    CHECK_FALSE(limiter.Allow("2001:db8::1", now + milliseconds(99)));
+    CHECK(limiter.Allow("2001:db8::1", now + milliseconds(100)));
+    CHECK_FALSE(limiter.Allow("2001:db8::1", now + milliseconds(100)));
+
+    // The bucket is full again after being idle, but holds no more than the burst.
+    now += milliseconds(10000);
+    CHECK(limiter.Allow("2001:db8::1", now));
+    CHECK(limiter.Allow("2001:db8::1", now));
+    CHECK(limiter.Allow("2001:db8::1", now));
+    CHECK_FALSE(limiter.Allow("2001:db8::1", now));
+
+    CHECK_EQUAL(1, limiter.GetRetryAfter());
+}
+
+TEST(RateLimiter, TestExempt)
+{
+    RateLimiter              limiter(1000, 1);
+    steady_clock::time_point now = steady_clock::now();
+
+    CHECK(limiter.Allow("::ffff:127.0.0.1", now));
+    CHECK(limiter.Allow("::ffff:127.0.0.1", now));
+    CHECK(limiter.Allow("::1", now));
+    CHECK(limiter.Allow("::1", now));
+    CHECK(limiter.Allow("unix:1000", now));
+    CHECK(limiter.Allow("unix:1000", now));
+
+    CHECK(limiter.Allow("::ffff:192.0.2.1", now));
+    CHECK_FALSE(limiter.Allow("::ffff:192.0.2.1", now));
+}
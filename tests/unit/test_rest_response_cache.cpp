@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/response_cache.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::ContentFormat;
+using otbr::rest::JsonWriter;
+using otbr::rest::Response;
+using otbr::rest::ResponseCache;
+using otbr::rest::SharedBody;
+using std::chrono::milliseconds;
+
+TEST_GROUP(ResponseCache){};
+
+static std::shared_ptr<SharedBody> MakeBody(const char *aText)
+{
+    std::string body(aText);
+
+    return std::make_shared<SharedBody>(body);
+}
+
+TEST(ResponseCache, TestFind)
+{
+    ResponseCache            cache(2, 1000);
+    steady_clock::time_point now  = steady_clock::now();
+    auto                     body = MakeBody("[]");
+
+    CHECK(cache.Find(1, "/diagnostics", ContentFormat::kJson, 7, now) == nullptr);
+
+    cache.Insert(1, "/diagnostics", ContentFormat::kJson, 7, now, body);
+    CHECK(cache.Find(1, "/diagnostics", ContentFormat::kJson, 7, now + milliseconds(999)) == body);
+    CHECK_EQUAL(1u, cache.GetHits());
+
+    // The route, the target, the encoding and the version of the state must all match.
+    CHECK(cache.Find(2, "/diagnostics", ContentFormat::kJson, 7, now) == nullptr);
+    CHECK(cache.Find(1, "/diagnostics?types=0", ContentFormat::kJson, 7, now) == nullptr);
+    CHECK(cache.Find(1, "/diagnostics", ContentFormat::kCbor, 7, now) == nullptr);
+    CHECK(cache.Find(1, "/diagnostics", ContentFormat::kJson, 8, now) == nullptr);
+
+    // A body is only shared for a short time.
+    CHECK(cache.Find(1, "/diagnostics", ContentFormat::kJson, 7, now + milliseconds(1000)) == nullptr);
+}
+
+TEST(ResponseCache, TestReplace)
+{
+    ResponseCache            cache(2, 1000);
+    steady_clock::time_point now    = steady_clock::now();
+    auto                     first  = MakeBody("1");
+    auto                     second = MakeBody("2");
+
+    cache.Insert(1, "/a", ContentFormat::kJson, 1, now, first);
+    cache.Insert(1, "/b", ContentFormat::kJson, 1, now + milliseconds(1), MakeBody("b"));
+    CHECK(cache.Find(1, "/a", ContentFormat::kJson, 1, now + milliseconds(2)) == first);
+
+    // The entry used the longest time ago is replaced first.
+    cache.Insert(1, "/c", ContentFormat::kJson, 1, now + milliseconds(3), MakeBody("c"));
+    CHECK(cache.Find(1, "/a", ContentFormat::kJson, 1, now + milliseconds(4)) == first);
+    CHECK(cache.Find(1, "/b", ContentFormat::kJson, 1, now + milliseconds(4)) == nullptr);
+
+    // A newer version replaces the entry of the same request.
+    cache.Insert(1, "/a", ContentFormat::kJson, 2, now + milliseconds(5), second);
+    CHECK(cache.Find(1, "/a", ContentFormat::kJson, 1, now + milliseconds(6)) == nullptr);
+    CHECK(cache.Find(1, "/a", ContentFormat::kJson, 2, now + milliseconds(6)) == second);
+}
+
+TEST(ResponseCache, TestSharedBody)
+{
+    Response response;
+    Response other;
+    int      renders = 0;
+
+    response.SetBodyRenderer([&renders](JsonWriter &aWriter) {
+        renders++;
+        aWriter.BeginArray();
+        aWriter.EndArray();
+    });
+
+    // A shared body is rendered once, by the first response written.
+    other.SetSharedBody(response.ShareBody());
+    CHECK(response.HasBodyRenderer());
+    CHECK(other.HasBodyRenderer());
+
+    other.RenderBody();
+    response.RenderBody();
+    CHECK_EQUAL(1, renders);
+    CHECK_FALSE(response.HasBodyRenderer());
+    STRCMP_EQUAL("[]", response.GetBody().c_str());
+    CHECK(&response.GetBody() == &other.GetBody());
+
+    // Setting a body leaves the shared body to the other responses.
+    std::string body("{}");
+
+    response.SetBody(body);
+    STRCMP_EQUAL("{}", response.GetBody().c_str());
+    STRCMP_EQUAL("[]", other.GetBody().c_str());
+}
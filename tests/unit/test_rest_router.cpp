@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/router.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::HttpMethod;
+using otbr::rest::HttpStatusCode;
+using otbr::rest::Router;
+
+TEST_GROUP(Router){};
+
+TEST(Router, MatchStaticPath)
+{
+    Router             router;
+    Router::Parameters parameters;
+    uint16_t           id = 0;
+
+    router.Add("/", HttpMethod::kGet, 1);
+    router.Add("/node", HttpMethod::kGet, 2);
+    router.Add("/node/rloc16", HttpMethod::kGet, 3);
+
+    CHECK(router.Match("/", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(1, id);
+    CHECK(router.Match("/node", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(2, id);
+    CHECK(router.Match("/node/rloc16", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(3, id);
+    CHECK(parameters.empty());
+
+    CHECK(router.Match("/node/rloc", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusResourceNotFound);
+    CHECK(router.Match("/node/rloc16/x", HttpMethod::kGet, id, parameters) ==
+          HttpStatusCode::kStatusResourceNotFound);
+    CHECK(router.Match("/node", HttpMethod::kPost, id, parameters) == HttpStatusCode::kStatusMethodNotAllowed);
+}
+
+TEST(Router, MatchPathParameter)
+{
+    Router             router;
+    Router::Parameters parameters;
+    uint16_t           id = 0;
+
+    router.Add("/diagnostics", HttpMethod::kGet, 1);
+    router.Add("/diagnostics/{rloc16}", HttpMethod::kGet, 2);
+    router.Add("/diagnostics/{rloc16}/children", HttpMethod::kGet, 3);
+    router.Add("/diagnostics/leader/children", HttpMethod::kGet, 4);
+
+    CHECK(router.Match("/diagnostics", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(1, id);
+    CHECK(parameters.empty());
+
+    CHECK(router.Match("/diagnostics/0x1400", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(2, id);
+    CHECK_EQUAL(1, parameters.size());
+    STRCMP_EQUAL("rloc16", parameters[0].first.c_str());
+    STRCMP_EQUAL("0x1400", parameters[0].second.c_str());
+
+    CHECK(router.Match("/diagnostics/leader/children", HttpMethod::kGet, id, parameters) ==
+          HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(4, id);
+    CHECK(parameters.empty());
+
+    // Falls back to the parameter when the static segment does not lead to a route.
+    CHECK(router.Match("/diagnostics/leader", HttpMethod::kGet, id, parameters) == HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(2, id);
+    STRCMP_EQUAL("leader", parameters[0].second.c_str());
+
+    CHECK(router.Match("/diagnostics/0x1400/children", HttpMethod::kGet, id, parameters) ==
+          HttpStatusCode::kStatusOk);
+    CHECK_EQUAL(3, id);
+    STRCMP_EQUAL("0x1400", parameters[0].second.c_str());
+}
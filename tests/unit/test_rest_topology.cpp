@@ -0,0 +1,108 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/topology.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "rest/diag_store.hpp"
+
+using otbr::rest::DiagInfo;
+using otbr::rest::DiagStore;
+using otbr::rest::Topology;
+
+TEST_GROUP(Topology){};
+
+static DiagInfo MakeRouter(uint16_t aRloc16, uint8_t aRouteCost)
+{
+    DiagInfo         info;
+    otNetworkDiagTlv tlv;
+
+    info.mRloc16  = aRloc16;
+    info.mTlvMask = 0;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                                     = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    tlv.mData.mRoute.mRouteCount                  = 1;
+    tlv.mData.mRoute.mRouteData[0].mRouterId      = 1;
+    tlv.mData.mRoute.mRouteData[0].mRouteCost     = aRouteCost;
+    tlv.mData.mRoute.mRouteData[0].mLinkQualityIn = 3;
+    DiagStore::AppendTlv(info.mDiagContent, tlv);
+
+    return info;
+}
+
+TEST(Topology, TestVersions)
+{
+    Topology topology;
+
+    CHECK(topology.Update(MakeRouter(0x0400, 1)));
+    CHECK(topology.Update(MakeRouter(0x0800, 1)));
+    CHECK_EQUAL(2, topology.GetVersion());
+
+    // The same diagnostics do not change the topology.
+    CHECK_FALSE(topology.Update(MakeRouter(0x0400, 1)));
+    CHECK_EQUAL(2, topology.GetVersion());
+
+    // Each node records the version it last changed at.
+    CHECK(topology.Update(MakeRouter(0x0400, 2)));
+    CHECK_EQUAL(3, topology.begin()->mVersion);
+    CHECK_EQUAL(2, (topology.begin() + 1)->mVersion);
+    CHECK_EQUAL(2, topology.begin()->mRoutes[0].mRouteCost);
+
+    CHECK(topology.Remove(0x0800));
+    CHECK_FALSE(topology.Remove(0x0800));
+    CHECK((topology.begin() + 1)->mRemoved);
+    CHECK_EQUAL(4, (topology.begin() + 1)->mVersion);
+
+    CHECK(topology.HasChangesSince(0));
+    CHECK(topology.HasChangesSince(4));
+    CHECK_FALSE(topology.HasChangesSince(5));
+}
+
+TEST(Topology, TestPruneRemovedNodes)
+{
+    Topology topology;
+
+    for (uint16_t i = 0; i < 100; i++)
+    {
+        topology.Update(MakeRouter(i, 1));
+    }
+
+    for (uint16_t i = 0; i < 100; i++)
+    {
+        topology.Remove(i);
+    }
+
+    // Removals are forgotten from the oldest one, changes since then are no longer known.
+    CHECK_EQUAL(64, topology.end() - topology.begin());
+    CHECK_FALSE(topology.HasChangesSince(100));
+    CHECK(topology.HasChangesSince(136));
+}
@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/worker_pool.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/event_poller.hpp"
+
+static const int kJobNum = 64;
+
+static void Poll(void)
+{
+    otSysMainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 100000};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::EventPoller::Get().UpdateFdSet(mainloop);
+
+    CHECK(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                 &mainloop.mTimeout) >= 0);
+
+    otbr::EventPoller::Get().Process(mainloop);
+}
+
+TEST_GROUP(WorkerPool){};
+
+TEST(WorkerPool, TestPost)
+{
+    otbr::rest::WorkerPool &pool       = otbr::rest::WorkerPool::Get();
+    std::thread::id         mainThread = std::this_thread::get_id();
+    std::thread::id         workThreads[kJobNum];
+    int                     results[kJobNum];
+    int                     doneNum = 0;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, pool.Init(2));
+    CHECK(pool.IsEnabled());
+
+    for (int index = 0; index < kJobNum; index++)
+    {
+        results[index] = 0;
+        pool.Post(
+            [&workThreads, &results, index]() {
+                workThreads[index] = std::this_thread::get_id();
+                results[index]     = index * 2;
+            },
+            [&workThreads, &results, &doneNum, index, mainThread]() {
+                // The completion runs on the mainloop and sees the result of the work.
+                CHECK(std::this_thread::get_id() == mainThread);
+                CHECK(workThreads[index] != mainThread);
+                CHECK_EQUAL(index * 2, results[index]);
+                doneNum++;
+            });
+    }
+
+    for (int retry = 0; retry < 100 && doneNum < kJobNum; retry++)
+    {
+        Poll();
+    }
+
+    CHECK_EQUAL(kJobNum, doneNum);
+}
+
+TEST(WorkerPool, TestPostSmallBatchInline)
+{
+    otbr::rest::WorkerPool &pool       = otbr::rest::WorkerPool::Get();
+    std::thread::id         mainThread = std::this_thread::get_id();
+    std::thread::id         workThread;
+    int                     doneNum = 0;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, pool.Init(2));
+    CHECK_FALSE(pool.IsWorthPosting(OTBR_REST_WORKER_MIN_BATCH - 1));
+    CHECK_TRUE(pool.IsWorthPosting(OTBR_REST_WORKER_MIN_BATCH));
+
+    // A batch below the threshold is done before `Post()` returns, without a worker thread.
+    pool.Post([&workThread]() { workThread = std::this_thread::get_id(); },
+              [&doneNum, mainThread]() {
+                  CHECK(std::this_thread::get_id() == mainThread);
+                  doneNum++;
+              },
+              OTBR_REST_WORKER_MIN_BATCH - 1);
+    CHECK_EQUAL(1, doneNum);
+    CHECK(workThread == mainThread);
+
+    // A batch at the threshold goes to a worker thread, its completion runs from the mainloop.
+    pool.Post([&workThread]() { workThread = std::this_thread::get_id(); }, [&doneNum]() { doneNum++; },
+              OTBR_REST_WORKER_MIN_BATCH);
+
+    for (int retry = 0; retry < 100 && doneNum < 2; retry++)
+    {
+        Poll();
+    }
+
+    CHECK_EQUAL(2, doneNum);
+    CHECK(workThread != mainThread);
+}
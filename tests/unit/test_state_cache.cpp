@@ -0,0 +1,106 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "utils/state_cache.hpp"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::StateCache;
+
+TEST_GROUP(StateCache)
+{
+    // A unique file, so that concurrent runs don't share it.
+    char mPath[32];
+
+    void setup()
+    {
+        int fd;
+
+        strcpy(mPath, "/tmp/otbr-test-state-XXXXXX");
+        fd = mkstemp(mPath);
+        CHECK(fd >= 0);
+        close(fd);
+    }
+
+    void teardown()
+    {
+        StateCache::Get().Close();
+        unlink(mPath);
+    }
+};
+
+TEST(StateCache, TestRestore)
+{
+    StateCache &cache = StateCache::Get();
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, cache.Open(mPath));
+    CHECK(cache.Find(StateCache::kRecordNdProxy) == nullptr);
+
+    cache.Update(StateCache::kRecordNdProxy, {1, 2, 3});
+    cache.Update(StateCache::kRecordDiagnostics, std::vector<uint8_t>(1000, 0xa5));
+    cache.Close();
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, cache.Open(mPath));
+    CHECK(*cache.Find(StateCache::kRecordNdProxy) == std::vector<uint8_t>({1, 2, 3}));
+    CHECK_EQUAL(1000u, cache.Find(StateCache::kRecordDiagnostics)->size());
+
+    cache.Erase(StateCache::kRecordDiagnostics);
+    cache.Close();
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, cache.Open(mPath));
+    CHECK(cache.Find(StateCache::kRecordNdProxy) != nullptr);
+    CHECK(cache.Find(StateCache::kRecordDiagnostics) == nullptr);
+}
+
+TEST(StateCache, TestTornWrite)
+{
+    StateCache &cache = StateCache::Get();
+    int         fd;
+    uint8_t     garbage = 0xee;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, cache.Open(mPath));
+    cache.Update(StateCache::kRecordNdProxy, {1, 2, 3});
+    CHECK_EQUAL(OTBR_ERROR_NONE, cache.Flush());
+    cache.Update(StateCache::kRecordNdProxy, {4, 5, 6});
+    cache.Close();
+
+    // The second write went to the second slot, corrupting it falls back to the first write.
+    fd = open(mPath, O_RDWR);
+    CHECK(fd >= 0);
+    CHECK_EQUAL(1, pwrite(fd, &garbage, sizeof(garbage), OTBR_STATE_CACHE_SLOT_SIZE + 20));
+    close(fd);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, cache.Open(mPath));
+    CHECK(*cache.Find(StateCache::kRecordNdProxy) == std::vector<uint8_t>({1, 2, 3}));
+}
@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "agent/table_versions.hpp"
+
+using otbr::Ncp::TableVersions;
+
+static otChildInfo MakeChild(uint8_t aId, uint16_t aRloc16)
+{
+    otChildInfo child;
+
+    memset(&child, 0, sizeof(child));
+    child.mExtAddress.m8[7] = aId;
+    child.mRloc16           = aRloc16;
+    child.mChildId          = aRloc16 & 0x1ff;
+    child.mTimeout          = 240;
+    child.mRxOnWhenIdle     = true;
+
+    return child;
+}
+
+struct Snapshot
+{
+    std::vector<otChildInfo> mTable;
+    TableVersions            mVersions;
+};
+
+static void TakeSnapshot(const std::vector<otChildInfo> &aTable, const Snapshot *aPrevious, Snapshot &aSnapshot)
+{
+    aSnapshot.mTable = aTable;
+    aSnapshot.mVersions.Update(aSnapshot.mTable, aPrevious != nullptr ? &aPrevious->mTable : nullptr,
+                               aPrevious != nullptr ? &aPrevious->mVersions : nullptr);
+}
+
+TEST_GROUP(TableVersions){};
+
+TEST(TableVersions, TestLinkMetricsDoNotUpdate)
+{
+    Snapshot                 first;
+    Snapshot                 second;
+    Snapshot                 third;
+    TableVersions::Changes   changes;
+    std::vector<otChildInfo> table = {MakeChild(1, 0x1001), MakeChild(2, 0x1002)};
+
+    TakeSnapshot(table, nullptr, first);
+    CHECK_EQUAL(1, first.mVersions.mVersion);
+
+    first.mVersions.GetChanges(0, nullptr, changes);
+    CHECK(changes.mFull);
+    CHECK_EQUAL(2, changes.mAdded.size());
+    CHECK_EQUAL(0, changes.mUpdated.size());
+
+    // The link metrics change with each frame heard.
+    table[0].mAverageRssi      = -70;
+    table[0].mLastRssi         = -72;
+    table[0].mLinkQualityIn    = 2;
+    table[0].mFrameErrorRate   = 100;
+    table[0].mMessageErrorRate = 200;
+    table[0].mAge              = 3;
+    TakeSnapshot(table, &first, second);
+    CHECK_EQUAL(1, second.mVersions.mVersion);
+
+    second.mVersions.GetChanges(1, nullptr, changes);
+    CHECK(!changes.mFull);
+    CHECK_EQUAL(0, changes.mAdded.size());
+    CHECK_EQUAL(0, changes.mUpdated.size());
+
+    // A child of another parent router, or of another mode, is updated.
+    table[1].mRloc16       = 0x2002;
+    table[1].mRxOnWhenIdle = false;
+    TakeSnapshot(table, &second, third);
+    CHECK_EQUAL(2, third.mVersions.mVersion);
+
+    third.mVersions.GetChanges(1, nullptr, changes);
+    CHECK(!changes.mFull);
+    CHECK_EQUAL(0, changes.mAdded.size());
+    CHECK_EQUAL(1, changes.mUpdated.size());
+    CHECK_EQUAL(1, changes.mUpdated[0]);
+}
+
+TEST(TableVersions, TestRemovals)
+{
+    Snapshot                 first;
+    Snapshot                 second;
+    Snapshot                 third;
+    TableVersions::Changes   changes;
+    std::vector<otChildInfo> table = {MakeChild(1, 0x1001), MakeChild(2, 0x1002)};
+
+    TakeSnapshot(table, nullptr, first);
+    table.erase(table.begin());
+    TakeSnapshot(table, &first, second);
+    CHECK_EQUAL(2, second.mVersions.mVersion);
+
+    second.mVersions.GetChanges(1, nullptr, changes);
+    CHECK_EQUAL(0, changes.mAdded.size());
+    CHECK_EQUAL(1, changes.mRemoved.size());
+    CHECK_EQUAL(1, second.mVersions.mRemovals[changes.mRemoved[0]].mExtAddress.m8[7]);
+
+    // The full table has no removals.
+    second.mVersions.GetChanges(0, nullptr, changes);
+    CHECK(changes.mFull);
+    CHECK_EQUAL(1, changes.mAdded.size());
+    CHECK_EQUAL(0, changes.mRemoved.size());
+
+    // An entry added again is no longer removed.
+    table.push_back(MakeChild(1, 0x1001));
+    TakeSnapshot(table, &second, third);
+    CHECK_EQUAL(3, third.mVersions.mVersion);
+    CHECK_EQUAL(0, third.mVersions.mRemovals.size());
+
+    third.mVersions.GetChanges(2, nullptr, changes);
+    CHECK_EQUAL(1, changes.mAdded.size());
+    CHECK_EQUAL(1, changes.mAdded[0]);
+    CHECK_EQUAL(0, changes.mRemoved.size());
+
+    // A version not known yet gets the full table.
+    third.mVersions.GetChanges(4, nullptr, changes);
+    CHECK(changes.mFull);
+    CHECK_EQUAL(2, changes.mAdded.size());
+}
+
+TEST(TableVersions, TestPage)
+{
+    Snapshot                 first;
+    TableVersions::Changes   changes;
+    std::vector<otChildInfo> table = {MakeChild(1, 0x1001), MakeChild(2, 0x1002), MakeChild(3, 0x1003)};
+    std::vector<size_t>      page  = {2, 0};
+
+    TakeSnapshot(table, nullptr, first);
+
+    first.mVersions.GetChanges(0, &page, changes);
+    CHECK_EQUAL(2, changes.mAdded.size());
+    CHECK_EQUAL(2, changes.mAdded[0]);
+    CHECK_EQUAL(0, changes.mAdded[1]);
+}
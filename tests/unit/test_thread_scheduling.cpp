@@ -0,0 +1,110 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/thread_scheduling.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <string>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(ThreadScheduling){};
+
+TEST(ThreadScheduling, TestParseCpuList)
+{
+    cpu_set_t cpus;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::ParseCpuList("0,2-3,7", cpus));
+    CHECK_EQUAL(4, CPU_COUNT(&cpus));
+    CHECK_TRUE(CPU_ISSET(0, &cpus));
+    CHECK_TRUE(CPU_ISSET(2, &cpus));
+    CHECK_TRUE(CPU_ISSET(3, &cpus));
+    CHECK_TRUE(CPU_ISSET(7, &cpus));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::ParseCpuList("5", cpus));
+    CHECK_EQUAL(1, CPU_COUNT(&cpus));
+    CHECK_TRUE(CPU_ISSET(5, &cpus));
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("1,", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList(",1", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("3-1", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("1-", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("-1", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("1 2", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("a", cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList(std::to_string(CPU_SETSIZE).c_str(), cpus));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseCpuList("99999999999999999999", cpus));
+}
+
+TEST(ThreadScheduling, TestParseFifoPriority)
+{
+    int priority = 0;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::ParseFifoPriority("10", priority));
+    CHECK_EQUAL(10, priority);
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                otbr::ParseFifoPriority(std::to_string(sched_get_priority_max(SCHED_FIFO)).c_str(), priority));
+
+    priority = 10;
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseFifoPriority("", priority));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseFifoPriority("0", priority));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseFifoPriority("-1", priority));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseFifoPriority(" 5", priority));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseFifoPriority("5x", priority));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS,
+                otbr::ParseFifoPriority(std::to_string(sched_get_priority_max(SCHED_FIFO) + 1).c_str(), priority));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::ParseFifoPriority("99999999999999999999", priority));
+    CHECK_EQUAL(10, priority);
+}
+
+TEST(ThreadScheduling, TestApplyManagementScheduling)
+{
+    cpu_set_t              saved;
+    cpu_set_t              current;
+    otbr::ThreadScheduling radio;
+    int                    cpu;
+
+    CHECK_EQUAL(0, pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved));
+    otbr::SaveManagementScheduling();
+
+    // The mainloop is moved to one of the CPUs, the helper threads get all of them back.
+    for (cpu = 0; !CPU_ISSET(cpu, &saved); cpu++)
+    {
+    }
+    CPU_SET(cpu, &radio.mCpus);
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::ApplyThreadScheduling(radio));
+    CHECK_EQUAL(0, pthread_getaffinity_np(pthread_self(), sizeof(current), &current));
+    CHECK_EQUAL(1, CPU_COUNT(&current));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::ApplyManagementScheduling());
+    CHECK_EQUAL(0, pthread_getaffinity_np(pthread_self(), sizeof(current), &current));
+    CHECK_TRUE(CPU_EQUAL(&saved, &current));
+}
@@ -0,0 +1,215 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "common/timer.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using std::chrono::microseconds;
+using std::chrono::seconds;
+
+static std::vector<int> sFired;
+
+static void HandleTimer(otbr::Timer &aTimer, void *aContext)
+{
+    (void)aTimer;
+
+    sFired.push_back(*static_cast<int *>(aContext));
+}
+
+TEST_GROUP(Timer)
+{
+    void setup() { sFired.clear(); }
+};
+
+TEST(Timer, TestFireInOrder)
+{
+    auto        now        = otbr::Timer::Clock::now();
+    int         contexts[] = {0, 1, 2, 3};
+    otbr::Timer timer0(HandleTimer, &contexts[0]);
+    otbr::Timer timer1(HandleTimer, &contexts[1]);
+    otbr::Timer timer2(HandleTimer, &contexts[2]);
+    otbr::Timer timer3(HandleTimer, &contexts[3]);
+
+    timer2.StartAt(now - microseconds(100));
+    timer0.StartAt(now - microseconds(300));
+    timer3.StartAt(now + seconds(10));
+    timer1.StartAt(now - microseconds(200));
+
+    otbr::TimerScheduler::Get().Process();
+
+    CHECK_EQUAL(3, static_cast<int>(sFired.size()));
+    CHECK_EQUAL(0, sFired[0]);
+    CHECK_EQUAL(1, sFired[1]);
+    CHECK_EQUAL(2, sFired[2]);
+    CHECK_FALSE(timer0.IsRunning());
+    CHECK_TRUE(timer3.IsRunning());
+}
+
+TEST(Timer, TestStopAndRestart)
+{
+    auto        now        = otbr::Timer::Clock::now();
+    int         contexts[] = {0, 1};
+    otbr::Timer timer0(HandleTimer, &contexts[0]);
+    otbr::Timer timer1(HandleTimer, &contexts[1]);
+
+    timer0.StartAt(now - microseconds(100));
+    timer1.StartAt(now - microseconds(200));
+    timer1.Stop();
+    CHECK_FALSE(timer1.IsRunning());
+
+    otbr::TimerScheduler::Get().Process();
+    CHECK_EQUAL(1, static_cast<int>(sFired.size()));
+    CHECK_EQUAL(0, sFired[0]);
+
+    timer1.StartAt(now + seconds(10));
+    timer1.StartAt(now - microseconds(100));
+    otbr::TimerScheduler::Get().Process();
+    CHECK_EQUAL(2, static_cast<int>(sFired.size()));
+    CHECK_EQUAL(1, sFired[1]);
+}
+
+static void HandleRestartTimer(otbr::Timer &aTimer, void *aContext)
+{
+    HandleTimer(aTimer, aContext);
+    aTimer.Start(microseconds(0));
+}
+
+TEST(Timer, TestRestartInHandler)
+{
+    int         contexts[] = {0, 1};
+    otbr::Timer timer0(HandleRestartTimer, &contexts[0]);
+    otbr::Timer timer1(HandleTimer, &contexts[1]);
+
+    // A timer restarted with no delay by its handler fires once per call, instead of spinning.
+    timer0.Start(microseconds(0));
+    otbr::TimerScheduler::Get().Process();
+    CHECK_EQUAL(1, static_cast<int>(sFired.size()));
+    CHECK_TRUE(timer0.IsRunning());
+
+    otbr::TimerScheduler::Get().Process();
+    CHECK_EQUAL(2, static_cast<int>(sFired.size()));
+
+    // The deferred timer is stopped like any other.
+    timer1.Start(seconds(10));
+    timer0.Stop();
+    CHECK_FALSE(timer0.IsRunning());
+    otbr::TimerScheduler::Get().Process();
+    CHECK_EQUAL(2, static_cast<int>(sFired.size()));
+    CHECK_TRUE(timer1.IsRunning());
+}
+
+TEST(Timer, TestUpdateTimeout)
+{
+    int         context = 0;
+    otbr::Timer timer(HandleTimer, &context);
+    timeval     timeout = {10, 0};
+
+    otbr::TimerScheduler::Get().UpdateTimeout(timeout);
+    CHECK_EQUAL(10, timeout.tv_sec);
+
+    timer.Start(seconds(2));
+    otbr::TimerScheduler::Get().UpdateTimeout(timeout);
+    CHECK(timeout.tv_sec <= 2);
+
+    timer.StartAt(otbr::Timer::Clock::now() - microseconds(1));
+    otbr::TimerScheduler::Get().UpdateTimeout(timeout);
+    CHECK_EQUAL(0, timeout.tv_sec);
+    CHECK_EQUAL(0, timeout.tv_usec);
+}
+
+TEST(Timer, TestPost)
+{
+    bool ran = false;
+
+    otbr::TimerScheduler::Get().Post(otbr::Timer::Clock::now(), [&ran]() { ran = true; });
+    otbr::TimerScheduler::Get().Process();
+
+    CHECK_TRUE(ran);
+}
+
+TEST(Timer, TestMainloopClock)
+{
+    bool sampled = false;
+    int  fired   = 0;
+
+    // The clock is sampled by the thread of a mainloop, not by this one.
+    std::thread mainloop([&sampled, &fired]() {
+        int                            context0 = 0;
+        int                            context1 = 1;
+        otbr::Timer                    timer0(HandleTimer, &context0);
+        otbr::Timer                    timer1(HandleTimer, &context1);
+        otbr::Timer::Clock::time_point now = otbr::MainloopClock::Update();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        sampled = (otbr::MainloopClock::Now() == now);
+
+        // The timer due later than the sampled time waits for the next sample.
+        timer0.StartAt(now);
+        timer1.StartAt(now + microseconds(1));
+        otbr::TimerScheduler::Get().Process();
+        fired = static_cast<int>(sFired.size());
+
+        // The coarse clock, built by the option check of the CI, advances by scheduler ticks.
+        while (otbr::MainloopClock::Update() <= now)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        otbr::TimerScheduler::Get().Process();
+    });
+
+    mainloop.join();
+    CHECK_TRUE(sampled);
+    CHECK_EQUAL(1, fired);
+    CHECK_EQUAL(2, static_cast<int>(sFired.size()));
+    CHECK_EQUAL(0, sFired[0]);
+    CHECK_EQUAL(1, sFired[1]);
+}
+
+TEST(Timer, TestMainloopClockReset)
+{
+    bool stale  = false;
+    bool recent = false;
+
+    std::thread mainloop([&stale, &recent]() {
+        otbr::Timer::Clock::time_point sampled = otbr::MainloopClock::Update();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        stale = (otbr::MainloopClock::Now() == sampled);
+
+        // Out of the mainloop, the clock is read each time.
+        otbr::MainloopClock::Reset();
+        recent = (otbr::MainloopClock::Now() >= sampled + std::chrono::milliseconds(2));
+    });
+
+    mainloop.join();
+    CHECK_TRUE(stale);
+    CHECK_TRUE(recent);
+}
@@ -0,0 +1,106 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <vector>
+
+#include "common/tlv.hpp"
+
+TEST_GROUP(Tlv){};
+
+TEST(Tlv, TestWriteAndIterate)
+{
+    uint8_t              buffer[400];
+    std::vector<uint8_t> large(300, 0xa5);
+    otbr::TlvWriter      writer(buffer, sizeof(buffer));
+    size_t               count = 0;
+    otbr::TlvIterator    iterator;
+
+    CHECK(writer.Append(otbr::Meshcop::kState, static_cast<uint8_t>(otbr::Meshcop::kStateAccepted)));
+    CHECK(writer.Append(otbr::Meshcop::kCommissionerSessionId, static_cast<uint16_t>(0x1234)));
+    CHECK(writer.Append(otbr::Meshcop::kSteeringData, large.data(), static_cast<uint16_t>(large.size())));
+    CHECK_EQUAL(3 + 4 + 4 + large.size(), writer.GetLength());
+
+    for (const otbr::Tlv &tlv : otbr::TlvIterator(buffer, writer.GetLength()))
+    {
+        switch (count++)
+        {
+        case 0:
+            CHECK_EQUAL(otbr::Meshcop::kState, tlv.GetType());
+            CHECK_EQUAL(otbr::Meshcop::kStateAccepted, tlv.GetValueUInt8());
+            break;
+        case 1:
+            CHECK_EQUAL(0x1234, tlv.GetValueUInt16());
+            break;
+        default:
+            CHECK_EQUAL(large.size(), tlv.GetLength());
+            CHECK(memcmp(tlv.GetValue(), large.data(), large.size()) == 0);
+            break;
+        }
+    }
+    CHECK_EQUAL(3, count);
+
+    iterator = otbr::TlvIterator(buffer, writer.GetLength());
+    ++iterator;
+    CHECK(otbr::TlvIterator::Find(buffer, writer.GetLength(), otbr::Meshcop::kCommissionerSessionId) == &*iterator);
+    CHECK(otbr::TlvIterator::Find(buffer, writer.GetLength(), otbr::Meshcop::kJoinerIid) == nullptr);
+
+    // The last Tlv is cut short.
+    iterator = otbr::TlvIterator(buffer, writer.GetLength() - 1);
+    ++iterator;
+    ++iterator;
+    CHECK(iterator == otbr::TlvIterator());
+    CHECK(iterator.IsTruncated());
+}
+
+TEST(Tlv, TestTruncatedHeaders)
+{
+    const uint8_t     extended[] = {otbr::Meshcop::kSteeringData, otbr::Tlv::kLengthEscape, 0x00};
+    const uint8_t     single[]   = {otbr::Meshcop::kState};
+    otbr::TlvIterator iterator(extended, sizeof(extended));
+
+    CHECK(iterator == otbr::TlvIterator());
+    CHECK(iterator.IsTruncated());
+    CHECK(otbr::TlvIterator(single, sizeof(single)).IsTruncated());
+    CHECK(!otbr::TlvIterator(single, 0).IsTruncated());
+}
+
+TEST(Tlv, TestWriterOverflow)
+{
+    uint8_t         buffer[6];
+    otbr::TlvWriter writer(buffer, sizeof(buffer));
+    uint8_t *       value;
+
+    value = writer.Reserve(otbr::Meshcop::kJoinerIid, 2);
+    CHECK(value == buffer + 2);
+    CHECK(!writer.Append(otbr::Meshcop::kJoinerUdpPort, static_cast<uint16_t>(1000)));
+    CHECK(writer.IsOverflowed());
+    CHECK(!writer.Append(otbr::Meshcop::kState, static_cast<uint8_t>(0)));
+    CHECK_EQUAL(4, writer.GetLength());
+}
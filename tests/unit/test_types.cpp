@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <arpa/inet.h>
+#include <string.h>
+
+#include "common/types.hpp"
+
+static const char *const kAddresses[] = {
+    "::",
+    "::1",
+    "1::",
+    "fe80::1",
+    "fd11:22::1a2b:3c4d:5e6f:7788",
+    "1:0:0:2::3",
+    "1::2:0:0:3",
+    "2001:db8:0:1:1:1:1:1",
+    "::ffff:192.168.1.10",
+    "::1.2.3.4",
+    "ff02::1:ff00:0",
+    "ABCD:EF01:2345:6789:abcd:ef01:2345:6789",
+    "0:0:0:0:0:0:0:0",
+    "1:2:3:4:5:6:1.2.3.4",
+};
+
+static const char *const kInvalidAddresses[] = {
+    "",
+    ":",
+    ":::",
+    "1:::2",
+    "1::2::3",
+    ":1::",
+    "1:",
+    "12345::",
+    "1.2.3.4",
+    "::1.2.3",
+    "::1.2.3.04",
+    "::256.0.0.1",
+    "1:2:3:4:5:6:7:8:9",
+    "1:2:3:4:5:6:7::8",
+    "1:2:3:4:5:6:7:1.2.3.4",
+    "::g",
+    "fe80::1%lo0",
+};
+
+TEST_GROUP(Ip6Address){};
+
+TEST(Ip6Address, TestToStringMatchesInetNtop)
+{
+    for (const char *text : kAddresses)
+    {
+        otbr::Ip6Address address;
+        char             expected[INET6_ADDRSTRLEN];
+        char             buffer[otbr::Ip6Address::kStringSize];
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(text, address));
+        CHECK(inet_ntop(AF_INET6, address.m8, expected, sizeof(expected)) != nullptr);
+
+        CHECK_EQUAL(strlen(expected), address.ToString(buffer));
+        STRCMP_EQUAL(expected, buffer);
+        STRCMP_EQUAL(expected, address.ToString().c_str());
+    }
+}
+
+TEST(Ip6Address, TestFromStringMatchesInetPton)
+{
+    for (const char *text : kAddresses)
+    {
+        otbr::Ip6Address address;
+        uint8_t          expected[sizeof(address.m8)];
+
+        CHECK_EQUAL(1, inet_pton(AF_INET6, text, expected));
+        CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(text, address));
+        MEMCMP_EQUAL(expected, address.m8, sizeof(expected));
+    }
+
+    for (const char *text : kInvalidAddresses)
+    {
+        otbr::Ip6Address address;
+        uint8_t          expected[sizeof(address.m8)];
+
+        CHECK_EQUAL(0, inet_pton(AF_INET6, text, expected));
+        CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::Ip6Address::FromString(text, address));
+    }
+}
+
+TEST(Ip6Address, TestFromStringWithLength)
+{
+    const char       text[] = "fe80::1/64";
+    size_t           length = static_cast<size_t>(strchr(text, '/') - text);
+    otbr::Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::Ip6Address::FromString(text, address));
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(text, length, address));
+    STRCMP_EQUAL("fe80::1", address.ToString().c_str());
+}
+
+static otbr::Ip6Address ToAddress(const char *aText)
+{
+    otbr::Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(aText, address));
+
+    return address;
+}
+
+TEST_GROUP(Ip6Prefix){};
+
+TEST(Ip6Prefix, TestContainsAddress)
+{
+    otbr::Ip6Prefix prefix;
+
+    prefix.mPrefix = ToAddress("fd00:db8:0:1::");
+    prefix.mLength = 64;
+    CHECK_TRUE(prefix.ContainsAddress(ToAddress("fd00:db8:0:1::1")));
+    CHECK(!prefix.ContainsAddress(ToAddress("fd00:db8:0:2::1")));
+
+    // The bits after the length are ignored, also within a byte.
+    prefix.mLength = 62;
+    CHECK_TRUE(prefix.ContainsAddress(ToAddress("fd00:db8:0:2::1")));
+    CHECK(!prefix.ContainsAddress(ToAddress("fd00:db8:0:4::1")));
+
+    prefix.mLength = 0;
+    CHECK_TRUE(prefix.ContainsAddress(ToAddress("2001::1")));
+}
@@ -0,0 +1,92 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <string>
+
+#include <CppUTest/TestHarness.h>
+
+#include "web/web-service/status_push.hpp"
+
+using otbr::Web::StatusPush;
+
+static uint8_t GetByte(const std::string &aFrame, size_t aIndex)
+{
+    return static_cast<uint8_t>(aFrame[aIndex]);
+}
+
+TEST_GROUP(StatusPush){};
+
+TEST(StatusPush, TestComputeAcceptKey)
+{
+    // The example handshake of RFC 6455.
+    STRCMP_EQUAL("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=", StatusPush::ComputeAcceptKey("dGhlIHNhbXBsZSBub25jZQ==").c_str());
+    STRCMP_EQUAL("", StatusPush::ComputeAcceptKey("").c_str());
+}
+
+TEST(StatusPush, TestEncodeFrameLength)
+{
+    std::string frame;
+
+    // Up to 125 bytes, the length is in the header byte.
+    frame = StatusPush::EncodeFrame(StatusPush::kOpcodeText, std::string(125, 'x'));
+    CHECK_EQUAL(2 + 125, frame.size());
+    CHECK_EQUAL(0x81, GetByte(frame, 0));
+    CHECK_EQUAL(125, GetByte(frame, 1));
+    CHECK_EQUAL('x', frame[2]);
+
+    // Up to 65535 bytes, the length follows in 16 bits.
+    frame = StatusPush::EncodeFrame(StatusPush::kOpcodeText, std::string(126, 'x'));
+    CHECK_EQUAL(4 + 126, frame.size());
+    CHECK_EQUAL(126, GetByte(frame, 1));
+    CHECK_EQUAL(0x00, GetByte(frame, 2));
+    CHECK_EQUAL(126, GetByte(frame, 3));
+
+    frame = StatusPush::EncodeFrame(StatusPush::kOpcodeText, std::string(65535, 'x'));
+    CHECK_EQUAL(4 + 65535, frame.size());
+    CHECK_EQUAL(126, GetByte(frame, 1));
+    CHECK_EQUAL(0xff, GetByte(frame, 2));
+    CHECK_EQUAL(0xff, GetByte(frame, 3));
+
+    // Longer, the length follows in 64 bits.
+    frame = StatusPush::EncodeFrame(StatusPush::kOpcodeText, std::string(65536, 'x'));
+    CHECK_EQUAL(10 + 65536, frame.size());
+    CHECK_EQUAL(127, GetByte(frame, 1));
+    for (size_t index = 2; index < 10; index++)
+    {
+        CHECK_EQUAL(index == 7 ? 0x01 : 0x00, GetByte(frame, index));
+    }
+    CHECK_EQUAL('x', frame[10]);
+}
+
+TEST(StatusPush, TestEncodeFrameOpcode)
+{
+    std::string frame = StatusPush::EncodeFrame(StatusPush::kOpcodeClose, "");
+
+    CHECK_EQUAL(2, frame.size());
+    CHECK_EQUAL(0x88, GetByte(frame, 0));
+    CHECK_EQUAL(0, GetByte(frame, 1));
+}
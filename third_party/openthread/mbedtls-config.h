@@ -48,6 +48,10 @@
 #define MBEDTLS_SSL_EXPORT_KEYS
 
 #define MBEDTLS_AES_C
+// AES-NI is used when the CPU supports it, which speeds up the PSKc derivation.
+#if defined(MBEDTLS_HAVE_ASM) && defined(__x86_64__)
+#define MBEDTLS_AESNI_C
+#endif
 #define MBEDTLS_ASN1_PARSE_C
 #define MBEDTLS_ASN1_WRITE_C
 #define MBEDTLS_BIGNUM_C
@@ -70,6 +74,28 @@
 #define MBEDTLS_SSL_SRV_C
 #define MBEDTLS_SSL_TLS_C
 
+#if OTBR_ENABLE_REST_TLS
+// HTTPS of the REST server, with an ECDSA certificate and session resumption.
+#define MBEDTLS_BASE64_C
+#define MBEDTLS_ECDH_C
+#define MBEDTLS_ECDSA_C
+#define MBEDTLS_FS_IO
+#define MBEDTLS_GCM_C
+#define MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
+#define MBEDTLS_PEM_PARSE_C
+#define MBEDTLS_SSL_CACHE_C
+#define MBEDTLS_SSL_SESSION_TICKETS
+#define MBEDTLS_SSL_TICKET_C
+#define MBEDTLS_X509_CRT_PARSE_C
+#define MBEDTLS_X509_USE_C
+#endif
+
+#if OTBR_ENABLE_WEB_SERVICE
+// The accept key of the WebSocket handshake of the web service.
+#define MBEDTLS_BASE64_C
+#define MBEDTLS_SHA1_C
+#endif
+
 #define MBEDTLS_NET_C
 #define MBEDTLS_TIMING_C
 
@@ -79,7 +105,20 @@
 #define MBEDTLS_MPI_MAX_SIZE 32
 #define MBEDTLS_SSL_MAX_CONTENT_LEN 900
 
+#if OTBR_ENABLE_REST_TLS
+// HTTP clients send records of the full size, the responses are sent in smaller records.
+#define MBEDTLS_SSL_IN_CONTENT_LEN 16384
+#define MBEDTLS_SSL_OUT_CONTENT_LEN 4096
+#define MBEDTLS_SSL_CIPHERSUITES \
+    MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8, MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256
+#else
 #define MBEDTLS_SSL_CIPHERSUITES MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8
+#endif
+
+// A platform header may enable the alternative implementations of its crypto accelerator, e.g. MBEDTLS_AES_ALT.
+#ifdef OTBR_MBEDTLS_USER_CONFIG_FILE
+#include OTBR_MBEDTLS_USER_CONFIG_FILE
+#endif
 
 #include "mbedtls/check_config.h"
 
@@ -0,0 +1,343 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a tool to replay the d-bus method calls captured by otbr-agent.
+ */
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/server/dbus_capture.hpp"
+
+using std::chrono::steady_clock;
+
+namespace {
+
+const int kReplyTimeout = 30000; // The timeout of each method call in milliseconds.
+
+struct Call
+{
+    uint64_t     mTimestamp;
+    uint32_t     mLatency;
+    DBusMessage *mMessage;
+};
+
+struct Stats
+{
+    Stats(void)
+        : mErrors(0)
+    {
+    }
+
+    std::vector<uint64_t> mRecorded;
+    std::vector<uint64_t> mReplayed;
+    uint64_t              mErrors;
+};
+
+struct PendingContext
+{
+    Stats *                  mStats;
+    steady_clock::time_point mStart;
+    size_t *                 mOutstanding;
+};
+
+void help(void)
+{
+    printf("dbus-replay - replay the d-bus method calls captured by otbr-agent\n"
+           "SYNTAX:\n"
+           "    dbus-replay [-I <THREAD_IFNAME>] [--speed <FACTOR>] <CAPTURE_FILE>\n"
+           "OPTIONS:\n"
+           "    -I, --thread-ifname  Thread interface of the agent the calls are sent to, wpan0 by default.\n"
+           "    -s, --speed          Factor of the recorded pacing, 2 to send twice as fast, 0 to send at once.\n"
+           "EXAMPLE:\n"
+           "    otbr-agent --dbus-capture-file /tmp/otbr-agent.dbus ...\n"
+           "    dbus-replay --speed 4 /tmp/otbr-agent.dbus\n");
+}
+
+std::string memberName(DBusMessage *aMessage)
+{
+    const char *interface = dbus_message_get_interface(aMessage);
+    const char *member    = dbus_message_get_member(aMessage);
+
+    return std::string(interface != nullptr ? interface : "") + "." + (member != nullptr ? member : "");
+}
+
+uint64_t percentile(const std::vector<uint64_t> &aSorted, double aFraction)
+{
+    size_t index;
+
+    VerifyOrExit(!aSorted.empty());
+    index = static_cast<size_t>(aFraction * static_cast<double>(aSorted.size() - 1) + 0.5);
+
+exit:
+    return aSorted.empty() ? 0 : aSorted[std::min(index, aSorted.size() - 1)];
+}
+
+void printRow(const std::string &aName, Stats &aStats)
+{
+    std::sort(aStats.mRecorded.begin(), aStats.mRecorded.end());
+    std::sort(aStats.mReplayed.begin(), aStats.mReplayed.end());
+
+    printf("%-56s %7zu %10.2f %10.2f %10.2f %10.2f %10.2f %7" PRIu64 "\n", aName.c_str(), aStats.mRecorded.size(),
+           percentile(aStats.mRecorded, 0.5) / 1000.0, percentile(aStats.mRecorded, 0.99) / 1000.0,
+           percentile(aStats.mReplayed, 0.5) / 1000.0, percentile(aStats.mReplayed, 0.99) / 1000.0,
+           (aStats.mReplayed.empty() ? 0 : aStats.mReplayed.back()) / 1000.0, aStats.mErrors);
+}
+
+void handleReply(DBusPendingCall *aPending, void *aContext)
+{
+    PendingContext *context = static_cast<PendingContext *>(aContext);
+    DBusMessage *   reply   = dbus_pending_call_steal_reply(aPending);
+
+    context->mStats->mReplayed.push_back(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - context->mStart).count()));
+
+    if (reply == nullptr || dbus_message_get_type(reply) == DBUS_MESSAGE_TYPE_ERROR)
+    {
+        context->mStats->mErrors++;
+    }
+
+    --*context->mOutstanding;
+
+    if (reply != nullptr)
+    {
+        dbus_message_unref(reply);
+    }
+    dbus_pending_call_unref(aPending);
+}
+
+void freeContext(void *aContext)
+{
+    delete static_cast<PendingContext *>(aContext);
+}
+
+int readCapture(const char *aPath, std::vector<Call> &aCalls)
+{
+    int                   ret  = EX_DATAERR;
+    FILE *                file = fopen(aPath, "rb");
+    otbrDBusCaptureHeader header;
+    otbrDBusCaptureRecord record;
+    std::vector<char>     buffer;
+    long                  size;
+
+    VerifyOrExit(file != nullptr, perror(aPath), ret = EX_NOINPUT);
+    VerifyOrExit(fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0,
+                 perror(aPath), ret = EX_IOERR);
+    VerifyOrExit(fread(&header, sizeof(header), 1, file) == 1, printf("The capture file is truncated.\n"));
+    VerifyOrExit(memcmp(header.mMagic, OTBR_DBUS_CAPTURE_MAGIC, sizeof(OTBR_DBUS_CAPTURE_MAGIC)) == 0,
+                 printf("The file is not a d-bus capture file.\n"));
+    VerifyOrExit(header.mVersion == OTBR_DBUS_CAPTURE_VERSION,
+                 printf("The capture file version %" PRIu32 " is not supported.\n", header.mVersion));
+
+    // The last record is dropped if the agent stopped while writing it.
+    while (fread(&record, sizeof(record), 1, file) == 1)
+    {
+        Call call;
+
+        // The length is checked against the rest of the file before allocating the message.
+        VerifyOrExit(record.mLength <= static_cast<unsigned long>(size - ftell(file)),
+                     printf("Ignoring the truncated record %zu.\n", aCalls.size()), ret = 0);
+        buffer.resize(record.mLength);
+        VerifyOrExit(record.mLength == 0 || fread(&buffer[0], 1, buffer.size(), file) == buffer.size(),
+                     printf("Ignoring the truncated record %zu.\n", aCalls.size()), ret = 0);
+
+        call.mTimestamp = record.mTimestamp;
+        call.mLatency   = record.mLatency;
+        call.mMessage   = dbus_message_demarshal(buffer.data(), static_cast<int>(buffer.size()), nullptr);
+        VerifyOrExit(call.mMessage != nullptr, printf("The record %zu is not a d-bus message.\n", aCalls.size()));
+
+        aCalls.push_back(call);
+    }
+
+    ret = 0;
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    return ret;
+}
+
+int replay(const std::vector<Call> &aCalls, const std::string &aServerName, double aSpeed)
+{
+    int                          ret = EX_UNAVAILABLE;
+    DBusError                    error;
+    DBusConnection *             connection;
+    std::map<std::string, Stats> stats;
+    Stats                        total;
+    size_t                       outstanding = 0;
+    steady_clock::time_point     start;
+    steady_clock::time_point     deadline;
+
+    dbus_error_init(&error);
+    connection = dbus_bus_get(DBUS_BUS_SYSTEM, &error);
+    VerifyOrExit(connection != nullptr, printf("Failed to connect to the system bus: %s\n", error.message));
+
+    start = steady_clock::now();
+    for (const Call &call : aCalls)
+    {
+        std::string      name  = memberName(call.mMessage);
+        Stats &          entry = stats[name];
+        DBusMessage *    message;
+        DBusPendingCall *pending = nullptr;
+
+        if (aSpeed > 0)
+        {
+            // The timestamps are in real time, a call recorded before the first one is sent at once.
+            uint64_t first   = aCalls.front().mTimestamp;
+            uint64_t elapsed = call.mTimestamp > first ? call.mTimestamp - first : 0;
+            auto     offset  = std::chrono::microseconds(static_cast<int64_t>(static_cast<double>(elapsed) / aSpeed));
+
+            // Replies are handled while waiting for the recorded time of the call.
+            while (steady_clock::now() < start + offset)
+            {
+                auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(start + offset - steady_clock::now());
+
+                dbus_connection_read_write_dispatch(connection, static_cast<int>(wait.count()));
+            }
+        }
+
+        // The copy has no serial, so that the connection assigns a new one.
+        message = dbus_message_copy(call.mMessage);
+        VerifyOrExit(message != nullptr, ret = EX_OSERR);
+        dbus_message_set_destination(message, aServerName.c_str());
+        entry.mRecorded.push_back(call.mLatency);
+
+        if (dbus_message_get_no_reply(message))
+        {
+            dbus_connection_send(connection, message, nullptr);
+        }
+        else if (dbus_connection_send_with_reply(connection, message, &pending, kReplyTimeout) && pending != nullptr)
+        {
+            dbus_pending_call_set_notify(pending, handleReply,
+                                         new PendingContext{&entry, steady_clock::now(), &outstanding}, freeContext);
+            outstanding++;
+        }
+        else
+        {
+            entry.mErrors++;
+        }
+        dbus_message_unref(message);
+    }
+
+    deadline = steady_clock::now() + std::chrono::milliseconds(kReplyTimeout);
+    while (outstanding > 0 && steady_clock::now() < deadline)
+    {
+        dbus_connection_read_write_dispatch(connection, 100);
+    }
+
+    printf("calls %zu duration %.1fs speed %g\n", aCalls.size(),
+           std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start).count() / 1000.0,
+           aSpeed);
+    printf("%-56s %7s %10s %10s %10s %10s %10s %7s\n", "method", "calls", "rec-p50", "rec-p99", "p50(ms)", "p99(ms)",
+           "max(ms)", "errors");
+    for (auto &entry : stats)
+    {
+        printRow(entry.first, entry.second);
+        total.mRecorded.insert(total.mRecorded.end(), entry.second.mRecorded.begin(), entry.second.mRecorded.end());
+        total.mReplayed.insert(total.mReplayed.end(), entry.second.mReplayed.begin(), entry.second.mReplayed.end());
+        total.mErrors += entry.second.mErrors;
+    }
+    total.mErrors += outstanding;
+    printRow("total", total);
+
+    ret = total.mErrors == 0 ? 0 : EX_SOFTWARE;
+
+exit:
+    if (connection != nullptr)
+    {
+        dbus_connection_unref(connection);
+    }
+    dbus_error_free(&error);
+    return ret;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    static const struct option kOptions[] = {{"thread-ifname", required_argument, nullptr, 'I'},
+                                             {"speed", required_argument, nullptr, 's'},
+                                             {"help", no_argument, nullptr, 'h'},
+                                             {0, 0, 0, 0}};
+
+    int               ret           = 0;
+    const char *      interfaceName = "wpan0";
+    double            speed         = 1;
+    int               opt;
+    std::vector<Call> calls;
+
+    while ((opt = getopt_long(argc, argv, "I:s:h", kOptions, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'I':
+            interfaceName = optarg;
+            break;
+
+        case 's':
+            speed = atof(optarg);
+            VerifyOrExit(speed >= 0, help(), ret = EX_USAGE);
+            break;
+
+        default:
+            help();
+            ExitNow(ret = (opt == 'h' ? 0 : EX_USAGE));
+            break;
+        }
+    }
+
+    VerifyOrExit(optind + 1 == argc, help(), ret = EX_USAGE);
+    SuccessOrExit(ret = readCapture(argv[optind], calls));
+    VerifyOrExit(!calls.empty(), printf("The capture file has no method call.\n"), ret = EX_DATAERR);
+    ret = replay(calls, OTBR_DBUS_SERVER_PREFIX + std::string(interfaceName), speed);
+
+exit:
+    for (const Call &call : calls)
+    {
+        dbus_message_unref(call.mMessage);
+    }
+    return ret;
+}
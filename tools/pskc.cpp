@@ -31,7 +31,14 @@
  *   This file implements a simple tool to compute pskc.
  */
 
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <sysexits.h>
 
 #include "common/code_utils.hpp"
@@ -48,43 +55,75 @@ enum
     kSizeExtPanId   = 8,
 };
 
+/**
+ * This structure represents one line of a batch.
+ *
+ */
+struct BatchEntry
+{
+    std::string mPassphrase;
+    std::string mExtPanId;
+    std::string mNetworkName;
+    uint8_t     mExtPanIdBytes[kSizeExtPanId];
+    uint8_t     mPskc[OT_PSKC_LENGTH];
+};
+
 void help(void)
 {
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc --batch [--threads <COUNT>] [FILE]\n"
+           "BATCH:\n"
+           "    Reads lines of <PASSPHRASE>,<EXTPANID>,<NETWORK_NAME> from FILE or stdin, the network name is\n"
+           "    the rest of the line after the second comma. Empty lines and lines starting with # are skipped.\n"
+           "    Prints <EXTPANID>,<NETWORK_NAME>,<PSKC> for each line in input order and the throughput to\n"
+           "    stderr. COUNT defaults to the number of CPUs.\n"
            "EXAMPLE:\n"
-           "    pskc 654321 1122334455667788 OpenThread\n");
+           "    pskc 654321 1122334455667788 OpenThread\n"
+           "    pskc --batch --threads 4 networks.csv\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+bool parseInput(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName, uint8_t *aExtPanIdBytes)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
-
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t * pskc;
+    size_t length;
+    bool   ret = false;
 
     length = strlen(aPassphrase);
-    VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
+    VerifyOrExit(length > 0, fprintf(stderr, "PASSPHRASE must not be empty.\n"));
     VerifyOrExit(length <= kMaxPassphrase,
-                 printf("PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
+                 fprintf(stderr, "PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
 
     length = strlen(aExtPanId);
-    VerifyOrExit(length == kSizeExtPanId * 2, printf("EXTPANID length must be %d bytes.\n", kSizeExtPanId));
+    VerifyOrExit(length == kSizeExtPanId * 2, fprintf(stderr, "EXTPANID length must be %d bytes.\n", kSizeExtPanId));
     for (size_t i = 0; i < length; i++)
     {
         VerifyOrExit((aExtPanId[i] <= '9' && aExtPanId[i] >= '0') || (aExtPanId[i] <= 'f' && aExtPanId[i] >= 'a') ||
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
-                     printf("EXTPANID must be encoded in hex.\n"));
+                     fprintf(stderr, "EXTPANID must be encoded in hex.\n"));
     }
-    otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
+    otbr::Utils::Hex2Bytes(aExtPanId, aExtPanIdBytes, kSizeExtPanId);
 
     length = strlen(aNetworkName);
-    VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
+    VerifyOrExit(length > 0, fprintf(stderr, "NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
-                 printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
+                 fprintf(stderr, "NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+{
+    uint8_t extpanid[kSizeExtPanId];
+    int     ret = -1;
+
+    otbr::Psk::Pskc pskcComputer;
+    const uint8_t * pskc;
+
+    VerifyOrExit(parseInput(aPassphrase, aExtPanId, aNetworkName, extpanid));
 
     pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
     for (int i = 0; i < 16; i++)
@@ -98,10 +137,162 @@ exit:
     return ret;
 }
 
+int readBatch(FILE *aFile, std::vector<BatchEntry> &aEntries)
+{
+    char     line[kMaxPassphrase + kSizeExtPanId * 2 + kMaxNetworkName + 8];
+    unsigned lineNumber = 0;
+    int      ret        = 0;
+
+    while (fgets(line, sizeof(line), aFile) != nullptr)
+    {
+        size_t     length = strcspn(line, "\r\n");
+        char *     extPanId;
+        char *     networkName;
+        BatchEntry entry;
+
+        lineNumber++;
+
+        if (line[length] == '\0' && !feof(aFile))
+        {
+            fprintf(stderr, "line %u: too long\n", lineNumber);
+            ExitNow(ret = EX_DATAERR);
+        }
+
+        line[length] = '\0';
+
+        if (length == 0 || line[0] == '#')
+        {
+            continue;
+        }
+
+        extPanId    = strchr(line, ',');
+        networkName = (extPanId != nullptr ? strchr(extPanId + 1, ',') : nullptr);
+
+        if (networkName == nullptr)
+        {
+            fprintf(stderr, "line %u: expected <PASSPHRASE>,<EXTPANID>,<NETWORK_NAME>\n", lineNumber);
+            ExitNow(ret = EX_DATAERR);
+        }
+
+        *extPanId++    = '\0';
+        *networkName++ = '\0';
+
+        if (!parseInput(line, extPanId, networkName, entry.mExtPanIdBytes))
+        {
+            fprintf(stderr, "line %u: invalid input\n", lineNumber);
+            ExitNow(ret = EX_DATAERR);
+        }
+
+        entry.mPassphrase  = line;
+        entry.mExtPanId    = extPanId;
+        entry.mNetworkName = networkName;
+        aEntries.push_back(entry);
+    }
+
+    if (ferror(aFile))
+    {
+        perror("read");
+        ret = EX_IOERR;
+    }
+
+exit:
+    return ret;
+}
+
+void computeBatch(std::vector<BatchEntry> &aEntries, std::atomic<size_t> &aNext)
+{
+    otbr::Psk::Pskc pskcComputer;
+
+    for (size_t i = aNext++; i < aEntries.size(); i = aNext++)
+    {
+        BatchEntry &entry = aEntries[i];
+
+        memcpy(entry.mPskc,
+               pskcComputer.ComputePskc(entry.mExtPanIdBytes, entry.mNetworkName.c_str(), entry.mPassphrase.c_str()),
+               sizeof(entry.mPskc));
+    }
+}
+
+int runBatch(const char *aPath, unsigned aThreads)
+{
+    FILE *                   file = stdin;
+    std::vector<BatchEntry>  entries;
+    std::vector<std::thread> threads;
+    std::atomic<size_t>      next(0);
+    double                   seconds;
+    int                      ret;
+
+    if (aPath != nullptr)
+    {
+        file = fopen(aPath, "r");
+        VerifyOrExit(file != nullptr, perror(aPath), ret = EX_NOINPUT);
+    }
+
+    SuccessOrExit(ret = readBatch(file, entries));
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (unsigned i = 1; i < aThreads; i++)
+        {
+            threads.emplace_back(computeBatch, std::ref(entries), std::ref(next));
+        }
+
+        computeBatch(entries, next);
+
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    for (const BatchEntry &entry : entries)
+    {
+        printf("%s,%s,", entry.mExtPanId.c_str(), entry.mNetworkName.c_str());
+        for (uint8_t byte : entry.mPskc)
+        {
+            printf("%02x", byte);
+        }
+        printf("\n");
+    }
+
+    fprintf(stderr, "computed %zu PSKc in %.3f s with %u threads, %.1f PSKc/s\n", entries.size(), seconds, aThreads,
+            seconds > 0 ? entries.size() / seconds : 0.0);
+
+exit:
+    if (file != nullptr && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
     int ret = 0;
 
+    if (argc >= 2 && strcmp(argv[1], "--batch") == 0)
+    {
+        unsigned    threads = std::thread::hardware_concurrency();
+        const char *path    = nullptr;
+        int         i       = 2;
+
+        if (i + 1 < argc && strcmp(argv[i], "--threads") == 0)
+        {
+            threads = static_cast<unsigned>(atoi(argv[i + 1]));
+            VerifyOrExit(threads > 0, help(), ret = EX_USAGE);
+            i += 2;
+        }
+
+        VerifyOrExit(argc - i <= 1, help(), ret = EX_USAGE);
+        path = (i < argc ? argv[i] : nullptr);
+
+        ExitNow(ret = runBatch(path, (threads > 0 ? threads : 1)));
+    }
+
     VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
     ret = printPSKc(argv[1], argv[2], argv[3]);
 
@@ -31,6 +31,10 @@
  *   This file implements a simple tool to compute pskc.
  */
 
+#include <chrono>
+#include <thread>
+#include <vector>
+
 #include <mbedtls/sha256.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -45,10 +49,15 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data --batch [--threads <COUNT>] [LENGTH] [FILE]\n"
+           "BATCH:\n"
+           "    Reads one EUI64 per line from FILE or stdin, empty lines and lines starting with # are skipped.\n"
+           "    Prints the steering data and the throughput to stderr. COUNT defaults to the number of CPUs.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
-           "    steering-data 18b4300000000001 18b4300000000002\n");
+           "    steering-data 18b4300000000001 18b4300000000002\n"
+           "    steering-data --batch --threads 4 joiners.txt\n");
 }
 
 int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
@@ -70,6 +79,103 @@ exit:
     return ret;
 }
 
+int ReadEui64s(FILE *aFile, std::vector<otbr::SteeringData::Eui64> &aEui64s)
+{
+    char     line[64];
+    unsigned lineNumber = 0;
+    int      ret        = EX_OK;
+
+    while (fgets(line, sizeof(line), aFile) != nullptr)
+    {
+        size_t                    length = strcspn(line, "\r\n");
+        otbr::SteeringData::Eui64 eui64;
+
+        lineNumber++;
+        line[length] = '\0';
+
+        if (length == 0 || line[0] == '#')
+        {
+            continue;
+        }
+
+        VerifyOrExit(length == otbr::SteeringData::kSizeEui64 * 2 &&
+                         otbr::Utils::Hex2Bytes(line, eui64.data(), eui64.size()) == eui64.size(),
+                     fprintf(stderr, "line %u: invalid EUI64: %s\n", lineNumber, line), ret = EX_DATAERR);
+        aEui64s.push_back(eui64);
+    }
+
+    if (ferror(aFile))
+    {
+        perror("read");
+        ret = EX_IOERR;
+    }
+
+exit:
+    return ret;
+}
+
+int RunBatch(int argc, char *argv[])
+{
+    otbr::SteeringData                     computer;
+    std::vector<otbr::SteeringData::Eui64> eui64s;
+    FILE *                                 file    = stdin;
+    unsigned                               threads = std::thread::hardware_concurrency();
+    int                                    length  = 16;
+    int                                    i       = 2;
+    int                                    ret     = EX_USAGE;
+
+    if (i + 1 < argc && strcmp(argv[i], "--threads") == 0)
+    {
+        threads = static_cast<unsigned>(atoi(argv[i + 1]));
+        VerifyOrExit(threads > 0, help());
+        i += 2;
+    }
+
+    if (i < argc && strlen(argv[i]) <= 2 && atoi(argv[i]) > 0)
+    {
+        length = atoi(argv[i]);
+        VerifyOrExit(length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
+                     fprintf(stderr, "Invalid bloom filter length: %d\n", length));
+        ++i;
+    }
+
+    VerifyOrExit(argc - i <= 1, help());
+
+    if (i < argc)
+    {
+        file = fopen(argv[i], "r");
+        VerifyOrExit(file != nullptr, perror(argv[i]), ret = EX_NOINPUT);
+    }
+
+    SuccessOrExit(ret = ReadEui64s(file, eui64s));
+
+    {
+        auto   start = std::chrono::steady_clock::now();
+        double seconds;
+
+        computer.Init(static_cast<uint8_t>(length));
+        computer.ComputeBloomFilter(eui64s, (threads > 0 ? threads : 1));
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (i = 0; i < length; i++)
+        {
+            printf("%02x", computer.GetBloomFilter()[i]);
+        }
+        printf("\n");
+
+        fprintf(stderr, "added %zu joiners in %.3f s with up to %u threads, %.1f joiners/s\n", eui64s.size(), seconds,
+                threads, seconds > 0 ? eui64s.size() / seconds : 0.0);
+    }
+
+exit:
+    if (file != nullptr && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
     otbr::SteeringData computer;
@@ -82,6 +188,11 @@ int main(int argc, char *argv[])
         ExitNow(help());
     }
 
+    if (strcmp(argv[1], "--batch") == 0)
+    {
+        ExitNow(ret = RunBatch(argc, argv));
+    }
+
     if (strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
     {
         length = atoi(argv[i]);
@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a tool to decode the binary trace of otbr-agent.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sysexits.h>
+#include <time.h>
+
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/trace.hpp"
+
+void help(void)
+{
+    printf("trace-decode - decode the binary trace of otbr-agent\n"
+           "SYNTAX:\n"
+           "    trace-decode <TRACE_FILE>\n"
+           "EXAMPLE:\n"
+           "    trace-decode /tmp/otbr-agent.trace\n");
+}
+
+const char *methodName(uint8_t aMethod)
+{
+    static const char *const kMethods[] = {"DELETE", "GET", "HEAD", "POST", "PUT", "UNKNOWN", "OPTIONS"};
+
+    return aMethod < sizeof(kMethods) / sizeof(kMethods[0]) ? kMethods[aMethod] : "UNKNOWN";
+}
+
+void printRecord(const otbrTraceRecord &aRecord)
+{
+    time_t    seconds = static_cast<time_t>(aRecord.mTimestamp / 1000000);
+    struct tm tm;
+    char      date[32];
+    uint16_t  length = aRecord.mLength < sizeof(aRecord.mData) ? aRecord.mLength : sizeof(aRecord.mData);
+
+    gmtime_r(&seconds, &tm);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", &tm);
+    printf("%s.%06" PRIu64 "Z ", date, aRecord.mTimestamp % 1000000);
+
+    switch (aRecord.mEvent)
+    {
+    case OTBR_TRACE_STATE_CHANGED:
+        printf("state-changed flags=0x%08" PRIx32 "\n", aRecord.mValue);
+        break;
+
+    case OTBR_TRACE_REST_REQUEST:
+        printf("rest-request %s %.*s status=%" PRIu32 "\n", methodName(aRecord.mValue & 0xff), length,
+               reinterpret_cast<const char *>(aRecord.mData), aRecord.mValue >> 8);
+        break;
+
+    case OTBR_TRACE_LOG_DROPPED:
+        printf("log-dropped count=%" PRIu32 "\n", aRecord.mValue);
+        break;
+
+    case OTBR_TRACE_NCP_RESET:
+        printf("ncp-reset duration=%" PRIu32 "ms\n", aRecord.mValue);
+        break;
+
+    case OTBR_TRACE_RESUME:
+    {
+        uint32_t phases[3] = {0, 0, 0};
+
+        memcpy(phases, aRecord.mData, length < sizeof(phases) ? length : sizeof(phases));
+        printf("resume role=%" PRIu32 " detached=%" PRIu32 "ms attached=%" PRIu32 "ms resumed=%" PRIu32 "ms\n",
+               aRecord.mValue, phases[0], phases[1], phases[2]);
+        break;
+    }
+
+    case OTBR_TRACE_MAINLOOP:
+    {
+        uint32_t data[2] = {0, 0};
+
+        memcpy(data, aRecord.mData, length < sizeof(data) ? length : sizeof(data));
+        printf("mainloop processing=%" PRIu32 "us waiting=%" PRIu32 "us select=%" PRId32 "\n", aRecord.mValue,
+               data[0], static_cast<int32_t>(data[1]));
+        break;
+    }
+
+    case OTBR_TRACE_DBUS_REQUEST:
+        printf("dbus-request %.*s latency=%" PRIu32 "us\n", length, reinterpret_cast<const char *>(aRecord.mData),
+               aRecord.mValue);
+        break;
+
+    default:
+        printf("event-%u value=0x%08" PRIx32 " data=", aRecord.mEvent, aRecord.mValue);
+        for (uint16_t i = 0; i < length; i++)
+        {
+            printf("%02x", aRecord.mData[i]);
+        }
+        printf("\n");
+        break;
+    }
+}
+
+int decodeTrace(const char *aPath)
+{
+    int                          ret  = EX_DATAERR;
+    FILE *                       file = fopen(aPath, "rb");
+    otbrTraceHeader              header;
+    std::vector<otbrTraceRecord> records;
+    uint64_t                     sequence;
+
+    VerifyOrExit(file != nullptr, perror(aPath), ret = EX_NOINPUT);
+    VerifyOrExit(fread(&header, sizeof(header), 1, file) == 1, printf("The trace file is truncated.\n"));
+    VerifyOrExit(memcmp(header.mMagic, OTBR_TRACE_MAGIC, sizeof(OTBR_TRACE_MAGIC)) == 0,
+                 printf("The file is not a trace file.\n"));
+    VerifyOrExit(header.mVersion == OTBR_TRACE_VERSION && header.mRecordSize == sizeof(otbrTraceRecord),
+                 printf("The trace file version %" PRIu32 " is not supported.\n", header.mVersion));
+
+    VerifyOrExit(header.mRecordCount > 0, printf("The trace file has no record.\n"));
+
+    records.resize(header.mRecordCount);
+    VerifyOrExit(fread(&records[0], sizeof(otbrTraceRecord), records.size(), file) == records.size(),
+                 printf("The trace file is truncated.\n"));
+
+    // Records are written in the order of their sequence, the oldest kept is one round before the next record.
+    sequence = header.mSequence > header.mRecordCount ? header.mSequence - header.mRecordCount : 0;
+    for (; sequence < header.mSequence; sequence++)
+    {
+        const otbrTraceRecord &record = records[sequence % header.mRecordCount];
+
+        if (record.mSequence == static_cast<uint32_t>(sequence))
+        {
+            printRecord(record);
+        }
+    }
+
+    ret = 0;
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0;
+
+    VerifyOrExit(argc == 2, help(), ret = EX_USAGE);
+    ret = decodeTrace(argv[1]);
+
+exit:
+    return ret;
+}